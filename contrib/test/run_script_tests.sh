@@ -26,6 +26,9 @@ $UNIT_TEST/test_wksp_helper > $LOG_PATH/wksp_helper 2>&1 # allocates a gigantic
 $UNIT_TEST/test_cnc   --tile-cpus 0,2   2> $LOG_PATH/cnc
 $UNIT_TEST/test_tile  --tile-cpus 0-8/2 2> $LOG_PATH/tile_multi
 $UNIT_TEST/test_tpool --tile-cpus 0-7   2> $LOG_PATH/tpool_large
+if [ -x $UNIT_TEST/test_jit_cache ]; then
+  $UNIT_TEST/test_jit_cache --tile-cpus f3 2> $LOG_PATH/jit_cache_multi
+fi
 
 if $UNIT_TEST/test_ipc_init $OBJDIR && \
     $UNIT_TEST/test_ipc_meta 16     && \
@@ -52,6 +52,7 @@ $(call add-objs,run/tiles/fd_eqvoc,fd_fdctl)
 $(call add-objs,run/tiles/fd_rpcserv,fd_fdctl)
 $(call add-objs,run/tiles/fd_batch,fd_fdctl)
 $(call add-objs,run/tiles/fd_batch_thread,fd_fdctl)
+$(call add-objs,run/tiles/fd_archiver,fd_fdctl)
 endif
 
 # fdctl topologies
@@ -107,6 +108,7 @@ $(OBJDIR)/obj/app/fdctl/run/tiles/fd_replay.o: src/app/fdctl/run/tiles/generated
 $(OBJDIR)/obj/app/fdctl/run/tiles/fd_sender.o: src/app/fdctl/run/tiles/generated/sender_seccomp.h
 $(OBJDIR)/obj/app/fdctl/run/tiles/fd_eqvoc.o: src/app/fdctl/run/tiles/generated/eqvoc_seccomp.h
 $(OBJDIR)/obj/app/fdctl/run/tiles/fd_rpcserv.o: src/app/fdctl/run/tiles/generated/rpcserv_seccomp.h
+$(OBJDIR)/obj/app/fdctl/run/tiles/fd_archiver.o: src/app/fdctl/run/tiles/generated/archiver_seccomp.h
 $(OBJDIR)/obj/app/fdctl/run/tiles/fd_snaps.o: src/app/fdctl/run/tiles/generated/snapshot_seccomp.h
 endif
 
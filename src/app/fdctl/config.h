@@ -216,6 +216,7 @@ typedef struct {
       uint xdp_aio_depth;
 
       uint send_buffer_size;
+      int  zero_copy_rx;
 
       ulong multihome_ip_addrs_cnt; /* number of home ip addresses */
       char  multihome_ip_addrs[FD_NET_MAX_SRC_ADDR][32];
@@ -299,6 +300,7 @@ typedef struct {
       char  snapshot[ PATH_MAX ];
       char  status_cache[ PATH_MAX ];
       ulong tpool_thread_count;
+      char  txn_sched[ 16 ];
       char  cluster_version[ 32 ];
       int   in_wen_restart;
       char  tower_checkpt[ PATH_MAX ];
@@ -290,6 +290,7 @@ fdctl_pod_to_cfg( config_t * config,
   CFG_POP      ( uint,   tiles.net.xdp_tx_queue_size                      );
   CFG_POP      ( uint,   tiles.net.xdp_aio_depth                          );
   CFG_POP      ( uint,   tiles.net.send_buffer_size                       );
+  CFG_POP      ( bool,   tiles.net.zero_copy_rx                           );
   CFG_POP_ARRAY( cstr,   tiles.net.multihome_ip_addrs                     );
 
   CFG_POP      ( ushort, tiles.quic.regular_transaction_listen_port       );
@@ -386,6 +387,7 @@ fdctl_pod_to_cfg( config_t * config,
   CFG_POP      ( cstr,   tiles.replay.snapshot                            );
   CFG_POP      ( cstr,   tiles.replay.status_cache                        );
   CFG_POP      ( ulong,  tiles.replay.tpool_thread_count                  );
+  CFG_POP      ( cstr,   tiles.replay.txn_sched                           );
   CFG_POP      ( cstr,   tiles.replay.cluster_version                     );
   CFG_POP      ( bool,   tiles.replay.in_wen_restart                      );
   CFG_POP      ( cstr,   tiles.replay.tower_checkpt                       );
@@ -43,6 +43,7 @@ extern fd_topo_run_tile_t fd_tile_poh_int;
 extern fd_topo_run_tile_t fd_tile_sender;
 extern fd_topo_run_tile_t fd_tile_eqvoc;
 extern fd_topo_run_tile_t fd_tile_rpcserv;
+extern fd_topo_run_tile_t fd_tile_archiver;
 #endif
 
 fd_topo_run_tile_t * TILES[] = {
@@ -74,6 +75,7 @@ fd_topo_run_tile_t * TILES[] = {
   &fd_tile_sender,
   &fd_tile_eqvoc,
   &fd_tile_rpcserv,
+  &fd_tile_archiver,
 #endif
   NULL,
 };
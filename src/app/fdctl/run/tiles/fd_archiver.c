@@ -0,0 +1,149 @@
+/* Archiver tile writes out finalized blocks queued by replay (see
+   fd_blockstore_publish) to the blockstore archival file, compressing
+   them with a codec owned by the tile, such that replay never blocks on
+   compression or file I/O. */
+
+#define _GNU_SOURCE
+
+#include "../../../../disco/tiles.h"
+
+#include "generated/archiver_seccomp.h"
+
+#include "../../../../disco/topo/fd_pod_format.h"
+#include "../../../../flamenco/runtime/fd_blockstore.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+/* FD_ARCHIVER_FLUSH_MAX is the max number of blocks written out per
+   iteration of the run loop, so that housekeeping is not delayed when
+   the archive queue is long. */
+
+#define FD_ARCHIVER_FLUSH_MAX (1UL)
+
+struct fd_archiver_tile_ctx {
+  fd_blockstore_t *       blockstore;
+  int                     blockstore_fd; /* file descriptor for archival file */
+  fd_blockstore_codec_t * codec;
+};
+typedef struct fd_archiver_tile_ctx fd_archiver_tile_ctx_t;
+
+FD_FN_CONST static inline ulong
+scratch_align( void ) {
+  return 128UL;
+}
+
+FD_FN_PURE static inline ulong
+scratch_footprint( fd_topo_tile_t const * tile ) {
+  (void)tile;
+
+  ulong l = FD_LAYOUT_INIT;
+  l = FD_LAYOUT_APPEND( l, alignof(fd_archiver_tile_ctx_t), sizeof(fd_archiver_tile_ctx_t) );
+  l = FD_LAYOUT_APPEND( l, fd_blockstore_codec_align(),     fd_blockstore_codec_footprint( 1 ) );
+  return FD_LAYOUT_FINI( l, scratch_align() );
+}
+
+static inline void
+before_credit( fd_archiver_tile_ctx_t * ctx,
+               fd_stem_context_t *      stem,
+               int *                    charge_busy ) {
+  (void)stem;
+
+  *charge_busy = !!fd_blockstore_archive_flush( ctx->blockstore, ctx->blockstore_fd, ctx->codec, FD_ARCHIVER_FLUSH_MAX );
+}
+
+static void
+privileged_init( fd_topo_t *      topo,
+                 fd_topo_tile_t * tile ) {
+  void * scratch = fd_topo_obj_laddr( topo, tile->tile_obj_id );
+
+  FD_SCRATCH_ALLOC_INIT( l, scratch );
+  fd_archiver_tile_ctx_t * ctx = FD_SCRATCH_ALLOC_APPEND( l, alignof(fd_archiver_tile_ctx_t), sizeof(fd_archiver_tile_ctx_t) );
+  FD_SCRATCH_ALLOC_FINI( l, scratch_align() );
+
+  ctx->blockstore_fd = open( tile->archiver.blockstore_file, O_RDWR | O_CREAT, 0666 );
+  if( FD_UNLIKELY( ctx->blockstore_fd == -1 ) ) {
+    FD_LOG_ERR(( "failed to open or create blockstore archival file %s %d %d %s", tile->archiver.blockstore_file, ctx->blockstore_fd, errno, strerror(errno) ));
+  }
+}
+
+static void
+unprivileged_init( fd_topo_t *      topo,
+                   fd_topo_tile_t * tile ) {
+  void * scratch = fd_topo_obj_laddr( topo, tile->tile_obj_id );
+
+  if( FD_UNLIKELY( tile->in_cnt || tile->out_cnt ) )
+    FD_LOG_ERR(( "archiver tile has unexpected links %lu %lu", tile->in_cnt, tile->out_cnt ));
+
+  FD_SCRATCH_ALLOC_INIT( l, scratch );
+  fd_archiver_tile_ctx_t * ctx = FD_SCRATCH_ALLOC_APPEND( l, alignof(fd_archiver_tile_ctx_t), sizeof(fd_archiver_tile_ctx_t) );
+  void * codec_mem             = FD_SCRATCH_ALLOC_APPEND( l, fd_blockstore_codec_align(),     fd_blockstore_codec_footprint( 1 ) );
+  ulong scratch_top = FD_SCRATCH_ALLOC_FINI( l, scratch_align() );
+  if( FD_UNLIKELY( scratch_top > (ulong)scratch + scratch_footprint( tile ) ) )
+    FD_LOG_ERR(( "scratch overflow %lu %lu %lu", scratch_top - (ulong)scratch - scratch_footprint( tile ), scratch_top, (ulong)scratch + scratch_footprint( tile ) ));
+
+  ctx->codec = fd_blockstore_codec_new( codec_mem, 1 );
+  if( FD_UNLIKELY( !ctx->codec ) ) FD_LOG_ERR(( "failed to create blockstore codec" ));
+
+  ulong blockstore_obj_id = fd_pod_queryf_ulong( topo->props, ULONG_MAX, "blockstore" );
+  FD_TEST( blockstore_obj_id!=ULONG_MAX );
+  ctx->blockstore = fd_blockstore_join( fd_topo_obj_laddr( topo, blockstore_obj_id ) );
+  FD_TEST( ctx->blockstore!=NULL );
+}
+
+static ulong
+populate_allowed_seccomp( fd_topo_t const *      topo,
+                          fd_topo_tile_t const * tile,
+                          ulong                  out_cnt,
+                          struct sock_filter *   out ) {
+  void * scratch = fd_topo_obj_laddr( topo, tile->tile_obj_id );
+
+  FD_SCRATCH_ALLOC_INIT( l, scratch );
+  fd_archiver_tile_ctx_t * ctx = FD_SCRATCH_ALLOC_APPEND( l, alignof(fd_archiver_tile_ctx_t), sizeof(fd_archiver_tile_ctx_t) );
+  FD_SCRATCH_ALLOC_FINI( l, scratch_align() );
+
+  populate_sock_filter_policy_archiver( out_cnt, out, (uint)fd_log_private_logfile_fd(), (uint)ctx->blockstore_fd );
+  return sock_filter_policy_archiver_instr_cnt;
+}
+
+static ulong
+populate_allowed_fds( fd_topo_t const *      topo,
+                      fd_topo_tile_t const * tile,
+                      ulong                  out_fds_cnt,
+                      int *                  out_fds ) {
+  void * scratch = fd_topo_obj_laddr( topo, tile->tile_obj_id );
+
+  FD_SCRATCH_ALLOC_INIT( l, scratch );
+  fd_archiver_tile_ctx_t * ctx = FD_SCRATCH_ALLOC_APPEND( l, alignof(fd_archiver_tile_ctx_t), sizeof(fd_archiver_tile_ctx_t) );
+  FD_SCRATCH_ALLOC_FINI( l, scratch_align() );
+
+  if( FD_UNLIKELY( out_fds_cnt<3UL ) ) FD_LOG_ERR(( "out_fds_cnt %lu", out_fds_cnt ));
+
+  ulong out_cnt = 0UL;
+  out_fds[ out_cnt++ ] = STDERR_FILENO;
+  if( FD_LIKELY( -1!=fd_log_private_logfile_fd() ) )
+    out_fds[ out_cnt++ ] = fd_log_private_logfile_fd(); /* logfile */
+  out_fds[ out_cnt++ ] = ctx->blockstore_fd;
+  return out_cnt;
+}
+
+#define STEM_BURST (1UL)
+
+#define STEM_CALLBACK_CONTEXT_TYPE  fd_archiver_tile_ctx_t
+#define STEM_CALLBACK_CONTEXT_ALIGN alignof(fd_archiver_tile_ctx_t)
+
+#define STEM_CALLBACK_BEFORE_CREDIT before_credit
+
+#include "../../../../disco/stem/fd_stem.c"
+
+fd_topo_run_tile_t fd_tile_archiver = {
+  .name                     = "archiv",
+  .populate_allowed_seccomp = populate_allowed_seccomp,
+  .populate_allowed_fds     = populate_allowed_fds,
+  .scratch_align            = scratch_align,
+  .scratch_footprint        = scratch_footprint,
+  .privileged_init          = privileged_init,
+  .unprivileged_init        = unprivileged_init,
+  .run                      = stem_run,
+};
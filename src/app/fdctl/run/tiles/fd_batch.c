@@ -33,8 +33,6 @@ struct fd_snapshot_tile_ctx {
   fd_funk_t     * funk;
 
   /* File descriptors used for snapshot generation. */
-  int             tmp_fd;
-  int             tmp_inc_fd;
   int             full_snapshot_fd;
   int             incremental_snapshot_fd;
 
@@ -108,20 +106,8 @@ privileged_init( fd_topo_t      * topo FD_PARAM_UNUSED,
   /* First open the relevant files here. TODO: We eventually want to extend
      this to support multiple files. */
 
-  char tmp_dir_buf[ FD_SNAPSHOT_DIR_MAX ];
-  int err = snprintf( tmp_dir_buf, FD_SNAPSHOT_DIR_MAX, "%s/%s", tile->batch.out_dir, FD_SNAPSHOT_TMP_ARCHIVE );
-  if( FD_UNLIKELY( err<0 ) ) {
-    FD_LOG_ERR(( "Failed to format directory string" ));
-  }
-
-  char tmp_inc_dir_buf[ FD_SNAPSHOT_DIR_MAX ];
-  err = snprintf( tmp_inc_dir_buf, FD_SNAPSHOT_DIR_MAX, "%s/%s", tile->batch.out_dir, FD_SNAPSHOT_TMP_INCR_ARCHIVE );
-  if( FD_UNLIKELY( err<0 ) ) {
-    FD_LOG_ERR(( "Failed to format directory string" ));
-  }
-
   char zstd_dir_buf[ FD_SNAPSHOT_DIR_MAX ];
-  err = snprintf( zstd_dir_buf, FD_SNAPSHOT_DIR_MAX, "%s/%s", tile->batch.out_dir, FD_SNAPSHOT_TMP_FULL_ARCHIVE_ZSTD );
+  int err = snprintf( zstd_dir_buf, FD_SNAPSHOT_DIR_MAX, "%s/%s", tile->batch.out_dir, FD_SNAPSHOT_TMP_FULL_ARCHIVE_ZSTD );
   if( FD_UNLIKELY( err<0 ) ) {
     FD_LOG_ERR(( "Failed to format directory string" ));
   }
@@ -134,16 +120,6 @@ privileged_init( fd_topo_t      * topo FD_PARAM_UNUSED,
 
   /* Create and open the relevant files for snapshots. */
 
-  tile->batch.tmp_fd = open( tmp_dir_buf, O_CREAT | O_RDWR | O_TRUNC, 0644 );
-  if( FD_UNLIKELY( tile->batch.tmp_fd==-1 ) ) {
-    FD_LOG_ERR(( "Failed to open and create tarball for file=%s (%i-%s)", tmp_dir_buf, errno, fd_io_strerror( errno ) ));
-  }
-
-  tile->batch.tmp_inc_fd = open( tmp_inc_dir_buf, O_CREAT | O_RDWR | O_TRUNC, 0644 );
-  if( FD_UNLIKELY( tile->batch.tmp_inc_fd==-1 ) ) {
-    FD_LOG_ERR(( "Failed to open and create tarball for file=%s (%i-%s)", tmp_dir_buf, errno, fd_io_strerror( errno ) ));
-  }
-
   tile->batch.full_snapshot_fd = open( zstd_dir_buf, O_RDWR | O_CREAT | O_TRUNC, 0644 );
   if( FD_UNLIKELY( tile->batch.full_snapshot_fd==-1 ) ) {
     FD_LOG_WARNING(( "Failed to open the snapshot file (%i-%s)", errno, fd_io_strerror( errno ) ));
@@ -183,8 +159,6 @@ unprivileged_init( fd_topo_t      * topo FD_PARAM_UNUSED,
   ctx->full_interval           = tile->batch.full_interval;
   ctx->incremental_interval    = tile->batch.incremental_interval;
   ctx->out_dir                 = tile->batch.out_dir;
-  ctx->tmp_fd                  = tile->batch.tmp_fd;
-  ctx->tmp_inc_fd              = tile->batch.tmp_inc_fd;
   ctx->full_snapshot_fd        = tile->batch.full_snapshot_fd;
   ctx->incremental_snapshot_fd = tile->batch.incremental_snapshot_fd;
 
@@ -303,7 +277,6 @@ produce_snapshot( fd_snapshot_tile_ctx_t * ctx, ulong batch_fseq ) {
     .is_incremental           = (uchar)is_incremental,
     .funk                     = ctx->funk,
     .status_cache             = ctx->status_cache,
-    .tmp_fd                   = is_incremental ? ctx->tmp_inc_fd              : ctx->tmp_fd,
     .snapshot_fd              = is_incremental ? ctx->incremental_snapshot_fd : ctx->full_snapshot_fd,
     .tpool                    = ctx->tpool,
     /* These parameters are ignored if the snapshot is not incremental. */
@@ -342,21 +315,11 @@ produce_snapshot( fd_snapshot_tile_ctx_t * ctx, ulong batch_fseq ) {
   }
   FD_LOG_NOTICE(( "Renaming file from %s to %s", prev_filename, new_filename ));
 
-  err = ftruncate( snapshot_ctx.tmp_fd, 0UL );
-  if( FD_UNLIKELY( err==-1 ) ) {
-    FD_LOG_ERR(( "Failed to truncate the temporary file (%i-%s)", errno, fd_io_strerror( errno ) ));
-  }
-
   err = ftruncate( snapshot_ctx.snapshot_fd, 0UL );
   if( FD_UNLIKELY( err==-1 ) ) {
     FD_LOG_ERR(( "Failed to truncate the snapshot file (%i-%s)", errno, fd_io_strerror( errno ) ));
   }
 
-  long seek = lseek( snapshot_ctx.tmp_fd, 0UL, SEEK_SET );
-  if( FD_UNLIKELY( seek!=0L ) ) {
-    FD_LOG_ERR(( "Failed to seek to the beginning of the file" ));
-  }
-
   /* Now that the files are in an expected state, create the snapshot. */
   FD_SCRATCH_SCOPE_BEGIN {
     snapshot_ctx.valloc = fd_scratch_virtual();
@@ -514,8 +477,6 @@ populate_allowed_seccomp( fd_topo_t const *      topo,
   populate_sock_filter_policy_batch( out_cnt,
                                      out,
                                      (uint)fd_log_private_logfile_fd(),
-                                     (uint)tile->batch.tmp_fd,
-                                     (uint)tile->batch.tmp_inc_fd,
                                      (uint)tile->batch.full_snapshot_fd,
                                      (uint)tile->batch.incremental_snapshot_fd );
   return sock_filter_policy_batch_instr_cnt;
@@ -537,8 +498,6 @@ populate_allowed_fds( fd_topo_t const *      topo,
   if( FD_LIKELY( -1!=fd_log_private_logfile_fd() ) )
     out_fds[ out_cnt++ ] = fd_log_private_logfile_fd(); /* logfile */
 
-  out_fds[ out_cnt++ ] = tile->batch.tmp_fd;
-  out_fds[ out_cnt++ ] = tile->batch.tmp_inc_fd;
   out_fds[ out_cnt++ ] = tile->batch.full_snapshot_fd;
   out_fds[ out_cnt++ ] = tile->batch.incremental_snapshot_fd;
   return out_cnt;
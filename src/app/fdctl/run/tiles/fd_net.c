@@ -46,12 +46,21 @@
 #include "../../../../util/log/fd_dtrace.h"
 #include "../../../../util/net/fd_ip4.h"
 #include "../../../../waltz/ip/fd_ip.h"
+#include "../../../../waltz/quic/fd_quic_conn_id.h"
 
 #include <unistd.h>
 #include <linux/unistd.h>
 
 #define MAX_NET_INS (32UL)
 
+/* MAX_NET_OUT_CONS is the max number of reliable consumers of an out
+   link, only tracked with zero_copy_rx. */
+#define MAX_NET_OUT_CONS (64UL)
+
+/* NET_RX_REL_BATCH is the number of frames given back to an xsk at
+   once with zero_copy_rx. */
+#define NET_RX_REL_BATCH (64UL)
+
 typedef struct {
   fd_wksp_t * mem;
   ulong       chunk0;
@@ -68,6 +77,18 @@ typedef struct {
   ulong       chunk0;
   ulong       wmark;
   ulong       chunk;
+
+  /* With zero_copy_rx, frags are published in place in the UMEM and
+     the frames of frags in [rel_seq,seq) are not given back to the
+     kernel yet.  An unreliable consumer can only detect that a frag
+     was overwritten through its mcache line, so if the link has any
+     (cons_unreliable), frames are only given back when their line gets
+     reused.  Otherwise, they are given back as soon as all reliable
+     consumers (cons_fseq) moved past them. */
+  ulong         rel_seq;
+  int           cons_unreliable;
+  ulong         cons_cnt;
+  ulong const * cons_fseq[ MAX_NET_OUT_CONS ];
 } fd_net_out_ctx_t;
 
 typedef struct {
@@ -102,6 +123,14 @@ typedef struct {
   fd_net_out_ctx_t gossip_out[1];
   fd_net_out_ctx_t repair_out[1];
 
+  int                zero_copy_rx;
+  uchar *            umem;     /* UMEM of xsk[0], followed by the one of xsk[1] */
+  ulong              umem_sz;  /* UMEM footprint of an xsk */
+  ulong              zc_out_cnt;
+  fd_net_out_ctx_t * zc_out[ 4 ];
+  ulong              rx_rel_cnt[ 2 ];
+  ulong              rx_rel_off[ 2 ][ NET_RX_REL_BATCH ];
+
   fd_ip_t *   ip;
   long        ip_next_upd;
 
@@ -115,6 +144,21 @@ scratch_align( void ) {
   return 4096UL;
 }
 
+FD_FN_PURE static inline ulong
+umem_footprint( fd_topo_tile_t const * tile ) {
+  return fd_xsk_umem_footprint( FD_NET_MTU, tile->net.xdp_rx_queue_size, tile->net.xdp_rx_queue_size, tile->net.xdp_tx_queue_size, tile->net.xdp_tx_queue_size );
+}
+
+/* xsk_footprint is the scratch footprint of an xsk.  With zero_copy_rx
+   the UMEM lives in a dcache shared with the consumers instead. */
+
+FD_FN_PURE static inline ulong
+xsk_footprint( fd_topo_tile_t const * tile ) {
+  ulong footprint = fd_xsk_footprint( FD_NET_MTU, tile->net.xdp_rx_queue_size, tile->net.xdp_rx_queue_size, tile->net.xdp_tx_queue_size, tile->net.xdp_tx_queue_size );
+  if( FD_UNLIKELY( tile->net.zero_copy_rx ) ) footprint -= umem_footprint( tile );
+  return footprint;
+}
+
 FD_FN_PURE static inline ulong
 scratch_footprint( fd_topo_tile_t const * tile ) {
   /* TODO reproducing this conditional memory layout twice is susceptible to bugs. Use more robust object discovery */
@@ -122,16 +166,46 @@ scratch_footprint( fd_topo_tile_t const * tile ) {
   ulong l = FD_LAYOUT_INIT;
   l = FD_LAYOUT_APPEND( l, alignof(fd_net_ctx_t), sizeof(fd_net_ctx_t) );
   l = FD_LAYOUT_APPEND( l, fd_aio_align(),        fd_aio_footprint() );
-  l = FD_LAYOUT_APPEND( l, fd_xsk_align(),        fd_xsk_footprint( FD_NET_MTU, tile->net.xdp_rx_queue_size, tile->net.xdp_rx_queue_size, tile->net.xdp_tx_queue_size, tile->net.xdp_tx_queue_size ) );
+  l = FD_LAYOUT_APPEND( l, fd_xsk_align(),        xsk_footprint( tile ) );
   l = FD_LAYOUT_APPEND( l, fd_xsk_aio_align(),    fd_xsk_aio_footprint( tile->net.xdp_tx_queue_size, tile->net.xdp_aio_depth ) );
   if( FD_UNLIKELY( strcmp( tile->net.interface, "lo" ) && tile->kind_id == 0 ) ) {
-    l = FD_LAYOUT_APPEND( l, fd_xsk_align(),      fd_xsk_footprint( FD_NET_MTU, tile->net.xdp_rx_queue_size, tile->net.xdp_rx_queue_size, tile->net.xdp_tx_queue_size, tile->net.xdp_tx_queue_size ) );
+    l = FD_LAYOUT_APPEND( l, fd_xsk_align(),      xsk_footprint( tile ) );
     l = FD_LAYOUT_APPEND( l, fd_xsk_aio_align(),  fd_xsk_aio_footprint( tile->net.xdp_tx_queue_size, tile->net.xdp_aio_depth ) );
   }
   l = FD_LAYOUT_APPEND( l, fd_ip_align(),         fd_ip_footprint( 0UL, 0UL ) );
   return FD_LAYOUT_FINI( l, scratch_align() );
 }
 
+/* net_rx_release gives the frame holding packet back to the xsk it
+   was received on (zero_copy_rx only).  Frames are handed back in
+   batches, net_rx_release_flush hands back the current batch. */
+
+static void
+net_rx_release_flush( fd_net_ctx_t * ctx ) {
+  for( ulong i=0UL; i<ctx->xsk_cnt; i++ ) {
+    if( FD_LIKELY( ctx->rx_rel_cnt[ i ] ) ) fd_xsk_aio_rx_release( ctx->xsk_aio[ i ], ctx->rx_rel_off[ i ], ctx->rx_rel_cnt[ i ] );
+    ctx->rx_rel_cnt[ i ] = 0UL;
+  }
+}
+
+static inline void
+net_rx_release( fd_net_ctx_t * ctx,
+                uchar const *  packet ) {
+  ulong off = (ulong)packet - (ulong)ctx->umem;
+  ulong idx = (ulong)( off>=ctx->umem_sz );
+  ctx->rx_rel_off[ idx ][ ctx->rx_rel_cnt[ idx ]++ ] = off - idx*ctx->umem_sz;
+  if( FD_UNLIKELY( ctx->rx_rel_cnt[ idx ]==NET_RX_REL_BATCH ) ) net_rx_release_flush( ctx );
+}
+
+/* net_out_rel_frag returns the payload of the oldest frag published to
+   out whose frame was not released yet. */
+
+static inline uchar const *
+net_out_rel_frag( fd_net_out_ctx_t const * out ) {
+  fd_frag_meta_t const * line = out->mcache + fd_mcache_line_idx( out->rel_seq, out->depth );
+  return fd_chunk_to_laddr_const( out->mem, line->chunk );
+}
+
 /* net_rx_aio_send is a callback invoked by aio when new data is
    received on an incoming xsk.  The xsk might be bound to any interface
    or ports, so the purpose of this callback is to determine if the
@@ -177,6 +251,7 @@ net_rx_aio_send( void *                    _ctx,
     /* Ignore if UDP header is too short */
     if( FD_UNLIKELY( udp+8U > packet_end ) ) {
       FD_DTRACE_PROBE( net_tile_err_rx_undersz );
+      if( FD_UNLIKELY( ctx->zero_copy_rx ) ) net_rx_release( ctx, packet );
       continue;
     }
 
@@ -224,16 +299,47 @@ net_rx_aio_send( void *                    _ctx,
                    ctx->repair_serve_listen_port ));
     }
 
-    fd_memcpy( fd_chunk_to_laddr( out->mem, out->chunk ), packet, batch[ i ].buf_sz );
-
     /* tile can decide how to partition based on src ip addr and src port */
     ulong sig = fd_disco_netmux_sig( ip_srcaddr, udp_srcport, 0U, proto, 14UL+8UL+iplen );
 
+    /* QUIC short header packets must go to the quic tile owning the
+       conn, which tagged its conn IDs with its tile index.  Steer by
+       the dst conn ID instead.  Long header packets (handshakes) keep
+       the src address hash, which is also how the owner was picked. */
+    if( proto==DST_PROTO_TPU_QUIC ) {
+      uchar const * payload = udp+8UL;
+      int shard = fd_quic_pkt_shard( payload, (ulong)( packet_end-payload ) );
+      if( shard>=0 ) sig = fd_disco_netmux_sig_set_hash( sig, (ulong)shard );
+    }
+
     ulong tspub  = (ulong)fd_frag_meta_ts_comp( fd_tickcount() );
-    fd_mcache_publish( out->mcache, out->depth, out->seq, sig, out->chunk, batch[ i ].buf_sz, 0, 0, tspub );
+
+    if( FD_LIKELY( !ctx->zero_copy_rx ) ) {
+      fd_memcpy( fd_chunk_to_laddr( out->mem, out->chunk ), packet, batch[ i ].buf_sz );
+      fd_mcache_publish( out->mcache, out->depth, out->seq, sig, out->chunk, batch[ i ].buf_sz, 0, 0, tspub );
+      out->chunk = fd_dcache_compact_next( out->chunk, FD_NET_MTU, out->chunk0, out->wmark );
+    } else {
+      /* Publish the packet in place.  Frags start at a chunk boundary,
+         which the kernel's headroom usually is. */
+      uchar * frag = (uchar *)fd_ulong_align_dn( (ulong)packet, FD_CHUNK_ALIGN );
+      if( FD_UNLIKELY( frag!=packet ) ) memmove( frag, packet, batch[ i ].buf_sz );
+
+      /* If consumers are a full mcache behind, overrun them.  The
+         frame of the frag being overwritten can only be reused once
+         the line is overwritten, such that consumers still reading it
+         detect the overrun. */
+      uchar const * evicted = NULL;
+      if( FD_UNLIKELY( fd_seq_diff( out->seq, out->rel_seq )>=(long)out->depth ) ) evicted = net_out_rel_frag( out );
+
+      fd_mcache_publish( out->mcache, out->depth, out->seq, sig, fd_laddr_to_chunk( out->mem, frag ), batch[ i ].buf_sz, 0, 0, tspub );
+
+      if( FD_UNLIKELY( evicted ) ) {
+        net_rx_release( ctx, evicted );
+        out->rel_seq = fd_seq_inc( out->rel_seq, 1UL );
+      }
+    }
 
     out->seq = fd_seq_inc( out->seq, 1UL );
-    out->chunk = fd_dcache_compact_next( out->chunk, FD_NET_MTU, out->chunk0, out->wmark );
   }
 
   if( FD_LIKELY( opt_batch_idx ) ) {
@@ -275,6 +381,28 @@ before_credit( fd_net_ctx_t *      ctx,
       *charge_busy = 1;
     }
   }
+
+  if( FD_UNLIKELY( ctx->zero_copy_rx ) ) {
+    /* Give back the frames of frags all reliable consumers are done
+       with.  An fseq is ULONG_MAX until its consumer booted, which
+       compares as behind any seq.  Links with unreliable consumers
+       only give frames back in net_rx_aio_send, when lines are
+       reused. */
+    for( ulong i=0UL; i<ctx->zc_out_cnt; i++ ) {
+      fd_net_out_ctx_t * out = ctx->zc_out[ i ];
+      if( FD_UNLIKELY( out->cons_unreliable ) ) continue;
+      ulong rel_end = out->seq;
+      for( ulong j=0UL; j<out->cons_cnt; j++ ) {
+        ulong cons_seq = fd_fseq_query( out->cons_fseq[ j ] );
+        if( FD_UNLIKELY( fd_seq_lt( cons_seq, rel_end ) ) ) rel_end = cons_seq;
+      }
+      while( fd_seq_lt( out->rel_seq, rel_end ) ) {
+        net_rx_release( ctx, net_out_rel_frag( out ) );
+        out->rel_seq = fd_seq_inc( out->rel_seq, 1UL );
+      }
+    }
+    net_rx_release_flush( ctx );
+  }
 }
 
 struct xdp_statistics_v0 {
@@ -535,19 +663,39 @@ privileged_init( fd_topo_t *      topo,
   uint if_idx = if_nametoindex( tile->net.interface );
   if( FD_UNLIKELY( !if_idx ) ) FD_LOG_ERR(( "if_nametoindex(%s) failed", tile->net.interface ));
 
+  /* Networking tile at index 0 also binds to loopback (see below) */
+
+  ctx->xsk_cnt = fd_ulong_if( strcmp( tile->net.interface, "lo" ) && !tile->kind_id, 2UL, 1UL );
+
+  /* With zero_copy_rx, the UMEMs of the xsks are in the dcache backing
+     all out links (see setup_topo_net_umem), aligned as the kernel
+     requires. */
+
+  ctx->zero_copy_rx = tile->net.zero_copy_rx;
+  ctx->umem         = NULL;
+  ctx->umem_sz      = umem_footprint( tile );
+  if( FD_UNLIKELY( ctx->zero_copy_rx ) ) {
+    uchar * dcache = fd_dcache_join( fd_topo_obj_laddr( topo, tile->net.umem_dcache_obj_id ) );
+    if( FD_UNLIKELY( !dcache ) ) FD_LOG_ERR(( "fd_dcache_join failed" ));
+    ctx->umem = (uchar *)fd_ulong_align_up( (ulong)dcache, FD_XSK_UMEM_ALIGN );
+    if( FD_UNLIKELY( ctx->umem + ctx->xsk_cnt*ctx->umem_sz > dcache + fd_dcache_data_sz( dcache ) ) )
+      FD_LOG_ERR(( "UMEM dcache too small for %lu xsks", ctx->xsk_cnt ));
+  }
+
   /* Create and install XSKs */
 
   int xsk_map_fd = 123462;
   ctx->prog_link_fds[ 0 ] = 123463;
   ctx->xsk[ 0 ] =
       fd_xsk_join(
-      fd_xsk_new( FD_SCRATCH_ALLOC_APPEND( l, fd_xsk_align(), fd_xsk_footprint( FD_NET_MTU, tile->net.xdp_rx_queue_size, tile->net.xdp_rx_queue_size, tile->net.xdp_tx_queue_size, tile->net.xdp_tx_queue_size ) ),
+      fd_xsk_new( FD_SCRATCH_ALLOC_APPEND( l, fd_xsk_align(), xsk_footprint( tile ) ),
                   FD_NET_MTU,
                   tile->net.xdp_rx_queue_size,
                   tile->net.xdp_rx_queue_size,
                   tile->net.xdp_tx_queue_size,
                   tile->net.xdp_tx_queue_size ) );
   if( FD_UNLIKELY( !ctx->xsk[ 0 ] ) )                                                    FD_LOG_ERR(( "fd_xsk_new failed" ));
+  if( FD_UNLIKELY( ctx->umem && !fd_xsk_set_umem( ctx->xsk[ 0 ], ctx->umem ) ) )         FD_LOG_ERR(( "fd_xsk_set_umem failed" ));
   uint flags = tile->net.zero_copy ? XDP_ZEROCOPY : XDP_COPY;
   if( FD_UNLIKELY( !fd_xsk_init( ctx->xsk[ 0 ], if_idx, (uint)tile->kind_id, flags ) ) ) FD_LOG_ERR(( "failed to bind xsk for net tile %lu", tile->kind_id ));
   if( FD_UNLIKELY( !fd_xsk_activate( ctx->xsk[ 0 ], xsk_map_fd ) ) )                     FD_LOG_ERR(( "failed to activate xsk for net tile %lu", tile->kind_id ));
@@ -566,8 +714,7 @@ privileged_init( fd_topo_t *      topo,
 
   /* Networking tile at index 0 also binds to loopback (only queue 0 available on lo) */
 
-  if( FD_UNLIKELY( strcmp( tile->net.interface, "lo" ) && !tile->kind_id ) ) {
-    ctx->xsk_cnt = 2;
+  if( FD_UNLIKELY( ctx->xsk_cnt>1UL ) ) {
 
     ushort udp_port_candidates[] = {
       (ushort)tile->net.legacy_transaction_listen_port,
@@ -590,13 +737,14 @@ privileged_init( fd_topo_t *      topo,
     ctx->prog_link_fds[ 1 ] = lo_fds.prog_link_fd;
     ctx->xsk[ 1 ] =
         fd_xsk_join(
-        fd_xsk_new( FD_SCRATCH_ALLOC_APPEND( l, fd_xsk_align(), fd_xsk_footprint( FD_NET_MTU, tile->net.xdp_rx_queue_size, tile->net.xdp_rx_queue_size, tile->net.xdp_tx_queue_size, tile->net.xdp_tx_queue_size ) ),
+        fd_xsk_new( FD_SCRATCH_ALLOC_APPEND( l, fd_xsk_align(), xsk_footprint( tile ) ),
                     FD_NET_MTU,
                     tile->net.xdp_rx_queue_size,
                     tile->net.xdp_rx_queue_size,
                     tile->net.xdp_tx_queue_size,
                     tile->net.xdp_tx_queue_size ) );
     if( FD_UNLIKELY( !ctx->xsk[ 1 ] ) )                                                            FD_LOG_ERR(( "fd_xsk_join failed" ));
+    if( FD_UNLIKELY( ctx->umem && !fd_xsk_set_umem( ctx->xsk[ 1 ], ctx->umem + ctx->umem_sz ) ) )  FD_LOG_ERR(( "fd_xsk_set_umem failed" ));
     if( FD_UNLIKELY( !fd_xsk_init( ctx->xsk[ 1 ], lo_idx, (uint)tile->kind_id, 0 /* flags */ ) ) ) FD_LOG_ERR(( "failed to bind lo_xsk" ));
     if( FD_UNLIKELY( !fd_xsk_activate( ctx->xsk[ 1 ], lo_fds.xsk_map_fd ) ) )                          FD_LOG_ERR(( "failed to activate lo_xsk" ));
     if( FD_UNLIKELY( -1==close( lo_fds.xsk_map_fd ) ) )                                                FD_LOG_ERR(( "close(%d) failed (%d-%s)", xsk_map_fd, errno, fd_io_strerror( errno ) ));
@@ -625,13 +773,18 @@ unprivileged_init( fd_topo_t *      topo,
   ctx->round_robin_id  = tile->kind_id;
 
   fd_xsk_aio_set_rx( ctx->xsk_aio[ 0 ], net_rx_aio );
+  fd_xsk_aio_set_rx_defer( ctx->xsk_aio[ 0 ], ctx->zero_copy_rx );
   ctx->tx = fd_xsk_aio_get_tx( ctx->xsk_aio[ 0 ] );
 
   if( FD_UNLIKELY( ctx->xsk_cnt>1UL ) ) {
     fd_xsk_aio_set_rx( ctx->xsk_aio[ 1 ], net_rx_aio );
+    fd_xsk_aio_set_rx_defer( ctx->xsk_aio[ 1 ], ctx->zero_copy_rx );
     ctx->lo_tx = fd_xsk_aio_get_tx( ctx->xsk_aio[ 1 ] );
   }
 
+  ctx->rx_rel_cnt[ 0 ] = 0UL;
+  ctx->rx_rel_cnt[ 1 ] = 0UL;
+
   ctx->src_ip_addr = tile->net.src_ip_addr;
   memcpy( ctx->src_mac_addr, tile->net.src_mac_addr, 6UL );
 
@@ -706,6 +859,37 @@ unprivileged_init( fd_topo_t *      topo,
     }
   }
 
+  /* With zero_copy_rx, find the fseqs of the reliable consumers of
+     each out link, which the topology gave us read access to. */
+
+  ctx->zc_out_cnt = 0UL;
+  for( ulong i=0UL; ctx->zero_copy_rx && i<tile->out_cnt; i++ ) {
+    fd_topo_link_t *   out_link = &topo->links[ tile->out_link_id[ i ] ];
+    fd_net_out_ctx_t * out;
+    if(      !strcmp( out_link->name, "net_quic"   ) ) out = ctx->quic_out;
+    else if( !strcmp( out_link->name, "net_shred"  ) ) out = ctx->shred_out;
+    else if( !strcmp( out_link->name, "net_gossip" ) ) out = ctx->gossip_out;
+    else                                               out = ctx->repair_out;
+
+    out->rel_seq         = out->seq;
+    out->cons_unreliable = 0;
+    out->cons_cnt        = 0UL;
+    for( ulong j=0UL; j<topo->tile_cnt; j++ ) {
+      fd_topo_tile_t const * consumer = &topo->tiles[ j ];
+      for( ulong k=0UL; k<consumer->in_cnt; k++ ) {
+        if( FD_LIKELY( consumer->in_link_id[ k ]!=out_link->id ) ) continue;
+        if( !consumer->in_link_reliable[ k ] ) {
+          out->cons_unreliable = 1;
+          continue;
+        }
+        if( FD_UNLIKELY( out->cons_cnt>=MAX_NET_OUT_CONS ) ) FD_LOG_ERR(( "out link `%s` has too many reliable consumers", out_link->name ));
+        FD_TEST( consumer->in_link_fseq[ k ] );
+        out->cons_fseq[ out->cons_cnt++ ] = consumer->in_link_fseq[ k ];
+      }
+    }
+    ctx->zc_out[ ctx->zc_out_cnt++ ] = out;
+  }
+
   /* Check if any of the tiles we set a listen port for do not have an outlink. */
   if( FD_UNLIKELY( ctx->shred_listen_port!=0 && ctx->shred_out->mcache==NULL ) ) {
     FD_LOG_ERR(( "shred listen port set but no out link was found" ));
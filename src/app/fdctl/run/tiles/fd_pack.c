@@ -219,6 +219,7 @@ typedef struct {
   fd_histf_t no_sched_duration[ 1 ];
   fd_histf_t insert_duration  [ 1 ];
   fd_histf_t complete_duration[ 1 ];
+  fd_histf_t microblocks_per_schedule[ 1 ];
 
   struct {
     uint metric_state;
@@ -289,6 +290,7 @@ metrics_write( fd_pack_ctx_t * ctx ) {
   FD_MHIST_COPY( PACK, NO_SCHED_MICROBLOCK_DURATION_SECONDS, ctx->no_sched_duration );
   FD_MHIST_COPY( PACK, INSERT_TRANSACTION_DURATION_SECONDS,  ctx->insert_duration   );
   FD_MHIST_COPY( PACK, COMPLETE_MICROBLOCK_DURATION_SECONDS, ctx->complete_duration );
+  FD_MHIST_COPY( PACK, MICROBLOCKS_PER_SCHEDULE_COUNT,       ctx->microblocks_per_schedule );
 
   fd_pack_metrics_write( ctx->pack );
 }
@@ -477,24 +479,45 @@ after_credit( fd_pack_ctx_t *     ctx,
 
   *charge_busy = 1;
 
-  /* Try to schedule the next microblock.  Do we have any idle bank
-     tiles in the first `pacing_bank_cnt`? */
-  if( FD_LIKELY( ctx->bank_idle_bitset & fd_ulong_mask_lsb( pacing_bank_cnt ) ) ) { /* Optimize for schedule */
+  /* Try to schedule the next microblocks.  Do we have any idle bank
+     tiles in the first `pacing_bank_cnt`?  If several of them are idle,
+     schedule a microblock for each of them in one go, which packs them
+     better than scheduling one bank tile at a time, as long as we have
+     the credits to publish them all. */
+  ulong sched_bitset = ctx->bank_idle_bitset & fd_ulong_mask_lsb( pacing_bank_cnt );
+  if( FD_LIKELY( sched_bitset ) ) { /* Optimize for schedule */
     any_ready = 1;
 
-    int i               = fd_ulong_find_lsb( ctx->bank_idle_bitset );
-
-    /* You can maybe make the case that this should happen as soon
-       as we detect the bank has become idle, but doing it now probably
-       helps with account locality. */
-    long complete_duration = -fd_tickcount();
-    int completed = fd_pack_microblock_complete( ctx->pack, (ulong)i );
-    complete_duration      += fd_tickcount();
-    if( FD_LIKELY( completed ) ) fd_histf_sample( ctx->complete_duration, (ulong)complete_duration );
+    ulong        sched_cnt = 0UL;
+    ulong        sched_bank[ FD_PACK_PACK_MAX_OUT ];
+    ulong        sched_chunk[ FD_PACK_PACK_MAX_OUT ];
+    fd_txn_p_t * sched_dst[ FD_PACK_PACK_MAX_OUT ];
+    ulong        sched_txn_cnt[ FD_PACK_PACK_MAX_OUT ];
+
+    ulong chunk     = ctx->out_chunk;
+    ulong sched_max = fd_ulong_min( *stem->cr_avail, FD_PACK_PACK_MAX_OUT );
+    for( ; sched_bitset && sched_cnt<sched_max; sched_bitset=fd_ulong_pop_lsb( sched_bitset ) ) {
+      ulong i = (ulong)fd_ulong_find_lsb( sched_bitset );
+
+      /* You can maybe make the case that this should happen as soon
+         as we detect the bank has become idle, but doing it now probably
+         helps with account locality. */
+      long complete_duration = -fd_tickcount();
+      int completed = fd_pack_microblock_complete( ctx->pack, i );
+      complete_duration      += fd_tickcount();
+      if( FD_LIKELY( completed ) ) fd_histf_sample( ctx->complete_duration, (ulong)complete_duration );
+
+      /* We don't know how large each microblock will be until it's
+         scheduled, so each one gets room for the largest. */
+      sched_bank [ sched_cnt ] = i;
+      sched_chunk[ sched_cnt ] = chunk;
+      sched_dst  [ sched_cnt ] = fd_chunk_to_laddr( ctx->out_mem, chunk );
+      chunk = fd_dcache_compact_next( chunk, MAX_TXN_PER_MICROBLOCK*sizeof(fd_txn_p_t)+sizeof(fd_microblock_bank_trailer_t), ctx->out_chunk0, ctx->out_wmark );
+      sched_cnt++;
+    }
 
-    void * microblock_dst = fd_chunk_to_laddr( ctx->out_mem, ctx->out_chunk );
     long schedule_duration = -fd_tickcount();
-    ulong schedule_cnt = fd_pack_schedule_next_microblock( ctx->pack, CUS_PER_MICROBLOCK, VOTE_FRACTION, (ulong)i, microblock_dst );
+    ulong schedule_cnt = fd_pack_schedule_next_microblocks( ctx->pack, CUS_PER_MICROBLOCK, VOTE_FRACTION, sched_bank, sched_cnt, sched_dst, sched_txn_cnt );
     schedule_duration      += fd_tickcount();
     fd_histf_sample( (schedule_cnt>0UL) ? ctx->schedule_duration : ctx->no_sched_duration, (ulong)schedule_duration );
 
@@ -503,20 +526,28 @@ after_credit( fd_pack_ctx_t *     ctx,
       long  now2   = fd_tickcount();
       ulong tsorig = (ulong)fd_frag_meta_ts_comp( now  ); /* A bound on when we observed bank was idle */
       ulong tspub  = (ulong)fd_frag_meta_ts_comp( now2 );
-      ulong chunk  = ctx->out_chunk;
-      ulong msg_sz = schedule_cnt*sizeof(fd_txn_p_t);
-      fd_microblock_bank_trailer_t * trailer = (fd_microblock_bank_trailer_t*)((uchar*)microblock_dst+msg_sz);
-      trailer->bank = ctx->leader_bank;
-      trailer->microblock_idx = ctx->slot_microblock_cnt;
-
-      ulong sig = fd_disco_poh_sig( ctx->leader_slot, POH_PKT_TYPE_MICROBLOCK, (ulong)i );
-      fd_stem_publish( stem, 0UL, sig, chunk, msg_sz+sizeof(fd_microblock_bank_trailer_t), 0UL, tsorig, tspub );
-      ctx->bank_expect[ i ] = stem->seqs[0]-1UL;
-      ctx->bank_ready_at[i] = now2 + (long)ctx->microblock_duration_ticks;
-      ctx->out_chunk = fd_dcache_compact_next( ctx->out_chunk, msg_sz+sizeof(fd_microblock_bank_trailer_t), ctx->out_chunk0, ctx->out_wmark );
-      ctx->slot_microblock_cnt++;
-
-      ctx->bank_idle_bitset = fd_ulong_pop_lsb( ctx->bank_idle_bitset );
+
+      ulong microblock_cnt = 0UL;
+      for( ulong k=0UL; k<sched_cnt; k++ ) {
+        if( FD_UNLIKELY( !sched_txn_cnt[ k ] ) ) continue;
+        ulong i      = sched_bank[ k ];
+        ulong msg_sz = sched_txn_cnt[ k ]*sizeof(fd_txn_p_t);
+        fd_microblock_bank_trailer_t * trailer = (fd_microblock_bank_trailer_t*)((uchar*)sched_dst[ k ]+msg_sz);
+        trailer->bank = ctx->leader_bank;
+        trailer->microblock_idx = ctx->slot_microblock_cnt;
+
+        ulong sig = fd_disco_poh_sig( ctx->leader_slot, POH_PKT_TYPE_MICROBLOCK, i );
+        fd_stem_publish( stem, 0UL, sig, sched_chunk[ k ], msg_sz+sizeof(fd_microblock_bank_trailer_t), 0UL, tsorig, tspub );
+        ctx->bank_expect[ i ] = stem->seqs[0]-1UL;
+        ctx->bank_ready_at[i] = now2 + (long)ctx->microblock_duration_ticks;
+        ctx->out_chunk = fd_dcache_compact_next( sched_chunk[ k ], msg_sz+sizeof(fd_microblock_bank_trailer_t), ctx->out_chunk0, ctx->out_wmark );
+        ctx->slot_microblock_cnt++;
+        microblock_cnt++;
+
+        ctx->bank_idle_bitset &= ~(1UL<<i);
+      }
+      fd_histf_sample( ctx->microblocks_per_schedule, microblock_cnt );
+
       ctx->skip_cnt         = (long)schedule_cnt * fd_long_if( ctx->use_consumed_cus, (long)bank_cnt/2L, 1L );
       fd_pack_pacing_update_consumed_cus( ctx->pacer, fd_pack_current_block_cost( ctx->pack ), now2 );
     }
@@ -877,6 +908,8 @@ unprivileged_init( fd_topo_t *      topo,
                                                        FD_MHIST_SECONDS_MAX( PACK, INSERT_TRANSACTION_DURATION_SECONDS  ) ) );
   fd_histf_join( fd_histf_new( ctx->complete_duration, FD_MHIST_SECONDS_MIN( PACK, COMPLETE_MICROBLOCK_DURATION_SECONDS ),
                                                        FD_MHIST_SECONDS_MAX( PACK, COMPLETE_MICROBLOCK_DURATION_SECONDS  ) ) );
+  fd_histf_join( fd_histf_new( ctx->microblocks_per_schedule, FD_MHIST_MIN( PACK, MICROBLOCKS_PER_SCHEDULE_COUNT ),
+                                                              FD_MHIST_MAX( PACK, MICROBLOCKS_PER_SCHEDULE_COUNT ) ) );
   ctx->metric_state = 0;
   ctx->metric_state_begin = fd_tickcount();
   memset( ctx->metric_timing, '\0', 16*sizeof(long) );
@@ -33,6 +33,7 @@
 #include "../../../../choreo/fd_choreo.h"
 #include "../../../../disco/store/fd_epoch_forks.h"
 #include "../../../../funk/fd_funk_filemap.h"
+#include "../../../../funk/fd_funk_cold.h"
 #include "../../../../flamenco/snapshot/fd_snapshot_create.h"
 #include "../../../../disco/plugin/fd_plugin.h"
 
@@ -309,6 +310,8 @@ struct fd_replay_tile_ctx {
   fd_spad_t * spads[ 128UL ];
   ulong       spad_cnt;
 
+  int         txn_sched; /* FD_RUNTIME_TXN_SCHED_{WAVES,DAG} */
+
   /* TODO: refactor this all into fd_replay_tile_snapshot_ctx_t. */
   ulong   snapshot_interval;        /* User defined parameter */
   ulong   incremental_interval;     /* User defined parameter */
@@ -1560,13 +1563,24 @@ after_frag( fd_replay_tile_ctx_t * ctx,
       for( ulong i = 0UL; i<ctx->bank_cnt; i++ ) {
         fd_tpool_wait( ctx->tpool, i+1 );
       }
-      int res = fd_runtime_process_txns_in_waves_tpool( &fork->slot_ctx,
-                                                        ctx->capture_ctx,
-                                                        txns,
-                                                        txn_cnt,
-                                                        ctx->tpool,
-                                                        ctx->spads,
-                                                        ctx->spad_cnt );
+      int res;
+      if( ctx->txn_sched==FD_RUNTIME_TXN_SCHED_DAG ) {
+        res = fd_runtime_process_txns_dag_tpool( &fork->slot_ctx,
+                                                 ctx->capture_ctx,
+                                                 txns,
+                                                 txn_cnt,
+                                                 ctx->tpool,
+                                                 ctx->spads,
+                                                 ctx->spad_cnt );
+      } else {
+        res = fd_runtime_process_txns_in_waves_tpool( &fork->slot_ctx,
+                                                      ctx->capture_ctx,
+                                                      txns,
+                                                      txn_cnt,
+                                                      ctx->tpool,
+                                                      ctx->spads,
+                                                      ctx->spad_cnt );
+      }
       if( res != 0UL ) {
         FD_LOG_WARNING(( "block invalid - slot: %lu", curr_slot ));
 
@@ -1735,7 +1749,7 @@ after_frag( fd_replay_tile_ctx_t * ctx,
     fd_tower_print( ctx->tower, ctx->root );
 
     fd_fork_t * child = fd_fork_frontier_ele_query( ctx->forks->frontier, &fork->slot, NULL, ctx->forks->pool );
-    ulong vote_slot = fd_tower_vote_slot( ctx->tower, ctx->epoch, ctx->funk, child->slot_ctx.funk_txn, ctx->ghost );
+    ulong vote_slot = fd_tower_vote_slot( ctx->tower, ctx->epoch, ctx->ghost );
 
     FD_LOG_NOTICE( ( "\n\n[Fork Selection]\n"
                      "# of vote accounts: %lu\n"
@@ -1923,7 +1937,10 @@ static void
 kickoff_repair_orphans( fd_replay_tile_ctx_t * ctx, fd_stem_context_t * stem ) {
 
   fd_blockstore_start_write( ctx->slot_ctx->blockstore );
-  fd_blockstore_init( ctx->slot_ctx->blockstore, ctx->blockstore_fd, FD_BLOCKSTORE_ARCHIVE_MIN_SIZE, &ctx->slot_ctx->slot_bank );
+  fd_blockstore_init( ctx->slot_ctx->blockstore,
+                      ctx->blockstore_fd,
+                      FD_BLOCKSTORE_ARCHIVE_MIN_SIZE + fd_blockstore_archive_idx_footprint( ctx->slot_ctx->blockstore ),
+                      &ctx->slot_ctx->slot_bank );
   fd_blockstore_end_write( ctx->slot_ctx->blockstore );
 
   publish_stake_weights( ctx, stem, ctx->slot_ctx );
@@ -1973,7 +1990,7 @@ read_snapshot( void *              _ctx,
     if( strlen( incremental )>0UL ) {
       uchar *                  tmp_mem      = fd_scratch_alloc( fd_snapshot_load_ctx_align(), fd_snapshot_load_ctx_footprint() );
       /* TODO: enable snapshot verification */
-      fd_snapshot_load_ctx_t * tmp_snap_ctx = fd_snapshot_load_new( tmp_mem, incremental, ctx->slot_ctx, ctx->tpool, false, false, FD_SNAPSHOT_TYPE_FULL, ctx->valloc );
+      fd_snapshot_load_ctx_t * tmp_snap_ctx = fd_snapshot_load_new( tmp_mem, incremental, ctx->slot_ctx, ctx->tpool, false, false, false, FD_SNAPSHOT_TYPE_FULL, ctx->valloc );
       /* Load the prefetch manifest, and initialize the status cache and slot context,
          so that we can use these to kick off repair. */
       fd_snapshot_load_prefetch_manifest( tmp_snap_ctx );
@@ -1988,7 +2005,7 @@ read_snapshot( void *              _ctx,
 
     uchar *                  mem      = fd_scratch_alloc( fd_snapshot_load_ctx_align(), fd_snapshot_load_ctx_footprint() );
     /* TODO: enable snapshot verification */
-    fd_snapshot_load_ctx_t * snap_ctx = fd_snapshot_load_new( mem, snapshot, ctx->slot_ctx, ctx->tpool, false, false, FD_SNAPSHOT_TYPE_FULL, ctx->valloc );
+    fd_snapshot_load_ctx_t * snap_ctx = fd_snapshot_load_new( mem, snapshot, ctx->slot_ctx, ctx->tpool, false, false, false, FD_SNAPSHOT_TYPE_FULL, ctx->valloc );
   
     fd_snapshot_load_init( snap_ctx );
 
@@ -2028,7 +2045,7 @@ read_snapshot( void *              _ctx,
     /* The slot of the full snapshot should be used as the base slot to verify the incremental snapshot,
        not the slot context's slot - which is the slot of the incremental, not the full snapshot. */
     /* TODO: enable snapshot verification */
-    fd_snapshot_load_all( incremental, ctx->slot_ctx, &base_slot, ctx->tpool, false, false, FD_SNAPSHOT_TYPE_INCREMENTAL, ctx->valloc );
+    fd_snapshot_load_all( incremental, ctx->slot_ctx, &base_slot, ctx->tpool, false, false, false, FD_SNAPSHOT_TYPE_INCREMENTAL, ctx->valloc );
   }
 
   if( ctx->replay_plugin_out_mem ) {
@@ -2047,7 +2064,10 @@ read_snapshot( void *              _ctx,
   FD_LOG_NOTICE(( "finished fd_bpf_scan_and_create_bpf_program_cache_entry..." ));
 
   fd_blockstore_start_write( ctx->slot_ctx->blockstore );
-  fd_blockstore_init( ctx->slot_ctx->blockstore, ctx->blockstore_fd, FD_BLOCKSTORE_ARCHIVE_MIN_SIZE, &ctx->slot_ctx->slot_bank );
+  fd_blockstore_init( ctx->slot_ctx->blockstore,
+                      ctx->blockstore_fd,
+                      FD_BLOCKSTORE_ARCHIVE_MIN_SIZE + fd_blockstore_archive_idx_footprint( ctx->slot_ctx->blockstore ),
+                      &ctx->slot_ctx->slot_bank );
   fd_blockstore_end_write( ctx->slot_ctx->blockstore );
 }
 
@@ -2342,9 +2362,15 @@ privileged_init( fd_topo_t *      topo,
   FD_TEST( sizeof(ulong) == getrandom( &ctx->funk_seed, sizeof(ulong), 0 ) );
   FD_TEST( sizeof(ulong) == getrandom( &ctx->status_cache_seed, sizeof(ulong), 0 ) );
 
-  ctx->blockstore_fd = open( tile->replay.blockstore_file, O_RDWR | O_CREAT, 0666 );
-  if ( FD_UNLIKELY( ctx->blockstore_fd == -1 ) ) {
-    FD_LOG_ERR(( "failed to open or create blockstore archival file %s %d %d %s", tile->replay.blockstore_file, ctx->blockstore_fd, errno, strerror(errno) ));
+  /* Finalized blocks are only archived if an archival file is
+     configured (the archiver tile writes them out). */
+
+  ctx->blockstore_fd = -1;
+  if( FD_LIKELY( strcmp( tile->replay.blockstore_file, "" ) ) ) {
+    ctx->blockstore_fd = open( tile->replay.blockstore_file, O_RDWR | O_CREAT, 0666 );
+    if ( FD_UNLIKELY( ctx->blockstore_fd == -1 ) ) {
+      FD_LOG_ERR(( "failed to open or create blockstore archival file %s %d %d %s", tile->replay.blockstore_file, ctx->blockstore_fd, errno, strerror(errno) ));
+    }
   }
 }
 
@@ -2433,6 +2459,31 @@ unprivileged_init( fd_topo_t *      topo,
 
   FD_LOG_NOTICE(( "Snapshot intervals full=%lu incremental=%lu", ctx->snapshot_interval, ctx->incremental_interval ));
 
+  /**********************************************************************/
+  /* tpool                                                              */
+  /**********************************************************************/
+
+  /* Booted before funk such that funk checkpoints are restored using
+     all threads. */
+
+  if( FD_LIKELY( tile->replay.tpool_thread_count > 1 ) ) {
+    tpool_boot( topo, tile->replay.tpool_thread_count );
+  }
+  ctx->tpool = fd_tpool_init( ctx->tpool_mem, tile->replay.tpool_thread_count );
+
+  if( FD_LIKELY( tile->replay.tpool_thread_count > 1 ) ) {
+    /* Start the tpool workers */
+    for( ulong i=1UL; i<tile->replay.tpool_thread_count; i++ ) {
+      if( fd_tpool_worker_push( ctx->tpool, i, (uchar *)tpool_worker_mem + TPOOL_WORKER_MEM_SZ*(i - 1U), TPOOL_WORKER_MEM_SZ ) == NULL ) {
+        FD_LOG_ERR(( "failed to launch worker" ));
+      }
+    }
+  }
+
+  if( ctx->tpool == NULL ) {
+    FD_LOG_ERR(("failed to create thread pool"));
+  }
+
   /**********************************************************************/
   /* funk                                                               */
   /**********************************************************************/
@@ -2449,7 +2500,7 @@ unprivileged_init( fd_topo_t *      topo,
         FD_FUNK_READ_WRITE, NULL );
   } else if( strncmp( snapshot, "wksp:", 5 ) == 0) {
     /* Recover funk database from a checkpoint. */
-    funk = fd_funk_recover_checkpoint( tile->replay.funk_file, 1, snapshot+5, NULL );
+    funk = fd_funk_recover_checkpoint( tile->replay.funk_file, 1, snapshot+5, ctx->tpool, 0UL, tile->replay.tpool_thread_count, NULL );
   } else {
     /* Create new funk database */
     funk = fd_funk_open_file(
@@ -2611,28 +2662,6 @@ unprivileged_init( fd_topo_t *      topo,
 
   ctx->mbatch = mbatch_mem;
 
-  /**********************************************************************/
-  /* tpool                                                              */
-  /**********************************************************************/
-
-  if( FD_LIKELY( tile->replay.tpool_thread_count > 1 ) ) {
-    tpool_boot( topo, tile->replay.tpool_thread_count );
-  }
-  ctx->tpool = fd_tpool_init( ctx->tpool_mem, tile->replay.tpool_thread_count );
-
-  if( FD_LIKELY( tile->replay.tpool_thread_count > 1 ) ) {
-    /* Start the tpool workers */
-    for( ulong i=1UL; i<tile->replay.tpool_thread_count; i++ ) {
-      if( fd_tpool_worker_push( ctx->tpool, i, (uchar *)tpool_worker_mem + TPOOL_WORKER_MEM_SZ*(i - 1U), TPOOL_WORKER_MEM_SZ ) == NULL ) {
-        FD_LOG_ERR(( "failed to launch worker" ));
-      }
-    }
-  }
-
-  if( ctx->tpool == NULL ) {
-    FD_LOG_ERR(("failed to create thread pool"));
-  }
-
   /**********************************************************************/
   /* spad                                                               */
   /**********************************************************************/
@@ -2647,6 +2676,7 @@ unprivileged_init( fd_topo_t *      topo,
     ctx->spads[ ctx->spad_cnt++ ] = spad;
     spad_mem_cur += fd_ulong_align_up( thread_spad_size, fd_spad_align() );
   }
+  ctx->txn_sched = tile->replay.txn_sched;
 
   /**********************************************************************/
   /* capture                                                            */
@@ -2855,7 +2885,8 @@ populate_allowed_fds( fd_topo_t const *      topo,
   out_fds[ out_cnt++ ] = 2; /* stderr */
   if( FD_LIKELY( -1!=fd_log_private_logfile_fd() ) )
     out_fds[ out_cnt++ ] = fd_log_private_logfile_fd(); /* logfile */
-  out_fds[ out_cnt++ ] = ctx->blockstore_fd;
+  if( FD_LIKELY( -1!=ctx->blockstore_fd ) )
+    out_fds[ out_cnt++ ] = ctx->blockstore_fd; /* archival file */
   return out_cnt;
 }
 
@@ -2863,6 +2894,26 @@ static inline void
 metrics_write( fd_replay_tile_ctx_t * ctx ) {
   FD_MGAUGE_SET( REPLAY, LAST_VOTED_SLOT, ctx->metrics.last_voted_slot );
   FD_MGAUGE_SET( REPLAY, SLOT, ctx->metrics.slot );
+
+  if( FD_LIKELY( ctx->blockstore ) ) {
+    FD_MCNT_SET( REPLAY, BLOCKSTORE_ARCHIVE_DROP_COUNT, FD_VOLATILE_CONST( ctx->blockstore->archive_drop_cnt ) );
+  }
+
+  fd_funk_cold_shmem_t const * cold_shmem = fd_funk_cold_shmem( ctx->funk );
+  if( cold_shmem ) {
+    fd_funk_cold_metrics_t const * cold = cold_shmem->metrics;
+    FD_MCNT_SET  ( REPLAY, FUNK_COLD_LOOKUP_COUNT,            cold->lookup_cnt          );
+    FD_MCNT_SET  ( REPLAY, FUNK_COLD_FAULT_COUNT,             cold->fault_cnt           );
+    FD_MCNT_SET  ( REPLAY, FUNK_COLD_FAULT_SIZE_BYTES,        cold->fault_sz            );
+    FD_MCNT_SET  ( REPLAY, FUNK_COLD_FAULT_DURATION_NANOS,    (ulong)cold->fault_ns     );
+    FD_MGAUGE_SET( REPLAY, FUNK_COLD_FAULT_MAX_DURATION_NANOS, (ulong)cold->fault_ns_max );
+    FD_MCNT_SET  ( REPLAY, FUNK_COLD_PEEK_COUNT,              cold->peek_cnt            );
+    FD_MCNT_SET  ( REPLAY, FUNK_COLD_EVICT_COUNT,             cold->evict_cnt           );
+    FD_MCNT_SET  ( REPLAY, FUNK_COLD_EVICT_SIZE_BYTES,        cold->evict_sz            );
+    FD_MCNT_SET  ( REPLAY, FUNK_COLD_COMPACT_COUNT,           cold->compact_cnt         );
+    FD_MGAUGE_SET( REPLAY, FUNK_COLD_LOG_USED_BYTES,          cold_shmem->used_sz       );
+    FD_MGAUGE_SET( REPLAY, FUNK_COLD_LOG_CAPACITY_BYTES,      cold_shmem->map_sz        );
+  }
 }
 
 /* TODO: This is definitely not correct */
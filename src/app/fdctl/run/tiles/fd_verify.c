@@ -21,6 +21,7 @@ scratch_footprint( fd_topo_tile_t const * tile ) {
   for( ulong i=0; i<FD_TXN_ACTUAL_SIG_MAX; i++ ) {
     l = FD_LAYOUT_APPEND( l, fd_sha512_align(), fd_sha512_footprint() );
   }
+  l = FD_LAYOUT_APPEND( l, fd_ed25519_pubkey_cache_align(), fd_ed25519_pubkey_cache_footprint( FD_VERIFY_PUBKEY_CACHE_ENTRY_CNT, FD_VERIFY_PUBKEY_CACHE_HOT_CNT ) );
   return FD_LAYOUT_FINI( l, scratch_align() );
 }
 
@@ -29,6 +30,9 @@ metrics_write( fd_verify_ctx_t * ctx ) {
   FD_MCNT_SET( VERIFY, TRANSACTION_PARSE_FAILURE,  ctx->metrics.parse_fail_cnt );
   FD_MCNT_SET( VERIFY, TRANSACTION_DEDUP_FAILURE,  ctx->metrics.dedup_fail_cnt );
   FD_MCNT_SET( VERIFY, TRANSACTION_VERIFY_FAILURE, ctx->metrics.verify_fail_cnt );
+  FD_MCNT_SET( VERIFY, PUBKEY_CACHE_HIT,           fd_ed25519_pubkey_cache_hit_cnt      ( ctx->pubkey_cache ) );
+  FD_MCNT_SET( VERIFY, PUBKEY_CACHE_MISS,          fd_ed25519_pubkey_cache_miss_cnt     ( ctx->pubkey_cache ) );
+  FD_MCNT_SET( VERIFY, PUBKEY_CACHE_TABLE_HIT,     fd_ed25519_pubkey_cache_table_hit_cnt( ctx->pubkey_cache ) );
 }
 
 static int
@@ -42,65 +46,95 @@ before_frag( fd_verify_ctx_t * ctx,
   return (seq % ctx->round_robin_cnt) != ctx->round_robin_idx;
 }
 
-/* during_frag is called between pairs for sequence number checks, as
-   we are reading incoming frags.  We don't actually need to copy the
-   fragment here, see fd_dedup.c for why we do this.*/
+/* The verify tile consumes frags in batches (see fd_stem.c) such that
+   the signatures of many transactions, which mostly have a single
+   signature, can be verified together.  during_frag_batch copies each
+   frag of the batch into its own out dcache chunk, see fd_dedup.c for
+   why we copy here.  The stem only forms batches it has the credits to
+   publish, so the batch fits in the out dcache like a burst of as many
+   MTU sized frags would.  after_frag_batch then parses the batch in
+   place, verifies it and publishes the transactions that pass from the
+   chunk they were staged in.  The batch is only made of frags that
+   were already available, so batching doesn't add latency. */
 
 static inline void
-during_frag( fd_verify_ctx_t * ctx,
-             ulong             in_idx,
-             ulong             seq,
-             ulong             sig,
-             ulong             chunk,
-             ulong             sz ) {
-  (void)seq;
-  (void)sig;
-
-  if( FD_UNLIKELY( chunk<ctx->in[in_idx].chunk0 || chunk>ctx->in[in_idx].wmark || sz>FD_TPU_MTU ) )
-    FD_LOG_ERR(( "chunk %lu %lu corrupt, not in range [%lu,%lu]", chunk, sz, ctx->in[in_idx].chunk0, ctx->in[in_idx].wmark ));
-
-  uchar * src = (uchar *)fd_chunk_to_laddr( ctx->in[in_idx].mem, chunk );
-  fd_txn_m_t * dst = (fd_txn_m_t *)fd_chunk_to_laddr( ctx->out_mem, ctx->out_chunk );
-
-  dst->payload_sz = (ushort)sz;
-  fd_memcpy( fd_txn_m_payload( dst ), src, sz );
+during_frag_batch( fd_verify_ctx_t *      ctx,
+                   ulong                  in_idx,
+                   fd_frag_meta_t const * meta,
+                   ulong                  meta_cnt ) {
+  ulong out_chunk = ctx->out_chunk;
+  for( ulong i=0UL; i<meta_cnt; i++ ) {
+    ulong chunk = (ulong)meta[i].chunk;
+    ulong sz    = (ulong)meta[i].sz;
+
+    if( FD_UNLIKELY( chunk<ctx->in[in_idx].chunk0 || chunk>ctx->in[in_idx].wmark || sz>FD_TPU_MTU ) )
+      FD_LOG_ERR(( "chunk %lu %lu corrupt, not in range [%lu,%lu]", chunk, sz, ctx->in[in_idx].chunk0, ctx->in[in_idx].wmark ));
+
+    uchar * src = (uchar *)fd_chunk_to_laddr( ctx->in[in_idx].mem, chunk );
+    fd_txn_m_t * dst = (fd_txn_m_t *)fd_chunk_to_laddr( ctx->out_mem, out_chunk );
+
+    dst->payload_sz = (ushort)sz;
+    fd_memcpy( fd_txn_m_payload( dst ), src, sz );
+
+    ctx->batch_chunk[ i ] = out_chunk;
+    out_chunk = fd_dcache_compact_next( out_chunk, FD_TPU_PARSED_MTU, ctx->out_chunk0, ctx->out_wmark );
+  }
 }
 
 static inline void
-after_frag( fd_verify_ctx_t *   ctx,
-            ulong               in_idx,
-            ulong               seq,
-            ulong               sig,
-            ulong               sz,
-            ulong               tsorig,
-            fd_stem_context_t * stem ) {
+after_frag_batch( fd_verify_ctx_t *      ctx,
+                  ulong                  in_idx,
+                  fd_frag_meta_t const * meta,
+                  ulong                  meta_cnt,
+                  fd_stem_context_t *    stem ) {
   (void)in_idx;
-  (void)seq;
-  (void)sig;
-  (void)sz;
-
-  fd_txn_m_t * txnm = (fd_txn_m_t *)fd_chunk_to_laddr( ctx->out_mem, ctx->out_chunk );
-  fd_txn_t *  txnt = fd_txn_m_txn_t( txnm );
-  txnm->txn_t_sz = (ushort)fd_txn_parse( fd_txn_m_payload( txnm ), txnm->payload_sz, txnt, NULL );
 
-  if( FD_UNLIKELY( !txnm->txn_t_sz ) ) {
-    ctx->metrics.parse_fail_cnt++;
-    return;
+  fd_txn_m_t *     txnm      [ FD_VERIFY_BATCH_TXN_MAX ];
+  ulong            chunk     [ FD_VERIFY_BATCH_TXN_MAX ];
+  uchar const *    payload   [ FD_VERIFY_BATCH_TXN_MAX ];
+  ushort           payload_sz[ FD_VERIFY_BATCH_TXN_MAX ];
+  fd_txn_t const * txnt      [ FD_VERIFY_BATCH_TXN_MAX ];
+  ulong            tsorig    [ FD_VERIFY_BATCH_TXN_MAX ];
+  int              res       [ FD_VERIFY_BATCH_TXN_MAX ];
+  ulong            _txn_sig  [ FD_VERIFY_BATCH_TXN_MAX ];
+  ulong            txn_cnt = 0UL;
+
+  for( ulong i=0UL; i<meta_cnt; i++ ) {
+    fd_txn_m_t * m = (fd_txn_m_t *)fd_chunk_to_laddr( ctx->out_mem, ctx->batch_chunk[ i ] );
+    fd_txn_t *   t = fd_txn_m_txn_t( m );
+    m->txn_t_sz = (ushort)fd_txn_parse( fd_txn_m_payload( m ), m->payload_sz, t, NULL );
+
+    if( FD_UNLIKELY( !m->txn_t_sz ) ) {
+      ctx->metrics.parse_fail_cnt++;
+      continue;
+    }
+
+    txnm      [ txn_cnt ] = m;
+    chunk     [ txn_cnt ] = ctx->batch_chunk[ i ];
+    payload   [ txn_cnt ] = fd_txn_m_payload( m );
+    payload_sz[ txn_cnt ] = m->payload_sz;
+    txnt      [ txn_cnt ] = t;
+    tsorig    [ txn_cnt ] = (ulong)meta[i].tsorig;
+    txn_cnt++;
   }
 
-  ulong _txn_sig;
-  int res = fd_txn_verify( ctx, fd_txn_m_payload( txnm ), txnm->payload_sz, txnt, &_txn_sig );
-  if( FD_UNLIKELY( res!=FD_TXN_VERIFY_SUCCESS ) ) {
-    if( FD_LIKELY( res==FD_TXN_VERIFY_DEDUP ) ) ctx->metrics.dedup_fail_cnt++;
-    else                                        ctx->metrics.verify_fail_cnt++;
+  fd_txn_verify_batch( ctx, payload, payload_sz, txnt, txn_cnt, res, _txn_sig );
 
-    return;
-  }
+  /* Chunks of transactions that are dropped are skipped, except after
+     the last published transaction where they are reused. */
+
+  for( ulong i=0UL; i<txn_cnt; i++ ) {
+    if( FD_UNLIKELY( res[i]!=FD_TXN_VERIFY_SUCCESS ) ) {
+      if( FD_LIKELY( res[i]==FD_TXN_VERIFY_DEDUP ) ) ctx->metrics.dedup_fail_cnt++;
+      else                                           ctx->metrics.verify_fail_cnt++;
+      continue;
+    }
 
-  ulong realized_sz = fd_txn_m_realized_footprint( txnm, 0 );
-  ulong tspub = (ulong)fd_frag_meta_ts_comp( fd_tickcount() );
-  fd_stem_publish( stem, 0UL, 0UL, ctx->out_chunk, realized_sz, 0UL, tsorig, tspub );
-  ctx->out_chunk = fd_dcache_compact_next( ctx->out_chunk, realized_sz, ctx->out_chunk0, ctx->out_wmark );
+    ulong realized_sz = fd_txn_m_realized_footprint( txnm[i], 0 );
+    ulong tspub = (ulong)fd_frag_meta_ts_comp( fd_tickcount() );
+    fd_stem_publish( stem, 0UL, 0UL, chunk[i], realized_sz, 0UL, tsorig[i], tspub );
+    ctx->out_chunk = fd_dcache_compact_next( chunk[i], realized_sz, ctx->out_chunk0, ctx->out_wmark );
+  }
 }
 
 static void
@@ -132,6 +166,10 @@ unprivileged_init( fd_topo_t *      topo,
     ctx->sha[i] = sha;
   }
 
+  void * pubkey_cache = FD_SCRATCH_ALLOC_APPEND( l, fd_ed25519_pubkey_cache_align(), fd_ed25519_pubkey_cache_footprint( FD_VERIFY_PUBKEY_CACHE_ENTRY_CNT, FD_VERIFY_PUBKEY_CACHE_HOT_CNT ) );
+  ctx->pubkey_cache = fd_ed25519_pubkey_cache_join( fd_ed25519_pubkey_cache_new( pubkey_cache, FD_VERIFY_PUBKEY_CACHE_ENTRY_CNT, FD_VERIFY_PUBKEY_CACHE_HOT_CNT, ctx->hashmap_seed ) );
+  if( FD_UNLIKELY( !ctx->pubkey_cache ) ) FD_LOG_ERR(( "fd_ed25519_pubkey_cache_join failed" ));
+
   ctx->tcache_depth   = fd_tcache_depth       ( tcache );
   ctx->tcache_map_cnt = fd_tcache_map_cnt     ( tcache );
   ctx->tcache_sync    = fd_tcache_oldest_laddr( tcache );
@@ -191,10 +229,12 @@ populate_allowed_fds( fd_topo_t const *      topo,
 #define STEM_CALLBACK_CONTEXT_TYPE  fd_verify_ctx_t
 #define STEM_CALLBACK_CONTEXT_ALIGN alignof(fd_verify_ctx_t)
 
-#define STEM_CALLBACK_METRICS_WRITE metrics_write
-#define STEM_CALLBACK_BEFORE_FRAG   before_frag
-#define STEM_CALLBACK_DURING_FRAG   during_frag
-#define STEM_CALLBACK_AFTER_FRAG    after_frag
+#define STEM_FRAG_BATCH_MAX FD_VERIFY_BATCH_TXN_MAX
+
+#define STEM_CALLBACK_METRICS_WRITE     metrics_write
+#define STEM_CALLBACK_BEFORE_FRAG       before_frag
+#define STEM_CALLBACK_DURING_FRAG_BATCH during_frag_batch
+#define STEM_CALLBACK_AFTER_FRAG_BATCH  after_frag_batch
 
 #include "../../../../disco/stem/fd_stem.c"
 
@@ -2,11 +2,30 @@
 #define HEADER_fd_src_app_fdctl_run_tiles_verify_h
 
 #include "../../../../disco/tiles.h"
+#include "../../../../ballet/ed25519/fd_ed25519_pubkey_cache.h"
 
 #define FD_TXN_VERIFY_SUCCESS  0
 #define FD_TXN_VERIFY_FAILED  -1
 #define FD_TXN_VERIFY_DEDUP   -2
 
+/* FD_VERIFY_BATCH_TXN_MAX is the max number of transactions verified
+   together by fd_txn_verify_batch (and consumed per stem frag batch by
+   the verify tile). */
+
+#define FD_VERIFY_BATCH_TXN_MAX (16UL)
+
+/* FD_VERIFY_BATCH_SCRATCH_SZ is the scratch space needed to hash the
+   preimages of a full batch of signatures in one pass. */
+
+#define FD_VERIFY_BATCH_SCRATCH_SZ (FD_ED25519_VERIFY_BATCH_MAX*(64UL+FD_TPU_MTU))
+
+/* FD_VERIFY_PUBKEY_CACHE_{ENTRY,HOT}_CNT size the decompressed public
+   key cache of a verify tile (roughly 1 MiB and 200 KiB resp., see
+   fd_ed25519_pubkey_cache.h). */
+
+#define FD_VERIFY_PUBKEY_CACHE_ENTRY_CNT (4096UL)
+#define FD_VERIFY_PUBKEY_CACHE_HOT_CNT   (128UL)
+
 /* fd_verify_in_ctx_t is a context object for each in (producer) mcache
    connected to the verify tile. */
 
@@ -38,6 +57,12 @@ typedef struct {
 
   ulong       hashmap_seed;
 
+  ulong       batch_chunk[ FD_VERIFY_BATCH_TXN_MAX ]; /* out chunk each txn of the current frag batch is staged in */
+
+  fd_ed25519_pubkey_cache_t * pubkey_cache; /* NULL to not cache public keys */
+
+  uchar       batch_scratch[ FD_VERIFY_BATCH_SCRATCH_SZ ];
+
   struct {
     ulong parse_fail_cnt;
     ulong verify_fail_cnt;
@@ -91,4 +116,103 @@ fd_txn_verify( fd_verify_ctx_t * ctx,
   return FD_TXN_VERIFY_SUCCESS;
 }
 
+/* fd_txn_verify_batch is fd_txn_verify for txn_cnt transactions at
+   once, with txn_cnt in [0,FD_VERIFY_BATCH_TXN_MAX].  The signatures of
+   the transactions that are not HA duplicates are verified together,
+   FD_ED25519_VERIFY_BATCH_MAX at a time, and failures are mapped back
+   to the transactions they belong to.  On return, res[i] holds the
+   FD_TXN_VERIFY_* result for transaction i and, on success, opt_sig[i]
+   its dedup tag.  The results are the same as calling fd_txn_verify on
+   the transactions one after the other, except that a transaction that
+   fails verification is reported as FAILED instead of DEDUP if it is a
+   duplicate of an earlier transaction in the same batch (it is dropped
+   either way).  Public keys are looked up in and added to
+   ctx->pubkey_cache if any. */
+
+static inline void
+fd_txn_verify_private_batch_flush( fd_verify_ctx_t * ctx,
+                                   uchar const **    msg,
+                                   ulong *           msg_sz,
+                                   uchar const **    sig,
+                                   uchar const **    pub,
+                                   ulong *           owner,
+                                   ulong             lane_cnt,
+                                   int *             res ) {
+  if( FD_UNLIKELY( !lane_cnt ) ) return;
+  int err[ FD_ED25519_VERIFY_BATCH_MAX ];
+  int all_ok = fd_ed25519_verify_batch_multi_msg( msg, msg_sz, sig, pub, lane_cnt,
+                                                  ctx->batch_scratch, FD_VERIFY_BATCH_SCRATCH_SZ, ctx->sha[0],
+                                                  ctx->pubkey_cache, err );
+  if( FD_LIKELY( all_ok==FD_ED25519_SUCCESS ) ) return;
+  for( ulong j=0UL; j<lane_cnt; j++ ) {
+    if( FD_UNLIKELY( err[j]!=FD_ED25519_SUCCESS ) ) res[ owner[j] ] = FD_TXN_VERIFY_FAILED;
+  }
+}
+
+static inline void
+fd_txn_verify_batch( fd_verify_ctx_t *      ctx,
+                     uchar const * const    udp_payload[],
+                     ushort const           payload_sz [],
+                     fd_txn_t const * const txn        [],
+                     ulong                  txn_cnt,
+                     int                    res        [],
+                     ulong                  opt_sig    [] ) {
+
+  uchar const * msg   [ FD_ED25519_VERIFY_BATCH_MAX ];
+  ulong         msg_sz[ FD_ED25519_VERIFY_BATCH_MAX ];
+  uchar const * sig   [ FD_ED25519_VERIFY_BATCH_MAX ];
+  uchar const * pub   [ FD_ED25519_VERIFY_BATCH_MAX ];
+  ulong         owner [ FD_ED25519_VERIFY_BATCH_MAX ];
+  ulong         lane_cnt = 0UL;
+
+  ulong ha_dedup_tag[ FD_VERIFY_BATCH_TXN_MAX ];
+
+  for( ulong i=0UL; i<txn_cnt; i++ ) {
+    uchar  signature_cnt = txn[i]->signature_cnt;
+    ushort signature_off = txn[i]->signature_off;
+    ushort acct_addr_off = txn[i]->acct_addr_off;
+    ushort message_off   = txn[i]->message_off;
+
+    uchar const * signatures = udp_payload[i] + signature_off;
+    uchar const * pubkeys    = udp_payload[i] + acct_addr_off;
+
+    /* See fd_txn_verify for the HA dedup */
+
+    ha_dedup_tag[i] = fd_hash( ctx->hashmap_seed, signatures, 64UL );
+    int ha_dup;
+    FD_FN_UNUSED ulong tcache_map_idx = 0; /* ignored */
+    FD_TCACHE_QUERY( ha_dup, tcache_map_idx, ctx->tcache_map, ctx->tcache_map_cnt, ha_dedup_tag[i] );
+    if( FD_UNLIKELY( ha_dup ) ) {
+      res[i] = FD_TXN_VERIFY_DEDUP;
+      continue;
+    }
+    res[i] = FD_TXN_VERIFY_SUCCESS;
+
+    if( FD_UNLIKELY( lane_cnt+signature_cnt>FD_ED25519_VERIFY_BATCH_MAX ) ) {
+      fd_txn_verify_private_batch_flush( ctx, msg, msg_sz, sig, pub, owner, lane_cnt, res );
+      lane_cnt = 0UL;
+    }
+    for( ulong j=0UL; j<signature_cnt; j++ ) {
+      msg   [ lane_cnt ] = udp_payload[i] + message_off;
+      msg_sz[ lane_cnt ] = (ulong)payload_sz[i] - message_off;
+      sig   [ lane_cnt ] = signatures + 64UL*j;
+      pub   [ lane_cnt ] = pubkeys    + 32UL*j;
+      owner [ lane_cnt ] = i;
+      lane_cnt++;
+    }
+  }
+  fd_txn_verify_private_batch_flush( ctx, msg, msg_sz, sig, pub, owner, lane_cnt, res );
+
+  for( ulong i=0UL; i<txn_cnt; i++ ) {
+    if( FD_UNLIKELY( res[i]!=FD_TXN_VERIFY_SUCCESS ) ) continue;
+    int ha_dup;
+    FD_TCACHE_INSERT( ha_dup, *ctx->tcache_sync, ctx->tcache_ring, ctx->tcache_depth, ctx->tcache_map, ctx->tcache_map_cnt, ha_dedup_tag[i] );
+    if( FD_UNLIKELY( ha_dup ) ) {
+      res[i] = FD_TXN_VERIFY_DEDUP;
+      continue;
+    }
+    opt_sig[i] = ha_dedup_tag[i];
+  }
+}
+
 #endif /* HEADER_fd_src_app_fdctl_run_tiles_verify_h */
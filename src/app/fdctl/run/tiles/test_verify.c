@@ -317,6 +317,78 @@ test_verify_invalid_dedup_with_collision_success( void ) {
   free_verify_ctx( ctx, mem );
 }
 
+static void
+test_verify_batch( int cached ) {
+  fd_verify_ctx_t ctx[1];
+  void *          mem = NULL;
+
+  FD_LOG_NOTICE(( "test_verify_batch(cached=%d)", cached ));
+  setup_verify_ctx( ctx, &mem );
+
+  void * cache_mem = NULL;
+  if( cached ) {
+    cache_mem = aligned_alloc( fd_ed25519_pubkey_cache_align(), fd_ed25519_pubkey_cache_footprint( 4UL, 2UL ) );
+    ctx->pubkey_cache = fd_ed25519_pubkey_cache_join( fd_ed25519_pubkey_cache_new( cache_mem, 4UL, 2UL, 1234UL ) );
+    FD_TEST( ctx->pubkey_cache );
+  }
+
+  /* valid, invalid, valid, same valid again, invalid with same
+     signature as a valid one, and then more than a batch of
+     signatures */
+
+  struct { char ** hex; ulong hex_sz; int exp; } in[] = {
+    { valid_txn_2sigs,       sizeof(valid_txn_2sigs),       FD_TXN_VERIFY_SUCCESS },
+    { invalid_txn_2sigs,     sizeof(invalid_txn_2sigs),     FD_TXN_VERIFY_FAILED  },
+    { valid_txn_1sig,        sizeof(valid_txn_1sig),        FD_TXN_VERIFY_SUCCESS },
+    { valid_txn_2sigs,       sizeof(valid_txn_2sigs),       FD_TXN_VERIFY_DEDUP   },
+    { invalid_txn_same_1sig, sizeof(invalid_txn_same_1sig), FD_TXN_VERIFY_FAILED  },
+    { invalid_txn_2sigs,     sizeof(invalid_txn_2sigs),     FD_TXN_VERIFY_FAILED  },
+    { invalid_txn_2sigs,     sizeof(invalid_txn_2sigs),     FD_TXN_VERIFY_FAILED  },
+    { invalid_txn_2sigs,     sizeof(invalid_txn_2sigs),     FD_TXN_VERIFY_FAILED  },
+    { invalid_txn_2sigs,     sizeof(invalid_txn_2sigs),     FD_TXN_VERIFY_FAILED  },
+    { invalid_txn_2sigs,     sizeof(invalid_txn_2sigs),     FD_TXN_VERIFY_FAILED  },
+    { invalid_txn_2sigs,     sizeof(invalid_txn_2sigs),     FD_TXN_VERIFY_FAILED  },
+  };
+  ulong txn_cnt = sizeof(in)/sizeof(in[0]);
+  FD_TEST( txn_cnt<=FD_VERIFY_BATCH_TXN_MAX );
+
+  uchar            out_buf   [ FD_VERIFY_BATCH_TXN_MAX ][ FD_TXN_MAX_SZ ] __attribute__((aligned(alignof(fd_txn_t))));
+  uchar *          payload   [ FD_VERIFY_BATCH_TXN_MAX ];
+  ushort           payload_sz[ FD_VERIFY_BATCH_TXN_MAX ];
+  fd_txn_t const * txn       [ FD_VERIFY_BATCH_TXN_MAX ];
+  int              res       [ FD_VERIFY_BATCH_TXN_MAX ];
+  ulong            opt_sig   [ FD_VERIFY_BATCH_TXN_MAX ];
+  for( ulong i=0UL; i<txn_cnt; i++ ) {
+    ulong sz;
+    payload[i]    = load_test_txn( in[i].hex, in[i].hex_sz, &sz );
+    payload_sz[i] = (ushort)sz;
+    FD_TEST( fd_txn_parse( payload[i], sz, out_buf[i], NULL ) );
+    txn[i] = (fd_txn_t const *)out_buf[i];
+  }
+
+  fd_txn_verify_batch( ctx, (uchar const * const *)payload, payload_sz, txn, txn_cnt, res, opt_sig );
+  for( ulong i=0UL; i<txn_cnt; i++ ) FD_TEST( res[i]==in[i].exp );
+
+  /* Everything valid is deduped the second time around, and so is the
+     invalid txn with the same first signature as a valid one (in the
+     first batch, it failed verification before the valid one was
+     inserted) */
+
+  fd_txn_verify_batch( ctx, (uchar const * const *)payload, payload_sz, txn, 3UL, res, opt_sig );
+  FD_TEST( res[0]==FD_TXN_VERIFY_DEDUP && res[1]==FD_TXN_VERIFY_DEDUP && res[2]==FD_TXN_VERIFY_DEDUP );
+
+  fd_txn_verify_batch( ctx, (uchar const * const *)payload, payload_sz, txn, 0UL, res, opt_sig );
+
+  if( cached ) {
+    FD_TEST( fd_ed25519_pubkey_cache_hit_cnt( ctx->pubkey_cache ) );
+    FD_TEST( fd_ed25519_pubkey_cache_miss_cnt( ctx->pubkey_cache ) );
+    free( fd_ed25519_pubkey_cache_delete( fd_ed25519_pubkey_cache_leave( ctx->pubkey_cache ) ) );
+  }
+
+  for( ulong i=0UL; i<txn_cnt; i++ ) free( payload[i] );
+  free_verify_ctx( ctx, mem );
+}
+
 int
 main( int     argc,
       char ** argv ) {
@@ -326,6 +398,8 @@ main( int     argc,
   test_verify_invalid_sigs_success();
   test_verify_invalid_dedup_success();
   test_verify_invalid_dedup_with_collision_success();
+  test_verify_batch( 0 );
+  test_verify_batch( 1 );
 
   FD_LOG_NOTICE(( "pass" ));
   fd_halt();
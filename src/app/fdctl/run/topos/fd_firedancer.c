@@ -8,6 +8,7 @@
 #include "../../../../disco/tiles.h"
 #include "../../../../disco/topo/fd_topob.h"
 #include "../../../../disco/topo/fd_pod_format.h"
+#include "../../../../waltz/xdp/fd_xsk.h"
 #include "../../../../flamenco/runtime/fd_blockstore.h"
 #include "../../../../flamenco/runtime/fd_runtime.h"
 #include "../../../../flamenco/runtime/fd_txncache.h"
@@ -18,6 +19,53 @@
 #include <sys/sysinfo.h>
 #include <sys/random.h>
 
+/* setup_topo_net_umem places the XDP frames of a net tile in a dcache
+   that backs all of the tile's out links, such that received packets
+   can be published in place, and lets the tile read the fseqs of the
+   reliable consumers of those links to know when a frame can be
+   reused. */
+
+static void
+setup_topo_net_umem( fd_topo_t *      topo,
+                     fd_topo_tile_t * tile ) {
+  ulong xsk_cnt = fd_ulong_if( strcmp( tile->net.interface, "lo" ) && !tile->kind_id, 2UL, 1UL );
+  ulong umem_sz = xsk_cnt*fd_xsk_umem_footprint( FD_NET_MTU, tile->net.xdp_rx_queue_size, tile->net.xdp_rx_queue_size,
+                                                             tile->net.xdp_tx_queue_size, tile->net.xdp_tx_queue_size );
+
+  /* The burst leaves room to align the frames to FD_XSK_UMEM_ALIGN */
+  fd_topo_obj_t * obj = fd_topob_obj( topo, "dcache", "net_umem" );
+  FD_TEST( fd_pod_insertf_ulong( topo->props, umem_sz/FD_NET_MTU, "obj.%lu.depth", obj->id ) );
+  FD_TEST( fd_pod_insertf_ulong( topo->props, 2UL,                "obj.%lu.burst", obj->id ) );
+  FD_TEST( fd_pod_insertf_ulong( topo->props, FD_NET_MTU,         "obj.%lu.mtu",   obj->id ) );
+  fd_topob_tile_uses( topo, tile, obj, FD_SHMEM_JOIN_MODE_READ_WRITE );
+  tile->net.umem_dcache_obj_id = obj->id;
+
+  /* Each out link holds on to the frames of up to depth frags (a frame
+     is given back at the latest when its mcache line is reused), all of
+     which might come from the same xsk.  The xsk must be left at least
+     one frame on its fill ring, otherwise nothing gets received anymore
+     and no line is ever reused. */
+
+  ulong held_max = 0UL;
+  for( ulong i=0UL; i<tile->out_cnt; i++ ) held_max += topo->links[ tile->out_link_id[ i ] ].depth;
+  if( FD_UNLIKELY( held_max>=tile->net.xdp_rx_queue_size ) )
+    FD_LOG_ERR(( "[tiles.net.zero_copy_rx] needs [tiles.net.xdp_rx_queue_size] (%lu) to be larger than the sum of the depths "
+                 "of the net tile out links (%lu)", tile->net.xdp_rx_queue_size, held_max ));
+
+  for( ulong i=0UL; i<tile->out_cnt; i++ ) {
+    fd_topo_link_t * link = &topo->links[ tile->out_link_id[ i ] ];
+    fd_topob_link_dcache( topo, link->name, link->kind_id, obj );
+
+    for( ulong j=0UL; j<topo->tile_cnt; j++ ) {
+      fd_topo_tile_t * consumer = &topo->tiles[ j ];
+      for( ulong k=0UL; k<consumer->in_cnt; k++ ) {
+        if( FD_LIKELY( consumer->in_link_id[ k ]!=link->id || !consumer->in_link_reliable[ k ] ) ) continue;
+        fd_topob_tile_uses( topo, tile, &topo->objs[ consumer->in_link_fseq_obj_id[ k ] ], FD_SHMEM_JOIN_MODE_READ_ONLY );
+      }
+    }
+  }
+}
+
 static fd_topo_obj_t *
 setup_topo_blockstore( fd_topo_t *  topo,
                        char const * wksp_name,
@@ -73,7 +121,8 @@ fd_topo_initialize( config_t * config ) {
   ulong replay_tpool_thread_count = config->tiles.replay.tpool_thread_count;
   ulong batch_tpool_thread_count  = config->tiles.batch.hash_tpool_thread_count;
 
-  int enable_rpc = ( config->rpc.port != 0 );
+  int enable_rpc     = ( config->rpc.port != 0 );
+  int enable_archive = !!strcmp( config->blockstore.file, "" ); /* finalized blocks are archived to blockstore.file */
 
   fd_topo_t * topo = { fd_topob_new( &config->topo, config->name ) };
 
@@ -130,6 +179,8 @@ fd_topo_initialize( config_t * config ) {
   fd_topob_wksp( topo, "voter_dedup"  );
   fd_topob_wksp( topo, "batch_replay" );
 
+  if( FD_UNLIKELY( config->tiles.net.zero_copy_rx ) ) fd_topob_wksp( topo, "net_umem" );
+
   fd_topob_wksp( topo, "net"        );
   fd_topob_wksp( topo, "quic"       );
   fd_topob_wksp( topo, "verify"     );
@@ -155,7 +206,8 @@ fd_topo_initialize( config_t * config ) {
   fd_topob_wksp( topo, "constipate" );
 
 
-  if( enable_rpc ) fd_topob_wksp( topo, "rpcsrv" );
+  if( enable_rpc )     fd_topob_wksp( topo, "rpcsrv" );
+  if( enable_archive ) fd_topob_wksp( topo, "archiv" );
 
   #define FOR(cnt) for( ulong i=0UL; i<cnt; i++ )
 
@@ -260,6 +312,7 @@ fd_topo_initialize( config_t * config ) {
   /**/                             fd_topob_tile( topo, "batch",   "batch",   "metric_in",  tile_to_cpu[ topo->tile_cnt ], 0 );
   /* These thread tiles must be defined immediately after the snapshot tile. */
   FOR(batch_tpool_thread_count-1)  fd_topob_tile( topo, "btpool",  "btpool",  "metric_in",  tile_to_cpu[ topo->tile_cnt ], 0 );
+  if( enable_archive )             fd_topob_tile( topo, "archiv",  "archiv",  "metric_in",  tile_to_cpu[ topo->tile_cnt ], 0 );
 
   if( enable_rpc )                 fd_topob_tile( topo, "rpcsrv",  "rpcsrv",  "metric_in",  tile_to_cpu[ topo->tile_cnt ], 0 );
 
@@ -279,6 +332,10 @@ fd_topo_initialize( config_t * config ) {
   fd_topob_tile_uses( topo, store_tile,  blockstore_obj, FD_SHMEM_JOIN_MODE_READ_WRITE );
   fd_topob_tile_uses( topo, replay_tile, blockstore_obj, FD_SHMEM_JOIN_MODE_READ_WRITE );
   fd_topob_tile_uses( topo, repair_tile, blockstore_obj, FD_SHMEM_JOIN_MODE_READ_ONLY );
+  if( enable_archive ) {
+    fd_topo_tile_t * archv_tile = &topo->tiles[ fd_topo_find_tile( topo, "archiv", 0UL ) ];
+    fd_topob_tile_uses( topo, archv_tile, blockstore_obj, FD_SHMEM_JOIN_MODE_READ_WRITE );
+  }
   if( enable_rpc ) {
     fd_topo_tile_t * rpcserv_tile = &topo->tiles[ fd_topo_find_tile( topo, "rpcsrv", 0UL ) ];
     fd_topob_tile_uses( topo, rpcserv_tile, blockstore_obj, FD_SHMEM_JOIN_MODE_READ_ONLY );
@@ -355,6 +412,8 @@ fd_topo_initialize( config_t * config ) {
                        fd_topob_tile_in(  topo, "net",     i,            "metric_in", "quic_net",     j,            FD_TOPOB_UNRELIABLE, FD_TOPOB_POLLED ); /* No reliable consumers of networking fragments, may be dropped or overrun */
   FOR(quic_tile_cnt) for( ulong j=0UL; j<net_tile_cnt; j++ )
                        fd_topob_tile_in(  topo, "quic",    i,            "metric_in", "net_quic",     j,            FD_TOPOB_UNRELIABLE, FD_TOPOB_POLLED ); /* No reliable consumers of networking fragments, may be dropped or overrun */
+  FOR(quic_tile_cnt)   fd_topob_tile_in(  topo, "quic",    i,            "metric_in", "stake_out",    0UL,          FD_TOPOB_UNRELIABLE, FD_TOPOB_POLLED );
+  FOR(quic_tile_cnt)   fd_topob_tile_in(  topo, "quic",    i,            "metric_in", "crds_shred",   0UL,          FD_TOPOB_UNRELIABLE, FD_TOPOB_POLLED );
   FOR(quic_tile_cnt)   fd_topob_tile_out( topo, "quic",    i,                         "quic_verify",  i                                                  );
   FOR(quic_tile_cnt)   fd_topob_tile_out( topo, "quic",    i,                         "quic_net",     i                                                  );
   /* All verify tiles read from all QUIC tiles, packets are round robin. */
@@ -513,6 +572,7 @@ fd_topo_initialize( config_t * config ) {
       tile->net.xdp_tx_queue_size              = config->tiles.net.xdp_tx_queue_size;
       tile->net.src_ip_addr                    = config->tiles.net.ip_addr;
       tile->net.zero_copy                      = !!strcmp( config->tiles.net.xdp_mode, "skb" ); /* disable zc for skb */
+      tile->net.zero_copy_rx                   = config->tiles.net.zero_copy_rx;
       fd_memset( tile->net.xdp_mode, 0, 4 );
       fd_memcpy( tile->net.xdp_mode, config->tiles.net.xdp_mode, strnlen( config->tiles.net.xdp_mode, 3 ) );  /* GCC complains about strncpy */
 
@@ -529,6 +589,8 @@ fd_topo_initialize( config_t * config ) {
         tile->net.multihome_ip_addrs[j] = config->tiles.net.multihome_ip4_addrs[j];
       }
 
+      if( FD_UNLIKELY( tile->net.zero_copy_rx ) ) setup_topo_net_umem( topo, tile );
+
     } else if( FD_UNLIKELY( !strcmp( tile->name, "quic" ) ) ) {
       fd_memcpy( tile->quic.src_mac_addr, config->tiles.net.mac_addr, 6 );
 
@@ -541,6 +603,7 @@ fd_topo_initialize( config_t * config ) {
       tile->quic.idle_timeout_millis            = config->tiles.quic.idle_timeout_millis;
       tile->quic.ack_delay_millis               = config->tiles.quic.ack_delay_millis;
       tile->quic.retry                          = config->tiles.quic.retry;
+      strncpy( tile->quic.identity_key_path, config->consensus.identity_path, sizeof(tile->quic.identity_key_path) );
 
     } else if( FD_UNLIKELY( !strcmp( tile->name, "verify" ) ) ) {
       tile->verify.tcache_depth = config->tiles.verify.signature_cache_size;
@@ -632,6 +695,13 @@ fd_topo_initialize( config_t * config ) {
       if( FD_UNLIKELY( tile->replay.tpool_thread_count == 0 || tile->replay.tpool_thread_count>=FD_TILE_MAX-1 ) ) {
         FD_LOG_ERR(( "bad tpool_thread_count %lu", tile->replay.tpool_thread_count ));
       }
+      if( FD_LIKELY( !strcmp( config->tiles.replay.txn_sched, "waves" ) || !strcmp( config->tiles.replay.txn_sched, "" ) ) ) {
+        tile->replay.txn_sched = FD_RUNTIME_TXN_SCHED_WAVES;
+      } else if( !strcmp( config->tiles.replay.txn_sched, "dag" ) ) {
+        tile->replay.txn_sched = FD_RUNTIME_TXN_SCHED_DAG;
+      } else {
+        FD_LOG_ERR(( "unknown [tiles.replay.txn_sched] %s (expected dag or waves)", config->tiles.replay.txn_sched ));
+      }
       strncpy( tile->replay.cluster_version, config->tiles.replay.cluster_version, sizeof(tile->replay.cluster_version) );
       tile->replay.bank_tile_count = config->layout.bank_tile_count;
       tile->replay.in_wen_restart  = config->tiles.replay.in_wen_restart;
@@ -684,6 +754,8 @@ fd_topo_initialize( config_t * config ) {
       strncpy( tile->sender.identity_key_path, config->consensus.identity_path, sizeof(tile->sender.identity_key_path) );
     } else if( FD_UNLIKELY( !strcmp( tile->name, "eqvoc" ) ) ) {
       strncpy( tile->eqvoc.identity_key_path, config->consensus.identity_path, sizeof(tile->eqvoc.identity_key_path) );
+    } else if( FD_UNLIKELY( !strcmp( tile->name, "archiv" ) ) ) {
+      strncpy( tile->archiver.blockstore_file, config->blockstore.file, sizeof(tile->archiver.blockstore_file) );
     } else if( FD_UNLIKELY( !strcmp( tile->name, "rpcsrv" ) ) ) {
       strncpy( tile->replay.blockstore_file, config->blockstore.file, sizeof(tile->replay.blockstore_file) );
       tile->replay.funk_rec_max = config->tiles.replay.funk_rec_max;
@@ -4,9 +4,57 @@
 #include "../../../../disco/tiles.h"
 #include "../../../../disco/topo/fd_topob.h"
 #include "../../../../disco/topo/fd_pod_format.h"
+#include "../../../../waltz/xdp/fd_xsk.h"
 #include "../../../../util/tile/fd_tile_private.h"
 #include "../../../../util/shmem/fd_shmem_private.h"
 
+/* setup_topo_net_umem places the XDP frames of a net tile in a dcache
+   that backs all of the tile's out links, such that received packets
+   can be published in place, and lets the tile read the fseqs of the
+   reliable consumers of those links to know when a frame can be
+   reused. */
+
+static void
+setup_topo_net_umem( fd_topo_t *      topo,
+                     fd_topo_tile_t * tile ) {
+  ulong xsk_cnt = fd_ulong_if( strcmp( tile->net.interface, "lo" ) && !tile->kind_id, 2UL, 1UL );
+  ulong umem_sz = xsk_cnt*fd_xsk_umem_footprint( FD_NET_MTU, tile->net.xdp_rx_queue_size, tile->net.xdp_rx_queue_size,
+                                                             tile->net.xdp_tx_queue_size, tile->net.xdp_tx_queue_size );
+
+  /* The burst leaves room to align the frames to FD_XSK_UMEM_ALIGN */
+  fd_topo_obj_t * obj = fd_topob_obj( topo, "dcache", "net_umem" );
+  FD_TEST( fd_pod_insertf_ulong( topo->props, umem_sz/FD_NET_MTU, "obj.%lu.depth", obj->id ) );
+  FD_TEST( fd_pod_insertf_ulong( topo->props, 2UL,                "obj.%lu.burst", obj->id ) );
+  FD_TEST( fd_pod_insertf_ulong( topo->props, FD_NET_MTU,         "obj.%lu.mtu",   obj->id ) );
+  fd_topob_tile_uses( topo, tile, obj, FD_SHMEM_JOIN_MODE_READ_WRITE );
+  tile->net.umem_dcache_obj_id = obj->id;
+
+  /* Each out link holds on to the frames of up to depth frags (a frame
+     is given back at the latest when its mcache line is reused), all of
+     which might come from the same xsk.  The xsk must be left at least
+     one frame on its fill ring, otherwise nothing gets received anymore
+     and no line is ever reused. */
+
+  ulong held_max = 0UL;
+  for( ulong i=0UL; i<tile->out_cnt; i++ ) held_max += topo->links[ tile->out_link_id[ i ] ].depth;
+  if( FD_UNLIKELY( held_max>=tile->net.xdp_rx_queue_size ) )
+    FD_LOG_ERR(( "[tiles.net.zero_copy_rx] needs [tiles.net.xdp_rx_queue_size] (%lu) to be larger than the sum of the depths "
+                 "of the net tile out links (%lu)", tile->net.xdp_rx_queue_size, held_max ));
+
+  for( ulong i=0UL; i<tile->out_cnt; i++ ) {
+    fd_topo_link_t * link = &topo->links[ tile->out_link_id[ i ] ];
+    fd_topob_link_dcache( topo, link->name, link->kind_id, obj );
+
+    for( ulong j=0UL; j<topo->tile_cnt; j++ ) {
+      fd_topo_tile_t * consumer = &topo->tiles[ j ];
+      for( ulong k=0UL; k<consumer->in_cnt; k++ ) {
+        if( FD_LIKELY( consumer->in_link_id[ k ]!=link->id || !consumer->in_link_reliable[ k ] ) ) continue;
+        fd_topob_tile_uses( topo, tile, &topo->objs[ consumer->in_link_fseq_obj_id[ k ] ], FD_SHMEM_JOIN_MODE_READ_ONLY );
+      }
+    }
+  }
+}
+
 void
 fd_topo_initialize( config_t * config ) {
   ulong net_tile_cnt    = config->layout.net_tile_count;
@@ -37,6 +85,8 @@ fd_topo_initialize( config_t * config ) {
   fd_topob_wksp( topo, "shred_sign"   );
   fd_topob_wksp( topo, "sign_shred"   );
 
+  if( FD_UNLIKELY( config->tiles.net.zero_copy_rx ) ) fd_topob_wksp( topo, "net_umem" );
+
   fd_topob_wksp( topo, "net"          );
   fd_topob_wksp( topo, "quic"         );
   fd_topob_wksp( topo, "verify"       );
@@ -167,6 +217,8 @@ fd_topo_initialize( config_t * config ) {
 
   FOR(quic_tile_cnt) for( ulong j=0UL; j<net_tile_cnt; j++ )
                        fd_topob_tile_in(  topo, "quic",    i,            "metric_in", "net_quic",     j,            FD_TOPOB_UNRELIABLE, FD_TOPOB_POLLED ); /* No reliable consumers of networking fragments, may be dropped or overrun */
+  FOR(quic_tile_cnt)   fd_topob_tile_in(  topo, "quic",    i,            "metric_in", "stake_out",    0UL,          FD_TOPOB_UNRELIABLE, FD_TOPOB_POLLED );
+  FOR(quic_tile_cnt)   fd_topob_tile_in(  topo, "quic",    i,            "metric_in", "crds_shred",   0UL,          FD_TOPOB_UNRELIABLE, FD_TOPOB_POLLED );
   FOR(quic_tile_cnt)   fd_topob_tile_out( topo, "quic",    i,                         "quic_verify",  i                                                  );
   FOR(quic_tile_cnt)   fd_topob_tile_out( topo, "quic",    i,                         "quic_net",     i                                                  );
   /* All verify tiles read from all QUIC tiles, packets are round robin. */
@@ -344,6 +396,7 @@ fd_topo_initialize( config_t * config ) {
       tile->net.xdp_tx_queue_size = config->tiles.net.xdp_tx_queue_size;
       tile->net.src_ip_addr       = config->tiles.net.ip_addr;
       tile->net.zero_copy         = !!strcmp( config->tiles.net.xdp_mode, "skb" ); /* disable zc for skb */
+      tile->net.zero_copy_rx      = config->tiles.net.zero_copy_rx;
       fd_memset( tile->net.xdp_mode, 0, 4 );
       fd_memcpy( tile->net.xdp_mode, config->tiles.net.xdp_mode, strnlen( config->tiles.net.xdp_mode, 3 ) );  /* GCC complains about strncpy */
 
@@ -356,6 +409,8 @@ fd_topo_initialize( config_t * config ) {
       for( ulong j = 0; j < multi_cnt; ++j ) {
         tile->net.multihome_ip_addrs[j] = config->tiles.net.multihome_ip4_addrs[j];
       }
+
+      if( FD_UNLIKELY( tile->net.zero_copy_rx ) ) setup_topo_net_umem( topo, tile );
     } else if( FD_UNLIKELY( !strcmp( tile->name, "quic" ) ) ) {
       fd_memcpy( tile->quic.src_mac_addr, config->tiles.net.mac_addr, 6 );
 
@@ -368,6 +423,7 @@ fd_topo_initialize( config_t * config ) {
       tile->quic.idle_timeout_millis            = config->tiles.quic.idle_timeout_millis;
       tile->quic.ack_delay_millis               = config->tiles.quic.ack_delay_millis;
       tile->quic.retry                          = config->tiles.quic.retry;
+      strncpy( tile->quic.identity_key_path, config->consensus.identity_path, sizeof(tile->quic.identity_key_path) );
 
     } else if( FD_UNLIKELY( !strcmp( tile->name, "verify" ) ) ) {
       tile->verify.tcache_depth = config->tiles.verify.signature_cache_size;
@@ -14,7 +14,9 @@
 #include "../../flamenco/fd_flamenco.h"
 #include "../../flamenco/nanopb/pb_decode.h"
 #include "../../flamenco/runtime/fd_hashes.h"
+#include "../../flamenco/runtime/fd_accounts_hash_cache.h"
 #include "../../funk/fd_funk_filemap.h"
+#include "../../funk/fd_funk_cold.h"
 #include "../../flamenco/types/fd_types.h"
 #include "../../flamenco/runtime/fd_runtime.h"
 #include "../../flamenco/runtime/fd_account.h"
@@ -56,6 +58,9 @@ struct fd_ledger_args {
   ulong                 index_max;               /* size of funk index (same as rec max) */
   char const *          funk_file;               /* path to funk backing store */
   ulong                 funk_page_cnt;
+  char const *          funk_cold_file;          /* path to the funk cold tier value log, NULL if none */
+  ulong                 funk_cold_sz;            /* funk cold tier log capacity in GiB */
+  ulong                 funk_cold_age;           /* evict funk values not written in this many slots, every this many slots */
   fd_funk_close_file_args_t funk_close_args;
   char const *          snapshot;                /* path to agave snapshot */
   char const *          incremental;             /* path to agave incremental snapshot */
@@ -72,6 +77,7 @@ struct fd_ledger_args {
   int                   capture_txns;            /* solcap: determine if transaction results should be captured for solcap*/
   char const *          checkpt_path;            /* path to dump funk wksp checkpoints during execution*/
   ulong                 checkpt_freq;            /* how often funk wksp checkpoints will be dumped (defaults to never) */
+  char const *          checkpt_archive;         /* path to the chain of funk record checkpoints dumped during execution */
   int                   checkpt_mismatch;        /* determine if a funk wksp checkpoint should be dumped on a mismatch*/
 
   int                   dump_insn_to_pb;         /* instruction dumping: should insns be dumped */
@@ -82,6 +88,7 @@ struct fd_ledger_args {
 
   int                   verify_funk;             /* verify funk before execution starts */
   uint                  verify_acc_hash;         /* verify account hash from the snapshot */
+  uint                  snapshot_par_restore;    /* restore multi-frame snapshots using all tpool threads */
   uint                  check_acc_hash;          /* check account hash by reconstructing with data */
   ulong                 trash_hash;              /* trash hash to be used for negative cases*/
   ulong                 vote_acct_max;           /* max number of vote accounts */
@@ -120,6 +127,8 @@ struct fd_ledger_args {
   ulong                 last_snapshot_cap;       /* last snapshot account capitalization */
   int                   is_snapshotting;         /* determine if a snapshot is being created */
   int                   snapshot_mismatch;       /* determine if a snapshot should be created on a mismatch */
+  int                   txn_sched;               /* transaction scheduler used for replay (FD_RUNTIME_TXN_SCHED_*) */
+  int                   accounts_hash_cache;     /* update the accounts hash incrementally across slots */
 
   uchar *               bg_snapshot_scr_mem;
   uchar *               snapshot_scr_mem;
@@ -145,17 +154,8 @@ fd_create_snapshot_task( void FD_PARAM_UNUSED *tpool,
   fd_snapshot_ctx_t * snapshot_ctx = (fd_snapshot_ctx_t *)t0;
   fd_ledger_args_t *  ledger_args  = (fd_ledger_args_t *)t1;
 
-  char tmp_dir_buf[ FD_SNAPSHOT_DIR_MAX ];
-  int err = snprintf( tmp_dir_buf, FD_SNAPSHOT_DIR_MAX, "%s/%s",
-                      snapshot_ctx->out_dir,
-                      snapshot_ctx->is_incremental ? FD_SNAPSHOT_TMP_INCR_ARCHIVE : FD_SNAPSHOT_TMP_ARCHIVE );
-  if( FD_UNLIKELY( err<0 ) ) {
-    FD_LOG_WARNING(( "Failed to format directory string" ));
-    return;
-  }
-
   char zstd_dir_buf[ FD_SNAPSHOT_DIR_MAX ];
-  err = snprintf( zstd_dir_buf, FD_SNAPSHOT_DIR_MAX, "%s/%s",
+  int err = snprintf( zstd_dir_buf, FD_SNAPSHOT_DIR_MAX, "%s/%s",
                   snapshot_ctx->out_dir,
                   snapshot_ctx->is_incremental ? FD_SNAPSHOT_TMP_INCR_ARCHIVE_ZSTD : FD_SNAPSHOT_TMP_FULL_ARCHIVE_ZSTD );
   if( FD_UNLIKELY( err<0 ) ) {
@@ -165,12 +165,6 @@ fd_create_snapshot_task( void FD_PARAM_UNUSED *tpool,
 
   /* Create and open the relevant files for snapshots. */
 
-  snapshot_ctx->tmp_fd = open( tmp_dir_buf, O_CREAT | O_RDWR | O_TRUNC, 0644 );
-  if( FD_UNLIKELY( snapshot_ctx->tmp_fd==-1 ) ) {
-    FD_LOG_WARNING(( "Failed to open and create tarball for file=%s (%i-%s)", tmp_dir_buf, errno, fd_io_strerror( errno ) ));
-    return;
-  }
-
   snapshot_ctx->snapshot_fd = open( zstd_dir_buf, O_RDWR | O_CREAT | O_TRUNC, 0644 );
   if( FD_UNLIKELY( snapshot_ctx->snapshot_fd==-1 ) ) {
     FD_LOG_WARNING(( "Failed to open the snapshot file (%i-%s)", errno, fd_io_strerror( errno ) ));
@@ -188,11 +182,6 @@ fd_create_snapshot_task( void FD_PARAM_UNUSED *tpool,
   ledger_args->slot_ctx->epoch_ctx->constipate_root = 0;
   ledger_args->is_snapshotting                      = 0;
 
-  err = close( snapshot_ctx->tmp_fd );
-  if( FD_UNLIKELY( err ) ) {
-    FD_LOG_ERR(( "failed to close tmp_fd" ));
-  }
-
   err = close( snapshot_ctx->snapshot_fd );
   if( FD_UNLIKELY( err ) ) {
     FD_LOG_ERR(( "failed to close snapshot_fd" ));
@@ -551,6 +540,20 @@ runtime_replay( fd_ledger_args_t * ledger_args ) {
 
     prev_slot = slot;
 
+    /* Move the values of accounts that have not been written recently
+       to the funk cold tier.  Snapshot creation walks the published
+       records in the background, so eviction waits for it. */
+    if( ledger_args->funk_cold_file ) {
+      fd_funk_t * funk = ledger_args->funk;
+      fd_funk_start_write( funk );
+      fd_funk_cold_clock_set( funk, slot );
+      if( !ledger_args->is_snapshotting && slot%ledger_args->funk_cold_age==0UL ) {
+        ulong evict_cnt = fd_funk_cold_evict( funk, ledger_args->funk_cold_age );
+        FD_LOG_INFO(( "evicted %lu funk values to the cold tier at slot %lu", evict_cnt, slot ));
+      }
+      fd_funk_end_write( funk );
+    }
+
     if( slot<ledger_args->end_slot ) {
       /* TODO: This currently doesn't support switching over on slots that occur
          on a fork */
@@ -677,10 +680,11 @@ fd_ledger_main_setup( fd_ledger_args_t * args ) {
   int has_solcap           = args->capture_fpath && args->capture_fpath[0] != '\0';
   int has_checkpt          = args->checkpt_path && args->checkpt_path[0] != '\0';
   int has_checkpt_funk     = args->checkpt_funk && args->checkpt_funk[0] != '\0';
+  int has_checkpt_archive  = args->checkpt_archive && args->checkpt_archive[0] != '\0';
   int has_prune            = args->pruned_funk != NULL;
   int has_dump_to_protobuf = args->dump_insn_to_pb || args->dump_txn_to_pb;
 
-  if( has_solcap || has_checkpt || has_checkpt_funk || has_prune || has_dump_to_protobuf ) {
+  if( has_solcap || has_checkpt || has_checkpt_funk || has_checkpt_archive || has_prune || has_dump_to_protobuf ) {
     FILE * capture_file = NULL;
 
     void * capture_ctx_mem = fd_valloc_malloc( args->valloc, FD_CAPTURE_CTX_ALIGN, FD_CAPTURE_CTX_FOOTPRINT );
@@ -705,6 +709,10 @@ fd_ledger_main_setup( fd_ledger_args_t * args ) {
       args->capture_ctx->checkpt_path = ( has_checkpt ? args->checkpt_path : args->checkpt_funk );
       args->capture_ctx->checkpt_freq = args->checkpt_freq;
     }
+    if( has_checkpt_archive ) {
+      args->capture_ctx->checkpt_archive = args->checkpt_archive;
+      args->capture_ctx->checkpt_freq    = args->checkpt_freq;
+    }
     if( has_prune ) {
       args->capture_ctx->pruned_funk = args->pruned_funk;
     }
@@ -720,6 +728,7 @@ fd_ledger_main_setup( fd_ledger_args_t * args ) {
   fd_runtime_recover_banks( args->slot_ctx, 1, args->genesis==NULL, args->valloc );
 
   args->slot_ctx->snapshot_freq      = args->snapshot_freq;
+  args->slot_ctx->txn_sched          = args->txn_sched;
   args->slot_ctx->incremental_freq   = args->incremental_freq;
   args->slot_ctx->last_snapshot_slot = 0UL;
   args->last_snapshot_slot           = 0UL;
@@ -947,18 +956,46 @@ void
 init_funk( fd_ledger_args_t * args ) {
   fd_funk_t * funk;
   if( args->restore_funk ) {
-    funk = fd_funk_recover_checkpoint( args->funk_file, 1, args->restore_funk, &args->funk_close_args );
+    /* The replay tpool is not set up yet (its scratch comes from the
+       runtime allocator).  Restore using the same worker tiles in a
+       tpool without scratch that is torn down before init_tpool. */
+    ulong        tcnt  = fd_ulong_if( fd_tile_cnt()>args->snapshot_tcnt, fd_tile_cnt()-args->snapshot_tcnt, 1UL );
+    fd_tpool_t * tpool = fd_tpool_init( args->tpool_mem, tcnt );
+    if( FD_UNLIKELY( !tpool ) ) FD_LOG_ERR(( "failed to create thread pool" ));
+    for( ulong i=1UL; i<tcnt; i++ ) {
+      if( FD_UNLIKELY( !fd_tpool_worker_push( tpool, i, NULL, 0UL ) ) ) FD_LOG_ERR(( "failed to launch worker" ));
+    }
+    funk = fd_funk_recover_checkpoint( args->funk_file, 1, args->restore_funk, tpool, 0UL, tcnt, &args->funk_close_args );
+    fd_tpool_fini( tpool );
   } else  {
     funk = fd_funk_open_file( args->funk_file, 1, args->hashseed, args->txns_max, args->index_max, args->funk_page_cnt*(1UL<<30), FD_FUNK_OVERWRITE, &args->funk_close_args );
   }
   args->funk = funk;
   args->funk_wksp = fd_funk_wksp( funk );
+
+  if( args->funk_cold_file ) {
+    /* A restored funk may already have its cold tier attached */
+    fd_funk_cold_shmem_t const * cold = fd_funk_cold_shmem( funk );
+    if( cold ) {
+      if( FD_UNLIKELY( strcmp( cold->path, args->funk_cold_file ) ) ) {
+        FD_LOG_ERR(( "funk cold tier is at %s, not %s", cold->path, args->funk_cold_file ));
+      }
+      if( FD_UNLIKELY( !fd_funk_cold_join( funk ) ) ) FD_LOG_ERR(( "failed to join funk cold tier %s", cold->path ));
+    } else {
+      fd_funk_start_write( funk );
+      int err = fd_funk_cold_open( funk, args->funk_cold_file, args->funk_cold_sz<<30 );
+      fd_funk_end_write( funk );
+      if( FD_UNLIKELY( err ) ) FD_LOG_ERR(( "failed to open funk cold tier %s (%i-%s)", args->funk_cold_file, err, fd_funk_strerror( err ) ));
+    }
+    FD_LOG_NOTICE(( "funk cold tier at %s, evicting values older than %lu slots", args->funk_cold_file, args->funk_cold_age ));
+  }
   FD_LOG_NOTICE(( "funky at global address 0x%016lx with %lu records", fd_wksp_gaddr_fast( args->funk_wksp, funk ),
                                                                        fd_funk_rec_cnt( fd_funk_rec_map( funk, args->funk_wksp ) ) ));
 }
 
 void
 cleanup_funk( fd_ledger_args_t * args ) {
+  fd_funk_cold_log_metrics( args->funk );
   fd_funk_close_file( &args->funk_close_args );
 }
 
@@ -1157,11 +1194,11 @@ ingest( fd_ledger_args_t * args ) {
 
   /* Load in snapshot(s) */
   if( args->snapshot ) {
-    fd_snapshot_load_all( args->snapshot, slot_ctx, NULL, args->tpool, args->verify_acc_hash, args->check_acc_hash , FD_SNAPSHOT_TYPE_FULL, args->valloc );
+    fd_snapshot_load_all( args->snapshot, slot_ctx, NULL, args->tpool, args->verify_acc_hash, args->check_acc_hash, args->snapshot_par_restore, FD_SNAPSHOT_TYPE_FULL, args->valloc );
     FD_LOG_NOTICE(( "imported %lu records from snapshot", fd_funk_rec_cnt( fd_funk_rec_map( funk, fd_funk_wksp( funk ) ) ) ));
   }
   if( args->incremental ) {
-    fd_snapshot_load_all( args->incremental, slot_ctx, NULL, args->tpool, args->verify_acc_hash, args->check_acc_hash, FD_SNAPSHOT_TYPE_INCREMENTAL, args->valloc );
+    fd_snapshot_load_all( args->incremental, slot_ctx, NULL, args->tpool, args->verify_acc_hash, args->check_acc_hash, args->snapshot_par_restore, FD_SNAPSHOT_TYPE_INCREMENTAL, args->valloc );
     FD_LOG_NOTICE(( "imported %lu records from incremental snapshot", fd_funk_rec_cnt( fd_funk_rec_map( funk, fd_funk_wksp( funk ) ) ) ));
   }
 
@@ -1285,6 +1322,17 @@ replay( fd_ledger_args_t * args ) {
   args->slot_ctx->epoch_ctx = args->epoch_ctx;
   args->slot_ctx->acc_mgr = fd_acc_mgr_new( args->acc_mgr, funk );
   args->slot_ctx->blockstore = args->blockstore;
+  if( args->accounts_hash_cache ) {
+    /* Attached before replay such that the account updates of every
+       replayed slot get marked in the cache */
+    void * cache_mem = fd_wksp_alloc_laddr( args->wksp,
+                                            fd_accounts_hash_cache_align(),
+                                            fd_accounts_hash_cache_footprint( FD_ACCOUNTS_HASH_CACHE_LG_PART_CNT_DEFAULT ),
+                                            FD_ACCOUNTS_HASH_CACHE_MAGIC );
+    fd_accounts_hash_cache_t * cache = fd_accounts_hash_cache_join( fd_accounts_hash_cache_new( cache_mem, FD_ACCOUNTS_HASH_CACHE_LG_PART_CNT_DEFAULT ) );
+    FD_TEST( cache );
+    fd_acc_mgr_set_hash_cache( args->slot_ctx, cache, args->valloc );
+  }
   void * status_cache_mem = fd_wksp_alloc_laddr( args->wksp,
                                                  FD_TXNCACHE_ALIGN,
                                                  fd_txncache_footprint( FD_TXNCACHE_DEFAULT_MAX_ROOTED_SLOTS,
@@ -1314,6 +1362,7 @@ replay( fd_ledger_args_t * args ) {
                             args->tpool,
                             args->verify_acc_hash,
                             args->check_acc_hash,
+                            args->snapshot_par_restore,
                             FD_SNAPSHOT_TYPE_FULL,
                             args->valloc );
       FD_LOG_NOTICE(( "imported %lu records from snapshot", fd_funk_rec_cnt( fd_funk_rec_map( funk, fd_funk_wksp( funk ) ) ) ));
@@ -1325,6 +1374,7 @@ replay( fd_ledger_args_t * args ) {
                             args->tpool,
                             args->verify_acc_hash,
                             args->check_acc_hash,
+                            args->snapshot_par_restore,
                             FD_SNAPSHOT_TYPE_INCREMENTAL,
                             args->valloc );
       FD_LOG_NOTICE(( "imported %lu records from snapshot", fd_funk_rec_cnt( fd_funk_rec_map( funk, fd_funk_wksp( funk ) ) ) ));
@@ -1338,7 +1388,7 @@ replay( fd_ledger_args_t * args ) {
 
   fd_ledger_main_setup( args );
 
-  fd_blockstore_init( args->blockstore, -1, FD_BLOCKSTORE_ARCHIVE_MIN_SIZE, &args->slot_ctx->slot_bank );
+  fd_blockstore_init( args->blockstore, -1, FD_BLOCKSTORE_ARCHIVE_MIN_SIZE + fd_blockstore_archive_idx_footprint( args->blockstore ), &args->slot_ctx->slot_bank );
 
   FD_LOG_WARNING(( "setup done" ));
 
@@ -1380,11 +1430,11 @@ prune( fd_ledger_args_t * args ) {
   if( !rec_cnt ) {
     /* Load in snapshot(s) */
     if( args->snapshot ) {
-      fd_snapshot_load_all( args->snapshot, args->slot_ctx, NULL, args->tpool, args->verify_acc_hash, args->check_acc_hash, FD_SNAPSHOT_TYPE_FULL, args->valloc );
+      fd_snapshot_load_all( args->snapshot, args->slot_ctx, NULL, args->tpool, args->verify_acc_hash, args->check_acc_hash, args->snapshot_par_restore, FD_SNAPSHOT_TYPE_FULL, args->valloc );
       FD_LOG_NOTICE(( "imported %lu records from snapshot", fd_funk_rec_cnt( fd_funk_rec_map( funk, fd_funk_wksp( funk ) ) ) ));
     }
     if( args->incremental ) {
-      fd_snapshot_load_all( args->incremental, args->slot_ctx, NULL, args->tpool, args->verify_acc_hash, args->check_acc_hash, FD_SNAPSHOT_TYPE_INCREMENTAL, args->valloc );
+      fd_snapshot_load_all( args->incremental, args->slot_ctx, NULL, args->tpool, args->verify_acc_hash, args->check_acc_hash, args->snapshot_par_restore, FD_SNAPSHOT_TYPE_INCREMENTAL, args->valloc );
       FD_LOG_NOTICE(( "imported %lu records from snapshot", fd_funk_rec_cnt( fd_funk_rec_map( funk, fd_funk_wksp( funk ) ) ) ));
     }
   }
@@ -1487,11 +1537,11 @@ prune( fd_ledger_args_t * args ) {
 
   /* Load in snapshot(s) */
   if( args->snapshot ) {
-    fd_snapshot_load_all( args->snapshot, args->slot_ctx, NULL, args->tpool, 0, 0, FD_SNAPSHOT_TYPE_FULL, args->valloc );
+    fd_snapshot_load_all( args->snapshot, args->slot_ctx, NULL, args->tpool, 0, 0, args->snapshot_par_restore, FD_SNAPSHOT_TYPE_FULL, args->valloc );
     FD_LOG_NOTICE(( "reload: imported %lu records from snapshot", fd_funk_rec_cnt( fd_funk_rec_map( funk, fd_funk_wksp( funk ) ) ) ));
   }
   if( args->incremental ) {
-    fd_snapshot_load_all( args->incremental, args->slot_ctx, NULL, args->tpool, 0, 0, FD_SNAPSHOT_TYPE_INCREMENTAL, args->valloc );
+    fd_snapshot_load_all( args->incremental, args->slot_ctx, NULL, args->tpool, 0, 0, args->snapshot_par_restore, FD_SNAPSHOT_TYPE_INCREMENTAL, args->valloc );
     FD_LOG_NOTICE(( "reload: imported %lu records from snapshot", fd_funk_rec_cnt( fd_funk_rec_map( funk, fd_funk_wksp( funk ) ) ) ));
   }
 
@@ -1626,6 +1676,9 @@ initial_setup( int argc, char ** argv, fd_ledger_args_t * args ) {
 
   char const * wksp_name               = fd_env_strip_cmdline_cstr  ( &argc, &argv, "--wksp-name",               NULL, NULL      );
   ulong        funk_page_cnt           = fd_env_strip_cmdline_ulong ( &argc, &argv, "--funk-page-cnt",           NULL, 5         );
+  char const * funk_cold_file          = fd_env_strip_cmdline_cstr  ( &argc, &argv, "--funk-cold-file",          NULL, NULL      );
+  ulong        funk_cold_sz            = fd_env_strip_cmdline_ulong ( &argc, &argv, "--funk-cold-sz",            NULL, 64UL      );
+  ulong        funk_cold_age           = fd_env_strip_cmdline_ulong ( &argc, &argv, "--funk-cold-age",           NULL, 1000UL    );
   ulong        page_cnt                = fd_env_strip_cmdline_ulong ( &argc, &argv, "--page-cnt",                NULL, 5         );
   int          reset                   = fd_env_strip_cmdline_int   ( &argc, &argv, "--reset",                   NULL, 0         );
   char const * cmd                     = fd_env_strip_cmdline_cstr  ( &argc, &argv, "--cmd",                     NULL, NULL      );
@@ -1643,6 +1696,7 @@ initial_setup( int argc, char ** argv, fd_ledger_args_t * args ) {
   ulong        end_slot                = fd_env_strip_cmdline_ulong ( &argc, &argv, "--end-slot",                NULL, ULONG_MAX );
   uint         verify_acc_hash         = fd_env_strip_cmdline_uint  ( &argc, &argv, "--verify-acc-hash",         NULL, 1         );
   uint         check_acc_hash          = fd_env_strip_cmdline_uint  ( &argc, &argv, "--check-acc-hash",          NULL, 1         );
+  uint         snapshot_par_restore    = fd_env_strip_cmdline_uint  ( &argc, &argv, "--snapshot-par-restore",    NULL, 0         );
   char const * restore                 = fd_env_strip_cmdline_cstr  ( &argc, &argv, "--restore",                 NULL, NULL      );
   char const * restore_funk            = fd_env_strip_cmdline_cstr  ( &argc, &argv, "--funk-restore",            NULL, NULL      );
   char const * shredcap                = fd_env_strip_cmdline_cstr  ( &argc, &argv, "--shred-cap",               NULL, NULL      );
@@ -1657,6 +1711,7 @@ initial_setup( int argc, char ** argv, fd_ledger_args_t * args ) {
   int          capture_txns            = fd_env_strip_cmdline_int   ( &argc, &argv, "--capture-txns",            NULL, 1         );
   char const * checkpt_path            = fd_env_strip_cmdline_cstr  ( &argc, &argv, "--checkpt-path",            NULL, NULL      );
   ulong        checkpt_freq            = fd_env_strip_cmdline_ulong ( &argc, &argv, "--checkpt-freq",            NULL, ULONG_MAX );
+  char const * checkpt_archive         = fd_env_strip_cmdline_cstr  ( &argc, &argv, "--checkpt-archive",         NULL, NULL      );
   int          checkpt_mismatch        = fd_env_strip_cmdline_int   ( &argc, &argv, "--checkpt-mismatch",        NULL, 0         );
   char const * allocator               = fd_env_strip_cmdline_cstr  ( &argc, &argv, "--allocator",               NULL, "wksp"    );
   int          abort_on_mismatch       = fd_env_strip_cmdline_int   ( &argc, &argv, "--abort-on-mismatch",       NULL, 1         );
@@ -1678,6 +1733,8 @@ initial_setup( int argc, char ** argv, fd_ledger_args_t * args ) {
   ulong        snapshot_tcnt           = fd_env_strip_cmdline_ulong ( &argc, &argv, "--snapshot-tcnt",           NULL, 2UL       );
   double       allowed_mem_delta       = fd_env_strip_cmdline_double( &argc, &argv, "--allowed-mem-delta",       NULL, 0.1       );
   int          snapshot_mismatch       = fd_env_strip_cmdline_int   ( &argc, &argv, "--snapshot-mismatch",       NULL, 0         );
+  char const * txn_sched               = fd_env_strip_cmdline_cstr  ( &argc, &argv, "--txn-sched",               NULL, "waves"   );
+  int          accounts_hash_cache     = fd_env_strip_cmdline_int   ( &argc, &argv, "--accounts-hash-cache",     NULL, 0         );
 
   if( FD_UNLIKELY( !verify_acc_hash ) ) {
     /* We've got full snapshots that contain all 0s for the account
@@ -1745,6 +1802,10 @@ initial_setup( int argc, char ** argv, fd_ledger_args_t * args ) {
   args->txns_max                = txns_max;
   args->index_max               = index_max;
   args->funk_page_cnt           = funk_page_cnt;
+  args->funk_cold_file          = funk_cold_file;
+  args->funk_cold_sz            = funk_cold_sz;
+  args->funk_cold_age           = funk_cold_age;
+  if( FD_UNLIKELY( funk_cold_file && !funk_cold_age ) ) FD_LOG_ERR(( "--funk-cold-age must be positive" ));
   args->funk_file               = funk_file;
   args->restore                 = restore;
   args->restore_funk            = restore_funk;
@@ -1758,6 +1819,7 @@ initial_setup( int argc, char ** argv, fd_ledger_args_t * args ) {
   args->verify_funk             = verify_funk;
   args->check_acc_hash          = check_acc_hash;
   args->verify_acc_hash         = verify_acc_hash;
+  args->snapshot_par_restore    = snapshot_par_restore;
   args->trash_hash              = trash_hash;
   args->index_max_pruned        = index_max_pruned;
   args->pages_pruned            = pages_pruned;
@@ -1765,6 +1827,7 @@ initial_setup( int argc, char ** argv, fd_ledger_args_t * args ) {
   args->capture_txns            = capture_txns;
   args->checkpt_path            = checkpt_path;
   args->checkpt_freq            = checkpt_freq;
+  args->checkpt_archive         = checkpt_archive;
   args->checkpt_mismatch        = checkpt_mismatch;
   args->allocator               = allocator;
   args->abort_on_mismatch       = abort_on_mismatch;
@@ -1784,6 +1847,15 @@ initial_setup( int argc, char ** argv, fd_ledger_args_t * args ) {
   args->allowed_mem_delta       = allowed_mem_delta;
   args->lthash                  = lthash;
   args->snapshot_mismatch       = snapshot_mismatch;
+  args->accounts_hash_cache     = accounts_hash_cache;
+
+  if( !strcmp( txn_sched, "dag" ) ) {
+    args->txn_sched = FD_RUNTIME_TXN_SCHED_DAG;
+  } else if( !strcmp( txn_sched, "waves" ) ) {
+    args->txn_sched = FD_RUNTIME_TXN_SCHED_WAVES;
+  } else {
+    FD_LOG_ERR(( "unknown --txn-sched %s (expected dag or waves)", txn_sched ));
+  }
   parse_one_off_features( args, one_off_features );
   parse_rocksdb_list( args, rocksdb_list, rocksdb_list_starts );
 
@@ -107,7 +107,7 @@ init_args_offline( int * argc, char *** argv, fd_rpcserver_args_t * args ) {
     FD_LOG_ERR(( "--funk-file argument is required" ));
   char const * restore = fd_env_strip_cmdline_cstr ( argc, argv, "--restore-funk", NULL, NULL );
   if( restore != NULL )
-    args->funk = fd_funk_recover_checkpoint( funk_file, 1, restore, NULL );
+    args->funk = fd_funk_recover_checkpoint( funk_file, 1, restore, NULL, 0UL, 1UL, NULL );
   else
     args->funk = fd_funk_open_file( funk_file, 1, 0, 0, 0, 0, FD_FUNK_READONLY, NULL );
 
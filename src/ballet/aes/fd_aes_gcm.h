@@ -78,6 +78,7 @@ typedef struct fd_aes_gcm_avx10_state fd_aes_gcm_avx10_t;
 
   typedef fd_aes_gcm_ref_t    fd_aes_gcm_t;
   #define fd_aes_128_gcm_init fd_aes_128_gcm_init_ref
+  #define fd_aes_gcm_set_iv   fd_aes_gcm_set_iv_ref
   #define fd_aes_gcm_encrypt  fd_aes_gcm_encrypt_ref
   #define fd_aes_gcm_decrypt  fd_aes_gcm_decrypt_ref
 
@@ -85,6 +86,7 @@ typedef struct fd_aes_gcm_avx10_state fd_aes_gcm_avx10_t;
 
   typedef fd_aes_gcm_aesni_t  fd_aes_gcm_t;
   #define fd_aes_128_gcm_init fd_aes_128_gcm_init_aesni
+  #define fd_aes_gcm_set_iv   fd_aes_gcm_set_iv_aesni
   #define fd_aes_gcm_encrypt  fd_aes_gcm_encrypt_aesni
   #define fd_aes_gcm_decrypt  fd_aes_gcm_decrypt_aesni
 
@@ -92,6 +94,7 @@ typedef struct fd_aes_gcm_avx10_state fd_aes_gcm_avx10_t;
 
   typedef fd_aes_gcm_aesni_t  fd_aes_gcm_t;
   #define fd_aes_128_gcm_init fd_aes_128_gcm_init_avx2
+  #define fd_aes_gcm_set_iv   fd_aes_gcm_set_iv_aesni
   #define fd_aes_gcm_encrypt  fd_aes_gcm_encrypt_avx2
   #define fd_aes_gcm_decrypt  fd_aes_gcm_decrypt_avx2
 
@@ -99,6 +102,7 @@ typedef struct fd_aes_gcm_avx10_state fd_aes_gcm_avx10_t;
 
   typedef fd_aes_gcm_avx10_t  fd_aes_gcm_t;
   #define fd_aes_128_gcm_init fd_aes_128_gcm_init_avx10_512
+  #define fd_aes_gcm_set_iv   fd_aes_gcm_set_iv_avx10
   #define fd_aes_gcm_encrypt  fd_aes_gcm_encrypt_avx10_512
   #define fd_aes_gcm_decrypt  fd_aes_gcm_decrypt_avx10_512
 
@@ -125,6 +129,16 @@ fd_aes_128_gcm_init( fd_aes_gcm_t * aes_gcm,
                      uchar const    key[ 16 ],
                      uchar const    iv [ 12 ] );
 
+/* fd_aes_gcm_set_iv replaces the initialization vector of an
+   fd_aes_gcm_t previously initialized with fd_aes_128_gcm_init.  The
+   expanded key and the GHASH key powers are kept.  This makes reusing
+   one fd_aes_gcm_t for many messages under the same key (each with
+   its own IV) much cheaper than reinitializing it for every message. */
+
+void
+fd_aes_gcm_set_iv( fd_aes_gcm_t * aes_gcm,
+                   uchar const    iv[ 12 ] );
+
 /* fd_aes_gcm_aead_{encrypt,decrypt} implements the AES-GCM AEAD cipher
    c points to the ciphertext buffer.  p points to the plaintext buffer.
    sz is the length of the p and c buffers.  p,c,sz do not have align-
@@ -55,6 +55,12 @@ fd_aes_128_gcm_init_ref( fd_aes_gcm_ref_t * gcm,
   fd_aes_gcm_setiv( gcm, iv );
 }
 
+void
+fd_aes_gcm_set_iv_ref( fd_aes_gcm_ref_t * gcm,
+                       uchar const        iv[ 12 ] ) {
+  fd_aes_gcm_setiv( gcm, iv );
+}
+
 static int
 fd_gcm128_aad( fd_aes_gcm_ref_t * aes_gcm,
                uchar const *      aad,
@@ -119,6 +119,12 @@ fd_aes_128_gcm_init_aesni( fd_aes_gcm_aesni_t * aes_gcm,
   memcpy( aes_gcm->iv, iv, 12 );
 }
 
+void
+fd_aes_gcm_set_iv_aesni( fd_aes_gcm_aesni_t * aes_gcm,
+                         uchar const          iv [ 12 ] ) {
+  memcpy( aes_gcm->iv, iv, 12 );
+}
+
 static void
 load_le_ctr( uint        le_ctr[4],
              uchar const iv[12] ) {
@@ -307,6 +313,12 @@ fd_aes_128_gcm_init_avx10_512( fd_aes_gcm_avx10_t * aes_gcm,
   memcpy( aes_gcm->iv, iv, 12 );
 }
 
+void
+fd_aes_gcm_set_iv_avx10( fd_aes_gcm_avx10_t * aes_gcm,
+                         uchar const          iv [ 12 ] ) {
+  memcpy( aes_gcm->iv, iv, 12 );
+}
+
 void
 fd_aes_gcm_encrypt_avx10_512( fd_aes_gcm_avx10_t * aes_gcm,
                               uchar *              c,
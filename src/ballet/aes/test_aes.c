@@ -419,6 +419,20 @@ test_aes_128_gcm( void ) {
 
   FD_LOG_INFO(( "OK: AES-128-GCM decrypt (AES-NI)" ));
 
+  /* Test reuse of an initialized state with a new IV */
+
+  uchar const zero_iv[ 12 ] = {0};
+  fd_aes_128_gcm_init( gcm, key, zero_iv );
+  fd_aes_gcm_set_iv( gcm, iv );
+  fd_aes_gcm_encrypt( gcm, actual_ciphertext, plaintext, sizeof(plaintext), aad, sizeof(aad), actual_tag );
+  FD_TEST( 0==memcmp( actual_ciphertext, ciphertext, sizeof( ciphertext ) ) );
+  FD_TEST( 0==memcmp( actual_tag,        tag,        sizeof( tag        ) ) );
+  fd_aes_gcm_set_iv( gcm, iv );
+  FD_TEST( fd_aes_gcm_decrypt( gcm, actual_ciphertext, actual_plaintext, sizeof(ciphertext), aad, sizeof(aad), tag ) );
+  FD_TEST( 0==memcmp( actual_plaintext, plaintext, sizeof( plaintext ) ) );
+  fd_aes_gcm_set_iv( gcm, zero_iv );
+  FD_TEST( !fd_aes_gcm_decrypt( gcm, actual_ciphertext, actual_plaintext, sizeof(ciphertext), aad, sizeof(aad), tag ) );
+
   /* Test AEAD malleability */
 
 # define BITFLIP( x, i ) ( (x)[ (i)>>3 ] = (uchar)( (x)[ (i)>>3 ] ^ 1UL<<((i)&7UL) ) )
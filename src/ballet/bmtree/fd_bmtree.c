@@ -318,6 +318,83 @@ fd_bmtree_commit_fini( fd_bmtree_commit_t * state ) {
   return root->hash;
 }
 
+/* FD_BMTREE_PRIVATE_MSG_MAX is the size of the largest branch node
+   preimage (prefix followed by two hashes). */
+
+#define FD_BMTREE_PRIVATE_MSG_MAX (FD_BMTREE_LONG_PREFIX_SZ+64UL)
+
+/* fd_bmtree_private_merge_msg writes the preimage of the branch node
+   with children a and b to msg and returns its size. */
+
+static inline ulong
+fd_bmtree_private_merge_msg( uchar *       msg,
+                             uchar const * a,
+                             uchar const * b,
+                             ulong         hash_sz,
+                             ulong         prefix_sz ) {
+  fd_memcpy( msg,                   fd_bmtree_node_prefix, prefix_sz );
+  fd_memcpy( msg+prefix_sz,         a,                     hash_sz   );
+  fd_memcpy( msg+prefix_sz+hash_sz, b,                     hash_sz   );
+  return prefix_sz+2UL*hash_sz;
+}
+
+uchar *
+fd_bmtree_commit_layered( fd_bmtree_commit_t *                 state,
+                          fd_bmtree_node_t const * FD_RESTRICT leaf,
+                          ulong                                leaf_cnt ) {
+  ulong depth = fd_bmtree_depth( leaf_cnt );
+
+  /* A tree with depth layers uses inclusion proof indices
+     [0,2^depth-1) */
+  if( FD_UNLIKELY( fd_ulong_mask_lsb( (int)depth )>state->inclusion_proof_sz ) ) {
+    fd_bmtree_commit_append( state, leaf, leaf_cnt );
+    return fd_bmtree_commit_fini( state );
+  }
+
+  ulong              hash_sz   = state->hash_sz;
+  ulong              prefix_sz = state->prefix_sz;
+  fd_bmtree_node_t * node      = state->inclusion_proofs;
+
+  /* The i^th node of layer l lives at inclusion proof index
+     (i<<(l+1)) + (1<<l) - 1 (see above), so the layers are interleaved
+     and computing one never clobbers another. */
+
+  for( ulong i=0UL; i<leaf_cnt; i++ ) node[ 2UL*i ] = leaf[ i ];
+
+  fd_sha256_batch_t _batch[1];
+  uchar msg[ FD_SHA256_BATCH_MAX ][ FD_BMTREE_PRIVATE_MSG_MAX ] __attribute__((aligned(32)));
+
+  ulong layer_cnt = leaf_cnt;
+  for( ulong layer=0UL; layer_cnt>1UL; layer++ ) {
+    ulong parent_cnt = (layer_cnt+1UL)>>1;
+
+    /* Messages must stay valid until the batch is done, so hash the
+       layer in chunks of FD_SHA256_BATCH_MAX. */
+
+    for( ulong p0=0UL; p0<parent_cnt; p0+=FD_SHA256_BATCH_MAX ) {
+      ulong p1 = fd_ulong_min( p0+FD_SHA256_BATCH_MAX, parent_cnt );
+      fd_sha256_batch_t * sha = fd_sha256_batch_init( _batch );
+      for( ulong p=p0; p<p1; p++ ) {
+        ulong l = 2UL*p;
+        ulong r = fd_ulong_min( l+1UL, layer_cnt-1UL ); /* 1 child => duplicate link */
+        ulong l_idx = (l<<(layer+1UL)) + (1UL<<layer) - 1UL;
+        ulong r_idx = (r<<(layer+1UL)) + (1UL<<layer) - 1UL;
+        ulong p_idx = (p<<(layer+2UL)) + (2UL<<layer) - 1UL;
+        ulong sz    = fd_bmtree_private_merge_msg( msg[ p-p0 ], node[ l_idx ].hash, node[ r_idx ].hash, hash_sz, prefix_sz );
+        fd_sha256_batch_add( sha, msg[ p-p0 ], sz, node[ p_idx ].hash );
+      }
+      fd_sha256_batch_fini( sha );
+    }
+
+    layer_cnt = parent_cnt;
+  }
+
+  fd_bmtree_node_t * root = state->node_buf + (depth-1UL);
+  *root = node[ (1UL<<(depth-1UL))-1UL ];
+  state->leaf_cnt = leaf_cnt;
+  return root->hash;
+}
+
 int
 fd_bmtree_get_proof( fd_bmtree_commit_t * state,
                      uchar *              dest,
@@ -361,6 +361,25 @@ fd_bmtree_commit_append( fd_bmtree_commit_t *                 state,         /*
    initialized for a new calc. */
 uchar * fd_bmtree_commit_fini( fd_bmtree_commit_t * state );
 
+/* fd_bmtree_commit_layered is a faster equivalent of appending leaf_cnt
+   leaves with fd_bmtree_commit_append and then calling
+   fd_bmtree_commit_fini.  Rather than walking up the tree once per
+   leaf, it derives the tree one layer at a time and hashes the branch
+   nodes of each layer with the SHA-256 batch API (AVX / AVX-512 when
+   available).  Assumes state is valid and freshly initialized for a
+   leaf-based calc (i.e. no leaves appended yet) and leaf_cnt>0.
+
+   If the tree fits in the inclusion proof storage (i.e.
+   fd_bmtree_depth( leaf_cnt ) <= inclusion_proof_layer_cnt used in
+   init), nodes are computed in place in the inclusion proof storage
+   and fd_bmtree_get_proof can be used afterward as usual.  Otherwise,
+   this falls back to fd_bmtree_commit_append + fd_bmtree_commit_fini.
+   Return value and state on return are as in fd_bmtree_commit_fini. */
+uchar *
+fd_bmtree_commit_layered( fd_bmtree_commit_t *                 state,
+                          fd_bmtree_node_t const * FD_RESTRICT leaf,     /* Indexed [0,leaf_cnt) */
+                          ulong                                leaf_cnt );
+
 
 /* bmtree_get_proof writes an inclusion proof for the leaf
    with index leaf_idx to the memory at dest.  state must be a valid
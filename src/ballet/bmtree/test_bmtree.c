@@ -129,6 +129,50 @@ test_inclusion( ulong leaf_cnt ) {
 
 }
 
+/* Test that the layer-batched commit agrees with its sequential
+   counterpart */
+static void
+test_layered( ulong leaf_cnt ) {
+  ulong const prefix_sz = FD_BMTREE_LONG_PREFIX_SZ;
+  FD_TEST( 9 >= fd_bmtree_depth( leaf_cnt ) );
+  ulong footprint = fd_bmtree_commit_footprint( 9UL );
+  fd_bmtree_commit_t * tree  = fd_bmtree_commit_init( memory, 20UL, prefix_sz, 9UL );
+  uchar * _memory = (uchar*)fd_ulong_align_up( (ulong)(memory+footprint), FD_BMTREE_COMMIT_ALIGN );
+  fd_bmtree_commit_t * ltree = fd_bmtree_commit_init( _memory, 20UL, prefix_sz, 9UL );
+
+  static fd_bmtree_node_t leaf[ 256 ];
+  for( ulong i=0UL; i<leaf_cnt; i++ ) {
+    fd_memset( leaf[ i ].hash, 0, 32UL );
+    FD_STORE( ulong, leaf[ i ].hash, i );
+  }
+
+  uchar * root  = fd_bmtree_commit_fini( fd_bmtree_commit_append( tree, leaf, leaf_cnt ) );
+  uchar * lroot = fd_bmtree_commit_layered( ltree, leaf, leaf_cnt );
+  FD_TEST( fd_bmtree_commit_leaf_cnt( ltree )==leaf_cnt );
+  FD_TEST( fd_memeq( root, lroot, 20UL ) );
+
+  /* Proofs from the layered tree match the sequential ones and derive
+     the same root */
+
+  ulong depth = fd_bmtree_depth( leaf_cnt );
+  static uchar lproof[ 8*20 ];
+  for( ulong i=0UL; i<leaf_cnt; i++ ) {
+    FD_TEST( (int)depth-1==fd_bmtree_get_proof( tree, inc_proof, i ) );
+    FD_TEST( (int)depth-1==fd_bmtree_get_proof( ltree, lproof, i ) );
+    FD_TEST( fd_memeq( inc_proof, lproof, 20UL*(depth-1UL) ) );
+    fd_bmtree_node_t proof_root[1];
+    FD_TEST( fd_bmtree_from_proof( leaf+i, i, proof_root, lproof, depth-1UL, 20UL, prefix_sz ) );
+    FD_TEST( fd_memeq( root, proof_root->hash, 20UL ) );
+  }
+
+  /* Trees that don't fit in the inclusion proof storage fall back to
+     the sequential path */
+
+  fd_bmtree_commit_t _tree[1];
+  fd_bmtree_commit_t * stree = fd_bmtree_commit_init( _tree, 20UL, prefix_sz, 0UL );
+  FD_TEST( fd_memeq( root, fd_bmtree_commit_layered( stree, leaf, leaf_cnt ), 20UL ) );
+}
+
 
 
 int
@@ -149,6 +193,7 @@ main( int     argc,
   FD_TEST( fd_bmtree_node_cnt( 1UL )==1UL );
 
   for( ulong leaf_cnt=1UL; leaf_cnt<=256UL; leaf_cnt++ ) test_inclusion( leaf_cnt );
+  for( ulong leaf_cnt=1UL; leaf_cnt<=256UL; leaf_cnt++ ) test_layered  ( leaf_cnt );
 
   for( ulong leaf_cnt=2UL; leaf_cnt<10000000UL; leaf_cnt++ ) {
     ulong depth = 1UL;
@@ -180,6 +225,24 @@ main( int     argc,
   dt += fd_log_wallclock();
   FD_LOG_NOTICE(( "%.3f ns/leaf @ %lu leaves", (double)((float)dt / (float)bench_cnt), bench_cnt ));
 
+  /* Compare with the layer-batched commit on a tree that fits in the
+     inclusion proof storage */
+  static fd_bmtree_node_t bench_leaf[ 1UL<<17 ];
+  ulong bench_leaf_cnt = 1UL<<17;
+  for( ulong i=0UL; i<bench_leaf_cnt; i++ ) { fd_memset( bench_leaf[ i ].hash, 0, 32UL ); FD_STORE( ulong, bench_leaf[ i ].hash, i ); }
+  ulong bench_layer_cnt = fd_bmtree_depth( bench_leaf_cnt );
+  FD_TEST( fd_bmtree_commit_footprint( bench_layer_cnt ) < MEMORY_SZ );
+
+  dt = -fd_log_wallclock();
+  fd_bmtree_commit_fini( fd_bmtree_commit_append( fd_bmtree_commit_init( memory, 20UL, 1UL, bench_layer_cnt ), bench_leaf, bench_leaf_cnt ) );
+  dt += fd_log_wallclock();
+  FD_LOG_NOTICE(( "append:  %.3f ns/leaf @ %lu leaves", (double)((float)dt / (float)bench_leaf_cnt), bench_leaf_cnt ));
+
+  dt = -fd_log_wallclock();
+  fd_bmtree_commit_layered( fd_bmtree_commit_init( memory, 20UL, 1UL, bench_layer_cnt ), bench_leaf, bench_leaf_cnt );
+  dt += fd_log_wallclock();
+  FD_LOG_NOTICE(( "layered: %.3f ns/leaf @ %lu leaves", (double)((float)dt / (float)bench_leaf_cnt), bench_leaf_cnt ));
+
   /* Test 32-byte tree */
 
   // Source: https://github.com/solana-foundation/specs/blob/main/core/merkle-tree.md
@@ -119,3 +119,86 @@ fd_chacha20rng_refill_avx( fd_chacha20rng_t * rng ) {
 
   rng->buf_fill += 8*FD_CHACHA20_BLOCK_SZ;
 }
+
+void
+fd_chacha20rng_block0_x8_avx( void *       _blocks,
+                              void const * _keys ) {
+
+  uchar const * keys = (uchar const *)_keys;
+
+  wu_t iv0  = wu_bcast( 0x61707865U );
+  wu_t iv1  = wu_bcast( 0x3320646eU );
+  wu_t iv2  = wu_bcast( 0x79622d32U );
+  wu_t iv3  = wu_bcast( 0x6b206574U );
+  wu_t zero = wu_zero();
+
+  /* Unpack keys such that lane i of kj holds word j of key i.  This is
+     the transpose of the 8 keys stacked as rows. */
+
+  wu_t k0 = wu_ldu( keys+0x00 ); wu_t k1 = wu_ldu( keys+0x20 );
+  wu_t k2 = wu_ldu( keys+0x40 ); wu_t k3 = wu_ldu( keys+0x60 );
+  wu_t k4 = wu_ldu( keys+0x80 ); wu_t k5 = wu_ldu( keys+0xa0 );
+  wu_t k6 = wu_ldu( keys+0xc0 ); wu_t k7 = wu_ldu( keys+0xe0 );
+  wu_transpose_8x8( k0, k1, k2, k3, k4, k5, k6, k7,
+                    k0, k1, k2, k3, k4, k5, k6, k7 );
+
+  /* Run through the round function.  Every lane computes block index 0
+     with a zero nonce. */
+
+  wu_t c0 = iv0;   wu_t c1 = iv1;   wu_t c2 = iv2;   wu_t c3 = iv3;
+  wu_t c4 = k0;    wu_t c5 = k1;    wu_t c6 = k2;    wu_t c7 = k3;
+  wu_t c8 = k4;    wu_t c9 = k5;    wu_t cA = k6;    wu_t cB = k7;
+  wu_t cC = zero;  wu_t cD = zero;  wu_t cE = zero;  wu_t cF = zero;
+
+# define QUARTER_ROUND(a,b,c,d)                                        \
+  do {                                                                 \
+    a = wu_add( a, b ); d = wu_xor( d, a ); d = wu_rol16( d );         \
+    c = wu_add( c, d ); b = wu_xor( b, c ); b = wu_rol12( b );         \
+    a = wu_add( a, b ); d = wu_xor( d, a ); d = wu_rol8( d );          \
+    c = wu_add( c, d ); b = wu_xor( b, c ); b = wu_rol7( b );          \
+  } while(0)
+
+  for( ulong i=0UL; i<10UL; i++ ) {
+    QUARTER_ROUND( c0, c4, c8, cC );
+    QUARTER_ROUND( c1, c5, c9, cD );
+    QUARTER_ROUND( c2, c6, cA, cE );
+    QUARTER_ROUND( c3, c7, cB, cF );
+    QUARTER_ROUND( c0, c5, cA, cF );
+    QUARTER_ROUND( c1, c6, cB, cC );
+    QUARTER_ROUND( c2, c7, c8, cD );
+    QUARTER_ROUND( c3, c4, c9, cE );
+  }
+# undef QUARTER_ROUND
+
+  /* Finalize (the counter and nonce words are zero) */
+
+  c0 = wu_add( c0, iv0 );
+  c1 = wu_add( c1, iv1 );
+  c2 = wu_add( c2, iv2 );
+  c3 = wu_add( c3, iv3 );
+  c4 = wu_add( c4, k0  );
+  c5 = wu_add( c5, k1  );
+  c6 = wu_add( c6, k2  );
+  c7 = wu_add( c7, k3  );
+  c8 = wu_add( c8, k4  );
+  c9 = wu_add( c9, k5  );
+  cA = wu_add( cA, k6  );
+  cB = wu_add( cB, k7  );
+
+  /* Transpose matrix to get one output block per key */
+
+  wu_transpose_8x8( c0, c1, c2, c3, c4, c5, c6, c7,
+                    c0, c1, c2, c3, c4, c5, c6, c7 );
+  wu_transpose_8x8( c8, c9, cA, cB, cC, cD, cE, cF,
+                    c8, c9, cA, cB, cC, cD, cE, cF );
+
+  uint * out = (uint *)_blocks;
+  wu_st( out+0x00, c0 ); wu_st( out+0x08, c8 );
+  wu_st( out+0x10, c1 ); wu_st( out+0x18, c9 );
+  wu_st( out+0x20, c2 ); wu_st( out+0x28, cA );
+  wu_st( out+0x30, c3 ); wu_st( out+0x38, cB );
+  wu_st( out+0x40, c4 ); wu_st( out+0x48, cC );
+  wu_st( out+0x50, c5 ); wu_st( out+0x58, cD );
+  wu_st( out+0x60, c6 ); wu_st( out+0x68, cE );
+  wu_st( out+0x70, c7 ); wu_st( out+0x78, cF );
+}
@@ -68,6 +68,60 @@ fd_chacha20rng_init( fd_chacha20rng_t * rng,
   return rng;
 }
 
+void
+fd_chacha20rng_ulong_roll_batch( fd_chacha20rng_t * rng,
+                                 void const *       _keys,
+                                 ulong              cnt,
+                                 ulong              n,
+                                 ulong *            out ) {
+  uchar const * keys = (uchar const *)_keys;
+
+  /* Same zone as fd_chacha20rng_ulong_roll */
+  ulong const zone = fd_ulong_if( rng->mode==FD_CHACHA20RNG_MODE_MOD,
+                                  ULONG_MAX - (ULONG_MAX-n+1UL)%n,
+                                  (n << (63 - fd_ulong_find_msb( n ) )) - 1UL );
+
+  ulong blocks[ 8UL*FD_CHACHA20_BLOCK_SZ/sizeof(ulong) ] __attribute__((aligned(FD_CHACHA20_BLOCK_SZ)));
+
+  for( ulong i0=0UL; i0<cnt; i0+=8UL ) {
+    ulong lane_cnt = fd_ulong_min( cnt-i0, 8UL );
+
+#   if FD_HAS_AVX
+    if( FD_LIKELY( lane_cnt==8UL ) ) {
+      fd_chacha20rng_block0_x8_avx( blocks, keys+FD_CHACHA20_KEY_SZ*i0 );
+    } else
+#   endif
+    {
+      uint idx_nonce[4] __attribute__((aligned(16))) = { 0U, 0U, 0U, 0U };
+      for( ulong j=0UL; j<lane_cnt; j++ ) {
+        uchar key[ FD_CHACHA20_KEY_SZ ] __attribute__((aligned(32)));
+        memcpy( key, keys+FD_CHACHA20_KEY_SZ*(i0+j), FD_CHACHA20_KEY_SZ );
+        fd_chacha20_block( blocks+j*(FD_CHACHA20_BLOCK_SZ/sizeof(ulong)), key, idx_nonce );
+      }
+    }
+
+    for( ulong j=0UL; j<lane_cnt; j++ ) {
+      ulong const * v = blocks+j*(FD_CHACHA20_BLOCK_SZ/sizeof(ulong));
+      ulong k=0UL;
+      for( ; k<FD_CHACHA20_BLOCK_SZ/sizeof(ulong); k++ ) {
+#       if FD_HAS_INT128
+        uint128 res = (uint128)v[k] * (uint128)n;
+        ulong   hi  = (ulong)(res>>64);
+        ulong   lo  = (ulong) res;
+#       else
+        ulong hi, lo;
+        fd_uwide_mul( &hi, &lo, v[k], n );
+#       endif
+        if( FD_LIKELY( lo<=zone ) ) { out[ i0+j ] = hi; break; }
+      }
+      if( FD_UNLIKELY( k==FD_CHACHA20_BLOCK_SZ/sizeof(ulong) ) ) {
+        fd_chacha20rng_init( rng, keys+FD_CHACHA20_KEY_SZ*(i0+j) );
+        out[ i0+j ] = fd_chacha20rng_ulong_roll( rng, n );
+      }
+    }
+  }
+}
+
 #if FD_HAS_AVX
 
 void
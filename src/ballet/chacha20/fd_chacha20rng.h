@@ -130,6 +130,16 @@ fd_chacha20rng_refill_seq( fd_chacha20rng_t * rng );
 #define fd_chacha20rng_private_refill fd_chacha20rng_refill_seq
 #endif
 
+/* fd_chacha20rng_block0_x8_avx computes the first block of the RNG
+   stream of 8 different keys at once (one key per SIMD lane).  keys
+   points to 8 consecutive 32 byte keys (no alignment requirement).
+   Block i is stored at blocks+64*i (32 byte aligned).  Not part of the
+   public API. */
+
+void
+fd_chacha20rng_block0_x8_avx( void *       blocks,
+                              void const * keys );
+
 /* fd_chacha20rng_avail returns the number of buffered bytes. */
 
 FD_FN_PURE static inline ulong
@@ -225,6 +235,29 @@ fd_chacha20rng_ulong_roll( fd_chacha20rng_t * rng,
   }
 }
 
+/* fd_chacha20rng_ulong_roll_batch computes cnt independent rolls, each
+   from a freshly seeded stream.  Specifically, out[i] is set to the
+   value that
+
+     fd_chacha20rng_init( rng, keys+32*i );
+     fd_chacha20rng_ulong_roll( rng, n );
+
+   would return, for i in [0,cnt).  This is much faster than doing the
+   above in a loop because a roll almost always only consumes the first
+   block of the stream and, with AVX, the first blocks of 8 streams are
+   computed together.  Rolls that reject every value of the first block
+   fall back to the above.  rng provides the mode and is used as
+   scratch, so its stream state is unspecified on return (it must be
+   re-initialized before its next use).  keys points to cnt consecutive
+   32 byte keys.  n must be positive. */
+
+void
+fd_chacha20rng_ulong_roll_batch( fd_chacha20rng_t * rng,
+                                 void const *       keys,
+                                 ulong              cnt,
+                                 ulong              n,
+                                 ulong *            out );
+
 FD_PROTOTYPES_END
 
 #endif /* HEADER_fd_src_ballet_chacha20_fd_chacha20rng_h */
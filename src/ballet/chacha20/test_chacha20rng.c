@@ -80,6 +80,33 @@ main( int     argc,
   } while(0);
 # endif /* FD_HAS_AVX */
 
+  /* Test batched rolls against the scalar roll.  n close to 2^63
+     rejects about half of all values, which exercises the fallback for
+     rolls that reject the entire first block. */
+
+  do {
+    static uchar keys[ 37UL*32UL ];
+    ulong        out [ 37UL ];
+    ulong const  ns[ 5 ] = { 1UL, 3UL, 200000UL, (1UL<<63)+1UL, ULONG_MAX };
+    for( int mode=FD_CHACHA20RNG_MODE_MOD; mode<=FD_CHACHA20RNG_MODE_SHIFT; mode++ ) {
+      fd_chacha20rng_t _rng2[1];
+      fd_chacha20rng_t * rng2 = fd_chacha20rng_join( fd_chacha20rng_new( _rng2, mode ) );
+      for( ulong iter=0UL; iter<200UL; iter++ ) {
+        for( ulong i=0UL; i<sizeof(keys); i++ ) keys[ i ] = (uchar)fd_ulong_hash( iter*sizeof(keys)+i );
+        ulong cnt = iter % 38UL;
+        ulong n   = ns[ iter % 5UL ];
+        fd_chacha20rng_ulong_roll_batch( rng2, keys, cnt, n, out );
+        for( ulong i=0UL; i<cnt; i++ ) {
+          fd_chacha20rng_init( rng, keys+32UL*i );
+          rng->mode = mode;
+          FD_TEST( out[ i ]==fd_chacha20rng_ulong_roll( rng, n ) );
+        }
+      }
+      fd_chacha20rng_delete( fd_chacha20rng_leave( rng2 ) );
+    }
+    rng->mode = FD_CHACHA20RNG_MODE_MOD;
+  } while(0);
+
   /* Clean up */
 
   FD_TEST( (ulong)fd_chacha20rng_delete( fd_chacha20rng_leave( rng ) )==(ulong)_rng );
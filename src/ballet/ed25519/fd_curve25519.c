@@ -14,6 +14,7 @@
 
 #define WNAF_BIT_SZ 4
 #define WNAF_TBL_SZ (2*WNAF_BIT_SZ)
+FD_STATIC_ASSERT( WNAF_TBL_SZ==FD_ED25519_WNAF_TBL_SZ, wnaf_tbl_sz );
 
 /*
  * Ser/de
@@ -107,19 +108,11 @@ fd_ed25519_scalar_mul( fd_ed25519_point_t *       r,
 }
 
 fd_ed25519_point_t *
-fd_ed25519_double_scalar_mul_base( fd_ed25519_point_t *       r,
-                                   uchar const                n1[ 32 ],
-                                   fd_ed25519_point_t const * a,
-                                   uchar const                n2[ 32 ] ) {
-
-  short n1slide[256]; fd_curve25519_scalar_wnaf( n1slide, n1, WNAF_BIT_SZ );
-  short n2slide[256]; fd_curve25519_scalar_wnaf( n2slide, n2, 8 );
-
-  fd_ed25519_point_t ai[WNAF_TBL_SZ]; /* A,3A,5A,7A,9A,11A,13A,15A */
+fd_ed25519_wnaf_table( fd_ed25519_point_t         ai[ WNAF_TBL_SZ ], /* A,3A,5A,7A,9A,11A,13A,15A */
+                       fd_ed25519_point_t const * a ) {
   fd_ed25519_point_t a2[1];           /* 2A (temp) */
   fd_ed25519_point_t t[1];
 
-  /* pre-computed table */
   fd_ed25519_point_set( &ai[0], a );
   fd_ed25519_point_dbln( a2, a, 1 ); // note: a is affine, we could save 1mul
   fd_curve25519_into_precomputed( &ai[0] );
@@ -129,6 +122,19 @@ fd_ed25519_double_scalar_mul_base( fd_ed25519_point_t *       r,
     /* pre-compute kT, to save 1mul during the loop */
     fd_curve25519_into_precomputed( &ai[i] );
   }
+  return ai;
+}
+
+fd_ed25519_point_t *
+fd_ed25519_double_scalar_mul_base_table( fd_ed25519_point_t *       r,
+                                         uchar const                n1[ 32 ],
+                                         fd_ed25519_point_t const   ai[ WNAF_TBL_SZ ],
+                                         uchar const                n2[ 32 ] ) {
+
+  short n1slide[256]; fd_curve25519_scalar_wnaf( n1slide, n1, WNAF_BIT_SZ );
+  short n2slide[256]; fd_curve25519_scalar_wnaf( n2slide, n2, 8 );
+
+  fd_ed25519_point_t t[1];
 
   /* main dbl-and-add loop */
   fd_ed25519_point_set_zero( r );
@@ -152,6 +158,15 @@ fd_ed25519_double_scalar_mul_base( fd_ed25519_point_t *       r,
   return r;
 }
 
+fd_ed25519_point_t *
+fd_ed25519_double_scalar_mul_base( fd_ed25519_point_t *       r,
+                                   uchar const                n1[ 32 ],
+                                   fd_ed25519_point_t const * a,
+                                   uchar const                n2[ 32 ] ) {
+  fd_ed25519_point_t ai[WNAF_TBL_SZ]; /* A,3A,5A,7A,9A,11A,13A,15A */
+  return fd_ed25519_double_scalar_mul_base_table( r, n1, fd_ed25519_wnaf_table( ai, a ), n2 );
+}
+
 
 FD_25519_INLINE fd_ed25519_point_t *
 fd_ed25519_multi_scalar_mul_with_opts( fd_ed25519_point_t *     r,
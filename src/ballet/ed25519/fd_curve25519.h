@@ -160,6 +160,28 @@ fd_ed25519_double_scalar_mul_base( fd_ed25519_point_t *       r,
                                    fd_ed25519_point_t const * a,
                                    uchar const                n2[ 32 ] );
 
+/* FD_ED25519_WNAF_TBL_SZ is the number of points in the table of odd
+   multiples of a point used by fd_ed25519_double_scalar_mul_base. */
+#define FD_ED25519_WNAF_TBL_SZ (8)
+
+/* fd_ed25519_wnaf_table computes tbl = { a, 3a, 5a, ..., 15a } in the
+   precomputed form used by fd_ed25519_double_scalar_mul_base_table,
+   and returns tbl.  a is assumed to be affine (Z==1, as returned by
+   fd_ed25519_point_frombytes, possibly negated).  Cost: ~70mul. */
+fd_ed25519_point_t *
+fd_ed25519_wnaf_table( fd_ed25519_point_t         tbl[ FD_ED25519_WNAF_TBL_SZ ],
+                       fd_ed25519_point_t const * a );
+
+/* fd_ed25519_double_scalar_mul_base_table is fd_ed25519_double_scalar_mul_base
+   with the table of a computed beforehand by fd_ed25519_wnaf_table.
+   This allows amortizing the table across multiple calls with the same
+   point a (e.g. a frequently used public key). */
+fd_ed25519_point_t *
+fd_ed25519_double_scalar_mul_base_table( fd_ed25519_point_t *       r,
+                                         uchar const                n1[ 32 ],
+                                         fd_ed25519_point_t const   tbl[ FD_ED25519_WNAF_TBL_SZ ],
+                                         uchar const                n2[ 32 ] );
+
 /* fd_ed25519_multi_scalar_mul computes r = n0 * a0 + n1 * a1 + ..., and returns r.
    n is a vector of sz scalars. a is a vector of sz points. */
 fd_ed25519_point_t *
@@ -19,6 +19,12 @@
 /* An Ed25519 signature. */
 typedef uchar fd_ed25519_sig_t[ FD_ED25519_SIG_SZ ];
 
+/* fd_ed25519_pubkey_cache_t is an opaque handle of a cache of
+   decompressed public keys (see fd_ed25519_pubkey_cache.h). */
+
+struct fd_ed25519_pubkey_cache;
+typedef struct fd_ed25519_pubkey_cache fd_ed25519_pubkey_cache_t;
+
 FD_PROTOTYPES_BEGIN
 
 /* fd_ed25519_public_from_private computes the public_key corresponding
@@ -129,6 +135,53 @@ fd_ed25519_verify_batch_single_msg( uchar const   msg[], /* msg_sz */
                                     fd_sha512_t * shas[ 1 ],               /* batch_sz */
                                     uchar const   batch_sz );
 
+/* FD_ED25519_VERIFY_BATCH_MAX is the max number of signatures that can
+   be verified by a single fd_ed25519_verify_batch_multi_msg call. */
+
+#define FD_ED25519_VERIFY_BATCH_MAX (16UL)
+
+/* fd_ed25519_verify_batch_multi_msg verifies a batch of independent
+   signatures, each over its own message and with its own public key,
+   according to the ED25519 standard.  This is meant for verifying the
+   signatures of many unrelated transactions at once (where most have a
+   single signature and fd_ed25519_verify_batch_single_msg would run
+   with a batch size of 1).
+
+   For j in [0,batch_cnt), msg[j] points to the msg_sz[j] byte message
+   signed by the 64-byte signature sig[j] for the 32-byte public key
+   public_key[j].  batch_cnt is in [0,FD_ED25519_VERIFY_BATCH_MAX].
+
+   The SHA-512 of each R || A || M is computed lane parallel with
+   fd_sha512_batch.  This requires the preimages to be contiguous, so
+   they are copied into scratch, which has room for scratch_sz bytes.
+   Preimages that do not fit at all in scratch (64+msg_sz[j] bytes) are
+   hashed with sha instead.  A scratch_sz of
+   FD_ED25519_VERIFY_BATCH_MAX*(64+max msg_sz) hashes the whole batch
+   in as few passes as possible.
+
+   If opt_cache is not NULL, public keys are looked up in opt_cache
+   before being decompressed and the ones that were not found are
+   inserted.  The results are the same with or without a cache.
+
+   On return, err[j] holds FD_ED25519_SUCCESS if signature j verified
+   and a FD_ED25519_ERR_* code otherwise (the same code
+   fd_ed25519_verify would return).  Returns FD_ED25519_SUCCESS if all
+   signatures verified and the first failure code otherwise.  If
+   batch_cnt is too large, returns FD_ED25519_ERR_SIG without verifying
+   anything (err is not touched). */
+
+int
+fd_ed25519_verify_batch_multi_msg( uchar const * const msg       [], /* batch_cnt */
+                                   ulong const         msg_sz    [], /* batch_cnt */
+                                   uchar const * const sig       [], /* batch_cnt, 64 bytes each */
+                                   uchar const * const public_key[], /* batch_cnt, 32 bytes each */
+                                   ulong               batch_cnt,
+                                   uchar *             scratch,
+                                   ulong               scratch_sz,
+                                   fd_sha512_t *       sha,
+                                   fd_ed25519_pubkey_cache_t * opt_cache,
+                                   int                 err       [] ); /* batch_cnt */
+
 /* fd_ed25519_strerror converts an FD_ED25519_SUCCESS / FD_ED25519_ERR_*
    code into a human readable cstr.  The lifetime of the returned
    pointer is infinite.  The returned pointer is always to a non-NULL
@@ -0,0 +1,202 @@
+#include "fd_ed25519_pubkey_cache.h"
+
+FD_FN_CONST ulong
+fd_ed25519_pubkey_cache_align( void ) {
+  return FD_ED25519_PUBKEY_CACHE_ALIGN;
+}
+
+FD_FN_CONST ulong
+fd_ed25519_pubkey_cache_footprint( ulong entry_cnt,
+                                   ulong hot_cnt ) {
+  if( FD_UNLIKELY( !fd_ulong_is_pow2( entry_cnt )             ) ) return 0UL;
+  if( FD_UNLIKELY( hot_cnt && !fd_ulong_is_pow2( hot_cnt )    ) ) return 0UL;
+  if( FD_UNLIKELY( entry_cnt>(1UL<<32) || hot_cnt>(1UL<<32)   ) ) return 0UL;
+  ulong l = FD_LAYOUT_INIT;
+  l = FD_LAYOUT_APPEND( l, FD_ED25519_PUBKEY_CACHE_ALIGN,          sizeof(fd_ed25519_pubkey_cache_t)                 );
+  l = FD_LAYOUT_APPEND( l, alignof(fd_ed25519_pubkey_cache_entry_t), entry_cnt*sizeof(fd_ed25519_pubkey_cache_entry_t) );
+  l = FD_LAYOUT_APPEND( l, alignof(fd_ed25519_pubkey_cache_hot_t),   hot_cnt  *sizeof(fd_ed25519_pubkey_cache_hot_t)   );
+  return FD_LAYOUT_FINI( l, FD_ED25519_PUBKEY_CACHE_ALIGN );
+}
+
+void *
+fd_ed25519_pubkey_cache_new( void * shmem,
+                             ulong  entry_cnt,
+                             ulong  hot_cnt,
+                             ulong  seed ) {
+
+  if( FD_UNLIKELY( !shmem ) ) {
+    FD_LOG_WARNING(( "NULL shmem" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)shmem, fd_ed25519_pubkey_cache_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned shmem" ));
+    return NULL;
+  }
+
+  ulong footprint = fd_ed25519_pubkey_cache_footprint( entry_cnt, hot_cnt );
+  if( FD_UNLIKELY( !footprint ) ) {
+    FD_LOG_WARNING(( "bad entry_cnt (%lu) or hot_cnt (%lu)", entry_cnt, hot_cnt ));
+    return NULL;
+  }
+
+  fd_memset( shmem, 0, footprint );
+
+  FD_SCRATCH_ALLOC_INIT( l, shmem );
+  fd_ed25519_pubkey_cache_t * cache = FD_SCRATCH_ALLOC_APPEND( l, FD_ED25519_PUBKEY_CACHE_ALIGN,            sizeof(fd_ed25519_pubkey_cache_t)                 );
+  void *                      entry = FD_SCRATCH_ALLOC_APPEND( l, alignof(fd_ed25519_pubkey_cache_entry_t), entry_cnt*sizeof(fd_ed25519_pubkey_cache_entry_t) );
+  void *                      hot   = FD_SCRATCH_ALLOC_APPEND( l, alignof(fd_ed25519_pubkey_cache_hot_t),   hot_cnt  *sizeof(fd_ed25519_pubkey_cache_hot_t)   );
+  FD_SCRATCH_ALLOC_FINI( l, FD_ED25519_PUBKEY_CACHE_ALIGN );
+
+  cache->entry_cnt = entry_cnt;
+  cache->hot_cnt   = hot_cnt;
+  cache->seed      = seed;
+  cache->entry_off = (ulong)entry - (ulong)shmem;
+  cache->hot_off   = (ulong)hot   - (ulong)shmem;
+
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( cache->magic ) = FD_ED25519_PUBKEY_CACHE_MAGIC;
+  FD_COMPILER_MFENCE();
+
+  return shmem;
+}
+
+fd_ed25519_pubkey_cache_t *
+fd_ed25519_pubkey_cache_join( void * shcache ) {
+
+  if( FD_UNLIKELY( !shcache ) ) {
+    FD_LOG_WARNING(( "NULL shcache" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)shcache, fd_ed25519_pubkey_cache_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned shcache" ));
+    return NULL;
+  }
+
+  fd_ed25519_pubkey_cache_t * cache = (fd_ed25519_pubkey_cache_t *)shcache;
+
+  if( FD_UNLIKELY( cache->magic!=FD_ED25519_PUBKEY_CACHE_MAGIC ) ) {
+    FD_LOG_WARNING(( "bad magic" ));
+    return NULL;
+  }
+
+  return cache;
+}
+
+void *
+fd_ed25519_pubkey_cache_leave( fd_ed25519_pubkey_cache_t * cache ) {
+
+  if( FD_UNLIKELY( !cache ) ) {
+    FD_LOG_WARNING(( "NULL cache" ));
+    return NULL;
+  }
+
+  return (void *)cache;
+}
+
+void *
+fd_ed25519_pubkey_cache_delete( void * shcache ) {
+
+  if( FD_UNLIKELY( !shcache ) ) {
+    FD_LOG_WARNING(( "NULL shcache" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)shcache, fd_ed25519_pubkey_cache_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned shcache" ));
+    return NULL;
+  }
+
+  fd_ed25519_pubkey_cache_t * cache = (fd_ed25519_pubkey_cache_t *)shcache;
+
+  if( FD_UNLIKELY( cache->magic!=FD_ED25519_PUBKEY_CACHE_MAGIC ) ) {
+    FD_LOG_WARNING(( "bad magic" ));
+    return NULL;
+  }
+
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( cache->magic ) = 0UL;
+  FD_COMPILER_MFENCE();
+
+  return shcache;
+}
+
+/* fd_ed25519_pubkey_cache_private_hash hashes pubkey.  Public keys are
+   attacker chosen, so all 32 bytes go through a seeded hash (hashing
+   only a prefix would let an attacker grind keys sharing a prefix into
+   the same slot).  The two levels use different halves of the hash. */
+
+static inline ulong
+fd_ed25519_pubkey_cache_private_hash( fd_ed25519_pubkey_cache_t const * cache,
+                                      uchar const                       pubkey[ 32 ] ) {
+  return fd_hash( cache->seed, pubkey, 32UL );
+}
+
+static inline fd_ed25519_pubkey_cache_entry_t *
+fd_ed25519_pubkey_cache_private_entry( fd_ed25519_pubkey_cache_t * cache,
+                                       ulong                       hash ) {
+  fd_ed25519_pubkey_cache_entry_t * entry = (fd_ed25519_pubkey_cache_entry_t *)((ulong)cache + cache->entry_off);
+  return entry + (hash & (cache->entry_cnt-1UL));
+}
+
+static inline fd_ed25519_pubkey_cache_hot_t *
+fd_ed25519_pubkey_cache_private_hot( fd_ed25519_pubkey_cache_t * cache,
+                                     ulong                       hash ) {
+  fd_ed25519_pubkey_cache_hot_t * hot = (fd_ed25519_pubkey_cache_hot_t *)((ulong)cache + cache->hot_off);
+  return hot + ((hash>>32) & (cache->hot_cnt-1UL));
+}
+
+fd_ed25519_pubkey_cache_entry_t const *
+fd_ed25519_pubkey_cache_query( fd_ed25519_pubkey_cache_t * cache,
+                               uchar const                 pubkey[ 32 ] ) {
+  ulong                             hash  = fd_ed25519_pubkey_cache_private_hash( cache, pubkey );
+  fd_ed25519_pubkey_cache_entry_t * entry = fd_ed25519_pubkey_cache_private_entry( cache, hash );
+
+  if( FD_UNLIKELY( !entry->used || memcmp( entry->key, pubkey, 32UL ) ) ) {
+    cache->miss_cnt++;
+    return NULL;
+  }
+  cache->hit_cnt++;
+
+  entry->hit_cnt += (uint)(entry->hit_cnt<UINT_MAX);
+  if( FD_UNLIKELY( entry->hit_cnt==FD_ED25519_PUBKEY_CACHE_HOT_THRESH && cache->hot_cnt && entry->err==FD_ED25519_SUCCESS ) ) {
+    fd_ed25519_pubkey_cache_hot_t * hot = fd_ed25519_pubkey_cache_private_hot( cache, hash );
+    if( !hot->used || memcmp( hot->key, pubkey, 32UL ) ) {
+      fd_memcpy( hot->key, pubkey, 32UL );
+      hot->used = 1;
+      fd_ed25519_wnaf_table( hot->tbl, entry->negA );
+    }
+  }
+
+  return entry;
+}
+
+void
+fd_ed25519_pubkey_cache_insert( fd_ed25519_pubkey_cache_t * cache,
+                                uchar const                 pubkey[ 32 ],
+                                fd_ed25519_point_t const *  negA ) {
+  ulong                             hash  = fd_ed25519_pubkey_cache_private_hash( cache, pubkey );
+  fd_ed25519_pubkey_cache_entry_t * entry = fd_ed25519_pubkey_cache_private_entry( cache, hash );
+
+  fd_memcpy( entry->key, pubkey, 32UL );
+  entry->used    = 1;
+  entry->hit_cnt = 0U;
+  if( FD_LIKELY( negA ) ) {
+    entry->err = FD_ED25519_SUCCESS;
+    fd_ed25519_point_set( entry->negA, negA );
+  } else {
+    entry->err = FD_ED25519_ERR_PUBKEY;
+  }
+}
+
+fd_ed25519_point_t const *
+fd_ed25519_pubkey_cache_table( fd_ed25519_pubkey_cache_t * cache,
+                               uchar const                 pubkey[ 32 ] ) {
+  if( FD_UNLIKELY( !cache->hot_cnt ) ) return NULL;
+  ulong                           hash = fd_ed25519_pubkey_cache_private_hash( cache, pubkey );
+  fd_ed25519_pubkey_cache_hot_t * hot  = fd_ed25519_pubkey_cache_private_hot( cache, hash );
+  if( FD_LIKELY( !hot->used || memcmp( hot->key, pubkey, 32UL ) ) ) return NULL;
+  cache->table_hit_cnt++;
+  return hot->tbl;
+}
@@ -0,0 +1,152 @@
+#ifndef HEADER_fd_src_ballet_ed25519_fd_ed25519_pubkey_cache_h
+#define HEADER_fd_src_ballet_ed25519_fd_ed25519_pubkey_cache_h
+
+/* fd_ed25519_pubkey_cache caches decompressed ED25519 public keys.
+
+   Verifying a signature decompresses the signer's public key A (a field
+   square root, roughly 10% of a verify) and, for the double scalar
+   multiplication, builds a table of odd multiples of -A.  Transaction
+   traffic is dominated by a small set of signers (e.g. vote
+   authorities, market makers), so a verifier sees the same public keys
+   over and over.  The cache maps a 32-byte public key to its
+   decompressed and negated point such that repeated signers skip the
+   decompression.  Public keys that do not decompress are cached too
+   (small order keys are not, as the error fd_ed25519_verify reports for
+   those also depends on the signature).
+
+   Keys that hit the cache often ("hot" keys) additionally get their
+   wNAF table (FD_ED25519_WNAF_TBL_SZ points) cached in a second,
+   smaller level.  Hot entries are 8x larger than regular ones, hence
+   the separate level.
+
+   Both levels are direct mapped with a seeded hash of the key (such
+   that collisions cannot be chosen without knowing the seed) and
+   entries are cache line aligned.  The cache is meant to be local to a
+   single verifier (e.g. in the scratch memory of a verify tile) and is
+   not safe for concurrent use.  A cache is position independent and
+   can be used by other processes if it is in shared memory. */
+
+#include "fd_ed25519.h"
+#include "fd_curve25519.h"
+
+#define FD_ED25519_PUBKEY_CACHE_ALIGN (128UL)
+#define FD_ED25519_PUBKEY_CACHE_MAGIC (0xf17eda2ce7ed2550UL) /* firedancer ed25519 pubkey cache version 0 */
+
+/* FD_ED25519_PUBKEY_CACHE_HOT_THRESH is the number of hits after which
+   a key gets its wNAF table cached. */
+
+#define FD_ED25519_PUBKEY_CACHE_HOT_THRESH (8U)
+
+struct __attribute__((aligned(64))) fd_ed25519_pubkey_cache_entry {
+  uchar              key[ 32 ];
+  int                used;    /* 1 if the entry holds key, 0 if empty */
+  int                err;     /* FD_ED25519_SUCCESS or FD_ED25519_ERR_PUBKEY if key does not decompress */
+  uint               hit_cnt; /* Number of hits since insertion (saturating) */
+  fd_ed25519_point_t negA[1]; /* -A, valid if err is FD_ED25519_SUCCESS */
+};
+
+typedef struct fd_ed25519_pubkey_cache_entry fd_ed25519_pubkey_cache_entry_t;
+
+struct __attribute__((aligned(64))) fd_ed25519_pubkey_cache_hot {
+  uchar              key[ 32 ];
+  int                used;
+  fd_ed25519_point_t tbl[ FD_ED25519_WNAF_TBL_SZ ]; /* fd_ed25519_wnaf_table of -A */
+};
+
+typedef struct fd_ed25519_pubkey_cache_hot fd_ed25519_pubkey_cache_hot_t;
+
+struct __attribute__((aligned(FD_ED25519_PUBKEY_CACHE_ALIGN))) fd_ed25519_pubkey_cache {
+  ulong magic;         /* ==FD_ED25519_PUBKEY_CACHE_MAGIC */
+  ulong entry_cnt;     /* Number of regular entries, a power of 2 */
+  ulong hot_cnt;       /* Number of hot entries, a power of 2 or 0 */
+  ulong seed;          /* Hash seed */
+  ulong entry_off;     /* Byte offset of the regular entries from the cache */
+  ulong hot_off;       /* Byte offset of the hot entries from the cache */
+
+  ulong hit_cnt;       /* Number of queries that found their key */
+  ulong miss_cnt;      /* Number of queries that did not */
+  ulong table_hit_cnt; /* Number of table queries that found their key */
+
+  /* Padding to FD_ED25519_PUBKEY_CACHE_ALIGN here */
+  /* entry_cnt fd_ed25519_pubkey_cache_entry_t here */
+  /* hot_cnt fd_ed25519_pubkey_cache_hot_t here */
+};
+
+/* Note: fd_ed25519_pubkey_cache_t is declared in fd_ed25519.h */
+
+FD_PROTOTYPES_BEGIN
+
+/* fd_ed25519_pubkey_cache_{align,footprint} return the required
+   alignment and footprint of a memory region suitable for use as a
+   cache with entry_cnt regular and hot_cnt hot entries.  entry_cnt
+   should be a positive power of 2 and hot_cnt a power of 2 or 0 (no
+   table caching).  footprint returns 0 for invalid parameters. */
+
+FD_FN_CONST ulong
+fd_ed25519_pubkey_cache_align( void );
+
+FD_FN_CONST ulong
+fd_ed25519_pubkey_cache_footprint( ulong entry_cnt,
+                                   ulong hot_cnt );
+
+/* fd_ed25519_pubkey_cache_{new,join,leave,delete} follow the usual
+   conventions.  new formats shmem as an empty cache seeded with seed
+   (an arbitrary value, ideally random) and returns shmem on success or
+   NULL on failure (logs details). */
+
+void *
+fd_ed25519_pubkey_cache_new( void * shmem,
+                             ulong  entry_cnt,
+                             ulong  hot_cnt,
+                             ulong  seed );
+
+fd_ed25519_pubkey_cache_t *
+fd_ed25519_pubkey_cache_join( void * shcache );
+
+void *
+fd_ed25519_pubkey_cache_leave( fd_ed25519_pubkey_cache_t * cache );
+
+void *
+fd_ed25519_pubkey_cache_delete( void * shcache );
+
+/* fd_ed25519_pubkey_cache_query returns the entry of cache holding
+   public key pubkey or NULL if pubkey is not cached.  The hit and miss
+   counters are updated accordingly.  A hit that makes pubkey hot
+   populates pubkey's table level entry.  The returned entry is valid
+   until the next insert or query (which can evict it). */
+
+fd_ed25519_pubkey_cache_entry_t const *
+fd_ed25519_pubkey_cache_query( fd_ed25519_pubkey_cache_t * cache,
+                               uchar const                 pubkey[ 32 ] );
+
+/* fd_ed25519_pubkey_cache_insert caches public key pubkey, evicting
+   whatever key it collides with.  negA is the negation of the
+   decompressed pubkey (which should not be of small order) or NULL if
+   pubkey does not decompress (in which case the entry err will be
+   FD_ED25519_ERR_PUBKEY). */
+
+void
+fd_ed25519_pubkey_cache_insert( fd_ed25519_pubkey_cache_t * cache,
+                                uchar const                 pubkey[ 32 ],
+                                fd_ed25519_point_t const *  negA );
+
+/* fd_ed25519_pubkey_cache_table returns the fd_ed25519_wnaf_table of
+   -A for public key pubkey if pubkey is hot and NULL otherwise (does
+   not count as a hit or a miss).  The returned table is valid until the
+   next query or insert. */
+
+fd_ed25519_point_t const *
+fd_ed25519_pubkey_cache_table( fd_ed25519_pubkey_cache_t * cache,
+                               uchar const                 pubkey[ 32 ] );
+
+/* Accessors */
+
+FD_FN_PURE static inline ulong fd_ed25519_pubkey_cache_entry_cnt    ( fd_ed25519_pubkey_cache_t const * cache ) { return cache->entry_cnt;     }
+FD_FN_PURE static inline ulong fd_ed25519_pubkey_cache_hot_cnt      ( fd_ed25519_pubkey_cache_t const * cache ) { return cache->hot_cnt;       }
+FD_FN_PURE static inline ulong fd_ed25519_pubkey_cache_hit_cnt      ( fd_ed25519_pubkey_cache_t const * cache ) { return cache->hit_cnt;       }
+FD_FN_PURE static inline ulong fd_ed25519_pubkey_cache_miss_cnt     ( fd_ed25519_pubkey_cache_t const * cache ) { return cache->miss_cnt;      }
+FD_FN_PURE static inline ulong fd_ed25519_pubkey_cache_table_hit_cnt( fd_ed25519_pubkey_cache_t const * cache ) { return cache->table_hit_cnt; }
+
+FD_PROTOTYPES_END
+
+#endif /* HEADER_fd_src_ballet_ed25519_fd_ed25519_pubkey_cache_h */
@@ -1,5 +1,6 @@
 #include "fd_ed25519.h"
 #include "fd_curve25519.h"
+#include "fd_ed25519_pubkey_cache.h"
 
 uchar * FD_FN_SENSITIVE
 fd_ed25519_public_from_private( uchar         public_key [ static 32 ],
@@ -309,6 +310,118 @@ int fd_ed25519_verify_batch_single_msg( uchar const   msg[], /* msg_sz */
 #undef MAX
 }
 
+int
+fd_ed25519_verify_batch_multi_msg( uchar const * const msg       [],
+                                   ulong const         msg_sz    [],
+                                   uchar const * const sig       [],
+                                   uchar const * const public_key[],
+                                   ulong               batch_cnt,
+                                   uchar *             scratch,
+                                   ulong               scratch_sz,
+                                   fd_sha512_t *       sha,
+                                   fd_ed25519_pubkey_cache_t * opt_cache,
+                                   int                 err       [] ) {
+#define MAX FD_ED25519_VERIFY_BATCH_MAX
+  if( FD_UNLIKELY( batch_cnt>MAX ) ) {
+    return FD_ED25519_ERR_SIG;
+  }
+
+  fd_ed25519_point_t R     [MAX];
+  fd_ed25519_point_t Aprime[MAX];
+  uchar              k     [MAX][64];
+
+  fd_sha512_batch_t _batch[1];
+  fd_sha512_batch_t * batch = fd_sha512_batch_init( _batch );
+  ulong scratch_off = 0UL;
+
+  /* First, validate scalars, decompress public keys (or look them up in
+     the cache) and points R_j and check low order points as
+     fd_ed25519_verify does.  For the valid ones, queue the preimage of
+     k_j for lane parallel hashing.  Aprime_j holds -A_j. */
+
+  for( ulong j=0UL; j<batch_cnt; j++ ) {
+    uchar const * r = sig[j];
+    uchar const * S = sig[j] + 32;
+
+    err[j] = FD_ED25519_SUCCESS;
+
+    if( FD_UNLIKELY( !fd_curve25519_scalar_validate( S ) ) ) {
+      err[j] = FD_ED25519_ERR_SIG;
+      continue;
+    }
+    fd_ed25519_pubkey_cache_entry_t const * entry = opt_cache ? fd_ed25519_pubkey_cache_query( opt_cache, public_key[j] ) : NULL;
+    if( FD_LIKELY( entry ) ) {
+      if( FD_UNLIKELY( entry->err ) ) {
+        err[j] = entry->err;
+        continue;
+      }
+      fd_ed25519_point_set( &Aprime[j], entry->negA );
+      if( FD_UNLIKELY( !fd_ed25519_point_frombytes( &R[j], r ) ) ) {
+        err[j] = FD_ED25519_ERR_SIG;
+        continue;
+      }
+    } else {
+      int res = fd_ed25519_point_frombytes_2x( &Aprime[j], public_key[j], &R[j], r );
+      if( FD_UNLIKELY( res ) ) {
+        if( res==1 && opt_cache ) fd_ed25519_pubkey_cache_insert( opt_cache, public_key[j], NULL );
+        err[j] = res == 1 ? FD_ED25519_ERR_PUBKEY : FD_ED25519_ERR_SIG;
+        continue;
+      }
+      /* Small order keys are not cached, such that they keep failing
+         with the same error as fd_ed25519_verify (which depends on R) */
+      if( FD_UNLIKELY( fd_ed25519_affine_is_small_order( &Aprime[j] ) ) ) {
+        err[j] = FD_ED25519_ERR_PUBKEY;
+        continue;
+      }
+      fd_ed25519_point_neg( &Aprime[j], &Aprime[j] );
+      if( opt_cache ) fd_ed25519_pubkey_cache_insert( opt_cache, public_key[j], &Aprime[j] );
+    }
+    if( FD_UNLIKELY( fd_ed25519_affine_is_small_order( &R[j] ) ) ) {
+      err[j] = FD_ED25519_ERR_SIG;
+      continue;
+    }
+
+    ulong pre_sz = 64UL + msg_sz[j];
+    if( FD_UNLIKELY( pre_sz>scratch_sz ) ) {
+      fd_sha512_fini( fd_sha512_append( fd_sha512_append( fd_sha512_append( fd_sha512_init( sha ),
+                      r, 32UL ), public_key[j], 32UL ), msg[j], msg_sz[j] ), k[j] );
+      continue;
+    }
+    if( FD_UNLIKELY( pre_sz>scratch_sz-scratch_off ) ) { /* Scratch full, hash what is queued and reuse it */
+      fd_sha512_batch_fini( batch );
+      batch       = fd_sha512_batch_init( _batch );
+      scratch_off = 0UL;
+    }
+    uchar * pre = scratch + scratch_off;
+    fd_memcpy( pre,       r,             32UL      );
+    fd_memcpy( pre+32UL,  public_key[j], 32UL      );
+    fd_memcpy( pre+64UL,  msg[j],        msg_sz[j] );
+    fd_sha512_batch_add( batch, pre, pre_sz, k[j] );
+    scratch_off += pre_sz;
+  }
+
+  fd_sha512_batch_fini( batch );
+
+  /* Then check the group equation of the remaining ones (with the
+     cached table of -A_j for hot keys) */
+
+  int ret = FD_ED25519_SUCCESS;
+  for( ulong j=0UL; j<batch_cnt; j++ ) {
+    if( FD_LIKELY( err[j]==FD_ED25519_SUCCESS ) ) {
+      uchar const * S = sig[j] + 32;
+      fd_ed25519_point_t Rcmp[1];
+      fd_curve25519_scalar_reduce( k[j], k[j] );
+      fd_ed25519_point_t const * tbl = opt_cache ? fd_ed25519_pubkey_cache_table( opt_cache, public_key[j] ) : NULL;
+      if( tbl ) fd_ed25519_double_scalar_mul_base_table( Rcmp, k[j], tbl,        S );
+      else      fd_ed25519_double_scalar_mul_base      ( Rcmp, k[j], &Aprime[j], S );
+      if( FD_UNLIKELY( !fd_ed25519_point_eq_z1( Rcmp, &R[j] ) ) ) err[j] = FD_ED25519_ERR_MSG;
+    }
+    ret = fd_int_if( ret==FD_ED25519_SUCCESS, err[j], ret );
+  }
+  return ret;
+#undef MAX
+}
+
 char const *
 fd_ed25519_strerror( int err ) {
   switch( err ) {
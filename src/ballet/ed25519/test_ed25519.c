@@ -1,6 +1,7 @@
 #include "../fd_ballet.h"
 #include "fd_ed25519.h"
 #include "fd_curve25519.h"
+#include "fd_ed25519_pubkey_cache.h"
 #include "../hex/fd_hex.h"
 #include "test_ed25519_wycheproof.c"
 #include "test_ed25519_cctv.c"
@@ -1141,6 +1142,119 @@ test_cctv_batch( fd_rng_t * rng, fd_sha512_t * sha ) {
   FD_LOG_NOTICE(( "fd_ed25519_verify_cctv_batch: ok" ));
 }
 
+void
+test_verify_batch_multi_msg( fd_rng_t *    rng,
+                             fd_sha512_t * sha ) {
+# define N FD_ED25519_VERIFY_BATCH_MAX
+  static uchar  msgs[ N ][ 1024 ];
+  static uchar  scratch[ N*(64UL+1024UL) ];
+  uchar         pubs[ N ][ 32 ];
+  uchar         sigs[ N ][ 64 ];
+  uchar         prv [ 32 ];
+  uchar const * msg_ptr[ N ];
+  ulong         msg_sz [ N ];
+  uchar const * sig_ptr[ N ];
+  uchar const * pub_ptr[ N ];
+  int           err    [ N ];
+
+  for( ulong j=0UL; j<N; j++ ) {
+    msg_sz[j] = (ulong)fd_rng_uint_roll( rng, 1025U );
+    for( ulong b=0UL; b<msg_sz[j]; b++ ) msgs[j][b] = fd_rng_uchar( rng );
+    fd_ed25519_public_from_private( pubs[j], fd_rng_b256( rng, prv ), sha );
+    fd_ed25519_sign( sigs[j], msgs[j], msg_sz[j], pubs[j], prv, sha );
+    msg_ptr[j] = msgs[j]; sig_ptr[j] = sigs[j]; pub_ptr[j] = pubs[j];
+  }
+
+  for( ulong batch_cnt=0UL; batch_cnt<=N; batch_cnt++ ) {
+    FD_TEST( fd_ed25519_verify_batch_multi_msg( msg_ptr, msg_sz, sig_ptr, pub_ptr, batch_cnt, scratch, sizeof(scratch), sha, NULL, err )==FD_ED25519_SUCCESS );
+    for( ulong j=0UL; j<batch_cnt; j++ ) FD_TEST( err[j]==FD_ED25519_SUCCESS );
+  }
+
+  /* Randomly corrupt signatures, messages and public keys and check
+     the per signature result matches fd_ed25519_verify, with scratch
+     sizes that force multiple hashing passes and hashing with sha, and
+     every other iteration with a pubkey cache small enough to collide */
+
+  static uchar pubkey_cache_mem[ 65536 ] __attribute__((aligned(FD_ED25519_PUBKEY_CACHE_ALIGN)));
+  FD_TEST( fd_ed25519_pubkey_cache_footprint( 8UL, 4UL )<=sizeof(pubkey_cache_mem) );
+  fd_ed25519_pubkey_cache_t * pubkey_cache = fd_ed25519_pubkey_cache_join( fd_ed25519_pubkey_cache_new( pubkey_cache_mem, 8UL, 4UL, fd_rng_ulong( rng ) ) );
+  FD_TEST( pubkey_cache );
+
+  for( ulong iter=0UL; iter<1000UL; iter++ ) {
+    uchar cmsgs[ N ][ 1024 ]; uchar cpubs[ N ][ 32 ]; uchar csigs[ N ][ 64 ];
+    fd_memcpy( cmsgs, msgs, sizeof(cmsgs) ); fd_memcpy( cpubs, pubs, sizeof(cpubs) ); fd_memcpy( csigs, sigs, sizeof(csigs) );
+    for( ulong j=0UL; j<N; j++ ) {
+      msg_ptr[j] = cmsgs[j]; sig_ptr[j] = csigs[j]; pub_ptr[j] = cpubs[j];
+      uint r = fd_rng_uint( rng );
+      if( !(r & 7U) ) { ulong idx = fd_rng_ulong_roll( rng, 512UL ); csigs[j][ idx>>3 ] ^= (uchar)(1UL<<(idx & 7UL)); } r >>= 3;
+      if( !(r & 7U) ) { ulong idx = fd_rng_ulong_roll( rng, 256UL ); cpubs[j][ idx>>3 ] ^= (uchar)(1UL<<(idx & 7UL)); } r >>= 3;
+      if( !(r & 7U) && msg_sz[j] ) { ulong idx = fd_rng_ulong_roll( rng, 8UL*msg_sz[j] ); cmsgs[j][ idx>>3 ] ^= (uchar)(1UL<<(idx & 7UL)); }
+    }
+    ulong batch_cnt  = 1UL + fd_rng_ulong_roll( rng, N );
+    ulong scratch_sz = fd_rng_ulong_roll( rng, sizeof(scratch)+1UL );
+    fd_ed25519_pubkey_cache_t * cache = (iter & 1UL) ? pubkey_cache : NULL;
+    int   ret        = fd_ed25519_verify_batch_multi_msg( msg_ptr, msg_sz, sig_ptr, pub_ptr, batch_cnt, scratch, scratch_sz, sha, cache, err );
+    int   exp_ret    = FD_ED25519_SUCCESS;
+    for( ulong j=0UL; j<batch_cnt; j++ ) {
+      int exp = fd_ed25519_verify( cmsgs[j], msg_sz[j], csigs[j], cpubs[j], sha );
+      FD_TEST( err[j]==exp );
+      if( exp_ret==FD_ED25519_SUCCESS ) exp_ret = exp;
+    }
+    FD_TEST( ret==exp_ret );
+  }
+  FD_TEST( fd_ed25519_pubkey_cache_hit_cnt      ( pubkey_cache ) );
+  FD_TEST( fd_ed25519_pubkey_cache_miss_cnt     ( pubkey_cache ) );
+  FD_TEST( fd_ed25519_pubkey_cache_table_hit_cnt( pubkey_cache ) );
+  FD_TEST( fd_ed25519_pubkey_cache_delete( fd_ed25519_pubkey_cache_leave( pubkey_cache ) )==pubkey_cache_mem );
+
+  for( ulong j=0UL; j<N; j++ ) { msg_ptr[j] = msgs[j]; sig_ptr[j] = sigs[j]; pub_ptr[j] = pubs[j]; }
+  FD_TEST( fd_ed25519_verify_batch_multi_msg( msg_ptr, msg_sz, sig_ptr, pub_ptr, N+1UL, scratch, sizeof(scratch), sha, NULL, err )==FD_ED25519_ERR_SIG );
+
+  /* Bench against verifying the signatures one at a time */
+
+  ulong iter = 1000UL;
+  long dt = fd_log_wallclock();
+  for( ulong rem=iter; rem; rem-- ) {
+    FD_COMPILER_FORGET( sha );
+    for( ulong j=0UL; j<N; j++ ) fd_ed25519_verify( msgs[j], msg_sz[j], sigs[j], pubs[j], sha );
+  }
+  dt = fd_log_wallclock() - dt;
+  log_bench( "fd_ed25519_verify(x16)", iter, dt );
+
+  dt = fd_log_wallclock();
+  for( ulong rem=iter; rem; rem-- ) {
+    FD_COMPILER_FORGET( sha );
+    fd_ed25519_verify_batch_multi_msg( msg_ptr, msg_sz, sig_ptr, pub_ptr, N, scratch, sizeof(scratch), sha, NULL, err );
+  }
+  dt = fd_log_wallclock() - dt;
+  log_bench( "fd_ed25519_verify_batch_multi_msg(16)", iter, dt );
+
+  /* With the public keys cached, without and with their tables (hot
+     after the first few iters) */
+
+  for( ulong hot_cnt=0UL; hot_cnt<=256UL; hot_cnt+=256UL ) {
+    static uchar bench_cache_mem[ 1UL<<20 ] __attribute__((aligned(FD_ED25519_PUBKEY_CACHE_ALIGN)));
+    FD_TEST( fd_ed25519_pubkey_cache_footprint( 1024UL, hot_cnt )<=sizeof(bench_cache_mem) );
+    pubkey_cache = fd_ed25519_pubkey_cache_join( fd_ed25519_pubkey_cache_new( bench_cache_mem, 1024UL, hot_cnt, 0UL ) );
+    FD_TEST( pubkey_cache );
+
+    dt = fd_log_wallclock();
+    for( ulong rem=iter; rem; rem-- ) {
+      FD_COMPILER_FORGET( sha );
+      fd_ed25519_verify_batch_multi_msg( msg_ptr, msg_sz, sig_ptr, pub_ptr, N, scratch, sizeof(scratch), sha, pubkey_cache, err );
+    }
+    dt = fd_log_wallclock() - dt;
+    log_bench( hot_cnt ? "fd_ed25519_verify_batch_multi_msg(16,cached pubkeys+tables)" : "fd_ed25519_verify_batch_multi_msg(16,cached pubkeys)", iter, dt );
+    for( ulong j=0UL; j<N; j++ ) FD_TEST( err[j]==FD_ED25519_SUCCESS );
+    FD_LOG_NOTICE(( "pubkey cache: hit %lu miss %lu table hit %lu",
+                    fd_ed25519_pubkey_cache_hit_cnt( pubkey_cache ), fd_ed25519_pubkey_cache_miss_cnt( pubkey_cache ),
+                    fd_ed25519_pubkey_cache_table_hit_cnt( pubkey_cache ) ));
+
+    fd_ed25519_pubkey_cache_delete( fd_ed25519_pubkey_cache_leave( pubkey_cache ) );
+  }
+# undef N
+}
+
 /**********************************************************************/
 
 int
@@ -1181,6 +1295,8 @@ main( int     argc,
   test_cctv       ( sha );
   test_cctv_batch ( rng, sha );
 
+  test_verify_batch_multi_msg( rng, sha );
+
   fd_sha512_delete( fd_sha512_leave( sha ) );
   fd_rng_delete( fd_rng_leave( rng ) );
   FD_LOG_NOTICE(( "pass" ));
@@ -1173,16 +1173,53 @@ typedef struct {
   ulong bytes_scheduled;
 } sched_return_t;
 
+/* sched_bin_t is one microblock being filled by fd_pack_schedule_impl.
+   cu_limit and txn_limit are what's left of the microblock's limits,
+   and out and use_by_bank_txn point to where the next scheduled
+   transaction goes.  The scheduled fields accumulate over calls. */
+
+typedef struct {
+  ulong        bank_tile;
+  ulong        cu_limit;
+  ulong        txn_limit;
+  fd_txn_p_t * out;
+  ulong      * use_by_bank_txn;
+  ulong        use_by_bank_cnt;
+  ulong        cus_scheduled;
+  ulong        txns_scheduled;
+} sched_bin_t;
+
+/* sched_bins_cu_limit returns the largest transaction cost that fits
+   in one of the bins with room for another transaction, capped at
+   shared_cu_limit, or 0 if all the bins are full. */
+
+static inline ulong
+sched_bins_cu_limit( sched_bin_t const * bins,
+                     ulong               bin_cnt,
+                     ulong               shared_cu_limit ) {
+  ulong cu_limit = 0UL;
+  for( ulong b=0UL; b<bin_cnt; b++ ) cu_limit = fd_ulong_max( cu_limit, fd_ulong_if( !!bins[b].txn_limit, bins[b].cu_limit, 0UL ) );
+  return fd_ulong_min( cu_limit, shared_cu_limit );
+}
+
+/* fd_pack_schedule_impl schedules transactions from sched_from into
+   bin_cnt microblocks at once, one for each (distinct) bank tile in
+   bins.  It walks the treap once, from best to worst, and puts each
+   transaction that doesn't conflict with anything in use (including
+   what was put in the other bins, as the microblocks execute in
+   parallel) into the bin that fits it with the most CUs left, which
+   keeps the microblocks balanced.  The transactions scheduled
+   together cannot exceed shared_cu_limit CUs and byte_limit bytes.
+   With a single bin, this is the usual greedy microblock scheduler. */
+
 static inline sched_return_t
 fd_pack_schedule_impl( fd_pack_t          * pack,
                        treap_t            * sched_from,
-                       ulong                cu_limit,
-                       ulong                txn_limit,
+                       sched_bin_t        * bins,
+                       ulong                bin_cnt,
+                       ulong                shared_cu_limit,
                        ulong                byte_limit,
-                       ulong                bank_tile,
-                       fd_pack_smallest_t * smallest_in_treap,
-                       ulong              * use_by_bank_txn,
-                       fd_txn_p_t         * out ) {
+                       fd_pack_smallest_t * smallest_in_treap ) {
 
   fd_pack_ord_txn_t  * pool         = pack->pool;
   fd_pack_addr_use_t * acct_in_use  = pack->acct_in_use;
@@ -1197,8 +1234,7 @@ fd_pack_schedule_impl( fd_pack_t          * pack,
   FD_PACK_BITSET_COPY( bitset_rw_in_use, pack->bitset_rw_in_use );
   FD_PACK_BITSET_COPY( bitset_w_in_use,  pack->bitset_w_in_use  );
 
-  fd_pack_addr_use_t * use_by_bank     = pack->use_by_bank    [bank_tile];
-  ulong                use_by_bank_cnt = pack->use_by_bank_cnt[bank_tile];
+  for( ulong b=0UL; b<bin_cnt; b++ ) bins[b].use_by_bank_cnt = pack->use_by_bank_cnt[ bins[b].bank_tile ];
 
   ulong max_write_cost_per_acct = pack->lim->max_write_cost_per_acct;
 
@@ -1208,8 +1244,6 @@ fd_pack_schedule_impl( fd_pack_t          * pack,
   ulong cus_scheduled   = 0UL;
   ulong bytes_scheduled = 0UL;
 
-  ulong bank_tile_mask = 1UL << bank_tile;
-
   ulong fast_path     = 0UL;
   ulong slow_path     = 0UL;
   ulong cu_limit_c    = 0UL;
@@ -1220,7 +1254,9 @@ fd_pack_schedule_impl( fd_pack_t          * pack,
   ulong min_cus   = ULONG_MAX;
   ulong min_bytes = ULONG_MAX;
 
-  if( FD_UNLIKELY( (cu_limit<smallest_in_treap->cus) | (txn_limit==0UL) | (byte_limit<smallest_in_treap->bytes) ) ) {
+  ulong cu_limit = sched_bins_cu_limit( bins, bin_cnt, shared_cu_limit );
+
+  if( FD_UNLIKELY( (cu_limit<smallest_in_treap->cus) | (cu_limit==0UL) | (byte_limit<smallest_in_treap->bytes) ) ) {
     sched_return_t to_return = { .cus_scheduled = 0UL, .txns_scheduled = 0UL, .bytes_scheduled = 0UL };
     return to_return;
   }
@@ -1338,7 +1374,19 @@ fd_pack_schedule_impl( fd_pack_t          * pack,
       continue;
     }
 
-    /* Include this transaction in the microblock! */
+    /* Include this transaction in the microblock of the bin with the
+       most CUs left.  Some bin fits it, as cu_limit is the max. */
+    sched_bin_t * bin = NULL;
+    for( ulong b=0UL; b<bin_cnt; b++ ) {
+      if( FD_UNLIKELY( !bins[b].txn_limit || bins[b].cu_limit<cur->compute_est ) ) continue;
+      if( !bin || bins[b].cu_limit>bin->cu_limit ) bin = bins+b;
+    }
+
+    fd_pack_addr_use_t * use_by_bank     = pack->use_by_bank[ bin->bank_tile ];
+    ulong                use_by_bank_cnt = bin->use_by_bank_cnt;
+    ulong                bank_tile_mask  = 1UL << bin->bank_tile;
+    fd_txn_p_t         * out             = bin->out;
+
     FD_PACK_BITSET_OR( bitset_rw_in_use, cur->rw_bitset );
     FD_PACK_BITSET_OR( bitset_w_in_use,  cur->w_bitset  );
 
@@ -1388,7 +1436,6 @@ fd_pack_schedule_impl( fd_pack_t          * pack,
       out->pack_cu.non_execution_cus       = cur->txn->pack_cu.non_execution_cus;
       out->flags                           = cur->txn->flags;
     }
-    out++;
 
     for( fd_txn_acct_iter_t iter=fd_txn_acct_iter_init( txn, FD_TXN_ACCT_CAT_WRITABLE );
         iter!=fd_txn_acct_iter_end(); iter=fd_txn_acct_iter_next( iter ) ) {
@@ -1436,11 +1483,18 @@ fd_pack_schedule_impl( fd_pack_t          * pack,
       FD_PACK_BITSET_CLEARN( bitset_w_in_use,  ret.clear_w_bit  );
     }
 
-    txns_scheduled  += 1UL;                      txn_limit       -= 1UL;
-    cus_scheduled   += cur->compute_est;         cu_limit        -= cur->compute_est;
+    txns_scheduled  += 1UL;                      bin->txn_limit  -= 1UL;
+    cus_scheduled   += cur->compute_est;         bin->cu_limit   -= cur->compute_est;
     bytes_scheduled += cur->txn->payload_sz;     byte_limit      -= cur->txn->payload_sz;
+    shared_cu_limit -= cur->compute_est;
+
+    bin->txns_scheduled  += 1UL;
+    bin->cus_scheduled   += cur->compute_est;
+    bin->out              = out+1;
+    bin->use_by_bank_cnt  = use_by_bank_cnt;
+    *(bin->use_by_bank_txn++) = use_by_bank_cnt;
 
-    *(use_by_bank_txn++) = use_by_bank_cnt;
+    cu_limit = sched_bins_cu_limit( bins, bin_cnt, shared_cu_limit );
 
     fd_ed25519_sig_t const * sig0 = fd_txn_get_signatures( txn, cur->txn->payload );
 
@@ -1452,7 +1506,7 @@ fd_pack_schedule_impl( fd_pack_t          * pack,
     trp_pool_idx_release( pool, _cur );
     pack->pending_txn_cnt--;
 
-    if( FD_UNLIKELY( (cu_limit<smallest_in_treap->cus) | (txn_limit==0UL) | (byte_limit<smallest_in_treap->bytes) ) ) break;
+    if( FD_UNLIKELY( (cu_limit<smallest_in_treap->cus) | (cu_limit==0UL) | (byte_limit<smallest_in_treap->bytes) ) ) break;
   }
 
   FD_MCNT_INC( PACK, TRANSACTION_SCHEDULE_TAKEN,      txns_scheduled );
@@ -1474,7 +1528,7 @@ fd_pack_schedule_impl( fd_pack_t          * pack,
     smallest_in_treap->bytes = min_bytes;
   }
 
-  pack->use_by_bank_cnt[bank_tile] = use_by_bank_cnt;
+  for( ulong b=0UL; b<bin_cnt; b++ ) pack->use_by_bank_cnt[ bins[b].bank_tile ] = bins[b].use_by_bank_cnt;
   FD_PACK_BITSET_COPY( pack->bitset_rw_in_use, bitset_rw_in_use );
   FD_PACK_BITSET_COPY( pack->bitset_w_in_use,  bitset_w_in_use  );
 
@@ -1599,72 +1653,93 @@ fd_pack_microblock_complete( fd_pack_t * pack,
 
 
 ulong
-fd_pack_schedule_next_microblock( fd_pack_t *  pack,
-                                  ulong        total_cus,
-                                  float        vote_fraction,
-                                  ulong        bank_tile,
-                                  fd_txn_p_t * out ) {
+fd_pack_schedule_next_microblocks( fd_pack_t *          pack,
+                                   ulong                total_cus,
+                                   float                vote_fraction,
+                                   ulong const *        bank_tile,
+                                   ulong                bank_cnt,
+                                   fd_txn_p_t * const * out,
+                                   ulong *              out_cnt ) {
+
+  for( ulong b=0UL; b<bank_cnt; b++ ) out_cnt[ b ] = 0UL;
 
   /* TODO: Decide if these are exactly how we want to handle limits */
-  total_cus = fd_ulong_min( total_cus, pack->lim->max_cost_per_block - pack->cumulative_block_cost );
+  ulong block_cus = pack->lim->max_cost_per_block - pack->cumulative_block_cost;
+  total_cus = fd_ulong_min( total_cus, block_cus );
   ulong vote_cus = fd_ulong_min( (ulong)((float)total_cus * vote_fraction),
                                  pack->lim->max_vote_cost_per_block - pack->cumulative_vote_cost );
   ulong vote_reserved_txns = fd_ulong_min( vote_cus/FD_PACK_TYPICAL_VOTE_COST,
                                            (ulong)((float)pack->lim->max_txn_per_microblock * vote_fraction) );
 
-
-  if( FD_UNLIKELY( (pack->microblock_cnt>=pack->lim->max_microblocks_per_block) ) ) {
+  /* Only plan as many microblocks as the block has room for.  Each one
+     reserves its overhead in the data limit up front. */
+  bank_cnt = fd_ulong_min( bank_cnt, pack->lim->max_microblocks_per_block - fd_ulong_min( pack->microblock_cnt, pack->lim->max_microblocks_per_block ) );
+  if( FD_UNLIKELY( !bank_cnt ) ) {
     FD_MCNT_INC( PACK, MICROBLOCK_PER_BLOCK_LIMIT, 1UL );
     return 0UL;
   }
-  if( FD_UNLIKELY( pack->data_bytes_consumed+MICROBLOCK_DATA_OVERHEAD+FD_TXN_MIN_SERIALIZED_SZ>pack->lim->max_data_bytes_per_block) ) {
+  ulong data_bytes_avail = pack->lim->max_data_bytes_per_block - fd_ulong_min( pack->data_bytes_consumed, pack->lim->max_data_bytes_per_block );
+  bank_cnt = fd_ulong_min( bank_cnt, data_bytes_avail/(MICROBLOCK_DATA_OVERHEAD+FD_TXN_MIN_SERIALIZED_SZ) );
+  if( FD_UNLIKELY( !bank_cnt ) ) {
     FD_MCNT_INC( PACK, DATA_PER_BLOCK_LIMIT, 1UL );
     return 0UL;
   }
 
-  ulong * use_by_bank_txn = pack->use_by_bank_txn[ bank_tile ];
+  sched_bin_t bins[ FD_PACK_MAX_BANK_TILES ];
+  bank_cnt = fd_ulong_min( bank_cnt, FD_PACK_MAX_BANK_TILES );
+  for( ulong b=0UL; b<bank_cnt; b++ ) {
+    bins[ b ] = (sched_bin_t){ .bank_tile       = bank_tile[ b ],
+                               .cu_limit        = vote_cus,
+                               .txn_limit       = vote_reserved_txns,
+                               .out             = out[ b ],
+                               .use_by_bank_txn = pack->use_by_bank_txn[ bank_tile[ b ] ] };
+  }
 
-  ulong cu_limit  = total_cus - vote_cus;
-  ulong txn_limit = pack->lim->max_txn_per_microblock - vote_reserved_txns;
-  ulong scheduled = 0UL;
-  ulong byte_limit = pack->lim->max_data_bytes_per_block - pack->data_bytes_consumed - MICROBLOCK_DATA_OVERHEAD;
+  ulong byte_limit = data_bytes_avail - bank_cnt*MICROBLOCK_DATA_OVERHEAD;
 
   sched_return_t status, status1;
 
   /* Schedule vote transactions */
-  status1= fd_pack_schedule_impl( pack, pack->pending_votes, vote_cus, vote_reserved_txns, byte_limit, bank_tile, pack->pending_votes_smallest, use_by_bank_txn, out+scheduled );
+  ulong vote_block_cus = fd_ulong_min( block_cus, pack->lim->max_vote_cost_per_block - pack->cumulative_vote_cost );
+  status1 = fd_pack_schedule_impl( pack, pack->pending_votes, bins, bank_cnt, vote_block_cus, byte_limit, pack->pending_votes_smallest );
 
-  scheduled                   += status1.txns_scheduled;
   pack->cumulative_vote_cost  += status1.cus_scheduled;
   pack->cumulative_block_cost += status1.cus_scheduled;
   pack->data_bytes_consumed   += status1.bytes_scheduled;
   byte_limit                  -= status1.bytes_scheduled;
-  use_by_bank_txn             += status1.txns_scheduled;
-  /* Add any remaining CUs/txns to the non-vote limits */
-  txn_limit += vote_reserved_txns - status1.txns_scheduled;
-  cu_limit  += vote_cus - status1.cus_scheduled;
-
+  /* Give any remaining CUs/txns to the non-vote limits */
+  ulong vote_txns[ FD_PACK_MAX_BANK_TILES ];
+  for( ulong b=0UL; b<bank_cnt; b++ ) {
+    vote_txns[ b ]      = bins[ b ].txns_scheduled;
+    bins[ b ].cu_limit  = total_cus                          - bins[ b ].cus_scheduled;
+    bins[ b ].txn_limit = pack->lim->max_txn_per_microblock - bins[ b ].txns_scheduled;
+  }
 
   /* Fill any remaining space with non-vote transactions */
-  status = fd_pack_schedule_impl( pack, pack->pending,       cu_limit, txn_limit,          byte_limit, bank_tile, pack->pending_smallest,       use_by_bank_txn, out+scheduled );
+  status = fd_pack_schedule_impl( pack, pack->pending,       bins, bank_cnt, block_cus-status1.cus_scheduled, byte_limit, pack->pending_smallest );
 
-  scheduled                   += status.txns_scheduled;
   pack->cumulative_block_cost += status.cus_scheduled;
   pack->data_bytes_consumed   += status.bytes_scheduled;
 
-  ulong nonempty = (ulong)(scheduled>0UL);
-  pack->microblock_cnt              += nonempty;
-  pack->outstanding_microblock_mask |= nonempty << bank_tile;
-  pack->data_bytes_consumed         += nonempty * MICROBLOCK_DATA_OVERHEAD;
+  ulong scheduled = 0UL;
+  for( ulong b=0UL; b<bank_cnt; b++ ) {
+    ulong txn_cnt  = bins[ b ].txns_scheduled;
+    ulong nonempty = (ulong)(txn_cnt>0UL);
+    out_cnt[ b ]                       = txn_cnt;
+    scheduled                         += txn_cnt;
+    pack->microblock_cnt              += nonempty;
+    pack->outstanding_microblock_mask |= nonempty << bins[ b ].bank_tile;
+    pack->data_bytes_consumed         += nonempty * MICROBLOCK_DATA_OVERHEAD;
+
+    fd_histf_sample( pack->txn_per_microblock,  txn_cnt        );
+    fd_histf_sample( pack->vote_per_microblock, vote_txns[ b ] );
+  }
 
   /* Update metrics counters */
   FD_MGAUGE_SET( PACK, AVAILABLE_TRANSACTIONS,      pack->pending_txn_cnt                );
   FD_MGAUGE_SET( PACK, AVAILABLE_VOTE_TRANSACTIONS, treap_ele_cnt( pack->pending_votes ) );
   FD_MGAUGE_SET( PACK, CUS_CONSUMED_IN_BLOCK,       pack->cumulative_block_cost          );
 
-  fd_histf_sample( pack->txn_per_microblock,  scheduled              );
-  fd_histf_sample( pack->vote_per_microblock, status1.txns_scheduled );
-
 #if FD_HAS_AVX512 && FD_PACK_USE_NON_TEMPORAL_MEMCPY
   _mm_sfence();
 #endif
@@ -1672,6 +1747,16 @@ fd_pack_schedule_next_microblock( fd_pack_t *  pack,
   return scheduled;
 }
 
+ulong
+fd_pack_schedule_next_microblock( fd_pack_t *  pack,
+                                  ulong        total_cus,
+                                  float        vote_fraction,
+                                  ulong        bank_tile,
+                                  fd_txn_p_t * out ) {
+  ulong out_cnt[1];
+  return fd_pack_schedule_next_microblocks( pack, total_cus, vote_fraction, &bank_tile, 1UL, &out, out_cnt );
+}
+
 ulong fd_pack_bank_tile_cnt     ( fd_pack_t const * pack ) { return pack->bank_tile_cnt;         }
 ulong fd_pack_current_block_cost( fd_pack_t const * pack ) { return pack->cumulative_block_cost; }
 
@@ -322,6 +322,37 @@ void         fd_pack_insert_txn_cancel( fd_pack_t * pack, fd_txn_e_t * txn
 
 ulong fd_pack_schedule_next_microblock( fd_pack_t * pack, ulong total_cus, float vote_fraction, ulong bank_tile, fd_txn_p_t * out );
 
+/* fd_pack_schedule_next_microblocks is like
+   fd_pack_schedule_next_microblock, but schedules a microblock for each
+   of the bank_cnt bank tiles in bank_tile at once.  This is meant for
+   when several bank tiles are idle at the same time: rather than
+   giving the best transactions to the first bank tile and what's left
+   to the next ones, it considers each transaction once and places it in
+   the microblock that has the most CUs left, which packs the CUs
+   available to the block better and costs a single pass over the
+   pending transactions.  Transactions in different microblocks
+   scheduled by one call do not conflict with each other.
+
+   bank_tile[i] must be distinct, in [0, bank_tile_cnt), and not have an
+   outstanding microblock.  The transactions of the microblock for
+   bank_tile[i] are copied to out[i] and their number is stored in
+   out_cnt[i].  Each microblock respects total_cus and vote_fraction as
+   explained above.  Block limits are checked for all the microblocks
+   together, and fewer than bank_cnt microblocks (the first ones) may be
+   scheduled if the block is almost full, in which case the remaining
+   out_cnt are 0.  Returns the total number of transactions scheduled.
+   With bank_cnt==1, this is the same as
+   fd_pack_schedule_next_microblock. */
+
+ulong
+fd_pack_schedule_next_microblocks( fd_pack_t *          pack,
+                                   ulong                total_cus,
+                                   float                vote_fraction,
+                                   ulong const *        bank_tile,
+                                   ulong                bank_cnt,
+                                   fd_txn_p_t * const * out,
+                                   ulong *              out_cnt );
+
 
 /* fd_pack_rebate_cus adjusts the compute unit accounting for the
    specified transactions to take into account the actual consumed CUs
@@ -302,6 +302,82 @@ void test0( void ) {
   schedule_validate_microblock( pack, 30000UL, 0.0f, 1UL, 0UL, 0UL, &outcome ); /* conflict gone.*/
 }
 
+/* microblock_accts collects the accounts (in the same encoding as
+   schedule_validate_microblock) used by the txn_cnt transactions at
+   txns. */
+static void
+microblock_accts( fd_txn_p_t const * txns,
+                  ulong              txn_cnt,
+                  aset_t *           read_accts,
+                  aset_t *           write_accts ) {
+  *read_accts  = aset_null( );
+  *write_accts = aset_null( );
+  for( ulong i=0UL; i<txn_cnt; i++ ) {
+    fd_txn_t const       * txn  = TXN(txns+i);
+    fd_acct_addr_t const * acct = fd_txn_get_acct_addrs( txn, txns[i].payload );
+    for( fd_txn_acct_iter_t iter=fd_txn_acct_iter_init( txn, FD_TXN_ACCT_CAT_WRITABLE_NONSIGNER_IMM );
+        iter!=fd_txn_acct_iter_end(); iter=fd_txn_acct_iter_next( iter ) ) {
+      uchar b0 = acct[ fd_txn_acct_iter_idx( iter ) ].b[0];
+      FD_TEST( !aset_test( *write_accts, (ulong)b0-0x30UL ) );
+      *write_accts = aset_insert( *write_accts, (ulong)b0-0x30UL );
+    }
+    for( fd_txn_acct_iter_t iter=fd_txn_acct_iter_init( txn, FD_TXN_ACCT_CAT_READONLY_NONSIGNER_IMM );
+        iter!=fd_txn_acct_iter_end(); iter=fd_txn_acct_iter_next( iter ) ) {
+      uchar b0 = acct[ fd_txn_acct_iter_idx( iter ) ].b[0];
+      if( (0x30UL<=b0) & (b0<0x70UL) ) *read_accts = aset_insert( *read_accts, (ulong)b0-0x30UL );
+    }
+  }
+}
+
+/* Scheduling for several idle bank tiles at once */
+void test_multi_bank( void ) {
+  FD_LOG_NOTICE(( "TEST MULTI BANK" ));
+  fd_pack_t * pack = init_all( 128UL, 4UL, 2UL, &outcome );
+  ulong i = 0UL;
+  make_transaction( i,  500U, 13.0, "A", "Z" ); insert( i++, pack );
+  make_transaction( i,  500U, 12.0, "B", "Z" ); insert( i++, pack );
+  make_transaction( i,  500U, 11.0, "C", "Y" ); insert( i++, pack );
+  make_transaction( i,  500U, 10.0, "Z", "D" ); insert( i++, pack ); /* conflicts with the first two */
+  make_transaction( i,  500U,  9.0, "D", "X" ); insert( i++, pack );
+  make_transaction( i,  500U,  8.0, "E", "Y" ); insert( i++, pack );
+  make_transaction( i,  500U,  7.0, "F", "" );  insert( i++, pack );
+  make_transaction( i,  500U,  6.0, "A", "" );  insert( i++, pack ); /* conflicts with the first one */
+
+  ulong         bank_tile[ 3 ] = { 2UL, 0UL, 3UL };
+  fd_txn_p_t  * out      [ 3 ] = { outcome.results, outcome.results+2UL, outcome.results+4UL };
+  ulong         out_cnt  [ 3 ];
+
+  /* Each microblock holds two transactions, so the six that don't
+     conflict get split over the three bank tiles. */
+  FD_TEST( fd_pack_schedule_next_microblocks( pack, 30000UL, 0.0f, bank_tile, 3UL, out, out_cnt )==6UL );
+  FD_TEST( fd_pack_avail_txn_cnt( pack )==2UL );
+
+  aset_t r[ 3 ], w[ 3 ];
+  for( ulong b=0UL; b<3UL; b++ ) {
+    FD_TEST( out_cnt[ b ]==2UL );
+    microblock_accts( out[ b ], out_cnt[ b ], r+b, w+b );
+    FD_TEST( aset_is_null( aset_intersect( r[ b ], w[ b ] ) ) );
+    FD_TEST( !aset_test( w[ b ], 'Z'-0x30UL ) );
+  }
+  for( ulong b0=0UL; b0<3UL; b0++ ) for( ulong b1=0UL; b1<3UL; b1++ ) {
+    if( b0==b1 ) continue;
+    FD_TEST( aset_is_null( aset_intersect( w[ b0 ], aset_union( r[ b1 ], w[ b1 ] ) ) ) );
+  }
+
+  /* Nothing else fits while those are outstanding.  A bank tile with an
+     outstanding microblock can't take part. */
+  FD_TEST( fd_pack_schedule_next_microblock( pack, 30000UL, 0.0f, 1UL, outcome.results )==0UL );
+
+  /* Once they complete, the two remaining ones don't conflict with each
+     other but do with the first microblocks, so they go together. */
+  for( ulong b=0UL; b<3UL; b++ ) FD_TEST( fd_pack_microblock_complete( pack, bank_tile[ b ] ) );
+  FD_TEST( fd_pack_schedule_next_microblocks( pack, 30000UL, 0.0f, bank_tile, 3UL, out, out_cnt )==2UL );
+  FD_TEST( out_cnt[ 0 ]+out_cnt[ 1 ]+out_cnt[ 2 ]==2UL );
+  FD_TEST( fd_pack_avail_txn_cnt( pack )==0UL );
+
+  if( extra_verify ) FD_TEST( !fd_pack_verify( pack, pack_verify_scratch ) );
+}
+
 /* The original two that broke my first algorithm */
 void test1( void ) {
   FD_LOG_NOTICE(( "TEST 1" ));
@@ -1158,6 +1234,7 @@ main( int     argc,
   test0();
   test1();
   test2();
+  test_multi_bank();
   test_vote();
   heap_overflow_test();
   test_delete();
@@ -1,4 +1,10 @@
 $(call add-hdrs,fd_poh.h)
 $(call add-objs,fd_poh,fd_ballet)
+ifdef FD_HAS_AVX
+$(call add-objs,fd_poh_batch_avx,fd_ballet)
+endif
+ifdef FD_HAS_AVX512
+$(call add-objs,fd_poh_batch_avx512,fd_ballet)
+endif
 $(call make-unit-test,test_poh,test_poh,fd_ballet fd_util)
 $(call run-unit-test,test_poh)
@@ -19,3 +19,16 @@ fd_poh_mixin( void *        FD_RESTRICT poh,
   fd_sha256_fini( &sha, poh );
   return poh;
 }
+
+void
+fd_poh_append_batch( void * const * poh,
+                     ulong const *  n,
+                     ulong          cnt ) {
+# if FD_HAS_AVX512
+  fd_poh_private_append_batch_avx512( poh, n, cnt );
+# elif FD_HAS_AVX
+  fd_poh_private_append_batch_avx( poh, n, cnt );
+# else
+  for( ulong i=0UL; i<cnt; i++ ) fd_poh_append( poh[ i ], n[ i ] );
+# endif
+}
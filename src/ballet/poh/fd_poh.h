@@ -29,6 +29,41 @@ void *
 fd_poh_mixin( void *        FD_RESTRICT poh,
               uchar const * FD_RESTRICT mixin );
 
+/* fd_poh_append_batch performs n[i] recursive hash operations on each
+   of the cnt independent PoH states poh[i] (i in [0,cnt)).  Equivalent
+   to calling fd_poh_append( poh[i], n[i] ) for each i, but advances up
+   to FD_POH_BATCH_MAX chains at a time in SIMD lanes.  Chains are fed
+   into lanes as other chains finish, so the n[i] need not be similar.
+   Throughput improves with cnt (e.g. when verifying all the microblocks
+   of a block at once).  The poh[i] must not overlap. */
+
+void
+fd_poh_append_batch( void * const * poh,
+                     ulong const *  n,
+                     ulong          cnt );
+
+#if FD_HAS_AVX512
+#define FD_POH_BATCH_MAX (16UL)
+#elif FD_HAS_AVX
+#define FD_POH_BATCH_MAX (8UL)
+#else
+#define FD_POH_BATCH_MAX (1UL)
+#endif
+
+#if FD_HAS_AVX
+void
+fd_poh_private_append_batch_avx( void * const * poh,
+                                 ulong const *  n,
+                                 ulong          cnt );
+#endif
+
+#if FD_HAS_AVX512
+void
+fd_poh_private_append_batch_avx512( void * const * poh,
+                                    ulong const *  n,
+                                    ulong          cnt );
+#endif
+
 FD_PROTOTYPES_END
 
 #endif /* HEADER_fd_src_ballet_poh_fd_poh_h */
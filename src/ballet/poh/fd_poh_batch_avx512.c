@@ -0,0 +1,204 @@
+#include "fd_poh.h"
+#include "../../util/simd/fd_avx512.h"
+
+/* LANE_CNT is the number of PoH chains advanced in parallel. */
+
+#define LANE_CNT (16UL)
+
+/* If few lanes are busy, it's faster to advance the remaining chains
+   sequentially.  When we have SHA-NI instructions, the sequential
+   implementation is faster, so we need more busy lanes to justify
+   using the batched implementation. */
+
+#if FD_HAS_SHANI
+#define MIN_LANE_CNT (5UL)
+#else
+#define MIN_LANE_CNT (2UL)
+#endif
+
+void
+fd_poh_private_append_batch_avx512( void * const * poh,
+                                 ulong const *  n,
+                                 ulong          cnt ) {
+
+  if( FD_UNLIKELY( cnt<MIN_LANE_CNT ) ) {
+    for( ulong i=0UL; i<cnt; i++ ) fd_poh_append( poh[ i ], n[ i ] );
+    return;
+  }
+
+  /* The PoH state of each lane is kept as the SHA-256 state words
+     (i.e. the hash output as big endian uints), transposed such that
+     st[k] holds word k of all lanes.  Since a PoH state is exactly 32
+     bytes, the message block of the next hash is the state followed by
+     constant padding.  Thus, no transposes are needed between hashes,
+     only when a chain is fed into or drained from a lane. */
+
+  uint  st [ 8 ][ LANE_CNT ] __attribute__((aligned(64))) = {{0}};
+  ulong rem[ LANE_CNT ];  /* hashes left in lane (0 if idle) */
+  ulong idx[ LANE_CNT ];  /* chain in lane */
+
+  ulong next     = 0UL;   /* next chain to feed */
+  ulong busy_cnt = 0UL;   /* number of lanes with rem>0 */
+
+# define FEED( lane ) do {                                                                              \
+    while( next<cnt && !n[ next ] ) next++;                                                             \
+    rem[ lane ] = 0UL;                                                                                  \
+    if( next<cnt ) {                                                                                    \
+      uchar const * _p = (uchar const *)poh[ next ];                                                    \
+      for( ulong _k=0UL; _k<8UL; _k++ ) st[ _k ][ lane ] = fd_uint_bswap( FD_LOAD( uint, _p+4UL*_k ) ); \
+      rem[ lane ] = n[ next ];                                                                          \
+      idx[ lane ] = next++;                                                                             \
+      busy_cnt++;                                                                                       \
+    }                                                                                                   \
+  } while(0)
+
+# define DRAIN( lane ) do {                                                                           \
+    uchar * _p = (uchar *)poh[ idx[ lane ] ];                                                         \
+    for( ulong _k=0UL; _k<8UL; _k++ ) FD_STORE( uint, _p+4UL*_k, fd_uint_bswap( st[ _k ][ lane ] ) ); \
+  } while(0)
+
+  for( ulong lane=0UL; lane<LANE_CNT; lane++ ) FEED( lane );
+
+  static uint const K[64] = { /* FIXME: Reuse with other functions */
+    0x428a2f98U, 0x71374491U, 0xb5c0fbcfU, 0xe9b5dba5U, 0x3956c25bU, 0x59f111f1U, 0x923f82a4U, 0xab1c5ed5U,
+    0xd807aa98U, 0x12835b01U, 0x243185beU, 0x550c7dc3U, 0x72be5d74U, 0x80deb1feU, 0x9bdc06a7U, 0xc19bf174U,
+    0xe49b69c1U, 0xefbe4786U, 0x0fc19dc6U, 0x240ca1ccU, 0x2de92c6fU, 0x4a7484aaU, 0x5cb0a9dcU, 0x76f988daU,
+    0x983e5152U, 0xa831c66dU, 0xb00327c8U, 0xbf597fc7U, 0xc6e00bf3U, 0xd5a79147U, 0x06ca6351U, 0x14292967U,
+    0x27b70a85U, 0x2e1b2138U, 0x4d2c6dfcU, 0x53380d13U, 0x650a7354U, 0x766a0abbU, 0x81c2c92eU, 0x92722c85U,
+    0xa2bfe8a1U, 0xa81a664bU, 0xc24b8b70U, 0xc76c51a3U, 0xd192e819U, 0xd6990624U, 0xf40e3585U, 0x106aa070U,
+    0x19a4c116U, 0x1e376c08U, 0x2748774cU, 0x34b0bcb5U, 0x391c0cb3U, 0x4ed8aa4aU, 0x5b9cca4fU, 0x682e6ff3U,
+    0x748f82eeU, 0x78a5636fU, 0x84c87814U, 0x8cc70208U, 0x90befffaU, 0xa4506cebU, 0xbef9a3f7U, 0xc67178f2U,
+  };
+
+  wwu_t const iv0 = wwu_bcast( 0x6a09e667U );
+  wwu_t const iv1 = wwu_bcast( 0xbb67ae85U );
+  wwu_t const iv2 = wwu_bcast( 0x3c6ef372U );
+  wwu_t const iv3 = wwu_bcast( 0xa54ff53aU );
+  wwu_t const iv4 = wwu_bcast( 0x510e527fU );
+  wwu_t const iv5 = wwu_bcast( 0x9b05688cU );
+  wwu_t const iv6 = wwu_bcast( 0x1f83d9abU );
+  wwu_t const iv7 = wwu_bcast( 0x5be0cd19U );
+
+  for(;;) {
+
+    /* Once there are no more chains to feed, finish up sequentially if
+       too few lanes are busy. */
+
+    while( next<cnt && !n[ next ] ) next++;
+    if( FD_UNLIKELY( next>=cnt && busy_cnt<MIN_LANE_CNT ) ) break;
+
+    /* Advance all lanes until the next busy lane finishes its chain.
+       Idle lanes hash garbage that is ignored. */
+
+    ulong step = ULONG_MAX;
+    for( ulong lane=0UL; lane<LANE_CNT; lane++ ) if( rem[ lane ] ) step = fd_ulong_min( step, rem[ lane ] );
+
+    wwu_t s0 = wwu_ld( st[0] ); wwu_t s1 = wwu_ld( st[1] ); wwu_t s2 = wwu_ld( st[2] ); wwu_t s3 = wwu_ld( st[3] );
+    wwu_t s4 = wwu_ld( st[4] ); wwu_t s5 = wwu_ld( st[5] ); wwu_t s6 = wwu_ld( st[6] ); wwu_t s7 = wwu_ld( st[7] );
+
+    for( ulong iter=step; iter; iter-- ) {
+
+      /* Message block: previous state, 0x80 terminator, zero padding
+         and the message size (256 bits). */
+
+      wwu_t x0 = s0; wwu_t x1 = s1; wwu_t x2 = s2; wwu_t x3 = s3; wwu_t x4 = s4; wwu_t x5 = s5; wwu_t x6 = s6; wwu_t x7 = s7;
+      wwu_t x8 = wwu_bcast( 0x80000000U );
+      wwu_t x9 = wwu_zero(); wwu_t xa = wwu_zero(); wwu_t xb = wwu_zero(); wwu_t xc = wwu_zero(); wwu_t xd = wwu_zero(); wwu_t xe = wwu_zero();
+      wwu_t xf = wwu_bcast( 256U );
+
+      wwu_t a = iv0; wwu_t b = iv1; wwu_t c = iv2; wwu_t d = iv3; wwu_t e = iv4; wwu_t f = iv5; wwu_t g = iv6; wwu_t h = iv7;
+
+#     define Sigma0(x)  wwu_xor( wwu_rol(x,30), wwu_xor( wwu_rol(x,19), wwu_rol(x,10) ) )
+#     define Sigma1(x)  wwu_xor( wwu_rol(x,26), wwu_xor( wwu_rol(x,21), wwu_rol(x, 7) ) )
+#     define sigma0(x)  wwu_xor( wwu_rol(x,25), wwu_xor( wwu_rol(x,14), wwu_shr(x, 3) ) )
+#     define sigma1(x)  wwu_xor( wwu_rol(x,15), wwu_xor( wwu_rol(x,13), wwu_shr(x,10) ) )
+#     define Ch(x,y,z)  wwu_xor( wwu_and(x,y), wwu_andnot(x,z) )
+#     define Maj(x,y,z) wwu_xor( wwu_and(x,y), wwu_xor( wwu_and(x,z), wwu_and(y,z) ) )
+#     define SHA_CORE(xi,ki)                                                           \
+      T1 = wwu_add( wwu_add(xi,ki), wwu_add( wwu_add( h, Sigma1(e) ), Ch(e, f, g) ) ); \
+      T2 = wwu_add( Sigma0(a), Maj(a, b, c) );                                         \
+      h = g;                                                                           \
+      g = f;                                                                           \
+      f = e;                                                                           \
+      e = wwu_add( d, T1 );                                                            \
+      d = c;                                                                           \
+      c = b;                                                                           \
+      b = a;                                                                           \
+      a = wwu_add( T1, T2 )
+
+      wwu_t T1;
+      wwu_t T2;
+
+      SHA_CORE( x0, wwu_bcast( K[ 0] ) );
+      SHA_CORE( x1, wwu_bcast( K[ 1] ) );
+      SHA_CORE( x2, wwu_bcast( K[ 2] ) );
+      SHA_CORE( x3, wwu_bcast( K[ 3] ) );
+      SHA_CORE( x4, wwu_bcast( K[ 4] ) );
+      SHA_CORE( x5, wwu_bcast( K[ 5] ) );
+      SHA_CORE( x6, wwu_bcast( K[ 6] ) );
+      SHA_CORE( x7, wwu_bcast( K[ 7] ) );
+      SHA_CORE( x8, wwu_bcast( K[ 8] ) );
+      SHA_CORE( x9, wwu_bcast( K[ 9] ) );
+      SHA_CORE( xa, wwu_bcast( K[10] ) );
+      SHA_CORE( xb, wwu_bcast( K[11] ) );
+      SHA_CORE( xc, wwu_bcast( K[12] ) );
+      SHA_CORE( xd, wwu_bcast( K[13] ) );
+      SHA_CORE( xe, wwu_bcast( K[14] ) );
+      SHA_CORE( xf, wwu_bcast( K[15] ) );
+      for( ulong i=16UL; i<64UL; i+=16UL ) {
+        x0 = wwu_add( wwu_add( x0, sigma0(x1) ), wwu_add( sigma1(xe), x9 ) ); SHA_CORE( x0, wwu_bcast( K[i     ] ) );
+        x1 = wwu_add( wwu_add( x1, sigma0(x2) ), wwu_add( sigma1(xf), xa ) ); SHA_CORE( x1, wwu_bcast( K[i+ 1UL] ) );
+        x2 = wwu_add( wwu_add( x2, sigma0(x3) ), wwu_add( sigma1(x0), xb ) ); SHA_CORE( x2, wwu_bcast( K[i+ 2UL] ) );
+        x3 = wwu_add( wwu_add( x3, sigma0(x4) ), wwu_add( sigma1(x1), xc ) ); SHA_CORE( x3, wwu_bcast( K[i+ 3UL] ) );
+        x4 = wwu_add( wwu_add( x4, sigma0(x5) ), wwu_add( sigma1(x2), xd ) ); SHA_CORE( x4, wwu_bcast( K[i+ 4UL] ) );
+        x5 = wwu_add( wwu_add( x5, sigma0(x6) ), wwu_add( sigma1(x3), xe ) ); SHA_CORE( x5, wwu_bcast( K[i+ 5UL] ) );
+        x6 = wwu_add( wwu_add( x6, sigma0(x7) ), wwu_add( sigma1(x4), xf ) ); SHA_CORE( x6, wwu_bcast( K[i+ 6UL] ) );
+        x7 = wwu_add( wwu_add( x7, sigma0(x8) ), wwu_add( sigma1(x5), x0 ) ); SHA_CORE( x7, wwu_bcast( K[i+ 7UL] ) );
+        x8 = wwu_add( wwu_add( x8, sigma0(x9) ), wwu_add( sigma1(x6), x1 ) ); SHA_CORE( x8, wwu_bcast( K[i+ 8UL] ) );
+        x9 = wwu_add( wwu_add( x9, sigma0(xa) ), wwu_add( sigma1(x7), x2 ) ); SHA_CORE( x9, wwu_bcast( K[i+ 9UL] ) );
+        xa = wwu_add( wwu_add( xa, sigma0(xb) ), wwu_add( sigma1(x8), x3 ) ); SHA_CORE( xa, wwu_bcast( K[i+10UL] ) );
+        xb = wwu_add( wwu_add( xb, sigma0(xc) ), wwu_add( sigma1(x9), x4 ) ); SHA_CORE( xb, wwu_bcast( K[i+11UL] ) );
+        xc = wwu_add( wwu_add( xc, sigma0(xd) ), wwu_add( sigma1(xa), x5 ) ); SHA_CORE( xc, wwu_bcast( K[i+12UL] ) );
+        xd = wwu_add( wwu_add( xd, sigma0(xe) ), wwu_add( sigma1(xb), x6 ) ); SHA_CORE( xd, wwu_bcast( K[i+13UL] ) );
+        xe = wwu_add( wwu_add( xe, sigma0(xf) ), wwu_add( sigma1(xc), x7 ) ); SHA_CORE( xe, wwu_bcast( K[i+14UL] ) );
+        xf = wwu_add( wwu_add( xf, sigma0(x0) ), wwu_add( sigma1(xd), x8 ) ); SHA_CORE( xf, wwu_bcast( K[i+15UL] ) );
+      }
+
+#     undef SHA_CORE
+#     undef Sigma0
+#     undef Sigma1
+#     undef sigma0
+#     undef sigma1
+#     undef Ch
+#     undef Maj
+
+      s0 = wwu_add( iv0, a ); s1 = wwu_add( iv1, b ); s2 = wwu_add( iv2, c ); s3 = wwu_add( iv3, d );
+      s4 = wwu_add( iv4, e ); s5 = wwu_add( iv5, f ); s6 = wwu_add( iv6, g ); s7 = wwu_add( iv7, h );
+    }
+
+    wwu_st( st[0], s0 ); wwu_st( st[1], s1 ); wwu_st( st[2], s2 ); wwu_st( st[3], s3 );
+    wwu_st( st[4], s4 ); wwu_st( st[5], s5 ); wwu_st( st[6], s6 ); wwu_st( st[7], s7 );
+
+    /* Drain finished chains and refill their lanes */
+
+    for( ulong lane=0UL; lane<LANE_CNT; lane++ ) {
+      if( !rem[ lane ] ) continue;
+      rem[ lane ] -= step;
+      if( rem[ lane ] ) continue;
+      DRAIN( lane );
+      busy_cnt--;
+      FEED( lane );
+    }
+  }
+
+  /* Finish the remaining chains sequentially */
+
+  for( ulong lane=0UL; lane<LANE_CNT; lane++ ) {
+    if( !rem[ lane ] ) continue;
+    DRAIN( lane );
+    fd_poh_append( poh[ idx[ lane ] ], rem[ lane ] );
+  }
+
+# undef DRAIN
+# undef FEED
+}
@@ -189,6 +189,65 @@ bench_poh_sequential( void ) {
   FD_LOG_NOTICE(( "PoH sequential: ~%.3f MH/s", ((double)hashes/secs)/1e6 ));
 }
 
+/* Ensure that fd_poh_append_batch matches fd_poh_append for batches of
+   various sizes, including chains with zero iterations and chains of
+   very different lengths. */
+static void
+test_poh_append_batch( fd_rng_t * rng ) {
+# define CHAIN_MAX (64UL)
+  uchar  poh [ CHAIN_MAX ][ FD_SHA256_HASH_SZ ];
+  uchar  want[ CHAIN_MAX ][ FD_SHA256_HASH_SZ ];
+  void * ptr [ CHAIN_MAX ];
+  ulong  n   [ CHAIN_MAX ];
+
+  for( ulong iter=0UL; iter<256UL; iter++ ) {
+    ulong cnt = fd_rng_ulong_roll( rng, CHAIN_MAX+1UL );
+    for( ulong i=0UL; i<cnt; i++ ) {
+      for( ulong j=0UL; j<FD_SHA256_HASH_SZ; j++ ) poh[ i ][ j ] = fd_rng_uchar( rng );
+      switch( fd_rng_uint_roll( rng, 4U ) ) {
+      case 0U: n[ i ] = 0UL;                                    break;
+      case 1U: n[ i ] = 1UL;                                    break;
+      case 2U: n[ i ] = fd_rng_ulong_roll( rng, 64UL );         break;
+      default: n[ i ] = fd_rng_ulong_roll( rng, 4096UL );       break;
+      }
+      memcpy( want[ i ], poh[ i ], FD_SHA256_HASH_SZ );
+      fd_poh_append( want[ i ], n[ i ] );
+      ptr[ i ] = poh[ i ];
+    }
+
+    fd_poh_append_batch( ptr, n, cnt );
+
+    for( ulong i=0UL; i<cnt; i++ ) FD_TEST( !memcmp( poh[ i ], want[ i ], FD_SHA256_HASH_SZ ) );
+  }
+# undef CHAIN_MAX
+}
+
+static void
+bench_poh_batch( void ) {
+# define CHAIN_CNT (64UL)
+  uchar  poh[ CHAIN_CNT ][ FD_SHA256_HASH_SZ ] = {{0}};
+  void * ptr[ CHAIN_CNT ];
+  ulong  n  [ CHAIN_CNT ];
+  for( ulong i=0UL; i<CHAIN_CNT; i++ ) { ptr[ i ] = poh[ i ]; n[ i ] = 1024UL; }
+
+  /* warmup */
+  ulong iter = 10UL;
+  long dt = fd_log_wallclock();
+  for( ulong rem=iter; rem; rem-- ) fd_poh_append_batch( ptr, n, CHAIN_CNT );
+  dt = fd_log_wallclock() - dt;
+
+  /* for real */
+  iter = 1000UL;
+  dt = fd_log_wallclock();
+  for( ulong rem=iter; rem; rem-- ) fd_poh_append_batch( ptr, n, CHAIN_CNT );
+  dt = fd_log_wallclock() - dt;
+
+  ulong hashes = iter*CHAIN_CNT*1024UL;
+  double secs = (double)dt / 1e9;
+  FD_LOG_NOTICE(( "PoH batch (%lu lanes): ~%.3f MH/s", FD_POH_BATCH_MAX, ((double)hashes/secs)/1e6 ));
+# undef CHAIN_CNT
+}
+
 int main( int argc,
           char ** argv ) {
   fd_boot( &argc, &argv );
@@ -202,7 +261,12 @@ int main( int argc,
     test_poh_vector( v );
   }
 
+  fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 0U, 0UL ) );
+  test_poh_append_batch( rng );
+  fd_rng_delete( fd_rng_leave( rng ) );
+
   bench_poh_sequential();
+  bench_poh_batch();
 
   FD_LOG_NOTICE(( "pass" ));
   fd_halt();
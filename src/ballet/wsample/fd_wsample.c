@@ -572,6 +572,65 @@ fd_wsample_sample_many( fd_wsample_t * sampler,
   for( ulong i=0UL; i<cnt; i++ ) idxs[i] = fd_wsample_sample( sampler );
 }
 
+void
+fd_wsample_sample_many_seeded( fd_wsample_t * sampler,
+                               uchar const  * seeds,
+                               ulong        * idxs,
+                               ulong          cnt   ) {
+  if( FD_UNLIKELY( !sampler->unremoved_weight ) ) { for( ulong i=0UL; i<cnt; i++ ) idxs[ i ] = FD_WSAMPLE_EMPTY;         return; }
+  if( FD_UNLIKELY(  sampler->poisoned_mode    ) ) { for( ulong i=0UL; i<cnt; i++ ) idxs[ i ] = FD_WSAMPLE_INDETERMINATE; return; }
+
+  tree_ele_t const * tree = sampler->tree;
+
+  /* Process in chunks small enough that the per sample state stays in
+     L1.  Within a chunk, every level of the tree is visited once for
+     all samples, which turns the dependent loads of each descent into
+     many independent ones. */
+# define CHUNK 64UL
+  ulong query [ CHUNK ];
+  ulong cursor[ CHUNK ];
+
+  for( ulong i0=0UL; i0<cnt; i0+=CHUNK ) {
+    ulong chunk_cnt = fd_ulong_min( cnt-i0, CHUNK );
+
+    fd_chacha20rng_ulong_roll_batch( sampler->rng, seeds+32UL*i0, chunk_cnt,
+                                     sampler->unremoved_weight+sampler->poisoned_weight, query );
+
+    /* Samples that land in the poisoned region descend with query 0
+       (their result is discarded below). */
+    for( ulong j=0UL; j<chunk_cnt; j++ ) {
+      cursor[ j ] = 0UL;
+      query [ j ] = fd_ulong_if( query[ j ]<sampler->unremoved_weight, query[ j ], ULONG_MAX );
+    }
+
+    for( ulong h=0UL; h<sampler->height; h++ ) {
+      for( ulong j=0UL; j<chunk_cnt; j++ ) {
+        tree_ele_t const * e = tree+cursor[ j ];
+        ulong x = fd_ulong_if( query[ j ]==ULONG_MAX, 0UL, query[ j ] );
+        ulong child_idx = 0UL;
+
+#if FD_HAS_AVX512 && R==9
+        __mmask8 mask = _mm512_cmple_epu64_mask( wwv_ld( e->left_sum ), wwv_bcast( x ) );
+        child_idx = (ulong)fd_uchar_popcnt( mask );
+#else
+        for( ulong i=0UL; i<R-1UL; i++ ) child_idx += (ulong)(e->left_sum[ i ]<=x);
+#endif
+
+        /* left_sum[ -1 ] is in bounds thanks to the dummy element (see
+           fd_wsample_map_sample_i) and discarded when child_idx==0. */
+        ulong lm1 = fd_ulong_if( child_idx>0UL, e->left_sum[ child_idx-1UL ], 0UL );
+        query [ j ] = fd_ulong_if( query[ j ]==ULONG_MAX, ULONG_MAX, x-lm1 );
+        cursor[ j ] = R*cursor[ j ] + child_idx + 1UL;
+      }
+    }
+
+    for( ulong j=0UL; j<chunk_cnt; j++ ) {
+      idxs[ i0+j ] = fd_ulong_if( query[ j ]==ULONG_MAX, FD_WSAMPLE_INDETERMINATE, cursor[ j ] - sampler->internal_node_cnt );
+    }
+  }
+# undef CHUNK
+}
+
 void
 fd_wsample_sample_and_remove_many( fd_wsample_t * sampler,
                                    ulong        * idxs,
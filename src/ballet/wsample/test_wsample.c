@@ -463,6 +463,47 @@ test_poison( void ) {
   fd_chacha20rng_delete( fd_chacha20rng_leave( rng ) );
 }
 
+static void
+test_many_seeded( void ) {
+  fd_chacha20rng_t _rng[1];
+  fd_chacha20rng_t * rng = fd_chacha20rng_join( fd_chacha20rng_new( _rng, FD_CHACHA20RNG_MODE_SHIFT ) );
+
+  static uchar seeds[ 150UL*32UL ];
+  ulong idxs[ 150UL ];
+  for( ulong i=0UL; i<sizeof(seeds); i++ ) seeds[ i ] = (uchar)fd_ulong_hash( i );
+
+  ulong const sizes[ 6 ] = { 1UL, 8UL, 9UL, 10UL, 82UL, MAX };
+  for( ulong s=0UL; s<6UL; s++ ) {
+    ulong sz = sizes[ s ];
+    for( ulong poison=0UL; poison<2UL; poison++ ) {
+      void * partial = fd_wsample_new_init( _shmem, rng, sz, 1, FD_WSAMPLE_HINT_POWERLAW_NOREMOVE );
+      for( ulong i=0UL; i<sz; i++ ) partial = fd_wsample_new_add( partial, 1000000UL/(i+1UL) );
+      fd_wsample_t * tree = fd_wsample_join( fd_wsample_new_fini( partial, poison*1000000UL/(sz+1UL) ) );
+
+      for( ulong rm=0UL; rm<2UL; rm++ ) {
+        if( rm ) fd_wsample_remove_idx( tree, 0UL );
+        for( ulong cnt=0UL; cnt<=150UL; cnt+=25UL ) {
+          fd_wsample_sample_many_seeded( tree, seeds, idxs, cnt );
+          for( ulong i=0UL; i<cnt; i++ ) {
+            fd_wsample_seed_rng( rng, seeds+32UL*i );
+            FD_TEST( idxs[ i ]==fd_wsample_sample( tree ) );
+          }
+        }
+      }
+
+      /* Everything removed */
+      if( sz==1UL ) {
+        fd_wsample_sample_many_seeded( tree, seeds, idxs, 10UL );
+        for( ulong i=0UL; i<10UL; i++ ) FD_TEST( idxs[ i ]==FD_WSAMPLE_EMPTY );
+      }
+
+      fd_wsample_delete( fd_wsample_leave( tree ) );
+    }
+  }
+
+  fd_chacha20rng_delete( fd_chacha20rng_leave( rng ) );
+}
+
 int
 main( int     argc,
       char ** argv ) {
@@ -479,6 +520,7 @@ main( int     argc,
   test_empty();
   test_footprint();
   test_poison();
+  test_many_seeded();
 
   test_probability_dist_replacement();
   test_probability_dist_noreplacement();
@@ -26,6 +26,14 @@ fd_zstd_peek( fd_zstd_peek_t * peek,
   return peek;
 }
 
+ulong
+fd_zstd_frame_sz( void const * buf,
+                  ulong        bufsz ) {
+  ulong const sz = ZSTD_findFrameCompressedSize( buf, bufsz );
+  if( FD_UNLIKELY( ZSTD_isError( sz ) ) ) return 0UL;
+  return sz;
+}
+
 ulong
 fd_zstd_dstream_align( void ) {
   return FD_ZSTD_DSTREAM_ALIGN;
@@ -135,3 +143,88 @@ fd_zstd_dstream_read( fd_zstd_dstream_t *     dstream,
   *out_p = (void *      )((ulong)out_start + out_buf.pos);
   return rc==0UL ? -1 /* frame complete */ : 0 /* still working */;
 }
+
+ulong
+fd_zstd_cstream_align( void ) {
+  return FD_ZSTD_CSTREAM_ALIGN;
+}
+
+ulong
+fd_zstd_cstream_footprint( int level ) {
+  return offsetof(fd_zstd_cstream_t, mem) + ZSTD_estimateCCtxSize( level );
+}
+
+ulong
+fd_zstd_cstream_window_sz( int level ) {
+  /* Frames of unknown or large content size use the largest window of
+     the level, smaller frames use a window no larger than that. */
+  return 1UL<<ZSTD_getCParams( level, ZSTD_CONTENTSIZE_UNKNOWN, 0UL ).windowLog;
+}
+
+fd_zstd_cstream_t *
+fd_zstd_cstream_new( void * mem,
+                     int    level ) {
+  fd_zstd_cstream_t * cstream = mem;
+  cstream->mem_sz = ZSTD_estimateCCtxSize( level );
+  cstream->level  = level;
+
+  ZSTD_CCtx * ctx = ZSTD_initStaticCCtx( cstream->mem, cstream->mem_sz );
+  if( FD_UNLIKELY( !ctx ) ) {
+    /* should never happen */
+    FD_LOG_WARNING(( "ZSTD_initStaticCCtx failed (level=%d)", level ));
+    return NULL;
+  }
+  if( FD_UNLIKELY( (ulong)ctx != (ulong)cstream->mem ) )
+    FD_LOG_CRIT(( "ZSTD_initStaticCCtx returned unexpected pointer (ctx=%p, mem=%p)",
+                  (void *)ctx, (void *)cstream->mem ));
+
+  FD_COMPILER_MFENCE();
+  cstream->magic = FD_ZSTD_CSTREAM_MAGIC;
+  FD_COMPILER_MFENCE();
+  return cstream;
+}
+
+static ZSTD_CCtx *
+fd_zstd_cstream_ctx( fd_zstd_cstream_t * cstream ) {
+  if( FD_UNLIKELY( cstream->magic != FD_ZSTD_CSTREAM_MAGIC ) )
+    FD_LOG_CRIT(( "fd_zstd_cstream_t at %p has invalid magic (memory corruption?)", (void *)cstream ));
+  return (ZSTD_CCtx *)fd_type_pun( cstream->mem );
+}
+
+void *
+fd_zstd_cstream_delete( fd_zstd_cstream_t * cstream ) {
+
+  if( FD_UNLIKELY( !cstream ) ) return NULL;
+
+  if( FD_UNLIKELY( cstream->magic != FD_ZSTD_CSTREAM_MAGIC ) )
+      FD_LOG_CRIT(( "fd_zstd_cstream_t at %p has invalid magic (memory corruption?)", (void *)cstream ));
+
+  /* No need to inform libzstd */
+
+  FD_COMPILER_MFENCE();
+  cstream->magic  = 0UL;
+  cstream->mem_sz = 0UL;
+  FD_COMPILER_MFENCE();
+
+  return (void *)cstream;
+}
+
+ulong
+fd_zstd_cstream_compress( fd_zstd_cstream_t * cstream,
+                          void *              dst,
+                          ulong               dst_max,
+                          void const *        src,
+                          ulong               src_sz,
+                          ulong *             opt_errcode ) {
+
+  ulong _opt_errcode[1];
+  opt_errcode = opt_errcode ? opt_errcode : _opt_errcode;
+
+  ZSTD_CCtx * ctx = fd_zstd_cstream_ctx( cstream );
+  ulong const sz = ZSTD_compressCCtx( ctx, dst, dst_max, src, src_sz, cstream->level );
+  if( FD_UNLIKELY( ZSTD_isError( sz ) ) ) {
+    *opt_errcode = sz;
+    return 0UL;
+  }
+  return sz;
+}
@@ -88,6 +88,18 @@ fd_zstd_peek( fd_zstd_peek_t * peek,
               void const *     buf,
               ulong            bufsz );
 
+/* fd_zstd_frame_sz returns the compressed size of the frame (including
+   skippable frames) that starts at buf.  [buf,buf+bufsz) must span at
+   least the entire frame.  Only the frame and block headers are read,
+   no data is decompressed.  Useful to locate the frame boundaries of a
+   multi-frame stream without decompressing it (such that the frames
+   can be decompressed independently).  Returns 0UL on failure.
+   Reasons for failure include insufficient bufsz or decode error. */
+
+ulong
+fd_zstd_frame_sz( void const * buf,
+                  ulong        bufsz );
+
 /* fd_zstd_dstream_{align,footprint} return the parameters of the
    memory region backing a fd_zstd_dstream_t.  max_window_sz is the
    largest window size that this object is able to handle. */
@@ -154,7 +166,72 @@ fd_zstd_dstream_read( fd_zstd_dstream_t *     dstream,
                       uchar *                 out_end,
                       ulong *                 opt_errcode );
 
-/* TODO: Migrate compression logic from fd_snapshot_create. to fd_zstd.h */
+FD_PROTOTYPES_END
+
+/* Compress API *******************************************************/
+
+/* fd_zstd_cstream_t provides compression of Zstandard frames at a fixed
+   compression level.  Currently only supports compressing an entire
+   frame at once.
+
+   TODO: Migrate streaming compression logic from fd_snapshot_create to
+         fd_zstd.h */
+
+struct fd_zstd_cstream;
+typedef struct fd_zstd_cstream fd_zstd_cstream_t;
+
+FD_PROTOTYPES_BEGIN
+
+/* fd_zstd_cstream_{align,footprint} return the parameters of the
+   memory region backing a fd_zstd_cstream_t.  level is the compression
+   level (as in libzstd). */
+
+FD_FN_CONST ulong
+fd_zstd_cstream_align( void );
+
+ulong
+fd_zstd_cstream_footprint( int level );
+
+/* fd_zstd_cstream_window_sz returns the largest window size of frames
+   compressed at the given level.  Useful to size a fd_zstd_dstream_t
+   that decompresses them. */
+
+ulong
+fd_zstd_cstream_window_sz( int level );
+
+/* fd_zstd_cstream_new creates a new cstream object backed by the memory
+   region at mem.  mem matches align/footprint requirements for the
+   given level.  Returns a handle to the newly created cstream object on
+   success (not just a simple cast of mem).  On failure, returns NULL. */
+
+fd_zstd_cstream_t *
+fd_zstd_cstream_new( void * mem,
+                     int    level );
+
+/* fd_zstd_cstream_delete destroys the cstream object and releases its
+   memory region back to the caller.  Returns pointer to memory region
+   on success (same as provided in call to new).  Acts as a no-op if
+   cstream==NULL. */
+
+void *
+fd_zstd_cstream_delete( fd_zstd_cstream_t * cstream );
+
+/* fd_zstd_cstream_compress compresses the src_sz bytes at src into a
+   single frame at dst (with dst_max bytes of capacity).  The frame
+   header records the content size.  Returns the frame size on success.
+   On failure, returns 0UL.  Reasons for failure include the frame not
+   fitting in dst_max bytes (e.g. because the data is incompressible).
+   If opt_errcode!=NULL and an error occured, *opt_errcode is set
+   accordingly.  The cstream can be reused for the next frame
+   regardless. */
+
+ulong
+fd_zstd_cstream_compress( fd_zstd_cstream_t * cstream,
+                          void *              dst,
+                          ulong               dst_max,
+                          void const *        src,
+                          ulong               src_sz,
+                          ulong *             opt_errcode );
 
 FD_PROTOTYPES_END
 
@@ -15,3 +15,19 @@ struct __attribute__((aligned(FD_ZSTD_DSTREAM_ALIGN))) fd_zstd_dstream {
 
   __extension__ uchar mem[0];
 };
+
+#define FD_ZSTD_CSTREAM_MAGIC (0x6b1ab0b1e4c0a5e3UL)  /* random */
+
+struct __attribute__((aligned(FD_ZSTD_CSTREAM_ALIGN))) fd_zstd_cstream {
+  /* This point is 64-byte aligned */
+
+  ulong magic;
+  ulong mem_sz;
+  int   level;
+
+  uchar pad[44];
+
+  /* This point is 64-byte aligned */
+
+  __extension__ uchar mem[0];
+};
@@ -12,6 +12,8 @@
 
 FD_STATIC_ASSERT( alignof ( fd_zstd_dstream_t      )==FD_ZSTD_DSTREAM_ALIGN, layout );
 FD_STATIC_ASSERT( offsetof( fd_zstd_dstream_t, mem )==FD_ZSTD_DSTREAM_ALIGN, layout );
+FD_STATIC_ASSERT( alignof ( fd_zstd_cstream_t      )==FD_ZSTD_CSTREAM_ALIGN, layout );
+FD_STATIC_ASSERT( offsetof( fd_zstd_cstream_t, mem )==FD_ZSTD_CSTREAM_ALIGN, layout );
 
 /* Test vectors */
 
@@ -130,6 +132,73 @@ test_decompress( void ) {
   FD_TEST( dstream->magic==0UL );
 }
 
+static void
+test_compress( void ) {
+  FD_TEST( fd_zstd_cstream_align()==FD_ZSTD_CSTREAM_ALIGN );
+
+  int   level  = 1;
+  ulong mem_sz = fd_zstd_cstream_footprint( level );
+  static uchar cmem[ 1UL<<22 ] __attribute__((aligned(FD_ZSTD_CSTREAM_ALIGN)));
+  FD_TEST( mem_sz<=sizeof(cmem) );
+
+  fd_zstd_cstream_t * cstream = fd_zstd_cstream_new( cmem, level );
+  FD_TEST( cstream );
+  FD_TEST( cstream->magic==FD_ZSTD_CSTREAM_MAGIC );
+  FD_TEST( cstream->mem_sz + sizeof(fd_zstd_cstream_t) == mem_sz );
+
+  ulong window_sz = fd_zstd_cstream_window_sz( level );
+  FD_TEST( fd_ulong_is_pow2( window_sz ) );
+  static uchar dmem[ 1UL<<22 ] __attribute__((aligned(64)));
+  FD_TEST( fd_zstd_dstream_footprint( window_sz )<=sizeof(dmem) );
+  fd_zstd_dstream_t * dstream = fd_zstd_dstream_new( dmem, window_sz );
+  FD_TEST( dstream );
+
+  /* Compressible data spanning several windows, round tripped through
+     the same cstream more than once */
+
+  static uchar src[ 3UL<<20 ];
+  static uchar frame[ 3UL<<20 ];
+  static uchar out[ 3UL<<20 ];
+  fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 1234U, 0UL ) );
+  for( ulong i=0UL; i<sizeof(src); i++ ) src[i] = (uchar)( fd_rng_uint_roll( rng, 16U ) + 'a' );
+
+  ulong src_szs[3] = { 1UL, 4096UL, sizeof(src) };
+  for( ulong k=0UL; k<6UL; k++ ) {
+    ulong src_sz   = src_szs[ k%3UL ];
+    ulong frame_sz = fd_zstd_cstream_compress( cstream, frame, sizeof(frame), src, src_sz, NULL );
+    FD_TEST( frame_sz );
+    FD_TEST( fd_zstd_frame_sz( frame, frame_sz )==frame_sz );
+    if( src_sz>4096UL ) FD_TEST( frame_sz<src_sz );
+
+    fd_zstd_peek_t peek[1] = {0};
+    FD_TEST( fd_zstd_peek( peek, frame, frame_sz )==peek );
+    FD_TEST( peek->frame_content_sz==src_sz );
+    FD_TEST( peek->window_sz<=window_sz );
+
+    uchar const * in_cur  = frame;
+    uchar *       out_cur = out;
+    int rc = 0;
+    while( !rc ) rc = fd_zstd_dstream_read( dstream, &in_cur, frame+frame_sz, &out_cur, out+sizeof(out), NULL );
+    FD_TEST( rc==-1 );
+    FD_TEST( in_cur ==frame+frame_sz );
+    FD_TEST( out_cur==out+src_sz );
+    FD_TEST( 0==memcmp( out, src, src_sz ) );
+  }
+
+  /* Frames that do not fit fail gracefully */
+
+  for( ulong i=0UL; i<sizeof(src); i++ ) src[i] = (uchar)fd_rng_uint( rng );
+  ulong errcode = 0UL;
+  FD_TEST( fd_zstd_cstream_compress( cstream, frame, 4096UL, src, 8192UL, &errcode )==0UL );
+  FD_TEST( errcode );
+  FD_TEST( fd_zstd_cstream_compress( cstream, frame, sizeof(frame), src, 8192UL, NULL ) );
+
+  fd_rng_delete( fd_rng_leave( rng ) );
+  FD_TEST( fd_zstd_dstream_delete( dstream )==dmem );
+  FD_TEST( fd_zstd_cstream_delete( cstream )==cmem );
+  FD_TEST( cstream->magic==0UL );
+}
+
 #define ZSTD_STATIC_LINKING_ONLY
 #include <zstd.h>
 
@@ -150,7 +219,19 @@ main( int     argc,
              ( _peek->frame_content_sz   == ULONG_MAX  ) );
   }
 
+  /* Locate frame boundaries of a multi-frame stream */
+
+  uchar stream[ sizeof(test_zstd_comp_0)+sizeof(test_zstd_comp_1) ];
+  fd_memcpy( stream,                            test_zstd_comp_0, sizeof(test_zstd_comp_0) );
+  fd_memcpy( stream+sizeof(test_zstd_comp_0), test_zstd_comp_1, sizeof(test_zstd_comp_1) );
+  FD_TEST( fd_zstd_frame_sz( stream, sizeof(stream) )==sizeof(test_zstd_comp_0) );
+  FD_TEST( fd_zstd_frame_sz( stream+sizeof(test_zstd_comp_0), sizeof(test_zstd_comp_1) )==sizeof(test_zstd_comp_1) );
+  for( ulong j=0UL; j<sizeof(test_zstd_comp_0); j++ )
+    FD_TEST( fd_zstd_frame_sz( stream, j )==0UL );
+  FD_TEST( fd_zstd_frame_sz( stream+1, sizeof(stream)-1UL )==0UL );
+
   test_decompress();
+  test_compress();
 
   for( int lvl=0; lvl<20; lvl++ ) {
     FD_LOG_INFO(( "ZSTD_estimateCCtxSize(%d) = %lu", lvl, ZSTD_estimateCCtxSize( lvl ) ));
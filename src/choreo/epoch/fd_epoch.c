@@ -31,9 +31,13 @@ fd_epoch_new( void * shmem, ulong voter_max ) {
   FD_SCRATCH_ALLOC_INIT( l, shmem );
   fd_epoch_t * epoch  = FD_SCRATCH_ALLOC_APPEND( l, fd_epoch_align(), sizeof(fd_epoch_t) );
   void * epoch_voters = FD_SCRATCH_ALLOC_APPEND( l, fd_epoch_voters_align(),  fd_epoch_voters_footprint( lg_slot_cnt ) );
+  void * epoch_towers = FD_SCRATCH_ALLOC_APPEND( l, alignof(fd_epoch_tower_t), voter_max*sizeof(fd_epoch_tower_t) );
   FD_TEST( FD_SCRATCH_ALLOC_FINI( l, fd_epoch_align() ) == (ulong)shmem + footprint );
 
   epoch->voters_gaddr = fd_wksp_gaddr_fast( wksp, fd_epoch_voters_join( fd_epoch_voters_new( epoch_voters, lg_slot_cnt ) ) );
+  epoch->towers_gaddr = fd_wksp_gaddr_fast( wksp, epoch_towers );
+  epoch->voter_max    = voter_max;
+  epoch->tower_cnt    = 0UL;
 
   epoch->epoch_gaddr = fd_wksp_gaddr_fast( wksp, epoch );
   epoch->total_stake = 0UL;
@@ -108,6 +112,7 @@ fd_epoch_init( fd_epoch_t * epoch, fd_epoch_bank_t const * epoch_bank ) {
   epoch->last_slot  = epoch_bank->eah_stop_slot;
 
   fd_voter_t *               epoch_voters  = fd_epoch_voters( epoch );
+  fd_epoch_tower_t *         epoch_towers  = fd_epoch_towers( epoch );
   fd_vote_accounts_t const * vote_accounts = &epoch_bank->stakes.vote_accounts;
 
   for( fd_vote_accounts_pair_t_mapnode_t * curr = fd_vote_accounts_pair_t_map_minimum(
@@ -123,6 +128,10 @@ fd_epoch_init( fd_epoch_t * epoch, fd_epoch_bank_t const * epoch_bank ) {
       FD_TEST( fd_epoch_voters_key_cnt( epoch_voters ) < fd_epoch_voters_key_max( epoch_voters ) );
       #endif
 
+      if( FD_UNLIKELY( epoch->tower_cnt >= epoch->voter_max ) ) {
+        FD_LOG_ERR(( "[%s] too many voters (voter_max %lu)", __func__, epoch->voter_max ));
+      }
+
       fd_voter_t * voter = fd_epoch_voters_insert( epoch_voters, curr->elem.key );
       voter->rec.c[FD_FUNK_REC_KEY_FOOTPRINT - 1] = FD_FUNK_KEY_TYPE_ACC;
 
@@ -136,13 +145,56 @@ fd_epoch_init( fd_epoch_t * epoch, fd_epoch_bank_t const * epoch_bank ) {
       voter->replay_vote = FD_SLOT_NULL;
       voter->gossip_vote = FD_SLOT_NULL;
       voter->rooted_vote = FD_SLOT_NULL;
+
+      voter->idx = epoch->tower_cnt++;
+      epoch_towers[voter->idx].stake = curr->elem.stake;
+      epoch_towers[voter->idx].cnt   = 0UL;
     }
     epoch->total_stake += curr->elem.stake;
   }
 }
 
+void
+fd_epoch_tower_update( fd_epoch_t *             epoch,
+                       fd_voter_t const *       voter,
+                       fd_voter_state_t const * state ) {
+  #if FD_EPOCH_USE_HANDHOLDING
+  FD_TEST( voter->idx < epoch->tower_cnt );
+  #endif
+
+  fd_epoch_tower_t * tower = fd_epoch_towers( epoch ) + voter->idx;
+  if( FD_UNLIKELY( !state ) ) {
+    tower->cnt = 0UL;
+    return;
+  }
+
+  ulong cnt = fd_voter_state_cnt( state );
+  #if FD_EPOCH_USE_HANDHOLDING
+  FD_TEST( cnt <= FD_EPOCH_TOWER_VOTE_MAX );
+  #endif
+
+  for( ulong i = 0; i < cnt; i++ ) {
+    ulong slot;
+    ulong conf;
+    if( FD_UNLIKELY( state->discriminant == FD_VOTER_STATE_V0_23_5 ) ) {
+      slot = state->v0_23_5.votes[i].slot;
+      conf = state->v0_23_5.votes[i].conf;
+    } else if( FD_UNLIKELY( state->discriminant == FD_VOTER_STATE_V1_14_11 ) ) {
+      slot = state->v1_14_11.votes[i].slot;
+      conf = state->v1_14_11.votes[i].conf;
+    } else {
+      slot = state->votes[i].slot;
+      conf = state->votes[i].conf;
+    }
+    tower->slot[i] = slot;
+    tower->exp[i]  = slot + ( 1UL << fd_ulong_min( conf, 63UL ) );
+  }
+  tower->cnt = cnt;
+}
+
 void
 fd_epoch_fini( fd_epoch_t * epoch ) {
   fd_epoch_voters_clear( fd_epoch_voters( epoch ) );
   epoch->total_stake = 0UL;
+  epoch->tower_cnt   = 0UL;
 }
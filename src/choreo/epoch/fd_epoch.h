@@ -13,6 +13,26 @@
 
 #define FD_EPOCH_MAGIC (0xf17eda2ce7e90c40UL) /* firedancer epoch version 0 */
 
+/* FD_EPOCH_TOWER_VOTE_MAX is the max number of votes in a voter's
+   tower (same as FD_TOWER_VOTE_MAX). */
+
+#define FD_EPOCH_TOWER_VOTE_MAX (31UL)
+
+/* fd_epoch_tower_t is a compact copy of a voter's tower (as stored in
+   its vote account) cached by fd_epoch, so that tower checks can pass
+   over every voter without querying funk and decoding vote accounts.
+   Votes are ordered from lowest to highest vote slot.  exp[i] is the
+   expiration slot of vote i ie. slot[i] + 2^conf.  The tower is empty
+   (cnt==0) until the voter's vote account has been read. */
+
+struct fd_epoch_tower {
+  ulong stake;                            /* voter's stake */
+  ulong cnt;                              /* number of votes in tower */
+  ulong slot[ FD_EPOCH_TOWER_VOTE_MAX ];  /* vote slots */
+  ulong exp [ FD_EPOCH_TOWER_VOTE_MAX ];  /* vote expiration slots */
+};
+typedef struct fd_epoch_tower fd_epoch_tower_t;
+
 struct __attribute__((aligned(128UL))) fd_epoch {
   ulong magic;       /* ==FD_EPOCH_MAGIC */
   ulong epoch_gaddr; /* wksp gaddr of this in the backing wksp, non-zero gaddr */
@@ -25,6 +45,14 @@ struct __attribute__((aligned(128UL))) fd_epoch {
      account address). */
 
   ulong voters_gaddr;
+
+  /* towers_gaddr is the global address of an array of voter_max
+     fd_epoch_tower_t, of which the first tower_cnt are in use.  The
+     cached tower of a voter is at index voter->idx. */
+
+  ulong voter_max;
+  ulong tower_cnt;
+  ulong towers_gaddr;
 };
 typedef struct fd_epoch fd_epoch_t;
 
@@ -51,11 +79,13 @@ FD_FN_CONST static inline ulong
 fd_epoch_footprint( ulong voter_max ) {
   int lg_slot_cnt = fd_ulong_find_msb( fd_ulong_pow2_up( voter_max ) ) + 2; /* fill ratio <= 0.25 */
   return FD_LAYOUT_FINI(
+    FD_LAYOUT_APPEND(
     FD_LAYOUT_APPEND(
     FD_LAYOUT_APPEND(
     FD_LAYOUT_INIT,
-      alignof(fd_epoch_t),     sizeof(fd_epoch_t) ),
-      fd_epoch_voters_align(), fd_epoch_voters_footprint( lg_slot_cnt ) ),
+      alignof(fd_epoch_t),       sizeof(fd_epoch_t) ),
+      fd_epoch_voters_align(),   fd_epoch_voters_footprint( lg_slot_cnt ) ),
+      alignof(fd_epoch_tower_t), voter_max*sizeof(fd_epoch_tower_t) ),
     fd_epoch_align() );
 }
 
@@ -99,6 +129,18 @@ fd_epoch_delete( void * epoch );
 void
 fd_epoch_init( fd_epoch_t * epoch, fd_epoch_bank_t const * epoch_bank );
 
+/* fd_epoch_tower_update refreshes the cached tower of `voter` from its
+   vote account `state` (NULL if the vote account does not exist, in
+   which case the cached tower is emptied).  Assumes epoch is a valid
+   local join and voter is a voter in epoch.  This is called for every
+   voter as part of fd_forks_update, so the cache always reflects the
+   vote accounts as of the most recently replayed slot. */
+
+void
+fd_epoch_tower_update( fd_epoch_t *             epoch,
+                       fd_voter_t const *       voter,
+                       fd_voter_state_t const * state );
+
 /* fd_epoch_fini finishes an epoch.  Assumes epoch is a valid local join
    and epoch has already been initialized.  This should only be called
    once at the end of an epoch. */
@@ -126,4 +168,17 @@ fd_epoch_voters_const( fd_epoch_t const * epoch ) {
   return fd_wksp_laddr_fast( fd_epoch_wksp( epoch ), epoch->voters_gaddr );
 }
 
+/* fd_epoch_towers{,_const} return the cached voter towers, indexed by
+   voter->idx.  The number of towers is epoch->tower_cnt. */
+
+FD_FN_PURE static inline fd_epoch_tower_t *
+fd_epoch_towers( fd_epoch_t * epoch ) {
+  return fd_wksp_laddr_fast( fd_epoch_wksp( epoch ), epoch->towers_gaddr );
+}
+
+FD_FN_PURE static inline fd_epoch_tower_t const *
+fd_epoch_towers_const( fd_epoch_t const * epoch ) {
+  return fd_wksp_laddr_fast( fd_epoch_wksp( epoch ), epoch->towers_gaddr );
+}
+
 #endif /* HEADER_fd_src_choreo_epoch_fd_epoch_h */
@@ -350,6 +350,10 @@ fd_forks_update( fd_forks_t *      forks,
     fd_voter_t *             voter = &epoch_voters[i];
     fd_voter_state_t const * state = fd_voter_state( funk, txn, &voter->rec );
 
+    /* Refresh the voter's cached tower (used by the tower checks). */
+
+    fd_epoch_tower_update( epoch, voter, state );
+
     /* Only process votes for slots >= root. Ghost requires vote slot
         to already exist in the ghost tree. */
 
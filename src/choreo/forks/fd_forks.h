@@ -157,8 +157,9 @@ fd_forks_prepare( fd_forks_t const *    forks,
                   fd_funk_t *           funk,
                   fd_valloc_t           valloc );
 
-/* fd_forks_update updates `blockstore` and `ghost` with the latest
-   state resulting from replaying `slot`.  Assumes `slot` is a fork head
+/* fd_forks_update updates `blockstore`, `ghost` and the voter towers
+   cached in `epoch` with the latest state resulting from replaying
+   `slot`.  Assumes `slot` is a fork head
    in the frontier.  In general, this should be called immediately after
    `slot` has been replayed. */
 
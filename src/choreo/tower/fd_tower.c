@@ -6,6 +6,8 @@
 #define SHALLOW_THRESHOLD_PCT   (0.38)
 #define SWITCH_PCT              (0.38)
 
+FD_STATIC_ASSERT( FD_EPOCH_TOWER_VOTE_MAX==FD_TOWER_VOTE_MAX, FD_EPOCH_TOWER_VOTE_MAX );
+
 void *
 fd_tower_new( void * shmem ) {
   if( FD_UNLIKELY( !shmem ) ) {
@@ -197,11 +199,9 @@ fd_tower_switch_check( fd_tower_t const * tower,
 }
 
 int
-fd_tower_threshold_check( fd_tower_t const *    tower,
-                          fd_epoch_t const *    epoch,
-                          fd_funk_t *           funk,
-                          fd_funk_txn_t const * txn,
-                          ulong                 slot ) {
+fd_tower_threshold_check( fd_tower_t const * tower,
+                          fd_epoch_t const * epoch,
+                          ulong              slot ) {
 
   /* First, simulate a vote, popping off everything that would be
      expired by voting for the current slot. */
@@ -224,49 +224,34 @@ fd_tower_threshold_check( fd_tower_t const *    tower,
 
   ulong threshold_stake = 0;
 
-  /* Iterate all the vote accounts. */
-
-  fd_voter_t const * epoch_voters = fd_epoch_voters_const( epoch );
-  for (ulong i = 0; i < fd_epoch_voters_slot_cnt( epoch_voters ); i++ ) {
-    if( FD_LIKELY( fd_epoch_voters_key_inval( epoch_voters[i].key ) ) ) continue /* most slots are empty */;
-
-    fd_voter_t const * voter = &epoch_voters[i];
-
-    /* Convert the landed_votes into tower's vote_slots interface. */
-    FD_SCRATCH_SCOPE_BEGIN {
-      void * mem = fd_scratch_alloc( fd_tower_align(), fd_tower_footprint() );
-      fd_tower_t * voter_tower = fd_tower_join( fd_tower_new( mem ) );
-      fd_tower_from_vote_acc( voter_tower, funk, txn, &voter->rec );
-
-      /* If this voter has not voted, continue. */
-
-      if( FD_UNLIKELY( fd_tower_votes_empty( voter_tower ) ) ) continue;
-
-      ulong cnt = simulate_vote( voter_tower, slot );
-
-      /* Continue if their tower is empty after simulating. */
+  /* Iterate all the voters' cached towers (refreshed from their vote
+     accounts by fd_forks_update). */
 
-      if( FD_UNLIKELY( !cnt ) ) continue;
+  fd_epoch_tower_t const * towers    = fd_epoch_towers_const( epoch );
+  ulong                    tower_cnt = epoch->tower_cnt;
+  for( ulong i = 0; i < tower_cnt; i++ ) {
+    fd_epoch_tower_t const * voter_tower = &towers[i];
 
-      /* Get their latest vote. */
+    /* Simulate their vote, popping all the expired votes at the top of
+       their tower (same as simulate_vote).  If this voter has not voted
+       or their tower is empty after simulating, continue. */
 
-      fd_tower_vote_t const * vote = fd_tower_votes_peek_index( voter_tower, cnt - 1 );
+    ulong cnt = voter_tower->cnt;
+    while( cnt && voter_tower->exp[cnt - 1] < slot ) cnt--;
+    if( FD_UNLIKELY( !cnt ) ) continue;
 
-      /* Count their stake towards the threshold check if their latest
-         vote slot >= our threshold slot.
+    /* Count their stake towards the threshold check if their latest
+       vote slot >= our threshold slot.
 
-         Because we are iterating vote accounts on the same fork that we
-         we want to vote for, we know these slots must all occur along
-         the same fork ancestry.
+       Because we are iterating vote accounts on the same fork that we
+       we want to vote for, we know these slots must all occur along
+       the same fork ancestry.
 
-         Therefore, if their latest vote slot >= our threshold slot, we
-         know that vote must be for the threshold slot itself or one of
-         threshold slot's descendants. */
+       Therefore, if their latest vote slot >= our threshold slot, we
+       know that vote must be for the threshold slot itself or one of
+       threshold slot's descendants. */
 
-      if( FD_LIKELY( vote->slot >= threshold_slot ) ) {
-        threshold_stake += voter->stake;
-      }
-    } FD_SCRATCH_SCOPE_END;
+    threshold_stake += fd_ulong_if( voter_tower->slot[cnt - 1] >= threshold_slot, voter_tower->stake, 0UL );
   }
 
   double threshold_pct = (double)threshold_stake / (double)epoch->total_stake;
@@ -313,11 +298,9 @@ fd_tower_reset_slot( fd_tower_t const * tower,
 }
 
 ulong
-fd_tower_vote_slot( fd_tower_t *          tower,
-                    fd_epoch_t const *    epoch,
-                    fd_funk_t *           funk,
-                    fd_funk_txn_t const * txn,
-                    fd_ghost_t const *    ghost ) {
+fd_tower_vote_slot( fd_tower_t *       tower,
+                    fd_epoch_t const * epoch,
+                    fd_ghost_t const * ghost ) {
 
   fd_tower_vote_t const * vote = fd_tower_votes_peek_tail_const( tower );
   fd_ghost_node_t const * root = fd_ghost_root( ghost );
@@ -344,7 +327,7 @@ fd_tower_vote_slot( fd_tower_t *          tower,
     /* The ghost head is on the same fork as our last vote slot, so we
        can vote fork it as long as we pass the threshold check. */
 
-    if( FD_LIKELY( fd_tower_threshold_check( tower, epoch, funk, txn, head->slot ) ) ) {
+    if( FD_LIKELY( fd_tower_threshold_check( tower, epoch, head->slot ) ) ) {
       FD_LOG_DEBUG(( "[%s] success (threshold). best: %lu. vote: (slot: %lu conf: %lu)", __func__, head->slot, vote->slot, vote->conf ));
       return head->slot;
     }
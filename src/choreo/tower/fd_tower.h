@@ -647,14 +647,16 @@ fd_tower_switch_check( fd_tower_t const * tower,
 
    The threshold check simulates voting for the current slot to expire
    stale votes.  This is to prevent validators that haven't voted in a
-   long time from counting towards the threshold stake. */
+   long time from counting towards the threshold stake.
+
+   The validators' towers are read from the tower cache in `epoch`, so
+   this does not query funk.  Assumes the cache was refreshed (via
+   fd_forks_update) for the fork containing `slot`. */
 
 int
-fd_tower_threshold_check( fd_tower_t const *    tower,
-                          fd_epoch_t const *    epoch,
-                          fd_funk_t *           funk,
-                          fd_funk_txn_t const * txn,
-                          ulong                 slot );
+fd_tower_threshold_check( fd_tower_t const * tower,
+                          fd_epoch_t const * epoch,
+                          ulong              slot );
 
 /* fd_tower_reset_slot returns the slot to reset PoH to when building
    the next leader block.  Assumes tower and ghost are both valid local
@@ -695,14 +697,15 @@ fd_tower_reset_slot( fd_tower_t const * tower,
       we pass the threshold check.
    2. the ghost head is on a different fork than our last vote slot,
       but we pass both the lockout and switch checks so we can
-      switch to the ghost head's fork. */
+      switch to the ghost head's fork.
+
+   Assumes the voter towers cached in `epoch` are up-to-date with the
+   most recently replayed slot (see fd_tower_threshold_check). */
 
 ulong
-fd_tower_vote_slot( fd_tower_t *          tower,
-                    fd_epoch_t const *    epoch,
-                    fd_funk_t *           funk,
-                    fd_funk_txn_t const * txn,
-                    fd_ghost_t const *    ghost );
+fd_tower_vote_slot( fd_tower_t *       tower,
+                    fd_epoch_t const * epoch,
+                    fd_ghost_t const * ghost );
 
 /* fd_tower_simulate_vote simulates a vote on the vote tower for slot,
    returning the new height (cnt) for all the votes that would have been
@@ -81,10 +81,103 @@ test_tower_vote( void ) {
   fd_tower_delete( fd_tower_leave( tower ) );
 }
 
+/* voter_state_init formats `state` as a current-version vote state
+   whose tower is the result of voting for slots [lo,hi) in order. */
+
+static void
+voter_state_init( fd_voter_state_t * state, ulong lo, ulong hi ) {
+  memset( state, 0, sizeof(fd_voter_state_t) );
+  state->discriminant = FD_VOTER_STATE_CURRENT;
+  state->meta.cnt     = hi - lo;
+  for( ulong slot = lo; slot < hi; slot++ ) {
+    state->votes[slot - lo].slot = slot;
+    state->votes[slot - lo].conf = (uint)( hi - slot );
+  }
+}
+
+void
+test_tower_threshold_check( fd_wksp_t * wksp ) {
+  void * epoch_mem = fd_wksp_alloc_laddr( wksp, fd_epoch_align(), fd_epoch_footprint( 4 ), 1UL );
+  fd_epoch_t * epoch = fd_epoch_join( fd_epoch_new( epoch_mem, 4 ) );
+  FD_TEST( epoch );
+
+  /* Voters A and B have 100 stake each and C has 50 stake. */
+
+  fd_voter_t *       voters[3];
+  ulong              stakes[3] = { 100, 100, 50 };
+  fd_epoch_tower_t * towers    = fd_epoch_towers( epoch );
+  for( ulong i = 0; i < 3; i++ ) {
+    fd_pubkey_t key = { .ul = { i + 1 } };
+    voters[i]        = fd_epoch_voters_insert( fd_epoch_voters( epoch ), key );
+    voters[i]->stake = stakes[i];
+    voters[i]->idx   = epoch->tower_cnt++;
+    towers[voters[i]->idx].stake = stakes[i];
+    towers[voters[i]->idx].cnt   = 0;
+    epoch->total_stake += stakes[i];
+  }
+
+  /* Our tower is 10 votes deep (slots 0 to 9), so voting for slot 10
+     requires threshold stake on slot 2. */
+
+  fd_tower_t * tower = fd_tower_join( fd_tower_new( scratch ) );
+  for( ulong slot = 0; slot < 10; slot++ ) fd_tower_vote( tower, slot );
+
+  /* No voter towers cached yet. */
+
+  FD_TEST( !fd_tower_threshold_check( tower, epoch, 10 ) );
+
+  /* A and B voted the same as us: 200 / 250 stake. */
+
+  fd_voter_state_t state[1];
+  voter_state_init( state, 0, 10 );
+  fd_epoch_tower_update( epoch, voters[0], state );
+  fd_epoch_tower_update( epoch, voters[1], state );
+  FD_TEST( towers[voters[0]->idx].cnt == 10 );
+  FD_TEST( towers[voters[0]->idx].slot[9] == 9 );
+  FD_TEST( towers[voters[0]->idx].exp[9]  == 11 );
+  FD_TEST( towers[voters[0]->idx].exp[0]  == 0 + (1UL << 10) );
+  FD_TEST( fd_tower_threshold_check( tower, epoch, 10 ) );
+
+  /* B's only vote expires when simulating a vote for slot 10: 100 /
+     250 stake. */
+
+  voter_state_init( state, 1, 2 );
+  fd_epoch_tower_update( epoch, voters[1], state );
+  FD_TEST( !fd_tower_threshold_check( tower, epoch, 10 ) );
+
+  /* B's vote account is missing: still 100 / 250 stake. */
+
+  fd_epoch_tower_update( epoch, voters[1], NULL );
+  FD_TEST( towers[voters[1]->idx].cnt == 0 );
+  FD_TEST( !fd_tower_threshold_check( tower, epoch, 10 ) );
+
+  /* B voted for a descendant of the threshold slot: 200 / 250 stake. */
+
+  voter_state_init( state, 5, 8 );
+  fd_epoch_tower_update( epoch, voters[1], state );
+  FD_TEST( fd_tower_threshold_check( tower, epoch, 10 ) );
+
+  fd_tower_delete( fd_tower_leave( tower ) );
+  fd_wksp_free_laddr( fd_epoch_delete( fd_epoch_leave( epoch ) ) );
+}
+
 int
 main( int argc, char ** argv ) {
   fd_boot( &argc, &argv );
+
+  char const * _page_sz = fd_env_strip_cmdline_cstr ( &argc, &argv, "--page-sz",  NULL, "gigantic" );
+  ulong        page_cnt = fd_env_strip_cmdline_ulong( &argc, &argv, "--page-cnt", NULL, 1UL        );
+  fd_wksp_t *  wksp     = fd_wksp_new_anonymous( fd_cstr_to_shmem_page_sz( _page_sz ),
+                                                 page_cnt,
+                                                 fd_shmem_cpu_idx( fd_shmem_numa_idx( 0 ) ),
+                                                 "wksp",
+                                                 0UL );
+  FD_TEST( wksp );
+
   test_tower_vote();
+  test_tower_threshold_check( wksp );
+
+  fd_wksp_delete_anonymous( wksp );
   fd_halt();
   return 0;
 }
@@ -43,6 +43,7 @@ struct fd_voter {
   ulong replay_vote; /* cached read of last tower vote via replay */
   ulong gossip_vote; /* cached read of last tower vote via gossip */
   ulong rooted_vote; /* cached read of last tower root via replay */
+  ulong idx;         /* index of voter's cached tower in fd_epoch */
 };
 typedef struct fd_voter fd_voter_t;
 
@@ -74,6 +74,15 @@ FD_FN_CONST static inline ulong fd_disco_netmux_sig_hash  ( ulong sig ) { return
 FD_FN_CONST static inline ulong fd_disco_netmux_sig_proto ( ulong sig ) { return (sig>>48UL) & 0xFFUL; }
 FD_FN_CONST static inline uint  fd_disco_netmux_sig_dst_ip( ulong sig ) { return (uint)((sig>>12UL) & 0xFFFFFFFFUL); }
 
+/* fd_disco_netmux_sig_set_hash returns sig with the hash field replaced
+   by the low 8 bits of hash.  Used to steer a frag to a specific
+   consumer of a round robin link. */
+FD_FN_CONST static inline ulong
+fd_disco_netmux_sig_set_hash( ulong sig,
+                              ulong hash ) {
+  return (sig & ((1UL<<56UL)-1UL)) | ((hash&0xFFUL)<<56UL);
+}
+
 /* fd_disco_netmux_sig_hdr_sz extracts the total size of the Ethernet,
    IP, and UDP headers from the netmux signature field.  The UDP payload
    of the packet stored in the corresponding frag begins at the returned
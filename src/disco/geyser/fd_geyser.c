@@ -28,6 +28,7 @@ struct fd_geyser {
   fd_funk_t *          funk;
   fd_blockstore_t *    blockstore;
   int                  blockstore_fd;
+  fd_blockstore_codec_t * codec;
   fd_stake_ci_t *      stake_ci;
   replay_sham_link_t * rep_notify;
   stake_sham_link_t *  stake_notify;
@@ -49,6 +50,7 @@ fd_geyser_footprint( void ) {
   l = FD_LAYOUT_APPEND( l, fd_stake_ci_align(), fd_stake_ci_footprint() );
   l = FD_LAYOUT_APPEND( l, replay_sham_link_align(), replay_sham_link_footprint() );
   l = FD_LAYOUT_APPEND( l, stake_sham_link_align(), stake_sham_link_footprint() );
+  l = FD_LAYOUT_APPEND( l, fd_blockstore_codec_align(), fd_blockstore_codec_footprint( 0 ) );
   return FD_LAYOUT_FINI( l, 1UL );
 }
 
@@ -64,6 +66,7 @@ fd_geyser_new( void * mem, fd_geyser_args_t * args ) {
   void * stake_ci_mem = FD_SCRATCH_ALLOC_APPEND( l, fd_stake_ci_align(), fd_stake_ci_footprint() );
   void * rep_notify_mem = FD_SCRATCH_ALLOC_APPEND( l, replay_sham_link_align(), replay_sham_link_footprint() );
   void * stake_notify_mem = FD_SCRATCH_ALLOC_APPEND( l, stake_sham_link_align(), stake_sham_link_footprint() );
+  void * codec_mem = FD_SCRATCH_ALLOC_APPEND( l, fd_blockstore_codec_align(), fd_blockstore_codec_footprint( 0 ) );
   ulong scratch_top = FD_SCRATCH_ALLOC_FINI( l, 1UL );
   FD_TEST( scratch_top <= (ulong)mem + fd_geyser_footprint() );
 
@@ -86,6 +89,8 @@ fd_geyser_new( void * mem, fd_geyser_args_t * args ) {
     FD_LOG_ERR(( "failed to join a blockstore" ));
   }
   self->blockstore_fd = args->blockstore_fd;
+  self->codec = fd_blockstore_codec_new( codec_mem, 0 );
+  FD_TEST( self->codec );
   FD_LOG_NOTICE(( "blockstore has slot root=%lu", self->blockstore->smr ));
   fd_wksp_mprotect( wksp, 1 );
 
@@ -186,7 +191,7 @@ fd_geyser_replay_block( fd_geyser_t * ctx, ulong slotn ) {
       fd_hash_t parent_hash;
       uchar * blk_data;
       ulong blk_sz;
-      if( fd_blockstore_block_data_query_volatile( ctx->blockstore, ctx->blockstore_fd, slotn, fd_scratch_virtual(), &parent_hash, meta, rewards, &blk_data, &blk_sz ) ) {
+      if( fd_blockstore_block_data_query_volatile( ctx->blockstore, ctx->blockstore_fd, ctx->codec, slotn, fd_scratch_virtual(), &parent_hash, meta, rewards, &blk_data, &blk_sz ) ) {
         FD_LOG_WARNING(( "failed to retrieve block for slot %lu", slotn ));
         return;
       }
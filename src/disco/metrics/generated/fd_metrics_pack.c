@@ -8,6 +8,7 @@ const fd_metrics_meta_t FD_METRICS_PACK[FD_METRICS_PACK_TOTAL] = {
     DECLARE_METRIC_HISTOGRAM_SECONDS( PACK_COMPLETE_MICROBLOCK_DURATION_SECONDS ),
     DECLARE_METRIC_HISTOGRAM_NONE( PACK_TOTAL_TRANSACTIONS_PER_MICROBLOCK_COUNT ),
     DECLARE_METRIC_HISTOGRAM_NONE( PACK_VOTES_PER_MICROBLOCK_COUNT ),
+    DECLARE_METRIC_HISTOGRAM_NONE( PACK_MICROBLOCKS_PER_SCHEDULE_COUNT ),
     DECLARE_METRIC( PACK_NORMAL_TRANSACTION_RECEIVED, COUNTER ),
     DECLARE_METRIC_ENUM( PACK_TRANSACTION_INSERTED, COUNTER, PACK_TXN_INSERT_RETURN, BUNDLE_BLACKLIST ),
     DECLARE_METRIC_ENUM( PACK_TRANSACTION_INSERTED, COUNTER, PACK_TXN_INSERT_RETURN, WRITE_SYSVAR ),
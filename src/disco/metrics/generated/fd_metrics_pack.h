@@ -6,7 +6,7 @@
 #define FD_METRICS_HISTOGRAM_PACK_SCHEDULE_MICROBLOCK_DURATION_SECONDS_OFF  (16UL)
 #define FD_METRICS_HISTOGRAM_PACK_SCHEDULE_MICROBLOCK_DURATION_SECONDS_NAME "pack_schedule_microblock_duration_seconds"
 #define FD_METRICS_HISTOGRAM_PACK_SCHEDULE_MICROBLOCK_DURATION_SECONDS_TYPE (FD_METRICS_TYPE_HISTOGRAM)
-#define FD_METRICS_HISTOGRAM_PACK_SCHEDULE_MICROBLOCK_DURATION_SECONDS_DESC "Duration of scheduling one microblock"
+#define FD_METRICS_HISTOGRAM_PACK_SCHEDULE_MICROBLOCK_DURATION_SECONDS_DESC "Duration of one scheduling decision, which schedules a microblock for each idle bank tile"
 #define FD_METRICS_HISTOGRAM_PACK_SCHEDULE_MICROBLOCK_DURATION_SECONDS_CVT  (FD_METRICS_CONVERTER_SECONDS)
 #define FD_METRICS_HISTOGRAM_PACK_SCHEDULE_MICROBLOCK_DURATION_SECONDS_MIN  (1e-08)
 #define FD_METRICS_HISTOGRAM_PACK_SCHEDULE_MICROBLOCK_DURATION_SECONDS_MAX  (0.1)
@@ -51,147 +51,155 @@
 #define FD_METRICS_HISTOGRAM_PACK_VOTES_PER_MICROBLOCK_COUNT_MIN  (0UL)
 #define FD_METRICS_HISTOGRAM_PACK_VOTES_PER_MICROBLOCK_COUNT_MAX  (64UL)
 
-#define FD_METRICS_COUNTER_PACK_NORMAL_TRANSACTION_RECEIVED_OFF  (118UL)
+#define FD_METRICS_HISTOGRAM_PACK_MICROBLOCKS_PER_SCHEDULE_COUNT_OFF  (118UL)
+#define FD_METRICS_HISTOGRAM_PACK_MICROBLOCKS_PER_SCHEDULE_COUNT_NAME "pack_microblocks_per_schedule_count"
+#define FD_METRICS_HISTOGRAM_PACK_MICROBLOCKS_PER_SCHEDULE_COUNT_TYPE (FD_METRICS_TYPE_HISTOGRAM)
+#define FD_METRICS_HISTOGRAM_PACK_MICROBLOCKS_PER_SCHEDULE_COUNT_DESC "Count of non-empty microblocks scheduled by one scheduling decision, at most one per idle bank tile"
+#define FD_METRICS_HISTOGRAM_PACK_MICROBLOCKS_PER_SCHEDULE_COUNT_CVT  (FD_METRICS_CONVERTER_NONE)
+#define FD_METRICS_HISTOGRAM_PACK_MICROBLOCKS_PER_SCHEDULE_COUNT_MIN  (0UL)
+#define FD_METRICS_HISTOGRAM_PACK_MICROBLOCKS_PER_SCHEDULE_COUNT_MAX  (64UL)
+
+#define FD_METRICS_COUNTER_PACK_NORMAL_TRANSACTION_RECEIVED_OFF  (135UL)
 #define FD_METRICS_COUNTER_PACK_NORMAL_TRANSACTION_RECEIVED_NAME "pack_normal_transaction_received"
 #define FD_METRICS_COUNTER_PACK_NORMAL_TRANSACTION_RECEIVED_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_PACK_NORMAL_TRANSACTION_RECEIVED_DESC "Count of transactions received via the normal TPU path"
 #define FD_METRICS_COUNTER_PACK_NORMAL_TRANSACTION_RECEIVED_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_OFF  (119UL)
+#define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_OFF  (136UL)
 #define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_NAME "pack_transaction_inserted"
 #define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_DESC "Result of inserting a transaction into the pack object"
 #define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_CNT  (15UL)
 
-#define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_BUNDLE_BLACKLIST_OFF (119UL)
-#define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_WRITE_SYSVAR_OFF (120UL)
-#define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_ESTIMATION_FAIL_OFF (121UL)
-#define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_DUPLICATE_ACCOUNT_OFF (122UL)
-#define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_TOO_MANY_ACCOUNTS_OFF (123UL)
-#define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_TOO_LARGE_OFF (124UL)
-#define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_EXPIRED_OFF (125UL)
-#define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_ADDR_LUT_OFF (126UL)
-#define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_UNAFFORDABLE_OFF (127UL)
-#define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_DUPLICATE_OFF (128UL)
-#define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_PRIORITY_OFF (129UL)
-#define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_NONVOTE_ADD_OFF (130UL)
-#define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_VOTE_ADD_OFF (131UL)
-#define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_NONVOTE_REPLACE_OFF (132UL)
-#define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_VOTE_REPLACE_OFF (133UL)
-
-#define FD_METRICS_COUNTER_PACK_METRIC_TIMING_OFF  (134UL)
+#define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_BUNDLE_BLACKLIST_OFF (136UL)
+#define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_WRITE_SYSVAR_OFF (137UL)
+#define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_ESTIMATION_FAIL_OFF (138UL)
+#define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_DUPLICATE_ACCOUNT_OFF (139UL)
+#define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_TOO_MANY_ACCOUNTS_OFF (140UL)
+#define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_TOO_LARGE_OFF (141UL)
+#define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_EXPIRED_OFF (142UL)
+#define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_ADDR_LUT_OFF (143UL)
+#define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_UNAFFORDABLE_OFF (144UL)
+#define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_DUPLICATE_OFF (145UL)
+#define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_PRIORITY_OFF (146UL)
+#define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_NONVOTE_ADD_OFF (147UL)
+#define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_VOTE_ADD_OFF (148UL)
+#define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_NONVOTE_REPLACE_OFF (149UL)
+#define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_VOTE_REPLACE_OFF (150UL)
+
+#define FD_METRICS_COUNTER_PACK_METRIC_TIMING_OFF  (151UL)
 #define FD_METRICS_COUNTER_PACK_METRIC_TIMING_NAME "pack_metric_timing"
 #define FD_METRICS_COUNTER_PACK_METRIC_TIMING_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_PACK_METRIC_TIMING_DESC "Time in nanos spent in each state"
 #define FD_METRICS_COUNTER_PACK_METRIC_TIMING_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_PACK_METRIC_TIMING_CNT  (16UL)
 
-#define FD_METRICS_COUNTER_PACK_METRIC_TIMING_NO_TXN_NO_BANK_NO_LEADER_NO_MICROBLOCK_OFF (134UL)
-#define FD_METRICS_COUNTER_PACK_METRIC_TIMING_TXN_NO_BANK_NO_LEADER_NO_MICROBLOCK_OFF (135UL)
-#define FD_METRICS_COUNTER_PACK_METRIC_TIMING_NO_TXN_BANK_NO_LEADER_NO_MICROBLOCK_OFF (136UL)
-#define FD_METRICS_COUNTER_PACK_METRIC_TIMING_TXN_BANK_NO_LEADER_NO_MICROBLOCK_OFF (137UL)
-#define FD_METRICS_COUNTER_PACK_METRIC_TIMING_NO_TXN_NO_BANK_LEADER_NO_MICROBLOCK_OFF (138UL)
-#define FD_METRICS_COUNTER_PACK_METRIC_TIMING_TXN_NO_BANK_LEADER_NO_MICROBLOCK_OFF (139UL)
-#define FD_METRICS_COUNTER_PACK_METRIC_TIMING_NO_TXN_BANK_LEADER_NO_MICROBLOCK_OFF (140UL)
-#define FD_METRICS_COUNTER_PACK_METRIC_TIMING_TXN_BANK_LEADER_NO_MICROBLOCK_OFF (141UL)
-#define FD_METRICS_COUNTER_PACK_METRIC_TIMING_NO_TXN_NO_BANK_NO_LEADER_MICROBLOCK_OFF (142UL)
-#define FD_METRICS_COUNTER_PACK_METRIC_TIMING_TXN_NO_BANK_NO_LEADER_MICROBLOCK_OFF (143UL)
-#define FD_METRICS_COUNTER_PACK_METRIC_TIMING_NO_TXN_BANK_NO_LEADER_MICROBLOCK_OFF (144UL)
-#define FD_METRICS_COUNTER_PACK_METRIC_TIMING_TXN_BANK_NO_LEADER_MICROBLOCK_OFF (145UL)
-#define FD_METRICS_COUNTER_PACK_METRIC_TIMING_NO_TXN_NO_BANK_LEADER_MICROBLOCK_OFF (146UL)
-#define FD_METRICS_COUNTER_PACK_METRIC_TIMING_TXN_NO_BANK_LEADER_MICROBLOCK_OFF (147UL)
-#define FD_METRICS_COUNTER_PACK_METRIC_TIMING_NO_TXN_BANK_LEADER_MICROBLOCK_OFF (148UL)
-#define FD_METRICS_COUNTER_PACK_METRIC_TIMING_TXN_BANK_LEADER_MICROBLOCK_OFF (149UL)
-
-#define FD_METRICS_COUNTER_PACK_TRANSACTION_DROPPED_FROM_EXTRA_OFF  (150UL)
+#define FD_METRICS_COUNTER_PACK_METRIC_TIMING_NO_TXN_NO_BANK_NO_LEADER_NO_MICROBLOCK_OFF (151UL)
+#define FD_METRICS_COUNTER_PACK_METRIC_TIMING_TXN_NO_BANK_NO_LEADER_NO_MICROBLOCK_OFF (152UL)
+#define FD_METRICS_COUNTER_PACK_METRIC_TIMING_NO_TXN_BANK_NO_LEADER_NO_MICROBLOCK_OFF (153UL)
+#define FD_METRICS_COUNTER_PACK_METRIC_TIMING_TXN_BANK_NO_LEADER_NO_MICROBLOCK_OFF (154UL)
+#define FD_METRICS_COUNTER_PACK_METRIC_TIMING_NO_TXN_NO_BANK_LEADER_NO_MICROBLOCK_OFF (155UL)
+#define FD_METRICS_COUNTER_PACK_METRIC_TIMING_TXN_NO_BANK_LEADER_NO_MICROBLOCK_OFF (156UL)
+#define FD_METRICS_COUNTER_PACK_METRIC_TIMING_NO_TXN_BANK_LEADER_NO_MICROBLOCK_OFF (157UL)
+#define FD_METRICS_COUNTER_PACK_METRIC_TIMING_TXN_BANK_LEADER_NO_MICROBLOCK_OFF (158UL)
+#define FD_METRICS_COUNTER_PACK_METRIC_TIMING_NO_TXN_NO_BANK_NO_LEADER_MICROBLOCK_OFF (159UL)
+#define FD_METRICS_COUNTER_PACK_METRIC_TIMING_TXN_NO_BANK_NO_LEADER_MICROBLOCK_OFF (160UL)
+#define FD_METRICS_COUNTER_PACK_METRIC_TIMING_NO_TXN_BANK_NO_LEADER_MICROBLOCK_OFF (161UL)
+#define FD_METRICS_COUNTER_PACK_METRIC_TIMING_TXN_BANK_NO_LEADER_MICROBLOCK_OFF (162UL)
+#define FD_METRICS_COUNTER_PACK_METRIC_TIMING_NO_TXN_NO_BANK_LEADER_MICROBLOCK_OFF (163UL)
+#define FD_METRICS_COUNTER_PACK_METRIC_TIMING_TXN_NO_BANK_LEADER_MICROBLOCK_OFF (164UL)
+#define FD_METRICS_COUNTER_PACK_METRIC_TIMING_NO_TXN_BANK_LEADER_MICROBLOCK_OFF (165UL)
+#define FD_METRICS_COUNTER_PACK_METRIC_TIMING_TXN_BANK_LEADER_MICROBLOCK_OFF (166UL)
+
+#define FD_METRICS_COUNTER_PACK_TRANSACTION_DROPPED_FROM_EXTRA_OFF  (167UL)
 #define FD_METRICS_COUNTER_PACK_TRANSACTION_DROPPED_FROM_EXTRA_NAME "pack_transaction_dropped_from_extra"
 #define FD_METRICS_COUNTER_PACK_TRANSACTION_DROPPED_FROM_EXTRA_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_PACK_TRANSACTION_DROPPED_FROM_EXTRA_DESC "Transactions dropped from the extra transaction storage because it was full"
 #define FD_METRICS_COUNTER_PACK_TRANSACTION_DROPPED_FROM_EXTRA_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_TO_EXTRA_OFF  (151UL)
+#define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_TO_EXTRA_OFF  (168UL)
 #define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_TO_EXTRA_NAME "pack_transaction_inserted_to_extra"
 #define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_TO_EXTRA_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_TO_EXTRA_DESC "Transactions inserted into the extra transaction storage because pack's primary storage was full"
 #define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_TO_EXTRA_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_FROM_EXTRA_OFF  (152UL)
+#define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_FROM_EXTRA_OFF  (169UL)
 #define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_FROM_EXTRA_NAME "pack_transaction_inserted_from_extra"
 #define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_FROM_EXTRA_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_FROM_EXTRA_DESC "Transactions pulled from the extra transaction storage and inserted into pack's primary storage"
 #define FD_METRICS_COUNTER_PACK_TRANSACTION_INSERTED_FROM_EXTRA_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_PACK_TRANSACTION_EXPIRED_OFF  (153UL)
+#define FD_METRICS_COUNTER_PACK_TRANSACTION_EXPIRED_OFF  (170UL)
 #define FD_METRICS_COUNTER_PACK_TRANSACTION_EXPIRED_NAME "pack_transaction_expired"
 #define FD_METRICS_COUNTER_PACK_TRANSACTION_EXPIRED_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_PACK_TRANSACTION_EXPIRED_DESC "Transactions deleted from pack because their TTL expired"
 #define FD_METRICS_COUNTER_PACK_TRANSACTION_EXPIRED_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_PACK_AVAILABLE_TRANSACTIONS_OFF  (154UL)
+#define FD_METRICS_GAUGE_PACK_AVAILABLE_TRANSACTIONS_OFF  (171UL)
 #define FD_METRICS_GAUGE_PACK_AVAILABLE_TRANSACTIONS_NAME "pack_available_transactions"
 #define FD_METRICS_GAUGE_PACK_AVAILABLE_TRANSACTIONS_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_PACK_AVAILABLE_TRANSACTIONS_DESC "The total number of pending transactions in pack's pool that are available to be scheduled"
 #define FD_METRICS_GAUGE_PACK_AVAILABLE_TRANSACTIONS_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_PACK_AVAILABLE_VOTE_TRANSACTIONS_OFF  (155UL)
+#define FD_METRICS_GAUGE_PACK_AVAILABLE_VOTE_TRANSACTIONS_OFF  (172UL)
 #define FD_METRICS_GAUGE_PACK_AVAILABLE_VOTE_TRANSACTIONS_NAME "pack_available_vote_transactions"
 #define FD_METRICS_GAUGE_PACK_AVAILABLE_VOTE_TRANSACTIONS_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_PACK_AVAILABLE_VOTE_TRANSACTIONS_DESC "The number of pending simple vote transactions in pack's pool that are available to be scheduled"
 #define FD_METRICS_GAUGE_PACK_AVAILABLE_VOTE_TRANSACTIONS_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_PACK_PENDING_TRANSACTIONS_HEAP_SIZE_OFF  (156UL)
+#define FD_METRICS_GAUGE_PACK_PENDING_TRANSACTIONS_HEAP_SIZE_OFF  (173UL)
 #define FD_METRICS_GAUGE_PACK_PENDING_TRANSACTIONS_HEAP_SIZE_NAME "pack_pending_transactions_heap_size"
 #define FD_METRICS_GAUGE_PACK_PENDING_TRANSACTIONS_HEAP_SIZE_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_PACK_PENDING_TRANSACTIONS_HEAP_SIZE_DESC "The maximum number of pending transactions that pack can consider.  This value is fixed at Firedancer startup but is a useful reference for AvailableTransactions and AvailableVoteTransactions."
 #define FD_METRICS_GAUGE_PACK_PENDING_TRANSACTIONS_HEAP_SIZE_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_PACK_CONFLICTING_TRANSACTIONS_OFF  (157UL)
+#define FD_METRICS_GAUGE_PACK_CONFLICTING_TRANSACTIONS_OFF  (174UL)
 #define FD_METRICS_GAUGE_PACK_CONFLICTING_TRANSACTIONS_NAME "pack_conflicting_transactions"
 #define FD_METRICS_GAUGE_PACK_CONFLICTING_TRANSACTIONS_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_PACK_CONFLICTING_TRANSACTIONS_DESC "The number of available transactions that are temporarily not being considered due to account lock conflicts with many higher paying transactions"
 #define FD_METRICS_GAUGE_PACK_CONFLICTING_TRANSACTIONS_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_GAUGE_PACK_SMALLEST_PENDING_TRANSACTION_OFF  (158UL)
+#define FD_METRICS_GAUGE_PACK_SMALLEST_PENDING_TRANSACTION_OFF  (175UL)
 #define FD_METRICS_GAUGE_PACK_SMALLEST_PENDING_TRANSACTION_NAME "pack_smallest_pending_transaction"
 #define FD_METRICS_GAUGE_PACK_SMALLEST_PENDING_TRANSACTION_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_PACK_SMALLEST_PENDING_TRANSACTION_DESC "A lower bound on the smallest non-vote transaction (in cost units) that is immediately available for scheduling"
 #define FD_METRICS_GAUGE_PACK_SMALLEST_PENDING_TRANSACTION_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_PACK_MICROBLOCK_PER_BLOCK_LIMIT_OFF  (159UL)
+#define FD_METRICS_COUNTER_PACK_MICROBLOCK_PER_BLOCK_LIMIT_OFF  (176UL)
 #define FD_METRICS_COUNTER_PACK_MICROBLOCK_PER_BLOCK_LIMIT_NAME "pack_microblock_per_block_limit"
 #define FD_METRICS_COUNTER_PACK_MICROBLOCK_PER_BLOCK_LIMIT_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_PACK_MICROBLOCK_PER_BLOCK_LIMIT_DESC "The number of times pack did not pack a microblock because the limit on microblocks/block had been reached"
 #define FD_METRICS_COUNTER_PACK_MICROBLOCK_PER_BLOCK_LIMIT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_PACK_DATA_PER_BLOCK_LIMIT_OFF  (160UL)
+#define FD_METRICS_COUNTER_PACK_DATA_PER_BLOCK_LIMIT_OFF  (177UL)
 #define FD_METRICS_COUNTER_PACK_DATA_PER_BLOCK_LIMIT_NAME "pack_data_per_block_limit"
 #define FD_METRICS_COUNTER_PACK_DATA_PER_BLOCK_LIMIT_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_PACK_DATA_PER_BLOCK_LIMIT_DESC "The number of times pack did not pack a microblock because it reached reached the data per block limit at the start of trying to schedule a microblock"
 #define FD_METRICS_COUNTER_PACK_DATA_PER_BLOCK_LIMIT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_PACK_TRANSACTION_SCHEDULE_OFF  (161UL)
+#define FD_METRICS_COUNTER_PACK_TRANSACTION_SCHEDULE_OFF  (178UL)
 #define FD_METRICS_COUNTER_PACK_TRANSACTION_SCHEDULE_NAME "pack_transaction_schedule"
 #define FD_METRICS_COUNTER_PACK_TRANSACTION_SCHEDULE_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_PACK_TRANSACTION_SCHEDULE_DESC "Result of trying to consider a transaction for scheduling"
 #define FD_METRICS_COUNTER_PACK_TRANSACTION_SCHEDULE_CVT  (FD_METRICS_CONVERTER_NONE)
 #define FD_METRICS_COUNTER_PACK_TRANSACTION_SCHEDULE_CNT  (7UL)
 
-#define FD_METRICS_COUNTER_PACK_TRANSACTION_SCHEDULE_TAKEN_OFF (161UL)
-#define FD_METRICS_COUNTER_PACK_TRANSACTION_SCHEDULE_CU_LIMIT_OFF (162UL)
-#define FD_METRICS_COUNTER_PACK_TRANSACTION_SCHEDULE_FAST_PATH_OFF (163UL)
-#define FD_METRICS_COUNTER_PACK_TRANSACTION_SCHEDULE_BYTE_LIMIT_OFF (164UL)
-#define FD_METRICS_COUNTER_PACK_TRANSACTION_SCHEDULE_WRITE_COST_OFF (165UL)
-#define FD_METRICS_COUNTER_PACK_TRANSACTION_SCHEDULE_SLOW_PATH_OFF (166UL)
-#define FD_METRICS_COUNTER_PACK_TRANSACTION_SCHEDULE_DEFER_SKIP_OFF (167UL)
+#define FD_METRICS_COUNTER_PACK_TRANSACTION_SCHEDULE_TAKEN_OFF (178UL)
+#define FD_METRICS_COUNTER_PACK_TRANSACTION_SCHEDULE_CU_LIMIT_OFF (179UL)
+#define FD_METRICS_COUNTER_PACK_TRANSACTION_SCHEDULE_FAST_PATH_OFF (180UL)
+#define FD_METRICS_COUNTER_PACK_TRANSACTION_SCHEDULE_BYTE_LIMIT_OFF (181UL)
+#define FD_METRICS_COUNTER_PACK_TRANSACTION_SCHEDULE_WRITE_COST_OFF (182UL)
+#define FD_METRICS_COUNTER_PACK_TRANSACTION_SCHEDULE_SLOW_PATH_OFF (183UL)
+#define FD_METRICS_COUNTER_PACK_TRANSACTION_SCHEDULE_DEFER_SKIP_OFF (184UL)
 
-#define FD_METRICS_GAUGE_PACK_CUS_CONSUMED_IN_BLOCK_OFF  (168UL)
+#define FD_METRICS_GAUGE_PACK_CUS_CONSUMED_IN_BLOCK_OFF  (185UL)
 #define FD_METRICS_GAUGE_PACK_CUS_CONSUMED_IN_BLOCK_NAME "pack_cus_consumed_in_block"
 #define FD_METRICS_GAUGE_PACK_CUS_CONSUMED_IN_BLOCK_TYPE (FD_METRICS_TYPE_GAUGE)
 #define FD_METRICS_GAUGE_PACK_CUS_CONSUMED_IN_BLOCK_DESC "The number of cost units consumed in the current block, or 0 if pack is not currently packing a block"
 #define FD_METRICS_GAUGE_PACK_CUS_CONSUMED_IN_BLOCK_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_HISTOGRAM_PACK_CUS_SCHEDULED_OFF  (169UL)
+#define FD_METRICS_HISTOGRAM_PACK_CUS_SCHEDULED_OFF  (186UL)
 #define FD_METRICS_HISTOGRAM_PACK_CUS_SCHEDULED_NAME "pack_cus_scheduled"
 #define FD_METRICS_HISTOGRAM_PACK_CUS_SCHEDULED_TYPE (FD_METRICS_TYPE_HISTOGRAM)
 #define FD_METRICS_HISTOGRAM_PACK_CUS_SCHEDULED_DESC "The number of cost units scheduled for each block pack produced.  This can be higher than the block limit because of returned CUs."
@@ -199,7 +207,7 @@
 #define FD_METRICS_HISTOGRAM_PACK_CUS_SCHEDULED_MIN  (1000000UL)
 #define FD_METRICS_HISTOGRAM_PACK_CUS_SCHEDULED_MAX  (192000000UL)
 
-#define FD_METRICS_HISTOGRAM_PACK_CUS_REBATED_OFF  (186UL)
+#define FD_METRICS_HISTOGRAM_PACK_CUS_REBATED_OFF  (203UL)
 #define FD_METRICS_HISTOGRAM_PACK_CUS_REBATED_NAME "pack_cus_rebated"
 #define FD_METRICS_HISTOGRAM_PACK_CUS_REBATED_TYPE (FD_METRICS_TYPE_HISTOGRAM)
 #define FD_METRICS_HISTOGRAM_PACK_CUS_REBATED_DESC "The number of compute units rebated for each block pack produced.  Compute units are rebated when a transaction fails prior to execution or requests more compute units than it uses."
@@ -207,7 +215,7 @@
 #define FD_METRICS_HISTOGRAM_PACK_CUS_REBATED_MIN  (1000000UL)
 #define FD_METRICS_HISTOGRAM_PACK_CUS_REBATED_MAX  (192000000UL)
 
-#define FD_METRICS_HISTOGRAM_PACK_CUS_NET_OFF  (203UL)
+#define FD_METRICS_HISTOGRAM_PACK_CUS_NET_OFF  (220UL)
 #define FD_METRICS_HISTOGRAM_PACK_CUS_NET_NAME "pack_cus_net"
 #define FD_METRICS_HISTOGRAM_PACK_CUS_NET_TYPE (FD_METRICS_TYPE_HISTOGRAM)
 #define FD_METRICS_HISTOGRAM_PACK_CUS_NET_DESC "The net number of cost units (scheduled - rebated) in each block pack produced."
@@ -215,17 +223,17 @@
 #define FD_METRICS_HISTOGRAM_PACK_CUS_NET_MIN  (1000000UL)
 #define FD_METRICS_HISTOGRAM_PACK_CUS_NET_MAX  (48000000UL)
 
-#define FD_METRICS_COUNTER_PACK_DELETE_MISSED_OFF  (220UL)
+#define FD_METRICS_COUNTER_PACK_DELETE_MISSED_OFF  (237UL)
 #define FD_METRICS_COUNTER_PACK_DELETE_MISSED_NAME "pack_delete_missed"
 #define FD_METRICS_COUNTER_PACK_DELETE_MISSED_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_PACK_DELETE_MISSED_DESC "Count of attempts to delete a transaction that wasn't found"
 #define FD_METRICS_COUNTER_PACK_DELETE_MISSED_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_COUNTER_PACK_DELETE_HIT_OFF  (221UL)
+#define FD_METRICS_COUNTER_PACK_DELETE_HIT_OFF  (238UL)
 #define FD_METRICS_COUNTER_PACK_DELETE_HIT_NAME "pack_delete_hit"
 #define FD_METRICS_COUNTER_PACK_DELETE_HIT_TYPE (FD_METRICS_TYPE_COUNTER)
 #define FD_METRICS_COUNTER_PACK_DELETE_HIT_DESC "Count of attempts to delete a transaction that was found and deleted"
 #define FD_METRICS_COUNTER_PACK_DELETE_HIT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_PACK_TOTAL (62UL)
+#define FD_METRICS_PACK_TOTAL (63UL)
 extern const fd_metrics_meta_t FD_METRICS_PACK[FD_METRICS_PACK_TOTAL];
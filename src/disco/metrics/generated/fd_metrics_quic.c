@@ -5,6 +5,13 @@ const fd_metrics_meta_t FD_METRICS_QUIC[FD_METRICS_QUIC_TOTAL] = {
     DECLARE_METRIC( QUIC_TXNS_OVERRUN, COUNTER ),
     DECLARE_METRIC( QUIC_TXN_REASMS_STARTED, COUNTER ),
     DECLARE_METRIC( QUIC_TXN_REASMS_ACTIVE, GAUGE ),
+    DECLARE_METRIC_ENUM( QUIC_TXNS_RECEIVED_STAKE, COUNTER, TPU_STAKE_CLASS, UNSTAKED ),
+    DECLARE_METRIC_ENUM( QUIC_TXNS_RECEIVED_STAKE, COUNTER, TPU_STAKE_CLASS, STAKED ),
+    DECLARE_METRIC_ENUM( QUIC_TXNS_OVERRUN_STAKE, COUNTER, TPU_STAKE_CLASS, UNSTAKED ),
+    DECLARE_METRIC_ENUM( QUIC_TXNS_OVERRUN_STAKE, COUNTER, TPU_STAKE_CLASS, STAKED ),
+    DECLARE_METRIC_ENUM( QUIC_TXN_REASMS_QUOTA_EXCEEDED, COUNTER, TPU_STAKE_CLASS, UNSTAKED ),
+    DECLARE_METRIC_ENUM( QUIC_TXN_REASMS_QUOTA_EXCEEDED, COUNTER, TPU_STAKE_CLASS, STAKED ),
+    DECLARE_METRIC( QUIC_STAKED_PEER_ADDRESSES, GAUGE ),
     DECLARE_METRIC( QUIC_FRAGS_OK, COUNTER ),
     DECLARE_METRIC( QUIC_FRAGS_GAP, COUNTER ),
     DECLARE_METRIC( QUIC_FRAGS_DUP, COUNTER ),
@@ -4,4 +4,16 @@
 const fd_metrics_meta_t FD_METRICS_REPLAY[FD_METRICS_REPLAY_TOTAL] = {
     DECLARE_METRIC( REPLAY_SLOT, GAUGE ),
     DECLARE_METRIC( REPLAY_LAST_VOTED_SLOT, GAUGE ),
+    DECLARE_METRIC( REPLAY_BLOCKSTORE_ARCHIVE_DROP_COUNT, COUNTER ),
+    DECLARE_METRIC( REPLAY_FUNK_COLD_LOOKUP_COUNT, COUNTER ),
+    DECLARE_METRIC( REPLAY_FUNK_COLD_FAULT_COUNT, COUNTER ),
+    DECLARE_METRIC( REPLAY_FUNK_COLD_FAULT_SIZE_BYTES, COUNTER ),
+    DECLARE_METRIC( REPLAY_FUNK_COLD_FAULT_DURATION_NANOS, COUNTER ),
+    DECLARE_METRIC( REPLAY_FUNK_COLD_FAULT_MAX_DURATION_NANOS, GAUGE ),
+    DECLARE_METRIC( REPLAY_FUNK_COLD_PEEK_COUNT, COUNTER ),
+    DECLARE_METRIC( REPLAY_FUNK_COLD_EVICT_COUNT, COUNTER ),
+    DECLARE_METRIC( REPLAY_FUNK_COLD_EVICT_SIZE_BYTES, COUNTER ),
+    DECLARE_METRIC( REPLAY_FUNK_COLD_COMPACT_COUNT, COUNTER ),
+    DECLARE_METRIC( REPLAY_FUNK_COLD_LOG_USED_BYTES, GAUGE ),
+    DECLARE_METRIC( REPLAY_FUNK_COLD_LOG_CAPACITY_BYTES, GAUGE ),
 };
@@ -15,5 +15,77 @@
 #define FD_METRICS_GAUGE_REPLAY_LAST_VOTED_SLOT_DESC ""
 #define FD_METRICS_GAUGE_REPLAY_LAST_VOTED_SLOT_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_REPLAY_TOTAL (2UL)
+#define FD_METRICS_COUNTER_REPLAY_BLOCKSTORE_ARCHIVE_DROP_COUNT_OFF  (18UL)
+#define FD_METRICS_COUNTER_REPLAY_BLOCKSTORE_ARCHIVE_DROP_COUNT_NAME "replay_blockstore_archive_drop_count"
+#define FD_METRICS_COUNTER_REPLAY_BLOCKSTORE_ARCHIVE_DROP_COUNT_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_REPLAY_BLOCKSTORE_ARCHIVE_DROP_COUNT_DESC "Number of finalized blocks dropped instead of archived, because the archiver tile fell behind (archive queue full) or a queue entry could not be allocated."
+#define FD_METRICS_COUNTER_REPLAY_BLOCKSTORE_ARCHIVE_DROP_COUNT_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_COUNTER_REPLAY_FUNK_COLD_LOOKUP_COUNT_OFF  (19UL)
+#define FD_METRICS_COUNTER_REPLAY_FUNK_COLD_LOOKUP_COUNT_NAME "replay_funk_cold_lookup_count"
+#define FD_METRICS_COUNTER_REPLAY_FUNK_COLD_LOOKUP_COUNT_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_REPLAY_FUNK_COLD_LOOKUP_COUNT_DESC "Number of published funk record lookups while a cold tier is attached."
+#define FD_METRICS_COUNTER_REPLAY_FUNK_COLD_LOOKUP_COUNT_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_COUNTER_REPLAY_FUNK_COLD_FAULT_COUNT_OFF  (20UL)
+#define FD_METRICS_COUNTER_REPLAY_FUNK_COLD_FAULT_COUNT_NAME "replay_funk_cold_fault_count"
+#define FD_METRICS_COUNTER_REPLAY_FUNK_COLD_FAULT_COUNT_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_REPLAY_FUNK_COLD_FAULT_COUNT_DESC "Number of funk record values faulted in or copied out of the cold tier log."
+#define FD_METRICS_COUNTER_REPLAY_FUNK_COLD_FAULT_COUNT_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_COUNTER_REPLAY_FUNK_COLD_FAULT_SIZE_BYTES_OFF  (21UL)
+#define FD_METRICS_COUNTER_REPLAY_FUNK_COLD_FAULT_SIZE_BYTES_NAME "replay_funk_cold_fault_size_bytes"
+#define FD_METRICS_COUNTER_REPLAY_FUNK_COLD_FAULT_SIZE_BYTES_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_REPLAY_FUNK_COLD_FAULT_SIZE_BYTES_DESC "Bytes faulted in or copied out of the cold tier log."
+#define FD_METRICS_COUNTER_REPLAY_FUNK_COLD_FAULT_SIZE_BYTES_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_COUNTER_REPLAY_FUNK_COLD_FAULT_DURATION_NANOS_OFF  (22UL)
+#define FD_METRICS_COUNTER_REPLAY_FUNK_COLD_FAULT_DURATION_NANOS_NAME "replay_funk_cold_fault_duration_nanos"
+#define FD_METRICS_COUNTER_REPLAY_FUNK_COLD_FAULT_DURATION_NANOS_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_REPLAY_FUNK_COLD_FAULT_DURATION_NANOS_DESC "Total time spent faulting values in from the cold tier log."
+#define FD_METRICS_COUNTER_REPLAY_FUNK_COLD_FAULT_DURATION_NANOS_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_GAUGE_REPLAY_FUNK_COLD_FAULT_MAX_DURATION_NANOS_OFF  (23UL)
+#define FD_METRICS_GAUGE_REPLAY_FUNK_COLD_FAULT_MAX_DURATION_NANOS_NAME "replay_funk_cold_fault_max_duration_nanos"
+#define FD_METRICS_GAUGE_REPLAY_FUNK_COLD_FAULT_MAX_DURATION_NANOS_TYPE (FD_METRICS_TYPE_GAUGE)
+#define FD_METRICS_GAUGE_REPLAY_FUNK_COLD_FAULT_MAX_DURATION_NANOS_DESC "Worst case time spent faulting a single value in from the cold tier log."
+#define FD_METRICS_GAUGE_REPLAY_FUNK_COLD_FAULT_MAX_DURATION_NANOS_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_COUNTER_REPLAY_FUNK_COLD_PEEK_COUNT_OFF  (24UL)
+#define FD_METRICS_COUNTER_REPLAY_FUNK_COLD_PEEK_COUNT_NAME "replay_funk_cold_peek_count"
+#define FD_METRICS_COUNTER_REPLAY_FUNK_COLD_PEEK_COUNT_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_REPLAY_FUNK_COLD_PEEK_COUNT_DESC "Number of cold funk record values read in place by record walkers (hashing, snapshots)."
+#define FD_METRICS_COUNTER_REPLAY_FUNK_COLD_PEEK_COUNT_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_COUNTER_REPLAY_FUNK_COLD_EVICT_COUNT_OFF  (25UL)
+#define FD_METRICS_COUNTER_REPLAY_FUNK_COLD_EVICT_COUNT_NAME "replay_funk_cold_evict_count"
+#define FD_METRICS_COUNTER_REPLAY_FUNK_COLD_EVICT_COUNT_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_REPLAY_FUNK_COLD_EVICT_COUNT_DESC "Number of funk record values evicted to the cold tier log."
+#define FD_METRICS_COUNTER_REPLAY_FUNK_COLD_EVICT_COUNT_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_COUNTER_REPLAY_FUNK_COLD_EVICT_SIZE_BYTES_OFF  (26UL)
+#define FD_METRICS_COUNTER_REPLAY_FUNK_COLD_EVICT_SIZE_BYTES_NAME "replay_funk_cold_evict_size_bytes"
+#define FD_METRICS_COUNTER_REPLAY_FUNK_COLD_EVICT_SIZE_BYTES_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_REPLAY_FUNK_COLD_EVICT_SIZE_BYTES_DESC "Bytes evicted to the cold tier log."
+#define FD_METRICS_COUNTER_REPLAY_FUNK_COLD_EVICT_SIZE_BYTES_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_COUNTER_REPLAY_FUNK_COLD_COMPACT_COUNT_OFF  (27UL)
+#define FD_METRICS_COUNTER_REPLAY_FUNK_COLD_COMPACT_COUNT_NAME "replay_funk_cold_compact_count"
+#define FD_METRICS_COUNTER_REPLAY_FUNK_COLD_COMPACT_COUNT_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_REPLAY_FUNK_COLD_COMPACT_COUNT_DESC "Number of cold tier log compactions."
+#define FD_METRICS_COUNTER_REPLAY_FUNK_COLD_COMPACT_COUNT_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_GAUGE_REPLAY_FUNK_COLD_LOG_USED_BYTES_OFF  (28UL)
+#define FD_METRICS_GAUGE_REPLAY_FUNK_COLD_LOG_USED_BYTES_NAME "replay_funk_cold_log_used_bytes"
+#define FD_METRICS_GAUGE_REPLAY_FUNK_COLD_LOG_USED_BYTES_TYPE (FD_METRICS_TYPE_GAUGE)
+#define FD_METRICS_GAUGE_REPLAY_FUNK_COLD_LOG_USED_BYTES_DESC "Bytes used in the cold tier log (including garbage)."
+#define FD_METRICS_GAUGE_REPLAY_FUNK_COLD_LOG_USED_BYTES_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_GAUGE_REPLAY_FUNK_COLD_LOG_CAPACITY_BYTES_OFF  (29UL)
+#define FD_METRICS_GAUGE_REPLAY_FUNK_COLD_LOG_CAPACITY_BYTES_NAME "replay_funk_cold_log_capacity_bytes"
+#define FD_METRICS_GAUGE_REPLAY_FUNK_COLD_LOG_CAPACITY_BYTES_TYPE (FD_METRICS_TYPE_GAUGE)
+#define FD_METRICS_GAUGE_REPLAY_FUNK_COLD_LOG_CAPACITY_BYTES_DESC "Capacity of the cold tier log in bytes."
+#define FD_METRICS_GAUGE_REPLAY_FUNK_COLD_LOG_CAPACITY_BYTES_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_REPLAY_TOTAL (14UL)
 extern const fd_metrics_meta_t FD_METRICS_REPLAY[FD_METRICS_REPLAY_TOTAL];
@@ -5,4 +5,7 @@ const fd_metrics_meta_t FD_METRICS_VERIFY[FD_METRICS_VERIFY_TOTAL] = {
     DECLARE_METRIC( VERIFY_TRANSACTION_PARSE_FAILURE, COUNTER ),
     DECLARE_METRIC( VERIFY_TRANSACTION_DEDUP_FAILURE, COUNTER ),
     DECLARE_METRIC( VERIFY_TRANSACTION_VERIFY_FAILURE, COUNTER ),
+    DECLARE_METRIC( VERIFY_PUBKEY_CACHE_HIT, COUNTER ),
+    DECLARE_METRIC( VERIFY_PUBKEY_CACHE_MISS, COUNTER ),
+    DECLARE_METRIC( VERIFY_PUBKEY_CACHE_TABLE_HIT, COUNTER ),
 };
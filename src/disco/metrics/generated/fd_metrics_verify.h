@@ -21,5 +21,23 @@
 #define FD_METRICS_COUNTER_VERIFY_TRANSACTION_VERIFY_FAILURE_DESC "Count of transactions that failed to deduplicate in the verify stage"
 #define FD_METRICS_COUNTER_VERIFY_TRANSACTION_VERIFY_FAILURE_CVT  (FD_METRICS_CONVERTER_NONE)
 
-#define FD_METRICS_VERIFY_TOTAL (3UL)
+#define FD_METRICS_COUNTER_VERIFY_PUBKEY_CACHE_HIT_OFF  (19UL)
+#define FD_METRICS_COUNTER_VERIFY_PUBKEY_CACHE_HIT_NAME "verify_pubkey_cache_hit"
+#define FD_METRICS_COUNTER_VERIFY_PUBKEY_CACHE_HIT_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_VERIFY_PUBKEY_CACHE_HIT_DESC "Count of signature public keys found in the decompressed public key cache"
+#define FD_METRICS_COUNTER_VERIFY_PUBKEY_CACHE_HIT_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_COUNTER_VERIFY_PUBKEY_CACHE_MISS_OFF  (20UL)
+#define FD_METRICS_COUNTER_VERIFY_PUBKEY_CACHE_MISS_NAME "verify_pubkey_cache_miss"
+#define FD_METRICS_COUNTER_VERIFY_PUBKEY_CACHE_MISS_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_VERIFY_PUBKEY_CACHE_MISS_DESC "Count of signature public keys that had to be decompressed"
+#define FD_METRICS_COUNTER_VERIFY_PUBKEY_CACHE_MISS_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_COUNTER_VERIFY_PUBKEY_CACHE_TABLE_HIT_OFF  (21UL)
+#define FD_METRICS_COUNTER_VERIFY_PUBKEY_CACHE_TABLE_HIT_NAME "verify_pubkey_cache_table_hit"
+#define FD_METRICS_COUNTER_VERIFY_PUBKEY_CACHE_TABLE_HIT_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_VERIFY_PUBKEY_CACHE_TABLE_HIT_DESC "Count of signature public keys whose precomputed multiples were found in the decompressed public key cache"
+#define FD_METRICS_COUNTER_VERIFY_PUBKEY_CACHE_TABLE_HIT_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_VERIFY_TOTAL (6UL)
 extern const fd_metrics_meta_t FD_METRICS_VERIFY[FD_METRICS_VERIFY_TOTAL];
@@ -8,7 +8,11 @@ $(OBJDIR)/obj/disco/quic/test_quic_metrics.o: src/disco/quic/test_quic_metrics.t
 
 ifdef FD_HAS_SSE
 ifdef FD_HAS_ALLOCA
-$(call add-hdrs,fd_quic_tile.h)
-$(call add-objs,fd_quic_tile,fd_disco)
+ifdef FD_HAS_INT128
+$(call add-hdrs,fd_quic_tile.h fd_tpu_stake.h)
+$(call add-objs,fd_quic_tile fd_tpu_stake,fd_disco)
+$(call make-unit-test,test_tpu_stake,test_tpu_stake,fd_disco fd_flamenco fd_tango fd_ballet fd_util)
+$(call run-unit-test,test_tpu_stake)
+endif
 endif
 endif
@@ -6,6 +6,7 @@
 #include "../../waltz/quic/fd_quic_private.h"
 #include "generated/quic_seccomp.h"
 #include "../../util/net/fd_eth.h"
+#include "../keyguard/fd_keyload.h"
 
 #include <errno.h>
 #include <linux/unistd.h>
@@ -61,6 +62,8 @@ scratch_footprint( fd_topo_tile_t const * tile ) {
   l = FD_LAYOUT_APPEND( l, alignof( fd_quic_ctx_t ), sizeof( fd_quic_ctx_t )                        );
   l = FD_LAYOUT_APPEND( l, fd_quic_align(),          fd_quic_footprint( &limits )                   );
   l = FD_LAYOUT_APPEND( l, fd_tpu_reasm_align(),     fd_tpu_reasm_footprint( out_depth, reasm_max ) );
+  l = FD_LAYOUT_APPEND( l, fd_tpu_stake_align(),     fd_tpu_stake_footprint()                       );
+  l = FD_LAYOUT_APPEND( l, alignof( fd_quic_conn_qos_t ), limits.conn_cnt*sizeof( fd_quic_conn_qos_t ) );
   return FD_LAYOUT_FINI( l, scratch_align() );
 }
 
@@ -87,6 +90,7 @@ legacy_stream_notify( fd_quic_ctx_t * ctx,
   if( FD_LIKELY( err==FD_TPU_REASM_SUCCESS ) ) {
     fd_stem_advance( stem, 0UL );
     ctx->metrics.txns_received_udp++;
+    ctx->metrics.txns_received_stake[ 0 ]++;
   }
 }
 
@@ -127,6 +131,11 @@ metrics_write( fd_quic_ctx_t * ctx ) {
   FD_MCNT_SET  ( QUIC, TXN_REASMS_STARTED,      ctx->metrics.reasm_started );
   FD_MGAUGE_SET( QUIC, TXN_REASMS_ACTIVE,       (ulong)fd_long_max( ctx->metrics.reasm_active, 0L ) );
 
+  FD_MCNT_ENUM_COPY( QUIC, TXNS_RECEIVED_STAKE,       ctx->metrics.txns_received_stake );
+  FD_MCNT_ENUM_COPY( QUIC, TXNS_OVERRUN_STAKE,        ctx->metrics.reasm_overrun_stake );
+  FD_MCNT_ENUM_COPY( QUIC, TXN_REASMS_QUOTA_EXCEEDED, ctx->metrics.reasm_quota_drop );
+  FD_MGAUGE_SET    ( QUIC, STAKED_PEER_ADDRESSES,     fd_tpu_stake_staked_ip_cnt( ctx->stake ) );
+
   FD_MCNT_SET( QUIC, LEGACY_TXN_UNDERSZ, ctx->metrics.udp_pkt_too_small );
   FD_MCNT_SET( QUIC, LEGACY_TXN_OVERSZ,  ctx->metrics.udp_pkt_too_large );
   FD_MCNT_SET( QUIC, TXN_UNDERSZ,        ctx->metrics.quic_txn_too_small );
@@ -177,12 +186,16 @@ before_frag( fd_quic_ctx_t * ctx,
              ulong           in_idx,
              ulong           seq,
              ulong           sig ) {
-  (void)in_idx;
   (void)seq;
 
+  /* Stake and contact info updates are always consumed */
+  if( FD_UNLIKELY( in_idx==ctx->stake_in_idx || in_idx==ctx->contact_in_idx ) ) return 0;
+
   ulong proto = fd_disco_netmux_sig_proto( sig );
   if( FD_UNLIKELY( proto!=DST_PROTO_TPU_UDP && proto!=DST_PROTO_TPU_QUIC ) ) return 1;
 
+  /* For QUIC short header packets, the net tile sets the hash to the
+     index of the quic tile that owns the conn. */
   ulong hash = fd_disco_netmux_sig_hash( sig );
   if( FD_UNLIKELY( (hash % ctx->round_robin_cnt) != ctx->round_robin_id ) ) return 1;
 
@@ -196,10 +209,23 @@ during_frag( fd_quic_ctx_t * ctx,
              ulong           sig,
              ulong           chunk,
              ulong           sz ) {
-  (void)in_idx;
   (void)seq;
   (void)sig;
 
+  if( FD_UNLIKELY( in_idx==ctx->stake_in_idx ) ) {
+    if( FD_UNLIKELY( chunk<ctx->stake_in_chunk0 || chunk>ctx->stake_in_wmark ) )
+      FD_LOG_ERR(( "chunk %lu %lu corrupt, not in range [%lu,%lu]", chunk, sz, ctx->stake_in_chunk0, ctx->stake_in_wmark ));
+    fd_tpu_stake_stake_msg_init( ctx->stake, fd_chunk_to_laddr_const( ctx->stake_in_mem, chunk ) );
+    return;
+  }
+
+  if( FD_UNLIKELY( in_idx==ctx->contact_in_idx ) ) {
+    if( FD_UNLIKELY( chunk<ctx->contact_in_chunk0 || chunk>ctx->contact_in_wmark ) )
+      FD_LOG_ERR(( "chunk %lu %lu corrupt, not in range [%lu,%lu]", chunk, sz, ctx->contact_in_chunk0, ctx->contact_in_wmark ));
+    fd_tpu_stake_contact_msg_init( ctx->stake, fd_chunk_to_laddr_const( ctx->contact_in_mem, chunk ) );
+    return;
+  }
+
   if( FD_UNLIKELY( chunk<ctx->in_chunk0 || chunk>ctx->in_wmark || sz > FD_NET_MTU ) )
     FD_LOG_ERR(( "chunk %lu %lu corrupt, not in range [%lu,%lu]", chunk, sz, ctx->in_chunk0, ctx->in_wmark ));
 
@@ -215,11 +241,19 @@ after_frag( fd_quic_ctx_t *     ctx,
             ulong               sz,
             ulong               tsorig,
             fd_stem_context_t * stem ) {
-  (void)in_idx;
   (void)seq;
   (void)tsorig;
   (void)stem;
 
+  if( FD_UNLIKELY( in_idx==ctx->stake_in_idx ) ) {
+    fd_tpu_stake_stake_msg_fini( ctx->stake );
+    return;
+  }
+  if( FD_UNLIKELY( in_idx==ctx->contact_in_idx ) ) {
+    fd_tpu_stake_contact_msg_fini( ctx->stake );
+    return;
+  }
+
   ulong proto = fd_disco_netmux_sig_proto( sig );
 
   if( FD_LIKELY( proto==DST_PROTO_TPU_QUIC ) ) {
@@ -267,6 +301,29 @@ quic_now( void * ctx FD_PARAM_UNUSED ) {
   return (ulong)fd_tickcount();
 }
 
+/* quic_conn_new is called when a handshake completes.  Derives the
+   conn's reassembly quota from the stake behind the peer address.
+   Unstaked conns get an equal share of the reassembly buffers.  Staked
+   conns get a share proportional to their stake (but no less than
+   unstaked conns) and may evict reassemblies of unstaked conns. */
+
+static void
+quic_conn_new( fd_quic_conn_t * conn,
+               void *           quic_ctx ) {
+  fd_quic_ctx_t *      ctx   = quic_ctx;
+  fd_quic_conn_qos_t * qos   = ctx->conn_qos + conn->conn_idx;
+  ulong                stake = fd_tpu_stake_query( ctx->stake, conn->peer[0].ip_addr );
+  ulong                total = fd_tpu_stake_total( ctx->stake );
+
+  ulong quota = ctx->reasm_quota_unstaked;
+  if( stake && total ) {
+    ulong share = (ulong)( (double)ctx->reasm_max * ((double)stake / (double)total) );
+    quota = fd_ulong_max( quota, fd_ulong_min( share, ctx->reasm_max ) );
+  }
+  qos->reasm_quota = (uint)fd_ulong_min( quota, UINT_MAX );
+  qos->staked      = !!stake;
+}
+
 static void
 quic_conn_final( fd_quic_conn_t * conn,
                  void *           quic_ctx ) {
@@ -294,6 +351,8 @@ quic_stream_rx( fd_quic_conn_t * conn,
   fd_frag_meta_t *    mcache   = stem->mcaches[0];
   void *              base     = ctx->verify_out_mem;
   ulong               seq      = stem->seqs[0];
+  fd_quic_conn_qos_t  qos      = ctx->conn_qos[ conn->conn_idx ];
+  int                 staked   = (int)qos.staked;
 
   int oversz = offset+data_sz > FD_TPU_MTU;
 
@@ -311,6 +370,7 @@ quic_stream_rx( fd_quic_conn_t * conn,
     if( FD_LIKELY( err==FD_TPU_REASM_SUCCESS ) ) {
       fd_stem_advance( stem, 0UL );
       ctx->metrics.txns_received_quic_fast++;
+      ctx->metrics.txns_received_stake[ staked ]++;
     }
     return FD_QUIC_SUCCESS;
   }
@@ -330,8 +390,15 @@ quic_stream_rx( fd_quic_conn_t * conn,
       return FD_QUIC_SUCCESS; /* drop */
     }
 
+    /* Admission control: limit the number of concurrent reassemblies
+       per conn */
+    if( FD_UNLIKELY( conn->srx->rx_streams_active >= (long)qos.reasm_quota ) ) {
+      ctx->metrics.reasm_quota_drop[ staked ]++;
+      return FD_QUIC_SUCCESS; /* drop */
+    }
+
     /* Was the reasm buffer we evicted busy? */
-    fd_tpu_reasm_slot_t * victim      = fd_tpu_reasm_peek_tail( reasm );
+    fd_tpu_reasm_slot_t * victim      = fd_tpu_reasm_peek_victim( reasm, staked );
     int                   victim_busy = victim->k.state == FD_TPU_REASM_STATE_BUSY;
 
     /* If so, does the connection it refers to still exist?
@@ -345,9 +412,10 @@ quic_stream_rx( fd_quic_conn_t * conn,
       victim_conn->srx->rx_streams_active -= victim_exists;
       ctx->metrics.reasm_overrun          += victim_exists;
       ctx->metrics.reasm_active           -= victim_exists;
+      ctx->metrics.reasm_overrun_stake[ victim->k.prio ] += victim_exists;
     }
 
-    slot = fd_tpu_reasm_prepare( reasm, conn_uid, stream_id, tspub ); /* infallible */
+    slot = fd_tpu_reasm_prepare( reasm, conn_uid, stream_id, tspub, staked ); /* infallible */
     ctx->metrics.reasm_started++;
     ctx->metrics.reasm_active++;
     conn->srx->rx_streams_active++;
@@ -375,6 +443,7 @@ quic_stream_rx( fd_quic_conn_t * conn,
     if( FD_UNLIKELY( pub_err!=FD_TPU_REASM_SUCCESS ) ) return FD_QUIC_SUCCESS; /* unreachable */
     ulong * rcv_cnt = (offset==0UL && fin) ? &ctx->metrics.txns_received_quic_fast : &ctx->metrics.txns_received_quic_frag;
     (*rcv_cnt)++;
+    ctx->metrics.txns_received_stake[ staked ]++;
     ctx->metrics.reasm_active--;
     conn->srx->rx_streams_active--;
 
@@ -434,7 +503,15 @@ quic_tx_aio_send( void *                    _ctx,
 static void
 privileged_init( fd_topo_t *      topo,
                  fd_topo_tile_t * tile ) {
-  (void)topo; (void)tile;
+  void * scratch = fd_topo_obj_laddr( topo, tile->tile_obj_id );
+
+  FD_SCRATCH_ALLOC_INIT( l, scratch );
+  fd_quic_ctx_t * ctx = FD_SCRATCH_ALLOC_APPEND( l, alignof( fd_quic_ctx_t ), sizeof( fd_quic_ctx_t ) );
+
+  /* The identity is only needed to track stakes (see fd_tpu_stake) */
+  memset( ctx->identity_key, 0, sizeof(fd_pubkey_t) );
+  if( FD_LIKELY( strcmp( tile->quic.identity_key_path, "" ) ) )
+    ctx->identity_key[ 0 ] = *(fd_pubkey_t const *)fd_type_pun_const( fd_keyload_load( tile->quic.identity_key_path, /* pubkey only: */ 1 ) );
 
   /* The fd_quic implementation calls fd_log_wallclock() internally
      which itself calls clock_gettime() which on most kernels is not a
@@ -466,10 +543,17 @@ unprivileged_init( fd_topo_t *      topo,
     FD_LOG_ERR(( "insufficient tile scratch space" ));
   }
 
-  if( FD_UNLIKELY( tile->in_cnt!=1UL ||
+  /* Net links come first, optionally followed by stake_out and
+     crds_shred (for stake-weighted QoS) */
+  if( FD_UNLIKELY( tile->in_cnt<1UL ||
                    strcmp( topo->links[ tile->in_link_id[ 0UL ] ].name, "net_quic" ) ) )
-    FD_LOG_ERR(( "quic tile has none or unexpected input links %lu %s %s",
-                 tile->in_cnt, topo->links[ tile->in_link_id[ 0 ] ].name, topo->links[ tile->in_link_id[ 1 ] ].name ));
+    FD_LOG_ERR(( "quic tile has none or unexpected input links %lu %s",
+                 tile->in_cnt, topo->links[ tile->in_link_id[ 0 ] ].name ));
+  for( ulong i=1UL; i<tile->in_cnt; i++ ) {
+    char const * name = topo->links[ tile->in_link_id[ i ] ].name;
+    if( FD_UNLIKELY( strcmp( name, "net_quic" ) && strcmp( name, "stake_out" ) && strcmp( name, "crds_shred" ) ) )
+      FD_LOG_ERR(( "quic tile has unexpected input link %lu %s", i, name ));
+  }
 
   if( FD_UNLIKELY( tile->out_cnt!=2UL ||
                    strcmp( topo->links[ tile->out_link_id[ 0UL ] ].name, "quic_verify" ) ||
@@ -487,7 +571,9 @@ unprivileged_init( fd_topo_t *      topo,
 
   FD_SCRATCH_ALLOC_INIT( l, scratch );
   fd_quic_ctx_t * ctx = FD_SCRATCH_ALLOC_APPEND( l, alignof( fd_quic_ctx_t ), sizeof( fd_quic_ctx_t ) );
+  fd_pubkey_t identity_key[1]; *identity_key = *ctx->identity_key; /* from privileged_init */
   fd_memset( ctx, 0, sizeof(fd_quic_ctx_t) );
+  *ctx->identity_key = *identity_key;
 
   if( FD_UNLIKELY( getrandom( ctx->tls_priv_key, ED25519_PRIV_KEY_SZ, 0 )!=ED25519_PRIV_KEY_SZ ) ) {
     FD_LOG_ERR(( "getrandom failed (%i-%s)", errno, fd_io_strerror( errno ) ));
@@ -509,6 +595,16 @@ unprivileged_init( fd_topo_t *      topo,
   ctx->reasm       = fd_tpu_reasm_join( fd_tpu_reasm_new( reasm_mem, out_depth, reasm_max, orig, txn_dcache ) );
   if( FD_UNLIKELY( !ctx->reasm ) ) FD_LOG_ERR(( "fd_tpu_reasm_new failed" ));
 
+  ctx->stake = fd_tpu_stake_join( fd_tpu_stake_new( FD_SCRATCH_ALLOC_APPEND( l, fd_tpu_stake_align(), fd_tpu_stake_footprint() ), ctx->identity_key ) );
+  if( FD_UNLIKELY( !ctx->stake ) ) FD_LOG_ERR(( "fd_tpu_stake_new failed" ));
+
+  ctx->conn_qos = FD_SCRATCH_ALLOC_APPEND( l, alignof( fd_quic_conn_qos_t ), limits.conn_cnt*sizeof( fd_quic_conn_qos_t ) );
+  ctx->reasm_max            = reasm_max;
+  ctx->reasm_quota_unstaked = fd_ulong_max( reasm_max / limits.conn_cnt, 1UL );
+  for( ulong i=0UL; i<limits.conn_cnt; i++ ) {
+    ctx->conn_qos[ i ] = (fd_quic_conn_qos_t){ .reasm_quota = (uint)fd_ulong_min( ctx->reasm_quota_unstaked, UINT_MAX ) };
+  }
+
   if( FD_UNLIKELY( tile->quic.ack_delay_millis == 0 ) ) {
     FD_LOG_ERR(( "Invalid `ack_delay_millis`: must be greater than zero" ));
   }
@@ -526,11 +622,21 @@ unprivileged_init( fd_topo_t *      topo,
   quic->config.ack_delay                  = tile->quic.ack_delay_millis * (ulong)1e6;
   quic->config.initial_rx_max_stream_data = FD_TXN_MTU;
   quic->config.retry                      = tile->quic.retry;
+
+  /* Tag conn IDs with our tile index such that the net tile steers
+     short header packets back to us (see before_frag) */
+  ulong quic_tile_cnt = fd_topo_tile_name_cnt( topo, tile->name );
+  if( FD_UNLIKELY( quic_tile_cnt>FD_QUIC_CONN_ID_SHARD_MAX ) ) {
+    FD_LOG_ERR(( "too many quic tiles (%lu), at most %lu supported", quic_tile_cnt, FD_QUIC_CONN_ID_SHARD_MAX ));
+  }
+  quic->config.conn_id_shard_cnt          = (uint)quic_tile_cnt;
+  quic->config.conn_id_shard_idx          = (uint)tile->kind_id;
   fd_memcpy( quic->config.identity_public_key, ctx->tls_pub_key, ED25519_PUB_KEY_SZ );
 
   quic->config.sign         = quic_tls_cv_sign;
   quic->config.sign_ctx     = ctx;
 
+  quic->cb.conn_new         = quic_conn_new;
   quic->cb.conn_final       = quic_conn_final;
   quic->cb.stream_rx        = quic_stream_rx;
   quic->cb.now              = quic_now;
@@ -546,6 +652,24 @@ unprivileged_init( fd_topo_t *      topo,
   ctx->in_chunk0 = fd_dcache_compact_chunk0( ctx->in_mem, net_in->dcache );
   ctx->in_wmark  = fd_dcache_compact_wmark ( ctx->in_mem, net_in->dcache, net_in->mtu );
 
+  ctx->stake_in_idx = fd_topo_find_tile_in_link( topo, tile, "stake_out", 0 );
+  if( FD_LIKELY( ctx->stake_in_idx!=ULONG_MAX ) ) {
+    if( FD_UNLIKELY( !strcmp( tile->quic.identity_key_path, "" ) ) )
+      FD_LOG_ERR(( "identity_key_path not set" ));
+    fd_topo_link_t * stake_in = &topo->links[ tile->in_link_id[ ctx->stake_in_idx ] ];
+    ctx->stake_in_mem    = topo->workspaces[ topo->objs[ stake_in->dcache_obj_id ].wksp_id ].wksp;
+    ctx->stake_in_chunk0 = fd_dcache_compact_chunk0( ctx->stake_in_mem, stake_in->dcache );
+    ctx->stake_in_wmark  = fd_dcache_compact_wmark ( ctx->stake_in_mem, stake_in->dcache, stake_in->mtu );
+  }
+
+  ctx->contact_in_idx = fd_topo_find_tile_in_link( topo, tile, "crds_shred", 0 );
+  if( FD_LIKELY( ctx->contact_in_idx!=ULONG_MAX ) ) {
+    fd_topo_link_t * contact_in = &topo->links[ tile->in_link_id[ ctx->contact_in_idx ] ];
+    ctx->contact_in_mem    = topo->workspaces[ topo->objs[ contact_in->dcache_obj_id ].wksp_id ].wksp;
+    ctx->contact_in_chunk0 = fd_dcache_compact_chunk0( ctx->contact_in_mem, contact_in->dcache );
+    ctx->contact_in_wmark  = fd_dcache_compact_wmark ( ctx->contact_in_mem, contact_in->dcache, contact_in->mtu );
+  }
+
   fd_topo_link_t * net_out = &topo->links[ tile->out_link_id[ 1 ] ];
 
   ctx->net_out_mcache = net_out->mcache;
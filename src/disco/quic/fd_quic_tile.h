@@ -2,12 +2,28 @@
 #define HEADER_fd_src_app_fdctl_run_tiles_fd_quic_tile_h
 
 #include "fd_tpu.h"
+#include "fd_tpu_stake.h"
 #include "../stem/fd_stem.h"
 #include "../../waltz/quic/fd_quic.h"
 
+/* fd_quic_conn_qos_t holds the admission control parameters of a QUIC
+   conn, derived from the stake behind the peer address at handshake
+   completion. */
+
+typedef struct {
+  uint reasm_quota; /* max concurrent txn reassemblies */
+  uint staked;      /* 1 if peer is staked, 0 otherwise */
+} fd_quic_conn_qos_t;
+
 typedef struct {
   fd_tpu_reasm_t * reasm;
 
+  fd_tpu_stake_t *     stake;
+  fd_pubkey_t          identity_key[1];   /* local validator, loaded in privileged_init */
+  fd_quic_conn_qos_t * conn_qos;          /* indexed by conn_idx */
+  ulong                reasm_quota_unstaked;
+  ulong                reasm_max;
+
   fd_stem_context_t * stem;
 
   fd_quic_t * quic;
@@ -28,6 +44,16 @@ typedef struct {
   ulong       in_chunk0;
   ulong       in_wmark;
 
+  ulong       stake_in_idx;   /* ULONG_MAX if not connected */
+  fd_wksp_t * stake_in_mem;
+  ulong       stake_in_chunk0;
+  ulong       stake_in_wmark;
+
+  ulong       contact_in_idx; /* ULONG_MAX if not connected */
+  fd_wksp_t * contact_in_mem;
+  ulong       contact_in_chunk0;
+  ulong       contact_in_wmark;
+
   fd_frag_meta_t * net_out_mcache;
   ulong *          net_out_sync;
   ulong            net_out_depth;
@@ -55,6 +81,9 @@ typedef struct {
     ulong udp_pkt_too_large;
     ulong quic_txn_too_small;
     ulong quic_txn_too_large;
+    ulong txns_received_stake[ 2 ];  /* indexed by staked */
+    ulong reasm_overrun_stake[ 2 ];  /* indexed by staked (of victim) */
+    ulong reasm_quota_drop   [ 2 ];  /* indexed by staked */
   } metrics;
 } fd_quic_ctx_t;
 
@@ -72,6 +72,14 @@
    the least recently prepared reassembly.  This also guarantees that
    unfragmented transaction never get dropped.
 
+   Reassemblies can be prioritized (e.g. streams of staked peers).
+   Prioritized reassemblies are kept in a separate queue that holds up
+   to burst-2 slots.  A new prioritized reassembly takes a free slot or
+   evicts the least recently prepared unprioritized reassembly.  Only
+   if the prioritized queue is full, it evicts the least recently
+   prepared prioritized reassembly.  Unprioritized reassemblies (and
+   fd_tpu_reasm_publish_fast) never evict prioritized ones.
+
    ### Internals
 
    fd_tpu_reasm internally manages an array of message reassembly
@@ -122,12 +130,13 @@
 struct fd_tpu_reasm_key {
   ulong conn_uid; /* ULONG_MAX means invalid */
   ulong stream_id : 48;
-  ulong sz        : 14;
+  ulong sz        : 13;
+  ulong prio      : 1;  /* 1 if slot is in the prioritized queue */
   ulong state     : 2;
 };
 
 #define FD_TPU_REASM_SID_MASK (0xffffffffffffUL)
-#define FD_TPU_REASM_SZ_MASK  (0x3fffUL)
+#define FD_TPU_REASM_SZ_MASK  (0x1fffUL)
 
 typedef struct fd_tpu_reasm_key fd_tpu_reasm_key_t;
 
@@ -157,6 +166,11 @@ struct __attribute__((aligned(FD_TPU_REASM_ALIGN))) fd_tpu_reasm {
 
   uint   slot_cnt;
   ushort orig;        /* tango orig */
+
+  uint   prio_head;   /* most  recent prioritized reassembly, UINT_MAX if none */
+  uint   prio_tail;   /* least recent prioritized reassembly, UINT_MAX if none */
+  uint   prio_cnt;    /* number of prioritized reassemblies */
+  uint   prio_max;    /* max number of prioritized reassemblies */
 };
 
 typedef struct fd_tpu_reasm fd_tpu_reasm_t;
@@ -240,20 +254,40 @@ fd_tpu_reasm_peek_tail( fd_tpu_reasm_t * reasm ) {
   return tail;
 }
 
+/* fd_tpu_reasm_peek_victim returns the slot that the next
+   fd_tpu_reasm_prepare with the given prio would take over.  The slot
+   is either FREE or BUSY (the reassembly that would get evicted). */
+
+FD_FN_PURE static inline fd_tpu_reasm_slot_t *
+fd_tpu_reasm_peek_victim( fd_tpu_reasm_t * reasm,
+                          int              prio ) {
+  if( prio && reasm->prio_max && reasm->prio_cnt>=reasm->prio_max ) {
+    return fd_tpu_reasm_slots_laddr( reasm ) + reasm->prio_tail;
+  }
+  return fd_tpu_reasm_peek_tail( reasm );
+}
+
+/* fd_tpu_reasm_prepare starts a new reassembly for the given stream,
+   evicting a reassembly if no slot is free (see Eviction Policy).
+   prio is 1 if the reassembly should be prioritized, 0 otherwise.
+   Infallible. */
+
 fd_tpu_reasm_slot_t *
 fd_tpu_reasm_prepare( fd_tpu_reasm_t * reasm,
                       ulong            conn_uid,
                       ulong            stream_id,
-                      long             tspub );
+                      long             tspub,
+                      int              prio );
 
 static inline fd_tpu_reasm_slot_t *
 fd_tpu_reasm_acquire( fd_tpu_reasm_t * reasm,
                       ulong            conn_uid,
                       ulong            stream_id,
-                      long             tspub ) {
+                      long             tspub,
+                      int              prio ) {
   fd_tpu_reasm_slot_t * slot = fd_tpu_reasm_query( reasm, conn_uid, stream_id );
   if( !slot ) {
-    slot = fd_tpu_reasm_prepare( reasm, conn_uid, stream_id, tspub );
+    slot = fd_tpu_reasm_prepare( reasm, conn_uid, stream_id, tspub, prio );
   }
   return slot;
 }
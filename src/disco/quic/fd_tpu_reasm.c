@@ -77,10 +77,9 @@ fd_tpu_reasm_new( void * shmem,
 
   reasm->depth    = (uint)depth;
   reasm->burst    = (uint)burst;
-  reasm->head     = (uint)slot_cnt-1U;
-  reasm->tail     = (uint)depth;
   reasm->slot_cnt = (uint)slot_cnt;
   reasm->orig     = (ushort)orig;
+  reasm->prio_max = (uint)burst-2U; /* slotq needs at least 2 slots */
 
   /* Initial slot distribution */
 
@@ -113,6 +112,7 @@ fd_tpu_reasm_reset( fd_tpu_reasm_t * reasm ) {
     slot->k.conn_uid  = ULONG_MAX;
     slot->k.stream_id = 0xffffffffffff;
     slot->k.sz        = 0;
+    slot->k.prio      = 0;
     slot->chain_next = UINT_MAX;
     pub_slots[ j ]   = j;
   }
@@ -122,11 +122,18 @@ fd_tpu_reasm_reset( fd_tpu_reasm_t * reasm ) {
     slot->k.conn_uid  = ULONG_MAX;
     slot->k.stream_id = 0xffffffffffff;
     slot->k.sz        = 0;
+    slot->k.prio      = 0;
     slot->lru_prev    = fd_uint_if( j<node_cnt-1U, j+1U, UINT_MAX );
     slot->lru_next    = fd_uint_if( j>depth,       j-1U, UINT_MAX );
     slot->chain_next  = UINT_MAX;
   }
 
+  reasm->head      = node_cnt-1U;
+  reasm->tail      = depth;
+  reasm->prio_head = UINT_MAX;
+  reasm->prio_tail = UINT_MAX;
+  reasm->prio_cnt  = 0U;
+
   /* Clear the entire hash map */
 
   ulong  chain_cnt = fd_tpu_reasm_map_chain_cnt( map );
@@ -170,11 +177,27 @@ fd_tpu_reasm_slot_t *
 fd_tpu_reasm_prepare( fd_tpu_reasm_t * reasm,
                       ulong            conn_uid,
                       ulong            stream_id,
-                      long             tsorig ) {
-  fd_tpu_reasm_slot_t * slot = slotq_pop_tail( reasm );
+                      long             tsorig,
+                      int              prio ) {
+  prio = prio && reasm->prio_max;
+
+  fd_tpu_reasm_slot_t * slot;
+  if( prio && reasm->prio_cnt>=reasm->prio_max ) {
+    /* Prioritized queue full, evict least recent prioritized slot */
+    slot = fd_tpu_reasm_slots_laddr( reasm ) + reasm->prio_tail;
+    prioq_remove( reasm, slot );
+  } else {
+    /* Take a free slot or evict least recent unprioritized slot */
+    slot = slotq_pop_tail( reasm );
+  }
   smap_remove( reasm, slot );
   slot_begin( slot );
-  slotq_push_head( reasm, slot );
+  if( prio ) {
+    slot->k.prio = 1;
+    prioq_push_head( reasm, slot );
+  } else {
+    slotq_push_head( reasm, slot );
+  }
   slot->k.conn_uid  = conn_uid;
   slot->k.stream_id = stream_id & FD_TPU_REASM_SID_MASK;
   smap_insert( reasm, slot );
@@ -274,7 +297,7 @@ fd_tpu_reasm_publish( fd_tpu_reasm_t *      reasm,
 # endif
 
   /* Mark new slot as published */
-  slotq_remove( reasm, slot );
+  slot_dequeue( reasm, slot );
   slot->k.state = FD_TPU_REASM_STATE_PUB;
   *pub_slot = slot_idx;
 
@@ -298,7 +321,7 @@ void
 fd_tpu_reasm_cancel( fd_tpu_reasm_t *      reasm,
                      fd_tpu_reasm_slot_t * slot ) {
   if( FD_UNLIKELY( slot->k.state != FD_TPU_REASM_STATE_BUSY ) ) return;
-  slotq_remove( reasm, slot );
+  slot_dequeue( reasm, slot );
   smap_remove( reasm, slot );
   slot->k.state     = FD_TPU_REASM_STATE_FREE;
   slot->k.conn_uid  = ULONG_MAX;
@@ -172,6 +172,68 @@ slotq_remove( fd_tpu_reasm_t *      reasm,
   next->lru_prev = lru_prev;
 }
 
+/* Prioritized queue methods *******************************************
+
+   prioq is an LRU list of the slots of prioritized reassemblies
+   (k.prio==1).  Uses the same links as slotq (a slot is in exactly one
+   of them).  Unlike slotq, prioq may be empty. */
+
+/* prioq_push_head adds the given slot to the prioritized queue head. */
+
+static FD_FN_UNUSED void
+prioq_push_head( fd_tpu_reasm_t *      reasm,
+                 fd_tpu_reasm_slot_t * slot ) {
+
+  uint slot_idx = slot_get_idx( reasm, slot );
+  uint head_idx = reasm->prio_head;
+
+  slot->lru_prev = UINT_MAX;
+  slot->lru_next = head_idx;
+  if( head_idx==UINT_MAX ) reasm->prio_tail = slot_idx;
+  else                     fd_tpu_reasm_slots_laddr( reasm )[ head_idx ].lru_prev = slot_idx;
+  reasm->prio_head = slot_idx;
+  reasm->prio_cnt++;
+}
+
+/* prioq_remove removes a slot at an arbitrary position in the
+   prioritized queue. */
+
+static FD_FN_UNUSED void
+prioq_remove( fd_tpu_reasm_t *      reasm,
+              fd_tpu_reasm_slot_t * slot ) {
+
+  uint lru_prev = slot->lru_prev;
+  uint lru_next = slot->lru_next;
+
+  slot->lru_prev = UINT_MAX;
+  slot->lru_next = UINT_MAX;
+
+  if( FD_UNLIKELY( ( lru_prev!=UINT_MAX && lru_prev>=reasm->slot_cnt ) |
+                   ( lru_next!=UINT_MAX && lru_next>=reasm->slot_cnt ) ) ) {
+    FD_LOG_ERR(( "OOB prioq link (lru_prev=%u, lru_next=%u, slot_cnt=%u)", lru_prev, lru_next, reasm->slot_cnt ));
+  }
+
+  fd_tpu_reasm_slot_t * slots = fd_tpu_reasm_slots_laddr( reasm );
+  if( lru_prev==UINT_MAX ) reasm->prio_head = lru_next;
+  else                     slots[ lru_prev ].lru_next = lru_next;
+  if( lru_next==UINT_MAX ) reasm->prio_tail = lru_prev;
+  else                     slots[ lru_next ].lru_prev = lru_prev;
+  reasm->prio_cnt--;
+}
+
+/* slot_dequeue removes a BUSY slot from whichever queue it is in. */
+
+static FD_FN_UNUSED void
+slot_dequeue( fd_tpu_reasm_t *      reasm,
+              fd_tpu_reasm_slot_t * slot ) {
+  if( slot->k.prio ) {
+    prioq_remove( reasm, slot );
+    slot->k.prio = 0;
+  } else {
+    slotq_remove( reasm, slot );
+  }
+}
+
 static FD_FN_UNUSED void
 smap_insert( fd_tpu_reasm_t *      reasm,
              fd_tpu_reasm_slot_t * slot ) {
@@ -0,0 +1,150 @@
+#include "fd_tpu_stake.h"
+
+#define MAP_NAME              ip_stake_map
+#define MAP_T                 fd_tpu_stake_ele_t
+#define MAP_KEY_T             uint
+#define MAP_KEY               ip4
+#define MAP_LG_SLOT_CNT       FD_TPU_STAKE_LG_SLOT_CNT
+#define MAP_KEY_NULL          0U
+#define MAP_KEY_INVAL(k)      (!(k))
+#define MAP_KEY_EQUAL(k0,k1)  ((k0)==(k1))
+#define MAP_KEY_EQUAL_IS_SLOW 0
+#define MAP_MEMOIZE           0
+#define MAP_KEY_HASH(key)     fd_uint_hash( (key) )
+#include "../../util/tmpl/fd_map.c"
+
+FD_STATIC_ASSERT( FD_TPU_STAKE_MAX<=(1UL<<(FD_TPU_STAKE_LG_SLOT_CNT-1)), map_load );
+
+void *
+fd_tpu_stake_new( void *              shmem,
+                  fd_pubkey_t const * identity_key ) {
+  if( FD_UNLIKELY( !shmem ) ) {
+    FD_LOG_WARNING(( "NULL shmem" ));
+    return NULL;
+  }
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)shmem, fd_tpu_stake_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned shmem" ));
+    return NULL;
+  }
+  if( FD_UNLIKELY( !identity_key ) ) {
+    FD_LOG_WARNING(( "NULL identity_key" ));
+    return NULL;
+  }
+
+  fd_tpu_stake_t * stake = shmem;
+  stake->epoch           = ULONG_MAX;
+  stake->total_stake     = 0UL;
+  stake->staked_ip_cnt   = 0UL;
+  stake->contact_cnt_new = 0UL;
+  fd_stake_ci_join( fd_stake_ci_new( stake->stake_ci, identity_key ) );
+  ip_stake_map_new( stake->map );
+  return shmem;
+}
+
+fd_tpu_stake_t *
+fd_tpu_stake_join( void * shstake ) {
+  if( FD_UNLIKELY( !shstake ) ) {
+    FD_LOG_WARNING(( "NULL shstake" ));
+    return NULL;
+  }
+  return (fd_tpu_stake_t *)shstake;
+}
+
+void *
+fd_tpu_stake_leave( fd_tpu_stake_t * stake ) {
+  return (void *)stake;
+}
+
+void *
+fd_tpu_stake_delete( void * shstake ) {
+  return shstake;
+}
+
+/* rebuild recomputes the address map from the stakes and contact
+   infos of the lowest epoch known to stake_ci (see the header). */
+
+static void
+rebuild( fd_tpu_stake_t * stake ) {
+  fd_stake_ci_t const *       stake_ci = stake->stake_ci;
+  fd_per_epoch_info_t const * ei       = NULL;
+  for( ulong i=0UL; i<2UL; i++ ) {
+    fd_per_epoch_info_t const * cand = stake_ci->epoch_info + i;
+    if( !cand->slot_cnt ) continue; /* not known yet */
+    if( !ei || cand->epoch<ei->epoch ) ei = cand;
+  }
+
+  fd_tpu_stake_ele_t * map = stake->map;
+  ip_stake_map_clear( map );
+  stake->staked_ip_cnt = 0UL;
+  if( FD_UNLIKELY( !ei ) ) return;
+
+  fd_shred_dest_t * sdest         = ei->sdest;
+  ulong             staked_cnt    = fd_shred_dest_cnt_staked( sdest );
+  ulong             total         = ei->excluded_stake;
+  ulong             staked_ip_cnt = 0UL;
+  for( ulong i=0UL; i<staked_cnt; i++ ) {
+    fd_shred_dest_weighted_t const * dest = fd_shred_dest_idx_to_dest( sdest, (fd_shred_dest_idx_t)i );
+    total += dest->stake_lamports;
+
+    /* Skip nodes without contact info and the local validator (which
+       has a dummy address) */
+    uint ip4 = dest->ip4;
+    if( FD_UNLIKELY( !ip4 || !memcmp( dest->pubkey.uc, stake_ci->identity_key->uc, 32UL ) ) ) continue;
+
+    fd_tpu_stake_ele_t * ele = ip_stake_map_query( map, ip4, NULL );
+    if( !ele ) {
+      ele = ip_stake_map_insert( map, ip4 ); /* cannot fail, see map_load */
+      ele->stake = 0UL;
+      staked_ip_cnt++;
+    }
+    ele->stake += dest->stake_lamports;
+  }
+  stake->epoch         = ei->epoch;
+  stake->total_stake   = total;
+  stake->staked_ip_cnt = staked_ip_cnt;
+}
+
+void
+fd_tpu_stake_stake_msg_init( fd_tpu_stake_t * stake,
+                             uchar const *    msg ) {
+  fd_stake_ci_stake_msg_init( stake->stake_ci, msg );
+}
+
+void
+fd_tpu_stake_stake_msg_fini( fd_tpu_stake_t * stake ) {
+  fd_stake_ci_stake_msg_fini( stake->stake_ci );
+  rebuild( stake );
+}
+
+void
+fd_tpu_stake_contact_msg_init( fd_tpu_stake_t * stake,
+                               uchar const *    msg ) {
+  ulong const * hdr = fd_type_pun_const( msg );
+
+  ulong dest_cnt = hdr[ 0 ];
+  if( FD_UNLIKELY( dest_cnt>=FD_TPU_STAKE_MAX ) )
+    FD_LOG_ERR(( "contact info message has %lu destinations, which was more than the max of %lu", dest_cnt, FD_TPU_STAKE_MAX-1UL ));
+
+  fd_shred_dest_wire_t const * in_dests = fd_type_pun_const( hdr+1UL );
+  fd_shred_dest_weighted_t *   dests    = fd_stake_ci_dest_add_init( stake->stake_ci );
+  for( ulong i=0UL; i<dest_cnt; i++ ) {
+    memcpy( dests[ i ].pubkey.uc, in_dests[ i ].pubkey, 32UL );
+    dests[ i ].ip4  = in_dests[ i ].ip4_addr;
+    dests[ i ].port = in_dests[ i ].udp_port;
+  }
+  stake->contact_cnt_new = dest_cnt;
+}
+
+void
+fd_tpu_stake_contact_msg_fini( fd_tpu_stake_t * stake ) {
+  fd_stake_ci_dest_add_fini( stake->stake_ci, stake->contact_cnt_new );
+  rebuild( stake );
+}
+
+ulong
+fd_tpu_stake_query( fd_tpu_stake_t const * stake,
+                    uint                   ip4 ) {
+  if( FD_UNLIKELY( !ip4 ) ) return 0UL;
+  fd_tpu_stake_ele_t const * ele = ip_stake_map_query_const( stake->map, ip4, NULL );
+  return ele ? ele->stake : 0UL;
+}
@@ -0,0 +1,132 @@
+#ifndef HEADER_fd_src_disco_quic_fd_tpu_stake_h
+#define HEADER_fd_src_disco_quic_fd_tpu_stake_h
+
+/* fd_tpu_stake maps the IPv4 addresses of TPU clients to the stake of
+   the validators behind them.  It is used by the QUIC tile to give
+   staked peers priority over unstaked ones.
+
+   TPU/QUIC clients are not authenticated by node identity.  Instead,
+   fd_tpu_stake joins the stake weights published on the stake_out link
+   (node identity -> stake) with the cluster contact info published on
+   the crds_shred link (node identity -> IPv4 address).  The stake of an
+   address is the sum of the stakes of all validators advertising it.
+
+   Both inputs are tracked with an fd_stake_ci, which keeps the stake
+   weights of two epochs (stake_out publishes the stakes of epoch N+1
+   early in epoch N).  The QUIC tile does not follow the slot clock, so
+   the address map is built from the lowest epoch known, i.e. the
+   current one.  A message for the next epoch does not replace the
+   current stakes; they are replaced once the message for the epoch
+   after next arrives (right after the epoch boundary).
+
+   Updates follow the same two-phase pattern as fd_stake_ci: the
+   *_msg_init functions copy a message out of a dcache (and can be
+   called in during_frag), the *_msg_fini functions apply it (and should
+   be called in after_frag, i.e. only if the message was not overrun).
+
+   fd_tpu_stake_t is statically sized (~40 MB, mostly fd_stake_ci_t). */
+
+#include "../fd_disco.h"
+#include "../shred/fd_stake_ci.h"
+
+/* FD_TPU_STAKE_MAX is the max number of stake weights and contact
+   infos. */
+
+#define FD_TPU_STAKE_MAX MAX_SHRED_DESTS
+
+#define FD_TPU_STAKE_LG_SLOT_CNT (17)
+
+struct fd_tpu_stake_ele {
+  uint  ip4;   /* network byte order, 0 means free */
+  ulong stake; /* lamports */
+};
+
+typedef struct fd_tpu_stake_ele fd_tpu_stake_ele_t;
+
+struct fd_tpu_stake {
+  ulong epoch;           /* epoch of the stakes in map, ULONG_MAX if none */
+  ulong total_stake;     /* total stake of epoch */
+  ulong staked_ip_cnt;   /* number of staked addresses in map */
+  ulong contact_cnt_new; /* number of contact infos pending dest_add_fini */
+
+  fd_stake_ci_t      stake_ci[ 1 ];
+  fd_tpu_stake_ele_t map[ 1UL<<FD_TPU_STAKE_LG_SLOT_CNT ];
+};
+
+typedef struct fd_tpu_stake fd_tpu_stake_t;
+
+FD_PROTOTYPES_BEGIN
+
+/* fd_tpu_stake_{align,footprint,new,join,leave,delete} follow the usual
+   conventions.  identity_key is the identity of the local validator (as
+   required by fd_stake_ci, no interest is retained).  A new
+   fd_tpu_stake_t knows no stakes. */
+
+FD_FN_CONST static inline ulong fd_tpu_stake_align    ( void ) { return alignof(fd_tpu_stake_t); }
+FD_FN_CONST static inline ulong fd_tpu_stake_footprint( void ) { return sizeof (fd_tpu_stake_t); }
+
+void *
+fd_tpu_stake_new( void *              shmem,
+                  fd_pubkey_t const * identity_key );
+
+fd_tpu_stake_t *
+fd_tpu_stake_join( void * shstake );
+
+void *
+fd_tpu_stake_leave( fd_tpu_stake_t * stake );
+
+void *
+fd_tpu_stake_delete( void * shstake );
+
+/* fd_tpu_stake_stake_msg_{init,fini} handle a new stake weights message
+   as published to the stake_out link (see fd_stake_ci_stake_msg_init
+   for the format and requirements).  Logs an error and terminates the
+   calling process if the message is malformed. */
+
+void fd_tpu_stake_stake_msg_init( fd_tpu_stake_t * stake, uchar const * msg );
+void fd_tpu_stake_stake_msg_fini( fd_tpu_stake_t * stake );
+
+/* fd_tpu_stake_contact_msg_{init,fini} handle a new cluster contact
+   info message as published to the crds_shred link (a ulong count
+   followed by that many fd_shred_dest_wire_t, not including the local
+   validator).  Logs an error and terminates the calling process if the
+   message is malformed. */
+
+void fd_tpu_stake_contact_msg_init( fd_tpu_stake_t * stake, uchar const * msg );
+void fd_tpu_stake_contact_msg_fini( fd_tpu_stake_t * stake );
+
+/* fd_tpu_stake_query returns the stake in lamports behind the IPv4
+   address ip4 (network byte order).  Returns 0 if unknown. */
+
+FD_FN_PURE ulong
+fd_tpu_stake_query( fd_tpu_stake_t const * stake,
+                    uint                   ip4 );
+
+/* fd_tpu_stake_epoch returns the epoch whose stakes are used, or
+   ULONG_MAX if no stake message was received yet. */
+
+FD_FN_PURE static inline ulong
+fd_tpu_stake_epoch( fd_tpu_stake_t const * stake ) {
+  return stake->epoch;
+}
+
+/* fd_tpu_stake_total returns the total stake in lamports of
+   fd_tpu_stake_epoch.  Returns 0 if no stake message was received
+   yet. */
+
+FD_FN_PURE static inline ulong
+fd_tpu_stake_total( fd_tpu_stake_t const * stake ) {
+  return stake->total_stake;
+}
+
+/* fd_tpu_stake_staked_ip_cnt returns the number of IPv4 addresses with
+   non-zero stake. */
+
+FD_FN_PURE static inline ulong
+fd_tpu_stake_staked_ip_cnt( fd_tpu_stake_t const * stake ) {
+  return stake->staked_ip_cnt;
+}
+
+FD_PROTOTYPES_END
+
+#endif /* HEADER_fd_src_disco_quic_fd_tpu_stake_h */
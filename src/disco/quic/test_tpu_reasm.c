@@ -23,6 +23,10 @@ verify_state( fd_tpu_reasm_t * reasm,
   FD_TEST( depth+burst==slot_cnt );
   FD_TEST( reasm->head <slot_cnt );
   FD_TEST( reasm->tail <slot_cnt );
+  FD_TEST( reasm->prio_cnt<=reasm->prio_max );
+  FD_TEST( reasm->prio_max+2U==burst );
+
+  uint main_cnt = burst - reasm->prio_cnt;
 
   /* Check for invalid state and duplicates in mcache */
 
@@ -50,8 +54,9 @@ verify_state( fd_tpu_reasm_t * reasm,
     FD_TEST( node<slot_cnt );
     fd_tpu_reasm_slot_t * slot = slots + node;
     queue_head_depth++;
-    FD_TEST( queue_head_depth<=burst );
-    FD_TEST( !((node==reasm->tail) ^ (queue_head_depth==burst)) );
+    FD_TEST( queue_head_depth<=main_cnt );
+    FD_TEST( !((node==reasm->tail) ^ (queue_head_depth==main_cnt)) );
+    FD_TEST( !slot->k.prio );
     node = slot->lru_next;
     free_cnt += (slot->k.state==FD_TPU_REASM_STATE_FREE);
 
@@ -62,7 +67,7 @@ verify_state( fd_tpu_reasm_t * reasm,
       FD_TEST( slot2==NULL || slot==slot2 );  /* optionally in map */
     }
   }
-  FD_TEST( queue_head_depth==burst );
+  FD_TEST( queue_head_depth==main_cnt );
 
   /* Scan slots via queue (tail to head) */
 
@@ -71,11 +76,30 @@ verify_state( fd_tpu_reasm_t * reasm,
     FD_TEST( node<slot_cnt );
     fd_tpu_reasm_slot_t * slot = slots + node;
     queue_tail_depth++;
-    FD_TEST( queue_tail_depth<=burst );
-    FD_TEST( !((node==reasm->head) ^ (queue_tail_depth==burst)) );
+    FD_TEST( queue_tail_depth<=main_cnt );
+    FD_TEST( !((node==reasm->head) ^ (queue_tail_depth==main_cnt)) );
     node = slot->lru_prev;
   }
-  FD_TEST( queue_tail_depth==burst );
+  FD_TEST( queue_tail_depth==main_cnt );
+
+  /* Scan prioritized queue (head to tail and back) */
+
+  ulong prio_depth = 0UL;
+  uint  prev       = UINT_MAX;
+  for( uint node = reasm->prio_head; node!=UINT_MAX; ) {
+    FD_TEST( node<slot_cnt );
+    fd_tpu_reasm_slot_t * slot = slots + node;
+    prio_depth++;
+    FD_TEST( prio_depth<=reasm->prio_cnt );
+    FD_TEST( slot->k.prio );
+    FD_TEST( slot->k.state==FD_TPU_REASM_STATE_BUSY );
+    FD_TEST( slot->lru_prev==prev );
+    FD_TEST( smap_query( reasm, slot->k.conn_uid, slot->k.stream_id )==slot );
+    prev = node;
+    node = slot->lru_next;
+  }
+  FD_TEST( prio_depth==reasm->prio_cnt );
+  FD_TEST( reasm->prio_tail==prev );
 
   return free_cnt;
 }
@@ -121,7 +145,7 @@ main( int     argc,
   void * dcache    = fd_dcache_join( fd_dcache_new( dcache_mem, dcache_sz, 0UL ) );
   FD_TEST( dcache );
 
-  static uchar __attribute__((aligned(FD_TPU_REASM_ALIGN))) tpu_reasm_mem[ 9344 ];
+  static uchar __attribute__((aligned(FD_TPU_REASM_ALIGN))) tpu_reasm_mem[ 9408 ];
   FD_LOG_INFO(( "fd_tpu_reasm_footprint(%lu,%lu)==%lu", depth, burst, fd_tpu_reasm_footprint( depth, burst ) ));
   FD_TEST( sizeof(tpu_reasm_mem)==fd_tpu_reasm_footprint( depth, burst ) );
 
@@ -156,7 +180,7 @@ main( int     argc,
   /* Publish frags */
 
   for( ulong j=0UL; j<burst; j++ ) {
-    fd_tpu_reasm_slot_t * slot = fd_tpu_reasm_acquire( reasm, 0UL, j, 0UL );
+    fd_tpu_reasm_slot_t * slot = fd_tpu_reasm_acquire( reasm, 0UL, j, 0UL, 0 );
     FD_TEST( slot );
     uint idx = slot_get_idx( reasm, slot );
 
@@ -175,7 +199,7 @@ main( int     argc,
   /* Confirm that 'burst' cnt slots can be active */
 
   for( ulong j=0UL; j<burst; j++ ) {
-    fd_tpu_reasm_slot_t * slot = fd_tpu_reasm_acquire( reasm, 0UL, j, 0UL );
+    fd_tpu_reasm_slot_t * slot = fd_tpu_reasm_acquire( reasm, 0UL, j, 0UL, 0 );
     uint idx = slot_get_idx( reasm, slot );
     uchar * data = slot_get_data( reasm, idx );
     FD_TEST( slot->k.sz==8 );
@@ -190,7 +214,7 @@ main( int     argc,
   FD_LOG_INFO(( "Test basic publishing" ));
 
   do {
-    fd_tpu_reasm_slot_t * slot = fd_tpu_reasm_acquire( reasm, 0UL, 0UL, 0UL );
+    fd_tpu_reasm_slot_t * slot = fd_tpu_reasm_acquire( reasm, 0UL, 0UL, 0UL, 0 );
     FD_TEST( slot->k.state == FD_TPU_REASM_STATE_BUSY );
     FD_TEST( fd_tpu_reasm_frag( reasm, slot, transaction4, transaction4_sz, 0UL )
              == FD_TPU_REASM_SUCCESS );
@@ -216,7 +240,7 @@ main( int     argc,
 
   uint free_cnt;
   for( ulong j=0UL; j<2*burst; j++ ) {
-    fd_tpu_reasm_slot_t * slot = fd_tpu_reasm_acquire( reasm, j, 1UL, 0UL );
+    fd_tpu_reasm_slot_t * slot = fd_tpu_reasm_acquire( reasm, j, 1UL, 0UL, 0 );
     FD_TEST( slot->k.state == FD_TPU_REASM_STATE_BUSY );
     free_cnt = verify_state( reasm, mcache );
     FD_TEST( (long)free_cnt==fd_long_max( (long)burst-(long)j-1L, 0L ) );
@@ -238,7 +262,7 @@ main( int     argc,
 
     switch( slot->k.state ) {
     case FD_TPU_REASM_STATE_FREE:
-      FD_TEST( fd_tpu_reasm_acquire( reasm, fd_rng_ulong( rng ), fd_rng_ulong( rng ), 0UL ) );
+      FD_TEST( fd_tpu_reasm_acquire( reasm, fd_rng_ulong( rng ), fd_rng_ulong( rng ), 0UL, (int)( fd_rng_uint( rng )&1U ) ) );
         check_free_diff( verify_state( reasm, mcache ), -1L );
       continue;
     case FD_TPU_REASM_STATE_BUSY: {
@@ -265,6 +289,70 @@ main( int     argc,
     }
   }
 
+  FD_LOG_INFO(( "Test prioritized eviction" ));
+
+  fd_tpu_reasm_reset( reasm );
+  verify_state( reasm, mcache );
+
+  /* Fill all slots with unprioritized reassemblies */
+
+  for( ulong j=0UL; j<burst; j++ ) {
+    FD_TEST( fd_tpu_reasm_prepare( reasm, 1UL, j, 0L, 0 ) );
+  }
+  FD_TEST( verify_state( reasm, mcache )==0U );
+
+  /* Prioritized reassemblies evict unprioritized ones, oldest first */
+
+  for( ulong j=0UL; j<burst-2UL; j++ ) {
+    fd_tpu_reasm_slot_t * victim = fd_tpu_reasm_peek_victim( reasm, 1 );
+    FD_TEST( victim->k.state==FD_TPU_REASM_STATE_BUSY );
+    FD_TEST( !victim->k.prio );
+    FD_TEST( victim->k.stream_id==j );
+    fd_tpu_reasm_slot_t * slot = fd_tpu_reasm_prepare( reasm, 2UL, j, 0L, 1 );
+    FD_TEST( slot==victim );
+    FD_TEST( slot->k.prio );
+    FD_TEST( !fd_tpu_reasm_query( reasm, 1UL, j ) );
+  }
+  verify_state( reasm, mcache );
+  FD_TEST( reasm->prio_cnt==reasm->prio_max );
+
+  /* Unprioritized reassemblies never evict prioritized ones */
+
+  for( ulong j=0UL; j<4UL*burst; j++ ) {
+    fd_tpu_reasm_slot_t * slot = fd_tpu_reasm_prepare( reasm, 3UL, j, 0L, 0 );
+    FD_TEST( !slot->k.prio );
+  }
+  verify_state( reasm, mcache );
+  for( ulong j=0UL; j<burst-2UL; j++ ) {
+    fd_tpu_reasm_slot_t * slot = fd_tpu_reasm_query( reasm, 2UL, j );
+    FD_TEST( slot && slot->k.state==FD_TPU_REASM_STATE_BUSY );
+  }
+
+  /* Full prioritized queue evicts oldest prioritized reassembly */
+
+  fd_tpu_reasm_slot_t * victim = fd_tpu_reasm_peek_victim( reasm, 1 );
+  FD_TEST( victim->k.prio && victim->k.conn_uid==2UL && victim->k.stream_id==0UL );
+  FD_TEST( fd_tpu_reasm_prepare( reasm, 2UL, burst, 0L, 1 )==victim );
+  FD_TEST( !fd_tpu_reasm_query( reasm, 2UL, 0UL ) );
+  verify_state( reasm, mcache );
+
+  /* Cancelling and publishing prioritized slots frees them */
+
+  fd_tpu_reasm_cancel( reasm, fd_tpu_reasm_query( reasm, 2UL, 1UL ) );
+  FD_TEST( verify_state( reasm, mcache )==1U );
+  FD_TEST( reasm->prio_cnt==reasm->prio_max-1U );
+  do {
+    fd_tpu_reasm_slot_t * slot = fd_tpu_reasm_query( reasm, 2UL, 2UL );
+    FD_TEST( fd_tpu_reasm_frag( reasm, slot, transaction4, transaction4_sz, 0UL )
+             == FD_TPU_REASM_SUCCESS );
+    FD_TEST( fd_tpu_reasm_publish( reasm, slot, mcache, base, seq, 0L )
+             == FD_TPU_REASM_SUCCESS );
+    seq = fd_seq_inc( seq, 1UL );
+    FD_TEST( !slot->k.prio );
+  } while(0);
+  FD_TEST( reasm->prio_cnt==reasm->prio_max-2U );
+  FD_TEST( verify_state( reasm, mcache )==2U );
+
   /* Clean up */
 
   fd_tpu_reasm_delete( fd_tpu_reasm_leave( reasm  ) );
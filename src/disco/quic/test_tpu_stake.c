@@ -0,0 +1,180 @@
+#include "fd_tpu_stake.h"
+
+static uchar __attribute__((aligned(128))) stake_mem[ sizeof(fd_tpu_stake_t) ];
+static uchar __attribute__((aligned(8)))   msg_buf  [ FD_STAKE_CI_STAKE_MSG_SZ ];
+
+#define SLOTS_PER_EPOCH (432000UL)
+
+/* Node i has stake stake_of( i ).  Stakes are distinct and descending
+   in i, such that stake messages listing nodes in order of i are
+   sorted the way fd_stake_ci requires. */
+
+#define STAKE_BASE (1UL<<20)
+
+static ulong stake_of( ulong i ) { return (STAKE_BASE-i)*1000UL; }
+
+static ulong
+stake_sum( ulong cnt ) {
+  return 1000UL*( cnt*STAKE_BASE - (cnt*(cnt-1UL))/2UL );
+}
+
+static void
+make_pubkey( uchar * out,
+             ulong   idx ) {
+  /* fd_shred_dest hashes pubkeys by their second word, so all words
+     need to look random */
+  for( ulong i=0UL; i<4UL; i++ ) FD_STORE( ulong, out+8UL*i, fd_ulong_hash( 4UL*idx+i+1UL ) );
+}
+
+#define IDENTITY_IDX (ULONG_MAX)
+
+/* send_stakes delivers a stake message for epoch where nodes [0,cnt)
+   are staked.  If with_self, the local validator is staked too (with
+   the least stake). */
+
+static void
+send_stakes( fd_tpu_stake_t * stake,
+             ulong            epoch,
+             ulong            cnt,
+             int              with_self,
+             ulong            excluded ) {
+  ulong * hdr = (ulong *)msg_buf;
+  hdr[ 0 ] = epoch;
+  hdr[ 1 ] = cnt + !!with_self;
+  hdr[ 2 ] = epoch*SLOTS_PER_EPOCH; /* start_slot */
+  hdr[ 3 ] = SLOTS_PER_EPOCH;
+  hdr[ 4 ] = excluded;
+  fd_stake_weight_t * weights = (fd_stake_weight_t *)( hdr+5UL );
+  for( ulong i=0UL; i<cnt; i++ ) {
+    make_pubkey( weights[ i ].key.uc, i );
+    weights[ i ].stake = stake_of( i );
+  }
+  if( with_self ) {
+    make_pubkey( weights[ cnt ].key.uc, IDENTITY_IDX );
+    weights[ cnt ].stake = 1UL;
+  }
+  fd_tpu_stake_stake_msg_init( stake, msg_buf );
+  fd_tpu_stake_stake_msg_fini( stake );
+}
+
+/* send_contacts delivers a contact info message where node i in
+   [0,cnt) has IPv4 address ip_of( i ), except that node 0 has address
+   ip0 */
+
+static uint ip_of( ulong i ) { return (uint)( 0x0a000000UL + (i>>1) ); } /* two nodes per IP */
+
+static void
+send_contacts( fd_tpu_stake_t * stake,
+               ulong            cnt,
+               uint             ip0 ) {
+  ulong * hdr = (ulong *)msg_buf;
+  hdr[ 0 ] = cnt;
+  fd_shred_dest_wire_t * dests = (fd_shred_dest_wire_t *)( hdr+1UL );
+  for( ulong i=0UL; i<cnt; i++ ) {
+    make_pubkey( dests[ i ].pubkey->uc, i );
+    dests[ i ].ip4_addr = i ? ip_of( i ) : ip0;
+    dests[ i ].udp_port = 8001;
+  }
+  fd_tpu_stake_contact_msg_init( stake, msg_buf );
+  fd_tpu_stake_contact_msg_fini( stake );
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  fd_pubkey_t identity[1];
+  make_pubkey( identity->uc, IDENTITY_IDX );
+
+  FD_TEST( fd_tpu_stake_footprint()==sizeof(fd_tpu_stake_t) );
+  FD_TEST( fd_tpu_stake_align()<=128UL );
+  FD_TEST( !fd_tpu_stake_new( NULL,         identity ) );
+  FD_TEST( !fd_tpu_stake_new( stake_mem+1UL, identity ) );
+  FD_TEST( !fd_tpu_stake_new( stake_mem,    NULL     ) );
+
+  fd_tpu_stake_t * stake = fd_tpu_stake_join( fd_tpu_stake_new( stake_mem, identity ) );
+  FD_TEST( stake );
+
+  /* Nothing known */
+
+  FD_TEST( fd_tpu_stake_epoch( stake )==ULONG_MAX );
+  FD_TEST( fd_tpu_stake_total( stake )==0UL );
+  FD_TEST( fd_tpu_stake_query( stake, ip_of( 0UL ) )==0UL );
+  FD_TEST( fd_tpu_stake_query( stake, 0U )==0UL );
+
+  /* Stakes without contact info */
+
+  send_stakes( stake, 1UL, 1000UL, 0, 0UL );
+  FD_TEST( fd_tpu_stake_epoch( stake )==1UL );
+  FD_TEST( fd_tpu_stake_total( stake )==stake_sum( 1000UL ) );
+  FD_TEST( fd_tpu_stake_staked_ip_cnt( stake )==0UL );
+  FD_TEST( fd_tpu_stake_query( stake, ip_of( 0UL ) )==0UL );
+
+  /* Contact info for some staked and some unstaked nodes */
+
+  send_contacts( stake, 2000UL, ip_of( 0UL ) );
+  FD_TEST( fd_tpu_stake_staked_ip_cnt( stake )==500UL );
+  for( ulong i=0UL; i<1000UL; i+=2UL ) {
+    FD_TEST( fd_tpu_stake_query( stake, ip_of( i ) )==stake_of( i )+stake_of( i+1UL ) );
+  }
+  for( ulong i=1000UL; i<2000UL; i+=2UL ) {
+    FD_TEST( fd_tpu_stake_query( stake, ip_of( i ) )==0UL );
+  }
+
+  /* The stakes of the next epoch are known early, but do not replace
+     the stakes of the current epoch */
+
+  send_stakes( stake, 2UL, 10UL, 0, 0UL );
+  FD_TEST( fd_tpu_stake_epoch( stake )==1UL );
+  FD_TEST( fd_tpu_stake_total( stake )==stake_sum( 1000UL ) );
+  FD_TEST( fd_tpu_stake_staked_ip_cnt( stake )==500UL );
+  FD_TEST( fd_tpu_stake_query( stake, ip_of( 10UL ) )==stake_of( 10UL )+stake_of( 11UL ) );
+
+  /* Once the stakes of the epoch after next arrive, epoch 2 is the
+     current one.  Contact infos carry over. */
+
+  send_stakes( stake, 3UL, 20UL, 0, 0UL );
+  FD_TEST( fd_tpu_stake_epoch( stake )==2UL );
+  FD_TEST( fd_tpu_stake_total( stake )==stake_sum( 10UL ) );
+  FD_TEST( fd_tpu_stake_staked_ip_cnt( stake )==5UL );
+  FD_TEST( fd_tpu_stake_query( stake, ip_of( 8UL ) )==stake_of( 8UL )+stake_of( 9UL ) );
+  FD_TEST( fd_tpu_stake_query( stake, ip_of( 10UL ) )==0UL );
+
+  /* Contact update: node 0 moves to a new address */
+
+  uint new_ip = 0x0b000000U;
+  send_contacts( stake, 2000UL, new_ip );
+  FD_TEST( fd_tpu_stake_staked_ip_cnt( stake )==6UL );
+  FD_TEST( fd_tpu_stake_query( stake, ip_of( 0UL ) )==stake_of( 1UL ) );
+  FD_TEST( fd_tpu_stake_query( stake, new_ip       )==stake_of( 0UL ) );
+
+  /* The local validator has no address (fd_stake_ci gives it a dummy
+     one) but counts towards the total */
+
+  send_stakes( stake, 4UL, 10UL, 1, 0UL );
+  send_stakes( stake, 5UL, 10UL, 1, 0UL );
+  FD_TEST( fd_tpu_stake_epoch( stake )==4UL );
+  FD_TEST( fd_tpu_stake_total( stake )==stake_sum( 10UL )+1UL );
+  FD_TEST( fd_tpu_stake_staked_ip_cnt( stake )==6UL );
+  FD_TEST( fd_tpu_stake_query( stake, 1U )==0UL );
+
+  /* Max size messages.  Stake is only excluded if there are more
+     staked nodes than destinations, in which case the local validator
+     must be staked, and there is no room for unstaked nodes. */
+
+  ulong max = FD_TPU_STAKE_MAX-1UL;
+  send_stakes  ( stake, 6UL, max, 1, 7UL );
+  send_stakes  ( stake, 7UL, max, 1, 7UL );
+  send_contacts( stake, max, ip_of( 0UL ) );
+  FD_TEST( fd_tpu_stake_epoch( stake )==6UL );
+  FD_TEST( fd_tpu_stake_total( stake )==stake_sum( max )+1UL+7UL );
+  FD_TEST( fd_tpu_stake_staked_ip_cnt( stake )==(max+1UL)/2UL );
+  FD_TEST( fd_tpu_stake_query( stake, ip_of( max-3UL ) )==stake_of( max-3UL )+stake_of( max-2UL ) );
+
+  fd_tpu_stake_delete( fd_tpu_stake_leave( stake ) );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
@@ -109,6 +109,7 @@ struct fd_rpc_global_ctx {
   fd_funk_t * funk;
   fd_blockstore_t * blockstore;
   int blockstore_fd;
+  fd_blockstore_codec_t * codec;
   struct fd_ws_subscription sub_list[FD_WS_MAX_SUBS];
   ulong sub_cnt;
   ulong last_subsc_id;
@@ -517,7 +518,7 @@ method_getBlock(struct json_values* values, fd_rpc_ctx_t * ctx) {
   fd_block_rewards_t rewards[1];
   fd_hash_t parent_hash;
   uchar * blk_data;
-  if( fd_blockstore_block_data_query_volatile( blockstore, ctx->global->blockstore_fd, slotn, fd_scratch_virtual(), &parent_hash, meta, rewards, &blk_data, &blk_sz ) ) {
+  if( fd_blockstore_block_data_query_volatile( blockstore, ctx->global->blockstore_fd, ctx->global->codec, slotn, fd_scratch_virtual(), &parent_hash, meta, rewards, &blk_data, &blk_sz ) ) {
     fd_method_error(ctx, -1, "failed to display block for slot %lu", slotn);
     return 0;
   }
@@ -2458,6 +2459,11 @@ fd_rpc_create_ctx(fd_rpcserver_args_t * args, fd_rpc_ctx_t ** ctx_p) {
   gctx->valloc = valloc;
   gctx->stake_ci = args->stake_ci;
 
+  /* Archived blocks are only decompressed here */
+  void * codec_mem = fd_valloc_malloc( valloc, fd_blockstore_codec_align(), fd_blockstore_codec_footprint( 0 ) );
+  gctx->codec = fd_blockstore_codec_new( codec_mem, 0 );
+  if( FD_UNLIKELY( !gctx->codec ) ) FD_LOG_ERR(( "failed to create blockstore codec" ));
+
   if( !args->offline ) {
     gctx->tpu_socket = socket(AF_INET, SOCK_DGRAM, 0);
     if( gctx->tpu_socket == -1 ) {
@@ -1,6 +1,7 @@
 #include "../../ballet/shred/fd_shred.h"
 #include "../../ballet/shred/fd_fec_set.h"
 #include "../../ballet/bmtree/fd_bmtree.h"
+#include "../../ballet/sha256/fd_sha256.h"
 #include "../../ballet/sha512/fd_sha512.h"
 #include "../../ballet/ed25519/fd_ed25519.h"
 #include "../../ballet/reedsol/fd_reedsol.h"
@@ -571,29 +572,28 @@ int fd_fec_resolver_add_shred( fd_fec_resolver_t    * resolver,
 
   uchar const * chained_root = fd_ptr_if( fd_shred_is_chained( shred_type ), (uchar *)shred+fd_shred_chain_off( variant ), NULL );
 
-  /* Iterate over recovered shreds, add them to the Merkle tree,
-     populate headers and signatures. */
+  /* Iterate over recovered shreds, populate headers and hash their
+     Merkle leaves.  As in fd_shredder, the leaves are hashed with the
+     batch SHA-256 API by temporarily placing the leaf prefix in the
+     last bytes of the signature field, which gets filled in below. */
+  fd_sha256_batch_t   _sha256[1];
+  fd_sha256_batch_t * sha256 = fd_sha256_batch_init( _sha256 );
+  fd_bmtree_node_t    rcvr_leaf[ FD_REEDSOL_DATA_SHREDS_MAX + FD_REEDSOL_PARITY_SHREDS_MAX ];
+
   for( ulong i=0UL; i<set->data_shred_cnt; i++ ) {
     if( !d_rcvd_test( set->data_shred_rcvd, i ) ) {
-      fd_memcpy( set->data_shreds[i], shred, sizeof(fd_ed25519_sig_t) );
       if( FD_UNLIKELY( fd_shred_is_chained( shred_type ) ) ) {
         fd_memcpy( set->data_shreds[i]+fd_shred_chain_off( data_variant ), chained_root, FD_SHRED_MERKLE_ROOT_SZ );
       }
-      fd_bmtree_hash_leaf( leaf, set->data_shreds[i]+sizeof(fd_ed25519_sig_t), data_merkle_protected_sz, FD_BMTREE_LONG_PREFIX_SZ );
-      if( FD_UNLIKELY( !fd_bmtree_commitp_insert_with_proof( tree, i, leaf, NULL, 0, NULL ) ) ) {
-        freelist_push_tail( free_list,        set  );
-        bmtrlist_push_tail( bmtree_free_list, tree );
-        FD_MCNT_INC( SHRED, FEC_REJECTED_FATAL, 1UL );
-        return FD_FEC_RESOLVER_SHRED_REJECTED;
-      }
-
+      uchar * leaf_data = set->data_shreds[i]+sizeof(fd_ed25519_sig_t)-FD_BMTREE_LONG_PREFIX_SZ;
+      fd_memcpy( leaf_data, fd_bmtree_leaf_prefix, FD_BMTREE_LONG_PREFIX_SZ );
+      fd_sha256_batch_add( sha256, leaf_data, data_merkle_protected_sz+FD_BMTREE_LONG_PREFIX_SZ, rcvr_leaf[i].hash );
     }
   }
 
   for( ulong i=0UL; i<set->parity_shred_cnt; i++ ) {
     if( !p_rcvd_test( set->parity_shred_rcvd, i ) ) {
       fd_shred_t * p_shred = (fd_shred_t *)set->parity_shreds[i]; /* We can't parse because we haven't populated the header */
-      fd_memcpy( p_shred->signature, shred->signature, sizeof(fd_ed25519_sig_t) );
       p_shred->variant       = parity_variant;
       p_shred->slot          = shred->slot;
       p_shred->idx           = (uint)(i + parity_idx0);
@@ -607,8 +607,32 @@ int fd_fec_resolver_add_shred( fd_fec_resolver_t    * resolver,
         fd_memcpy( set->parity_shreds[i]+fd_shred_chain_off( parity_variant ), chained_root, FD_SHRED_MERKLE_ROOT_SZ );
       }
 
-      fd_bmtree_hash_leaf( leaf, set->parity_shreds[i]+ sizeof(fd_ed25519_sig_t), parity_merkle_protected_sz, FD_BMTREE_LONG_PREFIX_SZ );
-      if( FD_UNLIKELY( !fd_bmtree_commitp_insert_with_proof( tree, set->data_shred_cnt + i, leaf, NULL, 0, NULL ) ) ) {
+      uchar * leaf_data = set->parity_shreds[i]+sizeof(fd_ed25519_sig_t)-FD_BMTREE_LONG_PREFIX_SZ;
+      fd_memcpy( leaf_data, fd_bmtree_leaf_prefix, FD_BMTREE_LONG_PREFIX_SZ );
+      fd_sha256_batch_add( sha256, leaf_data, parity_merkle_protected_sz+FD_BMTREE_LONG_PREFIX_SZ, rcvr_leaf[set->data_shred_cnt+i].hash );
+    }
+  }
+
+  fd_sha256_batch_fini( sha256 );
+
+  /* Add the recovered shreds to the Merkle tree and write their
+     signatures. */
+  for( ulong i=0UL; i<set->data_shred_cnt; i++ ) {
+    if( !d_rcvd_test( set->data_shred_rcvd, i ) ) {
+      fd_memcpy( set->data_shreds[i], shred, sizeof(fd_ed25519_sig_t) );
+      if( FD_UNLIKELY( !fd_bmtree_commitp_insert_with_proof( tree, i, rcvr_leaf+i, NULL, 0, NULL ) ) ) {
+        freelist_push_tail( free_list,        set  );
+        bmtrlist_push_tail( bmtree_free_list, tree );
+        FD_MCNT_INC( SHRED, FEC_REJECTED_FATAL, 1UL );
+        return FD_FEC_RESOLVER_SHRED_REJECTED;
+      }
+    }
+  }
+
+  for( ulong i=0UL; i<set->parity_shred_cnt; i++ ) {
+    if( !p_rcvd_test( set->parity_shred_rcvd, i ) ) {
+      fd_memcpy( set->parity_shreds[i], shred->signature, sizeof(fd_ed25519_sig_t) );
+      if( FD_UNLIKELY( !fd_bmtree_commitp_insert_with_proof( tree, set->data_shred_cnt + i, rcvr_leaf+set->data_shred_cnt+i, NULL, 0, NULL ) ) ) {
         freelist_push_tail( free_list,        set  );
         bmtrlist_push_tail( bmtree_free_list, tree );
         FD_MCNT_INC( SHRED, FEC_REJECTED_FATAL, 1UL );
@@ -282,11 +282,18 @@ fd_shred_dest_compute_first( fd_shred_dest_t          * sdest,
     fd_wsample_remove_idx( sdest->staked, sdest->source_validator_orig_idx );
 
   int any_staked_candidates = sdest->staked_cnt > (ulong)source_validator_is_staked;
-  for( ulong i=0UL; i<shred_cnt; i++ ) {
-    fd_wsample_seed_rng( fd_wsample_get_rng( sdest->staked ), dest_hash_outputs[ i ] );
+  if( FD_LIKELY( any_staked_candidates ) ) {
+    /* Each shred takes exactly one sample with its own seed from the
+       same tree, so we can do all of them together. */
+    ulong samples[ FD_SHRED_DEST_MAX_SHRED_CNT ];
+    fd_wsample_sample_many_seeded( sdest->staked, (uchar const *)dest_hash_outputs, samples, shred_cnt );
     /* Map FD_WSAMPLE_INDETERMINATE to FD_SHRED_DEST_NO_DEST */
-    if( FD_LIKELY( any_staked_candidates ) ) out[i] = (ushort)fd_ulong_min( fd_wsample_sample( sdest->staked ), FD_SHRED_DEST_NO_DEST );
-    else                                     out[i] = (ushort)sample_unstaked_noprepare( sdest, sdest->source_validator_orig_idx );
+    for( ulong i=0UL; i<shred_cnt; i++ ) out[i] = (ushort)fd_ulong_min( samples[ i ], FD_SHRED_DEST_NO_DEST );
+  } else {
+    for( ulong i=0UL; i<shred_cnt; i++ ) {
+      fd_wsample_seed_rng( fd_wsample_get_rng( sdest->staked ), dest_hash_outputs[ i ] );
+      out[i] = (ushort)sample_unstaked_noprepare( sdest, sdest->source_validator_orig_idx );
+    }
   }
   fd_wsample_restore_all( sdest->staked );
 
@@ -235,8 +235,7 @@ fd_shredder_next_fec_set( fd_shredder_t * shredder,
 
   /* Generate Merkle Proofs */
   fd_bmtree_commit_t * bmtree = fd_bmtree_commit_init( shredder->_bmtree_footprint, FD_SHRED_MERKLE_NODE_SZ, FD_BMTREE_LONG_PREFIX_SZ, tree_depth+1UL );
-  fd_bmtree_commit_append( bmtree, leaves, data_shred_cnt+parity_shred_cnt );
-  uchar * root = fd_bmtree_commit_fini( bmtree );
+  uchar * root = fd_bmtree_commit_layered( bmtree, leaves, data_shred_cnt+parity_shred_cnt );
 
   /* Sign Merkle Root */
   shredder->signer( shredder->signer_ctx, root_signature, root );
@@ -0,0 +1 @@
+$(call make-unit-test,bench_stem_batch,bench_stem_batch,fd_disco fd_tango fd_util)
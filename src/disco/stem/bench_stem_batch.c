@@ -0,0 +1,206 @@
+#include "fd_stem.h"
+
+#if FD_HAS_HOSTED && FD_HAS_SSE && FD_HAS_ALLOCA
+
+/* bench_stem_batch measures the rate at which a stem run loop consumes
+   frags from a single in published by a producer on another tile, with
+   per frag callbacks (AFTER_FRAG) and with batch callbacks
+   (AFTER_FRAG_BATCH).  The callbacks do a trivial amount of work per
+   frag such that the run loop overheads dominate.  Run with at least 2
+   tiles (e.g. --tile-cpus 1,2). */
+
+#include <setjmp.h>
+#include "../metrics/fd_metrics.h"
+
+#define DEPTH_MAX (32768UL)
+
+struct bench_ctx {
+  ulong   rx_cnt;   /* Number of frags received */
+  ulong   rx_max;   /* Number of frags to receive */
+  ulong   rx_sig;   /* Frag sig checksum */
+  ulong   rx_sz;    /* Frag sz checksum */
+  ulong   rx_seq;   /* Next expected frag seq */
+  jmp_buf done;     /* Where to go when rx_cnt reaches rx_max */
+};
+
+typedef struct bench_ctx bench_ctx_t;
+
+static inline void
+bench_rx( bench_ctx_t * ctx,
+          ulong         seq,
+          ulong         sig,
+          ulong         sz ) {
+  if( FD_UNLIKELY( seq!=ctx->rx_seq ) ) FD_LOG_ERR(( "unexpected seq (%lu, expected %lu)", seq, ctx->rx_seq ));
+  ctx->rx_seq  = seq+1UL;
+  ctx->rx_sig ^= sig;
+  ctx->rx_sz  += sz;
+  ctx->rx_cnt++;
+}
+
+static inline void
+after_frag( bench_ctx_t *       ctx,
+            ulong               in_idx,
+            ulong               seq,
+            ulong               sig,
+            ulong               sz,
+            ulong               tsorig,
+            fd_stem_context_t * stem ) {
+  (void)in_idx; (void)tsorig; (void)stem;
+  bench_rx( ctx, seq, sig, sz );
+  if( FD_UNLIKELY( ctx->rx_cnt>=ctx->rx_max ) ) longjmp( ctx->done, 1 );
+}
+
+static inline void
+after_frag_batch( bench_ctx_t *          ctx,
+                  ulong                  in_idx,
+                  fd_frag_meta_t const * meta,
+                  ulong                  meta_cnt,
+                  fd_stem_context_t *    stem ) {
+  (void)in_idx; (void)stem;
+  for( ulong i=0UL; i<meta_cnt; i++ ) bench_rx( ctx, meta[i].seq, meta[i].sig, (ulong)meta[i].sz );
+  if( FD_UNLIKELY( ctx->rx_cnt>=ctx->rx_max ) ) longjmp( ctx->done, 1 );
+}
+
+#define STEM_NAME                      stem_one
+#define STEM_BURST                     (1UL)
+#define STEM_CALLBACK_CONTEXT_TYPE     bench_ctx_t
+#define STEM_CALLBACK_CONTEXT_ALIGN    alignof(bench_ctx_t)
+#define STEM_CALLBACK_AFTER_FRAG       after_frag
+#include "fd_stem.c"
+
+#define STEM_NAME                      stem_batch
+#define STEM_BURST                     (1UL)
+#define STEM_CALLBACK_CONTEXT_TYPE     bench_ctx_t
+#define STEM_CALLBACK_CONTEXT_ALIGN    alignof(bench_ctx_t)
+#define STEM_CALLBACK_AFTER_FRAG_BATCH after_frag_batch
+#define STEM_FRAG_BATCH_MAX            (32UL)
+#include "fd_stem.c"
+
+static uchar mcache_mem [ FD_MCACHE_FOOTPRINT( DEPTH_MAX, 0UL ) ] __attribute__((aligned(FD_MCACHE_ALIGN)));
+static uchar fseq_mem   [ FD_FSEQ_FOOTPRINT                     ] __attribute__((aligned(FD_FSEQ_ALIGN)));
+static ulong metrics_mem[ FD_METRICS_FOOTPRINT( 1UL, 0UL )/sizeof(ulong) ] __attribute__((aligned(FD_METRICS_ALIGN)));
+
+static fd_frag_meta_t * tx_mcache;
+static ulong *          tx_fseq;
+static ulong            tx_depth;
+static ulong            tx_cnt;
+
+/* tx_main publishes tx_cnt frags to tx_mcache, honoring the flow
+   control credits returned by the stem via tx_fseq. */
+
+static int
+tx_main( int     argc,
+         char ** argv ) {
+  (void)argc; (void)argv;
+  fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 1U, 0UL ) );
+  ulong ctl = fd_frag_meta_ctl( 0UL, 1, 1, 0 );
+  ulong seq = 0UL;
+  while( seq<tx_cnt ) {
+    while( FD_UNLIKELY( fd_seq_diff( seq, fd_fseq_query( tx_fseq ) )>=(long)tx_depth ) ) FD_SPIN_PAUSE();
+    ulong sig = fd_rng_ulong( rng );
+    fd_mcache_publish( tx_mcache, tx_depth, seq, sig, 0UL, sig & 1023UL, ctl, 0UL, 0UL );
+    seq++;
+  }
+  fd_rng_delete( fd_rng_leave( rng ) );
+  return 0;
+}
+
+typedef void (*bench_run_fn_t)( bench_ctx_t * ctx, fd_rng_t * rng );
+
+static void
+bench_run_one( bench_ctx_t * ctx,
+               fd_rng_t *    rng ) {
+  fd_frag_meta_t const * in_mcache[1] = { tx_mcache };
+  ulong *                in_fseq  [1] = { tx_fseq   };
+  stem_one_run1( 1UL, in_mcache, in_fseq, 0UL, NULL, 0UL, NULL, NULL, 1UL, 0L, rng,
+                 fd_alloca( FD_STEM_SCRATCH_ALIGN, stem_one_scratch_footprint( 1UL, 0UL, 0UL ) ), ctx );
+}
+
+static void
+bench_run_batch( bench_ctx_t * ctx,
+                 fd_rng_t *    rng ) {
+  fd_frag_meta_t const * in_mcache[1] = { tx_mcache };
+  ulong *                in_fseq  [1] = { tx_fseq   };
+  stem_batch_run1( 1UL, in_mcache, in_fseq, 0UL, NULL, 0UL, NULL, NULL, 1UL, 0L, rng,
+                   fd_alloca( FD_STEM_SCRATCH_ALIGN, stem_batch_scratch_footprint( 1UL, 0UL, 0UL ) ), ctx );
+}
+
+static double
+bench( char const *   name,
+       bench_run_fn_t run,
+       ulong          frag_cnt,
+       fd_rng_t *     rng ) {
+
+  tx_mcache = fd_mcache_join( fd_mcache_new( mcache_mem, tx_depth, 0UL, 0UL ) ); FD_TEST( tx_mcache );
+  tx_fseq   = fd_fseq_join  ( fd_fseq_new  ( fseq_mem,   0UL               ) ); FD_TEST( tx_fseq   );
+  tx_cnt    = frag_cnt;
+
+  static bench_ctx_t ctx[1];
+  memset( ctx, 0, sizeof(bench_ctx_t) );
+  ctx->rx_max = frag_cnt;
+
+  fd_tile_exec_t * exec = fd_tile_exec_new( 1UL, tx_main, 0, NULL );
+  FD_TEST( exec );
+
+  long dt = -fd_log_wallclock();
+  if( !setjmp( ctx->done ) ) run( ctx, rng ); /* Only returns via longjmp */
+  dt += fd_log_wallclock();
+
+  int ret;
+  FD_TEST( !fd_tile_exec_delete( exec, &ret ) && !ret );
+  FD_TEST( ctx->rx_cnt==frag_cnt );
+
+  double mfps = 1e3*(double)frag_cnt / (double)dt;
+  FD_LOG_NOTICE(( "%-5s: %lu frags in %.3f ms (%.3f Mfrag/s, sig %016lx, sz %lu)",
+                  name, frag_cnt, 1e-6*(double)dt, mfps, ctx->rx_sig, ctx->rx_sz ));
+
+  fd_fseq_delete  ( fd_fseq_leave  ( tx_fseq   ) );
+  fd_mcache_delete( fd_mcache_leave( tx_mcache ) );
+  return mfps;
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  ulong depth    = fd_env_strip_cmdline_ulong( &argc, &argv, "--depth",    NULL, 4096UL    );
+  ulong frag_cnt = fd_env_strip_cmdline_ulong( &argc, &argv, "--frag-cnt", NULL, 1UL<<24UL );
+
+  if( FD_UNLIKELY( fd_tile_cnt()<2UL ) ) {
+    FD_LOG_WARNING(( "skip: this benchmark requires at least 2 tiles" ));
+    fd_halt();
+    return 0;
+  }
+  if( FD_UNLIKELY( !fd_ulong_is_pow2( depth ) || depth>DEPTH_MAX ) ) FD_LOG_ERR(( "--depth should be a power of 2 of at most %lu", DEPTH_MAX ));
+  tx_depth = depth;
+
+  FD_LOG_NOTICE(( "Benchmarking with --depth %lu --frag-cnt %lu", depth, frag_cnt ));
+
+  fd_metrics_register( fd_metrics_new( metrics_mem, 1UL, 0UL ) );
+
+  fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 0U, 0UL ) );
+
+  double one   = bench( "one",   bench_run_one,   frag_cnt, rng );
+  double batch = bench( "batch", bench_run_batch, frag_cnt, rng );
+  FD_LOG_NOTICE(( "batch / one: %.2fx", batch/one ));
+
+  fd_rng_delete( fd_rng_leave( rng ) );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
+
+#else
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+  FD_LOG_WARNING(( "skip: unit test requires FD_HAS_HOSTED, FD_HAS_SSE and FD_HAS_ALLOCA capabilities" ));
+  fd_halt();
+  return 0;
+}
+
+#endif
@@ -126,7 +126,29 @@
    number of the fragment that was read from the input mcache. sig,
    chunk, sz, and tsorig are the respective fields from the mcache
    fragment that was received.  If the producer is not respecting flow
-   control, these may be corrupt or torn and should not be trusted. */
+   control, these may be corrupt or torn and should not be trusted.
+
+      DURING_FRAG_BATCH
+      AFTER_FRAG_BATCH
+   Are batched alternatives to DURING_FRAG and AFTER_FRAG (a stem uses
+   one mode or the other, defining both is an error).  When the stem
+   finds a frag on an in, it also gathers the frags immediately behind
+   it that are already published on the same in, up to
+   STEM_FRAG_BATCH_MAX (default 16) frags, and fewer if there are not
+   enough flow control credits for AFTER_FRAG_BATCH to publish burst
+   frags per frag.  BEFORE_FRAG is still called per frag (filtered
+   frags are dropped from the batch, a negative return ends the batch
+   before that frag).  The metas of the remaining frags are copied into
+   a contiguous vector meta[i] for i in [0,meta_cnt) (meta_cnt
+   positive, in sequence order) and DURING_FRAG_BATCH is called with it,
+   with the same rules as DURING_FRAG for reading the frag data.  The
+   stem then checks once for the whole batch whether the reader was
+   overrun.  If it was, the entire batch is abandoned.  Otherwise
+   AFTER_FRAG_BATCH is called with the same vector, with the same rules
+   as AFTER_FRAG.  Tiles that do a small amount of work per frag can use
+   this to amortize the per frag polling, overrun checking, tickcount
+   and metrics overheads of the run loop across the batch and to
+   process the batch vectorized. */
 
 #if !FD_HAS_SSE
 #error "fd_stem requires SSE"
@@ -157,6 +179,16 @@
 #define STEM_LAZY (0L)
 #endif
 
+#if defined(STEM_CALLBACK_DURING_FRAG_BATCH) || defined(STEM_CALLBACK_AFTER_FRAG_BATCH)
+#define STEM_PRIVATE_FRAG_BATCH 1
+#if defined(STEM_CALLBACK_DURING_FRAG) || defined(STEM_CALLBACK_AFTER_FRAG)
+#error "STEM_CALLBACK_*_FRAG_BATCH cannot be combined with STEM_CALLBACK_DURING_FRAG or STEM_CALLBACK_AFTER_FRAG"
+#endif
+#ifndef STEM_FRAG_BATCH_MAX
+#define STEM_FRAG_BATCH_MAX (16UL)
+#endif
+#endif
+
 static inline void
 STEM_(in_update)( fd_stem_tile_in_t * in ) {
   fd_fseq_update( in->fseq, in->seq );
@@ -442,7 +474,7 @@ STEM_(run1)( ulong                        in_cnt,
       now = next;
     }
 
-#if defined(STEM_CALLBACK_BEFORE_CREDIT) || defined(STEM_CALLBACK_AFTER_CREDIT) || defined(STEM_CALLBACK_AFTER_FRAG)
+#if defined(STEM_CALLBACK_BEFORE_CREDIT) || defined(STEM_CALLBACK_AFTER_CREDIT) || defined(STEM_CALLBACK_AFTER_FRAG) || defined(STEM_CALLBACK_AFTER_FRAG_BATCH)
     fd_stem_context_t stem = {
       .mcaches             = out_mcache,
       .depths              = out_depth,
@@ -563,6 +595,107 @@ STEM_(run1)( ulong                        in_cnt,
       continue;
     }
 
+#ifdef STEM_PRIVATE_FRAG_BATCH
+
+    /* Gather the run of frags ready on this in into a batch.  Each
+       AFTER_FRAG_BATCH frag can publish up to burst frags so the batch
+       is limited to the credits we have for that. */
+
+    ulong batch_max = STEM_FRAG_BATCH_MAX;
+    if( FD_LIKELY( burst ) ) batch_max = fd_ulong_min( batch_max, cr_avail/burst );
+
+    fd_frag_meta_t batch[ STEM_FRAG_BATCH_MAX ];
+    ulong batch_cnt = 0UL; /* Number of frags in batch, in [0,batch_max] */
+    ulong batch_sz  = 0UL; /* Total sz of frags in batch */
+    ulong scan_cnt  = 0UL; /* Number of frags consumed from this in (including filtered), in [batch_cnt,batch_max] */
+    ulong filt_cnt  = 0UL;
+    ulong filt_sz   = 0UL;
+
+    ulong                  scan_seq   = this_in_seq;
+    fd_frag_meta_t const * scan_mline = this_in_mline;
+    for(;;) {
+      ulong sig = fd_frag_meta_sse0_sig( seq_sig );
+#ifdef STEM_CALLBACK_BEFORE_FRAG
+      int filter = STEM_CALLBACK_BEFORE_FRAG( ctx, (ulong)this_in->idx, scan_seq, sig );
+      if( FD_UNLIKELY( filter<0 ) ) break;
+      if( FD_UNLIKELY( filter>0 ) ) {
+        filt_cnt++;
+        filt_sz += (ulong)scan_mline->sz; /* Diagnostic only, a torn read here just skews the filtered size metric */
+      } else
+#endif
+      {
+        /* See note below about loading the frag metadata */
+        FD_COMPILER_MFENCE();
+        fd_frag_meta_t * meta = batch + batch_cnt;
+        *meta      = *scan_mline;
+        meta->seq  = scan_seq;
+        meta->sig  = sig;
+        batch_sz  += (ulong)meta->sz;
+        batch_cnt++;
+      }
+      scan_cnt++;
+      if( FD_UNLIKELY( scan_cnt>=batch_max ) ) break;
+
+      scan_seq   = fd_seq_inc( scan_seq, 1UL );
+      scan_mline = this_in->mcache + fd_mcache_line_idx( scan_seq, this_in->depth );
+      seq_sig    = fd_frag_meta_seq_sig_query( scan_mline );
+  #if FD_USING_CLANG
+      __asm__( "" : "+x"(seq_sig) ); /* See note above */
+  #endif
+      if( FD_LIKELY( fd_seq_ne( fd_frag_meta_sse0_seq( seq_sig ), scan_seq ) ) ) break; /* Caught up (or overrun, handled on next poll) */
+    }
+
+    if( FD_LIKELY( batch_cnt ) ) {
+
+#ifdef STEM_CALLBACK_DURING_FRAG_BATCH
+      STEM_CALLBACK_DURING_FRAG_BATCH( ctx, (ulong)this_in->idx, batch, batch_cnt );
+#endif
+
+      /* The producer overwrites mcache lines in sequence order, so if the
+         line of the oldest frag in the batch was not overwritten, neither
+         were the others. */
+
+      FD_COMPILER_MFENCE();
+      ulong seq_test =        this_in_mline->seq;
+      FD_COMPILER_MFENCE();
+
+      if( FD_UNLIKELY( fd_seq_ne( seq_test, seq_found ) ) ) { /* Overrun while reading (impossible if this_in honoring our fctl) */
+        this_in->seq   = seq_test; /* Resume from here (probably reasonably current, could query in mcache sync instead) */
+        this_in->mline = this_in->mcache + fd_mcache_line_idx( seq_test, this_in->depth );
+        fd_metrics_link_in( fd_metrics_base_tl, this_in->idx )[ FD_METRICS_COUNTER_LINK_OVERRUN_READING_COUNT_OFF ]++; /* No local accum since extremely rare, faster to use smaller cache line */
+        fd_metrics_link_in( fd_metrics_base_tl, this_in->idx )[ FD_METRICS_COUNTER_LINK_OVERRUN_READING_FRAG_COUNT_OFF ] += (uint)fd_seq_diff( seq_test, seq_found ); /* No local accum since extremely rare, faster to use smaller cache line */
+        metric_regime_ticks[1] += housekeeping_ticks;
+        metric_regime_ticks[4] += prefrag_ticks;
+        long next = fd_tickcount();
+        metric_regime_ticks[7] += (ulong)(next - now);
+        now = next;
+        continue;
+      }
+
+#ifdef STEM_CALLBACK_AFTER_FRAG_BATCH
+      STEM_CALLBACK_AFTER_FRAG_BATCH( ctx, (ulong)this_in->idx, batch, batch_cnt, &stem );
+#endif
+    }
+
+    /* Windup for the next in poll and accumulate diagnostics */
+
+    this_in_seq    = fd_seq_inc( this_in_seq, scan_cnt );
+    this_in->seq   = this_in_seq;
+    this_in->mline = this_in->mcache + fd_mcache_line_idx( this_in_seq, this_in->depth );
+
+    this_in->accum[ FD_METRICS_COUNTER_LINK_CONSUMED_COUNT_OFF      ] += (uint)batch_cnt;
+    this_in->accum[ FD_METRICS_COUNTER_LINK_CONSUMED_SIZE_BYTES_OFF ] += (uint)batch_sz;
+    this_in->accum[ FD_METRICS_COUNTER_LINK_FILTERED_COUNT_OFF      ] += (uint)filt_cnt;
+    this_in->accum[ FD_METRICS_COUNTER_LINK_FILTERED_SIZE_BYTES_OFF ] += (uint)filt_sz;
+
+    metric_regime_ticks[1] += housekeeping_ticks;
+    metric_regime_ticks[4] += prefrag_ticks;
+    long next = fd_tickcount();
+    metric_regime_ticks[7] += (ulong)(next - now);
+    now = next;
+
+#else /* !STEM_PRIVATE_FRAG_BATCH */
+
     ulong sig = fd_frag_meta_sse0_sig( seq_sig ); (void)sig;
 #ifdef STEM_CALLBACK_BEFORE_FRAG
     int filter = STEM_CALLBACK_BEFORE_FRAG( ctx, (ulong)this_in->idx, seq_found, sig );
@@ -643,6 +776,8 @@ STEM_(run1)( ulong                        in_cnt,
     long next = fd_tickcount();
     metric_regime_ticks[7] += (ulong)(next - now);
     now = next;
+
+#endif /* STEM_PRIVATE_FRAG_BATCH */
   }
 }
 
@@ -722,3 +857,7 @@ STEM_(run)( fd_topo_t *      topo,
 #undef STEM_CALLBACK_BEFORE_FRAG
 #undef STEM_CALLBACK_DURING_FRAG
 #undef STEM_CALLBACK_AFTER_FRAG
+#undef STEM_CALLBACK_DURING_FRAG_BATCH
+#undef STEM_CALLBACK_AFTER_FRAG_BATCH
+#undef STEM_FRAG_BATCH_MAX
+#undef STEM_PRIVATE_FRAG_BATCH
@@ -132,6 +132,8 @@ typedef struct {
       ulong  xdp_aio_depth;
       char   xdp_mode[4];
       int    zero_copy;
+      int    zero_copy_rx;       /* Publish received packets in place, see [tiles.net] */
+      ulong  umem_dcache_obj_id; /* dcache holding the XDP frames if zero_copy_rx */
       uint   src_ip_addr;
       uchar  src_mac_addr[6];
 
@@ -158,6 +160,7 @@ typedef struct {
       ulong  idle_timeout_millis;
       uint   ack_delay_millis;
       int    retry;
+      char   identity_key_path[ PATH_MAX ]; /* for stake-weighted QoS, may be empty if not connected to stake_out */
     } quic;
 
     struct {
@@ -232,6 +235,7 @@ typedef struct {
       char  snapshot[ PATH_MAX ];
       char  status_cache[ PATH_MAX ];
       ulong tpool_thread_count;
+      int   txn_sched;
       char  cluster_version[ 32 ];
       int   in_wen_restart;
       char  tower_checkpt[ PATH_MAX ];
@@ -344,12 +348,14 @@ typedef struct {
       char    identity_key_path[ PATH_MAX ];
     } rpcserv;
 
+    struct {
+      char  blockstore_file[ PATH_MAX ];
+    } archiver;
+
     struct {
       ulong full_interval;
       ulong incremental_interval;
       char  out_dir[ PATH_MAX ];
-      int   tmp_fd;
-      int   tmp_inc_fd;
       int   full_snapshot_fd;
       int   incremental_snapshot_fd;
       ulong hash_tpool_thread_count;
@@ -97,6 +97,42 @@ fd_topob_link( fd_topo_t *  topo,
   topo->link_cnt++;
 }
 
+void
+fd_topob_link_dcache( fd_topo_t *     topo,
+                      char const *    link_name,
+                      ulong           link_kind_id,
+                      fd_topo_obj_t * dcache_obj ) {
+  if( FD_UNLIKELY( !topo || !link_name || !dcache_obj ) ) FD_LOG_ERR(( "NULL args" ));
+  if( FD_UNLIKELY( strcmp( dcache_obj->name, "dcache" ) ) ) FD_LOG_ERR(( "obj %lu is not a dcache", dcache_obj->id ));
+
+  ulong link_id = fd_topo_find_link( topo, link_name, link_kind_id );
+  if( FD_UNLIKELY( link_id==ULONG_MAX ) ) FD_LOG_ERR(( "link not found: %s:%lu", link_name, link_kind_id ));
+  fd_topo_link_t * link = &topo->links[ link_id ];
+  if( FD_UNLIKELY( !link->mtu ) ) FD_LOG_ERR(( "link %s:%lu has no dcache", link_name, link_kind_id ));
+
+  /* Tiles already connected to the link switch over to the new dcache
+     in the same mode. */
+
+  ulong old_id = link->dcache_obj_id;
+  for( ulong i=0UL; i<topo->tile_cnt; i++ ) {
+    fd_topo_tile_t * tile = &topo->tiles[ i ];
+    for( ulong j=0UL; j<tile->uses_obj_cnt; j++ ) {
+      if( FD_LIKELY( tile->uses_obj_id[ j ]!=old_id ) ) continue;
+      int   mode = tile->uses_obj_mode[ j ];
+      ulong k;
+      for( k=0UL; k<tile->uses_obj_cnt; k++ ) if( tile->uses_obj_id[ k ]==dcache_obj->id ) break;
+      if( FD_LIKELY( k==tile->uses_obj_cnt ) ) fd_topob_tile_uses( topo, tile, dcache_obj, mode );
+      else if( mode==FD_SHMEM_JOIN_MODE_READ_WRITE ) tile->uses_obj_mode[ k ] = mode;
+    }
+  }
+
+  /* The original dcache is no longer used, shrink it to the minimum */
+
+  FD_TEST( !fd_pod_replacef_ulong( topo->props, 1UL, "obj.%lu.depth", old_id ) );
+  FD_TEST( !fd_pod_replacef_ulong( topo->props, 1UL, "obj.%lu.burst", old_id ) );
+  link->dcache_obj_id = dcache_obj->id;
+}
+
 void
 fd_topob_tile_uses( fd_topo_t *      topo,
                     fd_topo_tile_t * tile,
@@ -326,6 +362,7 @@ fd_topob_auto_layout( fd_topo_t * topo ) {
     "cswtch",
     "bencho",
     "bhole",  /* FIREDANCER only */
+    "archiv", /* FIREDANCER only */
   };
 
   char const * ORDERED[] = {
@@ -80,6 +80,21 @@ fd_topob_link( fd_topo_t *  topo,
                ulong        mtu,
                ulong        burst );
 
+/* Make a link use an existing dcache object for its data region
+   instead of the dcache it was created with, which gets shrunk to the
+   minimum size.  This allows a producer to publish frags out of a
+   single buffer to several links, or to hand out memory it shares with
+   something else (e.g. a NIC).  The link must have a dcache and
+   dcache_obj must be large enough for the link's mtu.  Tiles that are
+   already connected to the link get mapped to the new dcache in the
+   same mode. */
+
+void
+fd_topob_link_dcache( fd_topo_t *     topo,
+                      char const *    link_name,
+                      ulong           link_kind_id,
+                      fd_topo_obj_t * dcache_obj );
+
 /* Add a tile to the topology.  This creates various objects needed for
    a standard tile, including tile scratch memory, metrics memory and so
    on.  These objects will be created and linked to the respective
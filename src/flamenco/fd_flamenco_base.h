@@ -91,6 +91,9 @@ typedef struct fd_exec_instr_ctx fd_exec_instr_ctx_t;
 struct fd_acc_mgr;
 typedef struct fd_acc_mgr fd_acc_mgr_t;
 
+struct fd_accounts_hash_cache;
+typedef struct fd_accounts_hash_cache fd_accounts_hash_cache_t;
+
 struct fd_capture_ctx;
 typedef struct fd_capture_ctx fd_capture_ctx_t;
 
@@ -1,7 +1,9 @@
 ifdef FD_HAS_HOSTED
 ifdef FD_HAS_INT128
-$(call add-hdrs,fd_gossip.h)
+$(call add-hdrs,fd_gossip.h fd_gossip_bloom.h)
 $(call add-objs,fd_gossip,fd_flamenco)
 $(call make-bin,fd_gossip_spy,fd_gossip_spy,fd_flamenco fd_ballet fd_funk fd_util)
+$(call make-unit-test,test_gossip_bloom,test_gossip_bloom,fd_util)
+$(call run-unit-test,test_gossip_bloom,)
 endif
 endif
@@ -1,5 +1,6 @@
 #define _GNU_SOURCE 1
 #include "fd_gossip.h"
+#include "fd_gossip_bloom.h"
 #include "../../ballet/sha256/fd_sha256.h"
 #include "../../ballet/ed25519/fd_ed25519.h"
 #include "../../ballet/base58/fd_base58.h"
@@ -27,6 +28,10 @@
 #define FD_ACTIVE_KEY_MAX (1<<8)
 /* Max number of values that can be remembered */
 #define FD_VALUE_KEY_MAX (1<<16)
+/* Log2 of the number of value table shards (by high hash bits) */
+#define FD_VALUE_SHARD_LG_CNT (10)
+#define FD_VALUE_SHARD_CNT    (1UL<<FD_VALUE_SHARD_LG_CNT)
+#define FD_VALUE_SHARD_NULL   (ULONG_MAX)
 /* Max number of pending timed events */
 #define FD_PENDING_MAX (1<<9)
 /* Number of bloom filter bits in an outgoing pull request packet */
@@ -158,6 +163,8 @@ struct fd_value_elem {
     ulong wallclock; /* Original timestamp of value in millis */
     uchar data[PACKET_DATA_SIZE]; /* Serialized form of value (bincode) including signature */
     ulong datalen;
+    ulong shard_prev; /* Table index of previous value in the same shard */
+    ulong shard_next; /* Table index of next value in the same shard */
 };
 /* Value table */
 typedef struct fd_value_elem fd_value_elem_t;
@@ -294,6 +301,10 @@ struct fd_gossip {
 #define INACTIVES_MAX 1024U
     /* Table of crds values that we have received in the last 5 minutes, keys by hash */
     fd_value_elem_t * values;
+    /* Secondary index of values, sharded by the high bits of the hash
+       (see fd_gossip_value_shard).  Heads of doubly linked lists of
+       table indices. */
+    ulong value_shard_head[ FD_VALUE_SHARD_CNT ];
     /* The last timestamp hash that we pushed our own contact info */
     long last_contact_time;
     fd_hash_t last_contact_info_key;
@@ -383,6 +394,7 @@ fd_gossip_new ( void * shmem, ulong seed ) {
 
   shm = FD_SCRATCH_ALLOC_APPEND(l, fd_value_table_align(), fd_value_table_footprint(FD_VALUE_KEY_MAX));
   glob->values = fd_value_table_join(fd_value_table_new(shm, FD_VALUE_KEY_MAX, seed));
+  for( ulong i=0UL; i<FD_VALUE_SHARD_CNT; i++ ) glob->value_shard_head[ i ] = FD_VALUE_SHARD_NULL;
 
   glob->last_contact_time = 0;
   shm = FD_SCRATCH_ALLOC_APPEND(l, fd_pending_pool_align(), fd_pending_pool_footprint(FD_PENDING_MAX));
@@ -877,14 +889,39 @@ fd_gossip_sign_crds_value( fd_gossip_t * glob, fd_crds_value_t * crd ) {
   (*glob->sign_fun)( glob->sign_arg, crd->signature.uc, buf, (ulong)((uchar*)ctx.data - buf), FD_KEYGUARD_SIGN_TYPE_ED25519 );
 }
 
-/* Convert a hash to a bloom filter bit position */
-static ulong
-fd_gossip_bloom_pos( fd_hash_t * hash, ulong key, ulong nbits) {
-  for ( ulong i = 0; i < 32U; ++i) {
-    key ^= (ulong)(hash->uc[i]);
-    key *= 1099511628211UL;
-  }
-  return key % nbits;
+/* fd_gossip_value_shard returns the shard of the value table index
+   containing hash.  Shards are selected by the high bits of the first
+   word of the hash, as are pull request filters, so a pull request with
+   mask_bits>=FD_VALUE_SHARD_LG_CNT matches values in a single shard. */
+static inline ulong
+fd_gossip_value_shard( fd_hash_t const * hash ) {
+  return hash->ul[0] >> (64 - FD_VALUE_SHARD_LG_CNT);
+}
+
+/* fd_gossip_value_insert inserts key into the value table and links the
+   new element into its shard.  Assumes the table is not full and key
+   is not already in the table. */
+static fd_value_elem_t *
+fd_gossip_value_insert( fd_gossip_t * glob, fd_hash_t const * key ) {
+  fd_value_elem_t * ele  = fd_value_table_insert( glob->values, key );
+  ulong             idx  = (ulong)(ele - glob->values);
+  ulong *           head = glob->value_shard_head + fd_gossip_value_shard( key );
+  ele->shard_prev = FD_VALUE_SHARD_NULL;
+  ele->shard_next = *head;
+  if( *head!=FD_VALUE_SHARD_NULL ) glob->values[ *head ].shard_prev = idx;
+  *head = idx;
+  return ele;
+}
+
+/* fd_gossip_value_remove unlinks ele from its shard and removes it from
+   the value table. */
+static void
+fd_gossip_value_remove( fd_gossip_t * glob, fd_value_elem_t * ele ) {
+  fd_value_elem_t * values = glob->values;
+  if( ele->shard_prev!=FD_VALUE_SHARD_NULL ) values[ ele->shard_prev ].shard_next = ele->shard_next;
+  else glob->value_shard_head[ fd_gossip_value_shard( &ele->key ) ] = ele->shard_next;
+  if( ele->shard_next!=FD_VALUE_SHARD_NULL ) values[ ele->shard_next ].shard_prev = ele->shard_prev;
+  fd_value_table_remove( values, &ele->key );
 }
 
 /* Choose a random active peer with good ping count */
@@ -990,7 +1027,7 @@ fd_gossip_random_pull( fd_gossip_t * glob, fd_pending_event_arg_t * arg ) {
     fd_hash_t * hash = &(ele->key);
     /* Purge expired values */
     if (ele->wallclock < expire) {
-      fd_value_table_remove( glob->values, hash );
+      fd_gossip_value_remove( glob, ele );
       continue;
     }
     /* Choose which filter packet based on the high bits in the hash */
@@ -1300,7 +1337,7 @@ fd_gossip_recv_crds_value(fd_gossip_t * glob, const fd_gossip_peer_addr_t * from
     FD_LOG_DEBUG(("too many values"));
     return;
   }
-  msg = fd_value_table_insert(glob->values, &key);
+  msg = fd_gossip_value_insert(glob, &key);
   msg->wallclock = wallclock;
   fd_hash_copy(&msg->origin, pubkey);
 
@@ -1527,23 +1564,23 @@ fd_gossip_push_updated_contact(fd_gossip_t * glob) {
     /* Remove the old contact value */
     fd_value_elem_t * ele = fd_value_table_query(glob->values, &glob->last_contact_info_key, NULL);
     if (ele != NULL) {
-      fd_value_table_remove( glob->values, &glob->last_contact_info_key );
+      fd_gossip_value_remove( glob, ele );
     }
 
     /* Remove the old version value */
     ele = fd_value_table_query(glob->values, &glob->last_version_key, NULL);
     if (ele != NULL) {
-      fd_value_table_remove( glob->values, &glob->last_version_key );
+      fd_gossip_value_remove( glob, ele );
     }
 
     ele = fd_value_table_query(glob->values, &glob->last_contact_info_v2_key, NULL);
     if (ele != NULL) {
-      fd_value_table_remove( glob->values, &glob->last_contact_info_v2_key );
+      fd_gossip_value_remove( glob, ele );
     }
 
     ele = fd_value_table_query(glob->values, &glob->last_node_instance_key, NULL);
     if (ele != NULL) {
-      fd_value_table_remove( glob->values, &glob->last_node_instance_key );
+      fd_gossip_value_remove( glob, ele );
     }
   }
 
@@ -1733,57 +1770,71 @@ fd_gossip_handle_pull_req(fd_gossip_t * glob, const fd_gossip_peer_addr_t * from
   ulong hits = 0;
   ulong misses = 0;
   uint npackets = 0;
-  for( fd_value_table_iter_t iter = fd_value_table_iter_init( glob->values );
-       !fd_value_table_iter_done( glob->values, iter );
-       iter = fd_value_table_iter_next( glob->values, iter ) ) {
-    fd_value_elem_t * ele = fd_value_table_iter_ele( glob->values, iter );
-    fd_hash_t * hash = &(ele->key);
-    if (ele->wallclock < expire)
-      continue;
-    /* Execute the bloom filter */
-    if (filter->mask_bits != 0U) {
-      ulong m = (~0UL >> filter->mask_bits);
-      if ((hash->ul[0] | m) != filter->mask)
+
+  /* Only visit the shards of the value table that can match the mask.
+     The first min(mask_bits,FD_VALUE_SHARD_LG_CNT) bits of the shard
+     index are fixed by the mask. */
+  ulong mask_bits = fd_ulong_min( filter->mask_bits, 64UL );
+  ulong m         = mask_bits<64UL ? (~0UL >> mask_bits) : 0UL;
+  ulong shard_cnt = 1UL << (FD_VALUE_SHARD_LG_CNT - fd_ulong_min( mask_bits, FD_VALUE_SHARD_LG_CNT ));
+  ulong shard     = mask_bits ? ((filter->mask >> (64 - FD_VALUE_SHARD_LG_CNT)) & ~(shard_cnt-1UL)) : 0UL;
+  ulong shard_end = shard + shard_cnt;
+  ulong idx       = FD_VALUE_SHARD_NULL;
+
+  fd_value_elem_t * batch     [ FD_GOSSIP_BLOOM_BATCH ];
+  fd_hash_t *       batch_hash[ FD_GOSSIP_BLOOM_BATCH ];
+  for(;;) {
+    /* Gather the next batch of unexpired values matching the mask */
+    ulong batch_cnt = 0UL;
+    while( batch_cnt < FD_GOSSIP_BLOOM_BATCH ) {
+      while( idx == FD_VALUE_SHARD_NULL && shard < shard_end ) idx = glob->value_shard_head[ shard++ ];
+      if( idx == FD_VALUE_SHARD_NULL ) break;
+      fd_value_elem_t * ele = glob->values + idx;
+      idx = ele->shard_next;
+      if (ele->wallclock < expire)
+        continue;
+      if (mask_bits != 0U && (ele->key.ul[0] | m) != filter->mask)
         continue;
+      batch     [ batch_cnt ] = ele;
+      batch_hash[ batch_cnt ] = &ele->key;
+      batch_cnt++;
     }
-    int miss = 0;
-    for (ulong i = 0; i < nkeys; ++i) {
-      ulong pos = fd_gossip_bloom_pos(hash, keys[i], bitvec->len);
-      ulong * j = bitvec2 + (pos>>6U); /* divide by 64 */
-      ulong bit = 1UL<<(pos & 63U);
-      if (!((*j) & bit)) {
-        miss = 1;
-        break;
+    if( !batch_cnt ) break;
+
+    /* Execute the bloom filter */
+    ulong miss = fd_gossip_bloom_miss_batch( batch_hash, batch_cnt, keys, nkeys, bitvec2, bitvec->len );
+
+    for( ulong b = 0; b < batch_cnt; ++b ) {
+      fd_value_elem_t * ele = batch[ b ];
+      if (!((miss >> b) & 1UL)) {
+        hits++;
+        continue;
       }
-    }
-    if (!miss) {
-      hits++;
-      continue;
-    }
-    misses++;
+      misses++;
 
-    /* Record the ratio of hits to misses
+      /* Record the ratio of hits to misses
 
-       These metrics are imprecise as the numbers will vary 
-       per pull request. We keep them to surface 
-       obvious issues like 100% miss rate.*/
-    glob->metrics.handle_pull_req_bloom_filter_result[ FD_METRICS_ENUM_PULL_REQ_BLOOM_FILTER_RESULT_V_HIT_IDX ] += hits;
-    glob->metrics.handle_pull_req_bloom_filter_result[ FD_METRICS_ENUM_PULL_REQ_BLOOM_FILTER_RESULT_V_MISS_IDX ] += misses;
+         These metrics are imprecise as the numbers will vary 
+         per pull request. We keep them to surface 
+         obvious issues like 100% miss rate.*/
+      glob->metrics.handle_pull_req_bloom_filter_result[ FD_METRICS_ENUM_PULL_REQ_BLOOM_FILTER_RESULT_V_HIT_IDX ] += hits;
+      glob->metrics.handle_pull_req_bloom_filter_result[ FD_METRICS_ENUM_PULL_REQ_BLOOM_FILTER_RESULT_V_MISS_IDX ] += misses;
 
-    /* Add the value in already encoded form */
-    if (newend + ele->datalen - buf > PACKET_DATA_SIZE) {
-      /* Packet is getting too large. Flush it */
-      ulong sz = (ulong)(newend - buf);
-      fd_gossip_send_raw(glob, from, buf, sz);
-      char tmp[100];
-      FD_LOG_DEBUG(("sent msg type %u to %s size=%lu", gmsg.discriminant, fd_gossip_addr_str(tmp, sizeof(tmp), from), sz));
-      ++npackets;
-      newend = (uchar *)ctx.data;
-      *crds_len = 0;
+      /* Add the value in already encoded form */
+      if (newend + ele->datalen - buf > PACKET_DATA_SIZE) {
+        /* Packet is getting too large. Flush it */
+        ulong sz = (ulong)(newend - buf);
+        fd_gossip_send_raw(glob, from, buf, sz);
+        char tmp[100];
+        FD_LOG_DEBUG(("sent msg type %u to %s size=%lu", gmsg.discriminant, fd_gossip_addr_str(tmp, sizeof(tmp), from), sz));
+        ++npackets;
+        newend = (uchar *)ctx.data;
+        *crds_len = 0;
+      }
+      fd_memcpy(newend, ele->data, ele->datalen);
+      newend += ele->datalen;
+      (*crds_len)++;
     }
-    fd_memcpy(newend, ele->data, ele->datalen);
-    newend += ele->datalen;
-    (*crds_len)++;
   }
 
   /* Flush final packet */
@@ -2071,7 +2122,7 @@ fd_gossip_push_value_nolock( fd_gossip_t * glob, fd_crds_data_t * data, fd_hash_
     FD_LOG_DEBUG(("too many values"));
     return -1;
   }
-  msg = fd_value_table_insert(glob->values, &key);
+  msg = fd_gossip_value_insert(glob, &key);
   msg->wallclock = FD_NANOSEC_TO_MILLI(glob->now); /* convert to ms */
   fd_hash_copy(&msg->origin, glob->public_key);
 
@@ -0,0 +1,141 @@
+#ifndef HEADER_fd_src_flamenco_gossip_fd_gossip_bloom_h
+#define HEADER_fd_src_flamenco_gossip_fd_gossip_bloom_h
+
+/* Bloom filter probing for gossip pull requests and prune filters.
+   Bit positions are the FNV-1a hash of the 32 byte value hash seeded by
+   the filter key, modulo the number of bits in the filter (this matches
+   the Solana Labs Bloom<Hash> implementation). */
+
+#include "../types/fd_types_custom.h"
+#if FD_HAS_AVX
+#include "../../util/simd/fd_avx.h"
+#endif
+
+/* FD_GOSSIP_BLOOM_BATCH is the number of hashes that
+   fd_gossip_bloom_miss_batch probes at a time */
+
+#define FD_GOSSIP_BLOOM_BATCH (8UL)
+
+FD_PROTOTYPES_BEGIN
+
+/* fd_gossip_bloom_pos converts a hash to a bloom filter bit position */
+
+static inline ulong
+fd_gossip_bloom_pos( fd_hash_t const * hash,
+                     ulong             key,
+                     ulong             nbits ) {
+  for ( ulong i = 0; i < 32U; ++i) {
+    key ^= (ulong)(hash->uc[i]);
+    key *= 1099511628211UL;
+  }
+  return key % nbits;
+}
+
+/* fd_gossip_bloom_miss_batch_ref is the scalar reference for
+   fd_gossip_bloom_miss_batch below. */
+
+static inline ulong
+fd_gossip_bloom_miss_batch_ref( fd_hash_t * const * hash,
+                                ulong               cnt,
+                                ulong const *       keys,
+                                ulong               nkeys,
+                                ulong const *       bits,
+                                ulong               nbits ) {
+  ulong miss = 0UL;
+  for( ulong j=0UL; j<cnt; j++ ) {
+    for( ulong k=0UL; k<nkeys; k++ ) {
+      ulong pos = fd_gossip_bloom_pos( hash[j], keys[k], nbits );
+      if( !((bits[ pos>>6U ] >> (pos & 63U)) & 1UL) ) {
+        miss |= 1UL<<j;
+        break;
+      }
+    }
+  }
+  return miss;
+}
+
+#if FD_HAS_AVX
+
+/* fd_gossip_bloom_hash4 returns the FNV-1a hashes (before the modulo by
+   the filter size) of 4 hashes seeded with key.  w[i] holds word i of
+   each of the 4 hashes (i.e. the hashes transposed, one per lane).
+   Lane j of the result equals fd_gossip_bloom_pos( hash_j, key, nbits )
+   modulo nbits.  AVX2 lacks a 64-bit mullo, so the multiply by the FNV
+   prime (2^40 + 0x1b3) is done as two 32x32 multiplies plus a shift. */
+
+static inline wv_t
+fd_gossip_bloom_hash4( wv_t const w[ 4 ],
+                       ulong      key ) {
+  wv_t const prime_lo = wv_bcast( 0x1b3UL );
+  wv_t const byte     = wv_bcast( 0xffUL  );
+  wv_t x = wv_bcast( key );
+# define FNV_STEP(wi,sh) do {                                                   \
+    x = wv_xor( x, wv_and( wv_shr( (wi), (sh) ), byte ) );                      \
+    x = wv_add( wv_add( wv_mul_ll( x, prime_lo ),                               \
+                        wv_shl( wv_mul_ll( wv_shr( x, 32 ), prime_lo ), 32 ) ), \
+                wv_shl( x, 40 ) );                                              \
+  } while(0)
+  for( ulong i=0UL; i<4UL; i++ ) {
+    FNV_STEP( w[i],  0 ); FNV_STEP( w[i],  8 ); FNV_STEP( w[i], 16 ); FNV_STEP( w[i], 24 );
+    FNV_STEP( w[i], 32 ); FNV_STEP( w[i], 40 ); FNV_STEP( w[i], 48 ); FNV_STEP( w[i], 56 );
+  }
+# undef FNV_STEP
+  return x;
+}
+
+#endif /* FD_HAS_AVX */
+
+/* fd_gossip_bloom_miss_batch applies a bloom filter to the cnt hashes
+   hash[i], i in [0,cnt), cnt in [1,FD_GOSSIP_BLOOM_BATCH].  Returns a
+   bit mask of the hashes that are NOT in the filter (bit i set if
+   hash[i] misses).  Equivalent to fd_gossip_bloom_miss_batch_ref, but
+   with AVX, the FNV-1a of 4 hashes is computed in parallel. */
+
+static inline ulong
+fd_gossip_bloom_miss_batch( fd_hash_t * const * hash,
+                            ulong               cnt,
+                            ulong const *       keys,
+                            ulong               nkeys,
+                            ulong const *       bits,
+                            ulong               nbits ) {
+# if FD_HAS_AVX
+
+  ulong all  = fd_ulong_mask_lsb( (int)cnt );
+  ulong miss = 0UL;
+
+  for( ulong g=0UL; g<cnt; g+=4UL ) {
+    /* Transpose the hashes of this group of 4 (padding with the first
+       hash of the group) such that w[i] holds word i of each hash */
+    fd_hash_t const * h0 = hash[ g ];
+    fd_hash_t const * h1 = hash[ fd_ulong_if( g+1UL<cnt, g+1UL, g ) ];
+    fd_hash_t const * h2 = hash[ fd_ulong_if( g+2UL<cnt, g+2UL, g ) ];
+    fd_hash_t const * h3 = hash[ fd_ulong_if( g+3UL<cnt, g+3UL, g ) ];
+    wv_t w[4];
+    for( ulong i=0UL; i<4UL; i++ ) w[i] = wv( h0->ul[i], h1->ul[i], h2->ul[i], h3->ul[i] );
+
+    ulong grp_all  = (all>>g) & 0xfUL;
+    ulong grp_miss = 0UL;
+    for( ulong k=0UL; k<nkeys && grp_miss!=grp_all; k++ ) {
+      ulong h[4] __attribute__((aligned(32)));
+      wv_st( h, fd_gossip_bloom_hash4( w, keys[k] ) );
+      for( ulong j=0UL; j<4UL; j++ ) {
+        ulong pos = h[j] % nbits;
+        grp_miss |= (ulong)!((bits[ pos>>6U ] >> (pos & 63U)) & 1UL) << j;
+      }
+      grp_miss &= grp_all;
+    }
+    miss |= grp_miss<<g;
+  }
+
+  return miss & all;
+
+# else
+
+  return fd_gossip_bloom_miss_batch_ref( hash, cnt, keys, nkeys, bits, nbits );
+
+# endif
+}
+
+FD_PROTOTYPES_END
+
+#endif /* HEADER_fd_src_flamenco_gossip_fd_gossip_bloom_h */
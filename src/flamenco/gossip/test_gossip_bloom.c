@@ -0,0 +1,103 @@
+#include "fd_gossip_bloom.h"
+#include "../../util/rng/fd_rng.h"
+
+/* Checks that the batched (AVX where available) bloom probe computes
+   the same bit positions and hit/miss results as the scalar reference
+   on random hashes, keys and filters. */
+
+#define MAX_BITS (4096UL)
+#define MAX_KEYS (8UL)
+
+static void
+rand_hash( fd_rng_t *  rng,
+           fd_hash_t * hash ) {
+  for( ulong i=0UL; i<4UL; i++ ) hash->ul[i] = fd_rng_ulong( rng );
+}
+
+#if FD_HAS_AVX
+
+static void
+test_hash4( fd_rng_t * rng ) {
+  for( ulong iter=0UL; iter<100000UL; iter++ ) {
+    fd_hash_t hash[4];
+    for( ulong j=0UL; j<4UL; j++ ) rand_hash( rng, hash+j );
+    ulong key   = fd_rng_ulong( rng );
+    ulong nbits = fd_rng_ulong_roll( rng, MAX_BITS ) + 1UL;
+
+    wv_t w[4];
+    for( ulong i=0UL; i<4UL; i++ ) w[i] = wv( hash[0].ul[i], hash[1].ul[i], hash[2].ul[i], hash[3].ul[i] );
+    ulong h[4] __attribute__((aligned(32)));
+    wv_st( h, fd_gossip_bloom_hash4( w, key ) );
+    for( ulong j=0UL; j<4UL; j++ ) FD_TEST( h[j] % nbits==fd_gossip_bloom_pos( hash+j, key, nbits ) );
+  }
+  FD_LOG_NOTICE(( "fd_gossip_bloom_hash4: pass" ));
+}
+
+#endif /* FD_HAS_AVX */
+
+static void
+test_miss_batch( fd_rng_t * rng ) {
+  static ulong bits[ MAX_BITS/64UL ];
+  ulong miss_cnt = 0UL;
+  ulong hit_cnt  = 0UL;
+  for( ulong iter=0UL; iter<100000UL; iter++ ) {
+    ulong nbits = fd_rng_ulong_roll( rng, MAX_BITS ) + 1UL;
+    ulong nkeys = fd_rng_ulong_roll( rng, MAX_KEYS ) + 1UL;
+    ulong cnt   = fd_rng_ulong_roll( rng, FD_GOSSIP_BLOOM_BATCH ) + 1UL;
+    ulong keys[ MAX_KEYS ];
+    for( ulong k=0UL; k<nkeys; k++ ) keys[k] = fd_rng_ulong( rng );
+
+    /* Random fill density so that both hits and misses are common */
+    ulong density = fd_rng_uint_roll( rng, 4U );
+    for( ulong i=0UL; i<MAX_BITS/64UL; i++ ) {
+      ulong b = fd_rng_ulong( rng );
+      for( ulong d=0UL; d<density; d++ ) b |= fd_rng_ulong( rng );
+      bits[i] = b;
+    }
+
+    /* Insert some of the hashes so that they hit */
+    fd_hash_t   hash_mem[ FD_GOSSIP_BLOOM_BATCH ];
+    fd_hash_t * hash    [ FD_GOSSIP_BLOOM_BATCH ];
+    for( ulong j=0UL; j<cnt; j++ ) {
+      rand_hash( rng, hash_mem+j );
+      hash[j] = hash_mem+j;
+      if( fd_rng_uint_roll( rng, 2U ) ) {
+        for( ulong k=0UL; k<nkeys; k++ ) {
+          ulong pos = fd_gossip_bloom_pos( hash[j], keys[k], nbits );
+          bits[ pos>>6U ] |= 1UL<<(pos & 63U);
+        }
+      }
+    }
+
+    ulong ref  = fd_gossip_bloom_miss_batch_ref( hash, cnt, keys, nkeys, bits, nbits );
+    ulong miss = fd_gossip_bloom_miss_batch    ( hash, cnt, keys, nkeys, bits, nbits );
+    FD_TEST( miss==ref );
+    FD_TEST( !(miss & ~fd_ulong_mask_lsb( (int)cnt )) );
+    ulong m = (ulong)fd_ulong_popcnt( miss );
+    miss_cnt += m;
+    hit_cnt  += cnt - m;
+  }
+  FD_TEST( miss_cnt && hit_cnt );
+  FD_LOG_NOTICE(( "fd_gossip_bloom_miss_batch: pass (hit %lu miss %lu)", hit_cnt, miss_cnt ));
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 1234U, 0UL ) );
+
+# if FD_HAS_AVX
+  test_hash4( rng );
+# else
+  FD_LOG_NOTICE(( "skip: fd_gossip_bloom_hash4 (no AVX)" ));
+# endif
+  test_miss_batch( rng );
+
+  fd_rng_delete( fd_rng_leave( rng ) );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
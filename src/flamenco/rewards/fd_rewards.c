@@ -708,8 +708,7 @@ static int
 distribute_epoch_reward_to_stake_acc( fd_exec_slot_ctx_t * slot_ctx,
                                       fd_pubkey_t *        stake_pubkey,
                                       ulong                reward_lamports,
-                                      ulong                new_credits_observed,
-                                      fd_valloc_t          valloc ) {
+                                      ulong                new_credits_observed ) {
 
   FD_BORROWED_ACCOUNT_DECL( stake_acc_rec );
 
@@ -720,7 +719,7 @@ distribute_epoch_reward_to_stake_acc( fd_exec_slot_ctx_t * slot_ctx,
   stake_acc_rec->meta->slot = slot_ctx->slot_bank.slot;
 
   fd_stake_state_v2_t stake_state[1] = {0};
-  if( fd_stake_get_state(stake_acc_rec, valloc, stake_state) != 0 ) {
+  if( fd_stake_get_state( stake_acc_rec, stake_state ) != 0 ) {
     FD_LOG_DEBUG(( "failed to read stake state for %s", FD_BASE58_ENC_32_ALLOCA( stake_pubkey ) ));
     return 1;
   }
@@ -786,8 +785,7 @@ set_epoch_reward_status_active( fd_exec_slot_ctx_t *             slot_ctx,
 static void
 distribute_epoch_rewards_in_partition( fd_stake_reward_dlist_t * partition,
                                        fd_stake_reward_t *       pool,
-                                       fd_exec_slot_ctx_t *      slot_ctx,
-                                       fd_valloc_t               valloc ) {
+                                       fd_exec_slot_ctx_t *      slot_ctx ) {
 
   ulong lamports_distributed = 0UL;
   ulong lamports_burned      = 0UL;
@@ -800,7 +798,7 @@ distribute_epoch_rewards_in_partition( fd_stake_reward_dlist_t * partition,
     if( distribute_epoch_reward_to_stake_acc( slot_ctx,
                                               &stake_reward->stake_pubkey,
                                               stake_reward->lamports,
-                                              stake_reward->credits_observed, valloc ) == 0 ) {
+                                              stake_reward->credits_observed ) == 0 ) {
       lamports_distributed += stake_reward->lamports;
     } else {
       lamports_burned += stake_reward->lamports;
@@ -845,8 +843,7 @@ fd_distribute_partitioned_epoch_rewards( fd_exec_slot_ctx_t * slot_ctx, fd_vallo
     ulong partition_index = height - distribution_starting_block_height;
     distribute_epoch_rewards_in_partition( &status->partitioned_stake_rewards.partitions[ partition_index ],
                                            status->partitioned_stake_rewards.pool,
-                                           slot_ctx,
-                                           valloc );
+                                           slot_ctx );
   }
 
   /* If we have finished distributing rewards, set the status to inactive */
@@ -873,8 +870,7 @@ fd_update_rewards( fd_exec_slot_ctx_t * slot_ctx,
   for( ulong i = 0UL; i < rewards_result->stake_rewards_by_partition.partitioned_stake_rewards.partitions_len; i++ ) {
     distribute_epoch_rewards_in_partition( &rewards_result->stake_rewards_by_partition.partitioned_stake_rewards.partitions[ i ],
                                            rewards_result->stake_rewards_by_partition.partitioned_stake_rewards.pool,
-                                           slot_ctx,
-                                           valloc );
+                                           slot_ctx );
   }
 }
 
@@ -977,7 +973,7 @@ FD_SCRATCH_SCOPE_BEGIN {
         .deactivating = 0UL
     };
 
-    fd_accumulate_stake_infos( slot_ctx, stakes, stake_history, new_warmup_cooldown_rate_epoch, &_accumulator, &epoch_info, valloc );
+    fd_accumulate_stake_infos( slot_ctx, stakes, stake_history, new_warmup_cooldown_rate_epoch, &_accumulator, &epoch_info );
     fd_refresh_vote_accounts( slot_ctx, stake_history, new_warmup_cooldown_rate_epoch, &epoch_info );
 
     /* In future, the calculation will be cached in the snapshot, but for now we just re-calculate it
@@ -2,6 +2,9 @@ ifdef FD_HAS_INT128
 $(call add-hdrs,fd_acc_mgr.h)
 $(call add-objs,fd_acc_mgr,fd_flamenco)
 
+$(call add-hdrs,fd_accounts_hash_cache.h)
+$(call add-objs,fd_accounts_hash_cache,fd_flamenco)
+
 $(call add-hdrs,fd_account.h)
 $(call add-objs,fd_account,fd_flamenco)
 
@@ -53,6 +56,7 @@ ifdef FD_HAS_ATOMIC
 
 ifdef FD_HAS_HOSTED
 $(call make-unit-test,test_archive_block,test_archive_block, fd_flamenco fd_util fd_ballet,$(SECP256K1_LIBS))
+$(call make-unit-test,test_accounts_hash_cache,test_accounts_hash_cache,fd_flamenco fd_funk fd_ballet fd_util,$(SECP256K1_LIBS))
 # TODO: Flakes
 # $(call run-unit-test,test_txncache,)
 endif
@@ -55,6 +55,10 @@ struct __attribute__((aligned(8UL))) fd_exec_slot_ctx {
                                                      recording, e.g. txn logs.  Analogue
                                                      of Agave's ExecutionRecordingConfig. */
 
+  int                         txn_sched;             /* FD_RUNTIME_TXN_SCHED_{WAVES,DAG}, the
+                                                     scheduler used to replay blocks on a
+                                                     tpool.  Defaults to WAVES. */
+
   ulong                       root_slot;
   ulong                       snapshot_freq;
   ulong                       incremental_freq;
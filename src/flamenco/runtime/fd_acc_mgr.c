@@ -95,6 +95,15 @@ fd_acc_mgr_set_slots_per_epoch( fd_exec_slot_ctx_t * slot_ctx,
   fd_funk_repartition( acc_mgr->funk, (uint)slots_per_epoch, fd_rent_lists_cb, slot_ctx );
 }
 
+void
+fd_acc_mgr_set_hash_cache( fd_exec_slot_ctx_t *       slot_ctx,
+                           fd_accounts_hash_cache_t * cache,
+                           fd_valloc_t                valloc ) {
+  fd_acc_mgr_t * acc_mgr = slot_ctx->acc_mgr;
+  acc_mgr->hash_cache        = cache;
+  acc_mgr->hash_cache_valloc = valloc;
+}
+
 fd_account_meta_t const *
 fd_acc_mgr_view_raw( fd_acc_mgr_t *         acc_mgr,
                      fd_funk_txn_t const *  txn,
@@ -213,8 +222,7 @@ fd_acc_mgr_modify_raw( fd_acc_mgr_t *        acc_mgr,
 
   // At this point, we don't know if the record WILL be rent exempt so
   // it is safer to just stick it into the partition and look at it later.
-  if ( acc_mgr->slots_per_epoch != 0 )
-    fd_funk_part_set(funk, rec, (uint)fd_rent_lists_key_to_bucket( acc_mgr, rec ));
+  fd_acc_mgr_set_rent_part( acc_mgr, rec );
 
   fd_account_meta_t * ret = fd_funk_val( rec, fd_funk_wksp( funk ) );
 
@@ -333,6 +341,13 @@ fd_acc_mgr_save_non_tpool( fd_acc_mgr_t *          acc_mgr,
   return fd_acc_mgr_save( acc_mgr, account );
 }
 
+void
+fd_acc_mgr_set_rent_part( fd_acc_mgr_t *  acc_mgr,
+                          fd_funk_rec_t * rec ) {
+  if ( acc_mgr->slots_per_epoch != 0 )
+    fd_funk_part_set( acc_mgr->funk, rec, (uint)fd_rent_lists_key_to_bucket( acc_mgr, rec ) );
+}
+
 void
 fd_acc_mgr_lock( fd_acc_mgr_t * acc_mgr ) {
   FD_TEST( !acc_mgr->is_locked );
@@ -346,7 +361,8 @@ fd_acc_mgr_unlock( fd_acc_mgr_t * acc_mgr ) {
 }
 
 struct fd_acc_mgr_save_task_args {
-  fd_acc_mgr_t * acc_mgr;
+  fd_acc_mgr_t *  acc_mgr;
+  fd_funk_txn_t * txn;
 };
 typedef struct fd_acc_mgr_save_task_args fd_acc_mgr_save_task_args_t;
 
@@ -368,8 +384,38 @@ fd_acc_mgr_save_task( void *tpool,
   fd_acc_mgr_save_task_args_t * task_args = (fd_acc_mgr_save_task_args_t *)args;
   fd_acc_mgr_save_task_info_t * task_info = (fd_acc_mgr_save_task_info_t *)tpool + m0;
 
+  fd_acc_mgr_t * acc_mgr = task_args->acc_mgr;
+  fd_funk_t *    funk    = acc_mgr->funk;
+  fd_wksp_t *    wksp    = fd_funk_wksp( funk );
+
   for( ulong i = 0; i < task_info->accounts_cnt; i++ ) {
-    int err = fd_acc_mgr_save(task_args->acc_mgr,task_info->accounts[i] );
+    fd_borrowed_account_t * account = task_info->accounts[i];
+
+    /* This check is to prevent a seg fault in the case where an account with
+       null data tries to get saved. This notably happens if firedancer is
+       attemping to execute a bad block. This should NEVER happen in the case
+       of a proper replay. */
+    if( FD_UNLIKELY( !account->const_meta ) ) {
+      FD_LOG_ERR(( "An account likely does not exist. This block could be invalid." ));
+    }
+
+    /* The record is created (or copied from the ancestor incarnation)
+       and published atomically, so other threads can keep querying funk
+       while accounts are saved. */
+    fd_funk_rec_key_t key    = fd_acc_funk_key( account->pubkey );
+    ulong             reclen = sizeof(fd_account_meta_t)+account->const_meta->dlen;
+    int               err;
+    fd_funk_rec_t *   rec    = fd_funk_rec_write_prepare_concur( funk, task_args->txn, &key, reclen, 1, NULL, &err );
+    if( FD_UNLIKELY( !rec ) ) FD_LOG_ERR(( "unable to prepare account record, error %d", err ));
+
+    /* The ancestor incarnation may have been larger */
+    if( fd_funk_val_sz( rec )!=reclen &&
+        fd_funk_val_truncate( rec, reclen, fd_funk_alloc( funk, wksp ), wksp, &err ) == NULL ) {
+      FD_LOG_ERR(( "unable to allocate account value, err %d", err ));
+    }
+    account->rec = rec;
+
+    err = fd_acc_mgr_save( acc_mgr, account );
     if( FD_UNLIKELY( err != FD_ACC_MGR_SUCCESS ) ) {
       task_info->result = err;
       return;
@@ -389,7 +435,7 @@ fd_acc_mgr_save_many_tpool( fd_acc_mgr_t *          acc_mgr,
     fd_wksp_t * wksp = fd_funk_wksp( funk );
     fd_funk_rec_t * rec_map = fd_funk_rec_map( funk, wksp );
 
-    ulong batch_cnt = fd_ulong_min(
+    ulong batch_cnt = !tpool ? 1UL : fd_ulong_min(
       fd_funk_rec_map_private_list_cnt( fd_funk_rec_map_key_max( rec_map ) ),
       fd_ulong_pow2_up( fd_tpool_worker_cnt( tpool ) )
     );
@@ -420,47 +466,29 @@ fd_acc_mgr_save_many_tpool( fd_acc_mgr_t *          acc_mgr,
       task_accounts_cursor += batch_sz;
     }
 
-    fd_funk_start_write( funk );
-
     for( ulong i = 0; i < accounts_cnt; i++ ) {
-      fd_borrowed_account_t * account = accounts[i];
-
       ulong batch_idx = i & batch_mask;
       fd_acc_mgr_save_task_info_t * task_info = &task_infos[batch_idx];
-      task_info->accounts[task_info->accounts_cnt++] = account;
-      fd_funk_rec_key_t key = fd_acc_funk_key( account->pubkey );
-      fd_funk_rec_t * rec = (fd_funk_rec_t *)fd_funk_rec_query( funk, txn, &key );
-      if( rec == NULL ) {
-        int err;
-        rec = (fd_funk_rec_t *)fd_funk_rec_insert( funk, txn, &key, &err );
-        if( rec == NULL ) FD_LOG_ERR(( "unable to insert a new record, error %d", err ));
-      }
-      account->rec = rec;
-      if ( acc_mgr->slots_per_epoch != 0 )
-        fd_funk_part_set(funk, rec, (uint)fd_rent_lists_key_to_bucket( acc_mgr, rec ));
-
-      /* This check is to prevent a seg fault in the case where an account with
-         null data tries to get saved. This notably happens if firedancer is
-         attemping to execute a bad block. This should NEVER happen in the case
-         of a proper replay. */
-      if( FD_UNLIKELY( !account->const_meta ) ) {
-        FD_LOG_ERR(( "An account likely does not exist. This block could be invalid." ));
-      }
-
-      ulong reclen = sizeof(fd_account_meta_t)+account->const_meta->dlen;
-      int err;
-      if( fd_funk_val_truncate( account->rec, reclen, fd_funk_alloc( acc_mgr->funk, wksp ), wksp, &err ) == NULL ) {
-        FD_LOG_ERR(( "unable to allocate account value, err %d", err ));
-      }
+      task_info->accounts[task_info->accounts_cnt++] = accounts[i];
     }
 
+    fd_funk_start_write( funk );
+
     fd_acc_mgr_save_task_args_t task_args = {
-      .acc_mgr = acc_mgr
+      .acc_mgr = acc_mgr,
+      .txn     = txn
     };
 
     /* Save accounts in a thread pool */
 
-    fd_tpool_exec_all_rrobin( tpool, 0, fd_tpool_worker_cnt( tpool ), fd_acc_mgr_save_task, task_infos, &task_args, NULL, 1, 0, batch_cnt );
+    if( FD_LIKELY( tpool ) ) {
+      fd_tpool_exec_all_rrobin( tpool, 0, fd_tpool_worker_cnt( tpool ), fd_acc_mgr_save_task, task_infos, &task_args, NULL, 1, 0, batch_cnt );
+    } else {
+      fd_acc_mgr_save_task( task_infos, 0UL, 1UL, &task_args, NULL, 1UL, 0UL, batch_cnt, 0UL, 1UL, 0UL, 1UL );
+    }
+
+    /* Rent partition lists are not safe for concurrent updates */
+    for( ulong i = 0; i < accounts_cnt; i++ ) fd_acc_mgr_set_rent_part( acc_mgr, accounts[i]->rec );
 
     fd_funk_end_write( funk );
 
@@ -61,6 +61,15 @@ struct __attribute__((aligned(16UL))) fd_acc_mgr {
   uchar skip_rent_rewrites : 1;
 
   uint is_locked;
+
+  /* hash_cache, if non-NULL, is an accounts hash cache that the
+     runtime keeps up to date with account modifications and uses for
+     full accounts hashes, allocating its arrays from the persistent
+     allocator hash_cache_valloc.  See
+     fd_accounts_hash_cache.h.  Set with fd_acc_mgr_set_hash_cache. */
+
+  fd_accounts_hash_cache_t * hash_cache;
+  fd_valloc_t                hash_cache_valloc;
 };
 
 /* FD_ACC_MGR_{ALIGN,FOOTPRINT} specify the parameters for the memory
@@ -257,6 +266,17 @@ fd_acc_mgr_save_non_tpool( fd_acc_mgr_t *          acc_mgr,
                            fd_funk_txn_t *         txn,
                            fd_borrowed_account_t * account );
 
+/* fd_acc_mgr_save_many_tpool saves accounts_cnt borrowed accounts back
+   into funk txn under the funk write lock.  The accounts are spread
+   over the tpool workers, which create the records with
+   fd_funk_rec_write_prepare_concur and copy the account data.  Rent
+   partitions are assigned on the caller afterwards.  If tpool is NULL,
+   everything is done on the caller (useful when the tpool workers are
+   busy with other work, e.g. finalizing a transaction while other
+   transactions are still executing).  Records are published atomically,
+   so other threads may query funk concurrently (but not modify it or
+   the accounts being saved). */
+
 int
 fd_acc_mgr_save_many_tpool( fd_acc_mgr_t *           acc_mgr,
                             fd_funk_txn_t *          txn,
@@ -278,6 +298,28 @@ void
 fd_acc_mgr_set_slots_per_epoch( fd_exec_slot_ctx_t * slot_ctx,
                                 ulong                slots_per_epoch );
 
+/* fd_acc_mgr_set_hash_cache attaches the accounts hash cache cache to
+   the acc_mgr of slot_ctx, with valloc the persistent allocator for
+   the cache's arrays (NULL cache detaches the cache).  cache should
+   not have results for the current funk root unless it was attached to
+   this acc_mgr before (e.g. reset it). */
+
+void
+fd_acc_mgr_set_hash_cache( fd_exec_slot_ctx_t *       slot_ctx,
+                           fd_accounts_hash_cache_t * cache,
+                           fd_valloc_t                valloc );
+
+/* fd_acc_mgr_set_rent_part assigns the account record rec to its rent
+   partition, as fd_acc_mgr_modify_raw does for the records it returns.
+   No-op if rent partitions are not in use (slots_per_epoch==0).  Not
+   safe to call concurrently.  Useful for callers that write account
+   records concurrently via fd_funk_rec_write_prepare_concur and assign
+   partitions in a serial pass afterwards. */
+
+void
+fd_acc_mgr_set_rent_part( fd_acc_mgr_t *  acc_mgr,
+                          fd_funk_rec_t * rec );
+
 /* fd_acc_mgr_strerror converts an fd_acc_mgr error code into a human
    readable cstr.  The lifetime of the returned pointer is infinite and
    the call itself is thread safe.  The returned pointer is always to a
@@ -0,0 +1,335 @@
+#include "fd_accounts_hash_cache.h"
+
+FD_FN_CONST ulong
+fd_accounts_hash_cache_align( void ) {
+  return FD_ACCOUNTS_HASH_CACHE_ALIGN;
+}
+
+FD_FN_CONST ulong
+fd_accounts_hash_cache_footprint( ulong lg_part_cnt ) {
+  if( FD_UNLIKELY( lg_part_cnt>FD_ACCOUNTS_HASH_CACHE_LG_PART_CNT_MAX ) ) return 0UL;
+  ulong l = FD_LAYOUT_INIT;
+  l = FD_LAYOUT_APPEND( l, FD_ACCOUNTS_HASH_CACHE_ALIGN,           sizeof(fd_accounts_hash_cache_t)                          );
+  l = FD_LAYOUT_APPEND( l, alignof(fd_accounts_hash_cache_part_t), (1UL<<lg_part_cnt)*sizeof(fd_accounts_hash_cache_part_t) );
+  return FD_LAYOUT_FINI( l, FD_ACCOUNTS_HASH_CACHE_ALIGN );
+}
+
+void *
+fd_accounts_hash_cache_new( void * shmem,
+                            ulong  lg_part_cnt ) {
+
+  if( FD_UNLIKELY( !shmem ) ) {
+    FD_LOG_WARNING(( "NULL shmem" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)shmem, fd_accounts_hash_cache_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned shmem" ));
+    return NULL;
+  }
+
+  ulong footprint = fd_accounts_hash_cache_footprint( lg_part_cnt );
+  if( FD_UNLIKELY( !footprint ) ) {
+    FD_LOG_WARNING(( "bad lg_part_cnt (%lu)", lg_part_cnt ));
+    return NULL;
+  }
+
+  fd_memset( shmem, 0, footprint );
+
+  FD_SCRATCH_ALLOC_INIT( l, shmem );
+  fd_accounts_hash_cache_t * cache = FD_SCRATCH_ALLOC_APPEND( l, FD_ACCOUNTS_HASH_CACHE_ALIGN,           sizeof(fd_accounts_hash_cache_t)                          );
+  void *                     part  = FD_SCRATCH_ALLOC_APPEND( l, alignof(fd_accounts_hash_cache_part_t), (1UL<<lg_part_cnt)*sizeof(fd_accounts_hash_cache_part_t) );
+  FD_SCRATCH_ALLOC_FINI( l, FD_ACCOUNTS_HASH_CACHE_ALIGN );
+
+  cache->lg_part_cnt = lg_part_cnt;
+  cache->part_cnt    = 1UL<<lg_part_cnt;
+  cache->part_off    = (ulong)part - (ulong)shmem;
+
+  cache->scan_slot = ULONG_MAX;
+
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( cache->magic ) = FD_ACCOUNTS_HASH_CACHE_MAGIC;
+  FD_COMPILER_MFENCE();
+
+  return shmem;
+}
+
+fd_accounts_hash_cache_t *
+fd_accounts_hash_cache_join( void * shcache ) {
+
+  if( FD_UNLIKELY( !shcache ) ) {
+    FD_LOG_WARNING(( "NULL shcache" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)shcache, fd_accounts_hash_cache_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned shcache" ));
+    return NULL;
+  }
+
+  fd_accounts_hash_cache_t * cache = (fd_accounts_hash_cache_t *)shcache;
+
+  if( FD_UNLIKELY( cache->magic!=FD_ACCOUNTS_HASH_CACHE_MAGIC ) ) {
+    FD_LOG_WARNING(( "bad magic" ));
+    return NULL;
+  }
+
+  return cache;
+}
+
+void *
+fd_accounts_hash_cache_leave( fd_accounts_hash_cache_t * cache ) {
+
+  if( FD_UNLIKELY( !cache ) ) {
+    FD_LOG_WARNING(( "NULL cache" ));
+    return NULL;
+  }
+
+  return (void *)cache;
+}
+
+void *
+fd_accounts_hash_cache_delete( void * shcache ) {
+
+  if( FD_UNLIKELY( !shcache ) ) {
+    FD_LOG_WARNING(( "NULL shcache" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)shcache, fd_accounts_hash_cache_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned shcache" ));
+    return NULL;
+  }
+
+  fd_accounts_hash_cache_t * cache = (fd_accounts_hash_cache_t *)shcache;
+
+  if( FD_UNLIKELY( cache->magic!=FD_ACCOUNTS_HASH_CACHE_MAGIC ) ) {
+    FD_LOG_WARNING(( "bad magic" ));
+    return NULL;
+  }
+
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( cache->magic ) = 0UL;
+  FD_COMPILER_MFENCE();
+
+  return shcache;
+}
+
+void
+fd_accounts_hash_cache_reset( fd_accounts_hash_cache_t * cache,
+                              fd_valloc_t                valloc ) {
+  fd_accounts_hash_cache_part_t * parts = fd_accounts_hash_cache_part( cache );
+  for( ulong i=0UL; i<cache->part_cnt; i++ ) {
+    fd_accounts_hash_cache_part_t * part = parts + i;
+    if( part->pair ) fd_valloc_free( valloc, part->pair );
+    if( part->upd  ) fd_valloc_free( valloc, part->upd  );
+    memset( part, 0, sizeof(fd_accounts_hash_cache_part_t) );
+  }
+  if( cache->delta ) fd_valloc_free( valloc, cache->delta );
+  cache->delta     = NULL;
+  cache->delta_cnt = 0UL;
+  cache->delta_max = 0UL;
+  cache->scan_slot = ULONG_MAX;
+  fd_lthash_zero( &cache->lthash );
+}
+
+/* fd_accounts_hash_cache_grow grows the array old of *_max elements of
+   elem_sz bytes, cnt of which are in use, from valloc such that it has
+   room for at least one more.  Returns the grown array and updates
+   *_max. */
+
+static void *
+fd_accounts_hash_cache_grow( void *      old,
+                             ulong *     _max,
+                             ulong       cnt,
+                             ulong       elem_align,
+                             ulong       elem_sz,
+                             fd_valloc_t valloc ) {
+  ulong  max = fd_ulong_max( 2UL*(*_max), 64UL );
+  void * arr = fd_valloc_malloc( valloc, elem_align, max*elem_sz );
+  if( FD_UNLIKELY( !arr ) ) FD_LOG_ERR(( "failed to allocate %lu accounts hash cache entries", max ));
+  if( old ) {
+    fd_memcpy( arr, old, cnt*elem_sz );
+    fd_valloc_free( valloc, old );
+  }
+  *_max = max;
+  return arr;
+}
+
+void
+fd_accounts_hash_cache_part_append( fd_accounts_hash_cache_part_t * part,
+                                    fd_valloc_t                     valloc,
+                                    fd_pubkey_t const *             pubkey,
+                                    fd_hash_t const *               hash ) {
+  if( FD_UNLIKELY( part->pair_cnt==part->pair_max ) ) {
+    part->pair = fd_accounts_hash_cache_grow( part->pair, &part->pair_max, part->pair_cnt,
+                                              alignof(fd_accounts_hash_cache_pair_t), sizeof(fd_accounts_hash_cache_pair_t), valloc );
+  }
+  fd_accounts_hash_cache_pair_t * pair = part->pair + part->pair_cnt++;
+  pair->pubkey = *pubkey;
+  pair->hash   = *hash;
+}
+
+void
+fd_accounts_hash_cache_mark( fd_accounts_hash_cache_t * cache,
+                             fd_valloc_t                valloc,
+                             fd_pubkey_t const *        pubkey,
+                             fd_hash_t const *          hash,
+                             ulong                      slot ) {
+  fd_accounts_hash_cache_part_t * part = fd_accounts_hash_cache_part( cache ) + fd_accounts_hash_cache_part_idx( cache, pubkey );
+  if( FD_UNLIKELY( part->upd_cnt==part->upd_max ) ) {
+    part->upd = fd_accounts_hash_cache_grow( part->upd, &part->upd_max, part->upd_cnt,
+                                             alignof(fd_accounts_hash_cache_upd_t), sizeof(fd_accounts_hash_cache_upd_t), valloc );
+  }
+  fd_accounts_hash_cache_upd_t * upd = part->upd + part->upd_cnt++;
+  upd->pubkey = *pubkey;
+  if( hash ) upd->hash = *hash;
+  else       memset( &upd->hash, 0, sizeof(fd_hash_t) );
+  upd->slot   = slot;
+  upd->seq    = cache->upd_seq++;
+}
+
+void
+fd_accounts_hash_cache_mark_lthash( fd_accounts_hash_cache_t * cache,
+                                    fd_valloc_t                valloc,
+                                    fd_lthash_value_t const *  lthash,
+                                    ulong                      slot ) {
+  /* There are only a few unrooted slots at any point in time */
+  for( ulong i=0UL; i<cache->delta_cnt; i++ ) {
+    if( cache->delta[i].slot==slot ) {
+      fd_lthash_add( &cache->delta[i].lthash, lthash );
+      return;
+    }
+  }
+  if( FD_UNLIKELY( cache->delta_cnt==cache->delta_max ) ) {
+    cache->delta = fd_accounts_hash_cache_grow( cache->delta, &cache->delta_max, cache->delta_cnt,
+                                                  alignof(fd_accounts_hash_cache_delta_t), sizeof(fd_accounts_hash_cache_delta_t), valloc );
+  }
+  fd_accounts_hash_cache_delta_t * delta = cache->delta + cache->delta_cnt++;
+  delta->lthash = *lthash;
+  delta->slot   = slot;
+}
+
+#define SORT_NAME        sort_accounts_hash_cache_upd
+#define SORT_KEY_T       fd_accounts_hash_cache_upd_t
+#define SORT_BEFORE(a,b) fd_accounts_hash_cache_upd_before( &(a), &(b) )
+static inline int
+fd_accounts_hash_cache_upd_before( fd_accounts_hash_cache_upd_t const * a,
+                                   fd_accounts_hash_cache_upd_t const * b ) {
+  if( fd_accounts_hash_cache_pubkey_before( &a->pubkey, &b->pubkey ) ) return 1;
+  if( fd_accounts_hash_cache_pubkey_before( &b->pubkey, &a->pubkey ) ) return 0;
+  return a->seq<b->seq;
+}
+#include "../../util/tmpl/fd_sort.c"
+
+/* fd_accounts_hash_cache_part_rooted moves the pending updates of part
+   for the slots not newer than root_slot to the front of part's update
+   array and returns their number. */
+
+static ulong
+fd_accounts_hash_cache_part_rooted( fd_accounts_hash_cache_part_t * part,
+                                    ulong                           root_slot ) {
+  fd_accounts_hash_cache_upd_t * upd = part->upd;
+  ulong rooted_cnt = 0UL;
+  for( ulong i=0UL; i<part->upd_cnt; i++ ) {
+    if( upd[i].slot>root_slot ) continue;
+    fd_accounts_hash_cache_upd_t tmp = upd[i]; upd[i] = upd[rooted_cnt]; upd[rooted_cnt] = tmp;
+    rooted_cnt++;
+  }
+  return rooted_cnt;
+}
+
+/* fd_accounts_hash_cache_part_drop removes the first drop_cnt pending
+   updates of part. */
+
+static void
+fd_accounts_hash_cache_part_drop( fd_accounts_hash_cache_part_t * part,
+                                  ulong                           drop_cnt ) {
+  part->upd_cnt -= drop_cnt;
+  memmove( part->upd, part->upd + drop_cnt, part->upd_cnt*sizeof(fd_accounts_hash_cache_upd_t) );
+}
+
+int
+fd_accounts_hash_cache_part_merge( fd_accounts_hash_cache_part_t * part,
+                                   fd_valloc_t                     valloc,
+                                   ulong                           root_slot ) {
+  ulong upd_cnt = fd_accounts_hash_cache_part_rooted( part, root_slot );
+  if( !upd_cnt ) return 0;
+
+  fd_accounts_hash_cache_upd_t * upd = part->upd;
+  sort_accounts_hash_cache_upd_inplace( upd, upd_cnt );
+
+  /* Merge the sorted updates (of which the latest one per account
+     wins) with the sorted pairs into a new pair array */
+
+  ulong                           pair_cnt = part->pair_cnt;
+  fd_accounts_hash_cache_pair_t * pair     = part->pair;
+  ulong                           out_max  = fd_ulong_max( pair_cnt + upd_cnt, 64UL );
+  fd_accounts_hash_cache_pair_t * out      = fd_valloc_malloc( valloc, alignof(fd_accounts_hash_cache_pair_t), out_max*sizeof(fd_accounts_hash_cache_pair_t) );
+  if( FD_UNLIKELY( !out ) ) FD_LOG_ERR(( "failed to allocate %lu accounts hash cache pairs", out_max ));
+
+  ulong out_cnt  = 0UL;
+  ulong pair_idx = 0UL;
+  for( ulong upd_idx=0UL; upd_idx<upd_cnt; upd_idx++ ) {
+    fd_accounts_hash_cache_upd_t const * u = upd + upd_idx;
+    if( upd_idx+1UL<upd_cnt && !memcmp( &u[1].pubkey, &u->pubkey, sizeof(fd_pubkey_t) ) ) continue; /* Superseded */
+
+    while( pair_idx<pair_cnt && fd_accounts_hash_cache_pubkey_before( &pair[ pair_idx ].pubkey, &u->pubkey ) ) out[ out_cnt++ ] = pair[ pair_idx++ ];
+    if( pair_idx<pair_cnt && !memcmp( &pair[ pair_idx ].pubkey, &u->pubkey, sizeof(fd_pubkey_t) ) ) pair_idx++; /* Replaced */
+
+    fd_hash_t const * h = &u->hash;
+    if( (h->ul[0] | h->ul[1] | h->ul[2] | h->ul[3]) != 0 ) {
+      out[ out_cnt ].pubkey = u->pubkey;
+      out[ out_cnt ].hash   = *h;
+      out_cnt++;
+    }
+  }
+  while( pair_idx<pair_cnt ) out[ out_cnt++ ] = pair[ pair_idx++ ];
+
+  if( pair ) fd_valloc_free( valloc, pair );
+  part->pair     = out;
+  part->pair_cnt = out_cnt;
+  part->pair_max = out_max;
+  part->dirty    = 1UL;
+
+  fd_accounts_hash_cache_part_drop( part, upd_cnt );
+  return 1;
+}
+
+/* FD_ACCOUNTS_HASH_CACHE_MERGE_THRESH(pair_cnt) gives the number of
+   pending updates above which fd_accounts_hash_cache_publish merges
+   them into a partition of pair_cnt pairs.  This bounds the backlog
+   while keeping the amortized merge cost per update constant. */
+
+#define FD_ACCOUNTS_HASH_CACHE_MERGE_THRESH(pair_cnt) ((pair_cnt)/8UL + 4096UL)
+
+ulong
+fd_accounts_hash_cache_publish( fd_accounts_hash_cache_t * cache,
+                                fd_valloc_t                valloc,
+                                ulong                      root_slot ) {
+  int has_results = fd_accounts_hash_cache_has_results( cache );
+
+  ulong delta_cnt = 0UL;
+  for( ulong i=0UL; i<cache->delta_cnt; i++ ) {
+    fd_accounts_hash_cache_delta_t * delta = cache->delta + i;
+    if( delta->slot>root_slot ) {
+      if( delta_cnt!=i ) cache->delta[ delta_cnt ] = *delta;
+      delta_cnt++;
+      continue;
+    }
+    if( has_results ) fd_lthash_add( &cache->lthash, &delta->lthash );
+  }
+  cache->delta_cnt = delta_cnt;
+
+  ulong                           merge_cnt = 0UL;
+  fd_accounts_hash_cache_part_t * parts     = fd_accounts_hash_cache_part( cache );
+  for( ulong p=0UL; p<cache->part_cnt; p++ ) {
+    fd_accounts_hash_cache_part_t * part = parts + p;
+    if( !has_results ) {
+      fd_accounts_hash_cache_part_drop( part, fd_accounts_hash_cache_part_rooted( part, root_slot ) );
+    } else if( part->upd_cnt>FD_ACCOUNTS_HASH_CACHE_MERGE_THRESH( part->pair_cnt ) ) {
+      merge_cnt += (ulong)fd_accounts_hash_cache_part_merge( part, valloc, root_slot );
+    }
+  }
+  return merge_cnt;
+}
@@ -0,0 +1,270 @@
+#ifndef HEADER_fd_src_flamenco_runtime_fd_accounts_hash_cache_h
+#define HEADER_fd_src_flamenco_runtime_fd_accounts_hash_cache_h
+
+/* fd_accounts_hash_cache caches the per-partition results of a full
+   accounts hash (see fd_accounts_hash_cached in fd_hashes.h).
+
+   The account address space is split into part_cnt=2^lg_part_cnt
+   partitions, partition i holding the accounts whose address,
+   interpreted as a big endian number, has i as its lg_part_cnt most
+   significant bits.  Hence, concatenating the partitions in index
+   order yields the accounts sorted the way the accounts hash Merkle
+   tree wants them.  For each partition, the cache holds the sorted
+   (address, account hash) pairs that contribute leaves to the accounts
+   hash.  The cache also holds the lthash sum of all accounts.
+
+   The results are built once by scanning the funk root (the first
+   fd_accounts_hash_cached after new or reset).  From then on, the
+   runtime feeds the cache the outcome of every account modification
+   instead: fd_update_hash_bank_tpool records the new account hash of
+   every account it rehashes with fd_accounts_hash_cache_mark and the
+   slot's lthash delta (new minus old lthash of those accounts) with
+   fd_accounts_hash_cache_mark_lthash.  Updates and deltas stay pending
+   until their slot is rooted in funk.  Rooted deltas are added to the
+   cached lthash and rooted updates are merged into the sorted pairs of
+   their partition (fd_accounts_hash_cache_publish merges partitions
+   whose backlog grew large, fd_accounts_hash_cached merges the rest).
+   Hence, neither a partition's accounts get rehashed nor its pairs get
+   re-sorted after the initial scan, and the cost of a full accounts
+   hash is proportional to the number of accounts modified since the
+   previous one (plus a Merkle fold over the cached hashes).
+
+   Pending updates are applied when their slot is not newer than the
+   funk root, so the cache assumes that every marked slot eventually
+   gets rooted, as when replaying a single chain of slots (fd_ledger).
+   A cache that was marked for a slot that then got abandoned must be
+   reset.
+
+   Pair, update and delta arrays are allocated from the valloc given to
+   the operations below, which must be the same (persistent) allocator
+   for the lifetime of a cache.  Hence a cache is local to the process
+   that created it.  Marking is not safe concurrently with other
+   operations on the same cache. */
+
+#include "../fd_flamenco_base.h"
+#include "../types/fd_types.h"
+#include "../../ballet/lthash/fd_lthash.h"
+
+#define FD_ACCOUNTS_HASH_CACHE_ALIGN (128UL)
+#define FD_ACCOUNTS_HASH_CACHE_MAGIC (0xf17eda2ce7acc4a1UL) /* firedancer accounts hash cache version 1 */
+
+/* FD_ACCOUNTS_HASH_CACHE_LG_PART_CNT_{DEFAULT,MAX} give the default
+   and maximum log2 number of partitions.  Each partition costs its
+   pair array plus its backlog of pending updates. */
+
+#define FD_ACCOUNTS_HASH_CACHE_LG_PART_CNT_DEFAULT (10)
+#define FD_ACCOUNTS_HASH_CACHE_LG_PART_CNT_MAX     (16)
+
+struct fd_accounts_hash_cache_pair {
+  fd_pubkey_t pubkey;
+  fd_hash_t   hash;
+};
+
+typedef struct fd_accounts_hash_cache_pair fd_accounts_hash_cache_pair_t;
+
+/* fd_accounts_hash_cache_upd_t is a pending update of the pair of an
+   account.  An all zero hash removes the account's pair. */
+
+struct fd_accounts_hash_cache_upd {
+  fd_pubkey_t pubkey;
+  fd_hash_t   hash;
+  ulong       slot; /* Slot of the modification */
+  ulong       seq;  /* Order of the modification among all updates */
+};
+
+typedef struct fd_accounts_hash_cache_upd fd_accounts_hash_cache_upd_t;
+
+/* fd_accounts_hash_cache_delta_t is the pending lthash delta of the
+   accounts modified in slot. */
+
+struct __attribute__((aligned(FD_LTHASH_VALUE_ALIGN))) fd_accounts_hash_cache_delta {
+  fd_lthash_value_t lthash;
+  ulong             slot;
+};
+
+typedef struct fd_accounts_hash_cache_delta fd_accounts_hash_cache_delta_t;
+
+struct fd_accounts_hash_cache_part {
+  ulong                           dirty;    /* 1 if the pairs were modified since the last full hash */
+  ulong                           pair_cnt; /* Number of cached pairs */
+  ulong                           pair_max; /* Capacity of pair */
+  fd_accounts_hash_cache_pair_t * pair;     /* Cached pairs sorted by address, NULL if pair_max is 0 */
+  ulong                           upd_cnt;  /* Number of pending updates */
+  ulong                           upd_max;  /* Capacity of upd */
+  fd_accounts_hash_cache_upd_t *  upd;      /* Pending updates in no particular order, NULL if upd_max is 0 */
+};
+
+typedef struct fd_accounts_hash_cache_part fd_accounts_hash_cache_part_t;
+
+struct __attribute__((aligned(FD_ACCOUNTS_HASH_CACHE_ALIGN))) fd_accounts_hash_cache {
+  ulong magic;       /* ==FD_ACCOUNTS_HASH_CACHE_MAGIC */
+  ulong lg_part_cnt; /* In [0,FD_ACCOUNTS_HASH_CACHE_LG_PART_CNT_MAX] */
+  ulong part_cnt;    /* ==2^lg_part_cnt */
+  ulong part_off;    /* Byte offset of the partitions from the cache */
+
+  ulong scan_slot;   /* Funk root slot of the initial scan, ULONG_MAX if the cache has no results */
+  ulong upd_seq;     /* Sequence number of the next update */
+
+  ulong delta_cnt;   /* Number of pending lthash deltas */
+  ulong delta_max;   /* Capacity of delta */
+  fd_accounts_hash_cache_delta_t * delta; /* Pending lthash deltas, NULL if delta_max is 0 */
+
+  ulong hit_cnt;     /* Number of partitions reused as is by full hashes */
+  ulong miss_cnt;    /* Number of partitions scanned or merged into by full hashes */
+
+  fd_lthash_value_t lthash; /* lthash sum of all accounts as of the funk root, if scan_slot is valid */
+
+  /* Padding to FD_ACCOUNTS_HASH_CACHE_ALIGN here */
+  /* part_cnt fd_accounts_hash_cache_part_t here */
+};
+
+/* Note: fd_accounts_hash_cache_t is declared in fd_flamenco_base.h */
+
+FD_PROTOTYPES_BEGIN
+
+/* fd_accounts_hash_cache_{align,footprint} return the required
+   alignment and footprint of a memory region suitable for use as a
+   cache with 2^lg_part_cnt partitions.  footprint returns 0 if
+   lg_part_cnt is not in [0,FD_ACCOUNTS_HASH_CACHE_LG_PART_CNT_MAX]. */
+
+FD_FN_CONST ulong
+fd_accounts_hash_cache_align( void );
+
+FD_FN_CONST ulong
+fd_accounts_hash_cache_footprint( ulong lg_part_cnt );
+
+/* fd_accounts_hash_cache_{new,join,leave,delete} follow the usual
+   conventions.  new formats shmem as a cache with 2^lg_part_cnt
+   partitions, without cached results.  Arrays must be released with
+   fd_accounts_hash_cache_reset before delete. */
+
+void *
+fd_accounts_hash_cache_new( void * shmem,
+                            ulong  lg_part_cnt );
+
+fd_accounts_hash_cache_t *
+fd_accounts_hash_cache_join( void * shcache );
+
+void *
+fd_accounts_hash_cache_leave( fd_accounts_hash_cache_t * cache );
+
+void *
+fd_accounts_hash_cache_delete( void * shcache );
+
+/* fd_accounts_hash_cache_reset frees the arrays of cache to valloc and
+   drops all cached results and pending updates (e.g. because funk's
+   root was modified behind the cache's back, such as by a snapshot
+   load, or a marked slot was abandoned). */
+
+void
+fd_accounts_hash_cache_reset( fd_accounts_hash_cache_t * cache,
+                              fd_valloc_t                valloc );
+
+/* fd_accounts_hash_cache_part returns the partitions of cache.
+   fd_accounts_hash_cache_part_idx returns the index of the partition
+   holding the account at address pubkey. */
+
+static inline fd_accounts_hash_cache_part_t *
+fd_accounts_hash_cache_part( fd_accounts_hash_cache_t * cache ) {
+  return (fd_accounts_hash_cache_part_t *)((ulong)cache + cache->part_off);
+}
+
+FD_FN_PURE static inline ulong
+fd_accounts_hash_cache_part_idx( fd_accounts_hash_cache_t const * cache,
+                                 fd_pubkey_t const *              pubkey ) {
+  if( FD_UNLIKELY( !cache->lg_part_cnt ) ) return 0UL;
+  return fd_ulong_bswap( pubkey->ul[0] ) >> (64UL-cache->lg_part_cnt);
+}
+
+/* fd_accounts_hash_cache_has_results returns 1 if cache holds the
+   results of an initial scan and 0 otherwise. */
+
+FD_FN_PURE static inline int
+fd_accounts_hash_cache_has_results( fd_accounts_hash_cache_t const * cache ) {
+  return cache->scan_slot!=ULONG_MAX;
+}
+
+/* fd_accounts_hash_cache_mark records that the account at address
+   pubkey was modified in slot and that its account hash is now hash.
+   hash is NULL if the account does not contribute a pair to the
+   accounts hash anymore (e.g. it was closed). */
+
+void
+fd_accounts_hash_cache_mark( fd_accounts_hash_cache_t * cache,
+                             fd_valloc_t                valloc,
+                             fd_pubkey_t const *        pubkey,
+                             fd_hash_t const *          hash,
+                             ulong                      slot );
+
+/* fd_accounts_hash_cache_mark_lthash adds lthash, the sum over the
+   accounts modified in slot of their new lthash minus their previous
+   lthash, to the pending lthash delta of slot. */
+
+void
+fd_accounts_hash_cache_mark_lthash( fd_accounts_hash_cache_t * cache,
+                                    fd_valloc_t                valloc,
+                                    fd_lthash_value_t const *  lthash,
+                                    ulong                      slot );
+
+/* fd_accounts_hash_cache_publish applies the pending lthash deltas of
+   the slots not newer than root_slot, the funk root slot, and merges
+   the pending updates of the partitions where those have piled up.
+   If cache has no results, they are dropped instead, as the initial
+   scan will see them.  Returns the number of partitions merged. */
+
+ulong
+fd_accounts_hash_cache_publish( fd_accounts_hash_cache_t * cache,
+                                fd_valloc_t                valloc,
+                                ulong                      root_slot );
+
+/* fd_accounts_hash_cache_part_merge merges the pending updates of part
+   for the slots not newer than root_slot into part's pairs.  Returns 1
+   if any were merged and 0 otherwise.  Safe to call concurrently for
+   different partitions if valloc is thread safe. */
+
+int
+fd_accounts_hash_cache_part_merge( fd_accounts_hash_cache_part_t * part,
+                                   fd_valloc_t                     valloc,
+                                   ulong                           root_slot );
+
+/* fd_accounts_hash_cache_part_append appends the pair (pubkey,hash) to
+   part, growing part's pair array from valloc as needed.  Used by the
+   initial scan. */
+
+void
+fd_accounts_hash_cache_part_append( fd_accounts_hash_cache_part_t * part,
+                                    fd_valloc_t                     valloc,
+                                    fd_pubkey_t const *             pubkey,
+                                    fd_hash_t const *               hash );
+
+/* fd_accounts_hash_cache_{pubkey,pair}_before return 1 if the address
+   (of the pair) a sorts before the one of b in an accounts hash (by
+   address, interpreted as a big endian number) and 0 otherwise. */
+
+FD_FN_PURE static inline int
+fd_accounts_hash_cache_pubkey_before( fd_pubkey_t const * a,
+                                      fd_pubkey_t const * b ) {
+  for( ulong i=0UL; i<sizeof(fd_pubkey_t)/sizeof(ulong); i++ ) {
+    /* First byte is least significant when seen as a long. Make it most significant. */
+    ulong al = fd_ulong_bswap( a->ul[i] );
+    ulong bl = fd_ulong_bswap( b->ul[i] );
+    if( al!=bl ) return al<bl;
+  }
+  return 0;
+}
+
+FD_FN_PURE static inline int
+fd_accounts_hash_cache_pair_before( fd_accounts_hash_cache_pair_t const * a,
+                                    fd_accounts_hash_cache_pair_t const * b ) {
+  return fd_accounts_hash_cache_pubkey_before( &a->pubkey, &b->pubkey );
+}
+
+/* Accessors */
+
+FD_FN_PURE static inline ulong fd_accounts_hash_cache_part_cnt( fd_accounts_hash_cache_t const * cache ) { return cache->part_cnt; }
+FD_FN_PURE static inline ulong fd_accounts_hash_cache_hit_cnt ( fd_accounts_hash_cache_t const * cache ) { return cache->hit_cnt;  }
+FD_FN_PURE static inline ulong fd_accounts_hash_cache_miss_cnt( fd_accounts_hash_cache_t const * cache ) { return cache->miss_cnt; }
+
+FD_PROTOTYPES_END
+
+#endif /* HEADER_fd_src_flamenco_runtime_fd_accounts_hash_cache_h */
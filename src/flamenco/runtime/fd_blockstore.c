@@ -5,6 +5,15 @@
 #include <stdio.h> /* snprintf */
 #include <unistd.h>
 
+#if FD_HAS_ZSTD
+#include "../../ballet/zstd/fd_zstd.h"
+#endif
+
+/* ARCHIVE_MAGIC_V1 is the magic of archives that persisted the block
+   index past the end of the file size limit. */
+
+#define ARCHIVE_MAGIC_V1 (0xf17eda2ce7b1ac01UL)
+
 void *
 fd_blockstore_new( void * shmem,
                    ulong  wksp_tag,
@@ -60,8 +69,9 @@ fd_blockstore_new( void * shmem,
   FD_COMPILER_MFENCE();
 
   blockstore->archiver = (fd_blockstore_archiver_t){
-      .magic       = FD_BLOCKSTORE_MAGIC,
+      .magic       = FD_BLOCKSTORE_ARCHIVE_MAGIC,
       .fd_size_max = FD_BLOCKSTORE_ARCHIVE_MIN_SIZE,
+      .idx_off     = FD_BLOCKSTORE_ARCHIVE_MIN_SIZE,
       .head        = FD_BLOCKSTORE_ARCHIVE_START,
       .tail        = FD_BLOCKSTORE_ARCHIVE_START,
       .num_blocks  = 0,
@@ -188,35 +198,98 @@ fd_blockstore_delete( void * shblockstore ) {
   return blockstore;
 }
 
-static inline void check_read_write_err( int err ) {
-  if( FD_UNLIKELY( err < 0 ) ) {
-    FD_LOG_ERR(( "unexpected EOF %s", strerror( errno ) ));
+ulong
+fd_blockstore_codec_align( void ) {
+  return FD_BLOCKSTORE_CODEC_ALIGN;
+}
+
+ulong
+fd_blockstore_codec_footprint( int compress ) {
+  ulong l = FD_LAYOUT_INIT;
+  l = FD_LAYOUT_APPEND( l, alignof(fd_blockstore_codec_t), sizeof(fd_blockstore_codec_t) );
+#if FD_HAS_ZSTD
+  if( compress ) {
+    l = FD_LAYOUT_APPEND( l, fd_zstd_cstream_align(), fd_zstd_cstream_footprint( FD_BLOCKSTORE_ARCHIVE_ZSTD_LEVEL ) );
+    l = FD_LAYOUT_APPEND( l, 128UL,                   FD_BLOCKSTORE_CODEC_ZDATA_MAX                                  );
+  }
+  l = FD_LAYOUT_APPEND( l, fd_zstd_dstream_align(), fd_zstd_dstream_footprint( fd_zstd_cstream_window_sz( FD_BLOCKSTORE_ARCHIVE_ZSTD_LEVEL ) ) );
+  l = FD_LAYOUT_APPEND( l, 128UL,                   FD_BLOCKSTORE_CODEC_CHUNK_SZ );
+#else
+  (void)compress;
+#endif
+  return FD_LAYOUT_FINI( l, fd_blockstore_codec_align() );
+}
+
+fd_blockstore_codec_t *
+fd_blockstore_codec_new( void * mem, int compress ) {
+  if( FD_UNLIKELY( !mem ) ) {
+    FD_LOG_WARNING(( "NULL mem" ));
+    return NULL;
   }
-  if( FD_UNLIKELY( err > 0 ) ) {
-    FD_LOG_ERR(( "unable to read/write %s", strerror( errno ) ));
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)mem, fd_blockstore_codec_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned mem" ));
+    return NULL;
   }
+
+  FD_SCRATCH_ALLOC_INIT( l, mem );
+  fd_blockstore_codec_t * codec = FD_SCRATCH_ALLOC_APPEND( l, alignof(fd_blockstore_codec_t), sizeof(fd_blockstore_codec_t) );
+  fd_memset( codec, 0, sizeof(fd_blockstore_codec_t) );
+#if FD_HAS_ZSTD
+  if( compress ) {
+    void * cstream_mem = FD_SCRATCH_ALLOC_APPEND( l, fd_zstd_cstream_align(), fd_zstd_cstream_footprint( FD_BLOCKSTORE_ARCHIVE_ZSTD_LEVEL ) );
+    codec->zdata       = FD_SCRATCH_ALLOC_APPEND( l, 128UL,                   FD_BLOCKSTORE_CODEC_ZDATA_MAX                                  );
+    codec->cstream     = fd_zstd_cstream_new( cstream_mem, FD_BLOCKSTORE_ARCHIVE_ZSTD_LEVEL );
+    if( FD_UNLIKELY( !codec->cstream ) ) return NULL;
+  }
+  ulong  window_sz   = fd_zstd_cstream_window_sz( FD_BLOCKSTORE_ARCHIVE_ZSTD_LEVEL );
+  void * dstream_mem = FD_SCRATCH_ALLOC_APPEND( l, fd_zstd_dstream_align(), fd_zstd_dstream_footprint( window_sz ) );
+  codec->chunk       = FD_SCRATCH_ALLOC_APPEND( l, 128UL,                   FD_BLOCKSTORE_CODEC_CHUNK_SZ );
+  codec->dstream     = fd_zstd_dstream_new( dstream_mem, window_sz );
+  if( FD_UNLIKELY( !codec->dstream ) ) return NULL;
+#else
+  (void)compress;
+#endif
+  FD_SCRATCH_ALLOC_FINI( l, fd_blockstore_codec_align() );
+
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( codec->magic ) = FD_BLOCKSTORE_CODEC_MAGIC;
+  FD_COMPILER_MFENCE();
+
+  return codec;
 }
 
-ulong
-fd_blockstore_archiver_lrw_slot( fd_blockstore_t * blockstore, int fd, fd_block_map_t * lrw_block_map, fd_block_t * lrw_block ) {
-  fd_block_idx_t * block_idx = fd_blockstore_block_idx( blockstore );
-  if ( FD_UNLIKELY ( fd_block_idx_key_cnt( block_idx ) == 0 ) ) {
-    return FD_SLOT_NULL;
+void *
+fd_blockstore_codec_delete( fd_blockstore_codec_t * codec ) {
+  if( FD_UNLIKELY( !codec ) ) {
+    FD_LOG_WARNING(( "NULL codec" ));
+    return NULL;
   }
 
-  fd_block_idx_t lrw_block_idx = { 0 };
-  lrw_block_idx.off = blockstore->archiver.head;
-  int err = fd_blockstore_block_meta_restore(&blockstore->archiver, fd, &lrw_block_idx, lrw_block_map,  lrw_block);
-  check_read_write_err( err );
-  return lrw_block_map->slot;
+  if( FD_UNLIKELY( codec->magic != FD_BLOCKSTORE_CODEC_MAGIC ) ) {
+    FD_LOG_WARNING(( "bad magic" ));
+    return NULL;
+  }
+
+#if FD_HAS_ZSTD
+  if( codec->cstream ) fd_zstd_cstream_delete( codec->cstream );
+  if( codec->dstream ) fd_zstd_dstream_delete( codec->dstream );
+#endif
+
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( codec->magic ) = 0UL;
+  FD_COMPILER_MFENCE();
+
+  return codec;
 }
 
-bool
-fd_blockstore_archiver_verify( fd_blockstore_t * blockstore, fd_blockstore_archiver_t * fd_metadata ) {
-  return ( fd_metadata->head < FD_BLOCKSTORE_ARCHIVE_START )
-         || ( fd_metadata->tail < FD_BLOCKSTORE_ARCHIVE_START )
-         || ( fd_metadata->fd_size_max != blockstore->archiver.fd_size_max ) // should be initialized same as archive file
-         || ( fd_metadata->magic != FD_BLOCKSTORE_MAGIC );
+static inline void check_read_write_err( int err ) {
+  if( FD_UNLIKELY( err < 0 ) ) {
+    FD_LOG_ERR(( "unexpected EOF %s", strerror( errno ) ));
+  }
+  if( FD_UNLIKELY( err > 0 ) ) {
+    FD_LOG_ERR(( "unable to read/write %s", strerror( errno ) ));
+  }
 }
 
 #define check_read_err_safe( cond, msg )            \
@@ -238,7 +311,7 @@ static int read_with_wraparound( fd_blockstore_archiver_t * archvr,
   check_read_err_safe( lseek( fd, (long)*read_off, SEEK_SET ) == -1,
                        "failed to seek to read offset" );
 
-  ulong remaining_sz = archvr->fd_size_max - *read_off;
+  ulong remaining_sz = archvr->idx_off - *read_off;
   if ( remaining_sz < dst_sz ) {
     int err = fd_io_read( fd, dst, remaining_sz, remaining_sz, rsz );
     check_read_err_safe( err, "failed to read file near end" );
@@ -253,9 +326,9 @@ static int read_with_wraparound( fd_blockstore_archiver_t * archvr,
     check_read_err_safe( err, "failed to read file" );
     *read_off += *rsz;
   }
-  // if we read to EOF, set read_off ready for next read
-  // In reality should never be > blockstore->fd_size_max
-  if ( *read_off >= archvr->fd_size_max ) {
+  // if we read to the end of the ring, set read_off ready for next read
+  // In reality should never be > archvr->idx_off
+  if ( *read_off >= archvr->idx_off ) {
     *read_off = FD_BLOCKSTORE_ARCHIVE_START;
   }
 
@@ -264,15 +337,242 @@ static int read_with_wraparound( fd_blockstore_archiver_t * archvr,
 
 static ulong
 wrap_offset( fd_blockstore_archiver_t * archvr, ulong off ) {
-  if ( off == archvr->fd_size_max ) {
+  if ( off == archvr->idx_off ) {
     return FD_BLOCKSTORE_ARCHIVE_START;
-  } else if ( off > archvr->fd_size_max ) {
-    return FD_BLOCKSTORE_ARCHIVE_START + ( off - archvr->fd_size_max );
+  } else if ( off > archvr->idx_off ) {
+    return FD_BLOCKSTORE_ARCHIVE_START + ( off - archvr->idx_off );
   } else {
     return off;
   }
 }
 
+/* ring_dist returns the number of bytes from off0 forward to off1 in
+   the archive ring. */
+
+static ulong
+ring_dist( fd_blockstore_archiver_t const * archvr, ulong off0, ulong off1 ) {
+  if( off1 >= off0 ) return off1 - off0;
+  return ( archvr->idx_off - off0 ) + ( off1 - FD_BLOCKSTORE_ARCHIVE_START );
+}
+
+/* archive_rec_footprint returns the on-disk size of the record with
+   header rec. */
+
+static inline ulong
+archive_rec_footprint( fd_blockstore_archive_rec_t const * rec ) {
+  return sizeof(fd_blockstore_archive_rec_t) + sizeof(fd_block_map_t) + sizeof(fd_block_t) + rec->data_sz;
+}
+
+/* archive_rec_read reads the header, block map entry and block of the
+   record at off. */
+
+static int
+archive_rec_read( fd_blockstore_archiver_t *    archvr,
+                  int                           fd,
+                  ulong                         off,
+                  fd_blockstore_archive_rec_t * rec_out,
+                  fd_block_map_t *              block_map_entry_out,
+                  fd_block_t *                  block_out ) {
+  ulong rsz;
+  ulong read_off = off;
+  int err = read_with_wraparound( archvr,
+                                  fd,
+                                  (uchar *)fd_type_pun( rec_out ),
+                                  sizeof(fd_blockstore_archive_rec_t),
+                                  &rsz,
+                                  &read_off );
+  check_read_err_safe( err, "failed to read record header" );
+  check_read_err_safe( rec_out->magic != FD_BLOCKSTORE_ARCHIVE_REC_MAGIC, "bad record magic" );
+  err = read_with_wraparound( archvr,
+                              fd,
+                              (uchar *)fd_type_pun( block_map_entry_out ),
+                              sizeof(fd_block_map_t),
+                              &rsz,
+                              &read_off );
+  check_read_err_safe( err, "failed to read block map" );
+  err = read_with_wraparound( archvr,
+                              fd,
+                              (uchar *)fd_type_pun( block_out ),
+                              sizeof(fd_block_t),
+                              &rsz,
+                              &read_off );
+  check_read_err_safe( err, "failed to read block" );
+  check_read_err_safe( rec_out->slot != block_map_entry_out->slot || rec_out->raw_sz != block_out->data_sz,
+                       "record header does not match block" );
+  return FD_BLOCKSTORE_OK;
+}
+
+/* archive_lrw_read reads the least recently written record.  Returns
+   its slot or FD_SLOT_NULL if the archive is empty. */
+
+static ulong
+archive_lrw_read( fd_blockstore_t *             blockstore,
+                  int                           fd,
+                  fd_blockstore_archive_rec_t * lrw_rec,
+                  fd_block_map_t *              lrw_block_map,
+                  fd_block_t *                  lrw_block ) {
+  fd_block_idx_t * block_idx = fd_blockstore_block_idx( blockstore );
+  if ( FD_UNLIKELY ( fd_block_idx_key_cnt( block_idx ) == 0 ) ) {
+    return FD_SLOT_NULL;
+  }
+
+  int err = archive_rec_read( &blockstore->archiver, fd, blockstore->archiver.head, lrw_rec, lrw_block_map, lrw_block );
+  check_read_write_err( err );
+  return lrw_block_map->slot;
+}
+
+ulong
+fd_blockstore_archiver_lrw_slot( fd_blockstore_t * blockstore, int fd, fd_block_map_t * lrw_block_map, fd_block_t * lrw_block ) {
+  fd_blockstore_archive_rec_t lrw_rec;
+  return archive_lrw_read( blockstore, fd, &lrw_rec, lrw_block_map, lrw_block );
+}
+
+/* archive_evict_lrw drops the least recently written record from the
+   index and the archive. */
+
+static void
+archive_evict_lrw( fd_blockstore_t * blockstore, int fd ) {
+  fd_blockstore_archiver_t *  archvr    = &blockstore->archiver;
+  fd_block_idx_t *            block_idx = fd_blockstore_block_idx( blockstore );
+  fd_blockstore_archive_rec_t lrw_rec;
+  fd_block_map_t              lrw_block_map;
+  fd_block_t                  lrw_block;
+
+  ulong lrw_slot = archive_lrw_read( blockstore, fd, &lrw_rec, &lrw_block_map, &lrw_block );
+  fd_block_idx_t * lrw_block_index = fd_block_idx_query( block_idx, lrw_slot, NULL );
+  if( FD_LIKELY( lrw_block_index ) ) fd_block_idx_remove( block_idx, lrw_block_index );
+
+  archvr->head = wrap_offset( archvr, archvr->head + archive_rec_footprint( &lrw_rec ) );
+  archvr->num_blocks--;
+}
+
+bool
+fd_blockstore_archiver_verify( fd_blockstore_t * blockstore, fd_blockstore_archiver_t * fd_metadata ) {
+  return ( fd_metadata->head < FD_BLOCKSTORE_ARCHIVE_START )
+         || ( fd_metadata->tail < FD_BLOCKSTORE_ARCHIVE_START )
+         || ( fd_metadata->head >= fd_metadata->idx_off )
+         || ( fd_metadata->tail >= fd_metadata->idx_off )
+         || ( fd_metadata->fd_size_max != blockstore->archiver.fd_size_max ) // should be initialized same as archive file
+         || ( fd_metadata->idx_off <= FD_BLOCKSTORE_ARCHIVE_START )
+         || ( fd_metadata->idx_off + fd_blockstore_archive_idx_footprint( blockstore ) > fd_metadata->fd_size_max ) // index must fit before the size limit
+         || ( fd_metadata->magic != FD_BLOCKSTORE_ARCHIVE_MAGIC );
+}
+
+/* Index entries are persisted and loaded in batches of
+   ARCHIVE_IDX_BATCH_MAX.  The index checksum is chained across batches,
+   so the batching must be the same on both sides. */
+
+#define ARCHIVE_IDX_BATCH_MAX (256UL)
+
+/* archive_scan indexes the cnt records starting at off, evicting the
+   least recently written records if the index is full.  Returns the
+   offset after the last record scanned. */
+
+static ulong
+archive_scan( fd_blockstore_t * blockstore, int fd, ulong off, ulong cnt ) {
+  fd_block_idx_t * block_idx = fd_blockstore_block_idx( blockstore );
+
+  for( ulong i = 0; i < cnt; i++ ) {
+    fd_blockstore_archive_rec_t rec;
+    fd_block_map_t              block_map_out;
+    fd_block_t                  block_out;
+    int err = archive_rec_read( &blockstore->archiver, fd, off, &rec, &block_map_out, &block_out );
+    check_read_write_err( err );
+
+    if( FD_UNLIKELY( fd_block_idx_key_cnt( block_idx ) == fd_block_idx_key_max( block_idx ) )  ) {
+      archive_evict_lrw( blockstore, fd );
+    }
+    fd_block_idx_t * idx_entry = fd_block_idx_query( block_idx, block_map_out.slot, NULL );
+    if ( FD_UNLIKELY( idx_entry ) ) {
+      FD_LOG_WARNING(( "[%s] archival file contained duplicates of slot %lu", __func__, block_map_out.slot ));
+      fd_block_idx_remove( block_idx, idx_entry );
+    }
+
+    idx_entry = fd_block_idx_insert( block_idx, block_map_out.slot );
+    idx_entry->off             = off;
+    idx_entry->block_hash      = block_map_out.block_hash;
+    idx_entry->bank_hash       = block_map_out.bank_hash;
+    blockstore->mrw_slot       = block_map_out.slot;
+
+    FD_LOG_DEBUG(( "[%s] read block (%lu/%lu) at offset: %lu. slot no: %lu", __func__, i+1UL, cnt, off, block_map_out.slot ));
+
+    /* seek past data */
+    off = wrap_offset( &blockstore->archiver, off + archive_rec_footprint( &rec ) );
+  }
+  return off;
+}
+
+/* archive_idx_load rebuilds the index from the index persisted in the
+   archival file and the records archived after it was persisted.
+   Returns 1 on success and 0 if there is no usable persisted index (in
+   which case the index is left empty). */
+
+static int
+archive_idx_load( fd_blockstore_t * blockstore, int fd ) {
+  fd_blockstore_archiver_t * archvr    = &blockstore->archiver;
+  fd_block_idx_t *           block_idx = fd_blockstore_block_idx( blockstore );
+
+  if( FD_UNLIKELY( !archvr->idx_cnt ) ) return 0;
+  if( FD_UNLIKELY( archvr->idx_cnt > fd_block_idx_key_max( block_idx ) ) ) return 0;
+
+  /* Every block archived after the index was persisted must still be in
+     the archive (otherwise the index is stale) and the archive must fit
+     in the index without evicting. */
+
+  ulong scan_cnt = archvr->rec_cnt - archvr->idx_rec_cnt;
+  if( FD_UNLIKELY( archvr->idx_rec_cnt > archvr->rec_cnt || scan_cnt > archvr->num_blocks ) ) return 0;
+  if( FD_UNLIKELY( archvr->num_blocks > fd_block_idx_key_max( block_idx ) ) ) return 0;
+  ulong live_cnt = archvr->num_blocks - scan_cnt;
+  ulong live_sz  = ring_dist( archvr, archvr->head, archvr->idx_tail );
+
+  if( FD_UNLIKELY( lseek( fd, (long)archvr->idx_off, SEEK_SET ) == -1 ) ) return 0;
+
+  fd_blockstore_archive_idx_entry_t batch[ ARCHIVE_IDX_BATCH_MAX ];
+  ulong hash     = 0UL;
+  ulong load_cnt = 0UL;
+  int   ok       = 1;
+  for( ulong i = 0; ok && i < archvr->idx_cnt; i += ARCHIVE_IDX_BATCH_MAX ) {
+    ulong batch_cnt = fd_ulong_min( ARCHIVE_IDX_BATCH_MAX, archvr->idx_cnt - i );
+    ulong batch_sz  = batch_cnt * sizeof(fd_blockstore_archive_idx_entry_t);
+    ulong rsz;
+    if( FD_UNLIKELY( fd_io_read( fd, batch, batch_sz, batch_sz, &rsz ) ) ) { ok = 0; break; }
+    hash = fd_hash( hash, batch, batch_sz );
+
+    for( ulong j = 0; j < batch_cnt; j++ ) {
+      fd_blockstore_archive_idx_entry_t const * entry = &batch[j];
+
+      /* Skip entries overwritten since the index was persisted */
+
+      if( ring_dist( archvr, archvr->head, entry->off ) >= live_sz ) continue;
+      if( FD_UNLIKELY( load_cnt == live_cnt || fd_block_idx_key_inval( entry->slot ) ||
+                       fd_block_idx_query( block_idx, entry->slot, NULL ) ) ) { ok = 0; break; }
+
+      fd_block_idx_t * idx_entry = fd_block_idx_insert( block_idx, entry->slot );
+      idx_entry->off        = entry->off;
+      idx_entry->block_hash = entry->block_hash;
+      idx_entry->bank_hash  = entry->bank_hash;
+      load_cnt++;
+    }
+  }
+
+  if( FD_UNLIKELY( !ok || hash != archvr->idx_hash || load_cnt != live_cnt ) ) {
+    FD_LOG_WARNING(( "[%s] persisted index of archival file is invalid or stale", __func__ ));
+    fd_block_idx_clear( block_idx );
+    return 0;
+  }
+
+  blockstore->mrw_slot = archvr->idx_mrw_slot;
+  ulong off = archive_scan( blockstore, fd, archvr->idx_tail, scan_cnt );
+  if( FD_UNLIKELY( off != archvr->tail ) ) {
+    FD_LOG_WARNING(( "[%s] records archived after the persisted index do not end at the archive tail", __func__ ));
+    fd_block_idx_clear( block_idx );
+    return 0;
+  }
+
+  FD_LOG_NOTICE(( "[%s] loaded persisted index: %lu entries, %lu read back", __func__, load_cnt, scan_cnt ));
+  return 1;
+}
+
 /* Build the archival file index */
 
 static inline void FD_FN_UNUSED
@@ -284,8 +584,6 @@ build_idx( fd_blockstore_t * blockstore, int fd ) {
   FD_LOG_NOTICE(( "[%s] building index of blockstore archival file", __func__ ));
 
   fd_block_idx_t * block_idx = fd_blockstore_block_idx( blockstore );
-  fd_block_map_t block_map_out = { 0 };
-  fd_block_t     block_out     = { 0 };
 
   off_t sz = lseek( fd, 0, SEEK_END );
   if ( FD_UNLIKELY( sz == -1 ) ) {
@@ -301,66 +599,55 @@ build_idx( fd_blockstore_t * blockstore, int fd ) {
   fd_blockstore_archiver_t metadata;
   err = fd_io_read( fd, &metadata, sizeof(fd_blockstore_archiver_t), sizeof(fd_blockstore_archiver_t), &rsz );
   check_read_write_err( err );
+  /* Refuse to overwrite archives that cannot be read back with the
+     current format or limits, rather than silently losing their
+     blocks. */
+
+  if ( FD_UNLIKELY( metadata.magic == FD_BLOCKSTORE_MAGIC || metadata.magic == ARCHIVE_MAGIC_V1 ) ) {
+    FD_LOG_ERR(( "[%s] archival file uses an older format (magic %016lx) that this version cannot read. "
+                 "Move or remove it (blockstore.file) to start a new archive.", __func__, metadata.magic ));
+  }
+  if ( FD_UNLIKELY( metadata.fd_size_max != blockstore->archiver.fd_size_max ||
+                    metadata.idx_off + fd_blockstore_archive_idx_footprint( blockstore ) > metadata.fd_size_max ) ) {
+    FD_LOG_ERR(( "[%s] archival file was created with a different size limit (%lu, expected %lu) or index size. "
+                 "Restore the previous blockstore.idx_max, or move or remove the file to start a new archive.",
+                 __func__, metadata.fd_size_max, blockstore->archiver.fd_size_max ));
+  }
   if ( fd_blockstore_archiver_verify( blockstore, &metadata ) ) {
     FD_LOG_ERR(( "[%s] archival file was invalid: blockstore may have been crashed or been killed mid-write.", __func__ ));
     return;
   }
 
   blockstore->archiver = metadata;
-  ulong off          = metadata.head;
-  ulong total_blocks = metadata.num_blocks;
-  ulong blocks_read  = 0;
 
   /* If the file has content, but is perfectly filled, then off == end at the start.
     Then it is impossible to distinguish from an empty file except for num_blocks field. */
 
-  while ( FD_LIKELY( blocks_read < total_blocks ) ) {
-    blocks_read++;
-    fd_block_idx_t block_idx_entry = { 0 };
-    block_idx_entry.off = off;
-    err = fd_blockstore_block_meta_restore( &blockstore->archiver, fd, &block_idx_entry, &block_map_out,  &block_out );
-    check_read_write_err( err );
-
-    if( FD_UNLIKELY( fd_block_idx_key_cnt( block_idx ) == fd_block_idx_key_max( block_idx ) )  ) {
-      /* evict a block */
-      fd_block_map_t  lrw_block_map;
-      fd_block_t      lrw_block;
-      ulong lrw_slot = fd_blockstore_archiver_lrw_slot( blockstore, fd, &lrw_block_map, &lrw_block );
-
-      fd_block_idx_t * lrw_block_index = fd_block_idx_query( block_idx, lrw_slot, NULL );
-      fd_block_idx_remove( block_idx, lrw_block_index );
-
-      blockstore->archiver.head = wrap_offset(&blockstore->archiver, blockstore->archiver.head + lrw_block.data_sz + sizeof(fd_block_map_t) + sizeof(fd_block_t));;
-      blockstore->archiver.num_blocks--;
-    }
-    fd_block_idx_t * idx_entry = fd_block_idx_query( block_idx, block_map_out.slot, NULL );
-    if ( FD_UNLIKELY( idx_entry ) ) {
-      FD_LOG_WARNING(( "[%s] archival file contained duplicates of slot %lu", __func__, block_map_out.slot ));
-      fd_block_idx_remove( block_idx, idx_entry );
-    }
-
-    idx_entry = fd_block_idx_insert( block_idx, block_map_out.slot );
-    idx_entry->off             = off;
-    idx_entry->block_hash      = block_map_out.block_hash;
-    idx_entry->bank_hash       = block_map_out.bank_hash;
-    blockstore->mrw_slot       = block_map_out.slot;
+  if( FD_LIKELY( archive_idx_load( blockstore, fd ) ) ) {
+    FD_LOG_NOTICE(( "[%s] successfully indexed blockstore archival file. entries: %lu", __func__, fd_block_idx_key_cnt( block_idx ) ));
+    return;
+  }
 
-    FD_LOG_NOTICE(( "[%s] read block (%lu/%lu) at offset: %lu. slot no: %lu", __func__, blocks_read, total_blocks, off, block_map_out.slot ));
+  /* No usable persisted index, read back every record. */
 
-    /* seek past data */
-    off = wrap_offset( &blockstore->archiver, off + sizeof(fd_block_map_t) + sizeof(fd_block_t) + block_out.data_sz );
-    check_read_write_err( lseek( fd, (long)off, SEEK_SET ) == -1);
-  }
+  archive_scan( blockstore, fd, metadata.head, metadata.num_blocks );
   FD_LOG_NOTICE(( "[%s] successfully indexed blockstore archival file. entries: %lu", __func__, fd_block_idx_key_cnt( block_idx ) ));
 }
 
+ulong
+fd_blockstore_archive_idx_footprint( fd_blockstore_t * blockstore ) {
+  return fd_block_idx_key_max( fd_blockstore_block_idx( blockstore ) ) * sizeof(fd_blockstore_archive_idx_entry_t);
+}
+
 fd_blockstore_t *
 fd_blockstore_init( fd_blockstore_t * blockstore, int fd, ulong fd_size_max, fd_slot_bank_t const * slot_bank ) {
-  if ( fd_size_max < FD_BLOCKSTORE_ARCHIVE_MIN_SIZE ) {
+  ulong idx_sz = fd_blockstore_archive_idx_footprint( blockstore );
+  if ( fd_size_max < FD_BLOCKSTORE_ARCHIVE_MIN_SIZE + idx_sz ) {
     FD_LOG_ERR(( "archive file size too small" ));
     return NULL;
   }
   blockstore->archiver.fd_size_max = fd_size_max;
+  blockstore->archiver.idx_off     = fd_size_max - idx_sz;
 
   build_idx( blockstore, fd );
   lseek( fd, 0, SEEK_END );
@@ -441,6 +728,19 @@ fd_blockstore_fini( fd_blockstore_t * blockstore ) {
     fd_block_map_t * ele = fd_block_map_iter_ele( fd_blockstore_block_map( blockstore ), iter );
     fd_blockstore_slot_remove( blockstore, ele->slot );
   }
+
+  /* Drop blocks that are still queued for archival. */
+
+  if( FD_UNLIKELY( blockstore->archive_q_cnt ) ) {
+    FD_LOG_WARNING(( "[%s] dropping %lu blocks queued for archival", __func__, blockstore->archive_q_cnt ));
+  }
+  while( blockstore->archive_q_cnt ) {
+    fd_alloc_free( fd_blockstore_alloc( blockstore ),
+                   fd_wksp_laddr_fast( fd_blockstore_wksp( blockstore ), blockstore->archive_q[ blockstore->archive_q_head ] ) );
+    blockstore->archive_q[ blockstore->archive_q_head ] = 0UL;
+    blockstore->archive_q_head = ( blockstore->archive_q_head + 1UL ) % FD_BLOCKSTORE_ARCHIVE_QUEUE_MAX;
+    blockstore->archive_q_cnt--;
+  }
 }
 
 /* txn map helpers */
@@ -700,7 +1000,7 @@ fd_blockstore_buffered_shreds_remove( fd_blockstore_t * blockstore, ulong slot )
     right after where we just wrote ) */
 static ulong write_with_wraparound( fd_blockstore_archiver_t * archvr,
                                    int fd,
-                                   uchar * src,
+                                   uchar const * src,
                                    ulong src_sz,
                                    ulong write_off ) {
 
@@ -708,7 +1008,7 @@ static ulong write_with_wraparound( fd_blockstore_archiver_t * archvr,
     FD_LOG_ERR(( "[%s] failed to seek to offset %lu", __func__, write_off ));
   }
   ulong wsz;
-  ulong remaining_sz = archvr->fd_size_max - write_off;
+  ulong remaining_sz = archvr->idx_off - write_off;
   if ( remaining_sz < src_sz ) {
     int err = fd_io_write( fd, src, remaining_sz, remaining_sz, &wsz );
     check_read_write_err( err );
@@ -724,7 +1024,7 @@ static ulong write_with_wraparound( fd_blockstore_archiver_t * archvr,
     check_read_write_err( err );
     write_off += wsz;
   }
-  if ( write_off >= archvr->fd_size_max ) {
+  if ( write_off >= archvr->idx_off ) {
     write_off = FD_BLOCKSTORE_ARCHIVE_START;
   }
   return write_off;
@@ -758,16 +1058,17 @@ fd_blockstore_lrw_archive_clear( fd_blockstore_t * blockstore, int fd, ulong wsz
 
   ulong non_wrapped_end = write_off + wsz;
   ulong wrapped_end     = wrap_offset(archvr, non_wrapped_end);
-  bool mrw_wraps        = non_wrapped_end > archvr->fd_size_max;
+  bool mrw_wraps        = non_wrapped_end > archvr->idx_off;
 
   if ( FD_UNLIKELY( fd_block_idx_key_cnt( block_idx ) == 0 ) ) {
     return;
   }
 
-  fd_block_map_t lrw_block_map;
-  fd_block_t     lrw_block;
+  fd_blockstore_archive_rec_t lrw_rec;
+  fd_block_map_t              lrw_block_map;
+  fd_block_t                  lrw_block;
 
-  ulong lrw_slot = fd_blockstore_archiver_lrw_slot( blockstore, fd, &lrw_block_map, &lrw_block );
+  ulong lrw_slot = archive_lrw_read( blockstore, fd, &lrw_rec, &lrw_block_map, &lrw_block );
   fd_block_idx_t * lrw_block_index = fd_block_idx_query( block_idx, lrw_slot, NULL );
 
   while( lrw_block_index &&
@@ -777,10 +1078,10 @@ fd_blockstore_lrw_archive_clear( fd_blockstore_t * blockstore, int fd, ulong wsz
       FD_LOG_DEBUG(( "[%s] overwriting lrw block %lu", __func__, lrw_block_map.slot ));
       fd_block_idx_remove( block_idx, lrw_block_index );
 
-      archvr->head = wrap_offset(archvr, archvr->head + lrw_block.data_sz + sizeof(fd_block_map_t) + sizeof(fd_block_t));
+      archvr->head = wrap_offset( archvr, archvr->head + archive_rec_footprint( &lrw_rec ) );
       archvr->num_blocks--;
 
-      lrw_slot        = fd_blockstore_archiver_lrw_slot( blockstore, fd, &lrw_block_map, &lrw_block );
+      lrw_slot        = archive_lrw_read( blockstore, fd, &lrw_rec, &lrw_block_map, &lrw_block );
       lrw_block_index = fd_block_idx_query(block_idx, lrw_slot, NULL);
 
       if ( lrw_block_index && (lrw_block_index->off != archvr->head) ){
@@ -804,14 +1105,7 @@ static void fd_blockstore_post_checkpt_update( fd_blockstore_t * blockstore,
 
   if ( fd_block_idx_key_cnt( block_idx ) == fd_block_idx_key_max( block_idx ) ){
     /* make space if needed */
-    fd_block_map_t lrw_block_map_out;
-    fd_block_t     lrw_block_out;
-    ulong lrw_slot = fd_blockstore_archiver_lrw_slot( blockstore, fd, &lrw_block_map_out, &lrw_block_out );
-    fd_block_idx_t * lrw_block_index  = fd_block_idx_query(block_idx, lrw_slot, NULL);
-    fd_block_idx_remove( block_idx, lrw_block_index );
-
-    archvr->head = wrap_offset(archvr, archvr->head + lrw_block_out.data_sz + sizeof(fd_block_map_t) + sizeof(fd_block_t));
-    archvr->num_blocks--;
+    archive_evict_lrw( blockstore, fd );
   }
 
   fd_block_idx_t * idx_entry = fd_block_idx_insert( fd_blockstore_block_idx( blockstore ), slot );
@@ -820,88 +1114,342 @@ static void fd_blockstore_post_checkpt_update( fd_blockstore_t * blockstore,
   idx_entry->bank_hash       = ser->block_map->bank_hash;
 
   archvr->num_blocks++;
+  archvr->rec_cnt++;
   archvr->tail = wrap_offset( archvr, write_off + wsz);;
   blockstore->mrw_slot = slot;
+  blockstore->archive_idx_dirty++;
 }
 
-ulong
-fd_blockstore_block_checkpt( fd_blockstore_t * blockstore,
-                             fd_blockstore_ser_t * ser,
-                             int fd,
-                             ulong slot ) {
+/* archive_compress zstd compresses data_sz bytes of block data into
+   the codec buffer.  Returns the compressed size on success.  Returns 0
+   if codec is NULL or cannot compress (e.g. the target does not support
+   zstd) or if compression does not shrink the data, in which case the
+   data should be stored raw. */
+
+static ulong
+archive_compress( fd_blockstore_codec_t * codec,
+                  uchar const *           data,
+                  ulong                   data_sz ) {
+#if FD_HAS_ZSTD
+  if( FD_UNLIKELY( !codec || !codec->cstream || data_sz<2UL ) ) return 0UL;
+  ulong dst_max = fd_ulong_min( data_sz - 1UL, FD_BLOCKSTORE_CODEC_ZDATA_MAX );
+  return fd_zstd_cstream_compress( codec->cstream, codec->zdata, dst_max, data, data_sz, NULL );
+#else
+  (void)codec; (void)data; (void)data_sz;
+  return 0UL;
+#endif
+}
+
+/* archive_decompress decompresses the zstd frame of src_sz bytes at
+   read_off in the archival file into exactly dst_sz bytes at dst.  The
+   frame is read in chunks into the codec read buffer.  Returns 0 on
+   success and non-zero on failure. */
+
+static int
+archive_decompress( fd_blockstore_archiver_t * archvr,
+                    int                        fd,
+                    fd_blockstore_codec_t *    codec,
+                    ulong                      read_off,
+                    ulong                      src_sz,
+                    uchar *                    dst,
+                    ulong                      dst_sz ) {
+#if FD_HAS_ZSTD
+  if( FD_UNLIKELY( !codec || !codec->dstream ) ) {
+    FD_LOG_WARNING(( "[%s] archived block is zstd compressed but no codec was provided", __func__ ));
+    return -1;
+  }
+
+  fd_zstd_dstream_reset( codec->dstream );
+  uchar *       out_cur = dst;
+  uchar * const out_end = dst + dst_sz;
+  int           rc      = 0;
+  while( src_sz && !rc ) {
+    ulong chunk_sz = fd_ulong_min( src_sz, FD_BLOCKSTORE_CODEC_CHUNK_SZ );
+    ulong rsz;
+    if( FD_UNLIKELY( read_with_wraparound( archvr, fd, codec->chunk, chunk_sz, &rsz, &read_off ) ) ) return -1;
+    src_sz -= chunk_sz;
+
+    uchar const *       in_cur = codec->chunk;
+    uchar const * const in_end = codec->chunk + chunk_sz;
+    while( in_cur < in_end ) {
+      uchar const * in_prev  = in_cur;
+      uchar *       out_prev = out_cur;
+      rc = fd_zstd_dstream_read( codec->dstream, &in_cur, in_end, &out_cur, out_end, NULL );
+      if( FD_UNLIKELY( rc > 0 ) ) return -1;
+      if( rc == -1 ) break;
+      if( FD_UNLIKELY( in_cur == in_prev && out_cur == out_prev ) ) return -1; /* frame larger than dst */
+    }
+    if( FD_UNLIKELY( rc == -1 && ( in_cur != in_end || src_sz ) ) ) return -1; /* trailing data */
+  }
+  return rc != -1 || out_cur != out_end;
+#else
+  (void)archvr; (void)fd; (void)codec; (void)read_off; (void)src_sz; (void)dst; (void)dst_sz;
+  FD_LOG_WARNING(( "[%s] archived block is zstd compressed but zstd is not supported", __func__ ));
+  return -1;
+#endif
+}
+
+/* archive_write writes a record for the block described by ser, whose
+   data is stored as the data_sz bytes at data encoded with codec. */
+
+static ulong
+archive_write( fd_blockstore_t *     blockstore,
+               fd_blockstore_ser_t * ser,
+               int                   fd,
+               ulong                 slot,
+               ulong                 codec,
+               uchar const *         data,
+               ulong                 data_sz ) {
   ulong write_off = blockstore->archiver.tail;
   ulong og_write_off = write_off;
-  if ( FD_UNLIKELY( fd == -1 ) ) {
-    FD_LOG_DEBUG(( "[%s] fd is -1", __func__ ));
-    return 0;
-  }
   if ( FD_UNLIKELY( lseek( fd, (long)write_off, SEEK_SET ) == -1 ) ) {
     FD_LOG_ERR(( "[%s] failed to seek to offset %lu", __func__, write_off ));
   }
 
-  ulong total_wsz = sizeof(fd_block_map_t) + sizeof(fd_block_t) + ser->block->data_sz;
+  fd_blockstore_archive_rec_t rec = {
+    .magic     = FD_BLOCKSTORE_ARCHIVE_REC_MAGIC,
+    .slot      = slot,
+    .codec     = codec,
+    .data_sz   = data_sz,
+    .raw_sz    = ser->block->data_sz,
+    .data_hash = fd_hash( 0UL, ser->data, ser->block->data_sz )
+  };
+  ulong total_wsz = archive_rec_footprint( &rec );
 
   /* clear any potential overwrites */
   fd_blockstore_lrw_archive_clear( blockstore, fd, total_wsz, write_off );
 
   start_archive_write( &blockstore->archiver, fd );
 
-  write_off = write_with_wraparound( &blockstore->archiver, fd, (uchar*)ser->block_map, sizeof(fd_block_map_t), write_off );
-  write_off = write_with_wraparound( &blockstore->archiver, fd, (uchar*)ser->block, sizeof(fd_block_t), write_off );
-  write_off = write_with_wraparound( &blockstore->archiver, fd, ser->data, ser->block->data_sz, write_off );
+  write_off = write_with_wraparound( &blockstore->archiver, fd, (uchar const *)&rec, sizeof(fd_blockstore_archive_rec_t), write_off );
+  write_off = write_with_wraparound( &blockstore->archiver, fd, (uchar const *)ser->block_map, sizeof(fd_block_map_t), write_off );
+  write_off = write_with_wraparound( &blockstore->archiver, fd, (uchar const *)ser->block, sizeof(fd_block_t), write_off );
+  write_off = write_with_wraparound( &blockstore->archiver, fd, data, data_sz, write_off );
 
   fd_blockstore_post_checkpt_update( blockstore, ser, fd, slot, total_wsz, og_write_off );
 
-  end_archive_write( &blockstore->archiver, fd );
+  /* Persisting the index also writes out the updated metadata */
 
-  FD_LOG_NOTICE(( "[%s] archived block %lu at %lu: size %lu", __func__, slot, og_write_off, total_wsz ));
+  if( FD_UNLIKELY( blockstore->archive_idx_dirty >= FD_BLOCKSTORE_ARCHIVE_IDX_INTERVAL ) ) {
+    fd_blockstore_archive_idx_checkpt( blockstore, fd );
+  } else {
+    end_archive_write( &blockstore->archiver, fd );
+  }
+
+  FD_LOG_NOTICE(( "[%s] archived block %lu at %lu: size %lu (data %lu => %lu)", __func__, slot, og_write_off, total_wsz, ser->block->data_sz, data_sz ));
   return total_wsz;
 }
 
+ulong
+fd_blockstore_block_checkpt( fd_blockstore_t * blockstore,
+                             fd_blockstore_ser_t * ser,
+                             int fd,
+                             fd_blockstore_codec_t * codec,
+                             ulong slot ) {
+  if ( FD_UNLIKELY( fd == -1 ) ) {
+    FD_LOG_DEBUG(( "[%s] fd is -1", __func__ ));
+    return 0;
+  }
+
+  ulong zdata_sz = archive_compress( codec, ser->data, ser->block->data_sz );
+  return archive_write( blockstore, ser, fd, slot,
+                        zdata_sz ? FD_BLOCKSTORE_ARCHIVE_CODEC_ZSTD : FD_BLOCKSTORE_ARCHIVE_CODEC_RAW,
+                        zdata_sz ? codec->zdata : ser->data,
+                        zdata_sz ? zdata_sz     : ser->block->data_sz );
+}
+
+void
+fd_blockstore_archive_idx_checkpt( fd_blockstore_t * blockstore, int fd ) {
+  if ( FD_UNLIKELY( fd == -1 ) ) {
+    return;
+  }
+
+  fd_blockstore_archiver_t * archvr    = &blockstore->archiver;
+  fd_block_idx_t *           block_idx = fd_blockstore_block_idx( blockstore );
+
+  if ( FD_UNLIKELY( lseek( fd, (long)archvr->idx_off, SEEK_SET ) == -1 ) ) {
+    FD_LOG_ERR(( "[%s] failed to seek to offset %lu", __func__, archvr->idx_off ));
+  }
+
+  fd_blockstore_archive_idx_entry_t batch[ ARCHIVE_IDX_BATCH_MAX ];
+  ulong batch_cnt = 0UL;
+  ulong idx_cnt   = 0UL;
+  ulong hash      = 0UL;
+  ulong slot_cnt  = fd_block_idx_slot_cnt( block_idx );
+  for( ulong i = 0; i < slot_cnt; i++ ) {
+    fd_block_idx_t const * idx_entry = &block_idx[i];
+    if( !fd_block_idx_key_inval( idx_entry->slot ) ) {
+      batch[ batch_cnt++ ] = (fd_blockstore_archive_idx_entry_t){
+        .slot       = idx_entry->slot,
+        .off        = idx_entry->off,
+        .block_hash = idx_entry->block_hash,
+        .bank_hash  = idx_entry->bank_hash
+      };
+    }
+    if( batch_cnt == ARCHIVE_IDX_BATCH_MAX || ( batch_cnt && i == slot_cnt - 1UL ) ) {
+      ulong batch_sz = batch_cnt * sizeof(fd_blockstore_archive_idx_entry_t);
+      ulong wsz;
+      int err = fd_io_write( fd, batch, batch_sz, batch_sz, &wsz );
+      check_read_write_err( err );
+      hash       = fd_hash( hash, batch, batch_sz );
+      idx_cnt   += batch_cnt;
+      batch_cnt  = 0UL;
+    }
+  }
+
+  /* The index is only used once the metadata referencing it has been
+     written, so a crash mid-write leaves a stale index that fails its
+     checksum (and the archive is read back in full instead). */
+
+  archvr->idx_cnt      = idx_cnt;
+  archvr->idx_rec_cnt  = archvr->rec_cnt;
+  archvr->idx_tail     = archvr->tail;
+  archvr->idx_mrw_slot = blockstore->mrw_slot;
+  archvr->idx_hash     = hash;
+  blockstore->archive_idx_dirty = 0UL;
+
+  end_archive_write( archvr, fd );
+}
+
+/* archive_q_pop writes out the oldest queued block, with data zdata of
+   zdata_sz bytes if compressed (NULL if not), and removes it from the
+   queue. */
+
+static void
+archive_q_pop( fd_blockstore_t * blockstore,
+               int               fd,
+               uchar const *     zdata,
+               ulong             zdata_sz ) {
+  fd_blockstore_archive_pending_t * pending = fd_wksp_laddr_fast( fd_blockstore_wksp( blockstore ),
+                                                                  blockstore->archive_q[ blockstore->archive_q_head ] );
+  fd_blockstore_ser_t ser = {
+    .block_map = &pending->block_map,
+    .block     = &pending->block,
+    .data      = (uchar *)( pending + 1 )
+  };
+  archive_write( blockstore, &ser, fd, pending->block_map.slot,
+                 zdata ? FD_BLOCKSTORE_ARCHIVE_CODEC_ZSTD : FD_BLOCKSTORE_ARCHIVE_CODEC_RAW,
+                 zdata ? zdata : ser.data,
+                 zdata ? zdata_sz : pending->block.data_sz );
+
+  blockstore->archive_q[ blockstore->archive_q_head ] = 0UL;
+  blockstore->archive_q_head = ( blockstore->archive_q_head + 1UL ) % FD_BLOCKSTORE_ARCHIVE_QUEUE_MAX;
+  FD_COMPILER_MFENCE();
+  blockstore->archive_q_cnt--;
+  fd_alloc_free( fd_blockstore_alloc( blockstore ), pending );
+}
+
+int
+fd_blockstore_archive_enqueue( fd_blockstore_t *     blockstore,
+                               fd_blockstore_ser_t * ser,
+                               int                   fd,
+                               ulong                 slot ) {
+  if ( FD_UNLIKELY( fd == -1 ) ) {
+    return FD_BLOCKSTORE_OK;
+  }
+
+  /* The flusher may be compressing the oldest queued block, so it is
+     never removed here.  Instead, the block skips the queue. */
+
+  if( FD_UNLIKELY( blockstore->archive_q_cnt == FD_BLOCKSTORE_ARCHIVE_QUEUE_MAX ) ) {
+    FD_LOG_DEBUG(( "[%s] archive queue full, dropping slot %lu", __func__, slot ));
+    blockstore->archive_drop_cnt++;
+    return FD_BLOCKSTORE_ERR_QUEUE_FULL;
+  }
+
+  ulong data_sz = ser->block->data_sz;
+  fd_blockstore_archive_pending_t * pending = fd_alloc_malloc( fd_blockstore_alloc( blockstore ),
+                                                               alignof(fd_blockstore_archive_pending_t),
+                                                               sizeof(fd_blockstore_archive_pending_t) + data_sz );
+  if( FD_UNLIKELY( !pending ) ) {
+    FD_LOG_WARNING(( "[%s] failed to allocate archive queue entry, dropping slot %lu", __func__, slot ));
+    blockstore->archive_drop_cnt++;
+    return FD_BLOCKSTORE_ERR_NO_MEM;
+  }
+  pending->block_map = *ser->block_map;
+  pending->block     = *ser->block;
+  fd_memcpy( pending + 1, ser->data, data_sz );
+
+  /* The entry is complete before it is counted, as the flusher reads
+     the queue without holding the lock. */
+
+  ulong q_idx = ( blockstore->archive_q_head + blockstore->archive_q_cnt ) % FD_BLOCKSTORE_ARCHIVE_QUEUE_MAX;
+  blockstore->archive_q[ q_idx ] = fd_wksp_gaddr_fast( fd_blockstore_wksp( blockstore ), pending );
+  FD_COMPILER_MFENCE();
+  blockstore->archive_q_cnt++;
+  return FD_BLOCKSTORE_OK;
+}
+
+ulong
+fd_blockstore_archive_flush( fd_blockstore_t *       blockstore,
+                             int                     fd,
+                             fd_blockstore_codec_t * codec,
+                             ulong                   max_cnt ) {
+  ulong cnt = 0UL;
+  while( cnt < max_cnt && FD_VOLATILE_CONST( blockstore->archive_q_cnt ) ) {
+    FD_COMPILER_MFENCE();
+
+    /* Only the flusher (the caller) removes queued blocks, so the oldest
+       entry can be compressed without holding the lock. */
+
+    ulong gaddr = FD_VOLATILE_CONST( blockstore->archive_q[ FD_VOLATILE_CONST( blockstore->archive_q_head ) ] );
+    fd_blockstore_archive_pending_t const * pending = fd_wksp_laddr_fast( fd_blockstore_wksp( blockstore ), gaddr );
+    ulong zdata_sz = archive_compress( codec, (uchar const *)( pending + 1 ), pending->block.data_sz );
+
+    fd_blockstore_start_write( blockstore );
+    archive_q_pop( blockstore, fd, zdata_sz ? codec->zdata : NULL, zdata_sz );
+    fd_blockstore_end_write( blockstore );
+
+    cnt++;
+  }
+  return cnt;
+}
+
 int
 fd_blockstore_block_meta_restore( fd_blockstore_archiver_t * archvr,
                                   int fd,
                                   fd_block_idx_t * block_idx_entry,
                                   fd_block_map_t * block_map_entry_out,
                                   fd_block_t * block_out ) {
-  ulong rsz;
-  ulong read_off = block_idx_entry->off;
-  int err = read_with_wraparound( archvr,
-                                  fd,
-                                  (uchar *)fd_type_pun(block_map_entry_out),
-                                  sizeof(fd_block_map_t),
-                                  &rsz,
-                                  &read_off );
-  check_read_err_safe( err, "failed to read block map" );
-  err = read_with_wraparound( archvr,
-                              fd,
-                              (uchar *)fd_type_pun(block_out),
-                              sizeof(fd_block_t),
-                              &rsz,
-                              &read_off );
-  check_read_err_safe( err, "failed to read block" );
-  return FD_BLOCKSTORE_OK;
+  fd_blockstore_archive_rec_t rec;
+  return archive_rec_read( archvr, fd, block_idx_entry->off, &rec, block_map_entry_out, block_out );
 }
 
 int
-fd_blockstore_block_data_restore( fd_blockstore_archiver_t * archvr,
+fd_blockstore_block_data_restore( fd_blockstore_t * blockstore,
                                   int fd,
+                                  fd_blockstore_codec_t * codec,
                                   fd_block_idx_t * block_idx_entry,
                                   uchar * buf_out,
                                   ulong buf_max,
                                   ulong data_sz ) {
-  ulong data_off = wrap_offset(archvr, block_idx_entry->off + sizeof(fd_block_map_t) + sizeof(fd_block_t));
+  fd_blockstore_archiver_t * archvr = &blockstore->archiver;
   if( FD_UNLIKELY( buf_max < data_sz ) ) {
     FD_LOG_ERR(( "[%s] data_out_sz %lu < data_sz %lu", __func__, buf_max, data_sz ));
     return -1;
   }
-  if( FD_UNLIKELY( lseek( fd, (long)data_off, SEEK_SET ) == -1 ) ) {
-    FD_LOG_WARNING(( "failed to seek" ));
-    return FD_BLOCKSTORE_ERR_SLOT_MISSING;
-  }
+
+  fd_blockstore_archive_rec_t rec;
   ulong rsz;
-  int err = read_with_wraparound( archvr, fd, buf_out, data_sz, &rsz, &data_off );
-  check_read_err_safe( err, "failed to read block data" );
+  ulong data_off = block_idx_entry->off;
+  int err = read_with_wraparound( archvr, fd, (uchar *)fd_type_pun( &rec ), sizeof(fd_blockstore_archive_rec_t), &rsz, &data_off );
+  check_read_err_safe( err, "failed to read record header" );
+  check_read_err_safe( rec.magic != FD_BLOCKSTORE_ARCHIVE_REC_MAGIC || rec.raw_sz != data_sz, "bad record header" );
+  data_off = wrap_offset( archvr, data_off + sizeof(fd_block_map_t) + sizeof(fd_block_t) );
+
+  if( FD_LIKELY( rec.codec == FD_BLOCKSTORE_ARCHIVE_CODEC_RAW ) ) {
+    check_read_err_safe( rec.data_sz != data_sz, "bad record data size" );
+    err = read_with_wraparound( archvr, fd, buf_out, data_sz, &rsz, &data_off );
+    check_read_err_safe( err, "failed to read block data" );
+  } else if( rec.codec == FD_BLOCKSTORE_ARCHIVE_CODEC_ZSTD ) {
+    check_read_err_safe( rec.data_sz >= data_sz, "bad record data size" );
+    err = archive_decompress( archvr, fd, codec, data_off, rec.data_sz, buf_out, data_sz );
+    check_read_err_safe( err, "failed to read or decompress block data" );
+  } else {
+    check_read_err_safe( 1, "unknown record codec" );
+  }
+
+  check_read_err_safe( fd_hash( 0UL, buf_out, data_sz ) != rec.data_hash, "block data checksum mismatch" );
   return FD_BLOCKSTORE_OK;
 }
 
@@ -962,7 +1510,7 @@ fd_blockstore_publish( fd_blockstore_t * blockstore, int fd, ulong wmk ) {
           .block     = block,
           .data      = data
         };
-        fd_blockstore_block_checkpt( blockstore, &ser, fd, slot );
+        fd_blockstore_archive_enqueue( blockstore, &ser, fd, slot );
       }
     }
 
@@ -1509,16 +2057,91 @@ fd_blockstore_shreds_complete( fd_blockstore_t * blockstore, ulong slot ){
 }
 
 
+/* archive_q_query_volatile is fd_blockstore_block_data_query_volatile
+   for blocks in the archive queue.  Returns
+   FD_BLOCKSTORE_ERR_SLOT_MISSING if slot is not queued.  Queue entries
+   are only written and freed under the write lock, so a gaddr read from
+   the queue always points into the wksp (though possibly to a freed
+   entry, which the seqlock check then catches). */
+
+static int
+archive_q_query_volatile( fd_blockstore_t *    blockstore,
+                          ulong                slot,
+                          fd_valloc_t          alloc,
+                          fd_hash_t *          parent_block_hash_out,
+                          fd_block_map_t *     block_map_entry_out,
+                          fd_block_rewards_t * block_rewards_out,
+                          uchar **             block_data_out,
+                          ulong *              block_data_sz_out ) {
+  fd_wksp_t *      wksp      = fd_blockstore_wksp( blockstore );
+  fd_block_idx_t * block_idx = fd_blockstore_block_idx( blockstore );
+  for(;;) {
+    uint seqnum;
+    if( FD_UNLIKELY( fd_rwseq_start_concur_read( &blockstore->lock, &seqnum ) ) ) continue;
+
+    ulong q_head = FD_VOLATILE_CONST( blockstore->archive_q_head );
+    ulong q_cnt  = fd_ulong_min( FD_VOLATILE_CONST( blockstore->archive_q_cnt ), FD_BLOCKSTORE_ARCHIVE_QUEUE_MAX );
+    fd_blockstore_archive_pending_t const * pending = NULL;
+    fd_blockstore_archive_pending_t const * parent  = NULL;
+    for( ulong i = 0; i < q_cnt; i++ ) {
+      ulong gaddr = FD_VOLATILE_CONST( blockstore->archive_q[ ( q_head + i ) % FD_BLOCKSTORE_ARCHIVE_QUEUE_MAX ] );
+      if( FD_UNLIKELY( !gaddr ) ) continue;
+      fd_blockstore_archive_pending_t const * ele = fd_wksp_laddr_fast( wksp, gaddr );
+      if( ele->block_map.slot == slot ) pending = ele;
+    }
+    if( FD_LIKELY( !pending ) ) {
+      if( FD_UNLIKELY( fd_rwseq_check_concur_read( &blockstore->lock, seqnum ) ) ) continue;
+      return FD_BLOCKSTORE_ERR_SLOT_MISSING;
+    }
+
+    memcpy( block_map_entry_out, &pending->block_map, sizeof(fd_block_map_t) );
+    if( block_rewards_out ) memcpy( block_rewards_out, &pending->block.rewards, sizeof(fd_block_rewards_t) );
+    ulong sz = pending->block.data_sz;
+    if( FD_UNLIKELY( fd_rwseq_check_concur_read( &blockstore->lock, seqnum ) ) ) continue;
+    if( FD_UNLIKELY( sz >= FD_SHRED_MAX_PER_SLOT * FD_SHRED_MAX_SZ ) ) continue;
+
+    uchar * data_out = fd_valloc_malloc( alloc, 128UL, fd_ulong_max( sz, 1UL ) );
+    if( FD_UNLIKELY( !data_out ) ) return FD_BLOCKSTORE_ERR_SLOT_MISSING;
+    memcpy( data_out, pending + 1, sz );
+
+    if( parent_block_hash_out ) {
+      memset( parent_block_hash_out, 0, sizeof(fd_hash_t) );
+      for( ulong i = 0; i < q_cnt; i++ ) {
+        ulong gaddr = FD_VOLATILE_CONST( blockstore->archive_q[ ( q_head + i ) % FD_BLOCKSTORE_ARCHIVE_QUEUE_MAX ] );
+        if( FD_UNLIKELY( !gaddr ) ) continue;
+        fd_blockstore_archive_pending_t const * ele = fd_wksp_laddr_fast( wksp, gaddr );
+        if( ele->block_map.slot == block_map_entry_out->parent_slot ) parent = ele;
+      }
+      if( parent ) {
+        *parent_block_hash_out = parent->block_map.block_hash;
+      } else {
+        fd_block_idx_t * parent_idx_entry = fd_block_idx_query( block_idx, block_map_entry_out->parent_slot, NULL );
+        if( parent_idx_entry ) *parent_block_hash_out = parent_idx_entry->block_hash;
+      }
+    }
+
+    if( FD_UNLIKELY( fd_rwseq_check_concur_read( &blockstore->lock, seqnum ) ) ) {
+      fd_valloc_free( alloc, data_out );
+      continue;
+    }
+
+    *block_data_out    = data_out;
+    *block_data_sz_out = sz;
+    return FD_BLOCKSTORE_OK;
+  }
+}
+
 int
-fd_blockstore_block_data_query_volatile( fd_blockstore_t *    blockstore,
-                                         int                  fd,
-                                         ulong                slot,
-                                         fd_valloc_t          alloc,
-                                         fd_hash_t *          parent_block_hash_out,
-                                         fd_block_map_t *     block_map_entry_out,
-                                         fd_block_rewards_t * block_rewards_out,
-                                         uchar **             block_data_out,
-                                         ulong *              block_data_sz_out ) {
+fd_blockstore_block_data_query_volatile( fd_blockstore_t *       blockstore,
+                                         int                     fd,
+                                         fd_blockstore_codec_t * codec,
+                                         ulong                   slot,
+                                         fd_valloc_t             alloc,
+                                         fd_hash_t *             parent_block_hash_out,
+                                         fd_block_map_t *        block_map_entry_out,
+                                         fd_block_rewards_t *    block_rewards_out,
+                                         uchar **                block_data_out,
+                                         ulong *                 block_data_sz_out ) {
 
   /* WARNING: this code is extremely delicate. Do NOT modify without
      understanding all the invariants. In particular, we must never
@@ -1548,14 +2171,19 @@ fd_blockstore_block_data_query_volatile( fd_blockstore_t *    blockstore,
     if( FD_UNLIKELY( err ) ) {
       return FD_BLOCKSTORE_ERR_SLOT_MISSING;
     }
-    uchar * block_data = fd_valloc_malloc( alloc, 128UL, block_out.data_sz );
-    err = fd_blockstore_block_data_restore( &blockstore->archiver,
+    uchar * block_data = fd_valloc_malloc( alloc, 128UL, fd_ulong_max( block_out.data_sz, 1UL ) );
+    if( FD_UNLIKELY( !block_data ) ) {
+      return FD_BLOCKSTORE_ERR_SLOT_MISSING;
+    }
+    err = fd_blockstore_block_data_restore( blockstore,
                                             fd,
+                                            codec,
                                             idx_entry,
                                             block_data,
                                             block_out.data_sz,
                                             block_out.data_sz);
     if( FD_UNLIKELY( err ) ) {
+      fd_valloc_free( alloc, block_data );
       return FD_BLOCKSTORE_ERR_SLOT_MISSING;
     }
     fd_block_idx_t * parent_idx_entry = fd_block_idx_query( block_idx, block_map_entry_out->parent_slot, NULL );
@@ -1570,6 +2198,13 @@ fd_blockstore_block_data_query_volatile( fd_blockstore_t *    blockstore,
     return FD_BLOCKSTORE_OK;
   }
 
+  /* Blocks that were published but not yet written to the archive are
+     in the archive queue. */
+
+  int err = archive_q_query_volatile( blockstore, slot, alloc, parent_block_hash_out, block_map_entry_out,
+                                      block_rewards_out, block_data_out, block_data_sz_out );
+  if( FD_UNLIKELY( err != FD_BLOCKSTORE_ERR_SLOT_MISSING ) ) return err;
+
   fd_block_map_t const * block_map = fd_blockstore_block_map( blockstore );
   uchar * prev_data_out = NULL;
   ulong prev_sz = 0;
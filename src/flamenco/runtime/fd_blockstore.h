@@ -40,6 +40,21 @@
 #define FD_BLOCKSTORE_CHILD_SLOT_MAX    (32UL)        /* the maximum # of children a slot can have */
 #define FD_BLOCKSTORE_ARCHIVE_MIN_SIZE  (1UL << 26UL) /* 64MB := ceil(MAX_DATA_SHREDS_PER_SLOT*1228) */
 
+/* Archival file format.  The archive magic is distinct from the
+   blockstore magic such that archives written in a previous format
+   (uncompressed and unindexed, or with the index persisted past the
+   end of the file size limit) are detected, and refused, on init. */
+
+#define FD_BLOCKSTORE_ARCHIVE_MAGIC     (0xf17eda2ce7b1ac02UL) /* firedancer bl archive version 2 */
+#define FD_BLOCKSTORE_ARCHIVE_REC_MAGIC (0xf17eda2ce7b1ec01UL) /* firedancer bl record version 1 */
+
+#define FD_BLOCKSTORE_ARCHIVE_CODEC_RAW  (0UL) /* block data stored as is */
+#define FD_BLOCKSTORE_ARCHIVE_CODEC_ZSTD (1UL) /* block data stored as a single zstd frame */
+
+#define FD_BLOCKSTORE_ARCHIVE_ZSTD_LEVEL   (1)    /* favor compression speed */
+#define FD_BLOCKSTORE_ARCHIVE_QUEUE_MAX    (64UL) /* max # of finalized blocks waiting to be archived */
+#define FD_BLOCKSTORE_ARCHIVE_IDX_INTERVAL (64UL) /* the index is persisted every this many archived blocks */
+
 /* Maximum size of an entry batch is the entire block */
 #define FD_MBATCH_MAX (FD_SHRED_DATA_PAYLOAD_MAX_PER_SLOT)
 /* 64 ticks per slot, and then one min size transaction per microblock
@@ -72,6 +87,7 @@
 #define FD_BLOCKSTORE_ERR_SHRED_INVALID   -7 /* shred was invalid */
 #define FD_BLOCKSTORE_ERR_DESHRED_INVALID -8 /* deshredded block was invalid */
 #define FD_BLOCKSTORE_ERR_NO_MEM          -9 /* no mem */
+#define FD_BLOCKSTORE_ERR_QUEUE_FULL      -10 /* archive queue full */
 #define FD_BLOCKSTORE_ERR_UNKNOWN         -99
 /* clang-format on */
 
@@ -359,18 +375,71 @@ ulong fd_txn_key_hash(fd_txn_key_t const * k, ulong seed);
 
 /* fd_blockstore_archiver outlines the format of metadata
    at the start of an archive file - needed so that archive
-   files can be read back on initialization. */
+   files can be read back on initialization.
+
+   Records are written in a ring in [FD_BLOCKSTORE_ARCHIVE_START,
+   idx_off).  The block index is periodically persisted in the region
+   reserved for it at the end of the file, [idx_off,fd_size_max), such
+   that initialization only needs to load the index and scan the
+   records archived since (idx_tail to tail), instead of reading back
+   every record in the file.  The archival file never grows past
+   fd_size_max.  idx_cnt is 0 if no index was persisted. */
 
 struct fd_blockstore_archiver {
   ulong magic;
   ulong fd_size_max;      /* maximum size of the archival file */
+  ulong idx_off;          /* end of the record ring and start of the persisted index */
   ulong num_blocks;       /* number of blocks in the archival file. needed for reading back */
   ulong head;             /* location of least recently written block */
   ulong tail;             /* location after most recently written block */
+  ulong rec_cnt;          /* number of blocks ever written to the archival file */
+  ulong idx_cnt;          /* number of entries in the persisted index */
+  ulong idx_rec_cnt;      /* rec_cnt when the index was persisted */
+  ulong idx_tail;         /* tail when the index was persisted */
+  ulong idx_mrw_slot;     /* most recently written slot when the index was persisted */
+  ulong idx_hash;         /* fd_hash of the persisted index entries */
 };
 typedef struct fd_blockstore_archiver fd_blockstore_archiver_t;
 #define FD_BLOCKSTORE_ARCHIVE_START sizeof(fd_blockstore_archiver_t)
 
+/* fd_blockstore_archive_rec is the header of an archived block record.
+   It is followed by the fd_block_map_t and fd_block_t of the block and
+   data_sz bytes of (possibly compressed) block data.  data_hash covers
+   the uncompressed block data and is checked on restore. */
+
+struct fd_blockstore_archive_rec {
+  ulong magic;     /* ==FD_BLOCKSTORE_ARCHIVE_REC_MAGIC */
+  ulong slot;
+  ulong codec;     /* FD_BLOCKSTORE_ARCHIVE_CODEC_{RAW,ZSTD} */
+  ulong data_sz;   /* stored block data size */
+  ulong raw_sz;    /* uncompressed block data size */
+  ulong data_hash; /* fd_hash( 0, data, raw_sz ) */
+};
+typedef struct fd_blockstore_archive_rec fd_blockstore_archive_rec_t;
+
+/* fd_blockstore_archive_idx_entry is the on-disk format of a persisted
+   fd_block_idx_t entry. */
+
+struct fd_blockstore_archive_idx_entry {
+  ulong     slot;
+  ulong     off;
+  fd_hash_t block_hash;
+  fd_hash_t bank_hash;
+};
+typedef struct fd_blockstore_archive_idx_entry fd_blockstore_archive_idx_entry_t;
+
+/* fd_blockstore_archive_pending is a finalized block that has been
+   published but not yet written to the archival file.  It is a copy of
+   the block (the original is freed on publish) allocated from the
+   blockstore alloc, followed by block.data_sz bytes of block data. */
+
+struct fd_blockstore_archive_pending {
+  fd_block_map_t block_map;
+  fd_block_t     block;
+  /* block.data_sz bytes of block data follow */
+};
+typedef struct fd_blockstore_archive_pending fd_blockstore_archive_pending_t;
+
 struct __attribute__((aligned(FD_BLOCKSTORE_ALIGN))) fd_blockstore {
 /* clang-format on */
 
@@ -390,6 +459,21 @@ struct __attribute__((aligned(FD_BLOCKSTORE_ALIGN))) fd_blockstore {
   fd_blockstore_archiver_t archiver;
   ulong mrw_slot; /* most recently written slot */
 
+  /* Blocks are archived asynchronously: publish queues finalized
+     blocks and fd_blockstore_archive_flush (called from a different
+     thread or tile than the publisher) compresses and writes them out.
+     archive_q is a ring of gaddrs of fd_blockstore_archive_pending
+     (oldest at archive_q_head).  The queue is only modified while
+     holding the write lock.  The publisher only appends to the queue
+     and the flusher only removes its oldest entry, such that the
+     flusher can read the oldest entry without holding the lock. */
+
+  ulong archive_q[ FD_BLOCKSTORE_ARCHIVE_QUEUE_MAX ];
+  ulong archive_q_head;
+  ulong archive_q_cnt;
+  ulong archive_idx_dirty; /* # of blocks archived since the index was last persisted */
+  ulong archive_drop_cnt;  /* # of finalized blocks dropped instead of archived */
+
   /* Slot metadata */
 
   ulong lps; /* latest processed slot */
@@ -417,6 +501,33 @@ struct __attribute__((aligned(FD_BLOCKSTORE_ALIGN))) fd_blockstore {
 };
 typedef struct fd_blockstore fd_blockstore_t;
 
+/* fd_blockstore_codec is the local state used to compress and
+   decompress archived block data: zstd contexts, a buffer for the
+   compressed data of a block and a read buffer.  Unlike the blockstore
+   it is not shared (zstd contexts can not be shared across address
+   spaces), each thread that archives or restores blocks owns one and
+   reuses it for every block.  A codec that was created without
+   compress only decompresses and has a much smaller footprint.
+   cstream and dstream are NULL if the target does not support zstd,
+   in which case blocks are archived uncompressed. */
+
+#define FD_BLOCKSTORE_CODEC_ALIGN     (128UL)
+#define FD_BLOCKSTORE_CODEC_MAGIC     (0xf17eda2ce7b1cd01UL) /* firedancer bl codec version 1 */
+#define FD_BLOCKSTORE_CODEC_ZDATA_MAX (FD_SHRED_DATA_PAYLOAD_MAX_PER_SLOT) /* max compressed block data size */
+#define FD_BLOCKSTORE_CODEC_CHUNK_SZ  (1UL << 16UL) /* compressed block data is read back in chunks of this size */
+
+struct fd_zstd_cstream;
+struct fd_zstd_dstream;
+
+struct __attribute__((aligned(FD_BLOCKSTORE_CODEC_ALIGN))) fd_blockstore_codec {
+  ulong                    magic;
+  struct fd_zstd_cstream * cstream; /* NULL if !compress */
+  struct fd_zstd_dstream * dstream;
+  uchar *                  zdata;   /* FD_BLOCKSTORE_CODEC_ZDATA_MAX bytes, NULL if !compress */
+  uchar *                  chunk;   /* FD_BLOCKSTORE_CODEC_CHUNK_SZ bytes */
+};
+typedef struct fd_blockstore_codec fd_blockstore_codec_t;
+
 FD_PROTOTYPES_BEGIN
 
 /* Construction API */
@@ -470,6 +581,30 @@ fd_blockstore_leave( fd_blockstore_t * blockstore );
 void *
 fd_blockstore_delete( void * shblockstore );
 
+/* fd_blockstore_codec_{align,footprint} return the alignment and
+   footprint of the memory region backing a codec.  compress is
+   non-zero if the codec is used to archive blocks (as opposed to only
+   restoring them). */
+
+FD_FN_CONST ulong
+fd_blockstore_codec_align( void );
+
+ulong
+fd_blockstore_codec_footprint( int compress );
+
+/* fd_blockstore_codec_new formats the memory region at mem (with the
+   above alignment and footprint for compress) as a codec and returns a
+   handle to it.  Returns NULL on failure (logs details). */
+
+fd_blockstore_codec_t *
+fd_blockstore_codec_new( void * mem, int compress );
+
+/* fd_blockstore_codec_delete unformats a codec and returns the memory
+   region backing it.  Returns NULL if codec is NULL. */
+
+void *
+fd_blockstore_codec_delete( fd_blockstore_codec_t * codec );
+
 /* fd_blockstore_init initializes a blockstore with the given
    `slot_bank`.  This bank is used for initializing fields (SMR, etc.),
    and should be the bank upon finishing a snapshot load if booting from
@@ -481,11 +616,25 @@ fd_blockstore_delete( void * shblockstore );
 
    `fd` is a file descriptor for the blockstore archival file.  As part
    of `init`, blockstore rebuilds an in-memory index of the archival
-   file.  */
+   file, from the persisted index if there is a valid one (only the
+   blocks archived after it was persisted are read back) and otherwise
+   by reading back every block in the file.  The archival file never
+   grows past fd_size_max bytes, which must be at least
+   FD_BLOCKSTORE_ARCHIVE_MIN_SIZE bytes more than
+   fd_blockstore_archive_idx_footprint.  An existing file keeps its
+   index region if this blockstore's index fits in it (e.g. idx_max was
+   lowered) and is discarded if fd_size_max differs or it does not. */
 
 fd_blockstore_t *
 fd_blockstore_init( fd_blockstore_t * blockstore, int fd, ulong fd_size_max, fd_slot_bank_t const * slot_bank );
 
+/* fd_blockstore_archive_idx_footprint returns the size of the region at
+   the end of the archival file that is reserved for the persisted block
+   index.  It depends on the blockstore idx_max. */
+
+FD_FN_PURE ulong
+fd_blockstore_archive_idx_footprint( fd_blockstore_t * blockstore );
+
 /* fd_blockstore_fini finalizes a blockstore.
 
    IMPORTANT!  Caller MUST hold the read lock when calling this
@@ -703,20 +852,23 @@ fd_blockstore_block_frontier_query( fd_blockstore_t * blockstore,
    alloc, copies the block data into it, and sets the block_data_out
    pointer.  Caller provides the allocator via alloc for the copied
    block data (an allocator is needed because the block data sz is not
-   known apriori).  Returns FD_BLOCKSTORE_SLOT_MISSING if slot is
-   missing: caller MUST ignore out pointers in this case. Otherwise this
-   call cannot fail and returns FD_BLOCKSTORE_OK. */
+   known apriori).  codec is used to decompress the data of archived
+   blocks (see fd_blockstore_block_data_restore).  Returns
+   FD_BLOCKSTORE_SLOT_MISSING if slot is missing: caller MUST ignore out
+   pointers in this case. Otherwise this call cannot fail and returns
+   FD_BLOCKSTORE_OK. */
 
 int
-fd_blockstore_block_data_query_volatile( fd_blockstore_t *    blockstore,
-                                         int                  fd,
-                                         ulong                slot,
-                                         fd_valloc_t          alloc,
-                                         fd_hash_t *          parent_block_hash_out,
-                                         fd_block_map_t *     block_map_entry_out,
-                                         fd_block_rewards_t * block_rewards_out,
-                                         uchar **             block_data_out,
-                                         ulong *              block_data_sz_out );
+fd_blockstore_block_data_query_volatile( fd_blockstore_t *       blockstore,
+                                         int                     fd,
+                                         fd_blockstore_codec_t * codec,
+                                         ulong                   slot,
+                                         fd_valloc_t             alloc,
+                                         fd_hash_t *             parent_block_hash_out,
+                                         fd_block_map_t *        block_map_entry_out,
+                                         fd_block_rewards_t *    block_rewards_out,
+                                         uchar **                block_data_out,
+                                         ulong *                 block_data_sz_out );
 
 /* fd_blockstore_block_map_query_volatile is the same as above except it
    only copies out the metadata (fd_block_map_t).  Returns
@@ -820,12 +972,49 @@ fd_blockstore_block_height_update( fd_blockstore_t * blockstore, ulong slot, ulo
    finalized slots which is why they are archived.  Blocks removed as a
    result of pruning are not finalized, and therefore not archived.
 
+   Archival is asynchronous: finalized blocks are copied into the
+   archive queue (fd_blockstore_archive_enqueue) and only written to
+   the archival file by a later fd_blockstore_archive_flush.  If the
+   queue is full, blocks are not archived (see archive_drop_cnt), such
+   that publishing never blocks on archival file I/O.
+
    IMPORTANT!  Caller MUST hold the write lock when calling this
    function. */
 
 void
 fd_blockstore_publish( fd_blockstore_t * blockstore, int fd, ulong wmk );
 
+/* fd_blockstore_archive_flush writes up to max_cnt queued blocks (oldest
+   first) to the archival file `fd`, persisting the block index every
+   FD_BLOCKSTORE_ARCHIVE_IDX_INTERVAL blocks.  Blocks are compressed
+   with codec (which must have been created with compress) into its
+   buffer.  Returns the number of blocks written.  Blocks are compressed
+   without holding the lock and the write lock is only acquired to
+   write each record and update the index, such that archiving does not
+   stall readers or the publisher for the duration of compression.
+   Meant to be called from a different thread or tile than the one that
+   publishes (`fd` may be a different file descriptor for the same
+   archival file).
+
+   IMPORTANT!  There MUST be at most one thread flushing a blockstore
+   and caller MUST NOT hold the lock when calling this function. */
+
+ulong
+fd_blockstore_archive_flush( fd_blockstore_t *       blockstore,
+                             int                     fd,
+                             fd_blockstore_codec_t * codec,
+                             ulong                   max_cnt );
+
+/* fd_blockstore_archive_idx_checkpt persists the in-memory block index
+   to the archival file `fd`, such that a subsequent init does not need
+   to read back the blocks currently indexed.
+
+   IMPORTANT!  Caller MUST hold the write lock when calling this
+   function. */
+
+void
+fd_blockstore_archive_idx_checkpt( fd_blockstore_t * blockstore, int fd );
+
 /* fd_blockstore_start_read acquires the read lock */
 static inline void
 fd_blockstore_start_read( fd_blockstore_t * blockstore ) {
@@ -872,14 +1061,36 @@ struct fd_blockstore_ser {
 typedef struct fd_blockstore_ser fd_blockstore_ser_t;
 
 /* Archives a block and block map entry to fd at blockstore->off, and does
-   any necessary bookkeeping.
+   any necessary bookkeeping.  The block data is zstd compressed with
+   codec into its buffer if codec is not NULL (and was created with
+   compress), the target supports zstd and compression shrinks it.
    If fd is -1, no write is attempted. Returns written size */
 ulong
 fd_blockstore_block_checkpt( fd_blockstore_t * blockstore, 
                              fd_blockstore_ser_t * ser, 
                              int fd, 
+                             fd_blockstore_codec_t * codec,
                              ulong slot );
 
+/* fd_blockstore_archive_enqueue copies the block described by ser into
+   the archive queue, to be written to the archival file by a later
+   fd_blockstore_archive_flush.  If the queue is full (the flusher is
+   behind) or the copy could not be allocated, the block is dropped
+   (not archived) and counted in blockstore->archive_drop_cnt, such
+   that the publisher neither waits for nor races with the flusher, nor
+   writes the archival file itself.  If fd is -1, nothing is queued.
+   Returns FD_BLOCKSTORE_OK on success, FD_BLOCKSTORE_ERR_QUEUE_FULL if
+   the queue is full or FD_BLOCKSTORE_ERR_NO_MEM if the copy could not
+   be allocated.
+
+   IMPORTANT!  Caller MUST hold the write lock when calling this
+   function. */
+int
+fd_blockstore_archive_enqueue( fd_blockstore_t *     blockstore,
+                               fd_blockstore_ser_t * ser,
+                               int                   fd,
+                               ulong                 slot );
+
 /* Restores a block and block map entry from fd at given offset. As this used by
    rpcserver, it must return an error code instead of throwing an error on failure. */
 int
@@ -889,11 +1100,16 @@ fd_blockstore_block_meta_restore( fd_blockstore_archiver_t * archvr,
                                   fd_block_map_t * block_map_entry_out,
                                   fd_block_t * block_out );
 
-/* Reads block data from fd into a given buf. Modifies data_off similarly to
-   meta_restore */
+/* Reads block data from fd into a given buf, decompressing it with
+   codec if needed (compressed data is streamed through the codec read
+   buffer, codec may be NULL if no block is compressed).  data_sz is the
+   uncompressed block data size.  Returns FD_BLOCKSTORE_ERR_SLOT_MISSING
+   if the record is corrupt (e.g. its checksum does not match) or cannot
+   be decoded. */
 int 
-fd_blockstore_block_data_restore( fd_blockstore_archiver_t * archvr,
+fd_blockstore_block_data_restore( fd_blockstore_t * blockstore,
                                   int fd,
+                                  fd_blockstore_codec_t * codec,
                                   fd_block_idx_t * block_idx_entry,
                                   uchar * buf_out,
                                   ulong buf_max,
@@ -1,5 +1,7 @@
 #include "fd_hashes.h"
 #include "fd_acc_mgr.h"
+#include "fd_accounts_hash_cache.h"
+#include "../../funk/fd_funk_cold.h"
 #include "fd_runtime.h"
 #include "fd_account.h"
 #include "context/fd_capture_ctx.h"
@@ -37,60 +39,67 @@ struct fd_pubkey_hash_pair_list {
 };
 typedef struct fd_pubkey_hash_pair_list fd_pubkey_hash_pair_list_t;
 
-static void
-fd_hash_account_deltas( fd_pubkey_hash_pair_list_t * lists, ulong lists_len, fd_hash_t * hash ) {
+/* fd_account_deltas_merkle_t incrementally computes the fanout 16
+   Merkle root of a sequence of account hashes (leaves) appended in
+   account address order.  Each level i keeps a running sha256 over
+   the num_hashes[i] (<16) complete subtree hashes appended to it so
+   far such that the leaves can be streamed in without keeping them
+   around. */
+
+struct fd_account_deltas_merkle {
   fd_sha256_t shas[FD_ACCOUNT_DELTAS_MAX_MERKLE_HEIGHT];
   uchar       num_hashes[FD_ACCOUNT_DELTAS_MAX_MERKLE_HEIGHT+1];
+  ulong       leaf_cnt;
+  fd_hash_t   hash; /* Last completed subtree hash */
+};
+typedef struct fd_account_deltas_merkle fd_account_deltas_merkle_t;
 
+static void
+fd_account_deltas_merkle_init( fd_account_deltas_merkle_t * merkle ) {
   // Init the number of hashes
-  fd_memset( num_hashes, 0, sizeof(num_hashes) );
+  fd_memset( merkle->num_hashes, 0, sizeof(merkle->num_hashes) );
+  for( ulong j = 0; j < FD_ACCOUNT_DELTAS_MAX_MERKLE_HEIGHT; ++j ) {
+    fd_sha256_init( &merkle->shas[j] );
+  }
+  merkle->leaf_cnt = 0UL;
+  fd_memset( &merkle->hash, 0, sizeof(fd_hash_t) );
+}
+
+static inline void
+fd_account_deltas_merkle_append( fd_account_deltas_merkle_t * merkle,
+                                 fd_hash_t const *            leaf ) {
+  fd_sha256_t * shas       = merkle->shas;
+  uchar *       num_hashes = merkle->num_hashes;
 
-  // FD_LOG_DEBUG(("sorting %d", pairs_len));
-  // long timer_sort = -fd_log_wallclock();
-  // sort_pubkey_hash_pair_inplace( pairs, pairs_len );
-  // timer_sort += fd_log_wallclock();
-  // FD_LOG_DEBUG(("sorting done %6.3f ms", (double)timer_sort*(1e-6)));
+  fd_sha256_append( &shas[0], leaf->hash, sizeof( fd_hash_t ) );
+  num_hashes[0]++;
+  merkle->leaf_cnt++;
 
-  // FD_LOG_DEBUG(("fancy bmtree started"));
   for( ulong j = 0; j < FD_ACCOUNT_DELTAS_MAX_MERKLE_HEIGHT; ++j ) {
-    fd_sha256_init( &shas[j] );
+    if (num_hashes[j] == FD_ACCOUNT_DELTAS_MERKLE_FANOUT) {
+      num_hashes[j] = 0;
+      num_hashes[j+1]++;
+      fd_sha256_fini( &shas[j], merkle->hash.hash );
+      fd_sha256_init( &shas[j] );
+      fd_sha256_append( &shas[j+1], (uchar const *) merkle->hash.hash, sizeof( fd_hash_t ) );
+    } else {
+      break;
+    }
+  }
 }
 
-  if( lists_len == 0 ) {
+static void
+fd_account_deltas_merkle_fini( fd_account_deltas_merkle_t * merkle,
+                               fd_hash_t *                  hash ) {
+  fd_sha256_t * shas       = merkle->shas;
+  uchar *       num_hashes = merkle->num_hashes;
+
+  if( merkle->leaf_cnt == 0 ) {
     fd_sha256_fini( &shas[0], hash->hash );
     return;
   }
 
-  fd_pubkey_hash_pair_t * prev_pair = NULL;
-  for( ulong k = 0; k < lists_len; ++k ) {
-    fd_pubkey_hash_pair_t * pairs = lists[k].pairs;
-    ulong pairs_len               = lists[k].pairs_len;
-    for( ulong i = 0; i < pairs_len; ++i ) {
-#ifdef VLOG
-      FD_LOG_NOTICE(( "account delta hash X { \"key\":%ld, \"pubkey\":\"%s\", \"hash\":\"%s\" },",
-                      i,
-                      FD_BASE58_ENC_32_ALLOCA( pairs[i].pubkey->key ),
-                      FD_BASE58_ENC_32_ALLOCA( pairs[i].hash->hash ) ));
-#endif
-
-      if( prev_pair ) FD_TEST(fd_pubkey_hash_pair_compare(prev_pair, &pairs[i]) > 0);
-      prev_pair = &pairs[i];
-      fd_sha256_append( &shas[0], pairs[i].hash->hash, sizeof( fd_hash_t ) );
-      num_hashes[0]++;
-
-      for( ulong j = 0; j < FD_ACCOUNT_DELTAS_MAX_MERKLE_HEIGHT; ++j ) {
-        if (num_hashes[j] == FD_ACCOUNT_DELTAS_MERKLE_FANOUT) {
-          num_hashes[j] = 0;
-          num_hashes[j+1]++;
-          fd_sha256_fini( &shas[j], hash->hash );
-          fd_sha256_init( &shas[j] );
-          fd_sha256_append( &shas[j+1], (uchar const *) hash->hash, sizeof( fd_hash_t ) );
-        } else {
-          break;
-        }
-      }
-    }
-  }
+  *hash = merkle->hash;
 
   ulong tot_num_hashes = 0;
   for (ulong k = 0; k < FD_ACCOUNT_DELTAS_MAX_MERKLE_HEIGHT; ++k ) {
@@ -154,6 +163,31 @@ fd_hash_account_deltas( fd_pubkey_hash_pair_list_t * lists, ulong lists_len, fd_
   // If the level at the `height' was rolled into, do something about it
 }
 
+static void
+fd_hash_account_deltas( fd_pubkey_hash_pair_list_t * lists, ulong lists_len, fd_hash_t * hash ) {
+  fd_account_deltas_merkle_t merkle[1];
+  fd_account_deltas_merkle_init( merkle );
+
+  fd_pubkey_hash_pair_t * prev_pair = NULL;
+  for( ulong k = 0; k < lists_len; ++k ) {
+    fd_pubkey_hash_pair_t * pairs = lists[k].pairs;
+    ulong pairs_len               = lists[k].pairs_len;
+    for( ulong i = 0; i < pairs_len; ++i ) {
+#ifdef VLOG
+      FD_LOG_NOTICE(( "account delta hash X { \"key\":%ld, \"pubkey\":\"%s\", \"hash\":\"%s\" },",
+                      i,
+                      FD_BASE58_ENC_32_ALLOCA( pairs[i].pubkey->key ),
+                      FD_BASE58_ENC_32_ALLOCA( pairs[i].hash->hash ) ));
+#endif
+
+      if( prev_pair ) FD_TEST(fd_pubkey_hash_pair_compare(prev_pair, &pairs[i]) > 0);
+      prev_pair = &pairs[i];
+      fd_account_deltas_merkle_append( merkle, pairs[i].hash );
+    }
+  }
+
+  fd_account_deltas_merkle_fini( merkle, hash );
+}
 
 void
 fd_calculate_epoch_accounts_hash_values(fd_exec_slot_ctx_t * slot_ctx) {
@@ -458,10 +492,18 @@ fd_update_hash_bank_tpool( fd_exec_slot_ctx_t * slot_ctx,
 
   // Apply the lthash changes to the bank lthash
   fd_lthash_value_t * acc = (fd_lthash_value_t *)fd_type_pun( slot_ctx->slot_bank.lthash.lthash );
-  for( ulong i = 0; i < wcnt; i++ ) {
-    fd_lthash_add( acc, &task_data.lthash_values[i] );
+  for( ulong i = 1; i < wcnt; i++ ) {
+    fd_lthash_add( &task_data.lthash_values[0], &task_data.lthash_values[i] );
+  }
+  fd_lthash_add( acc, &task_data.lthash_values[0] );
+
+  /* Feed the accounts hash cache the slot's lthash delta and the new
+     account hashes, and let it catch up with the funk root */
+  fd_accounts_hash_cache_t * hash_cache = acc_mgr->hash_cache;
+  if( hash_cache ) {
+    fd_accounts_hash_cache_mark_lthash( hash_cache, acc_mgr->hash_cache_valloc, &task_data.lthash_values[0], slot_ctx->slot_bank.slot );
+    fd_accounts_hash_cache_publish( hash_cache, acc_mgr->hash_cache_valloc, fd_funk_last_publish( funk )->ul[0] );
   }
-
   for( ulong i = 0; i < task_data.info_sz; i++ ) {
     fd_accounts_hash_task_info_t * task_info = &task_data.info[i];
     /* Upgrade to writable record */
@@ -483,6 +525,13 @@ fd_update_hash_bank_tpool( fd_exec_slot_ctx_t * slot_ctx,
     memcpy( acc_rec->meta->hash, task_info->acc_hash->hash, sizeof(fd_hash_t) );
     acc_rec->meta->slot = slot_ctx->slot_bank.slot;
 
+    if( hash_cache ) {
+      /* Same pair selection as the accounts hash */
+      int has_pair = !task_info->should_erase && !( acc_rec->meta->info.executable & ~1 );
+      fd_accounts_hash_cache_mark( hash_cache, acc_mgr->hash_cache_valloc, task_info->acc_pubkey,
+                                   has_pair ? task_info->acc_hash : NULL, slot_ctx->slot_bank.slot );
+    }
+
     /* Add account to "dirty keys" list, which will be added to the
        bank hash. */
 
@@ -736,6 +785,22 @@ typedef struct accounts_hash accounts_hash_t;
 #define MAP_T    accounts_hash_t
 #include "../../util/tmpl/fd_map_dynamic.c"
 
+/* fd_accounts_hash_fill caches hash in the account metadata of the
+   root record rec, which has none yet, and returns the metadata.
+   Values peeked from the funk cold tier are read-only, so a cold rec is
+   faulted back into the wksp first. */
+
+static fd_account_meta_t const *
+fd_accounts_hash_fill( fd_funk_t *           funk,
+                       fd_wksp_t *           wksp,
+                       fd_funk_rec_t const * rec,
+                       uchar const           hash[ static 32 ] ) {
+  if( FD_UNLIKELY( rec->flags & FD_FUNK_REC_FLAG_COLD ) ) rec = fd_funk_cold_fault( funk, rec );
+  fd_account_meta_t * metadata = (fd_account_meta_t *) fd_funk_val( rec, wksp );
+  fd_memcpy( metadata->hash, hash, 32 );
+  return metadata;
+}
+
 static fd_pubkey_hash_pair_t *
 fd_accounts_sorted_subrange( fd_funk_t         * funk,
                              uint                range_idx,
@@ -774,7 +839,9 @@ fd_accounts_sorted_subrange( fd_funk_t         * funk,
       continue;
     }
 
-    fd_account_meta_t * metadata = (fd_account_meta_t *) fd_funk_val_const( rec, wksp );
+    /* Read cold values in place rather than faulting them in */
+    ulong                     val_sz;
+    fd_account_meta_t const * metadata = (fd_account_meta_t const *) fd_funk_cold_val_peek( funk, rec, wksp, &val_sz );
     int is_empty = (metadata->info.lamports == 0);
     if( is_empty ) {
       continue;
@@ -784,16 +851,18 @@ fd_accounts_sorted_subrange( fd_funk_t         * funk,
     fd_lthash_value_t new_lthash_value;
     fd_lthash_zero(&new_lthash_value);
 
-    fd_hash_account_current( (uchar *) hash, &new_lthash_value, metadata, rec->pair.key->uc, fd_account_get_data(metadata) );
+    fd_hash_account_current( (uchar *) hash, &new_lthash_value, metadata, rec->pair.key->uc, (uchar const *)metadata + metadata->hlen );
     fd_lthash_add( &accum, &new_lthash_value );
 
-    fd_hash_t * h = (fd_hash_t *) metadata->hash;
+    fd_hash_t const * h = (fd_hash_t const *) metadata->hash;
     if( FD_LIKELY( (h->ul[0] | h->ul[1] | h->ul[2] | h->ul[3]) != 0 ) ) {
       if( FD_UNLIKELY( fd_acc_exists( metadata ) && memcmp( metadata->hash, &hash, 32 ) != 0 ) ) {
         FD_LOG_WARNING(( "snapshot hash (%s) doesn't match calculated hash (%s)", FD_BASE58_ENC_32_ALLOCA( metadata->hash ), FD_BASE58_ENC_32_ALLOCA( &hash ) ));
       }
-    } else
-      fd_memcpy( metadata->hash, &hash, 32 );
+    } else {
+      metadata = fd_accounts_hash_fill( funk, wksp, rec, hash );
+      h        = (fd_hash_t const *) metadata->hash;
+    }
 
     if( (metadata->info.executable & ~1) != 0 )
       continue;
@@ -906,6 +975,221 @@ fd_accounts_hash( fd_funk_t          * funk,
   return 0;
 }
 
+#define SORT_NAME        sort_accounts_hash_cache_pair
+#define SORT_KEY_T       fd_accounts_hash_cache_pair_t
+#define SORT_BEFORE(a,b) fd_accounts_hash_cache_pair_before( &(a), &(b) )
+#include "../../util/tmpl/fd_sort.c"
+
+struct fd_accounts_hash_cache_task_info {
+  fd_funk_t *                funk;
+  fd_accounts_hash_cache_t * cache;
+  ulong                      task_cnt;
+  ulong                      root_slot;
+  fd_valloc_t                valloc;
+};
+typedef struct fd_accounts_hash_cache_task_info fd_accounts_hash_cache_task_info_t;
+
+/* fd_accounts_hash_cache_rec adds the root record rec of an account
+   in partition part to part's results.  Per account, this does exactly
+   what fd_accounts_sorted_subrange does. */
+
+static void
+fd_accounts_hash_cache_rec( fd_funk_t *                     funk,
+                            fd_wksp_t *                     wksp,
+                            fd_accounts_hash_cache_part_t * part,
+                            fd_lthash_value_t *             lthash,
+                            fd_valloc_t                     valloc,
+                            fd_funk_rec_t const *           rec ) {
+  /* Read cold values in place rather than faulting them in */
+  ulong                     val_sz;
+  fd_account_meta_t const * metadata = (fd_account_meta_t const *) fd_funk_cold_val_peek( funk, rec, wksp, &val_sz );
+  int is_empty = (metadata->info.lamports == 0);
+  if( is_empty ) {
+    return;
+  }
+
+  uchar hash[32];
+  fd_lthash_value_t new_lthash_value;
+  fd_lthash_zero(&new_lthash_value);
+
+  fd_hash_account_current( (uchar *) hash, &new_lthash_value, metadata, rec->pair.key->uc, (uchar const *)metadata + metadata->hlen );
+  fd_lthash_add( lthash, &new_lthash_value );
+
+  fd_hash_t const * h = (fd_hash_t const *) metadata->hash;
+  if( FD_LIKELY( (h->ul[0] | h->ul[1] | h->ul[2] | h->ul[3]) != 0 ) ) {
+    if( FD_UNLIKELY( fd_acc_exists( metadata ) && memcmp( metadata->hash, &hash, 32 ) != 0 ) ) {
+      FD_LOG_WARNING(( "snapshot hash (%s) doesn't match calculated hash (%s)", FD_BASE58_ENC_32_ALLOCA( metadata->hash ), FD_BASE58_ENC_32_ALLOCA( &hash ) ));
+    }
+  } else {
+    metadata = fd_accounts_hash_fill( funk, wksp, rec, hash );
+    h        = (fd_hash_t const *) metadata->hash;
+  }
+
+  if( (metadata->info.executable & ~1) != 0 )
+    return;
+
+  fd_accounts_hash_cache_part_append( part, valloc, fd_funk_key_to_acc( rec->pair.key ), h );
+}
+
+/* fd_accounts_hash_cache_rec_is_root_acc returns 1 if rec is the root
+   version of a live account and 0 otherwise. */
+
+FD_FN_PURE static inline int
+fd_accounts_hash_cache_rec_is_root_acc( fd_funk_rec_t const * rec ) {
+  return fd_funk_key_is_acc( rec->pair.key ) &&            /* a solana record */
+         !( rec->flags & FD_FUNK_REC_FLAG_ERASE ) &&        /* not a tombstone */
+         !( rec->pair.xid->ul[0] | rec->pair.xid->ul[1] );  /* root xid */
+}
+
+/* fd_accounts_hash_cache_scan_task builds the results of the
+   contiguous range of partitions assigned to task m0 with a pass over
+   the funk record map, accumulating their lthash into the task's
+   lthash_values[m0]. */
+
+static void
+fd_accounts_hash_cache_scan_task( void *tpool,
+                                  ulong t0 FD_PARAM_UNUSED, ulong t1 FD_PARAM_UNUSED,
+                                  void *args,
+                                  void *reduce FD_PARAM_UNUSED, ulong stride FD_PARAM_UNUSED,
+                                  ulong l0 FD_PARAM_UNUSED, ulong l1 FD_PARAM_UNUSED,
+                                  ulong m0, ulong m1 FD_PARAM_UNUSED,
+                                  ulong n0 FD_PARAM_UNUSED, ulong n1 FD_PARAM_UNUSED ) {
+  fd_accounts_hash_cache_task_info_t * task_info = (fd_accounts_hash_cache_task_info_t *)tpool;
+  fd_lthash_value_t *                  lthash    = (fd_lthash_value_t *)args + m0;
+  fd_funk_t *                     funk  = task_info->funk;
+  fd_accounts_hash_cache_t *      cache = task_info->cache;
+  fd_accounts_hash_cache_part_t * parts = fd_accounts_hash_cache_part( cache );
+
+  ulong part_cnt = fd_accounts_hash_cache_part_cnt( cache );
+  ulong part_lo  = ( m0     *part_cnt)/task_info->task_cnt;
+  ulong part_hi  = ((m0+1UL)*part_cnt)/task_info->task_cnt;
+
+  fd_wksp_t *     wksp    = fd_funk_wksp( funk );
+  fd_funk_rec_t * rec_map = fd_funk_rec_map( funk, wksp );
+
+  ulong num_iter_accounts = fd_funk_rec_map_key_max( rec_map );
+  for( ulong i = num_iter_accounts; i; --i ) {
+    fd_funk_rec_t const * rec = rec_map + (i-1UL);
+    if( ( rec->map_next >> 63 ) /* unused map entry */ || !fd_accounts_hash_cache_rec_is_root_acc( rec ) ) {
+      continue;
+    }
+
+    ulong p = fd_accounts_hash_cache_part_idx( cache, fd_funk_key_to_acc( rec->pair.key ) );
+    if( p < part_lo || p >= part_hi ) {
+      continue;
+    }
+    fd_accounts_hash_cache_rec( funk, wksp, parts + p, lthash, task_info->valloc, rec );
+  }
+
+  for( ulong p=part_lo; p<part_hi; p++ ) {
+    fd_accounts_hash_cache_part_t * part = parts + p;
+    sort_accounts_hash_cache_pair_inplace( part->pair, part->pair_cnt );
+  }
+}
+
+/* fd_accounts_hash_cache_merge_task merges the rooted pending updates
+   of the contiguous range of partitions assigned to task m0 into their
+   pairs.  Partitions merged into (here or by an earlier publish) are
+   marked dirty. */
+
+static void
+fd_accounts_hash_cache_merge_task( void *tpool,
+                                   ulong t0 FD_PARAM_UNUSED, ulong t1 FD_PARAM_UNUSED,
+                                   void *args FD_PARAM_UNUSED,
+                                   void *reduce FD_PARAM_UNUSED, ulong stride FD_PARAM_UNUSED,
+                                   ulong l0 FD_PARAM_UNUSED, ulong l1 FD_PARAM_UNUSED,
+                                   ulong m0, ulong m1 FD_PARAM_UNUSED,
+                                   ulong n0 FD_PARAM_UNUSED, ulong n1 FD_PARAM_UNUSED ) {
+  fd_accounts_hash_cache_task_info_t * task_info = (fd_accounts_hash_cache_task_info_t *)tpool;
+  fd_accounts_hash_cache_t *      cache = task_info->cache;
+  fd_accounts_hash_cache_part_t * parts = fd_accounts_hash_cache_part( cache );
+
+  ulong part_cnt = fd_accounts_hash_cache_part_cnt( cache );
+  ulong part_lo  = ( m0     *part_cnt)/task_info->task_cnt;
+  ulong part_hi  = ((m0+1UL)*part_cnt)/task_info->task_cnt;
+
+  for( ulong p=part_lo; p<part_hi; p++ ) {
+    fd_accounts_hash_cache_part_merge( parts + p, task_info->valloc, task_info->root_slot );
+  }
+}
+
+int
+fd_accounts_hash_cached( fd_funk_t *                funk,
+                         fd_accounts_hash_cache_t * cache,
+                         fd_slot_bank_t *           slot_bank,
+                         fd_valloc_t                valloc,
+                         fd_tpool_t *               tpool,
+                         fd_hash_t *                accounts_hash ) {
+  FD_LOG_NOTICE(("accounts_hash_cached start"));
+
+  ulong                           root_slot = fd_funk_last_publish( funk )->ul[0];
+  ulong                           part_cnt  = fd_accounts_hash_cache_part_cnt( cache );
+  fd_accounts_hash_cache_part_t * parts     = fd_accounts_hash_cache_part( cache );
+
+  ulong task_cnt = ( tpool == NULL ? 1UL : fd_ulong_min( fd_tpool_worker_cnt( tpool ), part_cnt ) );
+  fd_accounts_hash_cache_task_info_t task_info = {
+    .funk      = funk,
+    .cache     = cache,
+    .task_cnt  = task_cnt,
+    .root_slot = root_slot,
+    .valloc    = valloc };
+
+  /* Apply the lthash deltas of the slots rooted since the last call
+     (or drop them if the initial scan is yet to be done) */
+
+  fd_accounts_hash_cache_publish( cache, valloc, root_slot );
+
+  ulong dirty_cnt = 0UL;
+  if( !fd_accounts_hash_cache_has_results( cache ) ) {
+    FD_LOG_NOTICE(( "scanning %lu accounts hash partitions (root slot %lu)", part_cnt, root_slot ));
+
+    fd_lthash_value_t * lthash_values = fd_valloc_malloc( valloc, FD_LTHASH_VALUE_ALIGN, task_cnt*FD_LTHASH_VALUE_FOOTPRINT );
+    for( ulong i=0UL; i<task_cnt; i++ ) fd_lthash_zero( &lthash_values[i] );
+    if( task_cnt <= 1UL ) {
+      fd_accounts_hash_cache_scan_task( &task_info, 0UL, 0UL, lthash_values, NULL, 0UL, 0UL, 0UL, 0UL, 1UL, 0UL, 1UL );
+    } else {
+      fd_tpool_exec_all_rrobin( tpool, 0UL, task_cnt, fd_accounts_hash_cache_scan_task, &task_info, lthash_values, NULL, 1, 0, task_cnt );
+    }
+    fd_lthash_zero( &cache->lthash );
+    for( ulong i=0UL; i<task_cnt; i++ ) fd_lthash_add( &cache->lthash, &lthash_values[i] );
+    fd_valloc_free( valloc, lthash_values );
+
+    cache->scan_slot = root_slot;
+    dirty_cnt        = part_cnt;
+  } else {
+    if( task_cnt <= 1UL ) {
+      fd_accounts_hash_cache_merge_task( &task_info, 0UL, 0UL, NULL, NULL, 0UL, 0UL, 0UL, 0UL, 1UL, 0UL, 1UL );
+    } else {
+      fd_tpool_exec_all_rrobin( tpool, 0UL, task_cnt, fd_accounts_hash_cache_merge_task, &task_info, NULL, NULL, 1, 0, task_cnt );
+    }
+    for( ulong p=0UL; p<part_cnt; p++ ) dirty_cnt += parts[p].dirty;
+    FD_LOG_NOTICE(( "merged updates into %lu of %lu accounts hash partitions (root slot %lu)", dirty_cnt, part_cnt, root_slot ));
+  }
+
+  /* Merge the partitions, which are contiguous address ranges in
+     address order */
+
+  fd_account_deltas_merkle_t merkle[1];
+  fd_account_deltas_merkle_init( merkle );
+  for( ulong p=0UL; p<part_cnt; p++ ) {
+    fd_accounts_hash_cache_part_t * part = parts + p;
+    for( ulong i=0UL; i<part->pair_cnt; i++ ) fd_account_deltas_merkle_append( merkle, &part->pair[i].hash );
+    part->dirty = 0UL;
+  }
+  fd_account_deltas_merkle_fini( merkle, accounts_hash );
+
+  fd_lthash_value_t * acc = (fd_lthash_value_t *)fd_type_pun(slot_bank->lthash.lthash);
+  fd_lthash_add( acc, &cache->lthash );
+
+  cache->miss_cnt += dirty_cnt;
+  cache->hit_cnt  += part_cnt - dirty_cnt;
+
+  FD_LOG_NOTICE(("accounts_lthash %s", FD_LTHASH_ENC_32_ALLOCA( (fd_lthash_value_t *) slot_bank->lthash.lthash )));
+  FD_LOG_NOTICE(("accounts_hash %s", FD_BASE58_ENC_32_ALLOCA( accounts_hash->hash ) ));
+
+  return 0;
+}
+
 static int
 fd_accounts_hash_inc_only( fd_exec_slot_ctx_t * slot_ctx, 
                            fd_hash_t *          accounts_hash, 
@@ -66,6 +66,27 @@ fd_accounts_hash( fd_funk_t          * funk,
                   fd_tpool_t         * tpool,
                   fd_hash_t          * accounts_hash );
 
+/* fd_accounts_hash_cached is fd_accounts_hash computed from the
+   results held by cache (see fd_accounts_hash_cache.h).  The first call
+   after the cache was created or reset builds the results with a
+   parallel scan of the funk record map on tpool, each worker owning a
+   contiguous range of partitions.  Later calls merge the account
+   hashes marked since into the partitions' sorted pairs (in parallel,
+   without rehashing any account) and apply the marked lthash deltas,
+   before folding the pairs into the accounts hash.  Funk must not be
+   modified concurrently.  valloc is the cache's persistent allocator.
+   Yields the same accounts_hash and lthash as fd_accounts_hash provided
+   that every modification of funk's root since the initial scan was
+   marked in cache. */
+
+int
+fd_accounts_hash_cached( fd_funk_t *                funk,
+                         fd_accounts_hash_cache_t * cache,
+                         fd_slot_bank_t *           slot_bank,
+                         fd_valloc_t                valloc,
+                         fd_tpool_t *               tpool,
+                         fd_hash_t *                accounts_hash );
+
 /* Generate a non-incremental hash of the entire account database, conditionally including in the epoch account hash. */
 int
 fd_snapshot_hash( fd_exec_slot_ctx_t * slot_ctx,
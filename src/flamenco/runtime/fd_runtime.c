@@ -18,6 +18,7 @@
 #include "../../ballet/txn/fd_txn.h"
 #include "../../ballet/bmtree/fd_bmtree.h"
 #include "../../ballet/bmtree/fd_wbmtree.h"
+#include "../../funk/fd_funk_ckpt.h"
 
 #include "../stakes/fd_stakes.h"
 #include "../rewards/fd_rewards.h"
@@ -2334,6 +2335,352 @@ fd_runtime_process_txns_in_waves_tpool( fd_exec_slot_ctx_t * slot_ctx,
   return res;
 }
 
+/* Streaming DAG transaction scheduling ***********************************
+
+   The wave scheduler above runs sigverify, execution and finalization
+   as three tpool barriers per wave, so one long running transaction
+   idles every other worker until it completes.  The DAG scheduler below
+   instead builds the account conflict graph of a window of transactions
+   up front and then dispatches each transaction to an idle tpool worker
+   the moment all of its conflicting predecessors have been finalized.
+
+   For each account referenced in the window, we track the most recent
+   writer and the list of readers since that writer.  A transaction that
+   writes an account depends on the previous writer and all readers
+   since, a transaction that reads an account depends only on the
+   previous writer.  This gives the same serialization order as
+   executing the window one transaction at a time in block order.
+
+   The caller (tpool worker 0) acts as the dispatcher.  Workers run
+   sigverify + prepare + execute for a transaction.  Finalization (i.e.
+   saving accounts back into funk and updating the slot level state) is
+   done by the dispatcher as soon as a worker goes idle, while the other
+   workers keep executing.  This is safe because accounts are saved with
+   fd_funk_rec_write_prepare_concur (records are published atomically
+   for the lockless queries of executing transactions) and because no
+   executing transaction references an account of the transaction being
+   finalized (they would be its successors).  The successors of a
+   transaction are released (i.e. its account locks are freed) right
+   after it was finalized.  There are no barriers at all: a worker gets
+   its next transaction as soon as its previous one was finalized.
+
+   Like the wave scheduler, transactions that failed preparation (i.e.
+   are not sanitized) are neither executed nor finalized and are not
+   part of the graph.
+
+   Accounts are keyed by their 64-bit hash, like the wave scheduler.
+   A hash collision between two different accounts merely adds a
+   spurious dependency and is safe.
+
+   Each worker's spad holds the borrowed accounts of at most one
+   transaction at a time: the dispatcher pushes a frame on the worker's
+   spad before dispatch and pops it after finalization. */
+
+#define FD_RUNTIME_DAG_TXN_WINDOW (128UL)
+
+struct fd_runtime_dag_acct {
+  ulong key;         /* hash of the account pubkey, 0 is the null key */
+  uint  hash;
+  ulong last_writer; /* txn idx of the last writer in the window, ULONG_MAX if none */
+  ulong reader_head; /* edge pool idx of the reader list since last_writer, ULONG_MAX if empty */
+};
+typedef struct fd_runtime_dag_acct fd_runtime_dag_acct_t;
+
+#define MAP_NAME                fd_runtime_dag_acct_map
+#define MAP_T                   fd_runtime_dag_acct_t
+#define MAP_KEY                 key
+#define MAP_KEY_T               ulong
+#define MAP_KEY_NULL            0
+#define MAP_KEY_INVAL( k )      k==0
+#define MAP_KEY_EQUAL( k0, k1 ) k0==k1
+#define MAP_KEY_EQUAL_IS_SLOW   0
+#define MAP_KEY_HASH( key )     ( (uint)key )
+#define MAP_MEMOIZE             1
+#include "../../util/tmpl/fd_map_dynamic.c"
+
+/* fd_runtime_dag_edge_t is a node of a singly linked list, used both
+   for the successor lists of transactions and for the reader lists of
+   accounts. */
+
+struct fd_runtime_dag_edge {
+  ulong txn_idx;
+  ulong next;
+};
+typedef struct fd_runtime_dag_edge fd_runtime_dag_edge_t;
+
+struct fd_runtime_dag {
+  ulong *                 pred_cnt;  /* indexed [0,txn_cnt), number of unretired predecessor edges */
+  ulong *                 succ_head; /* indexed [0,txn_cnt), head of successor edge list */
+  fd_runtime_dag_edge_t * edge;      /* edge pool */
+  ulong                   edge_cnt;
+  ulong                   edge_max;
+};
+typedef struct fd_runtime_dag fd_runtime_dag_t;
+
+static inline void
+fd_runtime_dag_edge_add( fd_runtime_dag_t * dag,
+                         ulong              pred,
+                         ulong              succ ) {
+  if( FD_UNLIKELY( pred==ULONG_MAX || pred==succ ) ) return;
+  if( FD_UNLIKELY( dag->edge_cnt>=dag->edge_max ) ) FD_LOG_CRIT(( "dag edge pool overflow" ));
+  ulong e = dag->edge_cnt++;
+  dag->edge[ e ].txn_idx = succ;
+  dag->edge[ e ].next    = dag->succ_head[ pred ];
+  dag->succ_head[ pred ] = e;
+  dag->pred_cnt[ succ ]++;
+}
+
+/* fd_runtime_dag_build populates dag with the conflict graph of the
+   transactions in task_infos.  Transactions that are not sanitized are
+   skipped.  Returns the number of transactions that were scheduled and
+   appends the ones with no predecessors, in block order, to ready. */
+
+static ulong
+fd_runtime_dag_build( fd_runtime_dag_t *           dag,
+                      fd_execute_txn_task_info_t * task_infos,
+                      ulong                        txn_cnt,
+                      ulong *                      ready,
+                      ulong *                      _ready_cnt ) {
+  ulong acct_cnt = 0UL;
+  for( ulong i=0UL; i<txn_cnt; i++ ) {
+    if( FD_UNLIKELY( !( task_infos[i].txn->flags & FD_TXN_P_FLAGS_SANITIZE_SUCCESS ) ) ) continue;
+    acct_cnt += task_infos[i].txn_ctx->accounts_cnt;
+  }
+
+  /* Every account reference adds at most one edge from the previous
+     writer and one reader list node, and every reader list node turns
+     into at most one edge. */
+
+  dag->pred_cnt  = fd_scratch_alloc( alignof(ulong), txn_cnt*sizeof(ulong) );
+  dag->succ_head = fd_scratch_alloc( alignof(ulong), txn_cnt*sizeof(ulong) );
+  dag->edge_max  = 3UL*acct_cnt;
+  dag->edge_cnt  = 0UL;
+  dag->edge      = fd_scratch_alloc( alignof(fd_runtime_dag_edge_t), fd_ulong_max( dag->edge_max, 1UL )*sizeof(fd_runtime_dag_edge_t) );
+
+  int                     lg_slot_cnt = fd_ulong_find_msb( fd_ulong_max( acct_cnt, 1UL ) ) + 2;
+  void *                  map_mem     = fd_scratch_alloc( fd_runtime_dag_acct_map_align(), fd_runtime_dag_acct_map_footprint( lg_slot_cnt ) );
+  fd_runtime_dag_acct_t * acct_map    = fd_runtime_dag_acct_map_join( fd_runtime_dag_acct_map_new( map_mem, lg_slot_cnt ) );
+
+  ulong sched_cnt = 0UL;
+  ulong ready_cnt = 0UL;
+  for( ulong i=0UL; i<txn_cnt; i++ ) {
+    dag->pred_cnt [ i ] = 0UL;
+    dag->succ_head[ i ] = ULONG_MAX;
+    if( FD_UNLIKELY( !( task_infos[i].txn->flags & FD_TXN_P_FLAGS_SANITIZE_SUCCESS ) ) ) continue;
+
+    fd_exec_txn_ctx_t * txn_ctx = task_infos[i].txn_ctx;
+    for( ulong j=0UL; j<txn_ctx->accounts_cnt; j++ ) {
+      ulong h = fd_hash( 0UL, &txn_ctx->accounts[j], sizeof(fd_pubkey_t) );
+      h = fd_ulong_if( !h, 1UL, h );
+      fd_runtime_dag_acct_t * acct = fd_runtime_dag_acct_map_query( acct_map, h, NULL );
+      if( !acct ) {
+        acct              = fd_runtime_dag_acct_map_insert( acct_map, h );
+        acct->last_writer = ULONG_MAX;
+        acct->reader_head = ULONG_MAX;
+      }
+
+      fd_runtime_dag_edge_add( dag, acct->last_writer, i );
+      if( fd_txn_account_is_writable_idx( txn_ctx, (int)j ) ) {
+        for( ulong r=acct->reader_head; r!=ULONG_MAX; r=dag->edge[ r ].next ) {
+          fd_runtime_dag_edge_add( dag, dag->edge[ r ].txn_idx, i );
+        }
+        acct->last_writer = i;
+        acct->reader_head = ULONG_MAX;
+      } else {
+        if( FD_UNLIKELY( dag->edge_cnt>=dag->edge_max ) ) FD_LOG_CRIT(( "dag edge pool overflow" ));
+        ulong e = dag->edge_cnt++;
+        dag->edge[ e ].txn_idx = i;
+        dag->edge[ e ].next    = acct->reader_head;
+        acct->reader_head      = e;
+      }
+    }
+
+    sched_cnt++;
+    if( !dag->pred_cnt[ i ] ) ready[ ready_cnt++ ] = i;
+  }
+
+  *_ready_cnt = ready_cnt;
+  return sched_cnt;
+}
+
+/* fd_runtime_dag_retire releases the successors of txn_idx, appending
+   the ones that have no more outstanding predecessors to ready.
+   Returns the new ready_cnt. */
+
+static inline ulong
+fd_runtime_dag_retire( fd_runtime_dag_t * dag,
+                       ulong              txn_idx,
+                       ulong *            ready,
+                       ulong              ready_cnt ) {
+  for( ulong e=dag->succ_head[ txn_idx ]; e!=ULONG_MAX; e=dag->edge[ e ].next ) {
+    ulong succ = dag->edge[ e ].txn_idx;
+    if( !--dag->pred_cnt[ succ ] ) ready[ ready_cnt++ ] = succ;
+  }
+  return ready_cnt;
+}
+
+static void
+fd_txn_sigverify_prep_and_exec_task( void  *tpool,
+                                     ulong t0,     ulong t1,
+                                     void  *args,
+                                     void  *reduce, ulong stride,
+                                     ulong l0,     ulong l1,
+                                     ulong m0,     ulong m1,
+                                     ulong n0,     ulong n1 ) {
+  fd_txn_sigverify_task    ( tpool, t0, t1, args, reduce, stride, l0, l1, m0, m1, n0, n1 );
+  fd_txn_prep_and_exec_task( tpool, t0, t1, args, reduce, stride, l0, l1, m0, m1, n0, n1 );
+}
+
+/* fd_runtime_dag_finalize finalizes transaction txn_idx on the
+   dispatcher and pops the frame holding its borrowed accounts from
+   spad.  Other transactions may be executing on the tpool meanwhile
+   (see above), so the tpool is not used. */
+
+static void
+fd_runtime_dag_finalize( fd_exec_slot_ctx_t *         slot_ctx,
+                         fd_capture_ctx_t *           capture_ctx,
+                         fd_execute_txn_task_info_t * task_infos,
+                         ulong                        txn_idx,
+                         fd_spad_t *                  spad ) {
+  if( FD_UNLIKELY( fd_runtime_finalize_txns_tpool( slot_ctx, capture_ctx, task_infos+txn_idx, 1UL, NULL ) ) ) {
+    FD_LOG_ERR(( "Fail finalize" ));
+  }
+
+  /* The frame holding the transaction's borrowed accounts can be
+     pretty big, and there are additional dynamic allocations during
+     finalize. */
+  if( FD_UNLIKELY( fd_spad_verify( spad ) ) ) {
+    FD_LOG_ERR(( "spad corrupted or overflown" ));
+  }
+  fd_spad_pop( spad );
+  if( FD_UNLIKELY( fd_spad_frame_used( spad )!=0 ) ) {
+    FD_LOG_ERR(( "stray spad frame frame_used=%lu", fd_spad_frame_used( spad ) ));
+  }
+}
+
+/* NOTE: Like the wave scheduler, this should ONLY be used in offline
+   replay and the non-leader replay path. */
+
+int
+fd_runtime_process_txns_dag_tpool( fd_exec_slot_ctx_t * slot_ctx,
+                                   fd_capture_ctx_t *   capture_ctx,
+                                   fd_txn_p_t *         all_txns,
+                                   ulong                total_txn_cnt,
+                                   fd_tpool_t *         tpool,
+                                   fd_spad_t * *        spads,
+                                   ulong                spad_cnt ) {
+  int dump_txn = capture_ctx && slot_ctx->slot_bank.slot >= capture_ctx->dump_proto_start_slot && capture_ctx->dump_txn_to_pb;
+
+  ulong worker_cnt = fd_tpool_worker_cnt( tpool );
+  for( ulong w=1UL; w<worker_cnt; w++ ) {
+    if( FD_UNLIKELY( fd_tpool_worker_tile_idx( tpool, w )>=spad_cnt ) ) {
+      FD_LOG_ERR(( "no spad for tpool worker %lu (tile %lu)", w, fd_tpool_worker_tile_idx( tpool, w ) ));
+    }
+  }
+  if( FD_UNLIKELY( worker_cnt==1UL && fd_tile_idx()>=spad_cnt ) ) FD_LOG_ERR(( "no spad for tile %lu", fd_tile_idx() ));
+
+  for( ulong i=0UL; i<total_txn_cnt; i++ ) {
+    all_txns[i].flags = FD_TXN_P_FLAGS_SANITIZE_SUCCESS;
+  }
+
+  int res = 0;
+  for( ulong txn0=0UL; txn0<total_txn_cnt; txn0+=FD_RUNTIME_DAG_TXN_WINDOW ) {
+    FD_SCRATCH_SCOPE_BEGIN {
+
+    fd_txn_p_t * txns    = all_txns + txn0;
+    ulong        txn_cnt = fd_ulong_min( total_txn_cnt-txn0, FD_RUNTIME_DAG_TXN_WINDOW );
+
+    fd_execute_txn_task_info_t * task_infos = fd_scratch_alloc( 8UL, txn_cnt * sizeof(fd_execute_txn_task_info_t) );
+    int prep_res = fd_runtime_prepare_txns_start( slot_ctx, task_infos, txns, txn_cnt );
+    if( FD_UNLIKELY( prep_res ) ) {
+      FD_LOG_DEBUG(("Fail prep 1"));
+      res |= prep_res;
+    }
+    for( ulong i=0UL; i<txn_cnt; i++ ) {
+      task_infos[i].spads               = spads;
+      task_infos[i].txn_ctx->capture_ctx = capture_ctx;
+    }
+
+    fd_runtime_dag_t dag[1];
+    ulong * ready     = fd_scratch_alloc( alignof(ulong), txn_cnt*sizeof(ulong) );
+    ulong   ready_cnt = 0UL;
+    ulong   sched_cnt = fd_runtime_dag_build( dag, task_infos, txn_cnt, ready, &ready_cnt );
+    ulong   ready_idx = 0UL; /* ready[ready_idx,ready_cnt) are waiting to be dispatched */
+    ulong   done_cnt  = 0UL;
+
+    ulong * worker_txn = fd_scratch_alloc( alignof(ulong), worker_cnt*sizeof(ulong) );
+    for( ulong w=0UL; w<worker_cnt; w++ ) worker_txn[ w ] = ULONG_MAX;
+
+    while( done_cnt<sched_cnt ) {
+      int progress = 0;
+
+      /* Finalize the transactions of workers that went idle and release
+         their successors. */
+
+      ulong busy_cnt = 0UL;
+      for( ulong w=1UL; w<worker_cnt; w++ ) {
+        ulong txn_idx = worker_txn[ w ];
+        if( txn_idx==ULONG_MAX ) continue;
+        if( fd_tpool_worker_state( tpool, w )==FD_TPOOL_WORKER_STATE_EXEC ) { busy_cnt++; continue; }
+        FD_COMPILER_MFENCE();
+        fd_runtime_dag_finalize( slot_ctx, capture_ctx, task_infos, txn_idx, spads[ fd_tpool_worker_tile_idx( tpool, w ) ] );
+        ready_cnt = fd_runtime_dag_retire( dag, txn_idx, ready, ready_cnt );
+        done_cnt++;
+        worker_txn[ w ] = ULONG_MAX;
+        progress = 1;
+      }
+
+      /* Dispatch ready transactions to idle workers.  With no workers
+         besides the caller, execute inline. */
+
+      ulong w = fd_ulong_if( worker_cnt>1UL, 1UL, 0UL );
+      while( ready_idx<ready_cnt ) {
+        while( w<worker_cnt && worker_txn[ w ]!=ULONG_MAX ) w++;
+        if( w>=worker_cnt ) break;
+
+        ulong txn_idx = ready[ ready_idx++ ];
+
+        fd_spad_t * spad = spads[ w ? fd_tpool_worker_tile_idx( tpool, w ) : fd_tile_idx() ];
+
+        if( dump_txn ) {
+          /* Manual push/pop on the spad within the callee.  The worker
+             is idle so its spad is free to use. */
+          fd_dump_txn_to_protobuf( task_infos[ txn_idx ].txn_ctx, spad );
+        }
+
+        /* Borrowed accounts are allocated during prep and need to
+           persist till the end of finalize. */
+        fd_spad_push( spad );
+
+        if( w ) {
+          worker_txn[ w ] = txn_idx;
+          fd_tpool_exec( tpool, w, fd_txn_sigverify_prep_and_exec_task, task_infos, 0UL, 1UL, slot_ctx, capture_ctx, 1UL,
+                         0UL, txn_cnt, txn_idx, txn_idx+1UL, w, w+1UL );
+          busy_cnt++;
+        } else {
+          fd_txn_sigverify_prep_and_exec_task( task_infos, 0UL, 1UL, slot_ctx, capture_ctx, 1UL, 0UL, txn_cnt, txn_idx, txn_idx+1UL, 0UL, 1UL );
+          fd_runtime_dag_finalize( slot_ctx, capture_ctx, task_infos, txn_idx, spad );
+          ready_cnt = fd_runtime_dag_retire( dag, txn_idx, ready, ready_cnt );
+          done_cnt++;
+        }
+        progress = 1;
+      }
+
+      if( FD_UNLIKELY( !progress ) ) {
+        /* Nothing ready and no worker finished.  If no worker is busy
+           either, the graph has a cycle, which is a bug. */
+        if( FD_UNLIKELY( !busy_cnt ) ) FD_LOG_CRIT(( "dag scheduler stalled (%lu of %lu txns done)", done_cnt, sched_cnt ));
+        FD_SPIN_PAUSE();
+      }
+    }
+
+    } FD_SCRATCH_SCOPE_END;
+  }
+  slot_ctx->slot_bank.transaction_count += total_txn_cnt;
+
+  return res;
+}
+
 /******************************************************************************/
 /* Epoch Boundary                                                             */
 /******************************************************************************/
@@ -2929,7 +3276,7 @@ fd_runtime_process_new_epoch( fd_exec_slot_ctx_t * slot_ctx,
     }
 
     /* Updates stake history sysvar accumulated values. */
-    fd_stakes_activate_epoch( slot_ctx, new_rate_activation_epoch, &temp_info, valloc );
+    fd_stakes_activate_epoch( slot_ctx, new_rate_activation_epoch, &temp_info );
 
     /* Update the stakes epoch value to the new epoch */
     epoch_bank->stakes.epoch = epoch;
@@ -3554,7 +3901,7 @@ fd_runtime_init_bank_from_genesis( fd_exec_slot_ctx_t *  slot_ctx,
         .data = acc->account.data,
         .meta = &meta
       };
-      FD_TEST( fd_stake_get_state(&stake_account, valloc, &stake_state) == 0 );
+      FD_TEST( fd_stake_get_state(&stake_account, &stake_state) == 0 );
       if( !stake_state.inner.stake.stake.delegation.stake ) {
         continue;
       }
@@ -3867,34 +4214,18 @@ fd_runtime_block_verify_info_collect( fd_block_info_t const *      block_info,
   }
 }
 
+/* fd_runtime_poh_verify_finish completes the verification of a
+   microblock given the PoH state after the microblock's hashes that
+   precede the (optional) mixin. */
+
 static void
-fd_runtime_poh_verify_wide_task( void * tpool,
-                                 ulong  t0 FD_PARAM_UNUSED,
-                                 ulong  t1 FD_PARAM_UNUSED,
-                                 void * args FD_PARAM_UNUSED,
-                                 void * reduce FD_PARAM_UNUSED,
-                                 ulong  stride FD_PARAM_UNUSED,
-                                 ulong  l0 FD_PARAM_UNUSED,
-                                 ulong  l1 FD_PARAM_UNUSED,
-                                 ulong  m0,
-                                 ulong  m1 FD_PARAM_UNUSED,
-                                 ulong  n0 FD_PARAM_UNUSED,
-                                 ulong  n1 FD_PARAM_UNUSED ) {
-  fd_poh_verification_info_t * poh_info = (fd_poh_verification_info_t *)tpool + m0;
-
-  fd_hash_t out_poh_hash = *poh_info->in_poh_hash;
+fd_runtime_poh_verify_finish( fd_poh_verification_info_t * poh_info,
+                              fd_hash_t *                  out_poh_hash ) {
 
   fd_microblock_info_t const *microblock_info = poh_info->microblock_info;
-  ulong hash_cnt = microblock_info->microblock_hdr.hash_cnt;
   ulong txn_cnt = microblock_info->microblock_hdr.txn_cnt;
 
-  if( !txn_cnt ) {
-    fd_poh_append( &out_poh_hash, hash_cnt );
-  } else {
-    if( hash_cnt ) {
-      fd_poh_append(&out_poh_hash, hash_cnt - 1);
-    }
-
+  if( txn_cnt ) {
     ulong                 leaf_cnt = microblock_info->signature_cnt;
     uchar *               commit   = fd_alloca_check( FD_WBMTREE32_ALIGN, fd_wbmtree32_footprint(leaf_cnt));
     fd_wbmtree32_leaf_t * leafs    = fd_alloca_check(alignof(fd_wbmtree32_leaf_t), sizeof(fd_wbmtree32_leaf_t) * leaf_cnt);
@@ -3920,29 +4251,80 @@ fd_runtime_poh_verify_wide_task( void * tpool,
 
     fd_wbmtree32_append( tree, leafs, leaf_cnt, mbuf );
     uchar * root = fd_wbmtree32_fini( tree );
-    fd_poh_mixin( &out_poh_hash, root );
+    fd_poh_mixin( out_poh_hash, root );
   }
 
-  if( FD_UNLIKELY( memcmp(microblock_info->microblock_hdr.hash, out_poh_hash.hash, sizeof(fd_hash_t)) ) ) {
-    FD_LOG_WARNING(( "poh mismatch (bank: %s, entry: %s)", FD_BASE58_ENC_32_ALLOCA( out_poh_hash.hash ), FD_BASE58_ENC_32_ALLOCA( microblock_info->microblock_hdr.hash ) ));
+  if( FD_UNLIKELY( memcmp(microblock_info->microblock_hdr.hash, out_poh_hash->hash, sizeof(fd_hash_t)) ) ) {
+    FD_LOG_WARNING(( "poh mismatch (bank: %s, entry: %s)", FD_BASE58_ENC_32_ALLOCA( out_poh_hash->hash ), FD_BASE58_ENC_32_ALLOCA( microblock_info->microblock_hdr.hash ) ));
     poh_info->success = -1;
   }
 }
 
+/* FD_RUNTIME_POH_VERIFY_BATCH_MAX is the max number of microblocks
+   whose PoH segments are advanced in a single fd_poh_append_batch
+   call.  Large enough to keep all SIMD lanes busy while segments of
+   different lengths finish. */
+
+#define FD_RUNTIME_POH_VERIFY_BATCH_MAX (256UL)
+
+/* fd_runtime_poh_verify_batch_task verifies the microblocks [m0,m1).
+   The segments of these microblocks are independent hash chains
+   (each starts at the hash of the previous microblock), so they are
+   advanced together in SIMD lanes. */
+
+static void
+fd_runtime_poh_verify_batch_task( void * tpool,
+                                  ulong  t0 FD_PARAM_UNUSED,
+                                  ulong  t1 FD_PARAM_UNUSED,
+                                  void * args FD_PARAM_UNUSED,
+                                  void * reduce FD_PARAM_UNUSED,
+                                  ulong  stride FD_PARAM_UNUSED,
+                                  ulong  l0 FD_PARAM_UNUSED,
+                                  ulong  l1 FD_PARAM_UNUSED,
+                                  ulong  m0,
+                                  ulong  m1,
+                                  ulong  n0 FD_PARAM_UNUSED,
+                                  ulong  n1 FD_PARAM_UNUSED ) {
+  fd_poh_verification_info_t * poh_info = (fd_poh_verification_info_t *)tpool;
+
+  fd_hash_t out_poh_hash[ FD_RUNTIME_POH_VERIFY_BATCH_MAX ];
+  void *    out_poh_ptr [ FD_RUNTIME_POH_VERIFY_BATCH_MAX ];
+  ulong     append_cnt  [ FD_RUNTIME_POH_VERIFY_BATCH_MAX ];
+
+  for( ulong b0=m0; b0<m1; b0+=FD_RUNTIME_POH_VERIFY_BATCH_MAX ) {
+    ulong batch_cnt = fd_ulong_min( m1-b0, FD_RUNTIME_POH_VERIFY_BATCH_MAX );
+
+    for( ulong i=0UL; i<batch_cnt; i++ ) {
+      fd_microblock_info_t const * microblock_info = poh_info[ b0+i ].microblock_info;
+      ulong hash_cnt = microblock_info->microblock_hdr.hash_cnt;
+      ulong txn_cnt  = microblock_info->microblock_hdr.txn_cnt;
+
+      /* The last hash of a microblock with transactions is the mixin */
+      out_poh_hash[ i ] = *poh_info[ b0+i ].in_poh_hash;
+      out_poh_ptr [ i ] = &out_poh_hash[ i ];
+      append_cnt  [ i ] = ( txn_cnt && hash_cnt ) ? hash_cnt-1UL : hash_cnt;
+    }
+
+    fd_poh_append_batch( out_poh_ptr, append_cnt, batch_cnt );
+
+    for( ulong i=0UL; i<batch_cnt; i++ ) fd_runtime_poh_verify_finish( &poh_info[ b0+i ], &out_poh_hash[ i ] );
+  }
+}
+
 static int
 fd_runtime_poh_verify_tpool( fd_poh_verification_info_t * poh_verification_info,
                              ulong                        poh_verification_info_cnt,
                              fd_tpool_t *                 tpool ) {
-  fd_tpool_exec_all_rrobin( tpool,
-                            0,
-                            fd_tpool_worker_cnt( tpool ),
-                            fd_runtime_poh_verify_wide_task,
-                            poh_verification_info,
-                            NULL,
-                            NULL,
-                            1,
-                            0,
-                            poh_verification_info_cnt );
+  fd_tpool_exec_all_batch( tpool,
+                           0,
+                           fd_tpool_worker_cnt( tpool ),
+                           fd_runtime_poh_verify_batch_task,
+                           poh_verification_info,
+                           NULL,
+                           NULL,
+                           1,
+                           0,
+                           poh_verification_info_cnt );
 
   for( ulong i=0UL; i<poh_verification_info_cnt; i++ ) {
     if( poh_verification_info[i].success ) {
@@ -4035,7 +4417,12 @@ fd_runtime_publish_old_txns( fd_exec_slot_ctx_t * slot_ctx,
 
       if( txn->xid.ul[0] >= epoch_bank->eah_start_slot ) {
         if( !FD_FEATURE_ACTIVE( slot_ctx, accounts_lt_hash) ) {
-          fd_accounts_hash( slot_ctx->acc_mgr->funk, &slot_ctx->slot_bank, valloc, tpool, &slot_ctx->slot_bank.epoch_account_hash );
+          fd_accounts_hash_cache_t * hash_cache = slot_ctx->acc_mgr->hash_cache;
+          if( hash_cache ) {
+            fd_accounts_hash_cached( slot_ctx->acc_mgr->funk, hash_cache, &slot_ctx->slot_bank, slot_ctx->acc_mgr->hash_cache_valloc, tpool, &slot_ctx->slot_bank.epoch_account_hash );
+          } else {
+            fd_accounts_hash( slot_ctx->acc_mgr->funk, &slot_ctx->slot_bank, valloc, tpool, &slot_ctx->slot_bank.epoch_account_hash );
+          }
         }
         epoch_bank->eah_start_slot = ULONG_MAX;
       }
@@ -4074,7 +4461,11 @@ fd_runtime_block_execute_tpool( fd_exec_slot_ctx_t *    slot_ctx,
 
     fd_runtime_block_collect_txns( block_info, txn_ptrs );
 
-    res = fd_runtime_process_txns_in_waves_tpool( slot_ctx, capture_ctx, txn_ptrs, txn_cnt, tpool, spads, spad_cnt );
+    if( slot_ctx->txn_sched==FD_RUNTIME_TXN_SCHED_WAVES ) {
+      res = fd_runtime_process_txns_in_waves_tpool( slot_ctx, capture_ctx, txn_ptrs, txn_cnt, tpool, spads, spad_cnt );
+    } else {
+      res = fd_runtime_process_txns_dag_tpool( slot_ctx, capture_ctx, txn_ptrs, txn_cnt, tpool, spads, spad_cnt );
+    }
     if( res != FD_RUNTIME_EXECUTE_SUCCESS ) {
       return res;
     }
@@ -4371,6 +4762,39 @@ fd_runtime_checkpt( fd_capture_ctx_t *   capture_ctx,
     }
   }
 
+  if( capture_ctx->checkpt_archive != NULL ) {
+    /* The first checkpoint of a chain is a full one, the following ones
+       only hold the records changed since the previous one.  A chain is
+       continued if funk was restored from (or has written) its last
+       checkpoint. */
+    fd_funk_t * funk = slot_ctx->acc_mgr->funk;
+    ulong       seq  = fd_funk_ckpt_seq( funk );
+    char        prev[ PATH_MAX ];
+    char        path[ PATH_MAX ];
+    int incr = seq && fd_funk_ckpt_chain_path( prev, sizeof(prev), capture_ctx->checkpt_archive, seq ) && !access( prev, F_OK );
+    if( FD_UNLIKELY( !fd_funk_ckpt_chain_path( path, sizeof(path), capture_ctx->checkpt_archive, incr ? seq+1UL : 1UL ) ) ) {
+      FD_LOG_ERR(( "funk checkpoint path too long" ));
+    }
+
+    if( !is_abort_slot ) {
+      FD_LOG_NOTICE(( "%s funk checkpoint at slot=%lu to file=%s", incr ? "incremental" : "full", slot, path ));
+    } else {
+      FD_LOG_NOTICE(( "%s funk checkpoint after mismatch to file=%s", incr ? "incremental" : "full", path ));
+      fd_funk_start_write( funk );
+    }
+
+    ulong rec_cnt = 0UL;
+    int   err     = fd_funk_ckpt_write( funk, path, incr, &rec_cnt );
+    if( FD_UNLIKELY( err ) ) {
+      FD_LOG_ERR(( "funk checkpoint failed: error %d-%s", err, fd_funk_strerror( err ) ));
+    }
+    FD_LOG_NOTICE(( "funk checkpoint %s holds %lu records", path, rec_cnt ));
+
+    if( is_abort_slot ) {
+      fd_funk_end_write( funk );
+    }
+  }
+
 }
 
 void
@@ -37,6 +37,12 @@
 
 #define FD_RUNTIME_NUM_ROOT_BLOCKS (32UL)
 
+/* Transaction schedulers used when replaying a block on a tpool (see
+   fd_exec_slot_ctx_t txn_sched). */
+
+#define FD_RUNTIME_TXN_SCHED_WAVES (0)
+#define FD_RUNTIME_TXN_SCHED_DAG   (1)
+
 #define FD_FEATURE_ACTIVE(_slot_ctx, _feature_name)  (_slot_ctx->slot_bank.slot >= _slot_ctx->epoch_ctx->features. _feature_name)
 #define FD_FEATURE_JUST_ACTIVATED(_slot_ctx, _feature_name)  (_slot_ctx->slot_bank.slot == _slot_ctx->epoch_ctx->features. _feature_name)
 
@@ -365,6 +371,28 @@ fd_runtime_process_txns_in_waves_tpool( fd_exec_slot_ctx_t * slot_ctx,
                                         fd_spad_t * *        spads, 
                                         ulong                spads_cnt );
 
+/* fd_runtime_process_txns_dag_tpool is a drop-in replacement for
+   fd_runtime_process_txns_in_waves_tpool.  Instead of executing
+   conflict-free waves separated by tpool barriers, it builds the
+   account conflict graph of the transactions and dispatches each
+   transaction to an idle tpool worker as soon as all of its conflicting
+   predecessors have been finalized.  Finalization (saving accounts back
+   into funk) is done by the caller, in batches of the transactions that
+   finished while no worker is executing.  Transactions that fail
+   preparation are finalized without being executed and make the
+   function return an error, like fd_runtime_process_txns_in_waves_tpool.
+   The caller is tpool worker 0 and workers (0,worker_cnt) should be
+   idle on entry.  spads is indexed by tile idx and should cover the
+   caller and all workers. */
+int
+fd_runtime_process_txns_dag_tpool( fd_exec_slot_ctx_t * slot_ctx,
+                                   fd_capture_ctx_t *   capture_ctx,
+                                   fd_txn_p_t *         txns,
+                                   ulong                txn_cnt,
+                                   fd_tpool_t *         tpool,
+                                   fd_spad_t * *        spads,
+                                   ulong                spads_cnt );
+
 /* fd_runtime_process_txns and fd_runtime_execute_txns_in_waves_tpool are 
    both entrypoints for executing transactions. Currently, the former is used
    in the leader pipeline as conflict-free microblocks are streamed in from the 
@@ -394,6 +422,12 @@ fd_runtime_block_pre_execute_process_new_epoch( fd_exec_slot_ctx_t * slot_ctx,
 
 /* Debugging Tools ************************************************************/
 
+/* fd_runtime_checkpt checkpoints funk every capture_ctx->checkpt_freq
+   slots and on a mismatch (slot==ULONG_MAX).  checkpt_path gets a
+   workspace checkpoint.  checkpt_archive gets a funk record checkpoint
+   chain (fd_funk_ckpt.h): a full checkpoint first and incremental ones
+   afterwards.  Either can be passed to fd_funk_recover_checkpoint. */
+
 void
 fd_runtime_checkpt( fd_capture_ctx_t * capture_ctx,
                     fd_exec_slot_ctx_t * slot_ctx,
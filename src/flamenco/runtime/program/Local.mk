@@ -7,6 +7,12 @@ $(call add-objs,fd_builtin_programs,fd_flamenco)
 
 $(call add-hdrs,fd_bpf_loader_serialization.h)
 $(call add-objs,fd_bpf_loader_serialization,fd_flamenco)
+ifdef FD_HAS_HOSTED
+ifdef FD_HAS_SECP256K1
+$(call make-unit-test,test_bpf_loader_serialization,test_bpf_loader_serialization,fd_flamenco fd_funk fd_ballet fd_util,$(SECP256K1_LIBS))
+$(call run-unit-test,test_bpf_loader_serialization)
+endif
+endif
 
 $(call add-hdrs,fd_bpf_program_util.h)
 $(call add-objs,fd_bpf_program_util,fd_flamenco)
@@ -475,16 +475,17 @@ fd_bpf_execute( fd_exec_instr_ctx_t * instr_ctx, fd_sbpf_validated_program_t * p
   fd_vm_acc_region_meta_t acc_region_metas[256]   = {0}; /* instr acc idx to idx */
   uint                    input_mem_regions_cnt   = 0U;
   int                     direct_mapping          = FD_FEATURE_ACTIVE( instr_ctx->slot_ctx, bpf_account_data_direct_mapping );
+  int                     account_data            = direct_mapping ? FD_BPF_LOADER_ACCOUNT_DATA_DIRECT : FD_BPF_LOADER_ACCOUNT_DATA_COW;
 
   uchar * input = NULL;
   if( FD_UNLIKELY( is_deprecated ) ) {
     input = fd_bpf_loader_input_serialize_unaligned( *instr_ctx, &input_sz, pre_lens,
                                                      input_mem_regions, &input_mem_regions_cnt,
-                                                     acc_region_metas, !direct_mapping );
+                                                     acc_region_metas, account_data );
   } else {
     input = fd_bpf_loader_input_serialize_aligned( *instr_ctx, &input_sz, pre_lens,
                                                    input_mem_regions, &input_mem_regions_cnt,
-                                                   acc_region_metas, !direct_mapping );
+                                                   acc_region_metas, account_data );
   }
 
   if( FD_UNLIKELY( input==NULL ) ) {
@@ -660,12 +661,14 @@ fd_bpf_execute( fd_exec_instr_ctx_t * instr_ctx, fd_sbpf_validated_program_t * p
 
   int err;
   if( FD_UNLIKELY( is_deprecated ) ) {
-    err = fd_bpf_loader_input_deserialize_unaligned( *instr_ctx, pre_lens, input, input_sz, !direct_mapping );
+    err = fd_bpf_loader_input_deserialize_unaligned( *instr_ctx, pre_lens, input, input_sz,
+                                                     input_mem_regions, acc_region_metas, account_data );
     if( FD_UNLIKELY( err!=0 ) ) {
       return err;
     }
   } else {
-    err = fd_bpf_loader_input_deserialize_aligned( *instr_ctx, pre_lens, input, input_sz, !direct_mapping );
+    err = fd_bpf_loader_input_deserialize_aligned( *instr_ctx, pre_lens, input, input_sz,
+                                                   input_mem_regions, acc_region_metas, account_data );
     if( FD_UNLIKELY( err!=0 ) ) {
       return err;
     }
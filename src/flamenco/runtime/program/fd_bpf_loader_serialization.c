@@ -33,7 +33,16 @@
   also have different write permissions. This should solve the problem of
   having to memcpy/memcmp account data regions (which can be up to 10MiB each).
   There is some nuance to this, as the account data can be resized. This means
-  that memcpys for account data regions can't totally be avoided. */
+  that memcpys for account data regions can't totally be avoided.
+
+  When direct mapping is not active, the copies can still be deferred without
+  changing what the program observes (FD_BPF_LOADER_ACCOUNT_DATA_COW). The
+  layout of the buffer is unchanged (each account still has a slot for its
+  data in the buffer) but the slot is not filled in. Instead, the account
+  data is mapped in place as its own memory region which gets copied into
+  its slot the first time the program writes to it. On deserialize, account
+  data that was never written is left alone and only the range of bytes that
+  was written is copied back (or compared for accounts that can't change). */
 
 /* Add a new memory region to represent the input region. All of the memory
    regions here have sorted virtual addresses. These regions may or may not
@@ -56,6 +65,10 @@ new_input_mem_region( fd_vm_input_region_t * input_mem_regions,
   input_mem_regions[ *input_mem_regions_cnt ].region_sz    = (uint)region_sz;
   input_mem_regions[ *input_mem_regions_cnt ].vaddr_offset = vaddr_offset;
   input_mem_regions[ *input_mem_regions_cnt ].is_acct_data = is_acct_data;
+  input_mem_regions[ *input_mem_regions_cnt ].cow_haddr    = 0UL;
+  input_mem_regions[ *input_mem_regions_cnt ].dirty_lo     = 0U;
+  input_mem_regions[ *input_mem_regions_cnt ].dirty_hi     = 0U;
+  input_mem_regions[ *input_mem_regions_cnt ].is_cow       = 0U;
   (*input_mem_regions_cnt)++;
 }
 
@@ -84,9 +97,30 @@ write_account( fd_exec_instr_ctx_t *     instr_ctx,
   ulong         dlen = account ? account->const_meta->dlen : 0UL;
 
   if( copy_account_data ) {
-    /* Copy the account data into input region buffer */
-    fd_memcpy( *serialized_params, data, dlen );
-    *serialized_params += dlen;
+    if( copy_account_data==FD_BPF_LOADER_ACCOUNT_DATA_COW && dlen ) {
+      /* Close the region for everything serialized since the previous
+         account data region and map the account data in place. The
+         account data's slot in the input region buffer is left
+         uninitialized until the program writes into the region. */
+      ulong region_sz = (ulong)(*serialized_params) - (ulong)(*serialized_params_start);
+      new_input_mem_region( input_mem_regions, input_mem_regions_cnt, *serialized_params_start, region_sz, 1U, 0U );
+
+      acc_region_metas[instr_acc_idx].region_idx          = *input_mem_regions_cnt;
+      acc_region_metas[instr_acc_idx].has_data_region     = 1U;
+      acc_region_metas[instr_acc_idx].has_resizing_region = 0U;
+
+      fd_vm_input_region_t * region = &input_mem_regions[ *input_mem_regions_cnt ];
+      new_input_mem_region( input_mem_regions, input_mem_regions_cnt, data, dlen, 1U, 1U );
+      region->cow_haddr = (ulong)(*serialized_params);
+      region->is_cow    = 1U;
+
+      *serialized_params      += dlen;
+      *serialized_params_start = *serialized_params;
+    } else {
+      /* Copy the account data into input region buffer */
+      fd_memcpy( *serialized_params, data, dlen );
+      *serialized_params += dlen;
+    }
 
     if( FD_LIKELY( is_aligned ) ) {
       /* Zero out padding bytes and max permitted data increase */
@@ -144,6 +178,40 @@ write_account( fd_exec_instr_ctx_t *     instr_ctx,
   }
 }
 
+/* deserialize_cow_account handles the account data of an account that
+   was serialized with FD_BPF_LOADER_ACCOUNT_DATA_COW whose length did
+   not change. region is the account's data region. The data in region
+   only differs from the account data in the dirty range of the region,
+   so this does the same as deserializing the full data but only touches
+   the dirty range. */
+static int
+deserialize_cow_account( fd_exec_instr_ctx_t *        ctx,
+                         ulong                        instr_acc_idx,
+                         fd_borrowed_account_t *      view_acc,
+                         fd_vm_input_region_t const * region ) {
+  if( region->dirty_hi<=region->dirty_lo ) {
+    return FD_EXECUTOR_INSTR_SUCCESS;
+  }
+
+  uchar const * dirty    = (uchar const *)region->haddr + region->dirty_lo;
+  ulong         dirty_sz = (ulong)( region->dirty_hi - region->dirty_lo );
+
+  int err = 0;
+  if( fd_account_can_data_be_resized( ctx, view_acc->const_meta, view_acc->const_meta->dlen, &err ) &&
+      fd_account_can_data_be_changed( ctx, instr_acc_idx, &err ) ) {
+    uchar * acc_data = NULL;
+    ulong   acc_dlen = 0UL;
+    err = fd_account_get_data_mut( ctx, instr_acc_idx, &acc_data, &acc_dlen );
+    if( FD_UNLIKELY( err ) ) {
+      return err;
+    }
+    fd_memcpy( acc_data+region->dirty_lo, dirty, dirty_sz );
+  } else if( FD_UNLIKELY( memcmp( view_acc->const_data+region->dirty_lo, dirty, dirty_sz ) ) ) {
+    return err;
+  }
+  return FD_EXECUTOR_INSTR_SUCCESS;
+}
+
 uchar *
 fd_bpf_loader_input_serialize_aligned( fd_exec_instr_ctx_t       ctx,
                                        ulong *                   sz,
@@ -307,11 +375,13 @@ fd_bpf_loader_input_serialize_aligned( fd_exec_instr_ctx_t       ctx,
 
 /* https://github.com/anza-xyz/agave/blob/b5f5c3cdd3f9a5859c49ebc27221dc27e143d760/programs/bpf_loader/src/serialization.rs#L500-L603 */
 int
-fd_bpf_loader_input_deserialize_aligned( fd_exec_instr_ctx_t ctx,
-                                         ulong const *       pre_lens,
-                                         uchar *             buffer,
-                                         ulong FD_FN_UNUSED  buffer_sz,
-                                         int                 copy_account_data ) {
+fd_bpf_loader_input_deserialize_aligned( fd_exec_instr_ctx_t             ctx,
+                                         ulong const *                   pre_lens,
+                                         uchar *                         buffer,
+                                         ulong FD_FN_UNUSED              buffer_sz,
+                                         fd_vm_input_region_t *          input_mem_regions,
+                                         fd_vm_acc_region_meta_t const * acc_region_metas,
+                                         int                             copy_account_data ) {
   /* TODO: An optimization would be to skip ahead through non-writable accounts */
   /* https://github.com/anza-xyz/agave/blob/b5f5c3cdd3f9a5859c49ebc27221dc27e143d760/programs/bpf_loader/src/serialization.rs#L507 */
   ulong start = 0UL;
@@ -367,7 +437,21 @@ fd_bpf_loader_input_deserialize_aligned( fd_exec_instr_ctx_t ctx,
         return FD_EXECUTOR_INSTR_ERR_INVALID_REALLOC;
       }
 
-      if( copy_account_data ) {
+      int is_cow = copy_account_data==FD_BPF_LOADER_ACCOUNT_DATA_COW && acc_region_metas[i].has_data_region;
+
+      if( is_cow && post_len==pre_len && view_acc->const_meta->dlen==pre_len ) {
+        /* Account data mapped copy on write that was not resized */
+        int err = deserialize_cow_account( &ctx, i, view_acc, &input_mem_regions[ acc_region_metas[i].region_idx ] );
+        if( FD_UNLIKELY( err ) ) {
+          return err;
+        }
+        start += pre_len;
+      } else if( copy_account_data ) {
+        if( is_cow && input_mem_regions[ acc_region_metas[i].region_idx ].cow_haddr ) {
+          /* The account got resized, the full data is needed in the buffer */
+          fd_vm_input_region_cow_copy( &input_mem_regions[ acc_region_metas[i].region_idx ] );
+        }
+
         /* https://github.com/anza-xyz/agave/blob/b5f5c3cdd3f9a5859c49ebc27221dc27e143d760/programs/bpf_loader/src/serialization.rs#L551-563 */
         int err = 0;
         if( fd_account_can_data_be_resized( &ctx, view_acc->const_meta, post_len, &err ) &&
@@ -572,11 +656,13 @@ fd_bpf_loader_input_serialize_unaligned( fd_exec_instr_ctx_t       ctx,
 }
 
 int
-fd_bpf_loader_input_deserialize_unaligned( fd_exec_instr_ctx_t ctx,
-                                           ulong const *       pre_lens,
-                                           uchar *             input,
-                                           ulong               input_sz,
-                                           int                 copy_account_data ) {
+fd_bpf_loader_input_deserialize_unaligned( fd_exec_instr_ctx_t             ctx,
+                                           ulong const *                   pre_lens,
+                                           uchar *                         input,
+                                           ulong                           input_sz,
+                                           fd_vm_input_region_t *          input_mem_regions,
+                                           fd_vm_acc_region_meta_t const * acc_region_metas,
+                                           int                             copy_account_data ) {
   uchar * input_cursor = input;
 
   uchar acc_idx_seen[256] = {0};
@@ -613,7 +699,17 @@ fd_bpf_loader_input_deserialize_unaligned( fd_exec_instr_ctx_t ctx,
       if( copy_account_data ) {
         ulong   pre_len   = pre_lens[i];
         uchar * post_data = input_cursor;
-        if( view_acc->const_meta ) {
+        int is_cow = copy_account_data==FD_BPF_LOADER_ACCOUNT_DATA_COW && acc_region_metas[i].has_data_region;
+        if( is_cow && view_acc->const_meta && view_acc->const_meta->dlen==pre_len ) {
+          /* Account data mapped copy on write that was not resized */
+          int err = deserialize_cow_account( &ctx, i, view_acc, &input_mem_regions[ acc_region_metas[i].region_idx ] );
+          if( FD_UNLIKELY( err ) ) {
+            return err;
+          }
+        } else if( view_acc->const_meta ) {
+          if( is_cow && input_mem_regions[ acc_region_metas[i].region_idx ].cow_haddr ) {
+            fd_vm_input_region_cow_copy( &input_mem_regions[ acc_region_metas[i].region_idx ] );
+          }
           int err = 0;
           if( fd_account_can_data_be_resized( &ctx, view_acc->const_meta, pre_len, &err ) &&
               fd_account_can_data_be_changed( &ctx, i, &err ) ) {
@@ -6,6 +6,20 @@
 
 #define FD_NON_DUP_MARKER           (0xFF   )
 
+/* FD_BPF_LOADER_ACCOUNT_DATA_* give the ways account data can be mapped
+   into the input region (the copy_account_data argument below).  With
+   DIRECT, account data is mapped in place (direct mapping is active).
+   With COPY, account data is copied into the serialization buffer and
+   copied back out on deserialize.  With COW, account data is mapped in
+   place read-only and copied into the serialization buffer only if the
+   program writes into it, and only the written bytes are copied back
+   out on deserialize (see fd_vm_input_region_t).  COPY and COW produce
+   identical input regions from the point of view of a program. */
+
+#define FD_BPF_LOADER_ACCOUNT_DATA_DIRECT (0)
+#define FD_BPF_LOADER_ACCOUNT_DATA_COPY   (1)
+#define FD_BPF_LOADER_ACCOUNT_DATA_COW    (2)
+
 FD_PROTOTYPES_BEGIN
 
 uchar *
@@ -17,12 +31,18 @@ fd_bpf_loader_input_serialize_aligned( fd_exec_instr_ctx_t       ctx,
                                        fd_vm_acc_region_meta_t * acc_region_metas,
                                        int                       copy_account_data );
 
+/* fd_bpf_loader_input_deserialize_{aligned,unaligned} take the same
+   input_mem_regions and acc_region_metas as the corresponding serialize
+   (only used if copy_account_data is FD_BPF_LOADER_ACCOUNT_DATA_COW). */
+
 int
-fd_bpf_loader_input_deserialize_aligned( fd_exec_instr_ctx_t ctx, 
-                                         ulong const *       pre_lens,
-                                         uchar *             buffer,
-                                         ulong               buffer_sz,
-                                         int                 copy_account_data );
+fd_bpf_loader_input_deserialize_aligned( fd_exec_instr_ctx_t             ctx, 
+                                         ulong const *                   pre_lens,
+                                         uchar *                         buffer,
+                                         ulong                           buffer_sz,
+                                         fd_vm_input_region_t *          input_mem_regions,
+                                         fd_vm_acc_region_meta_t const * acc_region_metas,
+                                         int                             copy_account_data );
 
 uchar *
 fd_bpf_loader_input_serialize_unaligned( fd_exec_instr_ctx_t       ctx,
@@ -34,11 +54,13 @@ fd_bpf_loader_input_serialize_unaligned( fd_exec_instr_ctx_t       ctx,
                                          int                       copy_account_data );
 
 int
-fd_bpf_loader_input_deserialize_unaligned( fd_exec_instr_ctx_t ctx,
-                                           ulong const *       pre_lens,
-                                           uchar *             input,
-                                           ulong               input_sz,
-                                           int                 copy_account_data );
+fd_bpf_loader_input_deserialize_unaligned( fd_exec_instr_ctx_t             ctx,
+                                           ulong const *                   pre_lens,
+                                           uchar *                         input,
+                                           ulong                           input_sz,
+                                           fd_vm_input_region_t *          input_mem_regions,
+                                           fd_vm_acc_region_meta_t const * acc_region_metas,
+                                           int                             copy_account_data );
 
 
 FD_PROTOTYPES_END
@@ -143,22 +143,31 @@ from_vote_state_1_14_11( fd_vote_state_t *         vote_state,
 /* impl VoteAccount                                                   */
 /**********************************************************************/
 
+/* get_state decodes the vote state of self into a single region
+   allocated from spad (see FD_BINCODE_ARENA_ALIGN).  *versioned is a
+   copy of the decoded root; its votes, authorized voters, epoch
+   credits, etc. live in the spad region, which is released with the
+   spad frame of the instruction. */
+
 // https://github.com/anza-xyz/agave/blob/v2.0.1/programs/vote/src/vote_state/mod.rs#L1074
 static int
 get_state( fd_borrowed_account_t const * self,
-           fd_valloc_t                   valloc,
+           fd_spad_t *                   spad,
            fd_vote_state_versioned_t *   versioned /* out */ ) {
   int rc;
 
   fd_bincode_decode_ctx_t decode_ctx;
   decode_ctx.data    = self->const_data;
   decode_ctx.dataend = &self->const_data[self->const_meta->dlen];
-  decode_ctx.valloc  = valloc;
 
-  rc = fd_vote_state_versioned_decode( versioned, &decode_ctx );
+  ulong total_sz = 0UL;
+  rc = fd_vote_state_versioned_decode_footprint( &decode_ctx, &total_sz );
   if( FD_UNLIKELY( rc != FD_BINCODE_SUCCESS ) )
     return FD_EXECUTOR_INSTR_ERR_INVALID_ACC_DATA;
 
+  void * mem = fd_spad_alloc( spad, FD_BINCODE_ARENA_ALIGN, total_sz );
+  *versioned = *fd_vote_state_versioned_decode_inner( mem, &decode_ctx );
+
   return FD_EXECUTOR_INSTR_SUCCESS;
 }
 
@@ -1462,7 +1471,7 @@ authorize( ulong                         vote_acct_idx,
 
   // https://github.com/anza-xyz/agave/blob/v2.0.1/programs/vote/src/vote_state/mod.rs#L857
   fd_vote_state_versioned_t vote_state_versioned;
-  rc = get_state( vote_account, valloc, &vote_state_versioned );
+  rc = get_state( vote_account, ctx->txn_ctx->spad, &vote_state_versioned );
   if( FD_UNLIKELY( rc ) ) return rc;
   convert_to_current( &vote_state_versioned, valloc );
   fd_vote_state_t * vote_state = &vote_state_versioned.inner.current;
@@ -1518,7 +1527,7 @@ update_validator_identity( ulong                       vote_acct_idx,
 
   // https://github.com/anza-xyz/agave/blob/v2.0.1/programs/vote/src/vote_state/mod.rs#L900
   fd_vote_state_versioned_t vote_state_versioned;
-  rc = get_state( vote_account, valloc, &vote_state_versioned );
+  rc = get_state( vote_account, ctx->txn_ctx->spad, &vote_state_versioned );
   if( FD_UNLIKELY( rc ) ) return rc;
   convert_to_current( &vote_state_versioned, valloc );
   fd_vote_state_t * vote_state = &vote_state_versioned.inner.current;
@@ -1570,7 +1579,7 @@ update_commission( ulong                       vote_acct_idx,
   // https://github.com/anza-xyz/agave/blob/v2.0.1/programs/vote/src/vote_state/mod.rs#L927
   int enforce_commission_update_rule = 1;
   if (FD_FEATURE_ACTIVE( ctx->slot_ctx, allow_commission_decrease_at_any_time )) {
-    rc = get_state( vote_account, valloc, &vote_state_versioned );
+    rc = get_state( vote_account, ctx->txn_ctx->spad, &vote_state_versioned );
     if ( FD_LIKELY( rc==FD_EXECUTOR_INSTR_SUCCESS ) ) {
       convert_to_current( &vote_state_versioned, valloc );
       vote_state = &vote_state_versioned.inner.current;
@@ -1589,7 +1598,7 @@ update_commission( ulong                       vote_acct_idx,
 
   // https://github.com/anza-xyz/agave/blob/v2.0.1/programs/vote/src/vote_state/mod.rs#L949
   if (NULL == vote_state) {
-    rc = get_state( vote_account, valloc, &vote_state_versioned );
+    rc = get_state( vote_account, ctx->txn_ctx->spad, &vote_state_versioned );
     if( FD_UNLIKELY( rc ) ) return rc;
     convert_to_current( &vote_state_versioned, valloc );
     vote_state = &vote_state_versioned.inner.current;
@@ -1626,7 +1635,7 @@ withdraw(
 
   // https://github.com/anza-xyz/agave/blob/v2.0.1/programs/vote/src/vote_state/mod.rs#L1010
   fd_vote_state_versioned_t vote_state_versioned;
-  rc = get_state( vote_account, valloc, &vote_state_versioned );
+  rc = get_state( vote_account, ctx->txn_ctx->spad, &vote_state_versioned );
   if( FD_UNLIKELY( rc ) ) return rc;
   convert_to_current( &vote_state_versioned, valloc );
   fd_vote_state_t * vote_state = &vote_state_versioned.inner.current;
@@ -1784,7 +1793,7 @@ initialize_account( ulong                         vote_acct_idx,
 
   // https://github.com/anza-xyz/agave/blob/v2.0.1/programs/vote/src/vote_state/mod.rs#L1074
   fd_vote_state_versioned_t versioned;
-  rc = get_state( vote_account, valloc, &versioned );
+  rc = get_state( vote_account, ctx->txn_ctx->spad, &versioned );
   if( FD_UNLIKELY( rc ) ) return rc;
 
   // https://github.com/anza-xyz/agave/blob/v2.0.1/programs/vote/src/vote_state/mod.rs#L1076
@@ -1823,7 +1832,7 @@ verify_and_get_vote_state( fd_borrowed_account_t *       vote_account,
   fd_valloc_t valloc = fd_spad_virtual( ctx->txn_ctx->spad );
 
   // https://github.com/anza-xyz/agave/blob/v2.0.1/programs/vote/src/vote_state/mod.rs#L1091
-  rc = get_state( vote_account, valloc, &versioned );
+  rc = get_state( vote_account, ctx->txn_ctx->spad, &versioned );
   if( FD_UNLIKELY( rc ) ) return rc;
 
   // https://github.com/anza-xyz/agave/blob/v2.0.1/programs/vote/src/vote_state/mod.rs#L1093
@@ -2201,7 +2210,7 @@ fd_vote_acc_credits( fd_exec_instr_ctx_t const * ctx,
 
   rc = 0;
   fd_vote_state_versioned_t vote_state_versioned;
-  rc = get_state( &vote_account, valloc, &vote_state_versioned );
+  rc = get_state( &vote_account, ctx->txn_ctx->spad, &vote_state_versioned );
   if( FD_UNLIKELY( rc ) ) return rc;
   convert_to_current( &vote_state_versioned, valloc );
   fd_vote_state_t * state = &vote_state_versioned.inner.current;
@@ -2838,9 +2847,9 @@ fd_vote_program_execute( fd_exec_instr_ctx_t * ctx ) {
 
 int
 fd_vote_get_state( fd_borrowed_account_t const * self,
-                   fd_valloc_t                   valloc,
+                   fd_spad_t *                   spad,
                    fd_vote_state_versioned_t *   versioned /* out */ ) {
-  return get_state( self, valloc, versioned );
+  return get_state( self, spad, versioned );
 }
 
 void
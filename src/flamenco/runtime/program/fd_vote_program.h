@@ -51,9 +51,13 @@ fd_vote_program_execute( fd_exec_instr_ctx_t * ctx );
 ulong
 fd_query_pubkey_stake( fd_pubkey_t const * pubkey, fd_vote_accounts_t const * vote_accounts );
 
+/* fd_vote_get_state decodes the vote state of self into *versioned.
+   The dynamic members of the state are allocated in a single region
+   from spad and are valid until the current spad frame is popped. */
+
 int
 fd_vote_get_state( fd_borrowed_account_t const * self,
-                   fd_valloc_t                   valloc,
+                   fd_spad_t *                   spad,
                    fd_vote_state_versioned_t *   versioned /* out */ );
 
 void
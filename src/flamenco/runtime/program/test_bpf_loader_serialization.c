@@ -0,0 +1,320 @@
+#include "fd_bpf_loader_serialization.h"
+#include "../fd_account.h"
+#include "../fd_runtime.h"
+#include "../context/fd_exec_txn_ctx.h"
+#include "../../vm/fd_vm_private.h"
+#include "../../vm/test_vm_util.h"
+
+/* Round trips instructions through serialize, a simulated program
+   execution (writes translated by fd_vm_find_input_mem_region like the
+   interpreter does) and deserialize, with account data mapped copy on
+   write, and checks the accounts end up as with the account data
+   copied.
+
+   Instruction accounts:
+     0 writable, owned by the program
+     1 writable, owned by the program
+     2 read-only, owned by the program
+     3 writable, owned by another program
+     4 duplicate of 0 */
+
+#define TEST_ACCT_CNT       (4UL)
+#define TEST_INSTR_ACCT_CNT (5UL)
+#define TEST_ACCT_DATA_MAX  (1024UL+MAX_PERMITTED_DATA_INCREASE)
+#define TEST_SPAD_MAX       (1UL<<20)
+
+static ulong const test_acct_dlen[ TEST_ACCT_CNT ] = { 300UL, 200UL, 100UL, 50UL };
+
+static uchar                 acct_mem[ TEST_ACCT_CNT ][ sizeof(fd_account_meta_t)+TEST_ACCT_DATA_MAX ] __attribute__((aligned(8UL)));
+static fd_borrowed_account_t acct    [ TEST_ACCT_CNT ];
+static uchar                 instr_data[ 8UL ] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+static uchar                 spad_mem[ FD_SPAD_FOOTPRINT( TEST_SPAD_MAX ) ] __attribute__((aligned(FD_SPAD_ALIGN)));
+static fd_vm_t               vm[1];
+
+static fd_pubkey_t const program_id  = { .uc = { 0xaa } };
+static fd_pubkey_t const other_owner = { .uc = { 0xbb } };
+
+static void
+test_accts_reset( void ) {
+  for( ulong i=0UL; i<TEST_ACCT_CNT; i++ ) {
+    fd_account_meta_t * meta = (fd_account_meta_t *)acct_mem[ i ];
+    uchar *             data = acct_mem[ i ] + sizeof(fd_account_meta_t);
+    fd_account_meta_init( meta );
+    meta->dlen            = test_acct_dlen[ i ];
+    meta->info.lamports   = 1000UL+i;
+    meta->info.rent_epoch = ULONG_MAX;
+    memcpy( meta->info.owner, i==3UL ? &other_owner : &program_id, sizeof(fd_pubkey_t) );
+    for( ulong j=0UL; j<TEST_ACCT_DATA_MAX; j++ ) data[ j ] = (uchar)( j<meta->dlen ? 16UL*i+j : 0UL );
+
+    fd_borrowed_account_init( &acct[ i ] );
+    acct[ i ].pubkey[0]  = (fd_pubkey_t){ .uc = { (uchar)(i+1UL) } };
+    acct[ i ].const_meta = acct[ i ].meta = meta;
+    acct[ i ].const_data = acct[ i ].data = data;
+  }
+}
+
+static void
+test_instr_init( fd_exec_instr_ctx_t * ctx,
+                 fd_instr_info_t *     instr,
+                 fd_spad_t *           spad ) {
+  fd_exec_txn_ctx_t * txn_ctx = ctx->txn_ctx;
+  txn_ctx->spad                  = spad;
+  txn_ctx->accounts_resize_delta = 0UL;
+  txn_ctx->accounts_cnt          = TEST_ACCT_CNT+1UL;
+  for( ulong i=0UL; i<TEST_ACCT_CNT; i++ ) txn_ctx->accounts[ i ] = acct[ i ].pubkey[0];
+  txn_ctx->accounts[ TEST_ACCT_CNT ] = program_id;
+
+  memset( instr, 0, sizeof(fd_instr_info_t) );
+  instr->program_id        = (uchar)TEST_ACCT_CNT;
+  instr->program_id_pubkey = program_id;
+  instr->data              = instr_data;
+  instr->data_sz           = (ushort)sizeof(instr_data);
+  instr->acct_cnt          = (ushort)TEST_INSTR_ACCT_CNT;
+  for( ulong i=0UL; i<TEST_INSTR_ACCT_CNT; i++ ) {
+    ulong txn_idx = i<TEST_ACCT_CNT ? i : 0UL;
+    instr->acct_txn_idxs    [ i ] = (uchar)txn_idx;
+    instr->acct_flags       [ i ] = txn_idx==2UL ? 0 : FD_INSTR_ACCT_FLAGS_IS_WRITABLE;
+    instr->acct_pubkeys     [ i ] = acct[ txn_idx ].pubkey[0];
+    instr->is_duplicate     [ i ] = i>=TEST_ACCT_CNT;
+    instr->borrowed_accounts[ i ] = &acct[ txn_idx ];
+  }
+  ctx->instr = instr;
+}
+
+/* test_serialize serializes the instruction and points vm at the
+   resulting input region. */
+
+static uchar *
+test_serialize( fd_exec_instr_ctx_t *     ctx,
+                int                       is_aligned,
+                int                       copy_account_data,
+                ulong *                   sz,
+                ulong *                   pre_lens,
+                fd_vm_input_region_t *    regions,
+                fd_vm_acc_region_meta_t * metas ) {
+  uint region_cnt = 0U;
+  uchar * input = is_aligned ?
+    fd_bpf_loader_input_serialize_aligned  ( *ctx, sz, pre_lens, regions, &region_cnt, metas, copy_account_data ) :
+    fd_bpf_loader_input_serialize_unaligned( *ctx, sz, pre_lens, regions, &region_cnt, metas, copy_account_data );
+  FD_TEST( input );
+  if( copy_account_data==FD_BPF_LOADER_ACCOUNT_DATA_COW ) FD_TEST( region_cnt==TEST_ACCT_CNT*2UL+1UL );
+  else                                                    FD_TEST( region_cnt==1U                   );
+  vm->input_mem_regions     = regions;
+  vm->input_mem_regions_cnt = region_cnt;
+  return input;
+}
+
+static int
+test_deserialize( fd_exec_instr_ctx_t *           ctx,
+                  int                             is_aligned,
+                  int                             copy_account_data,
+                  uchar *                         input,
+                  ulong                           sz,
+                  ulong const *                   pre_lens,
+                  fd_vm_input_region_t *          regions,
+                  fd_vm_acc_region_meta_t const * metas ) {
+  return is_aligned ?
+    fd_bpf_loader_input_deserialize_aligned  ( *ctx, pre_lens, input, sz, regions, metas, copy_account_data ) :
+    fd_bpf_loader_input_deserialize_unaligned( *ctx, pre_lens, input, sz, regions, metas, copy_account_data );
+}
+
+/* test_{data,dlen}_off return the input region offset of the data and
+   of the data length of the account at instruction index i. */
+
+static ulong
+test_data_off( fd_vm_acc_region_meta_t const * metas,
+               int                             is_aligned,
+               ulong                           i ) {
+  return metas[ i ].metadata_region_offset + ( is_aligned ? 88UL : 51UL );
+}
+
+static ulong
+test_dlen_off( fd_vm_acc_region_meta_t const * metas,
+               int                             is_aligned,
+               ulong                           i ) {
+  return test_data_off( metas, is_aligned, i ) - sizeof(ulong);
+}
+
+/* test_prog_write does a program write of sz bytes at input region
+   offset off. */
+
+static void
+test_prog_write( ulong        off,
+                 void const * src,
+                 ulong        sz ) {
+  uchar is_multi = 0;
+  ulong haddr = fd_vm_find_input_mem_region( vm, off, sz, 1, 0UL, &is_multi );
+  FD_TEST( haddr );
+  memcpy( (void *)haddr, src, sz );
+}
+
+static void
+test_write_back( fd_exec_instr_ctx_t * ctx,
+                 int                   is_aligned ) {
+  ulong                   pre_lens[ TEST_INSTR_ACCT_CNT ];
+  fd_vm_input_region_t    regions [ 64 ];
+  fd_vm_acc_region_meta_t metas   [ TEST_INSTR_ACCT_CNT ];
+  ulong                   sz;
+
+  static uchar const patch_a[ 10 ] = { 0xde, 0xad, 0xbe, 0xef, 0xde, 0xad, 0xbe, 0xef, 0xde, 0xad };
+  static uchar const patch_b[  2 ] = { 0x55, 0x66 };
+
+  /* Copy on write */
+
+  test_accts_reset();
+  fd_spad_push( ctx->txn_ctx->spad );
+  uchar * input = test_serialize( ctx, is_aligned, FD_BPF_LOADER_ACCOUNT_DATA_COW, &sz, pre_lens, regions, metas );
+
+  /* Reads are served from the account data in place */
+  uchar is_multi = 0;
+  FD_TEST( fd_vm_find_input_mem_region( vm, test_data_off( metas, is_aligned, 1UL )+8UL, 4UL, 0, 0UL, &is_multi )==
+           (ulong)acct[ 1 ].const_data+8UL );
+
+  test_prog_write( test_data_off( metas, is_aligned, 0UL )+10UL, patch_a, sizeof(patch_a) );
+  test_prog_write( test_data_off( metas, is_aligned, 0UL )+40UL, patch_b, sizeof(patch_b) );
+
+  fd_vm_input_region_t const * region0 = &regions[ metas[ 0 ].region_idx ];
+  fd_vm_input_region_t const * region1 = &regions[ metas[ 1 ].region_idx ];
+  FD_TEST( !region0->cow_haddr && region0->dirty_lo==10U && region0->dirty_hi==42U );
+  FD_TEST(  region1->cow_haddr && region1->dirty_hi<=region1->dirty_lo             );
+  FD_TEST( acct[ 0 ].const_data[ 10 ]==(uchar)10 ); /* account data untouched during execution */
+
+  FD_TEST( test_deserialize( ctx, is_aligned, FD_BPF_LOADER_ACCOUNT_DATA_COW, input, sz, pre_lens, regions, metas )==FD_EXECUTOR_INSTR_SUCCESS );
+  fd_spad_pop( ctx->txn_ctx->spad );
+
+  static uchar cow_mem[ TEST_ACCT_CNT ][ sizeof(fd_account_meta_t)+TEST_ACCT_DATA_MAX ];
+  memcpy( cow_mem, acct_mem, sizeof(acct_mem) );
+
+  FD_TEST( !memcmp( acct[ 0 ].const_data+10UL, patch_a, sizeof(patch_a) ) );
+  FD_TEST( !memcmp( acct[ 0 ].const_data+40UL, patch_b, sizeof(patch_b) ) );
+  FD_TEST( acct[ 0 ].const_data[  9 ]==(uchar) 9 && acct[ 0 ].const_data[ 20 ]==(uchar)20 );
+  FD_TEST( acct[ 0 ].const_data[ 42 ]==(uchar)42 && acct[ 0 ].const_meta->dlen==test_acct_dlen[ 0 ] );
+
+  /* Copy, with the same program writes */
+
+  test_accts_reset();
+  fd_spad_push( ctx->txn_ctx->spad );
+  input = test_serialize( ctx, is_aligned, FD_BPF_LOADER_ACCOUNT_DATA_COPY, &sz, pre_lens, regions, metas );
+  test_prog_write( test_data_off( metas, is_aligned, 0UL )+10UL, patch_a, sizeof(patch_a) );
+  test_prog_write( test_data_off( metas, is_aligned, 0UL )+40UL, patch_b, sizeof(patch_b) );
+  FD_TEST( test_deserialize( ctx, is_aligned, FD_BPF_LOADER_ACCOUNT_DATA_COPY, input, sz, pre_lens, regions, metas )==FD_EXECUTOR_INSTR_SUCCESS );
+  fd_spad_pop( ctx->txn_ctx->spad );
+
+  FD_TEST( !memcmp( cow_mem, acct_mem, sizeof(acct_mem) ) );
+}
+
+static void
+test_readonly( fd_exec_instr_ctx_t * ctx,
+               int                   is_aligned ) {
+  ulong                   pre_lens[ TEST_INSTR_ACCT_CNT ];
+  fd_vm_input_region_t    regions [ 64 ];
+  fd_vm_acc_region_meta_t metas   [ TEST_INSTR_ACCT_CNT ];
+  ulong                   sz;
+
+  static uchar const patch[ 4 ] = { 0x01, 0x02, 0x03, 0x04 };
+
+  /* Accounts that can't change: read-only and owned by another program */
+
+  static ulong const idx[ 2 ] = { 2UL, 3UL };
+  static int   const exp[ 2 ] = { FD_EXECUTOR_INSTR_ERR_READONLY_DATA_MODIFIED, FD_EXECUTOR_INSTR_ERR_EXTERNAL_DATA_MODIFIED };
+
+  for( ulong j=0UL; j<2UL; j++ ) {
+    for( int mode=FD_BPF_LOADER_ACCOUNT_DATA_COPY; mode<=FD_BPF_LOADER_ACCOUNT_DATA_COW; mode++ ) {
+      test_accts_reset();
+      fd_spad_push( ctx->txn_ctx->spad );
+      uchar * input = test_serialize( ctx, is_aligned, mode, &sz, pre_lens, regions, metas );
+      test_prog_write( test_data_off( metas, is_aligned, idx[ j ] )+20UL, patch, sizeof(patch) );
+      FD_TEST( test_deserialize( ctx, is_aligned, mode, input, sz, pre_lens, regions, metas )==exp[ j ] );
+      fd_spad_pop( ctx->txn_ctx->spad );
+      FD_TEST( acct[ idx[ j ] ].const_data[ 20 ]==(uchar)( 16UL*idx[ j ]+20UL ) );
+    }
+  }
+
+  /* Writing back the bytes that were there is not a modification */
+
+  test_accts_reset();
+  fd_spad_push( ctx->txn_ctx->spad );
+  uchar * input = test_serialize( ctx, is_aligned, FD_BPF_LOADER_ACCOUNT_DATA_COW, &sz, pre_lens, regions, metas );
+  test_prog_write( test_data_off( metas, is_aligned, 2UL )+20UL, acct[ 2 ].const_data+20UL, 8UL );
+  FD_TEST( regions[ metas[ 2 ].region_idx ].dirty_hi>regions[ metas[ 2 ].region_idx ].dirty_lo );
+  FD_TEST( test_deserialize( ctx, is_aligned, FD_BPF_LOADER_ACCOUNT_DATA_COW, input, sz, pre_lens, regions, metas )==FD_EXECUTOR_INSTR_SUCCESS );
+  fd_spad_pop( ctx->txn_ctx->spad );
+}
+
+static void
+test_resize( fd_exec_instr_ctx_t * ctx ) {
+  ulong                   pre_lens[ TEST_INSTR_ACCT_CNT ];
+  fd_vm_input_region_t    regions [ 64 ];
+  fd_vm_acc_region_meta_t metas   [ TEST_INSTR_ACCT_CNT ];
+  ulong                   sz;
+
+  static uchar const patch[ 3 ] = { 0x77, 0x88, 0x99 };
+  static uchar const tail [ 16 ] = { 0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+                                     0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff };
+
+  test_accts_reset();
+  fd_spad_push( ctx->txn_ctx->spad );
+  uchar * input = test_serialize( ctx, 1, FD_BPF_LOADER_ACCOUNT_DATA_COW, &sz, pre_lens, regions, metas );
+
+  /* Account 0 grows by 16 bytes after a write into its data, account 1
+     shrinks by 50 bytes without its data ever being written.  The slot
+     of account 1 in the buffer is left uninitialized by serialize, fill
+     it with junk to check that the fallback copies it in. */
+
+  ulong dlen0 = pre_lens[ 0 ]+sizeof(tail);
+  ulong dlen1 = pre_lens[ 1 ]-50UL;
+  FD_TEST( regions[ metas[ 1 ].region_idx ].cow_haddr );
+  memset( (void *)regions[ metas[ 1 ].region_idx ].cow_haddr, 0xa5, pre_lens[ 1 ] );
+
+  test_prog_write( test_data_off( metas, 1, 0UL )+5UL,           patch,  sizeof(patch) );
+  test_prog_write( test_data_off( metas, 1, 0UL )+pre_lens[ 0 ], tail,   sizeof(tail)  );
+  test_prog_write( test_dlen_off( metas, 1, 0UL ),               &dlen0, sizeof(ulong) );
+  test_prog_write( test_dlen_off( metas, 1, 1UL ),               &dlen1, sizeof(ulong) );
+
+  FD_TEST( test_deserialize( ctx, 1, FD_BPF_LOADER_ACCOUNT_DATA_COW, input, sz, pre_lens, regions, metas )==FD_EXECUTOR_INSTR_SUCCESS );
+  FD_TEST( !regions[ metas[ 1 ].region_idx ].cow_haddr );
+  fd_spad_pop( ctx->txn_ctx->spad );
+
+  FD_TEST( acct[ 0 ].const_meta->dlen==dlen0 );
+  FD_TEST( !memcmp( acct[ 0 ].const_data+5UL,           patch, sizeof(patch) ) );
+  FD_TEST( !memcmp( acct[ 0 ].const_data+pre_lens[ 0 ], tail,  sizeof(tail)  ) );
+  for( ulong j=0UL; j<pre_lens[ 0 ]; j++ ) {
+    if( j>=5UL && j<5UL+sizeof(patch) ) continue;
+    FD_TEST( acct[ 0 ].const_data[ j ]==(uchar)j );
+  }
+
+  FD_TEST( acct[ 1 ].const_meta->dlen==dlen1 );
+  for( ulong j=0UL; j<dlen1; j++ ) FD_TEST( acct[ 1 ].const_data[ j ]==(uchar)( 16UL+j ) );
+
+  FD_TEST( ctx->txn_ctx->accounts_resize_delta==sizeof(tail) ); /* shrinking does not count */
+  ctx->txn_ctx->accounts_resize_delta = 0UL;
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  fd_exec_instr_ctx_t * ctx = test_vm_minimal_exec_instr_ctx( fd_libc_alloc_virtual() );
+  FD_TEST( ctx );
+
+  fd_spad_t * spad = fd_spad_join( fd_spad_new( spad_mem, TEST_SPAD_MAX ) );
+  FD_TEST( spad );
+
+  fd_instr_info_t instr[1];
+  test_accts_reset();
+  test_instr_init( ctx, instr, spad );
+
+  for( int is_aligned=0; is_aligned<2; is_aligned++ ) {
+    test_write_back( ctx, is_aligned );
+    test_readonly  ( ctx, is_aligned );
+  }
+  test_resize( ctx );
+
+  fd_spad_delete( fd_spad_leave( spad ) );
+  test_vm_exec_instr_ctx_delete( ctx, fd_libc_alloc_virtual() );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
@@ -0,0 +1,313 @@
+#include "fd_accounts_hash_cache.h"
+#include "fd_hashes.h"
+#include "fd_acc_mgr.h"
+#include "fd_account.h"
+#include "fd_rent_lists.h"
+
+/* test_accounts_hash_cache checks that fd_accounts_hash_cached yields
+   the same accounts hash and lthash as fd_accounts_hash over a funk
+   whose root is updated slot after slot, feeding the cache the account
+   hashes and lthash deltas of every slot the way
+   fd_update_hash_bank_tpool does, and that it only merges into the
+   partitions holding modified accounts.  This is done with a funk
+   without partitions and with a funk partitioned into rent partitions
+   (which the cache does not depend on). */
+
+static uchar cache_mem[ 1UL<<22 ] __attribute__((aligned(FD_ACCOUNTS_HASH_CACHE_ALIGN)));
+
+static void
+make_pubkey( fd_pubkey_t * pubkey,
+             ulong         idx ) {
+  /* Spread the accounts over the address space */
+  pubkey->ul[0] = fd_ulong_hash( idx );
+  pubkey->ul[1] = idx;
+  pubkey->ul[2] = 0UL;
+  pubkey->ul[3] = 0UL;
+}
+
+/* mark_slot marks the accounts modified by txn, a child of the funk
+   root, in cache: their new account hash and the sum of their new
+   minus root lthash. */
+
+static void
+mark_slot( fd_acc_mgr_t *             acc_mgr,
+           fd_accounts_hash_cache_t * cache,
+           fd_valloc_t                valloc,
+           fd_funk_txn_t *            txn,
+           ulong                      slot ) {
+  fd_funk_t * funk = acc_mgr->funk;
+  fd_wksp_t * wksp = fd_funk_wksp( funk );
+
+  fd_lthash_value_t delta[1]; fd_lthash_zero( delta );
+  for( fd_funk_rec_t const * rec = fd_funk_txn_first_rec( funk, txn ); rec; rec = fd_funk_txn_next_rec( funk, rec ) ) {
+    fd_lthash_value_t lthash[1];
+
+    fd_funk_rec_t const * old = fd_funk_rec_query( funk, NULL, rec->pair.key );
+    if( old ) {
+      fd_account_meta_t const * meta = fd_funk_val_const( old, wksp );
+      if( meta->info.lamports ) {
+        fd_hash_t hash[1];
+        fd_lthash_zero( lthash );
+        fd_hash_account_current( hash->hash, lthash, meta, old->pair.key->uc, (uchar const *)meta + meta->hlen );
+        fd_lthash_sub( delta, lthash );
+      }
+    }
+
+    fd_account_meta_t const * meta = fd_funk_val_const( rec, wksp );
+    fd_hash_t                 hash[1];
+    int                       has_pair = 0;
+    if( meta->info.lamports ) {
+      fd_lthash_zero( lthash );
+      fd_hash_account_current( hash->hash, lthash, meta, rec->pair.key->uc, (uchar const *)meta + meta->hlen );
+      fd_lthash_add( delta, lthash );
+      has_pair = !( meta->info.executable & ~1 );
+    }
+    fd_accounts_hash_cache_mark( cache, valloc, fd_funk_key_to_acc( rec->pair.key ), has_pair ? hash : NULL, slot );
+  }
+  fd_accounts_hash_cache_mark_lthash( cache, valloc, delta, slot );
+}
+
+/* prepare_slot prepares a transaction for slot that creates or
+   updates upd_cnt random accounts with keys in [0,key_max) and marks
+   them in cache.  apply_slot also publishes it. */
+
+static fd_funk_txn_t *
+prepare_slot( fd_acc_mgr_t *             acc_mgr,
+              fd_accounts_hash_cache_t * cache,
+              fd_valloc_t                valloc,
+              fd_rng_t *                 rng,
+              ulong                      slot,
+              ulong                      key_max,
+              ulong                      upd_cnt ) {
+  fd_funk_t *       funk   = acc_mgr->funk;
+  fd_funk_txn_xid_t xid[1] = {{ .ul = { slot, slot } }};
+  fd_funk_txn_t *   txn    = fd_funk_txn_prepare( funk, NULL, xid, 1 ); FD_TEST( txn );
+
+  for( ulong i=0UL; i<upd_cnt; i++ ) {
+    fd_pubkey_t pubkey[1]; make_pubkey( pubkey, fd_rng_ulong_roll( rng, key_max ) );
+    ulong dlen = fd_rng_ulong_roll( rng, 256UL );
+    int   err  = FD_ACC_MGR_SUCCESS;
+    fd_account_meta_t * meta = fd_acc_mgr_modify_raw( acc_mgr, txn, pubkey, 1, dlen, NULL, NULL, &err );
+    FD_TEST( err==FD_ACC_MGR_SUCCESS && meta );
+    fd_account_meta_init( meta );
+    meta->dlen            = dlen;
+    meta->slot            = slot;
+    meta->info.lamports   = fd_rng_uint_roll( rng, 8U ) ? 1UL+fd_rng_ulong_roll( rng, 1000000UL ) : 0UL;
+    meta->info.executable = (uchar)fd_rng_uint_roll( rng, 2U );
+    meta->info.owner[0]   = (uchar)fd_rng_uint( rng );
+    uchar * data = (uchar *)fd_account_get_data( meta );
+    for( ulong j=0UL; j<dlen; j++ ) data[j] = fd_rng_uchar( rng );
+  }
+
+  mark_slot( acc_mgr, cache, valloc, txn, slot );
+  return txn;
+}
+
+static void
+apply_slot( fd_acc_mgr_t *             acc_mgr,
+            fd_accounts_hash_cache_t * cache,
+            fd_valloc_t                valloc,
+            fd_rng_t *                 rng,
+            ulong                      slot,
+            ulong                      key_max,
+            ulong                      upd_cnt ) {
+  fd_funk_txn_t * txn = prepare_slot( acc_mgr, cache, valloc, rng, slot, key_max, upd_cnt );
+  FD_TEST( fd_funk_txn_publish( acc_mgr->funk, txn, 1 )==1UL );
+}
+
+static void
+check_hash( fd_acc_mgr_t *             acc_mgr,
+            fd_accounts_hash_cache_t * cache,
+            fd_valloc_t                valloc,
+            fd_tpool_t *               tpool ) {
+  fd_funk_t * funk = acc_mgr->funk;
+
+  static fd_slot_bank_t ref_bank[1];
+  static fd_slot_bank_t test_bank[1];
+  memset( ref_bank,  0, sizeof(fd_slot_bank_t) );
+  memset( test_bank, 0, sizeof(fd_slot_bank_t) );
+
+  fd_hash_t ref_hash[1];
+  fd_hash_t test_hash[1];
+  FD_TEST( !fd_accounts_hash       ( funk,        ref_bank,  valloc, tpool, ref_hash  ) );
+  FD_TEST( !fd_accounts_hash_cached( funk, cache, test_bank, valloc, tpool, test_hash ) );
+
+  FD_TEST( !memcmp( ref_hash, test_hash, sizeof(fd_hash_t) ) );
+  FD_TEST( !memcmp( ref_bank->lthash.lthash, test_bank->lthash.lthash, sizeof(ref_bank->lthash.lthash) ) );
+}
+
+/* test_cache runs the test over a new funk, partitioned into rent_cnt
+   rent partitions if rent_cnt is non-zero. */
+
+static void
+test_cache( fd_wksp_t *  wksp,
+            fd_tpool_t * tpool,
+            fd_rng_t *   rng,
+            ulong        key_max,
+            ulong        slot_cnt,
+            ulong        lg_part_cnt,
+            ulong        rent_cnt ) {
+  FD_LOG_NOTICE(( "Testing with %lu rent partitions", rent_cnt ));
+
+  ulong       wksp_tag = 1234UL;
+  fd_funk_t * funk     = fd_funk_join( fd_funk_new( fd_wksp_alloc_laddr( wksp, fd_funk_align(), fd_funk_footprint(), wksp_tag ),
+                                                    wksp_tag, 0UL, 4UL, 2UL*key_max ) );
+  FD_TEST( funk );
+  fd_funk_start_write( funk );
+
+  fd_alloc_t * alloc  = fd_alloc_join( fd_alloc_new( fd_wksp_alloc_laddr( wksp, fd_alloc_align(), fd_alloc_footprint(), wksp_tag ), wksp_tag ), 0UL );
+  fd_valloc_t  valloc = fd_alloc_virtual( alloc );
+
+  static uchar   acc_mgr_mem[ FD_ACC_MGR_FOOTPRINT ] __attribute__((aligned(FD_ACC_MGR_ALIGN)));
+  fd_acc_mgr_t * acc_mgr = fd_acc_mgr_new( acc_mgr_mem, funk ); FD_TEST( acc_mgr );
+
+  /* Accounts get assigned to their rent partition when modified */
+
+  if( rent_cnt ) {
+    acc_mgr->slots_per_epoch = rent_cnt;
+    acc_mgr->part_width      = fd_rent_partition_width( rent_cnt );
+    fd_funk_set_num_partitions( funk, (uint)rent_cnt );
+  }
+
+  fd_accounts_hash_cache_t * cache = fd_accounts_hash_cache_join( fd_accounts_hash_cache_new( cache_mem, lg_part_cnt ) );
+  FD_TEST( cache );
+  FD_TEST( fd_accounts_hash_cache_part_cnt( cache )==(1UL<<lg_part_cnt) );
+  acc_mgr->hash_cache        = cache;
+  acc_mgr->hash_cache_valloc = valloc;
+
+  /* Partitions are address ranges in address order */
+
+  fd_pubkey_t lo[1]; memset( lo, 0x00, sizeof(fd_pubkey_t) );
+  fd_pubkey_t hi[1]; memset( hi, 0xff, sizeof(fd_pubkey_t) );
+  FD_TEST( fd_accounts_hash_cache_part_idx( cache, lo )==0UL );
+  FD_TEST( fd_accounts_hash_cache_part_idx( cache, hi )==fd_accounts_hash_cache_part_cnt( cache )-1UL );
+
+  /* Empty funk */
+
+  check_hash( acc_mgr, cache, valloc, tpool );
+
+  /* Populate, then update a few accounts per slot.  After the first
+     full hash, only the partitions touched by a slot get merged into. */
+
+  apply_slot( acc_mgr, cache, valloc, rng, 1UL, key_max, key_max );
+  check_hash( acc_mgr, cache, valloc, tpool );
+
+  for( ulong slot=2UL; slot<slot_cnt; slot++ ) {
+    ulong upd_cnt  = fd_rng_ulong_roll( rng, 16UL );
+    ulong miss_cnt = fd_accounts_hash_cache_miss_cnt( cache );
+    ulong hit_cnt  = fd_accounts_hash_cache_hit_cnt ( cache );
+
+    apply_slot( acc_mgr, cache, valloc, rng, slot, key_max, upd_cnt );
+    check_hash( acc_mgr, cache, valloc, tpool );
+
+    ulong slot_miss_cnt = fd_accounts_hash_cache_miss_cnt( cache ) - miss_cnt;
+    FD_TEST( slot_miss_cnt<=upd_cnt );
+    FD_TEST( slot_miss_cnt + fd_accounts_hash_cache_hit_cnt( cache ) - hit_cnt==fd_accounts_hash_cache_part_cnt( cache ) );
+  }
+
+  /* A hash without any modification reuses all partitions */
+
+  ulong miss_cnt = fd_accounts_hash_cache_miss_cnt( cache );
+  check_hash( acc_mgr, cache, valloc, tpool );
+  FD_TEST( fd_accounts_hash_cache_miss_cnt( cache )==miss_cnt );
+
+  /* Records and marks of unpublished transactions (whose records share
+     the rent partitions with the root records) are not part of the
+     hash until published, and publishing merges them */
+
+  fd_funk_txn_t * txn = prepare_slot( acc_mgr, cache, valloc, rng, slot_cnt, key_max, 64UL );
+  check_hash( acc_mgr, cache, valloc, tpool );
+  FD_TEST( fd_funk_txn_publish( funk, txn, 1 )==1UL );
+  check_hash( acc_mgr, cache, valloc, tpool );
+
+  /* A large backlog of rooted updates gets merged on publish (the
+     last update of an account wins) */
+
+  txn = prepare_slot( acc_mgr, cache, valloc, rng, slot_cnt+1UL, key_max, 64UL );
+  do {
+    fd_funk_rec_t const *     rec  = fd_funk_txn_first_rec( funk, txn );
+    fd_account_meta_t const * meta = fd_funk_val_const( rec, fd_funk_wksp( funk ) );
+    fd_hash_t                 hash[1];
+    fd_lthash_value_t         lthash[1];
+    fd_hash_account_current( hash->hash, lthash, meta, rec->pair.key->uc, (uchar const *)meta + meta->hlen );
+    for( ulong i=0UL; i<8192UL; i++ ) {
+      fd_accounts_hash_cache_mark( cache, valloc, fd_funk_key_to_acc( rec->pair.key ), (i&1UL) ? NULL : hash, slot_cnt+1UL );
+    }
+    if( meta->info.lamports && !( meta->info.executable & ~1 ) ) {
+      fd_accounts_hash_cache_mark( cache, valloc, fd_funk_key_to_acc( rec->pair.key ), hash, slot_cnt+1UL );
+    }
+  } while(0);
+  FD_TEST( !fd_accounts_hash_cache_publish( cache, valloc, slot_cnt ) );
+  FD_TEST( fd_funk_txn_publish( funk, txn, 1 )==1UL );
+  FD_TEST( fd_accounts_hash_cache_publish( cache, valloc, slot_cnt+1UL )==1UL );
+  check_hash( acc_mgr, cache, valloc, tpool );
+
+  /* Abandoned slots require a reset */
+
+  txn = prepare_slot( acc_mgr, cache, valloc, rng, slot_cnt+2UL, key_max, 64UL );
+  FD_TEST( fd_funk_txn_cancel( funk, txn, 1 )==1UL );
+
+  /* Reset drops everything */
+
+  miss_cnt = fd_accounts_hash_cache_miss_cnt( cache );
+  fd_accounts_hash_cache_reset( cache, valloc );
+  check_hash( acc_mgr, cache, valloc, tpool );
+  FD_TEST( fd_accounts_hash_cache_miss_cnt( cache )==miss_cnt+fd_accounts_hash_cache_part_cnt( cache ) );
+
+  fd_accounts_hash_cache_reset( cache, valloc );
+  FD_TEST( fd_accounts_hash_cache_delete( fd_accounts_hash_cache_leave( cache ) )==cache_mem );
+  FD_TEST( !fd_accounts_hash_cache_join( cache_mem ) );
+
+  fd_funk_end_write( funk );
+
+  fd_acc_mgr_delete( acc_mgr );
+  fd_wksp_free_laddr( fd_alloc_delete( fd_alloc_leave( alloc ) ) );
+  fd_wksp_free_laddr( fd_funk_delete( fd_funk_leave( funk ) ) );
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  char const * _page_sz    = fd_env_strip_cmdline_cstr ( &argc, &argv, "--page-sz",     NULL, "gigantic" );
+  ulong        page_cnt    = fd_env_strip_cmdline_ulong( &argc, &argv, "--page-cnt",    NULL,        1UL );
+  ulong        near_cpu    = fd_env_strip_cmdline_ulong( &argc, &argv, "--near-cpu",    NULL, fd_log_cpu_id() );
+  ulong        key_max     = fd_env_strip_cmdline_ulong( &argc, &argv, "--key-max",     NULL,    16384UL );
+  ulong        slot_cnt    = fd_env_strip_cmdline_ulong( &argc, &argv, "--slot-cnt",    NULL,       16UL );
+  ulong        lg_part_cnt = fd_env_strip_cmdline_ulong( &argc, &argv, "--lg-part-cnt", NULL,        8UL );
+  ulong        rent_cnt    = fd_env_strip_cmdline_ulong( &argc, &argv, "--rent-cnt",    NULL,      432UL );
+
+  FD_LOG_NOTICE(( "Testing with --page-sz %s --page-cnt %lu --key-max %lu --slot-cnt %lu --lg-part-cnt %lu --rent-cnt %lu",
+                  _page_sz, page_cnt, key_max, slot_cnt, lg_part_cnt, rent_cnt ));
+
+  fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 0U, 0UL ) );
+
+  fd_wksp_t * wksp = fd_wksp_new_anonymous( fd_cstr_to_shmem_page_sz( _page_sz ), page_cnt, near_cpu, "wksp", 0UL );
+  FD_TEST( wksp );
+
+  static uchar tpool_mem[ FD_TPOOL_FOOTPRINT(FD_TILE_MAX) ] __attribute__((aligned(FD_TPOOL_ALIGN)));
+  ulong        tile_cnt = fd_tile_cnt();
+  fd_tpool_t * tpool    = fd_tpool_init( tpool_mem, tile_cnt ); FD_TEST( tpool );
+  for( ulong tile_idx=1UL; tile_idx<tile_cnt; tile_idx++ ) FD_TEST( fd_tpool_worker_push( tpool, tile_idx, NULL, 0UL )==tpool );
+
+  /* Test construction */
+
+  FD_TEST( fd_accounts_hash_cache_align()==FD_ACCOUNTS_HASH_CACHE_ALIGN );
+  FD_TEST( !fd_accounts_hash_cache_footprint( FD_ACCOUNTS_HASH_CACHE_LG_PART_CNT_MAX+1UL ) );
+  FD_TEST( !fd_accounts_hash_cache_new( NULL,          lg_part_cnt                                ) );
+  FD_TEST( !fd_accounts_hash_cache_new( cache_mem+1UL, lg_part_cnt                                ) );
+  FD_TEST( !fd_accounts_hash_cache_new( cache_mem,     FD_ACCOUNTS_HASH_CACHE_LG_PART_CNT_MAX+1UL ) );
+  FD_TEST( fd_accounts_hash_cache_footprint( lg_part_cnt )<=sizeof(cache_mem) );
+
+  test_cache( wksp, tpool, rng, key_max, slot_cnt, lg_part_cnt, 0UL      );
+  test_cache( wksp, tpool, rng, key_max, slot_cnt, lg_part_cnt, rent_cnt );
+
+  fd_tpool_fini( tpool );
+  fd_wksp_delete_anonymous( wksp );
+  fd_rng_delete( fd_rng_leave( rng ) );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
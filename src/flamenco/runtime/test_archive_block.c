@@ -11,6 +11,12 @@ ulong shred_max = 128;
 ulong block_max = 128;
 ulong txn_max = 128;
 
+/* fd_size_max leaves room for the index of the largest idx_max tested */
+
+ulong fd_size_max = FD_BLOCKSTORE_ARCHIVE_MIN_SIZE + (1UL << 13) * sizeof(fd_blockstore_archive_idx_entry_t);
+
+fd_blockstore_codec_t * codec;
+
 #define GENERATE_BLOCK_DATA( ser, block_map_entry, block, slot, data_sz )              \
   uchar data[data_sz];                                                                 \
   for( ulong i = 0; i < data_sz; i++ ) {                                               \
@@ -71,7 +77,7 @@ query_block(bool expect, fd_blockstore_t * blockstore, int fd, ulong slotn){
   fd_hash_t parent_hash;
   uchar * blk_data = NULL;
   fd_valloc_t valloc = fd_alloc_virtual( fd_blockstore_alloc(blockstore) ); 
-  bool success = fd_blockstore_block_data_query_volatile( blockstore, fd, slotn, valloc, &parent_hash, meta, rewards, &blk_data, &blk_sz ) == 0;
+  bool success = fd_blockstore_block_data_query_volatile( blockstore, fd, codec, slotn, valloc, &parent_hash, meta, rewards, &blk_data, &blk_sz ) == 0;
   if ( blk_data ) {
     fd_alloc_free( fd_blockstore_alloc(blockstore), blk_data );
   }
@@ -86,7 +92,7 @@ query_block(bool expect, fd_blockstore_t * blockstore, int fd, ulong slotn){
 }
 
 void
-test_archive_many_blocks( fd_wksp_t * wksp, int fd, ulong fd_size_max, ulong idx_max, ulong blocks ) {
+test_archive_many_blocks( fd_wksp_t * wksp, int fd, ulong idx_max, ulong blocks ) {
   /**
     Tests archiving blocks that will exceed the blockstore's capacity
     and will require the file to be overwritten.
@@ -99,10 +105,11 @@ test_archive_many_blocks( fd_wksp_t * wksp, int fd, ulong fd_size_max, ulong idx
   CREATE_BLOCKSTORE(blockstore, slot_bank, mem, fake_hash);
   FD_TEST(fd_blockstore_init(blockstore, fd, fd_size_max,&slot_bank));
 
-  /* Store blocks that have been written to compare them later */
-  fd_block_map_t * block_map_record = fd_alloc_malloc( fd_blockstore_alloc(blockstore), 
-                                                      fd_block_map_align(),
-                                                        sizeof(fd_block_map_t) * (blocks + 1) );
+  /* Store hashes of blocks that have been written to compare them later
+     (block map entries are too large to keep a copy of each) */
+  ulong * block_map_record = fd_alloc_malloc( fd_blockstore_alloc(blockstore), 
+                                              alignof(ulong),
+                                              sizeof(ulong) * (blocks + 1) );
   int max_data_sz_pow = 20;
   uchar buf_out[ (1 << max_data_sz_pow) ]; 
 
@@ -114,12 +121,14 @@ test_archive_many_blocks( fd_wksp_t * wksp, int fd, ulong fd_size_max, ulong idx
     ulong prev_lrw_slot = fd_blockstore_archiver_lrw_slot( blockstore, fd, &block_map_entry, &block );
 
     GENERATE_BLOCK_DATA( ser, block_map_entry, block, slot, data_sz );
+    if( slot & 1UL ) fd_memset( data, (int)slot, data_sz / 2 ); /* compressible */
     FD_LOG_NOTICE( ( "slot %lu, data_sz %lu", slot, data_sz ) );
-    block_map_record[slot] = block_map_entry;
+    block_map_record[slot] = fd_hash( 0UL, &block_map_entry, sizeof(fd_block_map_t) );
 
     /* Checkpoint the generated data */
 
-    fd_blockstore_block_checkpt( blockstore, &ser, fd, slot );
+    fd_blockstore_block_checkpt( blockstore, &ser, fd, codec, slot );
+    FD_TEST( lseek( fd, 0, SEEK_END ) <= (long)fd_size_max );
 
     /* Read back the data from archive */
 
@@ -129,7 +138,7 @@ test_archive_many_blocks( fd_wksp_t * wksp, int fd, ulong fd_size_max, ulong idx
     //ulong read_off = block_idx_entry->off;
     fd_blockstore_block_meta_restore(&blockstore->archiver, fd, block_idx_entry, &block_map_entry_out, &block_out);
     //read_off = wrap_offset(&blockstore->archiver, read_off + sizeof(fd_block_map_t) + sizeof(fd_block_t));
-    fd_blockstore_block_data_restore(&blockstore->archiver, fd, block_idx_entry, buf_out, block_out.data_sz, block_out.data_sz);
+    fd_blockstore_block_data_restore(blockstore, fd, codec, block_idx_entry, buf_out, block_out.data_sz, block_out.data_sz);
 
     /* Check data read back matches data written */
 
@@ -151,7 +160,7 @@ test_archive_many_blocks( fd_wksp_t * wksp, int fd, ulong fd_size_max, ulong idx
       // and blocks in archive match what we store in memory
       for( ulong s = lrw_slot; s != blockstore->mrw_slot; s++ ){
         fd_block_map_t blk_map = query_block(true, blockstore, fd, s);
-        FD_TEST( memcmp( &blk_map, &block_map_record[s], sizeof(fd_block_map_t)) == 0 );
+        FD_TEST( fd_hash( 0UL, &blk_map, sizeof(fd_block_map_t) ) == block_map_record[s] );
       }
     }
   }
@@ -168,7 +177,7 @@ void test_blockstore_archive_big( fd_wksp_t * wksp, int fd, ulong first_idx_max,
 
   ulong idx_max = first_idx_max;
   CREATE_BLOCKSTORE(blockstore, slot_bank, mem, fake_hash);
-  FD_TEST(fd_blockstore_init(blockstore, fd, FD_BLOCKSTORE_ARCHIVE_MIN_SIZE, &slot_bank));
+  FD_TEST(fd_blockstore_init(blockstore, fd, fd_size_max, &slot_bank));
 
   for( ulong slot = 1; slot <= first_idx_max; slot++ ){
     ulong data_sz = (ulong) (1 << (rand() % 18 + 2));
@@ -178,7 +187,7 @@ void test_blockstore_archive_big( fd_wksp_t * wksp, int fd, ulong first_idx_max,
 
     /* Checkpoint the generated data */
 
-    fd_blockstore_block_checkpt( blockstore, &ser, fd, slot );
+    fd_blockstore_block_checkpt( blockstore, &ser, fd, codec, slot );
   }
   fd_block_map_t lrw_block_map;
   fd_block_t     lrw_block;
@@ -189,7 +198,7 @@ void test_blockstore_archive_big( fd_wksp_t * wksp, int fd, ulong first_idx_max,
   CREATE_BLOCKSTORE( blockstore2, slot_bank2, mem2, fake_hash2 );
 
   // initialize from fd that was created from the test_archive_many_blocks
-  FD_TEST(fd_blockstore_init(blockstore2, fd, FD_BLOCKSTORE_ARCHIVE_MIN_SIZE, &slot_bank2));
+  FD_TEST(fd_blockstore_init(blockstore2, fd, fd_size_max, &slot_bank2));
 
   ulong lrw2 = fd_blockstore_archiver_lrw_slot( blockstore2, fd, &lrw_block_map, &lrw_block);
   FD_TEST( lrw2 >= lrw1 );
@@ -200,6 +209,91 @@ void test_blockstore_archive_big( fd_wksp_t * wksp, int fd, ulong first_idx_max,
   for ( ulong slot = lrw1; slot != lrw2; slot++ ){
     query_block(false, blockstore2, fd, slot);
   }
+  fd_wksp_free_laddr( mem2 );
+  CLOSE_BLOCKSTORE
+}
+
+void
+test_blockstore_archive_queue( fd_wksp_t * wksp, int fd, ulong blocks ){
+  /**
+    Tests archiving blocks through the archive queue, and initializing
+    from the persisted index (only the blocks archived after the index
+    was last persisted should be read back).  Blocks published while
+    the queue is full are dropped.
+   */
+  FD_TEST( ftruncate(fd, 0) == 0 );
+
+  ulong idx_max = 1 << 12;
+  CREATE_BLOCKSTORE(blockstore, slot_bank, mem, fake_hash);
+  FD_TEST(fd_blockstore_init(blockstore, fd, fd_size_max, &slot_bank));
+
+  uchar * dropped = fd_alloc_malloc( fd_blockstore_alloc(blockstore), 1UL, blocks + 1 );
+  FD_TEST( dropped );
+  ulong drop_cnt = 0UL;
+  for( ulong slot = 1; slot <= blocks; slot++ ){
+    ulong data_sz = (ulong) (1 << (rand() % 12 + 2));
+    GENERATE_BLOCK_DATA( ser, block_map_entry, block, slot, data_sz );
+    if( slot & 1UL ) fd_memset( data, (int)slot, data_sz / 2 ); /* compressible */
+
+    /* When the queue is full, the block is dropped */
+
+    dropped[ slot ] = blockstore->archive_q_cnt == FD_BLOCKSTORE_ARCHIVE_QUEUE_MAX;
+    drop_cnt += dropped[ slot ];
+    FD_TEST( fd_blockstore_archive_enqueue( blockstore, &ser, fd, slot ) ==
+             ( dropped[ slot ] ? FD_BLOCKSTORE_ERR_QUEUE_FULL : FD_BLOCKSTORE_OK ) );
+    FD_TEST( blockstore->archive_drop_cnt == drop_cnt );
+
+    /* Queued blocks are queryable before they are written out */
+
+    query_block(!dropped[ slot ], blockstore, fd, slot);
+    if( slot % 16 == 0 ) {
+      FD_TEST( fd_blockstore_archive_flush( blockstore, fd, codec, 8 ) == 8 );
+    }
+  }
+  FD_TEST( blockstore->archive_q_cnt );
+  ulong q_cnt = blockstore->archive_q_cnt;
+  FD_TEST( fd_blockstore_archive_flush( blockstore, fd, codec, ULONG_MAX ) == q_cnt );
+  FD_TEST( !blockstore->archive_q_cnt );
+  FD_TEST( drop_cnt );
+  FD_TEST( fd_block_idx_key_cnt( fd_blockstore_block_idx( blockstore ) ) == blocks - drop_cnt );
+  FD_TEST( blockstore->archiver.idx_cnt );
+  FD_TEST( blockstore->archiver.idx_rec_cnt < blockstore->archiver.rec_cnt ); /* some blocks only in the ring */
+
+  /* Restart from the persisted index */
+
+  CREATE_BLOCKSTORE( blockstore2, slot_bank2, mem2, fake_hash2 );
+  FD_TEST(fd_blockstore_init(blockstore2, fd, fd_size_max, &slot_bank2));
+  FD_TEST( fd_block_idx_key_cnt( fd_blockstore_block_idx( blockstore2 ) ) == blocks - drop_cnt );
+  FD_TEST( blockstore2->mrw_slot == blockstore->mrw_slot );
+  for( ulong slot = 1; slot <= blocks; slot++ ){
+    fd_block_idx_t * e1 = fd_block_idx_query( fd_blockstore_block_idx( blockstore  ), slot, NULL );
+    fd_block_idx_t * e2 = fd_block_idx_query( fd_blockstore_block_idx( blockstore2 ), slot, NULL );
+    if( dropped[ slot ] ) {
+      FD_TEST( !e1 && !e2 );
+    } else {
+      FD_TEST( e1 && e2 && e1->off == e2->off );
+    }
+    query_block(!dropped[ slot ], blockstore2, fd, slot);
+  }
+
+  /* A corrupt persisted index falls back to reading back every block */
+
+  fd_blockstore_archive_idx_checkpt( blockstore, fd );
+  FD_TEST( blockstore->archiver.idx_rec_cnt == blockstore->archiver.rec_cnt );
+  FD_TEST( lseek( fd, 0, SEEK_END ) <= (long)fd_size_max );
+  FD_TEST( pwrite( fd, &blockstore->archiver, sizeof(fd_blockstore_archiver_t), 0 ) == (long)sizeof(fd_blockstore_archiver_t) );
+  ulong junk = 0xdeadbeefUL;
+  FD_TEST( pwrite( fd, &junk, sizeof(ulong), (long)blockstore->archiver.idx_off ) == (long)sizeof(ulong) );
+
+  CREATE_BLOCKSTORE( blockstore3, slot_bank3, mem3, fake_hash3 );
+  FD_TEST(fd_blockstore_init(blockstore3, fd, fd_size_max, &slot_bank3));
+  FD_TEST( fd_block_idx_key_cnt( fd_blockstore_block_idx( blockstore3 ) ) == blocks - drop_cnt );
+  FD_TEST( blockstore3->mrw_slot == blockstore->mrw_slot );
+
+  fd_alloc_free( fd_blockstore_alloc(blockstore), dropped );
+  fd_wksp_free_laddr( mem3 );
+  fd_wksp_free_laddr( mem2 );
+  CLOSE_BLOCKSTORE
 }
 
 void test_blockstore_archive_small( fd_wksp_t * wksp, int fd, ulong first_idx_max, ulong replay_idx_max ){
@@ -212,18 +306,19 @@ void test_blockstore_archive_small( fd_wksp_t * wksp, int fd, ulong first_idx_ma
   FD_TEST( ftruncate(fd, 0) == 0 );
 
   // large fd - limit on blocks in archive should be idx_max
-  test_archive_many_blocks( wksp, fd, FD_BLOCKSTORE_ARCHIVE_MIN_SIZE, first_idx_max, first_idx_max );
+  test_archive_many_blocks( wksp, fd, first_idx_max, first_idx_max );
   ulong last_archived = first_idx_max;
 
   ulong idx_max = replay_idx_max; 
   CREATE_BLOCKSTORE( blockstore, slot_bank, mem, fake_hash );
 
   // initialize from fd that was created from the test_archive_many_blocks
-  FD_TEST(fd_blockstore_init(blockstore, fd, FD_BLOCKSTORE_ARCHIVE_MIN_SIZE, &slot_bank));
+  FD_TEST(fd_blockstore_init(blockstore, fd, fd_size_max, &slot_bank));
   fd_block_idx_t * block_idx = fd_blockstore_block_idx(blockstore);
 
   if( first_idx_max < replay_idx_max ){
     FD_LOG_WARNING(("The following tests are meaninful only when first_idx_max >= replay_idx_max, skipping."));
+    CLOSE_BLOCKSTORE
     return;
   }
   FD_TEST(fd_block_idx_key_cnt( block_idx) == fd_block_idx_key_max( block_idx ));
@@ -242,7 +337,7 @@ void test_blockstore_archive_small( fd_wksp_t * wksp, int fd, ulong first_idx_ma
   ulong slot = last_archived + 1;
   ulong data_sz = 1024;
   GENERATE_BLOCK_DATA( ser, block_map_entry, block, slot, data_sz );
-  fd_blockstore_block_checkpt( blockstore, &ser, fd, slot);
+  fd_blockstore_block_checkpt( blockstore, &ser, fd, codec, slot);
 
   /* Check that LRW was evicted, and MRW is updated */
   
@@ -264,7 +359,7 @@ test_blockstore_metadata_invalid( int fd ){
   fd_blockstore_t blockstore;
   blockstore.archiver.fd_size_max = 0x6000;
 
-  fd_blockstore_archiver_t metadata = { .magic = FD_BLOCKSTORE_MAGIC, 
+  fd_blockstore_archiver_t metadata = { .magic = FD_BLOCKSTORE_ARCHIVE_MAGIC, 
                                         .fd_size_max = 0x6000, 
                                         .head = 2, 
                                         .tail = 3 };
@@ -295,19 +390,26 @@ main( int argc, char ** argv ) {
   int fd = open(file, O_RDWR | O_CREAT, 0666);
   FD_TEST( fd > 0 );
 
+  void * codec_mem = fd_wksp_alloc_laddr( wksp, fd_blockstore_codec_align(), fd_blockstore_codec_footprint( 1 ), 1UL );
+  FD_TEST( codec_mem );
+  codec = fd_blockstore_codec_new( codec_mem, 1 );
+  FD_TEST( codec );
+
   test_blockstore_archive_big(wksp, fd, 1 << 12, 1 << 11);
+  test_blockstore_archive_queue(wksp, fd, 1000);
   test_blockstore_archive_small(wksp, fd, 128, 128);
   test_blockstore_archive_small(wksp, fd, 128, 64);
   test_blockstore_metadata_invalid(fd);
 
   // tested archive with smaller fd size ( on order of 20KB ), by setting FD_BLOCKSTORE_ARCHIVE_MIN_SIZE 
-  ulong small_fd_size_max = FD_BLOCKSTORE_ARCHIVE_MIN_SIZE;
-  test_archive_many_blocks(wksp, fd, small_fd_size_max, 4, 128);         // small idx_mas
-  test_archive_many_blocks(wksp, fd, small_fd_size_max, 256, 512);      
-  test_archive_many_blocks(wksp, fd, small_fd_size_max, 1 << 12, 1025);  // idx_max > blocks
-  test_archive_many_blocks(wksp, fd, small_fd_size_max, 1 << 13, 1<<15); // large blocks
+  test_archive_many_blocks(wksp, fd, 4, 128);         // small idx_mas
+  test_archive_many_blocks(wksp, fd, 256, 512);      
+  test_archive_many_blocks(wksp, fd, 1 << 12, 1025);  // idx_max > blocks
+  test_archive_many_blocks(wksp, fd, 1 << 13, 1<<15); // large blocks
+
+  //test_archive_many_blocks(wksp, fd, 1 << 13, 1<<20); // 1 million blocks
 
-  //test_archive_many_blocks(wksp, fd, small_fd_size_max, 1 << 13, 1<<20); // 1 million blocks
+  fd_wksp_free_laddr( fd_blockstore_codec_delete( codec ) );
 
   fd_halt();
   return 0;
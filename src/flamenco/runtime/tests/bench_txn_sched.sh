@@ -0,0 +1,14 @@
+#!/bin/bash -f
+
+# Replays the same recorded ledger once per replay transaction scheduler
+# and reports the "replay completed" throughput line of each run.  All
+# arguments are forwarded to run_ledger_test.sh, e.g.
+#
+#   ./src/flamenco/runtime/tests/bench_txn_sched.sh -l mainnet-257066033 -s snapshot-257066033-... -p 16 -y 5 -m 2000000 -e 257066038
+
+SCRIPT_DIR=$(dirname "$0")
+
+for SCHED in waves dag; do
+  echo "txn-sched=$SCHED"
+  "$SCRIPT_DIR/run_ledger_test.sh" "$@" --txn-sched $SCHED | grep "replay completed" || exit $?
+done
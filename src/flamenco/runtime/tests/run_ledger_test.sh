@@ -24,6 +24,9 @@ TILE_CPUS="--tile-cpus 5-21"
 CLUSTER_VERSION=""
 DUMP_DIR=${DUMP_DIR:="./dump"}
 ONE_OFFS=""
+TXN_SCHED=""
+ACCOUNTS_HASH_CACHE=""
+BANK_HASH_OUT=""
 
 while [[ $# -gt 0 ]]; do
   case $1 in
@@ -90,6 +93,21 @@ while [[ $# -gt 0 ]]; do
         shift
         shift
         ;;
+    --txn-sched)
+        TXN_SCHED="--txn-sched $2"
+        shift
+        shift
+        ;;
+    --accounts-hash-cache)
+        ACCOUNTS_HASH_CACHE="--accounts-hash-cache $2"
+        shift
+        shift
+        ;;
+    --bank-hash-out)
+        BANK_HASH_OUT="$2"
+        shift
+        shift
+        ;;
     -*|--*)
        echo "unknown option $1"
        exit 1
@@ -158,6 +176,8 @@ set -x
     $FUNK_PAGES \
     $SNAPSHOT \
     $ONE_OFFS \
+    $TXN_SCHED \
+    $ACCOUNTS_HASH_CACHE \
     --allocator wksp \
     $TILE_CPUS >& $LOG
 
@@ -182,4 +202,9 @@ then
   exit $status
 fi
 
+if [[ -n "$BANK_HASH_OUT" ]]; then
+  awk '/^slot: /{s=$2} /^bank hash: /{print s, $3}' $LOG > $BANK_HASH_OUT
+fi
+
+grep "replay completed" $LOG
 rm $LOG
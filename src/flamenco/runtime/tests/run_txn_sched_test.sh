@@ -0,0 +1,27 @@
+#!/bin/bash -f
+
+# Replays the same recorded ledger once per replay transaction scheduler
+# and fails unless both produce the same bank hash for every slot.  All
+# arguments are forwarded to run_ledger_test.sh, e.g.
+#
+#   ./src/flamenco/runtime/tests/run_txn_sched_test.sh -l mainnet-257066033 -s snapshot-257066033-... -p 16 -y 5 -m 2000000 -e 257066038
+
+SCRIPT_DIR=$(dirname "$0")
+OUT="/tmp/txn_sched_bank_hash$$"
+
+for SCHED in waves dag; do
+  "$SCRIPT_DIR/run_ledger_test.sh" "$@" --txn-sched $SCHED --bank-hash-out $OUT.$SCHED || exit $?
+done
+
+if [[ ! -s $OUT.waves ]]; then
+  echo "txn sched test failed: no bank hashes replayed: $*"
+  exit 1
+fi
+
+if ! diff $OUT.waves $OUT.dag; then
+  echo "txn sched test failed: dag and waves bank hashes differ: $*"
+  exit 1
+fi
+
+echo "txn sched test passed: $(wc -l < $OUT.waves) slots"
+rm $OUT.waves $OUT.dag
@@ -29,6 +29,13 @@ $(call add-objs,fd_snapshot,fd_flamenco)
 $(call add-hdrs,fd_snapshot_loader.h)
 $(call add-objs,fd_snapshot_loader,fd_flamenco)
 
+$(call add-hdrs,fd_snapshot_restore_par.h)
+$(call add-objs,fd_snapshot_restore_par,fd_flamenco)
+ifdef FD_HAS_HOSTED
+$(call make-unit-test,test_snapshot_restore_par,test_snapshot_restore_par,fd_flamenco fd_funk fd_ballet fd_util)
+$(call run-unit-test,test_snapshot_restore_par)
+endif
+
 $(call add-hdrs,fd_snapshot_create.h)
 $(call add-objs,fd_snapshot_create,fd_flamenco)
 
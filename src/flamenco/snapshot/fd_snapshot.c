@@ -22,6 +22,7 @@ struct fd_snapshot_load_ctx {
   fd_tpool_t *           tpool;
   uint                   verify_hash;
   uint                   check_hash;
+  uint                   par_restore;
   int                    snapshot_type;
 
   /* Internal state. */
@@ -90,6 +91,7 @@ fd_snapshot_load_new( uchar *                mem,
                       fd_tpool_t *           tpool,
                       uint                   verify_hash,
                       uint                   check_hash,
+                      uint                   par_restore,
                       int                    snapshot_type,
                       fd_valloc_t            valloc ) {
 
@@ -99,6 +101,7 @@ fd_snapshot_load_new( uchar *                mem,
   ctx->tpool         = tpool;
   ctx->verify_hash   = verify_hash;
   ctx->check_hash    = check_hash;
+  ctx->par_restore   = par_restore;
   ctx->snapshot_type = snapshot_type;
   ctx->valloc        = valloc;
   return ctx;
@@ -196,8 +199,19 @@ fd_snapshot_load_manifest_and_status_cache( fd_snapshot_load_ctx_t * ctx,
 void
 fd_snapshot_load_accounts( fd_snapshot_load_ctx_t * ctx ) {
 
-  /* Now, that the manifest is done being read in. Read in the rest of the accounts. */
-  for(;;) {
+  /* Now, that the manifest is done being read in. Read in the rest of
+     the accounts.  If enabled, accounts are inserted using all tpool
+     threads.  Snapshots consisting of many Zstandard frames are also
+     decompressed in parallel. */
+  int   par_err    = ENOTSUP;
+  ulong worker_cnt = ctx->tpool ? fd_tpool_worker_cnt( ctx->tpool ) : 1UL;
+  if( ctx->par_restore && worker_cnt>1UL ) {
+    par_err = fd_snapshot_loader_advance_par( ctx->loader, ctx->tpool, 0UL, worker_cnt );
+    if( FD_UNLIKELY( par_err!=-1 && par_err!=ENOTSUP ) ) FD_LOG_ERR(( "Failed to load snapshot (%d-%s)", par_err, fd_io_strerror( par_err ) ));
+    if( par_err==ENOTSUP ) FD_LOG_NOTICE(( "Snapshot cannot be loaded in parallel, falling back to serial loading" ));
+  }
+
+  while( par_err==ENOTSUP ) {
     int err = fd_snapshot_loader_advance( ctx->loader );
     if( err==-1 ) break; /* We have finished loading in the snapshot. */
     if( FD_LIKELY( err==0 ) ) continue; /* Keep going. */
@@ -290,13 +304,14 @@ fd_snapshot_load_all( const char *         source_cstr,
                       fd_tpool_t *         tpool,
                       uint                 verify_hash,
                       uint                 check_hash,
+                      uint                 par_restore,
                       int                  snapshot_type,
                       fd_valloc_t          valloc ) {
 
   FD_SCRATCH_SCOPE_BEGIN {
 
   uchar *                  mem = fd_scratch_alloc( fd_snapshot_load_ctx_align(), fd_snapshot_load_ctx_footprint() );
-  fd_snapshot_load_ctx_t * ctx = fd_snapshot_load_new( mem, source_cstr, slot_ctx, tpool, verify_hash, check_hash, snapshot_type, valloc );
+  fd_snapshot_load_ctx_t * ctx = fd_snapshot_load_new( mem, source_cstr, slot_ctx, tpool, verify_hash, check_hash, par_restore, snapshot_type, valloc );
 
   fd_snapshot_load_init( ctx );
   fd_snapshot_load_manifest_and_status_cache( ctx, base_slot_override,
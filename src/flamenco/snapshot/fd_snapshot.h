@@ -55,6 +55,10 @@ typedef struct fd_snapshot_load_ctx fd_snapshot_load_ctx_t;
 
    If check_hash!=0 checks that the snapshot hash matches the file name.
 
+   If par_restore!=0 and tpool has more than one worker, accounts are
+   restored using all tpool threads (see fd_snapshot_restore_par.h).
+   Otherwise, accounts are restored by the calling thread.
+
    snapshot_type is one of FD_SNAPSHOT_TYPE_{...}. */
 
 ulong
@@ -70,6 +74,7 @@ fd_snapshot_load_new( uchar *                mem,
                       fd_tpool_t *           tpool,
                       uint                   verify_hash,
                       uint                   check_hash,
+                      uint                   par_restore,
                       int                    snapshot_type,
                       fd_valloc_t            valloc );
 
@@ -95,6 +100,7 @@ fd_snapshot_load_all( const char *         source_cstr,
                       fd_tpool_t *         tpool,
                       uint                 verify_hash,
                       uint                 check_hash,
+                      uint                 par_restore,
                       int                  snapshot_type,
                       fd_valloc_t          valloc );
 
@@ -3,6 +3,7 @@
 #include "../../ballet/zstd/fd_zstd.h"
 #include "../runtime/fd_hashes.h"
 #include "../runtime/fd_runtime.h"
+#include "../../funk/fd_funk_cold.h"
 
 #include <errno.h>
 #include <stdio.h>
@@ -12,43 +13,223 @@
 #include <unistd.h>
 #include <zstd.h>
 
-static uchar             padding[ FD_SNAPSHOT_ACC_ALIGN ] = {0};
-static fd_account_meta_t default_meta = { .magic = FD_ACCOUNT_META_MAGIC };
+static uchar padding[ FD_TAR_BLOCK_SZ ] = {0};
 
-static inline fd_account_meta_t *
-fd_snapshot_create_get_default_meta( ulong slot ) {
-  default_meta.slot = slot;
-  return &default_meta;
+/* fd_snapshot_create_stream_t compresses the part of the archive that
+   is produced serially (the version, status cache and manifest files,
+   and the archive trailer) into zstd frames of at most
+   FD_SNAPSHOT_ZSTD_FRAME_SZ uncompressed bytes and writes them out to
+   the snapshot file.  The account vec files are compressed into their
+   own frames by tpool workers (see fd_snapshot_create_write_acc_vecs)
+   and written out through the same ostream, such that the snapshot
+   file is a concatenation of independent frames. */
+
+struct fd_snapshot_create_stream {
+  ZSTD_CCtx *              cctx;
+  fd_io_buffered_ostream_t ostream[1];
+  char *                   out_buf;
+  char *                   zstd_buf;
+  ulong                    zstd_buf_sz;
+  ulong                    frame_sz;    /* Uncompressed bytes in the current frame */
+};
+typedef struct fd_snapshot_create_stream fd_snapshot_create_stream_t;
+
+/* fd_snapshot_create_vec_t describes an account vec file.  Its accounts
+   are the records rec[rec_lo,rec_hi) of the plan. */
+
+struct fd_snapshot_create_vec {
+  ulong slot;
+  ulong id;
+  ulong rec_lo;
+  ulong rec_hi;
+  ulong file_sz;
+};
+typedef struct fd_snapshot_create_vec fd_snapshot_create_vec_t;
+
+/* fd_snapshot_create_frame_t describes a zstd frame of the account vec
+   part of the archive.  The account vec part is a sequence of items:
+   for each vec in archive order, its tar header, its accounts and its
+   tar padding.  With the accounts of vec v being rec[rec_lo,rec_hi),
+   the items of vec v are at indices [rec_lo+2v,rec_hi+2v+2).  A frame
+   holds the items [item_lo,item_hi), which are in_sz bytes of the tar
+   stream. */
+
+struct fd_snapshot_create_frame {
+  ulong item_lo;
+  ulong item_hi;
+  ulong in_sz;
+  ulong out_sz;  /* Compressed size, set once compressed */
+};
+typedef struct fd_snapshot_create_frame fd_snapshot_create_frame_t;
+
+/* fd_snapshot_create_plan_t is the layout of the account vec part of
+   the archive.  It is complete before any account is written out, which
+   allows writing the manifest (that holds the account vec index) ahead
+   of the account vecs in a single pass. */
+
+struct fd_snapshot_create_plan {
+  fd_funk_t *                  funk;
+
+  fd_funk_rec_t const * *      rec;        /* Records to write, in archive order */
+  ulong                        rec_cnt;
+  fd_snapshot_create_vec_t *   vec;        /* Account vecs, in archive order */
+  ulong                        vec_cnt;
+  fd_snapshot_create_frame_t * frame;
+  ulong                        frame_cnt;
+  ulong                        frame_max;  /* Max in_sz of a frame */
+
+  fd_funk_rec_t * *            tombstones;
+  ulong                        tombstones_cnt;
+
+  /* Compression state, one per worker of a round */
+  ulong                        frame0;     /* First frame of the current round */
+  ZSTD_CCtx * *                cctx;
+  uchar * *                    out;
+  ulong                        out_max;
+};
+typedef struct fd_snapshot_create_plan fd_snapshot_create_plan_t;
+
+/* fd_snapshot_create_rec_meta returns the account metadata of funk
+   record rec.  For a tombstone, this is metadata for a deleted account
+   at the slot of its deletion, which is populated in tmp.  Values that
+   were evicted to the funk cold tier are read in place from the cold
+   log. */
+
+static inline fd_account_meta_t const *
+fd_snapshot_create_rec_meta( fd_funk_t *           funk,
+                             fd_funk_rec_t const * rec,
+                             fd_account_meta_t *   tmp ) {
+  if( rec->flags & FD_FUNK_REC_FLAG_ERASE ) {
+    *tmp = (fd_account_meta_t){ .magic = FD_ACCOUNT_META_MAGIC, .slot = fd_funk_rec_get_erase_data( rec ) };
+    return tmp;
+  }
+  ulong val_sz;
+  return (fd_account_meta_t const *)fd_funk_cold_val_peek( funk, rec, fd_funk_wksp( funk ), &val_sz );
+}
+
+static inline ulong
+fd_snapshot_create_acc_sz( fd_account_meta_t const * metadata ) {
+  return sizeof(fd_solana_account_hdr_t) + fd_ulong_align_up( metadata->dlen, FD_SNAPSHOT_ACC_ALIGN );
+}
+
+static inline void
+fd_snapshot_create_acc_hdr( fd_solana_account_hdr_t * header,
+                            fd_pubkey_t const *       pubkey,
+                            fd_account_meta_t const * metadata ) {
+  fd_memset( header, 0, sizeof(fd_solana_account_hdr_t) );
+  /* Stored meta */
+  header->meta.write_version_obsolete = 0UL;
+  header->meta.data_len               = metadata->dlen;
+  fd_memcpy( header->meta.pubkey, pubkey, sizeof(fd_pubkey_t) );
+  /* Account Meta */
+  header->info.lamports               = metadata->info.lamports;
+  header->info.rent_epoch             = header->info.lamports ? metadata->info.rent_epoch : 0UL;
+  fd_memcpy( header->info.owner, metadata->info.owner, sizeof(fd_pubkey_t) );
+  header->info.executable             = metadata->info.executable;
+  /* Hash */
+  fd_memcpy( &header->hash, metadata->hash, sizeof(fd_hash_t) );
+}
+
+static inline void
+fd_snapshot_create_vec_name( char                             buf[ FD_SNAPSHOT_DIR_MAX ],
+                             fd_snapshot_create_vec_t const * vec ) {
+  int err = snprintf( buf, FD_SNAPSHOT_DIR_MAX, "accounts/%lu.%lu", vec->slot, vec->id );
+  if( FD_UNLIKELY( err<0 ) ) {
+    FD_LOG_ERR(( "Unable to format accounts name string" ));
+  }
+}
+
+/* Serial stream ******************************************************/
+
+static void
+fd_snapshot_create_stream_compress( fd_snapshot_create_stream_t * stream,
+                                    ZSTD_inBuffer *               input,
+                                    ZSTD_EndDirective             mode ) {
+  ulong remaining;
+  do {
+    ZSTD_outBuffer output = { stream->zstd_buf, stream->zstd_buf_sz, 0UL };
+    remaining = ZSTD_compressStream2( stream->cctx, &output, input, mode );
+    if( FD_UNLIKELY( ZSTD_isError( remaining ) ) ) {
+      FD_LOG_ERR(( "Compression error: %s", ZSTD_getErrorName( remaining ) ));
+    }
+
+    int err = fd_io_buffered_ostream_write( stream->ostream, stream->zstd_buf, output.pos );
+    if( FD_UNLIKELY( err ) ) {
+      FD_LOG_ERR(( "Failed to write out the compressed file (%i-%s)", err, fd_io_strerror( err ) ));
+    }
+  } while( mode==ZSTD_e_end ? remaining!=0UL : input->pos<input->size );
+}
+
+/* fd_snapshot_create_stream_end_frame finishes the current frame, if
+   any. */
+
+static void
+fd_snapshot_create_stream_end_frame( fd_snapshot_create_stream_t * stream ) {
+  if( !stream->frame_sz ) return;
+  ZSTD_inBuffer input = { NULL, 0UL, 0UL };
+  fd_snapshot_create_stream_compress( stream, &input, ZSTD_e_end );
+  stream->frame_sz = 0UL;
+}
+
+static void
+fd_snapshot_create_stream_write( fd_snapshot_create_stream_t * stream,
+                                 void const *                  data,
+                                 ulong                         data_sz ) {
+  uchar const * p = (uchar const *)data;
+  while( data_sz ) {
+    ulong         chunk_sz = fd_ulong_min( data_sz, FD_SNAPSHOT_ZSTD_FRAME_SZ - stream->frame_sz );
+    ZSTD_inBuffer input    = { p, chunk_sz, 0UL };
+    fd_snapshot_create_stream_compress( stream, &input, ZSTD_e_continue );
+
+    p                += chunk_sz;
+    data_sz          -= chunk_sz;
+    stream->frame_sz += chunk_sz;
+    if( stream->frame_sz==FD_SNAPSHOT_ZSTD_FRAME_SZ ) fd_snapshot_create_stream_end_frame( stream );
+  }
 }
 
+/* fd_snapshot_create_stream_write_file appends the file file_name with
+   content data to the archive. */
+
+static void
+fd_snapshot_create_stream_write_file( fd_snapshot_create_stream_t * stream,
+                                      char const *                  file_name,
+                                      void const *                  data,
+                                      ulong                         data_sz ) {
+  fd_tar_meta_t meta[1];
+  if( FD_UNLIKELY( !fd_tar_meta_init_file( meta, file_name, data_sz ) ) ) {
+    FD_LOG_ERR(( "Unable to create the tar header for file=%s", file_name ));
+  }
+  fd_snapshot_create_stream_write( stream, meta, FD_TAR_BLOCK_SZ );
+  fd_snapshot_create_stream_write( stream, data, data_sz );
+  fd_snapshot_create_stream_write( stream, padding, fd_ulong_align_up( data_sz, FD_TAR_BLOCK_SZ ) - data_sz );
+}
+
+/* Account vecs *******************************************************/
+
 static inline void
 fd_snapshot_create_populate_acc_vecs( fd_snapshot_ctx_t                 * snapshot_ctx,
                                       fd_solana_manifest_serializable_t * manifest,
-                                      fd_tar_writer_t                   * writer,
+                                      fd_snapshot_create_plan_t         * plan,
                                       ulong                             * out_cap ) {
 
   /* The append vecs need to be described in an index in the manifest so a
      reader knows what account files to look for. These files are technically
      slot indexed, but the Firedancer implementation of the Solana snapshot
-     produces far fewer indices. These storages are for the accounts 
-     that were modified and deleted in the most recent slot because that 
-     information is used by the Agave client to calculate and verify the 
+     produces far fewer indices. These storages are for the accounts
+     that were modified and deleted in the most recent slot because that
+     information is used by the Agave client to calculate and verify the
      bank hash for the given slot. This is done as an optimization to avoid
      having to slot index the Firedancer accounts db which would incur a large
      performance hit.
-     
-     To avoid iterating through the root twice to determine what accounts were
-     touched in the snapshot slot and what accounts were touched in the
-     other slots, we will create an array of pubkey pointers for all accounts
-     that were touched in the snapshot slot. This buffer can be safely sized to 
-     the maximum amount of writable accounts that are possible in a non-epoch
-     boundary slot. The rationale for this bound is explained in fd_runtime.h.
-     We will not attempt to create a snapshot on an epoch boundary. 
-     
-     TODO: We must add compaction here. */
 
-  fd_pubkey_t * * snapshot_slot_keys    = fd_valloc_malloc( snapshot_ctx->valloc, alignof(fd_pubkey_t*), sizeof(fd_pubkey_t*) * FD_WRITABLE_ACCS_IN_SLOT );
-  ulong           snapshot_slot_key_cnt = 0UL;
+     The manifest is written out ahead of the account vecs, hence the
+     complete layout of the account vecs must be known before any account
+     is written out.  The first pass over the funk root counts the
+     accounts and sizes out the account vecs, the second one records the
+     accounts to write in archive order along with the vec they go in.
+
+     TODO: We must add compaction here. */
 
   /* We will dynamically resize the number of incremental keys because the upper
      bound will be roughly 8 bytes * writable accs in a slot * number of slots
@@ -57,19 +238,25 @@ fd_snapshot_create_populate_acc_vecs( fd_snapshot_ctx_t                 * snapsh
   #define FD_INCREMENTAL_KEY_INIT_BOUND (100000UL)
   ulong                       incremental_key_bound = FD_INCREMENTAL_KEY_INIT_BOUND;
   ulong                       incremental_key_cnt   = 0UL;
-  fd_funk_rec_key_t const * * incremental_keys      = snapshot_ctx->is_incremental ? 
+  fd_funk_rec_key_t const * * incremental_keys      = snapshot_ctx->is_incremental ?
                                                       fd_valloc_malloc( snapshot_ctx->valloc, alignof(fd_funk_rec_key_t*), sizeof(fd_funk_rec_key_t*) * incremental_key_bound ) :
                                                       NULL;
 
   #undef FD_INCREMENTAL_KEY_INIT_BOUND
 
   /* In order to size out the accounts DB index in the manifest, we must
-     iterate through funk and accumulate the size of all of the records
-     from all slots before the snapshot_slot. */
-
-  fd_funk_t * funk           = snapshot_ctx->acc_mgr->funk;
-  ulong       prev_sz        = 0UL;
-  ulong       tombstones_cnt = 0UL;
+     iterate through funk and pack all of the records from all slots
+     before the snapshot_slot into append vecs.  All accounts that were
+     touched in the snapshot slot go in their own append vec so that
+     Agave can calculate the snapshot slot's bank hash. */
+
+  fd_funk_t *       funk           = snapshot_ctx->acc_mgr->funk;
+  ulong             prev_cnt       = 0UL;
+  ulong             curr_cnt       = 0UL;
+  ulong             prev_vec_cnt   = 0UL;
+  ulong             prev_vec_sz    = FD_SNAPSHOT_APPEND_VEC_SZ_MAX;
+  ulong             tombstones_cnt = 0UL;
+  fd_account_meta_t tmp_meta[1];
   for( fd_funk_rec_t const * rec = fd_funk_txn_first_rec( funk, NULL ); NULL != rec; rec = fd_funk_txn_next_rec( funk, rec ) ) {
 
     if( !fd_funk_key_is_acc( rec->pair.key ) ) {
@@ -78,10 +265,8 @@ fd_snapshot_create_populate_acc_vecs( fd_snapshot_ctx_t                 * snapsh
 
     tombstones_cnt++;
 
-    int                 is_tombstone = rec->flags & FD_FUNK_REC_FLAG_ERASE;                     
-    uchar const *       raw          = fd_funk_val( rec, fd_funk_wksp( funk ) );
-    fd_account_meta_t * metadata     = is_tombstone ? fd_snapshot_create_get_default_meta( fd_funk_rec_get_erase_data( rec ) ) : 
-                                                      (fd_account_meta_t*)raw;
+    int                       is_tombstone = rec->flags & FD_FUNK_REC_FLAG_ERASE;
+    fd_account_meta_t const * metadata     = fd_snapshot_create_rec_meta( funk, rec, tmp_meta );
 
     if( !metadata ) {
       continue;
@@ -93,8 +278,8 @@ fd_snapshot_create_populate_acc_vecs( fd_snapshot_ctx_t                 * snapsh
 
     if( snapshot_ctx->is_incremental ) {
       /* We only care about accounts that were modified since the last
-         snapshot slot for incremental snapshots. 
-         
+         snapshot slot for incremental snapshots.
+
          We also need to keep track of the capitalization for all of the
          accounts that are in the incremental as this is verified. */
       if( metadata->slot<=snapshot_ctx->last_snap_slot ) {
@@ -106,7 +291,7 @@ fd_snapshot_create_populate_acc_vecs( fd_snapshot_ctx_t                 * snapsh
       if( FD_UNLIKELY( incremental_key_cnt==incremental_key_bound ) ) {
         /* Dynamically resize if needed. */
         incremental_key_bound *= 2UL;
-        fd_funk_rec_key_t const * * new_incremental_keys = fd_valloc_malloc( snapshot_ctx->valloc, 
+        fd_funk_rec_key_t const * * new_incremental_keys = fd_valloc_malloc( snapshot_ctx->valloc,
                                                                              alignof(fd_funk_rec_key_t*),
                                                                              sizeof(fd_funk_rec_key_t*) * incremental_key_bound );
         fd_memcpy( new_incremental_keys, incremental_keys, sizeof(fd_funk_rec_key_t*) * incremental_key_cnt );
@@ -116,26 +301,37 @@ fd_snapshot_create_populate_acc_vecs( fd_snapshot_ctx_t                 * snapsh
     }
 
     /* We know that all of the accounts from the snapshot slot can fit into
-       one append vec, so we ignore all accounts from the snapshot slot. */
+       one append vec. */
 
     if( metadata->slot==snapshot_ctx->slot ) {
+      curr_cnt++;
       continue;
     }
 
-    prev_sz += metadata->dlen + sizeof(fd_solana_account_hdr_t);
+    /* We don't want to iterate over tombstones if the snapshot is not
+       incremental */
+    if( !snapshot_ctx->is_incremental && is_tombstone ) {
+      continue;
+    }
+
+    /* An append vec has a protocol-defined maximum size in Agave. When
+       the current one is full, start filling the next one. */
+
+    ulong acc_sz = fd_snapshot_create_acc_sz( metadata );
+    if( prev_vec_sz+acc_sz>FD_SNAPSHOT_APPEND_VEC_SZ_MAX ) {
+      prev_vec_cnt++;
+      prev_vec_sz = 0UL;
+    }
+    prev_vec_sz += acc_sz;
+    prev_cnt++;
 
   }
 
-  /* At this point we have sized out all of the relevant accounts that will 
-     be included in the snapshot. Now we must populate each of the append vecs
-     and update the index as we go.
-  
-     When we account for the number of slots we need to consider one append vec
-     for the snapshot slot and try to maximally fill up the others: an append
-     vec has a protocol-defined maximum size in Agave.  */
+  /* At this point we have sized out all of the relevant accounts that will
+     be included in the snapshot. Now we must populate the index with one
+     append vec for the snapshot slot and the ones for previous slots. */
 
-  ulong num_slots = 1UL + prev_sz / FD_SNAPSHOT_APPEND_VEC_SZ_MAX + 
-                    (prev_sz % FD_SNAPSHOT_APPEND_VEC_SZ_MAX ? 1UL : 0UL);
+  ulong num_slots = 1UL + prev_vec_cnt;
 
   fd_solana_accounts_db_fields_t * accounts_db = &manifest->accounts_db;
 
@@ -153,7 +349,7 @@ fd_snapshot_create_populate_acc_vecs( fd_snapshot_ctx_t                 * snapsh
   for( ulong i=0UL; i<num_slots; i++ ) {
     /* Populate the storages for each slot. As a note, the slot number only
        matters for the snapshot slot. The other slot numbers don't affect
-       consensus at all. Agave also maintains an invariant that there can 
+       consensus at all. Agave also maintains an invariant that there can
        only be one account vec per storage. */
 
     accounts_db->storages[ i ].account_vecs_len          = 1UL;
@@ -166,38 +362,38 @@ fd_snapshot_create_populate_acc_vecs( fd_snapshot_ctx_t                 * snapsh
   }
 
   /* At this point we have iterated through all of the accounts and created
-     the index. We are now ready to generate a snapshot hash. For both 
+     the index. We are now ready to generate a snapshot hash. For both
      snapshots we need to generate two hashes:
      1. The accounts hash. This is a simple hash of all of the accounts
         included in the snapshot.
      2. The snapshot hash. This is a hash of the accounts hash and the epoch
         account hash. If the EAH is not included, then the accounts hash ==
         snapshot hash.
-        
+
     There is some nuance as to which hash goes where. For full snapshots,
     the accounts hash in the bank hash info is the accounts hash. The hash in
     the filename is the snapshot hash.
-    
+
     For incremental snapshots, the account hash in the bank hash info field is
     left zeroed out. The full snapshot's hash is in the incremental persistence
-    field. The incremental snapshot's accounts hash is included in the 
-    incremental persistence field. The hash in the filename is the snapshot 
+    field. The incremental snapshot's accounts hash is included in the
+    incremental persistence field. The hash in the filename is the snapshot
     hash. */
 
   int err;
   if( !snapshot_ctx->is_incremental ) {
-    err = fd_snapshot_service_hash( &snapshot_ctx->acc_hash, 
+    err = fd_snapshot_service_hash( &snapshot_ctx->acc_hash,
                                     &snapshot_ctx->snap_hash,
-                                    &snapshot_ctx->slot_bank, 
+                                    &snapshot_ctx->slot_bank,
                                     &snapshot_ctx->epoch_bank,
                                     snapshot_ctx->acc_mgr->funk,
                                     snapshot_ctx->tpool,
                                     snapshot_ctx->valloc );
     accounts_db->bank_hash_info.accounts_hash = snapshot_ctx->acc_hash;
   } else {
-    err = fd_snapshot_service_inc_hash( &snapshot_ctx->acc_hash, 
+    err = fd_snapshot_service_inc_hash( &snapshot_ctx->acc_hash,
                                         &snapshot_ctx->snap_hash,
-                                        &snapshot_ctx->slot_bank, 
+                                        &snapshot_ctx->slot_bank,
                                         &snapshot_ctx->epoch_bank,
                                         snapshot_ctx->acc_mgr->funk,
                                         incremental_keys,
@@ -218,85 +414,58 @@ fd_snapshot_create_populate_acc_vecs( fd_snapshot_ctx_t                 * snapsh
 
   fd_memset( &accounts_db->bank_hash_info.stats, 0, sizeof(fd_bank_hash_stats_t) );
 
-  /* Now, we have calculated the relevant hashes for the accounts.
-     Because the files are serially written out for tar and we need to prepend
-     the manifest, we must reserve space in the archive for the solana manifest. */
-
   if( snapshot_ctx->is_incremental ) {
     manifest->bank_incremental_snapshot_persistence = fd_valloc_malloc( snapshot_ctx->valloc,
-                                                                        FD_BANK_INCREMENTAL_SNAPSHOT_PERSISTENCE_ALIGN, 
+                                                                        FD_BANK_INCREMENTAL_SNAPSHOT_PERSISTENCE_ALIGN,
                                                                         sizeof(fd_bank_incremental_snapshot_persistence_t) );
   }
 
-  ulong manifest_sz = fd_solana_manifest_serializable_size( manifest ); 
-
-  char buffer[ FD_SNAPSHOT_DIR_MAX ];
-  err = snprintf( buffer, FD_SNAPSHOT_DIR_MAX, "snapshots/%lu/%lu", snapshot_ctx->slot, snapshot_ctx->slot );
-  if( FD_UNLIKELY( err<0 ) ) {
-    FD_LOG_ERR(( "Unable to format manifest name string" ));
-  }
-
-  err = fd_tar_writer_new_file( writer, buffer );
-  if( FD_UNLIKELY( err ) ) {
-    FD_LOG_ERR(( "Unable to create snapshot manifest file" ));
-  }
-  
-  /* TODO: We want to eliminate having to write back into the tar file. This
-     will enable the snapshot service to only use one file per snapshot.
-     In order to do this, we must precompute the index in the manifest 
-     completely. This will allow us to stream out a compressed snapshot. */
-
-  err = fd_tar_writer_make_space( writer, manifest_sz );
-  if( FD_UNLIKELY( err ) ) {
-    FD_LOG_ERR(( "Unable to make space for snapshot manifest file" ));
-  }
-
-  err = fd_tar_writer_fini_file( writer );
-  if( FD_UNLIKELY( err ) ) {
-    FD_LOG_ERR(( "Unable to finalize snapshot manifest file" ));
-  }
-
-  /* We have made space for the manifest and are ready to append the append
-     vec files directly into the tar archive. We will iterate through all of
-     the records in the funk root and create/populate an append vec for 
-     previous slots. Just record the pubkeys for the latest slot to populate 
-     the append vec after. If the append vec is full, write into the next one. */
-
-  ulong curr_slot = 1UL;
-  fd_snapshot_acc_vec_t * prev_accs = &accounts_db->storages[ curr_slot ].account_vecs[ 0UL ];
-
-  err = snprintf( buffer, FD_SNAPSHOT_DIR_MAX, "accounts/%lu.%lu", snapshot_ctx->slot - curr_slot, prev_accs->id );
-  if( FD_UNLIKELY( err<0 ) ) {
-    FD_LOG_ERR(( "Unable to format previous accounts name string" ));
-  }
-
-  err = fd_tar_writer_new_file( writer, buffer );
-  if( FD_UNLIKELY( err ) ) {
-    FD_LOG_ERR(( "Unable to create previous accounts file" ));
+  /* Now lay out the account vecs in archive order: the append vecs for
+     the previous slots followed by the one for the snapshot slot (again,
+     this is needed because the snapshot slot's accounts must be in their
+     append vec in order to verify the bank hash for the snapshot slot in
+     the Agave client).  The second pass over the funk root records the
+     accounts in the same order as the first one saw them. */
+
+  ulong rec_cnt = prev_cnt + curr_cnt;
+
+  plan->funk           = funk;
+  plan->rec_cnt        = rec_cnt;
+  plan->rec            = fd_valloc_malloc( snapshot_ctx->valloc, alignof(fd_funk_rec_t const *), sizeof(fd_funk_rec_t const *) * fd_ulong_max( rec_cnt, 1UL ) );
+  plan->vec_cnt        = num_slots;
+  plan->vec            = fd_valloc_malloc( snapshot_ctx->valloc, alignof(fd_snapshot_create_vec_t), sizeof(fd_snapshot_create_vec_t) * num_slots );
+  plan->tombstones     = snapshot_ctx->is_incremental ? NULL :
+                         fd_valloc_malloc( snapshot_ctx->valloc, alignof(fd_funk_rec_t*), sizeof(fd_funk_rec_t*) * tombstones_cnt );
+  plan->tombstones_cnt = 0UL;
+
+  for( ulong v=0UL; v<num_slots; v++ ) {
+    fd_snapshot_acc_vec_t * acc_vec = &accounts_db->storages[ (v+1UL) % num_slots ].account_vecs[ 0UL ];
+    plan->vec[ v ].slot    = accounts_db->storages[ (v+1UL) % num_slots ].slot;
+    plan->vec[ v ].id      = acc_vec->id;
+    plan->vec[ v ].rec_lo  = 0UL;
+    plan->vec[ v ].rec_hi  = 0UL;
+    plan->vec[ v ].file_sz = 0UL;
   }
 
-  fd_funk_rec_t * * tombstones = snapshot_ctx->is_incremental ? NULL : 
-                                 fd_valloc_malloc( snapshot_ctx->valloc, alignof(fd_funk_rec_t*), sizeof(fd_funk_rec_t*) * tombstones_cnt );
-  tombstones_cnt = 0UL;
+  fd_snapshot_create_vec_t * curr_vec = &plan->vec[ num_slots-1UL ];
+  curr_vec->rec_lo = prev_cnt;
+  curr_vec->rec_hi = prev_cnt;
 
+  ulong                      prev_idx = 0UL;
+  fd_snapshot_create_vec_t * prev_vec = NULL;
   for( fd_funk_rec_t const * rec = fd_funk_txn_first_rec( funk, NULL ); NULL != rec; rec = fd_funk_txn_next_rec( funk, rec ) ) {
 
-    /* Get the account data. */
-
     if( !fd_funk_key_is_acc( rec->pair.key ) ) {
       continue;
     }
 
-    fd_pubkey_t const * pubkey       = fd_type_pun_const( rec->pair.key[0].uc );
-    int                 is_tombstone = rec->flags & FD_FUNK_REC_FLAG_ERASE;                     
-    uchar const *       raw          = fd_funk_val( rec, fd_funk_wksp( funk ) );
-    fd_account_meta_t * metadata     = is_tombstone ? fd_snapshot_create_get_default_meta( fd_funk_rec_get_erase_data( rec ) ) : 
-                                                      (fd_account_meta_t*)raw;
+    int                       is_tombstone = rec->flags & FD_FUNK_REC_FLAG_ERASE;
+    fd_account_meta_t const * metadata     = fd_snapshot_create_rec_meta( funk, rec, tmp_meta );
 
     if( !snapshot_ctx->is_incremental && is_tombstone ) {
       /* If we are in a full snapshot, we need to gather all of the accounts
          that we plan on deleting. */
-      tombstones[ tombstones_cnt++ ] = (fd_funk_rec_t*)rec;
+      plan->tombstones[ plan->tombstones_cnt++ ] = (fd_funk_rec_t*)rec;
     }
 
     if( !metadata ) {
@@ -305,7 +474,7 @@ fd_snapshot_create_populate_acc_vecs( fd_snapshot_ctx_t                 * snapsh
 
     if( metadata->magic!=FD_ACCOUNT_META_MAGIC ) {
       continue;
-    } 
+    }
 
     /* Don't iterate through accounts that were touched before the last full
        snapshot. */
@@ -313,182 +482,260 @@ fd_snapshot_create_populate_acc_vecs( fd_snapshot_ctx_t                 * snapsh
       continue;
     }
 
-    uchar const * acc_data = raw + metadata->hlen;
-
-    /* All accounts that were touched in the snapshot slot should be in 
-       a different append vec so that Agave can calculate the snapshot slot's
-       bank hash. We don't want to include them in an arbitrary append vec. */
+    ulong acc_sz = fd_snapshot_create_acc_sz( metadata );
 
     if( metadata->slot==snapshot_ctx->slot ) {
-      snapshot_slot_keys[ snapshot_slot_key_cnt++ ] = (fd_pubkey_t*)pubkey;
+      if( FD_UNLIKELY( curr_vec->rec_hi==rec_cnt ) ) {
+        FD_LOG_ERR(( "Funk root changed during snapshot creation" ));
+      }
+      plan->rec[ curr_vec->rec_hi++ ] = rec;
+      curr_vec->file_sz += acc_sz;
       continue;
     }
 
-    /* We don't want to iterate over tombstones if the snapshot is not
-       incremental */
     if( !snapshot_ctx->is_incremental && is_tombstone ) {
       continue;
     }
 
-    ulong new_sz = prev_accs->file_sz + sizeof(fd_solana_account_hdr_t) + fd_ulong_align_up( metadata->dlen, FD_SNAPSHOT_ACC_ALIGN );
-
-    if( new_sz>FD_SNAPSHOT_APPEND_VEC_SZ_MAX ) {
+    if( !prev_vec || prev_vec->file_sz+acc_sz>FD_SNAPSHOT_APPEND_VEC_SZ_MAX ) {
+      prev_vec = prev_vec ? prev_vec+1 : plan->vec;
+      if( FD_UNLIKELY( prev_vec==curr_vec ) ) {
+        FD_LOG_ERR(( "Funk root changed during snapshot creation" ));
+      }
+      prev_vec->rec_lo = prev_idx;
+      prev_vec->rec_hi = prev_idx;
+    }
+    if( FD_UNLIKELY( prev_idx==prev_cnt ) ) {
+      FD_LOG_ERR(( "Funk root changed during snapshot creation" ));
+    }
+    plan->rec[ prev_idx++ ] = rec;
+    prev_vec->rec_hi   = prev_idx;
+    prev_vec->file_sz += acc_sz;
+  }
 
-      /* When the current append vec is full, finish writing it, start writing 
-         into the next append vec. */
+  if( FD_UNLIKELY( prev_idx!=prev_cnt || curr_vec->rec_hi!=rec_cnt ) ) {
+    FD_LOG_ERR(( "Funk root changed during snapshot creation" ));
+  }
 
-      err = fd_tar_writer_fini_file( writer );
-      if( FD_UNLIKELY( err ) ) {
-        FD_LOG_ERR(( "Unable to finalize previous accounts file" ));
-      }
+  for( ulong v=0UL; v<num_slots; v++ ) {
+    accounts_db->storages[ (v+1UL) % num_slots ].account_vecs[ 0UL ].file_sz = plan->vec[ v ].file_sz;
+  }
 
-      prev_accs = &accounts_db->storages[ ++curr_slot ].account_vecs[ 0UL ];
+  /* Finally, split the account vec part of the archive into frames of
+     roughly FD_SNAPSHOT_ZSTD_FRAME_SZ bytes that can be compressed
+     independently.  A frame is only ever cut before a tar header or an
+     account, so two consecutive frames together are always larger than
+     FD_SNAPSHOT_ZSTD_FRAME_SZ. */
 
-      err = snprintf( buffer, FD_SNAPSHOT_DIR_MAX, "accounts/%lu.%lu", snapshot_ctx->slot - curr_slot, prev_accs->id );
-      if( FD_UNLIKELY( err<0 ) ) {
-        FD_LOG_ERR(( "Unable to format previous accounts name string" ));
-      }
+  ulong total_sz = 0UL;
+  for( ulong v=0UL; v<num_slots; v++ ) {
+    total_sz += FD_TAR_BLOCK_SZ + fd_ulong_align_up( plan->vec[ v ].file_sz, FD_TAR_BLOCK_SZ );
+  }
 
-      err = fd_tar_writer_new_file( writer, buffer );
-      if( FD_UNLIKELY( err ) ) {
-        FD_LOG_ERR(( "Unable to create previous accounts file" ));
+  ulong frame_max_cnt = 2UL*(total_sz/FD_SNAPSHOT_ZSTD_FRAME_SZ) + 2UL;
+  plan->frame         = fd_valloc_malloc( snapshot_ctx->valloc, alignof(fd_snapshot_create_frame_t), sizeof(fd_snapshot_create_frame_t) * frame_max_cnt );
+  plan->frame_cnt     = 0UL;
+  plan->frame_max     = 0UL;
+
+  fd_snapshot_create_frame_t * frame = plan->frame;
+  frame->item_lo = 0UL;
+  frame->in_sz   = 0UL;
+  for( ulong v=0UL; v<num_slots; v++ ) {
+    fd_snapshot_create_vec_t const * vec     = &plan->vec[ v ];
+    ulong                            item_lo = vec->rec_lo + 2UL*v;
+    ulong                            item_hi = vec->rec_hi + 2UL*v + 2UL;
+    for( ulong item=item_lo; item<item_hi; item++ ) {
+      ulong item_sz;
+      if(      item==item_lo     ) item_sz = FD_TAR_BLOCK_SZ;
+      else if( item==item_hi-1UL ) item_sz = fd_ulong_align_up( vec->file_sz, FD_TAR_BLOCK_SZ ) - vec->file_sz;
+      else                         item_sz = fd_snapshot_create_acc_sz( fd_snapshot_create_rec_meta( funk, plan->rec[ vec->rec_lo + item - item_lo - 1UL ], tmp_meta ) );
+
+      if( frame->in_sz && item!=item_hi-1UL && frame->in_sz+item_sz>FD_SNAPSHOT_ZSTD_FRAME_SZ ) {
+        frame->item_hi  = item;
+        plan->frame_max = fd_ulong_max( plan->frame_max, frame->in_sz );
+        frame++;
+        frame->item_lo  = item;
+        frame->in_sz    = 0UL;
       }
+      frame->in_sz += item_sz;
     }
+  }
+  frame->item_hi  = plan->rec_cnt + 2UL*num_slots;
+  plan->frame_max = fd_ulong_max( plan->frame_max, frame->in_sz );
+  plan->frame_cnt = (ulong)(frame - plan->frame) + 1UL;
 
-    prev_accs->file_sz += sizeof(fd_solana_account_hdr_t) + fd_ulong_align_up( metadata->dlen, FD_SNAPSHOT_ACC_ALIGN );
-
-
-    /* Write out the header. */
-
-    fd_solana_account_hdr_t header = {0};
-    /* Stored meta */
-    header.meta.write_version_obsolete = 0UL;
-    header.meta.data_len               = metadata->dlen;
-    fd_memcpy( header.meta.pubkey, pubkey, sizeof(fd_pubkey_t) );
-    /* Account Meta */
-    header.info.lamports               = metadata->info.lamports;
-    header.info.rent_epoch             = header.info.lamports ? metadata->info.rent_epoch : 0UL;
-    fd_memcpy( header.info.owner, metadata->info.owner, sizeof(fd_pubkey_t) );
-    header.info.executable             = metadata->info.executable;
-    /* Hash */
-    fd_memcpy( &header.hash, metadata->hash, sizeof(fd_hash_t) );
+  if( FD_UNLIKELY( plan->frame_cnt>frame_max_cnt ) ) {
+    FD_LOG_CRIT(( "invariant violation: frame_cnt=%lu frame_max_cnt=%lu", plan->frame_cnt, frame_max_cnt ));
+  }
 
-    err = fd_tar_writer_write_file_data( writer, &header, sizeof(fd_solana_account_hdr_t) );
-    if( FD_UNLIKELY( err ) ) {
-      FD_LOG_ERR(( "Unable to stream out account header to tar archive" ));
-    }
+  FD_LOG_NOTICE(( "Writing out %lu accounts in %lu account vecs and %lu frames", rec_cnt, num_slots, plan->frame_cnt ));
+}
 
-    /* Write out the file data. */
+/* fd_snapshot_create_frame_emit feeds data_sz bytes at data to the
+   frame being compressed in cctx.  output is sized for the entire
+   frame, such that the compressor never runs out of space. */
 
-    err = fd_tar_writer_write_file_data( writer, acc_data, metadata->dlen );
-    if( FD_UNLIKELY( err ) ) {
-      FD_LOG_ERR(( "Unable to stream out account data to tar archive" ));
+static void
+fd_snapshot_create_frame_emit( ZSTD_CCtx *      cctx,
+                               ZSTD_outBuffer * output,
+                               void const *     data,
+                               ulong            data_sz ) {
+  ZSTD_inBuffer input = { data, data_sz, 0UL };
+  while( input.pos<input.size ) {
+    ulong ret = ZSTD_compressStream2( cctx, output, &input, ZSTD_e_continue );
+    if( FD_UNLIKELY( ZSTD_isError( ret ) ) ) {
+      FD_LOG_ERR(( "Compression error: %s", ZSTD_getErrorName( ret ) ));
     }
-
-    ulong align_sz = fd_ulong_align_up( metadata->dlen, FD_SNAPSHOT_ACC_ALIGN ) - metadata->dlen;
-    err = fd_tar_writer_write_file_data( writer, padding, align_sz );
-    if( FD_UNLIKELY( err ) ) {
-      FD_LOG_ERR( ("Unable to stream out account padding to tar archive" ));
+    if( FD_UNLIKELY( output->pos==output->size && input.pos<input.size ) ) {
+      FD_LOG_ERR(( "Compressed frame overflows its buffer" ));
     }
   }
+}
 
-  err = fd_tar_writer_fini_file( writer );
-  if( FD_UNLIKELY( err ) ) {
-    FD_LOG_ERR(( "Unable to finalize previous accounts file" ));
-  }
-
-  /* Now write out the append vec for the snapshot slot. Again, this is needed
-     because the snapshot slot's accounts must be in their append vec in order
-     to verify the bank hash for the snapshot slot in the Agave client. */
-
-  fd_snapshot_acc_vec_t * curr_accs = &accounts_db->storages[ 0UL ].account_vecs[ 0UL ];
-  err = snprintf( buffer, FD_SNAPSHOT_DIR_MAX, "accounts/%lu.%lu", snapshot_ctx->slot, curr_accs->id );
-  if( FD_UNLIKELY( err<0 ) ) {
-    FD_LOG_ERR(( "Unable to format current accounts name string" ));
-  }
+/* fd_snapshot_create_frame_task compresses the frame frame0+n0 of the
+   plan with the compression state of worker n0. */
 
-  err = fd_tar_writer_new_file( writer, buffer );
-  if( FD_UNLIKELY( err ) ) {
-    FD_LOG_ERR(( "Unable to create current accounts file" ));
+static void
+fd_snapshot_create_frame_task( void * tpool,
+                               ulong  t0     FD_PARAM_UNUSED, ulong t1 FD_PARAM_UNUSED,
+                               void * args   FD_PARAM_UNUSED,
+                               void * reduce FD_PARAM_UNUSED, ulong stride FD_PARAM_UNUSED,
+                               ulong  l0     FD_PARAM_UNUSED, ulong l1 FD_PARAM_UNUSED,
+                               ulong  m0     FD_PARAM_UNUSED, ulong m1 FD_PARAM_UNUSED,
+                               ulong  n0,                     ulong n1 FD_PARAM_UNUSED ) {
+  fd_snapshot_create_plan_t *  plan  = (fd_snapshot_create_plan_t *)tpool;
+  fd_snapshot_create_frame_t * frame = &plan->frame[ plan->frame0 + n0 ];
+  ZSTD_CCtx *                  cctx  = plan->cctx[ n0 ];
+  fd_funk_t *                  funk  = plan->funk;
+
+  ZSTD_CCtx_reset( cctx, ZSTD_reset_session_only );
+  ulong ret = ZSTD_CCtx_setPledgedSrcSize( cctx, frame->in_sz );
+  if( FD_UNLIKELY( ZSTD_isError( ret ) ) ) {
+    FD_LOG_ERR(( "Unable to start a zstd frame: %s", ZSTD_getErrorName( ret ) ));
   }
 
-  for( ulong i=0UL; i<snapshot_slot_key_cnt; i++ ) {
-    
-    fd_pubkey_t const * pubkey = snapshot_slot_keys[i];
-    fd_funk_rec_key_t key = fd_acc_funk_key( pubkey );
+  ZSTD_outBuffer    output = { plan->out[ n0 ], plan->out_max, 0UL };
+  fd_account_meta_t tmp_meta[1];
+  for( ulong v=0UL; v<plan->vec_cnt; v++ ) {
+    fd_snapshot_create_vec_t const * vec     = &plan->vec[ v ];
+    ulong                            item_lo = vec->rec_lo + 2UL*v;
+    ulong                            item_hi = vec->rec_hi + 2UL*v + 2UL;
+    if( item_hi<=frame->item_lo || item_lo>=frame->item_hi ) continue;
+
+    ulong item0 = fd_ulong_max( item_lo, frame->item_lo );
+    ulong item1 = fd_ulong_min( item_hi, frame->item_hi );
+    for( ulong item=item0; item<item1; item++ ) {
+
+      if( item==item_lo ) {
+        char          name[ FD_SNAPSHOT_DIR_MAX ];
+        fd_tar_meta_t meta[1];
+        fd_snapshot_create_vec_name( name, vec );
+        if( FD_UNLIKELY( !fd_tar_meta_init_file( meta, name, vec->file_sz ) ) ) {
+          FD_LOG_ERR(( "Unable to create the tar header for file=%s", name ));
+        }
+        fd_snapshot_create_frame_emit( cctx, &output, meta, FD_TAR_BLOCK_SZ );
+        continue;
+      }
 
-    fd_funk_rec_t const * rec = fd_funk_rec_query( funk, NULL, &key );
-    if( FD_UNLIKELY( !rec ) ) {
-      FD_LOG_ERR(( "Previously found record can no longer be found" ));
-    }
+      if( item==item_hi-1UL ) {
+        fd_snapshot_create_frame_emit( cctx, &output, padding, fd_ulong_align_up( vec->file_sz, FD_TAR_BLOCK_SZ ) - vec->file_sz );
+        continue;
+      }
 
-    int                 is_tombstone = rec->flags & FD_FUNK_REC_FLAG_ERASE;
-    uchar       const * raw          = fd_funk_val( rec, fd_funk_wksp( funk ) );
-    fd_account_meta_t * metadata     = is_tombstone ? fd_snapshot_create_get_default_meta( fd_funk_rec_get_erase_data( rec ) ) : 
-                                                      (fd_account_meta_t*)raw;
+      fd_funk_rec_t const *     rec      = plan->rec[ vec->rec_lo + item - item_lo - 1UL ];
+      fd_pubkey_t const *       pubkey   = fd_type_pun_const( rec->pair.key[0].uc );
+      fd_account_meta_t const * metadata = fd_snapshot_create_rec_meta( funk, rec, tmp_meta );
+      uchar const *             acc_data = (uchar const *)metadata + metadata->hlen;
 
-    if( FD_UNLIKELY( !metadata ) ) {
-      FD_LOG_ERR(( "Record should have non-NULL metadata" ));
+      fd_solana_account_hdr_t header[1];
+      fd_snapshot_create_acc_hdr( header, pubkey, metadata );
+      fd_snapshot_create_frame_emit( cctx, &output, header,   sizeof(fd_solana_account_hdr_t) );
+      fd_snapshot_create_frame_emit( cctx, &output, acc_data, metadata->dlen );
+      fd_snapshot_create_frame_emit( cctx, &output, padding,  fd_ulong_align_up( metadata->dlen, FD_SNAPSHOT_ACC_ALIGN ) - metadata->dlen );
     }
+  }
 
-    if( FD_UNLIKELY( metadata->magic!=FD_ACCOUNT_META_MAGIC ) ) {
-      FD_LOG_ERR(( "Record should have valid magic" ));
+  ZSTD_inBuffer input = { NULL, 0UL, 0UL };
+  do {
+    ret = ZSTD_compressStream2( cctx, &output, &input, ZSTD_e_end );
+    if( FD_UNLIKELY( ZSTD_isError( ret ) ) ) {
+      FD_LOG_ERR(( "Compression error: %s", ZSTD_getErrorName( ret ) ));
     }
+    if( FD_UNLIKELY( ret && output.pos==output.size ) ) {
+      FD_LOG_ERR(( "Compressed frame overflows its buffer" ));
+    }
+  } while( ret );
 
-    uchar const * acc_data = raw + metadata->hlen;
-
-    curr_accs->file_sz += sizeof(fd_solana_account_hdr_t) + fd_ulong_align_up( metadata->dlen, FD_SNAPSHOT_ACC_ALIGN );
-
-    /* Write out the header. */
-    fd_solana_account_hdr_t header = {0};
-    /* Stored meta */
-    header.meta.write_version_obsolete = 0UL;
-    header.meta.data_len               = metadata->dlen;
-    fd_memcpy( header.meta.pubkey, pubkey, sizeof(fd_pubkey_t) );
-    /* Account Meta */
-    header.info.lamports               = metadata->info.lamports;
-    header.info.rent_epoch             = header.info.lamports ? metadata->info.rent_epoch : 0UL;
-    fd_memcpy( header.info.owner, metadata->info.owner, sizeof(fd_pubkey_t) );
-    header.info.executable             = metadata->info.executable;
-    /* Hash */
-    fd_memcpy( &header.hash, metadata->hash, sizeof(fd_hash_t) );
+  frame->out_sz = output.pos;
+}
 
+/* fd_snapshot_create_write_acc_vecs writes out the account vec part of
+   the archive laid out in plan.  The frames are compressed in rounds of
+   one frame per tpool worker and written out in order after each
+   round. */
 
-    err = fd_tar_writer_write_file_data( writer, &header, sizeof(fd_solana_account_hdr_t) );
-    if( FD_UNLIKELY( err ) ) {
-      FD_LOG_ERR(( "Unable to stream out account header to tar archive" ));
+static void
+fd_snapshot_create_write_acc_vecs( fd_snapshot_ctx_t *           snapshot_ctx,
+                                   fd_snapshot_create_stream_t * stream,
+                                   fd_snapshot_create_plan_t *   plan ) {
+
+  fd_tpool_t * tpool      = snapshot_ctx->tpool;
+  ulong        worker_cnt = fd_ulong_min( tpool ? fd_tpool_worker_cnt( tpool ) : 1UL, plan->frame_cnt );
+
+  plan->out_max = ZSTD_compressBound( plan->frame_max );
+  plan->cctx    = fd_valloc_malloc( snapshot_ctx->valloc, alignof(ZSTD_CCtx *), sizeof(ZSTD_CCtx *) * worker_cnt );
+  plan->out     = fd_valloc_malloc( snapshot_ctx->valloc, alignof(uchar *),     sizeof(uchar *)     * worker_cnt );
+  for( ulong i=0UL; i<worker_cnt; i++ ) {
+    plan->cctx[ i ] = ZSTD_createCCtx();
+    if( FD_UNLIKELY( !plan->cctx[ i ] ) ) {
+      FD_LOG_ERR(( "Failed to create a zstd compression context" ));
     }
-    err = fd_tar_writer_write_file_data( writer, acc_data, metadata->dlen );
-    if( FD_UNLIKELY( err ) ) {
-      FD_LOG_ERR(( "Unable to stream out account data to tar archive" ));
+    ZSTD_CCtx_setParameter( plan->cctx[ i ], ZSTD_c_compressionLevel, ZSTD_CLEVEL_DEFAULT );
+    ZSTD_CCtx_setParameter( plan->cctx[ i ], ZSTD_c_contentSizeFlag,  1                   );
+    plan->out[ i ] = fd_valloc_malloc( snapshot_ctx->valloc, FD_ZSTD_CSTREAM_ALIGN, plan->out_max );
+  }
+
+  for( plan->frame0=0UL; plan->frame0<plan->frame_cnt; plan->frame0+=worker_cnt ) {
+    ulong round_cnt = fd_ulong_min( worker_cnt, plan->frame_cnt - plan->frame0 );
+    if( round_cnt<=1UL ) {
+      fd_snapshot_create_frame_task( plan, 0UL, 1UL, NULL, NULL, 0UL, 0UL, 0UL, 0UL, 1UL, 0UL, 1UL );
+    } else {
+      fd_tpool_exec_all_raw( tpool, 0UL, round_cnt, fd_snapshot_create_frame_task, plan, NULL, NULL, 1UL, 0UL, round_cnt );
     }
-    ulong align_sz = fd_ulong_align_up( metadata->dlen, FD_SNAPSHOT_ACC_ALIGN ) - metadata->dlen;
-    err = fd_tar_writer_write_file_data( writer, padding, align_sz );
-    if( FD_UNLIKELY( err ) ) {
-      FD_LOG_ERR(( "Unable to stream out account padding to tar archive" ));
+
+    for( ulong i=0UL; i<round_cnt; i++ ) {
+      int err = fd_io_buffered_ostream_write( stream->ostream, plan->out[ i ], plan->frame[ plan->frame0 + i ].out_sz );
+      if( FD_UNLIKELY( err ) ) {
+        FD_LOG_ERR(( "Failed to write out the compressed file (%i-%s)", err, fd_io_strerror( err ) ));
+      }
     }
   }
 
-  err = fd_tar_writer_fini_file( writer );
-  if( FD_UNLIKELY( err ) ) {
-    FD_LOG_ERR(( "Unable to finish writing out file" ));
+  for( ulong i=0UL; i<worker_cnt; i++ ) {
+    fd_valloc_free( snapshot_ctx->valloc, plan->out[ i ] );
+    ZSTD_freeCCtx( plan->cctx[ i ] );
   }
+  fd_valloc_free( snapshot_ctx->valloc, plan->out  );
+  fd_valloc_free( snapshot_ctx->valloc, plan->cctx );
 
-  /* TODO: At this point we must implement compaction to the snapshot service. 
+  /* TODO: At this point we must implement compaction to the snapshot service.
      Without this, we are actually not cleaning up any tombstones from funk. */
 
   if( snapshot_ctx->is_incremental ) {
+    fd_funk_t * funk = plan->funk;
     fd_funk_start_write( funk );
-    err = fd_funk_rec_forget( funk, tombstones, tombstones_cnt );
+    int err = fd_funk_rec_forget( funk, plan->tombstones, plan->tombstones_cnt );
     if( FD_UNLIKELY( err!=FD_FUNK_SUCCESS ) ) {
       FD_LOG_ERR(( "Unable to forget tombstones" ));
     }
-    FD_LOG_NOTICE(( "Compacted %lu tombstone records", tombstones_cnt ));
+    FD_LOG_NOTICE(( "Compacted %lu tombstone records", plan->tombstones_cnt ));
     fd_funk_end_write( funk );
   }
 
-  fd_valloc_free( snapshot_ctx->valloc, snapshot_slot_keys );
-  fd_valloc_free( snapshot_ctx->valloc, tombstones );
+  fd_valloc_free( snapshot_ctx->valloc, plan->frame      );
+  fd_valloc_free( snapshot_ctx->valloc, plan->vec        );
+  fd_valloc_free( snapshot_ctx->valloc, plan->rec        );
+  fd_valloc_free( snapshot_ctx->valloc, plan->tombstones );
 
 }
 
@@ -707,6 +954,7 @@ fd_snapshot_create_populate_bank( fd_snapshot_ctx_t *                snapshot_ct
 
 }
 
+
 static inline void
 fd_snapshot_create_setup_and_validate_ctx( fd_snapshot_ctx_t * snapshot_ctx ) {
 
@@ -791,18 +1039,9 @@ fd_snapshot_create_setup_and_validate_ctx( fd_snapshot_ctx_t * snapshot_ctx ) {
                      snapshot_ctx->slot, snapshot_ctx->slot_bank.slot ));
   }
 
-  /* Truncate the two files used for snapshot creation and seek to its start. */
+  /* Truncate the snapshot file and seek to its start. */
 
-  long seek = lseek( snapshot_ctx->tmp_fd, 0, SEEK_SET );
-  if( FD_UNLIKELY( seek ) ) {
-    FD_LOG_ERR(( "Failed to seek to the start of the file" ));
-  }
-
-  if( FD_UNLIKELY( ftruncate( snapshot_ctx->tmp_fd, 0UL ) < 0 ) ) {
-    FD_LOG_ERR(( "Failed to truncate the temporary file" ));
-  }
-
-  seek = lseek( snapshot_ctx->snapshot_fd, 0, SEEK_SET );
+  long seek = lseek( snapshot_ctx->snapshot_fd, 0, SEEK_SET );
   if( FD_UNLIKELY( seek ) ) {
     FD_LOG_ERR(( "Failed to seek to the start of the file" ));
   }
@@ -813,42 +1052,47 @@ fd_snapshot_create_setup_and_validate_ctx( fd_snapshot_ctx_t * snapshot_ctx ) {
 
 }
 
+
 static inline void
-fd_snapshot_create_setup_writer( fd_snapshot_ctx_t * snapshot_ctx ) {
-  
-  /* Setup a tar writer. */
+fd_snapshot_create_setup_stream( fd_snapshot_ctx_t *           snapshot_ctx,
+                                 fd_snapshot_create_stream_t * stream ) {
 
-  uchar * writer_mem   = fd_valloc_malloc( snapshot_ctx->valloc, fd_tar_writer_align(), fd_tar_writer_footprint() );
-  snapshot_ctx->writer = fd_tar_writer_new( writer_mem, snapshot_ctx->tmp_fd );
-  if( FD_UNLIKELY( !snapshot_ctx->writer ) ) {
-    FD_LOG_ERR(( "Unable to create a tar writer" ));
-  }
-}
+  /* Setup the zstd compression context for the serially written part of
+     the archive and the buffered output stream for the snapshot file.
 
-static inline void
-fd_snapshot_create_write_version( fd_snapshot_ctx_t * snapshot_ctx ) {
+     TODO: Currently, the snapshot service interfaces directly with the zstd
+     library but a generalized cstream defined in fd_zstd should be used
+     instead. */
 
-  /* The first file in the tar archive should be the version file.. */
+  ulong out_buf_sz    = ZSTD_CStreamOutSize();
+  stream->zstd_buf_sz = ZSTD_CStreamOutSize();
+  stream->zstd_buf    = fd_valloc_malloc( snapshot_ctx->valloc, FD_ZSTD_CSTREAM_ALIGN, stream->zstd_buf_sz );
+  stream->out_buf     = fd_valloc_malloc( snapshot_ctx->valloc, FD_ZSTD_CSTREAM_ALIGN, out_buf_sz );
+  stream->frame_sz    = 0UL;
 
-  int err = fd_tar_writer_new_file( snapshot_ctx->writer, FD_SNAPSHOT_VERSION_FILE );
-  if( FD_UNLIKELY( err ) ) {
-    FD_LOG_ERR(( "Failed to create the version file" ));
+  stream->cctx = ZSTD_createCCtx();
+  if( FD_UNLIKELY( !stream->cctx ) ) {
+    FD_LOG_ERR(( "Failed to create the zstd compression stream" ));
   }
+  ZSTD_CCtx_setParameter( stream->cctx, ZSTD_c_compressionLevel, ZSTD_CLEVEL_DEFAULT );
 
-  err = fd_tar_writer_write_file_data( snapshot_ctx->writer, FD_SNAPSHOT_VERSION, FD_SNAPSHOT_VERSION_LEN);
-  if( FD_UNLIKELY( err ) ) {
-    FD_LOG_ERR(( "Failed to create the version file" ));
+  if( FD_UNLIKELY( !fd_io_buffered_ostream_init( stream->ostream, snapshot_ctx->snapshot_fd, stream->out_buf, out_buf_sz ) ) ) {
+    FD_LOG_ERR(( "Failed to initialize the ostream" ));
   }
+}
 
-  err = fd_tar_writer_fini_file( snapshot_ctx->writer );
-  if( FD_UNLIKELY( err ) ) {
-    FD_LOG_ERR(( "Failed to create the version file" ));
-  }
+static inline void
+fd_snapshot_create_write_version( fd_snapshot_create_stream_t * stream ) {
+
+  /* The first file in the tar archive should be the version file.. */
+
+  fd_snapshot_create_stream_write_file( stream, FD_SNAPSHOT_VERSION_FILE, FD_SNAPSHOT_VERSION, FD_SNAPSHOT_VERSION_LEN );
 
 }
 
 static inline void
-fd_snapshot_create_write_status_cache( fd_snapshot_ctx_t *  snapshot_ctx ) {
+fd_snapshot_create_write_status_cache( fd_snapshot_ctx_t *           snapshot_ctx,
+                                       fd_snapshot_create_stream_t * stream ) {
 
   FD_SCRATCH_SCOPE_BEGIN {
 
@@ -862,7 +1106,7 @@ fd_snapshot_create_write_status_cache( fd_snapshot_ctx_t *  snapshot_ctx ) {
   }
   ulong   bank_slot_deltas_sz = fd_bank_slot_deltas_size( &slot_deltas_new );
   uchar * out_status_cache    = fd_valloc_malloc( snapshot_ctx->valloc,
-                                                  FD_BANK_SLOT_DELTAS_ALIGN, 
+                                                  FD_BANK_SLOT_DELTAS_ALIGN,
                                                   bank_slot_deltas_sz );
   fd_bincode_encode_ctx_t encode_status_cache = {
     .data    = out_status_cache,
@@ -874,18 +1118,7 @@ fd_snapshot_create_write_status_cache( fd_snapshot_ctx_t *  snapshot_ctx ) {
 
   /* Now write out the encoded buffer to the tar archive. */
 
-  err = fd_tar_writer_new_file( snapshot_ctx->writer, FD_SNAPSHOT_STATUS_CACHE_FILE );
-  if( FD_UNLIKELY( err ) ) {
-    FD_LOG_ERR(( "Failed to create the status cache file" ));
-  }
-  err = fd_tar_writer_write_file_data( snapshot_ctx->writer, out_status_cache, bank_slot_deltas_sz );
-  if( FD_UNLIKELY( err ) ) {
-    FD_LOG_ERR(( "Failed to create the status cache file" ));
-  }
-  err = fd_tar_writer_fini_file( snapshot_ctx->writer );
-  if( FD_UNLIKELY( err ) ) {
-    FD_LOG_ERR(( "Failed to create the status cache file" ));
-  }
+  fd_snapshot_create_stream_write_file( stream, FD_SNAPSHOT_STATUS_CACHE_FILE, out_status_cache, bank_slot_deltas_sz );
 
   /* Registers all roots and unconstipates the status cache. */
 
@@ -898,13 +1131,14 @@ fd_snapshot_create_write_status_cache( fd_snapshot_ctx_t *  snapshot_ctx ) {
 }
 
 static inline void
-fd_snapshot_create_write_manifest_and_acc_vecs( fd_snapshot_ctx_t * snapshot_ctx,
-                                                fd_hash_t *         out_hash,
-                                                ulong *             out_capitalization ) {
+fd_snapshot_create_write_manifest_and_acc_vecs( fd_snapshot_ctx_t *           snapshot_ctx,
+                                                fd_snapshot_create_stream_t * stream,
+                                                fd_hash_t *                   out_hash,
+                                                ulong *                       out_capitalization ) {
 
 
   fd_solana_manifest_serializable_t manifest = {0};
-  
+
   /* Copy in all the fields of the bank. */
 
   fd_snapshot_create_populate_bank( snapshot_ctx, &manifest.bank );
@@ -921,12 +1155,13 @@ fd_snapshot_create_write_manifest_and_acc_vecs( fd_snapshot_ctx_t * snapshot_ctx
   manifest.versioned_epoch_stakes_len            = 0UL;
   manifest.versioned_epoch_stakes                = NULL;
 
-  /* Populate the append vec index and write out the corresponding acc files. */
+  /* Populate the append vec index and lay out the corresponding acc files. */
 
-  ulong incr_capitalization = 0UL;
-  fd_snapshot_create_populate_acc_vecs( snapshot_ctx, &manifest, snapshot_ctx->writer, &incr_capitalization );
+  ulong                     incr_capitalization = 0UL;
+  fd_snapshot_create_plan_t plan[1];
+  fd_snapshot_create_populate_acc_vecs( snapshot_ctx, &manifest, plan, &incr_capitalization );
 
-  /* Once the append vec index is populated and the hashes are calculated, 
+  /* Once the append vec index is populated and the hashes are calculated,
      propogate the hashes to the correct fields. As a note, the last_snap_hash
      is the full snapshot's account hash. */
 
@@ -941,15 +1176,14 @@ fd_snapshot_create_write_manifest_and_acc_vecs( fd_snapshot_ctx_t * snapshot_ctx
     *out_capitalization = snapshot_ctx->slot_bank.capitalization;
   }
 
-  /* At this point, all of the account files are written out and the append
-     vec index is populated in the manifest. We have already reserved space
-     in the archive for the manifest. All we need to do now is encode the 
-     manifest and write it in. */
+  /* At this point, the append vec index is populated in the manifest and
+     the account files are laid out. Encode the manifest and write it
+     out ahead of the account files. */
 
-  ulong   manifest_sz  = fd_solana_manifest_serializable_size( &manifest ); 
+  ulong   manifest_sz  = fd_solana_manifest_serializable_size( &manifest );
   uchar * out_manifest = fd_valloc_malloc( snapshot_ctx->valloc, FD_SOLANA_MANIFEST_SERIALIZABLE_ALIGN, manifest_sz );
 
-  fd_bincode_encode_ctx_t encode = { 
+  fd_bincode_encode_ctx_t encode = {
     .data    = out_manifest,
     .dataend = out_manifest + manifest_sz
   };
@@ -958,22 +1192,25 @@ fd_snapshot_create_write_manifest_and_acc_vecs( fd_snapshot_ctx_t * snapshot_ctx
   if( FD_UNLIKELY( err ) ) {
     FD_LOG_ERR(( "Failed to encode the manifest" ));
   }
-  
-  err = fd_tar_writer_fill_space( snapshot_ctx->writer, out_manifest, manifest_sz );
-  if( FD_UNLIKELY( err ) ) {
-    FD_LOG_ERR(( "Failed to write out the manifest" ));
-  }
 
-  void * mem = fd_tar_writer_delete( snapshot_ctx->writer );
-  if( FD_UNLIKELY( !mem ) ) {
-    FD_LOG_ERR(( "Unable to delete the tar writer" ));
+  char buffer[ FD_SNAPSHOT_DIR_MAX ];
+  err = snprintf( buffer, FD_SNAPSHOT_DIR_MAX, "snapshots/%lu/%lu", snapshot_ctx->slot, snapshot_ctx->slot );
+  if( FD_UNLIKELY( err<0 ) ) {
+    FD_LOG_ERR(( "Unable to format manifest name string" ));
   }
 
+  fd_snapshot_create_stream_write_file( stream, buffer, out_manifest, manifest_sz );
+  fd_snapshot_create_stream_end_frame( stream );
+
+  /* Now compress and write out the account files. */
+
+  fd_snapshot_create_write_acc_vecs( snapshot_ctx, stream, plan );
+
   fd_bincode_destroy_ctx_t destroy = {
     .valloc  = snapshot_ctx->valloc
   };
 
-  /* This is kind of a hack but we need to do this so we don't accidentally 
+  /* This is kind of a hack but we need to do this so we don't accidentally
      corrupt memory when we try to double destory. Everything below is
      things that aren't stack allocated from the manifest including the banks. */
 
@@ -985,119 +1222,31 @@ fd_snapshot_create_write_manifest_and_acc_vecs( fd_snapshot_ctx_t * snapshot_ctx
   if( snapshot_ctx->is_incremental ) {
     fd_valloc_free( snapshot_ctx->valloc, manifest.bank_incremental_snapshot_persistence );
   }
-  fd_valloc_free( snapshot_ctx->valloc, out_manifest );  
+  fd_valloc_free( snapshot_ctx->valloc, out_manifest );
 
 }
 
 static inline void
-fd_snapshot_create_compress( fd_snapshot_ctx_t * snapshot_ctx ) {
-
-  /* Compress the file using zstd. First open the non-compressed file and
-     create a file for the compressed file. The reason why we can't do this
-     as we stream out the snapshot archive is that we write back into the
-     manifest buffer. 
-     
-     TODO: A way to eliminate this and to just stream out
-     1 compressed file would be to totally precompute the index such that 
-     we don't have to write back into funk.
-     
-     TODO: Currently, the snapshot service interfaces directly with the zstd 
-     library but a generalized cstream defined in fd_zstd should be used 
-     instead. */
-
-  ulong in_buf_sz   = ZSTD_CStreamInSize();
-  ulong zstd_buf_sz = ZSTD_CStreamOutSize();
-  ulong out_buf_sz  = ZSTD_CStreamOutSize();
-
-  char * in_buf   = fd_valloc_malloc( snapshot_ctx->valloc, FD_ZSTD_CSTREAM_ALIGN, in_buf_sz );
-  char * zstd_buf = fd_valloc_malloc( snapshot_ctx->valloc, FD_ZSTD_CSTREAM_ALIGN, out_buf_sz );
-  char * out_buf  = fd_valloc_malloc( snapshot_ctx->valloc, FD_ZSTD_CSTREAM_ALIGN, out_buf_sz );
-
-  /* Reopen the tarball and open/overwrite the filename for the compressed,
-     finalized full snapshot. Setup the zstd compression stream. */
-
-  int err = 0;
-
-  ZSTD_CStream * cstream = ZSTD_createCStream();
-  if( FD_UNLIKELY( !cstream ) ) {
-    FD_LOG_ERR(( "Failed to create the zstd compression stream" ));
-  }
-  ZSTD_initCStream( cstream, ZSTD_CLEVEL_DEFAULT ); 
-
-  fd_io_buffered_ostream_t ostream[1];
+fd_snapshot_create_finalize( fd_snapshot_ctx_t *           snapshot_ctx,
+                             fd_snapshot_create_stream_t * stream ) {
 
-  if( FD_UNLIKELY( !fd_io_buffered_ostream_init( ostream, snapshot_ctx->snapshot_fd, out_buf, out_buf_sz ) ) ) {
-    FD_LOG_ERR(( "Failed to initialize the ostream" ));
-  }
-
-  long seek = lseek( snapshot_ctx->snapshot_fd, 0, SEEK_SET );
-  if( FD_UNLIKELY( seek!=0L ) ) {
-    FD_LOG_ERR(( "Failed to seek to the start of the file" ));
-  }
-
-  /* At this point, the tar archive and the new zstd file is open. The zstd
-     streamer is still open. Now, we are ready to read in bytes and stream
-     compress them. We will keep going until we see an EOF in a tar archive. */
-
-  ulong in_sz = in_buf_sz;
-
-  ulong off = (ulong)lseek( snapshot_ctx->tmp_fd, 0, SEEK_SET );
-  if( FD_UNLIKELY( off ) ) {
-    FD_LOG_ERR(( "Failed to seek to the beginning of the file" ));
-  }
-
-  while( in_sz==in_buf_sz ) {
-
-    /* Read chunks from the file. There isn't really a need to use a streamed
-       reader here because we will read in the max size buffer for every single
-       file read except for the very last one.
-       
-       in_sz will only not equal in_buf_sz on the last read. */
-    err = fd_io_read( snapshot_ctx->tmp_fd, in_buf, 0UL, in_buf_sz, &in_sz );
-    if( FD_UNLIKELY( err ) ) {
-      FD_LOG_ERR(( "Failed to read in the file" ));
-    }
+  /* The end of a tar archive is marked with two EOF blocks.  Write them
+     out in a final frame, flush the snapshot file and deinit any data
+     structures. */
 
-    /* Compress the in memory buffer and add it to the output stream. */
-  
-    ZSTD_inBuffer input = { in_buf, in_sz, 0UL };
-    while( input.pos<input.size ) {
-      ZSTD_outBuffer output = { zstd_buf, zstd_buf_sz, 0UL };
-      ulong          ret    = ZSTD_compressStream( cstream, &output, &input );
-
-      if( FD_UNLIKELY( ZSTD_isError( ret ) ) ) {
-        FD_LOG_ERR(( "Compression error: %s\n", ZSTD_getErrorName( ret ) ));
-      }
-
-      err = fd_io_buffered_ostream_write( ostream, zstd_buf, output.pos );
-      if( FD_UNLIKELY( err ) ) {
-        FD_LOG_ERR(( "Failed to write out the compressed file" ));
-      }
-    }
-  }
-
-  /* Now flush any bytes left in the zstd buffer, cleanup open file 
-     descriptors, and deinit any data structures.  */
+  fd_snapshot_create_stream_write( stream, padding, FD_TAR_BLOCK_SZ );
+  fd_snapshot_create_stream_write( stream, padding, FD_TAR_BLOCK_SZ );
+  fd_snapshot_create_stream_end_frame( stream );
 
-  ZSTD_outBuffer output    = { zstd_buf, zstd_buf_sz, 0UL };
-  ulong          remaining = ZSTD_endStream(  cstream, &output );
-
-  if( FD_UNLIKELY( ZSTD_isError( remaining ) ) ) {
-    FD_LOG_ERR(( "Unable to end the zstd stream" ));
-  }   
-  if( output.pos>0UL ) {
-    fd_io_buffered_ostream_write( ostream, zstd_buf, output.pos );
-  }
-
-  fd_valloc_free( snapshot_ctx->valloc, in_buf );
-  fd_valloc_free( snapshot_ctx->valloc, zstd_buf );
-  fd_valloc_free( snapshot_ctx->valloc, out_buf );
-
-  ZSTD_freeCStream( cstream ); /* Works even if cstream is null */
-  err = fd_io_buffered_ostream_flush( ostream );
+  int err = fd_io_buffered_ostream_flush( stream->ostream );
   if( FD_UNLIKELY( err ) ) {
     FD_LOG_ERR(( "Failed to flush the ostream" ));
   }
+  fd_io_buffered_ostream_fini( stream->ostream );
+
+  ZSTD_freeCCtx( stream->cctx );
+  fd_valloc_free( snapshot_ctx->valloc, stream->zstd_buf );
+  fd_valloc_free( snapshot_ctx->valloc, stream->out_buf );
 
   /* Assuming that there was a successful write, make the compressed
      snapshot file readable and servable. */
@@ -1110,10 +1259,10 @@ fd_snapshot_create_compress( fd_snapshot_ctx_t * snapshot_ctx ) {
 
   char directory_buf_zstd[ FD_SNAPSHOT_DIR_MAX ];
   if( !snapshot_ctx->is_incremental ) {
-    err = snprintf( directory_buf_zstd, FD_SNAPSHOT_DIR_MAX, "%s/snapshot-%lu-%s.tar.zst", 
+    err = snprintf( directory_buf_zstd, FD_SNAPSHOT_DIR_MAX, "%s/snapshot-%lu-%s.tar.zst",
                     snapshot_ctx->out_dir, snapshot_ctx->slot, FD_BASE58_ENC_32_ALLOCA(&snapshot_ctx->snap_hash) );
   } else {
-    err = snprintf( directory_buf_zstd, FD_SNAPSHOT_DIR_MAX, "%s/incremental-snapshot-%lu-%lu-%s.tar.zst", 
+    err = snprintf( directory_buf_zstd, FD_SNAPSHOT_DIR_MAX, "%s/incremental-snapshot-%lu-%lu-%s.tar.zst",
                     snapshot_ctx->out_dir, snapshot_ctx->last_snap_slot, snapshot_ctx->slot, FD_BASE58_ENC_32_ALLOCA(&snapshot_ctx->snap_hash) );
   }
 
@@ -1129,8 +1278,8 @@ fd_snapshot_create_compress( fd_snapshot_ctx_t * snapshot_ctx ) {
 }
 
 void
-fd_snapshot_create_new_snapshot( fd_snapshot_ctx_t * snapshot_ctx, 
-                                 fd_hash_t *         out_hash, 
+fd_snapshot_create_new_snapshot( fd_snapshot_ctx_t * snapshot_ctx,
+                                 fd_hash_t *         out_hash,
                                  ulong *             out_capitalization ) {
 
   FD_SCRATCH_SCOPE_BEGIN {
@@ -1141,25 +1290,26 @@ fd_snapshot_create_new_snapshot( fd_snapshot_ctx_t * snapshot_ctx,
 
   fd_snapshot_create_setup_and_validate_ctx( snapshot_ctx );
 
-  /* Setup the tar archive writer. */
+  /* Setup the compressed output stream. */
 
-  fd_snapshot_create_setup_writer( snapshot_ctx );
+  fd_snapshot_create_stream_t stream[1];
+  fd_snapshot_create_setup_stream( snapshot_ctx, stream );
 
   /* Write out the version file. */
 
-  fd_snapshot_create_write_version( snapshot_ctx );
+  fd_snapshot_create_write_version( stream );
 
   /* Dump the status cache and append it to the tar archive. */
 
-  fd_snapshot_create_write_status_cache( snapshot_ctx );
+  fd_snapshot_create_write_status_cache( snapshot_ctx, stream );
 
   /* Populate and write out the manifest and append vecs. */
 
-  fd_snapshot_create_write_manifest_and_acc_vecs( snapshot_ctx, out_hash, out_capitalization );
+  fd_snapshot_create_write_manifest_and_acc_vecs( snapshot_ctx, stream, out_hash, out_capitalization );
 
-  /* Compress the tar file and write it out to the specified directory. */
+  /* Finish the archive and move it to its final name in the specified directory. */
 
-  fd_snapshot_create_compress( snapshot_ctx );
+  fd_snapshot_create_finalize( snapshot_ctx, stream );
 
   FD_LOG_NOTICE(("Finished producing a snapshot" ));
 
@@ -19,8 +19,6 @@
 #define FD_SNAPSHOT_VERSION_LEN           (5UL)
 #define FD_SNAPSHOT_STATUS_CACHE_FILE     ("snapshots/status_cache")
 
-#define FD_SNAPSHOT_TMP_ARCHIVE           (".tmp.tar")
-#define FD_SNAPSHOT_TMP_INCR_ARCHIVE      (".tmp_inc.tar")
 #define FD_SNAPSHOT_TMP_FULL_ARCHIVE_ZSTD (".tmp.tar.zst")
 #define FD_SNAPSHOT_TMP_INCR_ARCHIVE_ZSTD (".tmp_inc.tar.zst")
 
@@ -31,6 +29,12 @@
    TODO: Figure out exactly what those problems are. */
 #define FD_SNAPSHOT_APPEND_VEC_SZ_MAX     (2UL * 1024UL * 1024UL * 1024UL) /* 2 MiB */
 
+/* FD_SNAPSHOT_ZSTD_FRAME_SZ is the target uncompressed size of a zstd
+   frame of a snapshot.  A snapshot is written out as a concatenation of
+   independent frames (see README.md), which allows compressing them in
+   parallel on creation and decompressing them in parallel on load. */
+#define FD_SNAPSHOT_ZSTD_FRAME_SZ         (100UL<<20) /* 100 MiB */
+
 FD_PROTOTYPES_BEGIN
 
 /* fd_snapshot_ctx_t holds various data structures needed for snapshot
@@ -57,19 +61,16 @@ struct fd_snapshot_ctx {
   ulong             last_snap_capitalization;  /* Full snapshot capitalization. */
   fd_hash_t *       last_snap_acc_hash;        /* Full snapshot account hash. */
 
+  /* Thread pool used for the accounts hash and for compressing the
+     account files.  May be NULL. */
   fd_tpool_t *      tpool;
 
-  /* We need two files to represent the snapshot file because can not directly
-     stream out the compressed snapshot with the current implementation of the
-     snapshot service. This is because we write back into the tar archive.
-     So, we first write out a tar archive, then this is compressed into a
-     second file. The tmp_fd is the file used to write the tar archive and
-     the snapshot_fd is used to write out the compressed file. */
-  int               tmp_fd;
+  /* The snapshot is written out in a single pass as a compressed tar
+     archive to snapshot_fd.  The file is renamed to its final name once
+     complete. */
   int               snapshot_fd;
 
   /* This gets setup within the context and not by the user. */
-  fd_tar_writer_t * writer;     /* Tar writer. */
   fd_hash_t         snap_hash;  /* Snapshot hash. */
   fd_hash_t         acc_hash;   /* Account hash. */
   fd_slot_bank_t    slot_bank;  /* Obtained from funk. */
@@ -150,7 +151,11 @@ fd_batch_fseq_get_slot( ulong fseq ) {
       of the accounts and is a set of files described by <slot#.id#>. These
       are described by the append vec index in the manifest.
 
-  The files are written out into a tar archive which is then zstd compressed.
+  The files are written out into a zstd compressed tar archive.  The
+  manifest is fully computed before any file is written out such that
+  the archive can be streamed out in a single pass.  The account files
+  are compressed into independent zstd frames in parallel on the
+  snapshot_ctx tpool.
 
   This can produce either a full snapshot or an incremental snapshot depending
   on the value of is_incremental. An incremental snapshot will contain all of
@@ -1,6 +1,7 @@
 #include "fd_snapshot_loader.h"
 #include "fd_snapshot_base.h"
 #include "fd_snapshot_http.h"
+#include "fd_snapshot_restore_par.h"
 
 #include <errno.h>
 #include <fcntl.h>
@@ -35,6 +36,7 @@ struct fd_snapshot_loader {
 
   fd_zstd_dstream_t *  zstd;
   fd_io_istream_zstd_t vzstd[1];
+  ulong                zstd_window_sz;
 
   /* Tar reader */
 
@@ -90,6 +92,7 @@ fd_snapshot_loader_new( void * mem,
   fd_memset( loader, 0, sizeof(fd_snapshot_loader_t) );
   loader->http_mem = http_mem;
   loader->zstd     = fd_zstd_dstream_new( zstd_mem, zstd_window_sz );
+  loader->zstd_window_sz = zstd_window_sz;
 
   FD_COMPILER_MFENCE();
   loader->magic = FD_SNAPSHOT_LOADER_MAGIC;
@@ -220,6 +223,22 @@ fd_snapshot_loader_advance( fd_snapshot_loader_t * dumper ) {
   return 0;
 }
 
+int
+fd_snapshot_loader_advance_par( fd_snapshot_loader_t * loader,
+                                fd_tpool_t *           tpool,
+                                ulong                  t0,
+                                ulong                  t1 ) {
+
+  /* Only local files can be randomly accessed */
+  if( loader->http || loader->snapshot_fd<0 ) return ENOTSUP;
+
+  int err = fd_snapshot_restore_par( loader->restore, loader->snapshot_fd, loader->zstd_window_sz, tpool, t0, t1 );
+  if( err==0 ) return -1;
+  if( FD_UNLIKELY( err!=ENOTSUP ) )
+    FD_LOG_WARNING(( "Failed to load snapshot (%d-%s)", err, fd_io_strerror( err ) ));
+  return err;
+}
+
 /* fd_snapshot_src_parse determines the source from the given cstr. */
 
 fd_snapshot_src_t *
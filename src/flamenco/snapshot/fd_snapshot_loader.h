@@ -15,6 +15,7 @@
 #include "fd_snapshot.h"
 #include "fd_snapshot_istream.h"
 #include "fd_snapshot_restore.h"
+#include "../../util/tpool/fd_tpool.h"
 
 /* FD_SNAPSHOT_SRC_{...} specifies the type of snapshot source. */
 
@@ -89,6 +90,21 @@ fd_snapshot_loader_init( fd_snapshot_loader_t *    loader,
 int
 fd_snapshot_loader_advance( fd_snapshot_loader_t * loader );
 
+/* fd_snapshot_loader_advance_par restores the remaining accounts using
+   tpool threads [t0,t1) (t0 is the caller, see fd_snapshot_restore_par).
+   Should be called after the manifest was loaded (advance returned
+   MANIFEST_DONE).  Returns -1 on successful EOF.  Returns ENOTSUP if
+   the snapshot cannot be loaded in parallel (e.g. it is streamed over
+   HTTP or consists of a single Zstandard frame), in which case the
+   caller should continue with fd_snapshot_loader_advance.  On failure,
+   returns errno-compatible code and logs error. */
+
+int
+fd_snapshot_loader_advance_par( fd_snapshot_loader_t * loader,
+                                fd_tpool_t *           tpool,
+                                ulong                  t0,
+                                ulong                  t1 );
+
 FD_FN_CONST fd_snapshot_name_t const *  /* nullable */
 fd_snapshot_loader_get_name( fd_snapshot_loader_t const * loader );
 
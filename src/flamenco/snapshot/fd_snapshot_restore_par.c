@@ -0,0 +1,861 @@
+#include "fd_snapshot_restore_par.h"
+#include "fd_snapshot_restore_private.h"
+#include "../../ballet/zstd/fd_zstd.h"
+#include "../runtime/fd_acc_mgr.h"
+#include "../runtime/fd_account.h"
+
+#include <errno.h>
+#include <stdio.h>     /* sscanf */
+#include <string.h>    /* strcmp */
+#include <sys/mman.h>  /* mmap */
+#include <sys/stat.h>  /* fstat */
+
+/* fd_snapshot_par_acc_t is an account record pending insertion into
+   funk.  The account data immediately follows the header (either in a
+   decompressed frame or in a heap copy). */
+
+struct fd_snapshot_par_acc {
+  fd_solana_account_hdr_t const * hdr;
+  ulong                           slot;     /* account vec slot */
+  fd_funk_rec_t *                 rec;      /* written record, NULL if skipped */
+  int                             is_copy;  /* hdr points to a heap copy */
+};
+
+typedef struct fd_snapshot_par_acc fd_snapshot_par_acc_t;
+
+/* fd_snapshot_par_list_t holds the account records of the current
+   round that were assigned to a worker, in archive order. */
+
+struct fd_snapshot_par_list {
+  fd_snapshot_par_acc_t * acc;
+  ulong                   cnt;
+  ulong                   max;
+};
+
+typedef struct fd_snapshot_par_list fd_snapshot_par_list_t;
+
+/* fd_snapshot_par_frame_t locates a Zstandard frame in the archive. */
+
+struct fd_snapshot_par_frame {
+  ulong off;      /* offset of first byte of frame in archive */
+  ulong sz;       /* compressed frame size */
+  ulong data_sz;  /* decompressed frame size */
+  int   sized;    /* data_sz is known from the frame header */
+};
+
+typedef struct fd_snapshot_par_frame fd_snapshot_par_frame_t;
+
+/* FILE_STATE_{...} specify how the content of the current file in the
+   TAR stream is handled. */
+
+#define FILE_STATE_IGNORE  (0)  /* skip file content */
+#define FILE_STATE_FORWARD (1)  /* forward to serial restore */
+#define FILE_STATE_ACCV    (2)  /* split account vec into records */
+
+/* ACCV_STATE_{...} are the states of the account vec parser. */
+
+#define ACCV_STATE_HDR  (0)  /* reading account header */
+#define ACCV_STATE_DATA (1)  /* copying account data spanning frames */
+#define ACCV_STATE_PAD  (2)  /* skipping alignment padding */
+
+struct fd_snapshot_par {
+  fd_snapshot_restore_t * restore;
+  fd_funk_t *             funk;
+  fd_valloc_t             valloc;
+  ulong                   t0;
+  ulong                   worker_cnt;  /* number of insert workers */
+  ulong                   dec_cnt;     /* number of decompress workers */
+
+  /* Archive */
+
+  uchar const *             map;
+  ulong                     map_sz;
+  fd_snapshot_par_frame_t * frame;
+  ulong                     frame_cnt;
+  ulong                     frame0;     /* first frame of current round */
+  ulong                     window_sz;  /* max window size of frames */
+  int                       stream;     /* archive is decompressed serially in chunks */
+  uchar const *             stream_in;  /* next compressed byte in stream mode */
+
+  /* Per worker state.  Decompression state is indexed [0,dec_cnt),
+     record lists are indexed [0,worker_cnt). */
+
+  fd_zstd_dstream_t **     dstream;
+  uchar **                 buf;
+  ulong *                  buf_cap;
+  fd_snapshot_par_list_t * list;
+
+  /* TAR stream state (only accessed by the calling thread) */
+
+  fd_tar_reader_t tar[1];
+  int             tar_done;
+  int             file_state;
+  int             accv_state;
+  ulong           accv_slot;   /* account vec slot */
+  ulong           accv_id;     /* account vec index */
+  ulong           accv_sz;     /* account vec bytes not yet parsed */
+  uchar           hdr[ sizeof(fd_solana_account_hdr_t) ];
+  ulong           hdr_ctr;     /* bytes buffered in hdr */
+  uchar *         copy;        /* heap copy of record spanning frames */
+  ulong           copy_ctr;
+  ulong           copy_sz;
+  ulong           pad_sz;      /* padding bytes left to skip */
+  ulong           acc_cnt;     /* number of records parsed */
+
+  int volatile    err;
+};
+
+typedef struct fd_snapshot_par fd_snapshot_par_t;
+
+/* fd_snapshot_par_push assigns an account record to a worker.  All
+   records with the same address get assigned to the same worker. */
+
+static int
+fd_snapshot_par_push( fd_snapshot_par_t *             par,
+                      fd_solana_account_hdr_t const * hdr,
+                      int                             is_copy ) {
+
+  fd_pubkey_t const *      key  = fd_type_pun_const( hdr->meta.pubkey );
+  fd_snapshot_par_list_t * list = &par->list[ fd_ulong_hash( key->ul[0] ) % par->worker_cnt ];
+
+  if( FD_UNLIKELY( list->cnt==list->max ) ) {
+    ulong                   max = fd_ulong_max( 2UL*list->max, 1024UL );
+    fd_snapshot_par_acc_t * acc = fd_valloc_malloc( par->valloc, alignof(fd_snapshot_par_acc_t), max*sizeof(fd_snapshot_par_acc_t) );
+    if( FD_UNLIKELY( !acc ) ) {
+      FD_LOG_WARNING(( "Failed to allocate account record list" ));
+      return ENOMEM;
+    }
+    if( list->cnt ) fd_memcpy( acc, list->acc, list->cnt*sizeof(fd_snapshot_par_acc_t) );
+    fd_valloc_free( par->valloc, list->acc );
+    list->acc = acc;
+    list->max = max;
+  }
+
+  list->acc[ list->cnt++ ] = (fd_snapshot_par_acc_t) {
+    .hdr     = hdr,
+    .slot    = par->accv_slot,
+    .rec     = NULL,
+    .is_copy = is_copy
+  };
+  par->acc_cnt++;
+  return 0;
+}
+
+/* fd_snapshot_par_accv_prepare prepares for consumption of an account
+   vec file.  Mirrors fd_snapshot_restore_accv_prepare. */
+
+static int
+fd_snapshot_par_accv_prepare( fd_snapshot_par_t *   par,
+                              fd_tar_meta_t const * meta,
+                              ulong                 real_sz ) {
+
+  fd_snapshot_restore_t * restore = par->restore;
+
+  /* Parse file name */
+  ulong id, slot;
+  if( FD_UNLIKELY( sscanf( meta->name, "accounts/%lu.%lu", &slot, &id )!=2 ) ) {
+    /* Ignore entire file if file name invalid */
+    return 0;
+  }
+
+  /* Reject if slot number is too high */
+  if( FD_UNLIKELY( slot > restore->slot ) ) {
+    FD_LOG_WARNING(( "%s has slot number %lu, which exceeds bank slot number %lu",
+                     meta->name, slot, restore->slot ));
+    return EINVAL;
+  }
+
+  /* Lookup account vec file size */
+  fd_snapshot_accv_key_t key = { .slot = slot, .id = id };
+  fd_snapshot_accv_map_t * rec = fd_snapshot_accv_map_query( restore->accv_map, key, NULL );
+  if( FD_UNLIKELY( !rec ) ) {
+    /* Ignore account vec files that are not explicitly mentioned in the
+       manifest. */
+    FD_LOG_DEBUG(( "Ignoring %s (sz %lu)", meta->name, real_sz ));
+    return 0;
+  }
+  ulong sz = rec->sz;
+
+  /* Validate the supposed file size against real size */
+  if( FD_UNLIKELY( sz > real_sz ) ) {
+    FD_LOG_WARNING(( "AppendVec %lu.%lu is %lu bytes long according to manifest, but actually only %lu bytes",
+                     slot, id, sz, real_sz ));
+    return EINVAL;
+  }
+
+  par->file_state = FILE_STATE_ACCV;
+  par->accv_state = ACCV_STATE_HDR;
+  par->accv_slot  = slot;
+  par->accv_id    = id;
+  par->accv_sz    = sz;
+  par->hdr_ctr    = 0UL;
+  return 0;
+}
+
+/* fd_snapshot_par_accv_read splits a chunk of an account vec into
+   account records.  Records fully contained in the chunk are referenced
+   in place, all others are gathered into a heap copy.  Any data past
+   the account vec size given by the manifest is ignored. */
+
+static int
+fd_snapshot_par_accv_read( fd_snapshot_par_t * par,
+                           uchar const *       buf,
+                           ulong               bufsz ) {
+
+  ulong const hdr_sz = sizeof(fd_solana_account_hdr_t);
+
+  while( bufsz && par->accv_sz ) {
+    ulong sz       = fd_ulong_min( bufsz, par->accv_sz );
+    ulong consumed = 0UL;
+
+    switch( par->accv_state ) {
+
+    case ACCV_STATE_HDR: {
+      if( FD_UNLIKELY( !par->hdr_ctr && par->accv_sz<hdr_sz ) ) {
+        FD_LOG_WARNING(( "encountered unexpected EOF while reading account header" ));
+        return EINVAL;
+      }
+
+      fd_solana_account_hdr_t const * hdr;
+      if( FD_LIKELY( !par->hdr_ctr && sz>=hdr_sz ) ) {
+        hdr      = fd_type_pun_const( buf );
+        consumed = hdr_sz;
+      } else {
+        consumed = fd_ulong_min( hdr_sz - par->hdr_ctr, sz );
+        fd_memcpy( par->hdr + par->hdr_ctr, buf, consumed );
+        par->hdr_ctr += consumed;
+        if( par->hdr_ctr<hdr_sz ) break;
+        par->hdr_ctr = 0UL;
+        hdr = fd_type_pun_const( par->hdr );
+      }
+
+      /* Sanity checks */
+      ulong data_sz = hdr->meta.data_len;
+      ulong left    = par->accv_sz - consumed;
+      if( FD_UNLIKELY( data_sz > FD_ACC_SZ_MAX ) ) {
+        FD_LOG_WARNING(( "accounts/%lu.%lu: account %s too large: data_len=%lu",
+                         par->accv_slot, par->accv_id, FD_BASE58_ENC_32_ALLOCA( hdr->meta.pubkey ), data_sz ));
+        FD_LOG_HEXDUMP_WARNING(( "account header", hdr, hdr_sz ));
+        return EINVAL;
+      }
+      if( FD_UNLIKELY( data_sz > left ) ) {
+        FD_LOG_WARNING(( "accounts/%lu.%lu: account %s data exceeds past end of account vec (acc_sz=%lu accv_sz=%lu)",
+                         par->accv_slot, par->accv_id, FD_BASE58_ENC_32_ALLOCA( hdr->meta.pubkey ), data_sz, left ));
+        FD_LOG_HEXDUMP_WARNING(( "account header", hdr, hdr_sz ));
+        return EINVAL;
+      }
+      par->pad_sz = fd_ulong_min( fd_ulong_align_up( data_sz, FD_SNAPSHOT_ACC_ALIGN ) - data_sz, left - data_sz );
+
+      if( FD_LIKELY( (uchar const *)hdr==buf && sz-consumed>=data_sz ) ) {
+        int err = fd_snapshot_par_push( par, hdr, 0 );
+        if( FD_UNLIKELY( err ) ) return err;
+        consumed       += data_sz;
+        par->accv_state = ACCV_STATE_PAD;
+      } else {
+        par->copy = fd_valloc_malloc( par->valloc, FD_SNAPSHOT_ACC_ALIGN, hdr_sz+data_sz );
+        if( FD_UNLIKELY( !par->copy ) ) {
+          FD_LOG_WARNING(( "Failed to allocate %lu bytes for account record", hdr_sz+data_sz ));
+          return ENOMEM;
+        }
+        fd_memcpy( par->copy, hdr, hdr_sz );
+        par->copy_ctr   = hdr_sz;
+        par->copy_sz    = hdr_sz+data_sz;
+        par->accv_state = ACCV_STATE_DATA;
+      }
+      break;
+    }
+
+    case ACCV_STATE_DATA:
+      consumed = fd_ulong_min( par->copy_sz - par->copy_ctr, sz );
+      fd_memcpy( par->copy + par->copy_ctr, buf, consumed );
+      par->copy_ctr += consumed;
+      break;
+
+    case ACCV_STATE_PAD:
+      consumed     = fd_ulong_min( par->pad_sz, sz );
+      par->pad_sz -= consumed;
+      break;
+
+    default:
+      __builtin_unreachable();
+    }
+
+    buf          += consumed;
+    bufsz        -= consumed;
+    par->accv_sz -= consumed;
+
+    if( par->accv_state==ACCV_STATE_DATA && par->copy_ctr==par->copy_sz ) {
+      int err = fd_snapshot_par_push( par, fd_type_pun_const( par->copy ), 1 );
+      if( FD_UNLIKELY( err ) ) return err;
+      par->copy       = NULL;
+      par->accv_state = ACCV_STATE_PAD;
+    }
+    if( par->accv_state==ACCV_STATE_PAD && !par->pad_sz ) par->accv_state = ACCV_STATE_HDR;
+  }
+
+  return 0;
+}
+
+/* fd_snapshot_par_{file,read} implement fd_tar_read_vtable_t.  Account
+   vecs are split into records, the status cache is forwarded to the
+   serial restore. */
+
+static int
+fd_snapshot_par_file( void *                _par,
+                      fd_tar_meta_t const * meta,
+                      ulong                 sz ) {
+
+  fd_snapshot_par_t * par = _par;
+  if( FD_UNLIKELY( par->copy || par->hdr_ctr ) ) {
+    FD_LOG_WARNING(( "accounts/%lu.%lu: account vec ended in the middle of an account", par->accv_slot, par->accv_id ));
+    return EINVAL;
+  }
+
+  par->file_state = FILE_STATE_IGNORE;
+  if( (sz==0UL) | (!fd_tar_meta_is_reg( meta )) ) return 0;
+
+  if( 0==strncmp( meta->name, "accounts/", sizeof("accounts/")-1 ) )
+    return fd_snapshot_par_accv_prepare( par, meta, sz );
+
+  /* The manifest was already loaded, the status cache may follow it */
+  if( 0==strcmp( meta->name, "snapshots/status_cache" ) && !par->restore->status_cache_done ) {
+    par->file_state = FILE_STATE_FORWARD;
+    return fd_snapshot_restore_file( par->restore, meta, sz );
+  }
+
+  return 0;
+}
+
+static int
+fd_snapshot_par_read( void *       _par,
+                      void const * buf,
+                      ulong        bufsz ) {
+
+  fd_snapshot_par_t * par = _par;
+  switch( par->file_state ) {
+  case FILE_STATE_IGNORE:
+    return 0;
+  case FILE_STATE_FORWARD:
+    return fd_snapshot_restore_chunk( par->restore, buf, bufsz );
+  case FILE_STATE_ACCV:
+    return fd_snapshot_par_accv_read( par, buf, bufsz );
+  default:
+    __builtin_unreachable();
+  }
+}
+
+static fd_tar_read_vtable_t const fd_snapshot_par_tar_vt =
+  { .file = fd_snapshot_par_file,
+    .read = fd_snapshot_par_read };
+
+/* fd_snapshot_par_index locates the frames of the archive and selects
+   serial decompression if they cannot be decompressed in parallel.
+   Returns ENOTSUP if the archive cannot be restored at all. */
+
+static int
+fd_snapshot_par_index( fd_snapshot_par_t * par,
+                       ulong               zstd_window_sz ) {
+
+  ulong off       = 0UL;
+  ulong frame_max = 0UL;
+  ulong sized_cnt = 0UL;
+  while( off < par->map_sz ) {
+    uchar const * frame = par->map    + off;
+    ulong         rem   = par->map_sz - off;
+
+    ulong          sz = fd_zstd_frame_sz( frame, rem );
+    fd_zstd_peek_t peek[1] = {0};
+    if( FD_UNLIKELY( !sz || !fd_zstd_peek( peek, frame, fd_ulong_min( rem, FD_ZSTD_MAX_HDR_SZ ) ) ) ) {
+      FD_LOG_WARNING(( "Failed to locate zstd frame at offset %lu", off ));
+      return ENOTSUP;
+    }
+    off += sz;
+    if( peek->frame_is_skippable ) continue;
+
+    if( FD_UNLIKELY( peek->window_sz>zstd_window_sz ) ) {
+      FD_LOG_NOTICE(( "zstd frame at offset %lu exceeds the max window size (window_sz=%lu)", off-sz, peek->window_sz ));
+      return ENOTSUP;
+    }
+    int sized = peek->frame_content_sz!=ULONG_MAX;
+    if( FD_UNLIKELY( sized && peek->frame_content_sz>FD_SNAPSHOT_RESTORE_PAR_FRAME_MAX ) ) par->stream = 1;
+
+    if( par->frame_cnt==frame_max ) {
+      ulong                     max  = fd_ulong_max( 2UL*frame_max, 64UL );
+      fd_snapshot_par_frame_t * next = fd_valloc_malloc( par->valloc, alignof(fd_snapshot_par_frame_t), max*sizeof(fd_snapshot_par_frame_t) );
+      if( FD_UNLIKELY( !next ) ) {
+        FD_LOG_WARNING(( "Failed to allocate zstd frame index" ));
+        return ENOMEM;
+      }
+      if( par->frame_cnt ) fd_memcpy( next, par->frame, par->frame_cnt*sizeof(fd_snapshot_par_frame_t) );
+      fd_valloc_free( par->valloc, par->frame );
+      par->frame = next;
+      frame_max  = max;
+    }
+
+    par->frame[ par->frame_cnt++ ] = (fd_snapshot_par_frame_t) {
+      .off     = off-sz,
+      .sz      = sz,
+      .data_sz = peek->frame_content_sz,
+      .sized   = sized
+    };
+    par->window_sz  = fd_ulong_max( par->window_sz, peek->window_sz );
+    sized_cnt      += (ulong)sized;
+  }
+
+  /* Streamed frames (e.g. the one containing the manifest) do not
+     declare their size and are decompressed by the calling thread.
+     Unless most of the archive can be split into frames, the whole
+     archive is decompressed by the calling thread instead. */
+
+  if( sized_cnt<2UL ) par->stream = 1;
+  return 0;
+}
+
+/* fd_snapshot_par_decompress_task decompresses frame frame0+w of the
+   current round into the buffer of worker w. */
+
+static void
+fd_snapshot_par_decompress_task( void * tpool,
+                                 ulong  t0     FD_PARAM_UNUSED, ulong t1 FD_PARAM_UNUSED,
+                                 void * args   FD_PARAM_UNUSED,
+                                 void * reduce FD_PARAM_UNUSED, ulong stride FD_PARAM_UNUSED,
+                                 ulong  l0     FD_PARAM_UNUSED, ulong l1 FD_PARAM_UNUSED,
+                                 ulong  m0     FD_PARAM_UNUSED, ulong m1 FD_PARAM_UNUSED,
+                                 ulong  n0,                     ulong n1 FD_PARAM_UNUSED ) {
+
+  fd_snapshot_par_t * par = (fd_snapshot_par_t *)tpool;
+  ulong               w   = n0 - par->t0;
+  ulong               f   = par->frame0 + w;
+  if( f >= par->frame_cnt ) return;
+
+  fd_snapshot_par_frame_t const * frame   = &par->frame[ f ];
+  if( !frame->sized ) return;  /* already decompressed */
+  fd_zstd_dstream_t *             dstream = par->dstream[ w ];
+  uchar const *                   in      = par->map + frame->off;
+  uchar const *                   in_end  = in + frame->sz;
+  uchar *                         out     = par->buf[ w ];
+  uchar *                         out_end = out + frame->data_sz;
+
+  fd_zstd_dstream_reset( dstream );
+  for(;;) {
+    uchar * out_prev = out;
+    int     rc       = fd_zstd_dstream_read( dstream, &in, in_end, &out, out_end, NULL );
+    if( rc==-1 ) break;
+    if( FD_UNLIKELY( rc>0 || ( in==in_end && out==out_prev ) ) ) {
+      FD_LOG_WARNING(( "Failed to decompress zstd frame at offset %lu (%d-%s)", frame->off, rc, fd_io_strerror( rc ) ));
+      par->err = EPROTO;
+      return;
+    }
+  }
+
+  if( FD_UNLIKELY( in!=in_end || out!=out_end ) ) {
+    FD_LOG_WARNING(( "zstd frame at offset %lu decompressed to %lu bytes, expected %lu",
+                     frame->off, (ulong)( out - par->buf[ w ] ), frame->data_sz ));
+    par->err = EPROTO;
+  }
+}
+
+/* fd_snapshot_par_decompress_unsized decompresses frame frame0+w of
+   the current round (which does not declare its size) into the buffer
+   of worker w, growing the buffer as needed.  Only called by the
+   calling thread. */
+
+static int
+fd_snapshot_par_decompress_unsized( fd_snapshot_par_t * par,
+                                    ulong               w ) {
+
+  fd_snapshot_par_frame_t * frame   = &par->frame[ par->frame0+w ];
+  fd_zstd_dstream_t *       dstream = par->dstream[ w ];
+  uchar const *             in      = par->map + frame->off;
+  uchar const *             in_end  = in + frame->sz;
+  ulong                     out_sz  = 0UL;
+
+  fd_zstd_dstream_reset( dstream );
+  for(;;) {
+    if( out_sz==par->buf_cap[ w ] ) {
+      ulong   cap = fd_ulong_min( fd_ulong_max( 2UL*par->buf_cap[ w ], 1UL<<20 ), FD_SNAPSHOT_RESTORE_PAR_FRAME_MAX );
+      uchar * buf = cap>out_sz ? fd_valloc_malloc( par->valloc, FD_SNAPSHOT_ACC_ALIGN, cap ) : NULL;
+      if( FD_UNLIKELY( !buf ) ) {
+        FD_LOG_WARNING(( "Failed to allocate buffer for zstd frame at offset %lu (decompressed %lu bytes so far)", frame->off, out_sz ));
+        return ENOMEM;
+      }
+      if( out_sz ) fd_memcpy( buf, par->buf[ w ], out_sz );
+      fd_valloc_free( par->valloc, par->buf[ w ] );
+      par->buf    [ w ] = buf;
+      par->buf_cap[ w ] = cap;
+    }
+
+    uchar * out      = par->buf[ w ] + out_sz;
+    uchar * out_prev = out;
+    int     rc       = fd_zstd_dstream_read( dstream, &in, in_end, &out, par->buf[ w ] + par->buf_cap[ w ], NULL );
+    out_sz = (ulong)( out - par->buf[ w ] );
+    if( rc==-1 ) break;
+    if( FD_UNLIKELY( rc>0 || ( in==in_end && out==out_prev ) ) ) {
+      FD_LOG_WARNING(( "Failed to decompress zstd frame at offset %lu (%d-%s)", frame->off, rc, fd_io_strerror( rc ) ));
+      return EPROTO;
+    }
+  }
+
+  if( FD_UNLIKELY( in!=in_end ) ) {
+    FD_LOG_WARNING(( "zstd frame at offset %lu has trailing data", frame->off ));
+    return EPROTO;
+  }
+  frame->data_sz = out_sz;
+  return 0;
+}
+
+/* fd_snapshot_par_decompress_stream decompresses the next chunk of the
+   archive (frames back to back, up to the capacity of the buffer of
+   worker 0) into the buffer of worker 0.  Returns the number of bytes
+   decompressed in *_out_sz.  Only called by the calling thread. */
+
+static int
+fd_snapshot_par_decompress_stream( fd_snapshot_par_t * par,
+                                   ulong *             _out_sz ) {
+
+  fd_zstd_dstream_t * dstream = par->dstream[ 0 ];
+  uchar const *       in_end  = par->map + par->map_sz;
+  uchar *             out     = par->buf[ 0 ];
+  uchar *             out_end = out + par->buf_cap[ 0 ];
+
+  while( out<out_end && par->stream_in<in_end ) {
+    uchar const * in_prev  = par->stream_in;
+    uchar *       out_prev = out;
+    int           rc       = fd_zstd_dstream_read( dstream, &par->stream_in, in_end, &out, out_end, NULL );
+    if( rc==-1 ) continue;  /* end of frame, the next one follows */
+    if( FD_UNLIKELY( rc>0 || ( par->stream_in==in_prev && out==out_prev ) ) ) {
+      FD_LOG_WARNING(( "Failed to decompress zstd stream at offset %lu (%d-%s)",
+                       (ulong)( par->stream_in - par->map ), rc, fd_io_strerror( rc ) ));
+      return EPROTO;
+    }
+  }
+
+  *_out_sz = (ulong)( out - par->buf[ 0 ] );
+  return 0;
+}
+
+/* fd_snapshot_par_insert_task inserts the account records assigned to
+   worker w into funk.  Mirrors fd_snapshot_restore_account_hdr. */
+
+static void
+fd_snapshot_par_insert_task( void * tpool,
+                             ulong  t0     FD_PARAM_UNUSED, ulong t1 FD_PARAM_UNUSED,
+                             void * args   FD_PARAM_UNUSED,
+                             void * reduce FD_PARAM_UNUSED, ulong stride FD_PARAM_UNUSED,
+                             ulong  l0     FD_PARAM_UNUSED, ulong l1 FD_PARAM_UNUSED,
+                             ulong  m0     FD_PARAM_UNUSED, ulong m1 FD_PARAM_UNUSED,
+                             ulong  n0,                     ulong n1 FD_PARAM_UNUSED ) {
+
+  fd_snapshot_par_t *      par      = (fd_snapshot_par_t *)tpool;
+  fd_snapshot_par_list_t * list     = &par->list[ n0 - par->t0 ];
+  fd_funk_txn_t *          funk_txn = par->restore->funk_txn;
+  fd_funk_t *              funk     = par->funk;
+  fd_wksp_t *              wksp     = fd_funk_wksp( funk );
+
+  for( ulong i=0UL; i<list->cnt; i++ ) {
+    if( FD_UNLIKELY( par->err ) ) return;
+
+    fd_snapshot_par_acc_t *         acc = &list->acc[ i ];
+    fd_solana_account_hdr_t const * hdr = acc->hdr;
+    fd_pubkey_t const *             key = fd_type_pun_const( hdr->meta.pubkey );
+
+    /* Skip if a newer revision was already restored.  Other workers
+       concurrently link records into the same hash chains, so the
+       query holds the chain's lock.  The value is stable as no other
+       worker writes this account. */
+    fd_funk_rec_key_t     id   = fd_acc_funk_key( key );
+    fd_funk_rec_t const * prev = fd_funk_rec_query_global_concur( funk, funk_txn, &id, NULL );
+    if( prev ) {
+      fd_account_meta_t const * prev_meta = fd_funk_val_const( prev, wksp );
+      if( prev_meta->magic==FD_ACCOUNT_META_MAGIC && prev_meta->slot > acc->slot ) continue;
+    }
+
+    int               err = FD_FUNK_SUCCESS;
+    fd_funk_rec_t *   rec = fd_funk_rec_write_prepare_concur( funk, funk_txn, &id, sizeof(fd_account_meta_t)+hdr->meta.data_len, 1, NULL, &err );
+    if( FD_UNLIKELY( !rec ) ) {
+      FD_LOG_WARNING(( "fd_funk_rec_write_prepare_concur(%s) failed (%i-%s)", FD_BASE58_ENC_32_ALLOCA( key ), err, fd_funk_strerror( err ) ));
+      par->err = ENOMEM;
+      return;
+    }
+
+    fd_account_meta_t * meta = fd_funk_val( rec, wksp );
+    if( meta->magic==0UL ) fd_account_meta_init( meta );
+    if( FD_UNLIKELY( meta->magic!=FD_ACCOUNT_META_MAGIC ) ) {
+      FD_LOG_WARNING(( "account %s has wrong magic", FD_BASE58_ENC_32_ALLOCA( key ) ));
+      par->err = ENOMEM;
+      return;
+    }
+
+    meta->dlen = hdr->meta.data_len;
+    meta->slot = acc->slot;
+    memcpy( &meta->hash, hdr->hash.uc, 32UL );
+    memcpy( &meta->info, &hdr->info, sizeof(fd_solana_account_meta_t) );
+    fd_memcpy( (uchar *)meta + meta->hlen, hdr+1, hdr->meta.data_len );
+    acc->rec = rec;
+  }
+}
+
+/* fd_snapshot_par_fini releases all resources of par. */
+
+static void
+fd_snapshot_par_fini( fd_snapshot_par_t * par ) {
+
+  if( par->list ) {
+    for( ulong w=0UL; w<par->worker_cnt; w++ ) {
+      fd_snapshot_par_list_t * list = &par->list[ w ];
+      for( ulong i=0UL; i<list->cnt; i++ )
+        if( list->acc[ i ].is_copy ) fd_valloc_free( par->valloc, (void *)list->acc[ i ].hdr );
+      fd_valloc_free( par->valloc, list->acc );
+    }
+    fd_valloc_free( par->valloc, par->list );
+  }
+  for( ulong w=0UL; w<par->dec_cnt; w++ ) {
+    if( par->buf     ) fd_valloc_free( par->valloc, par->buf[ w ] );
+    if( par->dstream ) fd_valloc_free( par->valloc, fd_zstd_dstream_delete( par->dstream[ w ] ) );
+  }
+  fd_valloc_free( par->valloc, par->buf     );
+  fd_valloc_free( par->valloc, par->buf_cap );
+  fd_valloc_free( par->valloc, par->dstream );
+  fd_valloc_free( par->valloc, par->copy    );
+  fd_valloc_free( par->valloc, par->frame   );
+  fd_tar_reader_delete( par->tar );
+
+  if( par->map ) munmap( (void *)par->map, par->map_sz );
+}
+
+/* fd_snapshot_par_setup allocates the per worker state. */
+
+static int
+fd_snapshot_par_setup( fd_snapshot_par_t * par ) {
+
+  ulong dec_cnt = par->dec_cnt;
+  par->list    = fd_valloc_malloc( par->valloc, alignof(fd_snapshot_par_list_t), par->worker_cnt*sizeof(fd_snapshot_par_list_t) );
+  par->dstream = fd_valloc_malloc( par->valloc, alignof(fd_zstd_dstream_t *),    dec_cnt*sizeof(fd_zstd_dstream_t *)       );
+  par->buf     = fd_valloc_malloc( par->valloc, alignof(uchar *),                dec_cnt*sizeof(uchar *)                   );
+  par->buf_cap = fd_valloc_malloc( par->valloc, alignof(ulong),                  dec_cnt*sizeof(ulong)                     );
+  if( FD_UNLIKELY( !par->list || !par->dstream || !par->buf || !par->buf_cap ) ) {
+    fd_valloc_free( par->valloc, par->list );
+    par->list = NULL;
+    par->dec_cnt = 0UL;
+    FD_LOG_WARNING(( "Failed to allocate worker state" ));
+    return ENOMEM;
+  }
+  fd_memset( par->list,    0, par->worker_cnt*sizeof(fd_snapshot_par_list_t) );
+  fd_memset( par->dstream, 0, dec_cnt*sizeof(fd_zstd_dstream_t *)             );
+  fd_memset( par->buf,     0, dec_cnt*sizeof(uchar *)                         );
+  fd_memset( par->buf_cap, 0, dec_cnt*sizeof(ulong)                           );
+
+  for( ulong w=0UL; w<dec_cnt; w++ ) {
+    void * mem = fd_valloc_malloc( par->valloc, fd_zstd_dstream_align(), fd_zstd_dstream_footprint( par->window_sz ) );
+    par->dstream[ w ] = mem ? fd_zstd_dstream_new( mem, par->window_sz ) : NULL;
+    if( FD_UNLIKELY( !par->dstream[ w ] ) ) {
+      fd_valloc_free( par->valloc, mem );
+      FD_LOG_WARNING(( "Failed to allocate zstd decompressor" ));
+      return ENOMEM;
+    }
+  }
+
+  if( FD_UNLIKELY( !fd_tar_reader_new( par->tar, &fd_snapshot_par_tar_vt, par ) ) ) {
+    FD_LOG_WARNING(( "Failed to create fd_tar_reader_t" ));
+    return EINVAL;
+  }
+  return 0;
+}
+
+/* fd_snapshot_par_split walks the TAR stream over sz decompressed
+   bytes at buf and splits account vecs into account records. */
+
+static int
+fd_snapshot_par_split( fd_snapshot_par_t * par,
+                       uchar const *       buf,
+                       ulong               sz ) {
+  if( par->tar_done ) return 0;
+  int err = fd_tar_read( par->tar, buf, sz, 0 );
+  if( err<0 ) {
+    par->tar_done = 1;
+  } else if( FD_UNLIKELY( err ) ) {
+    FD_LOG_WARNING(( "Failed to read snapshot archive (%d-%s)", err, fd_io_strerror( err ) ));
+    return err;
+  }
+  return 0;
+}
+
+/* fd_snapshot_par_insert inserts the account records split so far into
+   funk using all workers and releases them. */
+
+static int
+fd_snapshot_par_insert( fd_snapshot_par_t * par,
+                        fd_tpool_t *        tpool ) {
+
+  fd_tpool_exec_all_raw( tpool, par->t0, par->t0+par->worker_cnt, fd_snapshot_par_insert_task, par, NULL, NULL, 0UL, 0UL, 0UL );
+  if( FD_UNLIKELY( par->err ) ) return par->err;
+
+  /* Assign rent partitions (not thread safe) and release records */
+
+  fd_acc_mgr_t * acc_mgr = par->restore->acc_mgr;
+  for( ulong w=0UL; w<par->worker_cnt; w++ ) {
+    fd_snapshot_par_list_t * list = &par->list[ w ];
+    for( ulong i=0UL; i<list->cnt; i++ ) {
+      fd_snapshot_par_acc_t * acc = &list->acc[ i ];
+      if( acc->rec     ) fd_acc_mgr_set_rent_part( acc_mgr, acc->rec );
+      if( acc->is_copy ) fd_valloc_free( par->valloc, (void *)acc->hdr );
+    }
+    list->cnt = 0UL;
+  }
+
+  return 0;
+}
+
+/* fd_snapshot_par_round restores the frames [frame0,frame0+dec_cnt). */
+
+static int
+fd_snapshot_par_round( fd_snapshot_par_t * par,
+                       fd_tpool_t *        tpool ) {
+
+  ulong round_cnt = fd_ulong_min( par->dec_cnt, par->frame_cnt - par->frame0 );
+
+  /* Decompress frames */
+
+  for( ulong w=0UL; w<round_cnt; w++ ) {
+    if( !par->frame[ par->frame0+w ].sized ) {
+      int err = fd_snapshot_par_decompress_unsized( par, w );
+      if( FD_UNLIKELY( err ) ) return err;
+      continue;
+    }
+    ulong data_sz = par->frame[ par->frame0+w ].data_sz;
+    if( par->buf_cap[ w ]>=data_sz ) continue;
+    fd_valloc_free( par->valloc, par->buf[ w ] );
+    par->buf_cap[ w ] = 0UL;
+    par->buf    [ w ] = fd_valloc_malloc( par->valloc, FD_SNAPSHOT_ACC_ALIGN, data_sz );
+    if( FD_UNLIKELY( !par->buf[ w ] ) ) {
+      FD_LOG_WARNING(( "Failed to allocate %lu bytes for decompressed frame", data_sz ));
+      return ENOMEM;
+    }
+    par->buf_cap[ w ] = data_sz;
+  }
+
+  fd_tpool_exec_all_raw( tpool, par->t0, par->t0+round_cnt, fd_snapshot_par_decompress_task, par, NULL, NULL, 0UL, 0UL, 0UL );
+  if( FD_UNLIKELY( par->err ) ) return par->err;
+
+  /* Split frames into account records */
+
+  for( ulong w=0UL; w<round_cnt; w++ ) {
+    int err = fd_snapshot_par_split( par, par->buf[ w ], par->frame[ par->frame0+w ].data_sz );
+    if( FD_UNLIKELY( err ) ) return err;
+  }
+
+  return fd_snapshot_par_insert( par, tpool );
+}
+
+/* fd_snapshot_par_stream_round restores the next chunk of an archive
+   that is decompressed serially (see fd_snapshot_par_index). */
+
+static int
+fd_snapshot_par_stream_round( fd_snapshot_par_t * par,
+                              fd_tpool_t *        tpool ) {
+
+  if( FD_UNLIKELY( !par->buf_cap[ 0 ] ) ) {
+    par->buf[ 0 ] = fd_valloc_malloc( par->valloc, FD_SNAPSHOT_ACC_ALIGN, FD_SNAPSHOT_RESTORE_PAR_CHUNK_SZ );
+    if( FD_UNLIKELY( !par->buf[ 0 ] ) ) {
+      FD_LOG_WARNING(( "Failed to allocate %lu bytes for decompressed chunk", FD_SNAPSHOT_RESTORE_PAR_CHUNK_SZ ));
+      return ENOMEM;
+    }
+    par->buf_cap[ 0 ] = FD_SNAPSHOT_RESTORE_PAR_CHUNK_SZ;
+  }
+
+  ulong sz  = 0UL;
+  int   err = fd_snapshot_par_decompress_stream( par, &sz );
+  if( FD_UNLIKELY( err ) ) return err;
+
+  err = fd_snapshot_par_split( par, par->buf[ 0 ], sz );
+  if( FD_UNLIKELY( err ) ) return err;
+
+  return fd_snapshot_par_insert( par, tpool );
+}
+
+int
+fd_snapshot_restore_par( fd_snapshot_restore_t * restore,
+                         int                     fd,
+                         ulong                   zstd_window_sz,
+                         fd_tpool_t *            tpool,
+                         ulong                   t0,
+                         ulong                   t1 ) {
+
+  if( FD_UNLIKELY( restore->failed ) ) return EINVAL;
+  if( FD_UNLIKELY( !restore->manifest_done ) ) {
+    FD_LOG_WARNING(( "Unsupported snapshot: manifest was not loaded before accounts" ));
+    return EINVAL;
+  }
+
+  struct stat st;
+  if( FD_UNLIKELY( 0!=fstat( fd, &st ) ) ) {
+    FD_LOG_WARNING(( "fstat(%d) failed (%d-%s)", fd, errno, fd_io_strerror( errno ) ));
+    return ENOTSUP;
+  }
+  if( FD_UNLIKELY( !S_ISREG( st.st_mode ) || !st.st_size ) ) return ENOTSUP;
+
+  fd_snapshot_par_t * par = fd_valloc_malloc( restore->valloc, alignof(fd_snapshot_par_t), sizeof(fd_snapshot_par_t) );
+  if( FD_UNLIKELY( !par ) ) {
+    FD_LOG_WARNING(( "Failed to allocate parallel restore state" ));
+    return ENOMEM;
+  }
+  fd_memset( par, 0, sizeof(fd_snapshot_par_t) );
+  par->restore    = restore;
+  par->funk       = restore->acc_mgr->funk;
+  par->valloc     = restore->valloc;
+  par->t0         = t0;
+  par->worker_cnt = t1-t0;
+  par->map_sz     = (ulong)st.st_size;
+
+  void * map = mmap( NULL, par->map_sz, PROT_READ, MAP_PRIVATE, fd, 0 );
+  if( FD_UNLIKELY( map==MAP_FAILED ) ) {
+    FD_LOG_WARNING(( "mmap(%d,%lu) failed (%d-%s)", fd, par->map_sz, errno, fd_io_strerror( errno ) ));
+    fd_valloc_free( restore->valloc, par );
+    return ENOTSUP;
+  }
+  par->map = map;
+
+  /* Locate frames.  Nothing was modified yet, so fall back to the
+     serial pipeline if the archive cannot be decompressed. */
+
+  int err = fd_snapshot_par_index( par, zstd_window_sz );
+  if( FD_UNLIKELY( err ) ) goto fini;
+
+  if( par->stream ) {
+    par->dec_cnt = 1UL;
+    FD_LOG_NOTICE(( "Restoring accounts from %lu zstd frames decompressed serially, inserting using %lu threads", par->frame_cnt, par->worker_cnt ));
+  } else {
+    par->dec_cnt = fd_ulong_min( par->worker_cnt, par->frame_cnt );
+    FD_LOG_NOTICE(( "Restoring accounts from %lu zstd frames using %lu threads", par->frame_cnt, par->worker_cnt ));
+  }
+
+  err = fd_snapshot_par_setup( par );
+  if( FD_UNLIKELY( err ) ) goto fini;
+
+  if( par->stream ) {
+    par->stream_in = par->map;
+    while( par->stream_in<par->map+par->map_sz && !par->tar_done ) {
+      err = fd_snapshot_par_stream_round( par, tpool );
+      if( FD_UNLIKELY( err ) ) goto fini;
+    }
+  } else {
+    for( par->frame0=0UL; par->frame0<par->frame_cnt && !par->tar_done; par->frame0+=par->dec_cnt ) {
+      err = fd_snapshot_par_round( par, tpool );
+      if( FD_UNLIKELY( err ) ) goto fini;
+    }
+  }
+
+  if( FD_UNLIKELY( par->copy || par->hdr_ctr ) ) {
+    FD_LOG_WARNING(( "accounts/%lu.%lu: unexpected EOF while reading account", par->accv_slot, par->accv_id ));
+    err = EINVAL;
+    goto fini;
+  }
+
+  FD_LOG_NOTICE(( "Restored %lu account records", par->acc_cnt ));
+
+fini:
+  if( FD_UNLIKELY( err && err!=ENOTSUP ) ) restore->failed = 1;
+  fd_snapshot_par_fini( par );
+  fd_valloc_free( restore->valloc, par );
+  return err;
+}
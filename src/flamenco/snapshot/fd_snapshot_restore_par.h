@@ -0,0 +1,90 @@
+#ifndef HEADER_fd_src_flamenco_snapshot_fd_snapshot_restore_par_h
+#define HEADER_fd_src_flamenco_snapshot_fd_snapshot_restore_par_h
+
+#if FD_HAS_ZSTD
+
+/* fd_snapshot_restore_par.h provides a multi-threaded variant of the
+   account loading part of the snapshot loading pipeline.
+
+     read => unzstd => untar => restore
+             ^^^^^^    ^^^^^    ^^^^^^^
+
+   A Zstandard stream is the concatenation of independent frames.  The
+   serial pipeline (fd_snapshot_loader) is bound by the decompression
+   and funk insertion speed of a single core.  Snapshots that consist
+   of many frames (such as those produced by fd_snapshot_create) are
+   instead restored in rounds using a tpool:
+
+   - The frame boundaries are located up front (reading only frame and
+     block headers).
+   - Each worker decompresses one frame into its own buffer.
+   - The calling thread walks the TAR stream across these buffers and
+     splits account vecs into account records.  Records are referenced
+     in place, except for the few that span frame boundaries, which are
+     copied out to the heap.  Each record is assigned to a worker by
+     account address.
+   - Each worker inserts its records into funk (concurrently with the
+     other workers) in archive order.  All revisions of an account are
+     handled by the same worker, so duplicate revisions are resolved by
+     account vec slot exactly like in the serial restore (see "Pitfalls"
+     in README.md).
+
+   Memory use is one decompressed frame and one Zstandard decompression
+   context per worker.  Frames that do not declare their content size
+   (e.g. streamed frames holding the manifest) are decompressed by the
+   calling thread.
+
+   Archives that cannot be split (e.g. most snapshots produced by Agave
+   consist of a single frame) are instead decompressed serially by the
+   calling thread, FD_SNAPSHOT_RESTORE_PAR_CHUNK_SZ bytes per round,
+   and only the splitting and insertion of account records is
+   parallelized as above. */
+
+#include "fd_snapshot_restore.h"
+#include "../../util/tpool/fd_tpool.h"
+
+/* FD_SNAPSHOT_RESTORE_PAR_FRAME_MAX is the largest decompressed frame
+   size supported by fd_snapshot_restore_par. */
+
+#define FD_SNAPSHOT_RESTORE_PAR_FRAME_MAX (1UL<<30)
+
+/* FD_SNAPSHOT_RESTORE_PAR_CHUNK_SZ is the number of decompressed bytes
+   restored per round from archives that are decompressed serially. */
+
+#define FD_SNAPSHOT_RESTORE_PAR_CHUNK_SZ (1UL<<26)
+
+FD_PROTOTYPES_BEGIN
+
+/* fd_snapshot_restore_par restores the account vecs of the snapshot
+   archive (.tar.zst) in file descriptor fd into restore.  restore has
+   already loaded the snapshot manifest (fd_snapshot_restore_chunk
+   returned MANIFEST_DONE).  The status cache is forwarded to restore
+   as usual if it was not loaded yet (the manifest is not loaded again).  Account
+   records that were already restored by the serial pipeline are
+   restored again with identical content.  fd is not modified (the
+   archive is mapped read-only).  zstd_window_sz is the max window size
+   of a frame.  Uses tpool threads [t0,t1) (t0 is the caller).  The
+   funk of restore is inside a fd_funk_start_write block and no other
+   funk mutations happen for the duration of the call.
+
+   Returns 0 on success.  Returns ENOTSUP if fd is not a regular file,
+   the frames of the archive cannot be located or a frame needs a
+   window larger than zstd_window_sz, in which case restore and funk
+   were not modified and the caller should fall back to the serial
+   pipeline.
+   On failure, returns errno-compatible error code and logs reason.
+   restore is marked as failed and funk may contain a partial restore. */
+
+int
+fd_snapshot_restore_par( fd_snapshot_restore_t * restore,
+                         int                     fd,
+                         ulong                   zstd_window_sz,
+                         fd_tpool_t *            tpool,
+                         ulong                   t0,
+                         ulong                   t1 );
+
+FD_PROTOTYPES_END
+
+#endif /* FD_HAS_ZSTD */
+
+#endif /* HEADER_fd_src_flamenco_snapshot_fd_snapshot_restore_par_h */
@@ -0,0 +1,283 @@
+#include "fd_snapshot_restore_par.h"
+#include "fd_snapshot_restore_private.h"
+#include "../runtime/fd_acc_mgr.h"
+#include "../../util/archive/fd_tar.h"
+#include <stdlib.h>
+#include <unistd.h>
+#include <zstd.h>
+
+/* test_snapshot_restore_par restores the same snapshot archive with the
+   serial (fd_snapshot_restore_tar_vt) and the parallel
+   (fd_snapshot_restore_par) pipeline and checks that both produce the
+   same funk records.  Accounts appear at different revisions in
+   different account vecs, which are spread across frames, such that
+   newest-slot-wins is resolved across frames and threads.  Every other
+   archive consists of a single frame, which is decompressed serially
+   and inserted in parallel. */
+
+#define KEY_CNT   (64UL)
+#define ACCV_CNT  (8UL)
+#define DATA_MAX  (600UL)
+#define FRAME_SZ  (1000UL)  /* decompressed bytes per frame, not aligned to anything */
+#define TAR_MAX   (1UL<<20)
+
+/* Account vec slots in archive order.  Includes out of order and
+   repeated slots. */
+
+static ulong const accv_slot[ ACCV_CNT ] = { 12UL, 10UL, 15UL, 11UL, 15UL, 13UL, 10UL, 14UL };
+
+static uchar tar_buf[ TAR_MAX ];
+static uchar zst_buf[ TAR_MAX + (1UL<<16) ];
+
+static ulong accv_sz[ ACCV_CNT ];
+
+static int
+cb_manifest( void *                 ctx,
+             fd_solana_manifest_t * manifest,
+             fd_valloc_t            valloc ) {
+  (void)ctx; (void)manifest; (void)valloc;
+  return 0;
+}
+
+static int
+cb_status_cache( void *                  ctx,
+                 fd_bank_slot_deltas_t * cache ) {
+  (void)ctx; (void)cache;
+  return 0;
+}
+
+/* make_key derives the address of account i.  All words are non-zero. */
+
+static void
+make_key( fd_pubkey_t * key,
+          ulong         i ) {
+  for( ulong j=0UL; j<4UL; j++ ) key->ul[ j ] = fd_ulong_hash( 4UL*i+j+1UL );
+}
+
+/* make_tar writes a TAR stream with ACCV_CNT account vecs into tar_buf.
+   Each account vec holds a random subset of the accounts.  Returns the
+   stream size. */
+
+static ulong
+make_tar( fd_rng_t * rng ) {
+  ulong off = 0UL;
+  for( ulong v=0UL; v<ACCV_CNT; v++ ) {
+    fd_tar_meta_t * meta = (fd_tar_meta_t *)( tar_buf+off );
+    uchar *         accv = tar_buf+off+sizeof(fd_tar_meta_t);
+    ulong           sz   = 0UL;
+    for( ulong i=0UL; i<KEY_CNT; i++ ) {
+      if( fd_rng_uint_roll( rng, 3U ) ) continue;
+      fd_solana_account_hdr_t * hdr = (fd_solana_account_hdr_t *)( accv+sz );
+      memset( hdr, 0, sizeof(fd_solana_account_hdr_t) );
+      ulong data_len = fd_rng_ulong_roll( rng, DATA_MAX );
+      hdr->meta.write_version_obsolete = v;
+      hdr->meta.data_len               = data_len;
+      make_key( fd_type_pun( hdr->meta.pubkey ), i );
+      hdr->info.lamports               = fd_rng_uint_roll( rng, 4U ) ? fd_rng_ulong( rng ) : 0UL;
+      hdr->info.rent_epoch             = fd_rng_ulong( rng );
+      hdr->info.executable             = (uchar)fd_rng_uint_roll( rng, 2U );
+      hdr->info.owner[0]               = (uchar)v;
+      for( ulong j=0UL; j<32UL; j++ ) hdr->hash.uc[ j ] = fd_rng_uchar( rng );
+      uchar * data = (uchar *)( hdr+1 );
+      for( ulong j=0UL; j<data_len; j++ ) data[ j ] = fd_rng_uchar( rng );
+      sz += fd_ulong_align_up( sizeof(fd_solana_account_hdr_t)+data_len, FD_SNAPSHOT_ACC_ALIGN );
+      FD_TEST( off+sizeof(fd_tar_meta_t)+sz+3UL*FD_TAR_BLOCK_SZ<=TAR_MAX );
+    }
+    accv_sz[ v ] = sz;
+
+    char name[ 64 ];
+    FD_TEST( fd_cstr_printf_check( name, sizeof(name), NULL, "accounts/%lu.%lu", accv_slot[ v ], v ) );
+    FD_TEST( fd_tar_meta_init_file( meta, name, sz ) );
+    off += sizeof(fd_tar_meta_t) + fd_ulong_align_up( sz, FD_TAR_BLOCK_SZ );
+  }
+  memset( tar_buf+off, 0, 2UL*FD_TAR_BLOCK_SZ ); /* EOF marker */
+  return off + 2UL*FD_TAR_BLOCK_SZ;
+}
+
+/* make_archive compresses the TAR stream into frames of frame_sz
+   decompressed bytes.  Returns a file descriptor of the archive. */
+
+static int
+make_archive( ulong tar_sz,
+              ulong frame_sz ) {
+  ulong zst_sz = 0UL;
+  ulong frame_cnt = 0UL;
+  for( ulong off=0UL; off<tar_sz; off+=frame_sz ) {
+    ulong in_sz = fd_ulong_min( frame_sz, tar_sz-off );
+    ulong res   = ZSTD_compress( zst_buf+zst_sz, sizeof(zst_buf)-zst_sz, tar_buf+off, in_sz, 1 );
+    FD_TEST( !ZSTD_isError( res ) );
+    zst_sz += res;
+    frame_cnt++;
+  }
+  FD_LOG_NOTICE(( "archive: %lu TAR bytes in %lu frames (%lu compressed bytes)", tar_sz, frame_cnt, zst_sz ));
+
+  char path[] = "/tmp/test_snapshot_restore_par.XXXXXX";
+  int fd = mkstemp( path );
+  FD_TEST( fd>=0 );
+  FD_TEST( !unlink( path ) );
+  ulong wsz;
+  FD_TEST( !fd_io_write( fd, zst_buf, zst_sz, zst_sz, &wsz ) );
+  return fd;
+}
+
+static fd_snapshot_restore_t *
+new_restore( void *          mem,
+             fd_acc_mgr_t *  acc_mgr,
+             fd_funk_txn_t * funk_txn,
+             fd_valloc_t     valloc ) {
+  fd_snapshot_restore_t * restore = fd_snapshot_restore_new( mem, acc_mgr, funk_txn, valloc, NULL, cb_manifest, cb_status_cache );
+  FD_TEST( restore );
+  restore->manifest_done = MANIFEST_DONE_SEEN;
+  restore->slot          = 100UL;
+  for( ulong v=0UL; v<ACCV_CNT; v++ ) {
+    fd_snapshot_accv_key_t   key = { .slot = accv_slot[ v ], .id = v };
+    fd_snapshot_accv_map_t * rec = fd_snapshot_accv_map_insert( restore->accv_map, key );
+    FD_TEST( rec );
+    rec->sz = accv_sz[ v ];
+  }
+  return restore;
+}
+
+/* check_acc verifies that account i has the same content in txn a and
+   txn b and that it matches the newest revision in the archive.
+   Returns 1 if the account exists. */
+
+static int
+check_acc( fd_acc_mgr_t *  acc_mgr,
+           fd_funk_txn_t * txn_a,
+           fd_funk_txn_t * txn_b,
+           ulong           tar_sz,
+           ulong           i ) {
+  fd_pubkey_t key[1]; make_key( key, i );
+
+  /* Find the newest revision in archive order (later account vecs win
+     ties, like in the serial restore) */
+
+  fd_solana_account_hdr_t const * exp = NULL;
+  ulong                           exp_slot = 0UL;
+  ulong                           off = 0UL;
+  for( ulong v=0UL; v<ACCV_CNT; v++ ) {
+    uchar const * accv = tar_buf+off+sizeof(fd_tar_meta_t);
+    for( ulong sz=0UL; sz<accv_sz[ v ]; ) {
+      fd_solana_account_hdr_t const * hdr = (fd_solana_account_hdr_t const *)( accv+sz );
+      if( fd_memeq( hdr->meta.pubkey, key, 32UL ) && ( !exp || accv_slot[ v ]>=exp_slot ) ) {
+        exp      = hdr;
+        exp_slot = accv_slot[ v ];
+      }
+      sz += fd_ulong_align_up( sizeof(fd_solana_account_hdr_t)+hdr->meta.data_len, FD_SNAPSHOT_ACC_ALIGN );
+    }
+    off += sizeof(fd_tar_meta_t) + fd_ulong_align_up( accv_sz[ v ], FD_TAR_BLOCK_SZ );
+  }
+  FD_TEST( off+2UL*FD_TAR_BLOCK_SZ==tar_sz );
+
+  fd_account_meta_t const * a = fd_acc_mgr_view_raw( acc_mgr, txn_a, key, NULL, NULL, NULL );
+  fd_account_meta_t const * b = fd_acc_mgr_view_raw( acc_mgr, txn_b, key, NULL, NULL, NULL );
+  if( !exp ) {
+    FD_TEST( !a && !b );
+    return 0;
+  }
+  FD_TEST( a && b );
+  FD_TEST( a->slot==exp_slot && b->slot==exp_slot );
+  FD_TEST( a->dlen==exp->meta.data_len && b->dlen==exp->meta.data_len );
+  FD_TEST( fd_memeq( a->hash, exp->hash.uc, 32UL ) && fd_memeq( b->hash, exp->hash.uc, 32UL ) );
+  FD_TEST( fd_memeq( &a->info, &exp->info, sizeof(fd_solana_account_meta_t) ) );
+  FD_TEST( fd_memeq( &b->info, &exp->info, sizeof(fd_solana_account_meta_t) ) );
+  FD_TEST( fd_memeq( (uchar const *)a+a->hlen, exp+1, a->dlen ) );
+  FD_TEST( fd_memeq( (uchar const *)b+b->hlen, exp+1, b->dlen ) );
+  return 1;
+}
+
+static ulong
+txn_rec_cnt( fd_funk_t *           funk,
+             fd_funk_txn_t const * txn ) {
+  ulong cnt = 0UL;
+  for( fd_funk_rec_t const * rec = fd_funk_txn_first_rec( funk, txn ); rec; rec = fd_funk_txn_next_rec( funk, rec ) ) cnt++;
+  return cnt;
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  char const * _page_sz = fd_env_strip_cmdline_cstr  ( &argc, &argv, "--page-sz",  NULL,      "gigantic" );
+  ulong        page_cnt = fd_env_strip_cmdline_ulong ( &argc, &argv, "--page-cnt", NULL,             1UL );
+  ulong        near_cpu = fd_env_strip_cmdline_ulong ( &argc, &argv, "--near-cpu", NULL, fd_log_cpu_id() );
+  ulong        iter_cnt = fd_env_strip_cmdline_ulong ( &argc, &argv, "--iter-cnt", NULL,             8UL );
+
+  fd_wksp_t * wksp = fd_wksp_new_anonymous( fd_cstr_to_shmem_page_sz( _page_sz ), page_cnt, near_cpu, "wksp", 0UL );
+  FD_TEST( wksp );
+  ulong const static_tag = 1UL;
+
+  fd_alloc_t * alloc = fd_alloc_join( fd_alloc_new( fd_wksp_alloc_laddr( wksp, fd_alloc_align(), fd_alloc_footprint(), 41UL ), 41UL ), 0UL );
+  FD_TEST( alloc );
+  fd_valloc_t valloc = fd_alloc_virtual( alloc );
+
+  fd_funk_t * funk = fd_funk_join( fd_funk_new( fd_wksp_alloc_laddr( wksp, fd_funk_align(), fd_funk_footprint(), 42UL ), 42UL, 1234UL, 16UL, 4096UL ) );
+  FD_TEST( funk );
+  fd_funk_start_write( funk );
+
+  fd_acc_mgr_t * acc_mgr = fd_acc_mgr_new( fd_wksp_alloc_laddr( wksp, FD_ACC_MGR_ALIGN, FD_ACC_MGR_FOOTPRINT, static_tag ), funk );
+  FD_TEST( acc_mgr );
+
+  void * restore_mem = fd_wksp_alloc_laddr( wksp, fd_snapshot_restore_align(), fd_snapshot_restore_footprint(), static_tag );
+  void * tar_mem     = fd_wksp_alloc_laddr( wksp, fd_tar_reader_align(),       fd_tar_reader_footprint(),       static_tag );
+  FD_TEST( restore_mem && tar_mem );
+
+  static uchar tpool_mem[ FD_TPOOL_FOOTPRINT(FD_TILE_MAX) ] __attribute__((aligned(FD_TPOOL_ALIGN)));
+  ulong        tile_cnt = fd_tile_cnt();
+  fd_tpool_t * tpool    = fd_tpool_init( tpool_mem, tile_cnt ); FD_TEST( tpool );
+  for( ulong tile_idx=1UL; tile_idx<tile_cnt; tile_idx++ ) FD_TEST( fd_tpool_worker_push( tpool, tile_idx, NULL, 0UL )==tpool );
+
+  fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 1234U, 0UL ) );
+
+  for( ulong iter=0UL; iter<iter_cnt; iter++ ) {
+    ulong tar_sz = make_tar( rng );
+    int   fd     = make_archive( tar_sz, (iter&1UL) ? tar_sz : FRAME_SZ );
+
+    fd_funk_txn_xid_t xid_ser[1] = {{ .ul = { 2UL*iter+1UL, 2UL*iter+1UL } }};
+    fd_funk_txn_xid_t xid_par[1] = {{ .ul = { 2UL*iter+2UL, 2UL*iter+2UL } }};
+    fd_funk_txn_t *   txn_ser = fd_funk_txn_prepare( funk, NULL, xid_ser, 0 ); FD_TEST( txn_ser );
+    fd_funk_txn_t *   txn_par = fd_funk_txn_prepare( funk, NULL, xid_par, 0 ); FD_TEST( txn_par );
+
+    /* Serial restore */
+
+    fd_snapshot_restore_t * restore = new_restore( restore_mem, acc_mgr, txn_ser, valloc );
+    fd_tar_reader_t *       tar     = fd_tar_reader_new( tar_mem, &fd_snapshot_restore_tar_vt, restore );
+    FD_TEST( tar );
+    for( ulong off=0UL; off<tar_sz; off+=FRAME_SZ ) {
+      int err = fd_tar_read( tar, tar_buf+off, fd_ulong_min( FRAME_SZ, tar_sz-off ), 0 );
+      if( err==-1 ) { FD_TEST( off+FRAME_SZ+FD_TAR_BLOCK_SZ>=tar_sz ); break; } /* EOF */
+      FD_TEST( !err );
+    }
+    fd_tar_reader_delete( tar );
+    fd_snapshot_restore_delete( restore );
+
+    /* Parallel restore */
+
+    restore = new_restore( restore_mem, acc_mgr, txn_par, valloc );
+    FD_TEST( !fd_snapshot_restore_par( restore, fd, 1UL<<20, tpool, 0UL, tile_cnt ) );
+    fd_snapshot_restore_delete( restore );
+    FD_TEST( !close( fd ) );
+
+    /* Compare */
+
+    ulong acc_cnt = 0UL;
+    for( ulong i=0UL; i<KEY_CNT; i++ ) acc_cnt += (ulong)check_acc( acc_mgr, txn_ser, txn_par, tar_sz, i );
+    FD_TEST( txn_rec_cnt( funk, txn_ser )==acc_cnt );
+    FD_TEST( txn_rec_cnt( funk, txn_par )==acc_cnt );
+
+    FD_TEST( fd_funk_txn_cancel( funk, txn_ser, 0 ) );
+    FD_TEST( fd_funk_txn_cancel( funk, txn_par, 0 ) );
+  }
+
+  fd_rng_delete( fd_rng_leave( rng ) );
+  fd_tpool_fini( tpool );
+  fd_funk_end_write( funk );
+
+  fd_wksp_delete_anonymous( wksp );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
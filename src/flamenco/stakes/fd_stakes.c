@@ -336,8 +336,7 @@ fd_accumulate_stake_infos( fd_exec_slot_ctx_t const * slot_ctx,
                            fd_stake_history_t const * history,
                            ulong *                    new_rate_activation_epoch,
                            fd_stake_history_entry_t * accumulator,
-                           fd_epoch_info_t *          temp_info,
-                           fd_valloc_t                valloc ) {
+                           fd_epoch_info_t *          temp_info ) {
   ulong delegation_idx = 0UL;
 
   for( fd_delegation_pair_t_mapnode_t * n = fd_delegation_pair_t_map_minimum( stakes->stake_delegations_pool, stakes->stake_delegations_root ); 
@@ -350,7 +349,7 @@ fd_accumulate_stake_infos( fd_exec_slot_ctx_t const * slot_ctx,
     }
 
     fd_stake_state_v2_t stake_state;
-    rc = fd_stake_get_state( acc, valloc, &stake_state );
+    rc = fd_stake_get_state( acc, &stake_state );
     if( FD_UNLIKELY( rc != 0 ) ) {
       continue;
     }
@@ -382,7 +381,7 @@ fd_accumulate_stake_infos( fd_exec_slot_ctx_t const * slot_ctx,
     }
 
     fd_stake_state_v2_t stake_state;
-    rc = fd_stake_get_state( acc, valloc, &stake_state );
+    rc = fd_stake_get_state( acc, &stake_state );
     if( FD_UNLIKELY( rc != 0) ) {
       continue;
     }
@@ -411,9 +410,7 @@ fd_accumulate_stake_infos( fd_exec_slot_ctx_t const * slot_ctx,
 void
 fd_stakes_activate_epoch( fd_exec_slot_ctx_t *  slot_ctx,
                           ulong *               new_rate_activation_epoch,
-                          fd_epoch_info_t      *temp_info,
-                          fd_valloc_t           valloc
- ) {
+                          fd_epoch_info_t      *temp_info ) {
   fd_epoch_bank_t * epoch_bank = fd_exec_epoch_ctx_epoch_bank( slot_ctx->epoch_ctx );
   fd_stakes_t * stakes = &epoch_bank->stakes;
 
@@ -440,7 +437,7 @@ fd_stakes_activate_epoch( fd_exec_slot_ctx_t *  slot_ctx,
   };
 
   /* Accumulate stats for stake accounts */
-  fd_accumulate_stake_infos( slot_ctx, stakes, history, new_rate_activation_epoch, &accumulator, temp_info, valloc );
+  fd_accumulate_stake_infos( slot_ctx, stakes, history, new_rate_activation_epoch, &accumulator, temp_info );
 
   /* https://github.com/anza-xyz/agave/blob/v2.1.6/runtime/src/stakes.rs#L359 */
   fd_stake_history_entry_t new_elem = {
@@ -31,8 +31,7 @@ fd_stake_weights_by_node( fd_vote_accounts_t const * accs,
 void
 fd_stakes_activate_epoch( fd_exec_slot_ctx_t *  slot_ctx,
                           ulong *               new_rate_activation_epoch,
-                          fd_epoch_info_t *     temp_info,
-                          fd_valloc_t           valloc );
+                          fd_epoch_info_t *     temp_info );
 
 fd_stake_history_entry_t 
 stake_and_activating( fd_delegation_t const * delegation,
@@ -68,8 +67,7 @@ fd_accumulate_stake_infos( fd_exec_slot_ctx_t const * slot_ctx,
                            fd_stake_history_t const * history,
                            ulong *                    new_rate_activation_epoch,
                            fd_stake_history_entry_t * accumulator,
-                           fd_epoch_info_t *          temp_info,
-                           fd_valloc_t                valloc );
+                           fd_epoch_info_t *          temp_info );
 
 FD_PROTOTYPES_END
 
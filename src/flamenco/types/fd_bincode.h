@@ -421,6 +421,58 @@ fd_bincode_varint_size( ulong val ) {
   }
 }
 
+/* Single arena decoding **********************************************
+
+   Every generated type T with decoders also provides
+
+     int  T_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+     T_t * T_decode_inner   ( void * mem, fd_bincode_decode_ctx_t * ctx );
+
+   T_decode_footprint validates the encoded object at ctx->data (same
+   checks as T_decode_preflight) and on success sets *total_sz to the
+   exact number of bytes needed to hold the decoded T_t and everything
+   it points to (vectors, deques, maps, strings, ...).  ctx->data is
+   left unchanged.
+
+   T_decode_inner then decodes into the caller provided region mem,
+   which must be aligned FD_BINCODE_ARENA_ALIGN and at least *total_sz
+   bytes.  The T_t is placed at mem and all of its dynamic members are
+   bump allocated in the remainder of the region, in decode order, so
+   the whole object graph is contiguous and no allocator is called.
+   Returns mem.  ctx->valloc is ignored and ctx->data is advanced past
+   the object.  Objects decoded this way must not be destroyed; the
+   caller frees the region when done.
+
+   Internally, T_decode_footprint_inner advances *total_sz (an offset
+   relative to an FD_BINCODE_ARENA_ALIGN aligned base) by the dynamic
+   allocations of T in the same order T_decode_unsafe makes them. */
+
+#define FD_BINCODE_ARENA_ALIGN (128UL)
+
+struct fd_bincode_arena {
+  ulong cur; /* next free byte */
+};
+typedef struct fd_bincode_arena fd_bincode_arena_t;
+
+/* fd_bincode_arena_vtable is the virtual function table implementing
+   fd_valloc for fd_bincode_arena_t.  malloc bump allocates and free is
+   a no-op. */
+
+extern const fd_valloc_vtable_t fd_bincode_arena_vtable;
+
+static inline fd_valloc_t
+fd_bincode_arena_virtual( fd_bincode_arena_t * arena ) {
+  fd_valloc_t valloc = { arena, &fd_bincode_arena_vtable };
+  return valloc;
+}
+
+static inline ulong
+fd_bincode_footprint_alloc( ulong total_sz,
+                            ulong align,
+                            ulong sz ) {
+  return fd_ulong_align_up( total_sz, align ) + sz;
+}
+
 enum {
   /* All meta tags must fit in 6 bits */
 
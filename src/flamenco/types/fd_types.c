@@ -13,12 +13,32 @@ int fd_hash_decode( fd_hash_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_hash_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_hash_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_hash_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( sizeof(fd_hash_t), ctx );
 }
+int fd_hash_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_hash_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_hash_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_hash_t);
+  int err = fd_hash_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_hash_decode_unsafe( fd_hash_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_bytes_decode_unsafe( (uchar*)self, sizeof(fd_hash_t), ctx );
 }
+fd_hash_t * fd_hash_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_hash_t * self = (fd_hash_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_hash_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_hash_new( self );
+  fd_hash_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 void fd_hash_new( fd_hash_t * self ) { }
 void fd_hash_destroy( fd_hash_t * self, fd_bincode_destroy_ctx_t * ctx ) { }
 ulong fd_hash_footprint( void ) { return sizeof(fd_hash_t); }
@@ -40,12 +60,32 @@ int fd_signature_decode( fd_signature_t * self, fd_bincode_decode_ctx_t * ctx )
   fd_signature_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_signature_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_signature_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( sizeof(fd_signature_t), ctx );
 }
+int fd_signature_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_signature_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_signature_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_signature_t);
+  int err = fd_signature_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_signature_decode_unsafe( fd_signature_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_bytes_decode_unsafe( (uchar*)self, sizeof(fd_signature_t), ctx );
 }
+fd_signature_t * fd_signature_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_signature_t * self = (fd_signature_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_signature_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_signature_new( self );
+  fd_signature_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 void fd_signature_new( fd_signature_t * self ) { }
 void fd_signature_destroy( fd_signature_t * self, fd_bincode_destroy_ctx_t * ctx ) { }
 ulong fd_signature_footprint( void ) { return sizeof(fd_signature_t); }
@@ -67,12 +107,32 @@ int fd_gossip_ip4_addr_decode( fd_gossip_ip4_addr_t * self, fd_bincode_decode_ct
   fd_gossip_ip4_addr_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_gossip_ip4_addr_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_gossip_ip4_addr_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( sizeof(fd_gossip_ip4_addr_t), ctx );
 }
+int fd_gossip_ip4_addr_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_gossip_ip4_addr_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_gossip_ip4_addr_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_gossip_ip4_addr_t);
+  int err = fd_gossip_ip4_addr_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_gossip_ip4_addr_decode_unsafe( fd_gossip_ip4_addr_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_bytes_decode_unsafe( (uchar*)self, sizeof(fd_gossip_ip4_addr_t), ctx );
 }
+fd_gossip_ip4_addr_t * fd_gossip_ip4_addr_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_gossip_ip4_addr_t * self = (fd_gossip_ip4_addr_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_gossip_ip4_addr_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_gossip_ip4_addr_new( self );
+  fd_gossip_ip4_addr_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 void fd_gossip_ip4_addr_new( fd_gossip_ip4_addr_t * self ) { }
 void fd_gossip_ip4_addr_destroy( fd_gossip_ip4_addr_t * self, fd_bincode_destroy_ctx_t * ctx ) { }
 ulong fd_gossip_ip4_addr_footprint( void ) { return sizeof(fd_gossip_ip4_addr_t); }
@@ -91,12 +151,32 @@ int fd_gossip_ip6_addr_decode( fd_gossip_ip6_addr_t * self, fd_bincode_decode_ct
   fd_gossip_ip6_addr_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_gossip_ip6_addr_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_gossip_ip6_addr_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( sizeof(fd_gossip_ip6_addr_t), ctx );
 }
+int fd_gossip_ip6_addr_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_gossip_ip6_addr_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_gossip_ip6_addr_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_gossip_ip6_addr_t);
+  int err = fd_gossip_ip6_addr_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_gossip_ip6_addr_decode_unsafe( fd_gossip_ip6_addr_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_bytes_decode_unsafe( (uchar*)self, sizeof(fd_gossip_ip6_addr_t), ctx );
 }
+fd_gossip_ip6_addr_t * fd_gossip_ip6_addr_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_gossip_ip6_addr_t * self = (fd_gossip_ip6_addr_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_gossip_ip6_addr_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_gossip_ip6_addr_new( self );
+  fd_gossip_ip6_addr_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 void fd_gossip_ip6_addr_new( fd_gossip_ip6_addr_t * self ) { }
 void fd_gossip_ip6_addr_destroy( fd_gossip_ip6_addr_t * self, fd_bincode_destroy_ctx_t * ctx ) { }
 ulong fd_gossip_ip6_addr_footprint( void ) { return sizeof(fd_gossip_ip6_addr_t); }
@@ -117,7 +197,7 @@ int fd_feature_decode( fd_feature_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_feature_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_feature_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_feature_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   {
     uchar o;
@@ -130,6 +210,17 @@ int fd_feature_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_feature_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_feature_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_feature_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_feature_t);
+  int err = fd_feature_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_feature_decode_unsafe( fd_feature_t * self, fd_bincode_decode_ctx_t * ctx ) {
   {
     uchar o;
@@ -140,6 +231,15 @@ void fd_feature_decode_unsafe( fd_feature_t * self, fd_bincode_decode_ctx_t * ct
     }
   }
 }
+fd_feature_t * fd_feature_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_feature_t * self = (fd_feature_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_feature_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_feature_new( self );
+  fd_feature_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_feature_encode( fd_feature_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_bool_encode( self->has_activated_at, ctx );
@@ -152,6 +252,7 @@ int fd_feature_encode( fd_feature_t const * self, fd_bincode_encode_ctx_t * ctx
 }
 int fd_feature_decode_offsets( fd_feature_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->activated_at_off = (uint)( (ulong)ctx->data - (ulong)data );
   {
@@ -206,12 +307,32 @@ int fd_fee_calculator_decode( fd_fee_calculator_t * self, fd_bincode_decode_ctx_
   fd_fee_calculator_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_fee_calculator_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_fee_calculator_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 8, ctx );
 }
+int fd_fee_calculator_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_fee_calculator_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_fee_calculator_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_fee_calculator_t);
+  int err = fd_fee_calculator_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_fee_calculator_decode_unsafe( fd_fee_calculator_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->lamports_per_signature, ctx );
 }
+fd_fee_calculator_t * fd_fee_calculator_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_fee_calculator_t * self = (fd_fee_calculator_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_fee_calculator_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_fee_calculator_new( self );
+  fd_fee_calculator_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_fee_calculator_encode( fd_fee_calculator_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->lamports_per_signature, ctx );
@@ -284,6 +405,7 @@ int fd_fee_calculator_encode_archival( fd_fee_calculator_t const * self, fd_binc
 }
 int fd_fee_calculator_decode_offsets( fd_fee_calculator_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->lamports_per_signature_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -298,6 +420,7 @@ void fd_fee_calculator_destroy( fd_fee_calculator_t * self, fd_bincode_destroy_c
 
 ulong fd_fee_calculator_footprint( void ){ return FD_FEE_CALCULATOR_FOOTPRINT; }
 ulong fd_fee_calculator_align( void ){ return FD_FEE_CALCULATOR_ALIGN; }
+FD_STATIC_ASSERT( sizeof(fd_fee_calculator_t)==8UL, fd_fee_calculator_view );
 
 void fd_fee_calculator_walk( void * w, fd_fee_calculator_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_fee_calculator", level++ );
@@ -321,14 +444,34 @@ int fd_hash_age_decode( fd_hash_age_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_hash_age_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_hash_age_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_hash_age_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 24, ctx );
 }
+int fd_hash_age_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_hash_age_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_hash_age_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_hash_age_t);
+  int err = fd_hash_age_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_hash_age_decode_unsafe( fd_hash_age_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_fee_calculator_decode_unsafe( &self->fee_calculator, ctx );
   fd_bincode_uint64_decode_unsafe( &self->hash_index, ctx );
   fd_bincode_uint64_decode_unsafe( &self->timestamp, ctx );
 }
+fd_hash_age_t * fd_hash_age_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_hash_age_t * self = (fd_hash_age_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_hash_age_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_hash_age_new( self );
+  fd_hash_age_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_hash_age_encode( fd_hash_age_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_fee_calculator_encode( &self->fee_calculator, ctx );
@@ -442,9 +585,10 @@ int fd_hash_age_encode_archival( fd_hash_age_t const * self, fd_bincode_encode_c
 }
 int fd_hash_age_decode_offsets( fd_hash_age_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->fee_calculator_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_fee_calculator_decode_preflight( ctx );
+  err = fd_fee_calculator_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->hash_index_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -464,6 +608,7 @@ void fd_hash_age_destroy( fd_hash_age_t * self, fd_bincode_destroy_ctx_t * ctx )
 
 ulong fd_hash_age_footprint( void ){ return FD_HASH_AGE_FOOTPRINT; }
 ulong fd_hash_age_align( void ){ return FD_HASH_AGE_ALIGN; }
+FD_STATIC_ASSERT( sizeof(fd_hash_age_t)==24UL, fd_hash_age_view );
 
 void fd_hash_age_walk( void * w, fd_hash_age_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_hash_age", level++ );
@@ -491,13 +636,33 @@ int fd_hash_hash_age_pair_decode( fd_hash_hash_age_pair_t * self, fd_bincode_dec
   fd_hash_hash_age_pair_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_hash_hash_age_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_hash_hash_age_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 56, ctx );
 }
+int fd_hash_hash_age_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_hash_hash_age_pair_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_hash_hash_age_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_hash_hash_age_pair_t);
+  int err = fd_hash_hash_age_pair_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_hash_hash_age_pair_decode_unsafe( fd_hash_hash_age_pair_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_hash_decode_unsafe( &self->key, ctx );
   fd_hash_age_decode_unsafe( &self->val, ctx );
 }
+fd_hash_hash_age_pair_t * fd_hash_hash_age_pair_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_hash_hash_age_pair_t * self = (fd_hash_hash_age_pair_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_hash_hash_age_pair_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_hash_hash_age_pair_new( self );
+  fd_hash_hash_age_pair_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_hash_hash_age_pair_encode( fd_hash_hash_age_pair_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_hash_encode( &self->key, ctx );
@@ -604,12 +769,13 @@ int fd_hash_hash_age_pair_encode_archival( fd_hash_hash_age_pair_t const * self,
 }
 int fd_hash_hash_age_pair_decode_offsets( fd_hash_hash_age_pair_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->key_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->val_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_hash_age_decode_preflight( ctx );
+  err = fd_hash_age_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -625,6 +791,7 @@ void fd_hash_hash_age_pair_destroy( fd_hash_hash_age_pair_t * self, fd_bincode_d
 
 ulong fd_hash_hash_age_pair_footprint( void ){ return FD_HASH_HASH_AGE_PAIR_FOOTPRINT; }
 ulong fd_hash_hash_age_pair_align( void ){ return FD_HASH_HASH_AGE_PAIR_ALIGN; }
+FD_STATIC_ASSERT( sizeof(fd_hash_hash_age_pair_t)==56UL, fd_hash_hash_age_pair_view );
 
 void fd_hash_hash_age_pair_walk( void * w, fd_hash_hash_age_pair_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_hash_hash_age_pair", level++ );
@@ -650,7 +817,7 @@ int fd_block_hash_vec_decode( fd_block_hash_vec_t * self, fd_bincode_decode_ctx_
   fd_block_hash_vec_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_block_hash_vec_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_block_hash_vec_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -659,7 +826,8 @@ int fd_block_hash_vec_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
-      err = fd_hash_decode_preflight( ctx );
+      *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_HASH_ALIGN, FD_HASH_FOOTPRINT );
+      err = fd_hash_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -667,8 +835,9 @@ int fd_block_hash_vec_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   err = fd_bincode_uint64_decode( &ages_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( ages_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_HASH_HASH_AGE_PAIR_ALIGN, FD_HASH_HASH_AGE_PAIR_FOOTPRINT*ages_len );
     for( ulong i=0; i < ages_len; i++ ) {
-      err = fd_hash_hash_age_pair_decode_preflight( ctx );
+      err = fd_hash_hash_age_pair_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -676,6 +845,17 @@ int fd_block_hash_vec_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_block_hash_vec_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_block_hash_vec_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_block_hash_vec_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_block_hash_vec_t);
+  int err = fd_block_hash_vec_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_block_hash_vec_decode_unsafe( fd_block_hash_vec_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->last_hash_index, ctx );
   {
@@ -699,6 +879,15 @@ void fd_block_hash_vec_decode_unsafe( fd_block_hash_vec_t * self, fd_bincode_dec
     self->ages = NULL;
   fd_bincode_uint64_decode_unsafe( &self->max_age, ctx );
 }
+fd_block_hash_vec_t * fd_block_hash_vec_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_block_hash_vec_t * self = (fd_block_hash_vec_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_block_hash_vec_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_block_hash_vec_new( self );
+  fd_block_hash_vec_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_block_hash_vec_encode( fd_block_hash_vec_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->last_hash_index, ctx );
@@ -726,6 +915,7 @@ int fd_block_hash_vec_encode( fd_block_hash_vec_t const * self, fd_bincode_encod
 }
 int fd_block_hash_vec_decode_offsets( fd_block_hash_vec_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->last_hash_index_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -736,7 +926,8 @@ int fd_block_hash_vec_decode_offsets( fd_block_hash_vec_off_t * self, fd_bincode
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
-      err = fd_hash_decode_preflight( ctx );
+      *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_HASH_ALIGN, FD_HASH_FOOTPRINT );
+      err = fd_hash_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -745,8 +936,9 @@ int fd_block_hash_vec_decode_offsets( fd_block_hash_vec_off_t * self, fd_bincode
   err = fd_bincode_uint64_decode( &ages_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( ages_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_HASH_HASH_AGE_PAIR_ALIGN, FD_HASH_HASH_AGE_PAIR_FOOTPRINT*ages_len );
     for( ulong i=0; i < ages_len; i++ ) {
-      err = fd_hash_hash_age_pair_decode_preflight( ctx );
+      err = fd_hash_hash_age_pair_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -819,7 +1011,7 @@ int fd_block_hash_queue_decode( fd_block_hash_queue_t * self, fd_bincode_decode_
   fd_block_hash_queue_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_block_hash_queue_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_block_hash_queue_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -828,21 +1020,34 @@ int fd_block_hash_queue_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
-      err = fd_hash_decode_preflight( ctx );
+      *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_HASH_ALIGN, FD_HASH_FOOTPRINT );
+      err = fd_hash_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
   ulong ages_len;
   err = fd_bincode_uint64_decode( &ages_len, ctx );
   if( FD_UNLIKELY( err ) ) return err;
+  *total_sz = fd_bincode_footprint_alloc( *total_sz, fd_hash_hash_age_pair_t_map_align(), fd_hash_hash_age_pair_t_map_footprint( fd_ulong_max( ages_len, 400 ) ) );
   for( ulong i=0; i < ages_len; i++ ) {
-    err = fd_hash_hash_age_pair_decode_preflight( ctx );
+    err = fd_hash_hash_age_pair_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
   }
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_block_hash_queue_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_block_hash_queue_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_block_hash_queue_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_block_hash_queue_t);
+  int err = fd_block_hash_queue_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_block_hash_queue_decode_unsafe( fd_block_hash_queue_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->last_hash_index, ctx );
   {
@@ -869,6 +1074,15 @@ void fd_block_hash_queue_decode_unsafe( fd_block_hash_queue_t * self, fd_bincode
   }
   fd_bincode_uint64_decode_unsafe( &self->max_age, ctx );
 }
+fd_block_hash_queue_t * fd_block_hash_queue_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_block_hash_queue_t * self = (fd_block_hash_queue_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_block_hash_queue_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_block_hash_queue_new( self );
+  fd_block_hash_queue_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_block_hash_queue_encode( fd_block_hash_queue_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->last_hash_index, ctx );
@@ -1075,6 +1289,7 @@ int fd_block_hash_queue_encode_archival( fd_block_hash_queue_t const * self, fd_
 }
 int fd_block_hash_queue_decode_offsets( fd_block_hash_queue_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->last_hash_index_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -1085,7 +1300,8 @@ int fd_block_hash_queue_decode_offsets( fd_block_hash_queue_off_t * self, fd_bin
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
-      err = fd_hash_decode_preflight( ctx );
+      *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_HASH_ALIGN, FD_HASH_FOOTPRINT );
+      err = fd_hash_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -1093,8 +1309,9 @@ int fd_block_hash_queue_decode_offsets( fd_block_hash_queue_off_t * self, fd_bin
   ulong ages_len;
   err = fd_bincode_uint64_decode( &ages_len, ctx );
   if( FD_UNLIKELY( err ) ) return err;
+  *total_sz = fd_bincode_footprint_alloc( *total_sz, fd_hash_hash_age_pair_t_map_align(), fd_hash_hash_age_pair_t_map_footprint( fd_ulong_max( ages_len, 400 ) ) );
   for( ulong i=0; i < ages_len; i++ ) {
-    err = fd_hash_hash_age_pair_decode_preflight( ctx );
+    err = fd_hash_hash_age_pair_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
   }
   self->max_age_off = (uint)( (ulong)ctx->data - (ulong)data );
@@ -1168,9 +1385,20 @@ int fd_fee_rate_governor_decode( fd_fee_rate_governor_t * self, fd_bincode_decod
   fd_fee_rate_governor_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_fee_rate_governor_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_fee_rate_governor_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 33, ctx );
 }
+int fd_fee_rate_governor_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_fee_rate_governor_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_fee_rate_governor_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_fee_rate_governor_t);
+  int err = fd_fee_rate_governor_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_fee_rate_governor_decode_unsafe( fd_fee_rate_governor_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->target_lamports_per_signature, ctx );
   fd_bincode_uint64_decode_unsafe( &self->target_signatures_per_slot, ctx );
@@ -1178,6 +1406,15 @@ void fd_fee_rate_governor_decode_unsafe( fd_fee_rate_governor_t * self, fd_binco
   fd_bincode_uint64_decode_unsafe( &self->max_lamports_per_signature, ctx );
   fd_bincode_uint8_decode_unsafe( &self->burn_percent, ctx );
 }
+fd_fee_rate_governor_t * fd_fee_rate_governor_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_fee_rate_governor_t * self = (fd_fee_rate_governor_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_fee_rate_governor_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_fee_rate_governor_new( self );
+  fd_fee_rate_governor_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_fee_rate_governor_encode( fd_fee_rate_governor_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->target_lamports_per_signature, ctx );
@@ -1314,6 +1551,7 @@ int fd_fee_rate_governor_encode_archival( fd_fee_rate_governor_t const * self, f
 }
 int fd_fee_rate_governor_decode_offsets( fd_fee_rate_governor_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->target_lamports_per_signature_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -1371,13 +1609,33 @@ int fd_slot_pair_decode( fd_slot_pair_t * self, fd_bincode_decode_ctx_t * ctx )
   fd_slot_pair_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_slot_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_slot_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 16, ctx );
 }
+int fd_slot_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_slot_pair_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_slot_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_slot_pair_t);
+  int err = fd_slot_pair_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_slot_pair_decode_unsafe( fd_slot_pair_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->slot, ctx );
   fd_bincode_uint64_decode_unsafe( &self->val, ctx );
 }
+fd_slot_pair_t * fd_slot_pair_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_slot_pair_t * self = (fd_slot_pair_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_slot_pair_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_slot_pair_new( self );
+  fd_slot_pair_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_slot_pair_encode( fd_slot_pair_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->slot, ctx );
@@ -1466,6 +1724,7 @@ int fd_slot_pair_encode_archival( fd_slot_pair_t const * self, fd_bincode_encode
 }
 int fd_slot_pair_decode_offsets( fd_slot_pair_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->slot_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -1483,6 +1742,7 @@ void fd_slot_pair_destroy( fd_slot_pair_t * self, fd_bincode_destroy_ctx_t * ctx
 
 ulong fd_slot_pair_footprint( void ){ return FD_SLOT_PAIR_FOOTPRINT; }
 ulong fd_slot_pair_align( void ){ return FD_SLOT_PAIR_ALIGN; }
+FD_STATIC_ASSERT( sizeof(fd_slot_pair_t)==16UL, fd_slot_pair_view );
 
 void fd_slot_pair_walk( void * w, fd_slot_pair_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_slot_pair", level++ );
@@ -1508,19 +1768,31 @@ int fd_hard_forks_decode( fd_hard_forks_t * self, fd_bincode_decode_ctx_t * ctx
   fd_hard_forks_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_hard_forks_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_hard_forks_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   ulong hard_forks_len;
   err = fd_bincode_uint64_decode( &hard_forks_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( hard_forks_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_SLOT_PAIR_ALIGN, FD_SLOT_PAIR_FOOTPRINT*hard_forks_len );
     for( ulong i=0; i < hard_forks_len; i++ ) {
-      err = fd_slot_pair_decode_preflight( ctx );
+      err = fd_slot_pair_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_hard_forks_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_hard_forks_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_hard_forks_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_hard_forks_t);
+  int err = fd_hard_forks_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_hard_forks_decode_unsafe( fd_hard_forks_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->hard_forks_len, ctx );
   if( self->hard_forks_len ) {
@@ -1532,6 +1804,15 @@ void fd_hard_forks_decode_unsafe( fd_hard_forks_t * self, fd_bincode_decode_ctx_
   } else
     self->hard_forks = NULL;
 }
+fd_hard_forks_t * fd_hard_forks_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_hard_forks_t * self = (fd_hard_forks_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_hard_forks_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_hard_forks_new( self );
+  fd_hard_forks_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_hard_forks_encode( fd_hard_forks_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->hard_forks_len, ctx );
@@ -1640,14 +1921,16 @@ int fd_hard_forks_encode_archival( fd_hard_forks_t const * self, fd_bincode_enco
 }
 int fd_hard_forks_decode_offsets( fd_hard_forks_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->hard_forks_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong hard_forks_len;
   err = fd_bincode_uint64_decode( &hard_forks_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( hard_forks_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_SLOT_PAIR_ALIGN, FD_SLOT_PAIR_FOOTPRINT*hard_forks_len );
     for( ulong i=0; i < hard_forks_len; i++ ) {
-      err = fd_slot_pair_decode_preflight( ctx );
+      err = fd_slot_pair_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -1699,9 +1982,20 @@ int fd_inflation_decode( fd_inflation_t * self, fd_bincode_decode_ctx_t * ctx )
   fd_inflation_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_inflation_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_inflation_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 48, ctx );
 }
+int fd_inflation_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_inflation_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_inflation_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_inflation_t);
+  int err = fd_inflation_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_inflation_decode_unsafe( fd_inflation_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_double_decode_unsafe( &self->initial, ctx );
   fd_bincode_double_decode_unsafe( &self->terminal, ctx );
@@ -1710,6 +2004,15 @@ void fd_inflation_decode_unsafe( fd_inflation_t * self, fd_bincode_decode_ctx_t
   fd_bincode_double_decode_unsafe( &self->foundation_term, ctx );
   fd_bincode_double_decode_unsafe( &self->unused, ctx );
 }
+fd_inflation_t * fd_inflation_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_inflation_t * self = (fd_inflation_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_inflation_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_inflation_new( self );
+  fd_inflation_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_inflation_encode( fd_inflation_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_double_encode( self->initial, ctx );
@@ -1862,6 +2165,7 @@ int fd_inflation_encode_archival( fd_inflation_t const * self, fd_bincode_encode
 }
 int fd_inflation_decode_offsets( fd_inflation_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->initial_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_double_decode_preflight( ctx );
@@ -1891,6 +2195,7 @@ void fd_inflation_destroy( fd_inflation_t * self, fd_bincode_destroy_ctx_t * ctx
 
 ulong fd_inflation_footprint( void ){ return FD_INFLATION_FOOTPRINT; }
 ulong fd_inflation_align( void ){ return FD_INFLATION_ALIGN; }
+FD_STATIC_ASSERT( sizeof(fd_inflation_t)==48UL, fd_inflation_view );
 
 void fd_inflation_walk( void * w, fd_inflation_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_inflation", level++ );
@@ -1924,14 +2229,34 @@ int fd_rent_decode( fd_rent_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_rent_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_rent_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_rent_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 17, ctx );
 }
+int fd_rent_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_rent_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_rent_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_rent_t);
+  int err = fd_rent_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_rent_decode_unsafe( fd_rent_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->lamports_per_uint8_year, ctx );
   fd_bincode_double_decode_unsafe( &self->exemption_threshold, ctx );
   fd_bincode_uint8_decode_unsafe( &self->burn_percent, ctx );
 }
+fd_rent_t * fd_rent_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_rent_t * self = (fd_rent_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_rent_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_rent_new( self );
+  fd_rent_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_rent_encode( fd_rent_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->lamports_per_uint8_year, ctx );
@@ -2036,6 +2361,7 @@ int fd_rent_encode_archival( fd_rent_t const * self, fd_bincode_encode_ctx_t * c
 }
 int fd_rent_decode_offsets( fd_rent_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->lamports_per_uint8_year_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -2083,7 +2409,7 @@ int fd_epoch_schedule_decode( fd_epoch_schedule_t * self, fd_bincode_decode_ctx_
   fd_epoch_schedule_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_epoch_schedule_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_epoch_schedule_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -2097,6 +2423,17 @@ int fd_epoch_schedule_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_epoch_schedule_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_epoch_schedule_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_epoch_schedule_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_epoch_schedule_t);
+  int err = fd_epoch_schedule_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_epoch_schedule_decode_unsafe( fd_epoch_schedule_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->slots_per_epoch, ctx );
   fd_bincode_uint64_decode_unsafe( &self->leader_schedule_slot_offset, ctx );
@@ -2104,6 +2441,15 @@ void fd_epoch_schedule_decode_unsafe( fd_epoch_schedule_t * self, fd_bincode_dec
   fd_bincode_uint64_decode_unsafe( &self->first_normal_epoch, ctx );
   fd_bincode_uint64_decode_unsafe( &self->first_normal_slot, ctx );
 }
+fd_epoch_schedule_t * fd_epoch_schedule_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_epoch_schedule_t * self = (fd_epoch_schedule_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_epoch_schedule_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_epoch_schedule_new( self );
+  fd_epoch_schedule_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_epoch_schedule_encode( fd_epoch_schedule_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->slots_per_epoch, ctx );
@@ -2240,6 +2586,7 @@ int fd_epoch_schedule_encode_archival( fd_epoch_schedule_t const * self, fd_binc
 }
 int fd_epoch_schedule_decode_offsets( fd_epoch_schedule_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->slots_per_epoch_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -2297,24 +2644,44 @@ int fd_rent_collector_decode( fd_rent_collector_t * self, fd_bincode_decode_ctx_
   fd_rent_collector_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_rent_collector_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_rent_collector_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_epoch_schedule_decode_preflight( ctx );
+  err = fd_epoch_schedule_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_double_decode_preflight( ctx );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_rent_decode_preflight( ctx );
+  err = fd_rent_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_rent_collector_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_rent_collector_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_rent_collector_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_rent_collector_t);
+  int err = fd_rent_collector_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_rent_collector_decode_unsafe( fd_rent_collector_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->epoch, ctx );
   fd_epoch_schedule_decode_unsafe( &self->epoch_schedule, ctx );
   fd_bincode_double_decode_unsafe( &self->slots_per_year, ctx );
   fd_rent_decode_unsafe( &self->rent, ctx );
 }
+fd_rent_collector_t * fd_rent_collector_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_rent_collector_t * self = (fd_rent_collector_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_rent_collector_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_rent_collector_new( self );
+  fd_rent_collector_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_rent_collector_encode( fd_rent_collector_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->epoch, ctx );
@@ -2329,18 +2696,19 @@ int fd_rent_collector_encode( fd_rent_collector_t const * self, fd_bincode_encod
 }
 int fd_rent_collector_decode_offsets( fd_rent_collector_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->epoch_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->epoch_schedule_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_epoch_schedule_decode_preflight( ctx );
+  err = fd_epoch_schedule_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->slots_per_year_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_double_decode_preflight( ctx );
   if( FD_UNLIKELY( err ) ) return err;
   self->rent_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_rent_decode_preflight( ctx );
+  err = fd_rent_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -2385,15 +2753,35 @@ int fd_stake_history_entry_decode( fd_stake_history_entry_t * self, fd_bincode_d
   fd_stake_history_entry_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_stake_history_entry_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_stake_history_entry_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 32, ctx );
 }
+int fd_stake_history_entry_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_stake_history_entry_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_stake_history_entry_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_stake_history_entry_t);
+  int err = fd_stake_history_entry_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_stake_history_entry_decode_unsafe( fd_stake_history_entry_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->epoch, ctx );
   fd_bincode_uint64_decode_unsafe( &self->effective, ctx );
   fd_bincode_uint64_decode_unsafe( &self->activating, ctx );
   fd_bincode_uint64_decode_unsafe( &self->deactivating, ctx );
 }
+fd_stake_history_entry_t * fd_stake_history_entry_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_stake_history_entry_t * self = (fd_stake_history_entry_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_stake_history_entry_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_stake_history_entry_new( self );
+  fd_stake_history_entry_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_stake_history_entry_encode( fd_stake_history_entry_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->epoch, ctx );
@@ -2514,6 +2902,7 @@ int fd_stake_history_entry_encode_archival( fd_stake_history_entry_t const * sel
 }
 int fd_stake_history_entry_decode_offsets( fd_stake_history_entry_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->epoch_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -2537,6 +2926,7 @@ void fd_stake_history_entry_destroy( fd_stake_history_entry_t * self, fd_bincode
 
 ulong fd_stake_history_entry_footprint( void ){ return FD_STAKE_HISTORY_ENTRY_FOOTPRINT; }
 ulong fd_stake_history_entry_align( void ){ return FD_STAKE_HISTORY_ENTRY_ALIGN; }
+FD_STATIC_ASSERT( sizeof(fd_stake_history_entry_t)==32UL, fd_stake_history_entry_view );
 
 void fd_stake_history_entry_walk( void * w, fd_stake_history_entry_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_stake_history_entry", level++ );
@@ -2566,19 +2956,30 @@ int fd_stake_history_decode( fd_stake_history_t * self, fd_bincode_decode_ctx_t
   fd_stake_history_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_stake_history_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_stake_history_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   ulong fd_stake_history_len;
   err = fd_bincode_uint64_decode( &fd_stake_history_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( fd_stake_history_len ) {
     for( ulong i=0; i < fd_stake_history_len; i++ ) {
-      err = fd_stake_history_entry_decode_preflight( ctx );
+      err = fd_stake_history_entry_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_stake_history_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_stake_history_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_stake_history_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_stake_history_t);
+  int err = fd_stake_history_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_stake_history_decode_unsafe( fd_stake_history_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->fd_stake_history_len, ctx );
   self->fd_stake_history_size = 512;
@@ -2587,6 +2988,15 @@ void fd_stake_history_decode_unsafe( fd_stake_history_t * self, fd_bincode_decod
     fd_stake_history_entry_decode_unsafe( self->fd_stake_history + i, ctx );
   }
 }
+fd_stake_history_t * fd_stake_history_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_stake_history_t * self = (fd_stake_history_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_stake_history_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_stake_history_new( self );
+  fd_stake_history_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_stake_history_encode( fd_stake_history_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->fd_stake_history_len, ctx );
@@ -2692,6 +3102,7 @@ int fd_stake_history_encode_archival( fd_stake_history_t const * self, fd_bincod
 }
 int fd_stake_history_decode_offsets( fd_stake_history_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->fd_stake_history_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong fd_stake_history_len;
@@ -2699,7 +3110,7 @@ int fd_stake_history_decode_offsets( fd_stake_history_off_t * self, fd_bincode_d
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( fd_stake_history_len ) {
     for( ulong i=0; i < fd_stake_history_len; i++ ) {
-      err = fd_stake_history_entry_decode_preflight( ctx );
+      err = fd_stake_history_entry_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -2748,7 +3159,7 @@ int fd_solana_account_decode( fd_solana_account_t * self, fd_bincode_decode_ctx_
   fd_solana_account_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_solana_account_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_solana_account_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -2756,10 +3167,11 @@ int fd_solana_account_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   err = fd_bincode_uint64_decode( &data_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( data_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, data_len );
     err = fd_bincode_bytes_decode_preflight( data_len, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   }
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_bool_decode_preflight( ctx );
   if( FD_UNLIKELY( err ) ) return err;
@@ -2767,6 +3179,17 @@ int fd_solana_account_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_solana_account_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_solana_account_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_solana_account_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_solana_account_t);
+  int err = fd_solana_account_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_solana_account_decode_unsafe( fd_solana_account_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->lamports, ctx );
   fd_bincode_uint64_decode_unsafe( &self->data_len, ctx );
@@ -2779,6 +3202,15 @@ void fd_solana_account_decode_unsafe( fd_solana_account_t * self, fd_bincode_dec
   fd_bincode_bool_decode_unsafe( &self->executable, ctx );
   fd_bincode_uint64_decode_unsafe( &self->rent_epoch, ctx );
 }
+fd_solana_account_t * fd_solana_account_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_solana_account_t * self = (fd_solana_account_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_solana_account_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_solana_account_new( self );
+  fd_solana_account_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_solana_account_encode( fd_solana_account_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->lamports, ctx );
@@ -2799,6 +3231,7 @@ int fd_solana_account_encode( fd_solana_account_t const * self, fd_bincode_encod
 }
 int fd_solana_account_decode_offsets( fd_solana_account_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->lamports_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -2808,11 +3241,12 @@ int fd_solana_account_decode_offsets( fd_solana_account_off_t * self, fd_bincode
   err = fd_bincode_uint64_decode( &data_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( data_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, data_len );
     err = fd_bincode_bytes_decode_preflight( data_len, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   }
   self->owner_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->executable_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_bool_decode_preflight( ctx );
@@ -2870,21 +3304,41 @@ int fd_vote_accounts_pair_decode( fd_vote_accounts_pair_t * self, fd_bincode_dec
   fd_vote_accounts_pair_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_vote_accounts_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_vote_accounts_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_solana_vote_account_decode_preflight( ctx );
+  err = fd_solana_vote_account_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_vote_accounts_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_vote_accounts_pair_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_vote_accounts_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_vote_accounts_pair_t);
+  int err = fd_vote_accounts_pair_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_vote_accounts_pair_decode_unsafe( fd_vote_accounts_pair_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->key, ctx );
   fd_bincode_uint64_decode_unsafe( &self->stake, ctx );
   fd_solana_vote_account_decode_unsafe( &self->value, ctx );
 }
+fd_vote_accounts_pair_t * fd_vote_accounts_pair_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_vote_accounts_pair_t * self = (fd_vote_accounts_pair_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_vote_accounts_pair_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_vote_accounts_pair_new( self );
+  fd_vote_accounts_pair_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_vote_accounts_pair_encode( fd_vote_accounts_pair_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->key, ctx );
@@ -3007,15 +3461,16 @@ int fd_vote_accounts_pair_encode_archival( fd_vote_accounts_pair_t const * self,
 }
 int fd_vote_accounts_pair_decode_offsets( fd_vote_accounts_pair_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->key_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->stake_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->value_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_solana_vote_account_decode_preflight( ctx );
+  err = fd_solana_vote_account_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -3058,21 +3513,41 @@ int fd_vote_accounts_pair_serializable_decode( fd_vote_accounts_pair_serializabl
   fd_vote_accounts_pair_serializable_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_vote_accounts_pair_serializable_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_vote_accounts_pair_serializable_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_solana_account_decode_preflight( ctx );
+  err = fd_solana_account_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_vote_accounts_pair_serializable_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_vote_accounts_pair_serializable_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_vote_accounts_pair_serializable_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_vote_accounts_pair_serializable_t);
+  int err = fd_vote_accounts_pair_serializable_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_vote_accounts_pair_serializable_decode_unsafe( fd_vote_accounts_pair_serializable_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->key, ctx );
   fd_bincode_uint64_decode_unsafe( &self->stake, ctx );
   fd_solana_account_decode_unsafe( &self->value, ctx );
 }
+fd_vote_accounts_pair_serializable_t * fd_vote_accounts_pair_serializable_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_vote_accounts_pair_serializable_t * self = (fd_vote_accounts_pair_serializable_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_vote_accounts_pair_serializable_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_vote_accounts_pair_serializable_new( self );
+  fd_vote_accounts_pair_serializable_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_vote_accounts_pair_serializable_encode( fd_vote_accounts_pair_serializable_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->key, ctx );
@@ -3085,15 +3560,16 @@ int fd_vote_accounts_pair_serializable_encode( fd_vote_accounts_pair_serializabl
 }
 int fd_vote_accounts_pair_serializable_decode_offsets( fd_vote_accounts_pair_serializable_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->key_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->stake_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->value_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_solana_account_decode_preflight( ctx );
+  err = fd_solana_account_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -3136,17 +3612,29 @@ int fd_vote_accounts_serializable_decode( fd_vote_accounts_serializable_t * self
   fd_vote_accounts_serializable_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_vote_accounts_serializable_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_vote_accounts_serializable_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   ulong vote_accounts_len;
   err = fd_bincode_uint64_decode( &vote_accounts_len, ctx );
   if( FD_UNLIKELY( err ) ) return err;
+  *total_sz = fd_bincode_footprint_alloc( *total_sz, fd_vote_accounts_pair_serializable_t_map_align(), fd_vote_accounts_pair_serializable_t_map_footprint( fd_ulong_max( vote_accounts_len, 15000 ) ) );
   for( ulong i=0; i < vote_accounts_len; i++ ) {
-    err = fd_vote_accounts_pair_serializable_decode_preflight( ctx );
+    err = fd_vote_accounts_pair_serializable_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_vote_accounts_serializable_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_vote_accounts_serializable_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_vote_accounts_serializable_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_vote_accounts_serializable_t);
+  int err = fd_vote_accounts_serializable_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_vote_accounts_serializable_decode_unsafe( fd_vote_accounts_serializable_t * self, fd_bincode_decode_ctx_t * ctx ) {
   ulong vote_accounts_len;
   fd_bincode_uint64_decode_unsafe( &vote_accounts_len, ctx );
@@ -3161,6 +3649,15 @@ void fd_vote_accounts_serializable_decode_unsafe( fd_vote_accounts_serializable_
     fd_vote_accounts_pair_serializable_t_map_insert( self->vote_accounts_pool, &self->vote_accounts_root, node );
   }
 }
+fd_vote_accounts_serializable_t * fd_vote_accounts_serializable_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_vote_accounts_serializable_t * self = (fd_vote_accounts_serializable_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_vote_accounts_serializable_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_vote_accounts_serializable_new( self );
+  fd_vote_accounts_serializable_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_vote_accounts_serializable_encode( fd_vote_accounts_serializable_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   if( self->vote_accounts_root ) {
@@ -3180,13 +3677,15 @@ int fd_vote_accounts_serializable_encode( fd_vote_accounts_serializable_t const
 }
 int fd_vote_accounts_serializable_decode_offsets( fd_vote_accounts_serializable_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->vote_accounts_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong vote_accounts_len;
   err = fd_bincode_uint64_decode( &vote_accounts_len, ctx );
   if( FD_UNLIKELY( err ) ) return err;
+  *total_sz = fd_bincode_footprint_alloc( *total_sz, fd_vote_accounts_pair_serializable_t_map_align(), fd_vote_accounts_pair_serializable_t_map_footprint( fd_ulong_max( vote_accounts_len, 15000 ) ) );
   for( ulong i=0; i < vote_accounts_len; i++ ) {
-    err = fd_vote_accounts_pair_serializable_decode_preflight( ctx );
+    err = fd_vote_accounts_pair_serializable_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
   }
   return FD_BINCODE_SUCCESS;
@@ -3239,17 +3738,29 @@ int fd_vote_accounts_decode( fd_vote_accounts_t * self, fd_bincode_decode_ctx_t
   fd_vote_accounts_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_vote_accounts_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_vote_accounts_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   ulong vote_accounts_len;
   err = fd_bincode_uint64_decode( &vote_accounts_len, ctx );
   if( FD_UNLIKELY( err ) ) return err;
+  *total_sz = fd_bincode_footprint_alloc( *total_sz, fd_vote_accounts_pair_t_map_align(), fd_vote_accounts_pair_t_map_footprint( fd_ulong_max( vote_accounts_len, 15000 ) ) );
   for( ulong i=0; i < vote_accounts_len; i++ ) {
-    err = fd_vote_accounts_pair_decode_preflight( ctx );
+    err = fd_vote_accounts_pair_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_vote_accounts_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_vote_accounts_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_vote_accounts_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_vote_accounts_t);
+  int err = fd_vote_accounts_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_vote_accounts_decode_unsafe( fd_vote_accounts_t * self, fd_bincode_decode_ctx_t * ctx ) {
   ulong vote_accounts_len;
   fd_bincode_uint64_decode_unsafe( &vote_accounts_len, ctx );
@@ -3264,6 +3775,15 @@ void fd_vote_accounts_decode_unsafe( fd_vote_accounts_t * self, fd_bincode_decod
     fd_vote_accounts_pair_t_map_insert( self->vote_accounts_pool, &self->vote_accounts_root, node );
   }
 }
+fd_vote_accounts_t * fd_vote_accounts_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_vote_accounts_t * self = (fd_vote_accounts_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_vote_accounts_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_vote_accounts_new( self );
+  fd_vote_accounts_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_vote_accounts_encode( fd_vote_accounts_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   if( self->vote_accounts_root ) {
@@ -3383,13 +3903,15 @@ int fd_vote_accounts_encode_archival( fd_vote_accounts_t const * self, fd_bincod
 }
 int fd_vote_accounts_decode_offsets( fd_vote_accounts_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->vote_accounts_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong vote_accounts_len;
   err = fd_bincode_uint64_decode( &vote_accounts_len, ctx );
   if( FD_UNLIKELY( err ) ) return err;
+  *total_sz = fd_bincode_footprint_alloc( *total_sz, fd_vote_accounts_pair_t_map_align(), fd_vote_accounts_pair_t_map_footprint( fd_ulong_max( vote_accounts_len, 15000 ) ) );
   for( ulong i=0; i < vote_accounts_len; i++ ) {
-    err = fd_vote_accounts_pair_decode_preflight( ctx );
+    err = fd_vote_accounts_pair_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
   }
   return FD_BINCODE_SUCCESS;
@@ -3442,13 +3964,33 @@ int fd_account_keys_pair_decode( fd_account_keys_pair_t * self, fd_bincode_decod
   fd_account_keys_pair_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_account_keys_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_account_keys_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 33, ctx );
 }
+int fd_account_keys_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_account_keys_pair_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_account_keys_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_account_keys_pair_t);
+  int err = fd_account_keys_pair_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_account_keys_pair_decode_unsafe( fd_account_keys_pair_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->key, ctx );
   fd_bincode_uint8_decode_unsafe( &self->exists, ctx );
 }
+fd_account_keys_pair_t * fd_account_keys_pair_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_account_keys_pair_t * self = (fd_account_keys_pair_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_account_keys_pair_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_account_keys_pair_new( self );
+  fd_account_keys_pair_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_account_keys_pair_encode( fd_account_keys_pair_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->key, ctx );
@@ -3546,9 +4088,10 @@ int fd_account_keys_pair_encode_archival( fd_account_keys_pair_t const * self, f
 }
 int fd_account_keys_pair_decode_offsets( fd_account_keys_pair_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->key_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->exists_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint8_decode_preflight( ctx );
@@ -3590,17 +4133,29 @@ int fd_account_keys_decode( fd_account_keys_t * self, fd_bincode_decode_ctx_t *
   fd_account_keys_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_account_keys_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_account_keys_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   ulong account_keys_len;
   err = fd_bincode_uint64_decode( &account_keys_len, ctx );
   if( FD_UNLIKELY( err ) ) return err;
+  *total_sz = fd_bincode_footprint_alloc( *total_sz, fd_account_keys_pair_t_map_align(), fd_account_keys_pair_t_map_footprint( fd_ulong_max( account_keys_len, 100000 ) ) );
   for( ulong i=0; i < account_keys_len; i++ ) {
-    err = fd_account_keys_pair_decode_preflight( ctx );
+    err = fd_account_keys_pair_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_account_keys_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_account_keys_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_account_keys_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_account_keys_t);
+  int err = fd_account_keys_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_account_keys_decode_unsafe( fd_account_keys_t * self, fd_bincode_decode_ctx_t * ctx ) {
   ulong account_keys_len;
   fd_bincode_uint64_decode_unsafe( &account_keys_len, ctx );
@@ -3615,6 +4170,15 @@ void fd_account_keys_decode_unsafe( fd_account_keys_t * self, fd_bincode_decode_
     fd_account_keys_pair_t_map_insert( self->account_keys_pool, &self->account_keys_root, node );
   }
 }
+fd_account_keys_t * fd_account_keys_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_account_keys_t * self = (fd_account_keys_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_account_keys_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_account_keys_new( self );
+  fd_account_keys_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_account_keys_encode( fd_account_keys_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   if( self->account_keys_root ) {
@@ -3734,13 +4298,15 @@ int fd_account_keys_encode_archival( fd_account_keys_t const * self, fd_bincode_
 }
 int fd_account_keys_decode_offsets( fd_account_keys_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->account_keys_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong account_keys_len;
   err = fd_bincode_uint64_decode( &account_keys_len, ctx );
   if( FD_UNLIKELY( err ) ) return err;
+  *total_sz = fd_bincode_footprint_alloc( *total_sz, fd_account_keys_pair_t_map_align(), fd_account_keys_pair_t_map_footprint( fd_ulong_max( account_keys_len, 100000 ) ) );
   for( ulong i=0; i < account_keys_len; i++ ) {
-    err = fd_account_keys_pair_decode_preflight( ctx );
+    err = fd_account_keys_pair_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
   }
   return FD_BINCODE_SUCCESS;
@@ -3793,13 +4359,33 @@ int fd_stake_weight_decode( fd_stake_weight_t * self, fd_bincode_decode_ctx_t *
   fd_stake_weight_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_stake_weight_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_stake_weight_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 40, ctx );
 }
+int fd_stake_weight_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_stake_weight_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_stake_weight_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_stake_weight_t);
+  int err = fd_stake_weight_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_stake_weight_decode_unsafe( fd_stake_weight_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->key, ctx );
   fd_bincode_uint64_decode_unsafe( &self->stake, ctx );
 }
+fd_stake_weight_t * fd_stake_weight_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_stake_weight_t * self = (fd_stake_weight_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_stake_weight_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_stake_weight_new( self );
+  fd_stake_weight_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_stake_weight_encode( fd_stake_weight_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->key, ctx );
@@ -3810,9 +4396,10 @@ int fd_stake_weight_encode( fd_stake_weight_t const * self, fd_bincode_encode_ct
 }
 int fd_stake_weight_decode_offsets( fd_stake_weight_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->key_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->stake_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -3829,6 +4416,7 @@ void fd_stake_weight_destroy( fd_stake_weight_t * self, fd_bincode_destroy_ctx_t
 
 ulong fd_stake_weight_footprint( void ){ return FD_STAKE_WEIGHT_FOOTPRINT; }
 ulong fd_stake_weight_align( void ){ return FD_STAKE_WEIGHT_ALIGN; }
+FD_STATIC_ASSERT( sizeof(fd_stake_weight_t)==40UL, fd_stake_weight_view );
 
 void fd_stake_weight_walk( void * w, fd_stake_weight_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_stake_weight", level++ );
@@ -3854,17 +4442,29 @@ int fd_stake_weights_decode( fd_stake_weights_t * self, fd_bincode_decode_ctx_t
   fd_stake_weights_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_stake_weights_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_stake_weights_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   ulong stake_weights_len;
   err = fd_bincode_uint64_decode( &stake_weights_len, ctx );
   if( FD_UNLIKELY( err ) ) return err;
+  *total_sz = fd_bincode_footprint_alloc( *total_sz, fd_stake_weight_t_map_align(), fd_stake_weight_t_map_footprint( fd_ulong_max( stake_weights_len, 1UL ) ) );
   for( ulong i=0; i < stake_weights_len; i++ ) {
-    err = fd_stake_weight_decode_preflight( ctx );
+    err = fd_stake_weight_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_stake_weights_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_stake_weights_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_stake_weights_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_stake_weights_t);
+  int err = fd_stake_weights_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_stake_weights_decode_unsafe( fd_stake_weights_t * self, fd_bincode_decode_ctx_t * ctx ) {
   ulong stake_weights_len;
   fd_bincode_uint64_decode_unsafe( &stake_weights_len, ctx );
@@ -3879,6 +4479,15 @@ void fd_stake_weights_decode_unsafe( fd_stake_weights_t * self, fd_bincode_decod
     fd_stake_weight_t_map_insert( self->stake_weights_pool, &self->stake_weights_root, node );
   }
 }
+fd_stake_weights_t * fd_stake_weights_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_stake_weights_t * self = (fd_stake_weights_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_stake_weights_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_stake_weights_new( self );
+  fd_stake_weights_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_stake_weights_encode( fd_stake_weights_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   if( self->stake_weights_root ) {
@@ -3898,13 +4507,15 @@ int fd_stake_weights_encode( fd_stake_weights_t const * self, fd_bincode_encode_
 }
 int fd_stake_weights_decode_offsets( fd_stake_weights_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->stake_weights_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong stake_weights_len;
   err = fd_bincode_uint64_decode( &stake_weights_len, ctx );
   if( FD_UNLIKELY( err ) ) return err;
+  *total_sz = fd_bincode_footprint_alloc( *total_sz, fd_stake_weight_t_map_align(), fd_stake_weight_t_map_footprint( fd_ulong_max( stake_weights_len, 1UL ) ) );
   for( ulong i=0; i < stake_weights_len; i++ ) {
-    err = fd_stake_weight_decode_preflight( ctx );
+    err = fd_stake_weight_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
   }
   return FD_BINCODE_SUCCESS;
@@ -3957,9 +4568,20 @@ int fd_delegation_decode( fd_delegation_t * self, fd_bincode_decode_ctx_t * ctx
   fd_delegation_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_delegation_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_delegation_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 64, ctx );
 }
+int fd_delegation_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_delegation_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_delegation_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_delegation_t);
+  int err = fd_delegation_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_delegation_decode_unsafe( fd_delegation_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->voter_pubkey, ctx );
   fd_bincode_uint64_decode_unsafe( &self->stake, ctx );
@@ -3967,6 +4589,15 @@ void fd_delegation_decode_unsafe( fd_delegation_t * self, fd_bincode_decode_ctx_
   fd_bincode_uint64_decode_unsafe( &self->deactivation_epoch, ctx );
   fd_bincode_double_decode_unsafe( &self->warmup_cooldown_rate, ctx );
 }
+fd_delegation_t * fd_delegation_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_delegation_t * self = (fd_delegation_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_delegation_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_delegation_new( self );
+  fd_delegation_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_delegation_encode( fd_delegation_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->voter_pubkey, ctx );
@@ -4112,9 +4743,10 @@ int fd_delegation_encode_archival( fd_delegation_t const * self, fd_bincode_enco
 }
 int fd_delegation_decode_offsets( fd_delegation_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->voter_pubkey_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->stake_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -4140,6 +4772,7 @@ void fd_delegation_destroy( fd_delegation_t * self, fd_bincode_destroy_ctx_t * c
 
 ulong fd_delegation_footprint( void ){ return FD_DELEGATION_FOOTPRINT; }
 ulong fd_delegation_align( void ){ return FD_DELEGATION_ALIGN; }
+FD_STATIC_ASSERT( sizeof(fd_delegation_t)==64UL, fd_delegation_view );
 
 void fd_delegation_walk( void * w, fd_delegation_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_delegation", level++ );
@@ -4171,13 +4804,33 @@ int fd_delegation_pair_decode( fd_delegation_pair_t * self, fd_bincode_decode_ct
   fd_delegation_pair_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_delegation_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_delegation_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 96, ctx );
 }
+int fd_delegation_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_delegation_pair_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_delegation_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_delegation_pair_t);
+  int err = fd_delegation_pair_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_delegation_pair_decode_unsafe( fd_delegation_pair_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->account, ctx );
   fd_delegation_decode_unsafe( &self->delegation, ctx );
 }
+fd_delegation_pair_t * fd_delegation_pair_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_delegation_pair_t * self = (fd_delegation_pair_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_delegation_pair_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_delegation_pair_new( self );
+  fd_delegation_pair_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_delegation_pair_encode( fd_delegation_pair_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->account, ctx );
@@ -4284,12 +4937,13 @@ int fd_delegation_pair_encode_archival( fd_delegation_pair_t const * self, fd_bi
 }
 int fd_delegation_pair_decode_offsets( fd_delegation_pair_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->account_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->delegation_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_delegation_decode_preflight( ctx );
+  err = fd_delegation_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -4305,6 +4959,7 @@ void fd_delegation_pair_destroy( fd_delegation_pair_t * self, fd_bincode_destroy
 
 ulong fd_delegation_pair_footprint( void ){ return FD_DELEGATION_PAIR_FOOTPRINT; }
 ulong fd_delegation_pair_align( void ){ return FD_DELEGATION_PAIR_ALIGN; }
+FD_STATIC_ASSERT( sizeof(fd_delegation_pair_t)==96UL, fd_delegation_pair_view );
 
 void fd_delegation_pair_walk( void * w, fd_delegation_pair_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_delegation_pair", level++ );
@@ -4330,13 +4985,33 @@ int fd_stake_decode( fd_stake_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_stake_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_stake_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_stake_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 72, ctx );
 }
+int fd_stake_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_stake_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_stake_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_stake_t);
+  int err = fd_stake_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_stake_decode_unsafe( fd_stake_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_delegation_decode_unsafe( &self->delegation, ctx );
   fd_bincode_uint64_decode_unsafe( &self->credits_observed, ctx );
 }
+fd_stake_t * fd_stake_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_stake_t * self = (fd_stake_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_stake_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_stake_new( self );
+  fd_stake_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_stake_encode( fd_stake_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_delegation_encode( &self->delegation, ctx );
@@ -4347,9 +5022,10 @@ int fd_stake_encode( fd_stake_t const * self, fd_bincode_encode_ctx_t * ctx ) {
 }
 int fd_stake_decode_offsets( fd_stake_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->delegation_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_delegation_decode_preflight( ctx );
+  err = fd_delegation_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->credits_observed_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -4366,6 +5042,7 @@ void fd_stake_destroy( fd_stake_t * self, fd_bincode_destroy_ctx_t * ctx ) {
 
 ulong fd_stake_footprint( void ){ return FD_STAKE_FOOTPRINT; }
 ulong fd_stake_align( void ){ return FD_STAKE_ALIGN; }
+FD_STATIC_ASSERT( sizeof(fd_stake_t)==72UL, fd_stake_view );
 
 void fd_stake_walk( void * w, fd_stake_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_stake", level++ );
@@ -4391,13 +5068,33 @@ int fd_stake_pair_decode( fd_stake_pair_t * self, fd_bincode_decode_ctx_t * ctx
   fd_stake_pair_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_stake_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_stake_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 104, ctx );
 }
+int fd_stake_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_stake_pair_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_stake_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_stake_pair_t);
+  int err = fd_stake_pair_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_stake_pair_decode_unsafe( fd_stake_pair_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->account, ctx );
   fd_stake_decode_unsafe( &self->stake, ctx );
 }
+fd_stake_pair_t * fd_stake_pair_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_stake_pair_t * self = (fd_stake_pair_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_stake_pair_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_stake_pair_new( self );
+  fd_stake_pair_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_stake_pair_encode( fd_stake_pair_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->account, ctx );
@@ -4408,12 +5105,13 @@ int fd_stake_pair_encode( fd_stake_pair_t const * self, fd_bincode_encode_ctx_t
 }
 int fd_stake_pair_decode_offsets( fd_stake_pair_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->account_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->stake_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_stake_decode_preflight( ctx );
+  err = fd_stake_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -4429,6 +5127,7 @@ void fd_stake_pair_destroy( fd_stake_pair_t * self, fd_bincode_destroy_ctx_t * c
 
 ulong fd_stake_pair_footprint( void ){ return FD_STAKE_PAIR_FOOTPRINT; }
 ulong fd_stake_pair_align( void ){ return FD_STAKE_PAIR_ALIGN; }
+FD_STATIC_ASSERT( sizeof(fd_stake_pair_t)==104UL, fd_stake_pair_view );
 
 void fd_stake_pair_walk( void * w, fd_stake_pair_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_stake_pair", level++ );
@@ -4454,25 +5153,37 @@ int fd_stakes_decode( fd_stakes_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_stakes_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_stakes_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_stakes_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_vote_accounts_decode_preflight( ctx );
+  err = fd_vote_accounts_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   ulong stake_delegations_len;
   err = fd_bincode_uint64_decode( &stake_delegations_len, ctx );
   if( FD_UNLIKELY( err ) ) return err;
+  *total_sz = fd_bincode_footprint_alloc( *total_sz, fd_delegation_pair_t_map_align(), fd_delegation_pair_t_map_footprint( fd_ulong_max( stake_delegations_len, 1UL ) ) );
   for( ulong i=0; i < stake_delegations_len; i++ ) {
-    err = fd_delegation_pair_decode_preflight( ctx );
+    err = fd_delegation_pair_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
   }
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_stake_history_decode_preflight( ctx );
+  err = fd_stake_history_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_stakes_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_stakes_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_stakes_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_stakes_t);
+  int err = fd_stakes_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_stakes_decode_unsafe( fd_stakes_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_vote_accounts_decode_unsafe( &self->vote_accounts, ctx );
   ulong stake_delegations_len;
@@ -4491,6 +5202,15 @@ void fd_stakes_decode_unsafe( fd_stakes_t * self, fd_bincode_decode_ctx_t * ctx
   fd_bincode_uint64_decode_unsafe( &self->epoch, ctx );
   fd_stake_history_decode_unsafe( &self->stake_history, ctx );
 }
+fd_stakes_t * fd_stakes_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_stakes_t * self = (fd_stakes_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_stakes_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_stakes_new( self );
+  fd_stakes_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_stakes_encode( fd_stakes_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_vote_accounts_encode( &self->vote_accounts, ctx );
@@ -4692,16 +5412,18 @@ int fd_stakes_encode_archival( fd_stakes_t const * self, fd_bincode_encode_ctx_t
 }
 int fd_stakes_decode_offsets( fd_stakes_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->vote_accounts_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_vote_accounts_decode_preflight( ctx );
+  err = fd_vote_accounts_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->stake_delegations_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong stake_delegations_len;
   err = fd_bincode_uint64_decode( &stake_delegations_len, ctx );
   if( FD_UNLIKELY( err ) ) return err;
+  *total_sz = fd_bincode_footprint_alloc( *total_sz, fd_delegation_pair_t_map_align(), fd_delegation_pair_t_map_footprint( fd_ulong_max( stake_delegations_len, 1UL ) ) );
   for( ulong i=0; i < stake_delegations_len; i++ ) {
-    err = fd_delegation_pair_decode_preflight( ctx );
+    err = fd_delegation_pair_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
   }
   self->unused_off = (uint)( (ulong)ctx->data - (ulong)data );
@@ -4711,7 +5433,7 @@ int fd_stakes_decode_offsets( fd_stakes_off_t * self, fd_bincode_decode_ctx_t *
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->stake_history_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_stake_history_decode_preflight( ctx );
+  err = fd_stake_history_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -4775,25 +5497,37 @@ int fd_stakes_serializable_decode( fd_stakes_serializable_t * self, fd_bincode_d
   fd_stakes_serializable_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_stakes_serializable_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_stakes_serializable_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_vote_accounts_serializable_decode_preflight( ctx );
+  err = fd_vote_accounts_serializable_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   ulong stake_delegations_len;
   err = fd_bincode_uint64_decode( &stake_delegations_len, ctx );
   if( FD_UNLIKELY( err ) ) return err;
+  *total_sz = fd_bincode_footprint_alloc( *total_sz, fd_delegation_pair_t_map_align(), fd_delegation_pair_t_map_footprint( fd_ulong_max( stake_delegations_len, 1UL ) ) );
   for( ulong i=0; i < stake_delegations_len; i++ ) {
-    err = fd_delegation_pair_decode_preflight( ctx );
+    err = fd_delegation_pair_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
   }
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_stake_history_decode_preflight( ctx );
+  err = fd_stake_history_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_stakes_serializable_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_stakes_serializable_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_stakes_serializable_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_stakes_serializable_t);
+  int err = fd_stakes_serializable_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_stakes_serializable_decode_unsafe( fd_stakes_serializable_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_vote_accounts_serializable_decode_unsafe( &self->vote_accounts, ctx );
   ulong stake_delegations_len;
@@ -4812,6 +5546,15 @@ void fd_stakes_serializable_decode_unsafe( fd_stakes_serializable_t * self, fd_b
   fd_bincode_uint64_decode_unsafe( &self->epoch, ctx );
   fd_stake_history_decode_unsafe( &self->stake_history, ctx );
 }
+fd_stakes_serializable_t * fd_stakes_serializable_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_stakes_serializable_t * self = (fd_stakes_serializable_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_stakes_serializable_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_stakes_serializable_new( self );
+  fd_stakes_serializable_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_stakes_serializable_encode( fd_stakes_serializable_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_vote_accounts_serializable_encode( &self->vote_accounts, ctx );
@@ -4839,16 +5582,18 @@ int fd_stakes_serializable_encode( fd_stakes_serializable_t const * self, fd_bin
 }
 int fd_stakes_serializable_decode_offsets( fd_stakes_serializable_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->vote_accounts_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_vote_accounts_serializable_decode_preflight( ctx );
+  err = fd_vote_accounts_serializable_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->stake_delegations_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong stake_delegations_len;
   err = fd_bincode_uint64_decode( &stake_delegations_len, ctx );
   if( FD_UNLIKELY( err ) ) return err;
+  *total_sz = fd_bincode_footprint_alloc( *total_sz, fd_delegation_pair_t_map_align(), fd_delegation_pair_t_map_footprint( fd_ulong_max( stake_delegations_len, 1UL ) ) );
   for( ulong i=0; i < stake_delegations_len; i++ ) {
-    err = fd_delegation_pair_decode_preflight( ctx );
+    err = fd_delegation_pair_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
   }
   self->unused_off = (uint)( (ulong)ctx->data - (ulong)data );
@@ -4858,7 +5603,7 @@ int fd_stakes_serializable_decode_offsets( fd_stakes_serializable_off_t * self,
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->stake_history_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_stake_history_decode_preflight( ctx );
+  err = fd_stake_history_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -4922,25 +5667,37 @@ int fd_stakes_stake_decode( fd_stakes_stake_t * self, fd_bincode_decode_ctx_t *
   fd_stakes_stake_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_stakes_stake_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_stakes_stake_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_vote_accounts_decode_preflight( ctx );
+  err = fd_vote_accounts_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   ulong stake_delegations_len;
   err = fd_bincode_uint64_decode( &stake_delegations_len, ctx );
   if( FD_UNLIKELY( err ) ) return err;
+  *total_sz = fd_bincode_footprint_alloc( *total_sz, fd_stake_pair_t_map_align(), fd_stake_pair_t_map_footprint( fd_ulong_max( stake_delegations_len, 1UL ) ) );
   for( ulong i=0; i < stake_delegations_len; i++ ) {
-    err = fd_stake_pair_decode_preflight( ctx );
+    err = fd_stake_pair_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
   }
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_stake_history_decode_preflight( ctx );
+  err = fd_stake_history_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_stakes_stake_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_stakes_stake_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_stakes_stake_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_stakes_stake_t);
+  int err = fd_stakes_stake_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_stakes_stake_decode_unsafe( fd_stakes_stake_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_vote_accounts_decode_unsafe( &self->vote_accounts, ctx );
   ulong stake_delegations_len;
@@ -4959,6 +5716,15 @@ void fd_stakes_stake_decode_unsafe( fd_stakes_stake_t * self, fd_bincode_decode_
   fd_bincode_uint64_decode_unsafe( &self->epoch, ctx );
   fd_stake_history_decode_unsafe( &self->stake_history, ctx );
 }
+fd_stakes_stake_t * fd_stakes_stake_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_stakes_stake_t * self = (fd_stakes_stake_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_stakes_stake_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_stakes_stake_new( self );
+  fd_stakes_stake_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_stakes_stake_encode( fd_stakes_stake_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_vote_accounts_encode( &self->vote_accounts, ctx );
@@ -4986,16 +5752,18 @@ int fd_stakes_stake_encode( fd_stakes_stake_t const * self, fd_bincode_encode_ct
 }
 int fd_stakes_stake_decode_offsets( fd_stakes_stake_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->vote_accounts_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_vote_accounts_decode_preflight( ctx );
+  err = fd_vote_accounts_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->stake_delegations_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong stake_delegations_len;
   err = fd_bincode_uint64_decode( &stake_delegations_len, ctx );
   if( FD_UNLIKELY( err ) ) return err;
+  *total_sz = fd_bincode_footprint_alloc( *total_sz, fd_stake_pair_t_map_align(), fd_stake_pair_t_map_footprint( fd_ulong_max( stake_delegations_len, 1UL ) ) );
   for( ulong i=0; i < stake_delegations_len; i++ ) {
-    err = fd_stake_pair_decode_preflight( ctx );
+    err = fd_stake_pair_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
   }
   self->unused_off = (uint)( (ulong)ctx->data - (ulong)data );
@@ -5005,7 +5773,7 @@ int fd_stakes_stake_decode_offsets( fd_stakes_stake_off_t * self, fd_bincode_dec
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->stake_history_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_stake_history_decode_preflight( ctx );
+  err = fd_stake_history_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -5069,9 +5837,20 @@ int fd_bank_incremental_snapshot_persistence_decode( fd_bank_incremental_snapsho
   fd_bank_incremental_snapshot_persistence_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_bank_incremental_snapshot_persistence_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_bank_incremental_snapshot_persistence_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 88, ctx );
 }
+int fd_bank_incremental_snapshot_persistence_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_bank_incremental_snapshot_persistence_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_bank_incremental_snapshot_persistence_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_bank_incremental_snapshot_persistence_t);
+  int err = fd_bank_incremental_snapshot_persistence_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_bank_incremental_snapshot_persistence_decode_unsafe( fd_bank_incremental_snapshot_persistence_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->full_slot, ctx );
   fd_hash_decode_unsafe( &self->full_hash, ctx );
@@ -5079,6 +5858,15 @@ void fd_bank_incremental_snapshot_persistence_decode_unsafe( fd_bank_incremental
   fd_hash_decode_unsafe( &self->incremental_hash, ctx );
   fd_bincode_uint64_decode_unsafe( &self->incremental_capitalization, ctx );
 }
+fd_bank_incremental_snapshot_persistence_t * fd_bank_incremental_snapshot_persistence_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_bank_incremental_snapshot_persistence_t * self = (fd_bank_incremental_snapshot_persistence_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_bank_incremental_snapshot_persistence_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_bank_incremental_snapshot_persistence_new( self );
+  fd_bank_incremental_snapshot_persistence_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_bank_incremental_snapshot_persistence_encode( fd_bank_incremental_snapshot_persistence_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->full_slot, ctx );
@@ -5095,18 +5883,19 @@ int fd_bank_incremental_snapshot_persistence_encode( fd_bank_incremental_snapsho
 }
 int fd_bank_incremental_snapshot_persistence_decode_offsets( fd_bank_incremental_snapshot_persistence_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->full_slot_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->full_hash_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->full_capitalization_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->incremental_hash_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->incremental_capitalization_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -5125,6 +5914,7 @@ void fd_bank_incremental_snapshot_persistence_destroy( fd_bank_incremental_snaps
 
 ulong fd_bank_incremental_snapshot_persistence_footprint( void ){ return FD_BANK_INCREMENTAL_SNAPSHOT_PERSISTENCE_FOOTPRINT; }
 ulong fd_bank_incremental_snapshot_persistence_align( void ){ return FD_BANK_INCREMENTAL_SNAPSHOT_PERSISTENCE_ALIGN; }
+FD_STATIC_ASSERT( sizeof(fd_bank_incremental_snapshot_persistence_t)==88UL, fd_bank_incremental_snapshot_persistence_view );
 
 void fd_bank_incremental_snapshot_persistence_walk( void * w, fd_bank_incremental_snapshot_persistence_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_bank_incremental_snapshot_persistence", level++ );
@@ -5156,14 +5946,15 @@ int fd_node_vote_accounts_decode( fd_node_vote_accounts_t * self, fd_bincode_dec
   fd_node_vote_accounts_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_node_vote_accounts_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_node_vote_accounts_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   ulong vote_accounts_len;
   err = fd_bincode_uint64_decode( &vote_accounts_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( vote_accounts_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_PUBKEY_ALIGN, FD_PUBKEY_FOOTPRINT*vote_accounts_len );
     for( ulong i=0; i < vote_accounts_len; i++ ) {
-      err = fd_pubkey_decode_preflight( ctx );
+      err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -5171,6 +5962,17 @@ int fd_node_vote_accounts_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_node_vote_accounts_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_node_vote_accounts_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_node_vote_accounts_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_node_vote_accounts_t);
+  int err = fd_node_vote_accounts_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_node_vote_accounts_decode_unsafe( fd_node_vote_accounts_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->vote_accounts_len, ctx );
   if( self->vote_accounts_len ) {
@@ -5183,6 +5985,15 @@ void fd_node_vote_accounts_decode_unsafe( fd_node_vote_accounts_t * self, fd_bin
     self->vote_accounts = NULL;
   fd_bincode_uint64_decode_unsafe( &self->total_stake, ctx );
 }
+fd_node_vote_accounts_t * fd_node_vote_accounts_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_node_vote_accounts_t * self = (fd_node_vote_accounts_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_node_vote_accounts_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_node_vote_accounts_new( self );
+  fd_node_vote_accounts_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_node_vote_accounts_encode( fd_node_vote_accounts_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->vote_accounts_len, ctx );
@@ -5199,14 +6010,16 @@ int fd_node_vote_accounts_encode( fd_node_vote_accounts_t const * self, fd_binco
 }
 int fd_node_vote_accounts_decode_offsets( fd_node_vote_accounts_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->vote_accounts_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong vote_accounts_len;
   err = fd_bincode_uint64_decode( &vote_accounts_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( vote_accounts_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_PUBKEY_ALIGN, FD_PUBKEY_FOOTPRINT*vote_accounts_len );
     for( ulong i=0; i < vote_accounts_len; i++ ) {
-      err = fd_pubkey_decode_preflight( ctx );
+      err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -5263,18 +6076,38 @@ int fd_pubkey_node_vote_accounts_pair_decode( fd_pubkey_node_vote_accounts_pair_
   fd_pubkey_node_vote_accounts_pair_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_pubkey_node_vote_accounts_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_pubkey_node_vote_accounts_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_node_vote_accounts_decode_preflight( ctx );
+  err = fd_node_vote_accounts_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_pubkey_node_vote_accounts_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_pubkey_node_vote_accounts_pair_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_pubkey_node_vote_accounts_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_pubkey_node_vote_accounts_pair_t);
+  int err = fd_pubkey_node_vote_accounts_pair_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_pubkey_node_vote_accounts_pair_decode_unsafe( fd_pubkey_node_vote_accounts_pair_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->key, ctx );
   fd_node_vote_accounts_decode_unsafe( &self->value, ctx );
 }
+fd_pubkey_node_vote_accounts_pair_t * fd_pubkey_node_vote_accounts_pair_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_pubkey_node_vote_accounts_pair_t * self = (fd_pubkey_node_vote_accounts_pair_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_pubkey_node_vote_accounts_pair_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_pubkey_node_vote_accounts_pair_new( self );
+  fd_pubkey_node_vote_accounts_pair_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_pubkey_node_vote_accounts_pair_encode( fd_pubkey_node_vote_accounts_pair_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->key, ctx );
@@ -5285,12 +6118,13 @@ int fd_pubkey_node_vote_accounts_pair_encode( fd_pubkey_node_vote_accounts_pair_
 }
 int fd_pubkey_node_vote_accounts_pair_decode_offsets( fd_pubkey_node_vote_accounts_pair_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->key_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->value_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_node_vote_accounts_decode_preflight( ctx );
+  err = fd_node_vote_accounts_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -5331,13 +6165,33 @@ int fd_pubkey_pubkey_pair_decode( fd_pubkey_pubkey_pair_t * self, fd_bincode_dec
   fd_pubkey_pubkey_pair_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_pubkey_pubkey_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_pubkey_pubkey_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 64, ctx );
 }
+int fd_pubkey_pubkey_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_pubkey_pubkey_pair_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_pubkey_pubkey_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_pubkey_pubkey_pair_t);
+  int err = fd_pubkey_pubkey_pair_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_pubkey_pubkey_pair_decode_unsafe( fd_pubkey_pubkey_pair_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->key, ctx );
   fd_pubkey_decode_unsafe( &self->value, ctx );
 }
+fd_pubkey_pubkey_pair_t * fd_pubkey_pubkey_pair_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_pubkey_pubkey_pair_t * self = (fd_pubkey_pubkey_pair_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_pubkey_pubkey_pair_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_pubkey_pubkey_pair_new( self );
+  fd_pubkey_pubkey_pair_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_pubkey_pubkey_pair_encode( fd_pubkey_pubkey_pair_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->key, ctx );
@@ -5348,12 +6202,13 @@ int fd_pubkey_pubkey_pair_encode( fd_pubkey_pubkey_pair_t const * self, fd_binco
 }
 int fd_pubkey_pubkey_pair_decode_offsets( fd_pubkey_pubkey_pair_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->key_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->value_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -5369,6 +6224,7 @@ void fd_pubkey_pubkey_pair_destroy( fd_pubkey_pubkey_pair_t * self, fd_bincode_d
 
 ulong fd_pubkey_pubkey_pair_footprint( void ){ return FD_PUBKEY_PUBKEY_PAIR_FOOTPRINT; }
 ulong fd_pubkey_pubkey_pair_align( void ){ return FD_PUBKEY_PUBKEY_PAIR_ALIGN; }
+FD_STATIC_ASSERT( sizeof(fd_pubkey_pubkey_pair_t)==64UL, fd_pubkey_pubkey_pair_view );
 
 void fd_pubkey_pubkey_pair_walk( void * w, fd_pubkey_pubkey_pair_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_pubkey_pubkey_pair", level++ );
@@ -5394,9 +6250,9 @@ int fd_epoch_stakes_decode( fd_epoch_stakes_t * self, fd_bincode_decode_ctx_t *
   fd_epoch_stakes_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_epoch_stakes_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_epoch_stakes_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_stakes_decode_preflight( ctx );
+  err = fd_stakes_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -5404,8 +6260,9 @@ int fd_epoch_stakes_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   err = fd_bincode_uint64_decode( &node_id_to_vote_accounts_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( node_id_to_vote_accounts_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_PUBKEY_NODE_VOTE_ACCOUNTS_PAIR_ALIGN, FD_PUBKEY_NODE_VOTE_ACCOUNTS_PAIR_FOOTPRINT*node_id_to_vote_accounts_len );
     for( ulong i=0; i < node_id_to_vote_accounts_len; i++ ) {
-      err = fd_pubkey_node_vote_accounts_pair_decode_preflight( ctx );
+      err = fd_pubkey_node_vote_accounts_pair_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -5413,13 +6270,25 @@ int fd_epoch_stakes_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   err = fd_bincode_uint64_decode( &epoch_authorized_voters_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( epoch_authorized_voters_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_PUBKEY_PUBKEY_PAIR_ALIGN, FD_PUBKEY_PUBKEY_PAIR_FOOTPRINT*epoch_authorized_voters_len );
     for( ulong i=0; i < epoch_authorized_voters_len; i++ ) {
-      err = fd_pubkey_pubkey_pair_decode_preflight( ctx );
+      err = fd_pubkey_pubkey_pair_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_epoch_stakes_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_epoch_stakes_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_epoch_stakes_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_epoch_stakes_t);
+  int err = fd_epoch_stakes_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_epoch_stakes_decode_unsafe( fd_epoch_stakes_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_stakes_decode_unsafe( &self->stakes, ctx );
   fd_bincode_uint64_decode_unsafe( &self->total_stake, ctx );
@@ -5442,6 +6311,15 @@ void fd_epoch_stakes_decode_unsafe( fd_epoch_stakes_t * self, fd_bincode_decode_
   } else
     self->epoch_authorized_voters = NULL;
 }
+fd_epoch_stakes_t * fd_epoch_stakes_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_epoch_stakes_t * self = (fd_epoch_stakes_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_epoch_stakes_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_epoch_stakes_new( self );
+  fd_epoch_stakes_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_epoch_stakes_encode( fd_epoch_stakes_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_stakes_encode( &self->stakes, ctx );
@@ -5468,9 +6346,10 @@ int fd_epoch_stakes_encode( fd_epoch_stakes_t const * self, fd_bincode_encode_ct
 }
 int fd_epoch_stakes_decode_offsets( fd_epoch_stakes_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->stakes_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_stakes_decode_preflight( ctx );
+  err = fd_stakes_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->total_stake_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -5480,8 +6359,9 @@ int fd_epoch_stakes_decode_offsets( fd_epoch_stakes_off_t * self, fd_bincode_dec
   err = fd_bincode_uint64_decode( &node_id_to_vote_accounts_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( node_id_to_vote_accounts_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_PUBKEY_NODE_VOTE_ACCOUNTS_PAIR_ALIGN, FD_PUBKEY_NODE_VOTE_ACCOUNTS_PAIR_FOOTPRINT*node_id_to_vote_accounts_len );
     for( ulong i=0; i < node_id_to_vote_accounts_len; i++ ) {
-      err = fd_pubkey_node_vote_accounts_pair_decode_preflight( ctx );
+      err = fd_pubkey_node_vote_accounts_pair_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -5490,8 +6370,9 @@ int fd_epoch_stakes_decode_offsets( fd_epoch_stakes_off_t * self, fd_bincode_dec
   err = fd_bincode_uint64_decode( &epoch_authorized_voters_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( epoch_authorized_voters_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_PUBKEY_PUBKEY_PAIR_ALIGN, FD_PUBKEY_PUBKEY_PAIR_FOOTPRINT*epoch_authorized_voters_len );
     for( ulong i=0; i < epoch_authorized_voters_len; i++ ) {
-      err = fd_pubkey_pubkey_pair_decode_preflight( ctx );
+      err = fd_pubkey_pubkey_pair_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -5566,18 +6447,38 @@ int fd_epoch_epoch_stakes_pair_decode( fd_epoch_epoch_stakes_pair_t * self, fd_b
   fd_epoch_epoch_stakes_pair_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_epoch_epoch_stakes_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_epoch_epoch_stakes_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_epoch_stakes_decode_preflight( ctx );
+  err = fd_epoch_stakes_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_epoch_epoch_stakes_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_epoch_epoch_stakes_pair_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_epoch_epoch_stakes_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_epoch_epoch_stakes_pair_t);
+  int err = fd_epoch_epoch_stakes_pair_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_epoch_epoch_stakes_pair_decode_unsafe( fd_epoch_epoch_stakes_pair_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->key, ctx );
   fd_epoch_stakes_decode_unsafe( &self->value, ctx );
 }
+fd_epoch_epoch_stakes_pair_t * fd_epoch_epoch_stakes_pair_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_epoch_epoch_stakes_pair_t * self = (fd_epoch_epoch_stakes_pair_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_epoch_epoch_stakes_pair_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_epoch_epoch_stakes_pair_new( self );
+  fd_epoch_epoch_stakes_pair_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_epoch_epoch_stakes_pair_encode( fd_epoch_epoch_stakes_pair_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->key, ctx );
@@ -5588,12 +6489,13 @@ int fd_epoch_epoch_stakes_pair_encode( fd_epoch_epoch_stakes_pair_t const * self
 }
 int fd_epoch_epoch_stakes_pair_decode_offsets( fd_epoch_epoch_stakes_pair_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->key_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->value_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_epoch_stakes_decode_preflight( ctx );
+  err = fd_epoch_stakes_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -5632,13 +6534,33 @@ int fd_pubkey_u64_pair_decode( fd_pubkey_u64_pair_t * self, fd_bincode_decode_ct
   fd_pubkey_u64_pair_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_pubkey_u64_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_pubkey_u64_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 40, ctx );
 }
+int fd_pubkey_u64_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_pubkey_u64_pair_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_pubkey_u64_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_pubkey_u64_pair_t);
+  int err = fd_pubkey_u64_pair_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_pubkey_u64_pair_decode_unsafe( fd_pubkey_u64_pair_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->_0, ctx );
   fd_bincode_uint64_decode_unsafe( &self->_1, ctx );
 }
+fd_pubkey_u64_pair_t * fd_pubkey_u64_pair_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_pubkey_u64_pair_t * self = (fd_pubkey_u64_pair_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_pubkey_u64_pair_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_pubkey_u64_pair_new( self );
+  fd_pubkey_u64_pair_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_pubkey_u64_pair_encode( fd_pubkey_u64_pair_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->_0, ctx );
@@ -5649,9 +6571,10 @@ int fd_pubkey_u64_pair_encode( fd_pubkey_u64_pair_t const * self, fd_bincode_enc
 }
 int fd_pubkey_u64_pair_decode_offsets( fd_pubkey_u64_pair_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->_0_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->_1_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -5668,6 +6591,7 @@ void fd_pubkey_u64_pair_destroy( fd_pubkey_u64_pair_t * self, fd_bincode_destroy
 
 ulong fd_pubkey_u64_pair_footprint( void ){ return FD_PUBKEY_U64_PAIR_FOOTPRINT; }
 ulong fd_pubkey_u64_pair_align( void ){ return FD_PUBKEY_U64_PAIR_ALIGN; }
+FD_STATIC_ASSERT( sizeof(fd_pubkey_u64_pair_t)==40UL, fd_pubkey_u64_pair_view );
 
 void fd_pubkey_u64_pair_walk( void * w, fd_pubkey_u64_pair_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_pubkey_u64_pair", level++ );
@@ -5693,14 +6617,15 @@ int fd_unused_accounts_decode( fd_unused_accounts_t * self, fd_bincode_decode_ct
   fd_unused_accounts_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_unused_accounts_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_unused_accounts_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   ulong unused1_len;
   err = fd_bincode_uint64_decode( &unused1_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( unused1_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_PUBKEY_ALIGN, FD_PUBKEY_FOOTPRINT*unused1_len );
     for( ulong i=0; i < unused1_len; i++ ) {
-      err = fd_pubkey_decode_preflight( ctx );
+      err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -5708,8 +6633,9 @@ int fd_unused_accounts_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   err = fd_bincode_uint64_decode( &unused2_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( unused2_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_PUBKEY_ALIGN, FD_PUBKEY_FOOTPRINT*unused2_len );
     for( ulong i=0; i < unused2_len; i++ ) {
-      err = fd_pubkey_decode_preflight( ctx );
+      err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -5717,13 +6643,25 @@ int fd_unused_accounts_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   err = fd_bincode_uint64_decode( &unused3_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( unused3_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_PUBKEY_U64_PAIR_ALIGN, FD_PUBKEY_U64_PAIR_FOOTPRINT*unused3_len );
     for( ulong i=0; i < unused3_len; i++ ) {
-      err = fd_pubkey_u64_pair_decode_preflight( ctx );
+      err = fd_pubkey_u64_pair_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_unused_accounts_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_unused_accounts_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_unused_accounts_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_unused_accounts_t);
+  int err = fd_unused_accounts_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_unused_accounts_decode_unsafe( fd_unused_accounts_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->unused1_len, ctx );
   if( self->unused1_len ) {
@@ -5753,6 +6691,15 @@ void fd_unused_accounts_decode_unsafe( fd_unused_accounts_t * self, fd_bincode_d
   } else
     self->unused3 = NULL;
 }
+fd_unused_accounts_t * fd_unused_accounts_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_unused_accounts_t * self = (fd_unused_accounts_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_unused_accounts_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_unused_accounts_new( self );
+  fd_unused_accounts_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_unused_accounts_encode( fd_unused_accounts_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->unused1_len, ctx );
@@ -5783,14 +6730,16 @@ int fd_unused_accounts_encode( fd_unused_accounts_t const * self, fd_bincode_enc
 }
 int fd_unused_accounts_decode_offsets( fd_unused_accounts_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->unused1_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong unused1_len;
   err = fd_bincode_uint64_decode( &unused1_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( unused1_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_PUBKEY_ALIGN, FD_PUBKEY_FOOTPRINT*unused1_len );
     for( ulong i=0; i < unused1_len; i++ ) {
-      err = fd_pubkey_decode_preflight( ctx );
+      err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -5799,8 +6748,9 @@ int fd_unused_accounts_decode_offsets( fd_unused_accounts_off_t * self, fd_binco
   err = fd_bincode_uint64_decode( &unused2_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( unused2_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_PUBKEY_ALIGN, FD_PUBKEY_FOOTPRINT*unused2_len );
     for( ulong i=0; i < unused2_len; i++ ) {
-      err = fd_pubkey_decode_preflight( ctx );
+      err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -5809,8 +6759,9 @@ int fd_unused_accounts_decode_offsets( fd_unused_accounts_off_t * self, fd_binco
   err = fd_bincode_uint64_decode( &unused3_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( unused3_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_PUBKEY_U64_PAIR_ALIGN, FD_PUBKEY_U64_PAIR_FOOTPRINT*unused3_len );
     for( ulong i=0; i < unused3_len; i++ ) {
-      err = fd_pubkey_u64_pair_decode_preflight( ctx );
+      err = fd_pubkey_u64_pair_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -5896,26 +6847,27 @@ int fd_deserializable_versioned_bank_decode( fd_deserializable_versioned_bank_t
   fd_deserializable_versioned_bank_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_deserializable_versioned_bank_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_deserializable_versioned_bank_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_block_hash_vec_decode_preflight( ctx );
+  err = fd_block_hash_vec_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   ulong ancestors_len;
   err = fd_bincode_uint64_decode( &ancestors_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( ancestors_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_SLOT_PAIR_ALIGN, FD_SLOT_PAIR_FOOTPRINT*ancestors_len );
     for( ulong i=0; i < ancestors_len; i++ ) {
-      err = fd_slot_pair_decode_preflight( ctx );
+      err = fd_slot_pair_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_hard_forks_decode_preflight( ctx );
+  err = fd_hard_forks_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -5932,6 +6884,7 @@ int fd_deserializable_versioned_bank_decode_preflight( fd_bincode_decode_ctx_t *
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
+      *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, sizeof(ulong) );
       err = fd_bincode_uint64_decode_preflight( ctx );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
@@ -5952,32 +6905,33 @@ int fd_deserializable_versioned_bank_decode_preflight( fd_bincode_decode_ctx_t *
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_fee_calculator_decode_preflight( ctx );
+  err = fd_fee_calculator_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_fee_rate_governor_decode_preflight( ctx );
+  err = fd_fee_rate_governor_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_rent_collector_decode_preflight( ctx );
+  err = fd_rent_collector_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_epoch_schedule_decode_preflight( ctx );
+  err = fd_epoch_schedule_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_inflation_decode_preflight( ctx );
+  err = fd_inflation_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_stakes_decode_preflight( ctx );
+  err = fd_stakes_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_unused_accounts_decode_preflight( ctx );
+  err = fd_unused_accounts_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   ulong epoch_stakes_len;
   err = fd_bincode_uint64_decode( &epoch_stakes_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( epoch_stakes_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_EPOCH_EPOCH_STAKES_PAIR_ALIGN, FD_EPOCH_EPOCH_STAKES_PAIR_FOOTPRINT*epoch_stakes_len );
     for( ulong i=0; i < epoch_stakes_len; i++ ) {
-      err = fd_epoch_epoch_stakes_pair_decode_preflight( ctx );
+      err = fd_epoch_epoch_stakes_pair_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -5985,6 +6939,17 @@ int fd_deserializable_versioned_bank_decode_preflight( fd_bincode_decode_ctx_t *
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_deserializable_versioned_bank_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_deserializable_versioned_bank_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_deserializable_versioned_bank_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_deserializable_versioned_bank_t);
+  int err = fd_deserializable_versioned_bank_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_deserializable_versioned_bank_decode_unsafe( fd_deserializable_versioned_bank_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_block_hash_vec_decode_unsafe( &self->blockhash_queue, ctx );
   fd_bincode_uint64_decode_unsafe( &self->ancestors_len, ctx );
@@ -6043,6 +7008,15 @@ void fd_deserializable_versioned_bank_decode_unsafe( fd_deserializable_versioned
     self->epoch_stakes = NULL;
   fd_bincode_bool_decode_unsafe( &self->is_delta, ctx );
 }
+fd_deserializable_versioned_bank_t * fd_deserializable_versioned_bank_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_deserializable_versioned_bank_t * self = (fd_deserializable_versioned_bank_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_deserializable_versioned_bank_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_deserializable_versioned_bank_new( self );
+  fd_deserializable_versioned_bank_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_deserializable_versioned_bank_encode( fd_deserializable_versioned_bank_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_block_hash_vec_encode( &self->blockhash_queue, ctx );
@@ -6132,31 +7106,33 @@ int fd_deserializable_versioned_bank_encode( fd_deserializable_versioned_bank_t
 }
 int fd_deserializable_versioned_bank_decode_offsets( fd_deserializable_versioned_bank_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->blockhash_queue_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_block_hash_vec_decode_preflight( ctx );
+  err = fd_block_hash_vec_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->ancestors_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong ancestors_len;
   err = fd_bincode_uint64_decode( &ancestors_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( ancestors_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_SLOT_PAIR_ALIGN, FD_SLOT_PAIR_FOOTPRINT*ancestors_len );
     for( ulong i=0; i < ancestors_len; i++ ) {
-      err = fd_slot_pair_decode_preflight( ctx );
+      err = fd_slot_pair_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
   self->hash_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->parent_hash_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->parent_slot_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->hard_forks_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_hard_forks_decode_preflight( ctx );
+  err = fd_hard_forks_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->transaction_count_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -6179,6 +7155,7 @@ int fd_deserializable_versioned_bank_decode_offsets( fd_deserializable_versioned
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
+      *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, sizeof(ulong) );
       err = fd_bincode_uint64_decode_preflight( ctx );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
@@ -6208,42 +7185,43 @@ int fd_deserializable_versioned_bank_decode_offsets( fd_deserializable_versioned
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->collector_id_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->collector_fees_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->fee_calculator_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_fee_calculator_decode_preflight( ctx );
+  err = fd_fee_calculator_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->fee_rate_governor_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_fee_rate_governor_decode_preflight( ctx );
+  err = fd_fee_rate_governor_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->collected_rent_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->rent_collector_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_rent_collector_decode_preflight( ctx );
+  err = fd_rent_collector_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->epoch_schedule_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_epoch_schedule_decode_preflight( ctx );
+  err = fd_epoch_schedule_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->inflation_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_inflation_decode_preflight( ctx );
+  err = fd_inflation_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->stakes_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_stakes_decode_preflight( ctx );
+  err = fd_stakes_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->unused_accounts_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_unused_accounts_decode_preflight( ctx );
+  err = fd_unused_accounts_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->epoch_stakes_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong epoch_stakes_len;
   err = fd_bincode_uint64_decode( &epoch_stakes_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( epoch_stakes_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_EPOCH_EPOCH_STAKES_PAIR_ALIGN, FD_EPOCH_EPOCH_STAKES_PAIR_FOOTPRINT*epoch_stakes_len );
     for( ulong i=0; i < epoch_stakes_len; i++ ) {
-      err = fd_epoch_epoch_stakes_pair_decode_preflight( ctx );
+      err = fd_epoch_epoch_stakes_pair_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -6410,26 +7388,27 @@ int fd_serializable_versioned_bank_decode( fd_serializable_versioned_bank_t * se
   fd_serializable_versioned_bank_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_serializable_versioned_bank_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_serializable_versioned_bank_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_block_hash_vec_decode_preflight( ctx );
+  err = fd_block_hash_vec_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   ulong ancestors_len;
   err = fd_bincode_uint64_decode( &ancestors_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( ancestors_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_SLOT_PAIR_ALIGN, FD_SLOT_PAIR_FOOTPRINT*ancestors_len );
     for( ulong i=0; i < ancestors_len; i++ ) {
-      err = fd_slot_pair_decode_preflight( ctx );
+      err = fd_slot_pair_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_hard_forks_decode_preflight( ctx );
+  err = fd_hard_forks_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -6446,6 +7425,7 @@ int fd_serializable_versioned_bank_decode_preflight( fd_bincode_decode_ctx_t * c
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
+      *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, sizeof(ulong) );
       err = fd_bincode_uint64_decode_preflight( ctx );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
@@ -6466,32 +7446,33 @@ int fd_serializable_versioned_bank_decode_preflight( fd_bincode_decode_ctx_t * c
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_fee_calculator_decode_preflight( ctx );
+  err = fd_fee_calculator_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_fee_rate_governor_decode_preflight( ctx );
+  err = fd_fee_rate_governor_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_rent_collector_decode_preflight( ctx );
+  err = fd_rent_collector_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_epoch_schedule_decode_preflight( ctx );
+  err = fd_epoch_schedule_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_inflation_decode_preflight( ctx );
+  err = fd_inflation_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_stakes_serializable_decode_preflight( ctx );
+  err = fd_stakes_serializable_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_unused_accounts_decode_preflight( ctx );
+  err = fd_unused_accounts_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   ulong epoch_stakes_len;
   err = fd_bincode_uint64_decode( &epoch_stakes_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( epoch_stakes_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_EPOCH_EPOCH_STAKES_PAIR_ALIGN, FD_EPOCH_EPOCH_STAKES_PAIR_FOOTPRINT*epoch_stakes_len );
     for( ulong i=0; i < epoch_stakes_len; i++ ) {
-      err = fd_epoch_epoch_stakes_pair_decode_preflight( ctx );
+      err = fd_epoch_epoch_stakes_pair_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -6499,6 +7480,17 @@ int fd_serializable_versioned_bank_decode_preflight( fd_bincode_decode_ctx_t * c
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_serializable_versioned_bank_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_serializable_versioned_bank_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_serializable_versioned_bank_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_serializable_versioned_bank_t);
+  int err = fd_serializable_versioned_bank_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_serializable_versioned_bank_decode_unsafe( fd_serializable_versioned_bank_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_block_hash_vec_decode_unsafe( &self->blockhash_queue, ctx );
   fd_bincode_uint64_decode_unsafe( &self->ancestors_len, ctx );
@@ -6557,6 +7549,15 @@ void fd_serializable_versioned_bank_decode_unsafe( fd_serializable_versioned_ban
     self->epoch_stakes = NULL;
   fd_bincode_bool_decode_unsafe( &self->is_delta, ctx );
 }
+fd_serializable_versioned_bank_t * fd_serializable_versioned_bank_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_serializable_versioned_bank_t * self = (fd_serializable_versioned_bank_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_serializable_versioned_bank_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_serializable_versioned_bank_new( self );
+  fd_serializable_versioned_bank_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_serializable_versioned_bank_encode( fd_serializable_versioned_bank_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_block_hash_vec_encode( &self->blockhash_queue, ctx );
@@ -6646,31 +7647,33 @@ int fd_serializable_versioned_bank_encode( fd_serializable_versioned_bank_t cons
 }
 int fd_serializable_versioned_bank_decode_offsets( fd_serializable_versioned_bank_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->blockhash_queue_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_block_hash_vec_decode_preflight( ctx );
+  err = fd_block_hash_vec_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->ancestors_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong ancestors_len;
   err = fd_bincode_uint64_decode( &ancestors_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( ancestors_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_SLOT_PAIR_ALIGN, FD_SLOT_PAIR_FOOTPRINT*ancestors_len );
     for( ulong i=0; i < ancestors_len; i++ ) {
-      err = fd_slot_pair_decode_preflight( ctx );
+      err = fd_slot_pair_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
   self->hash_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->parent_hash_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->parent_slot_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->hard_forks_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_hard_forks_decode_preflight( ctx );
+  err = fd_hard_forks_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->transaction_count_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -6693,6 +7696,7 @@ int fd_serializable_versioned_bank_decode_offsets( fd_serializable_versioned_ban
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
+      *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, sizeof(ulong) );
       err = fd_bincode_uint64_decode_preflight( ctx );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
@@ -6722,42 +7726,43 @@ int fd_serializable_versioned_bank_decode_offsets( fd_serializable_versioned_ban
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->collector_id_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->collector_fees_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->fee_calculator_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_fee_calculator_decode_preflight( ctx );
+  err = fd_fee_calculator_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->fee_rate_governor_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_fee_rate_governor_decode_preflight( ctx );
+  err = fd_fee_rate_governor_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->collected_rent_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->rent_collector_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_rent_collector_decode_preflight( ctx );
+  err = fd_rent_collector_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->epoch_schedule_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_epoch_schedule_decode_preflight( ctx );
+  err = fd_epoch_schedule_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->inflation_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_inflation_decode_preflight( ctx );
+  err = fd_inflation_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->stakes_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_stakes_serializable_decode_preflight( ctx );
+  err = fd_stakes_serializable_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->unused_accounts_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_unused_accounts_decode_preflight( ctx );
+  err = fd_unused_accounts_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->epoch_stakes_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong epoch_stakes_len;
   err = fd_bincode_uint64_decode( &epoch_stakes_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( epoch_stakes_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_EPOCH_EPOCH_STAKES_PAIR_ALIGN, FD_EPOCH_EPOCH_STAKES_PAIR_FOOTPRINT*epoch_stakes_len );
     for( ulong i=0; i < epoch_stakes_len; i++ ) {
-      err = fd_epoch_epoch_stakes_pair_decode_preflight( ctx );
+      err = fd_epoch_epoch_stakes_pair_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -6924,9 +7929,20 @@ int fd_bank_hash_stats_decode( fd_bank_hash_stats_t * self, fd_bincode_decode_ct
   fd_bank_hash_stats_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_bank_hash_stats_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_bank_hash_stats_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 40, ctx );
 }
+int fd_bank_hash_stats_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_bank_hash_stats_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_bank_hash_stats_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_bank_hash_stats_t);
+  int err = fd_bank_hash_stats_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_bank_hash_stats_decode_unsafe( fd_bank_hash_stats_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->num_updated_accounts, ctx );
   fd_bincode_uint64_decode_unsafe( &self->num_removed_accounts, ctx );
@@ -6934,6 +7950,15 @@ void fd_bank_hash_stats_decode_unsafe( fd_bank_hash_stats_t * self, fd_bincode_d
   fd_bincode_uint64_decode_unsafe( &self->total_data_len, ctx );
   fd_bincode_uint64_decode_unsafe( &self->num_executable_accounts, ctx );
 }
+fd_bank_hash_stats_t * fd_bank_hash_stats_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_bank_hash_stats_t * self = (fd_bank_hash_stats_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_bank_hash_stats_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_bank_hash_stats_new( self );
+  fd_bank_hash_stats_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_bank_hash_stats_encode( fd_bank_hash_stats_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->num_updated_accounts, ctx );
@@ -6950,6 +7975,7 @@ int fd_bank_hash_stats_encode( fd_bank_hash_stats_t const * self, fd_bincode_enc
 }
 int fd_bank_hash_stats_decode_offsets( fd_bank_hash_stats_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->num_updated_accounts_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -6976,6 +8002,7 @@ void fd_bank_hash_stats_destroy( fd_bank_hash_stats_t * self, fd_bincode_destroy
 
 ulong fd_bank_hash_stats_footprint( void ){ return FD_BANK_HASH_STATS_FOOTPRINT; }
 ulong fd_bank_hash_stats_align( void ){ return FD_BANK_HASH_STATS_ALIGN; }
+FD_STATIC_ASSERT( sizeof(fd_bank_hash_stats_t)==40UL, fd_bank_hash_stats_view );
 
 void fd_bank_hash_stats_walk( void * w, fd_bank_hash_stats_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_bank_hash_stats", level++ );
@@ -7007,14 +8034,34 @@ int fd_bank_hash_info_decode( fd_bank_hash_info_t * self, fd_bincode_decode_ctx_
   fd_bank_hash_info_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_bank_hash_info_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_bank_hash_info_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 104, ctx );
 }
+int fd_bank_hash_info_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_bank_hash_info_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_bank_hash_info_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_bank_hash_info_t);
+  int err = fd_bank_hash_info_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_bank_hash_info_decode_unsafe( fd_bank_hash_info_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_hash_decode_unsafe( &self->accounts_delta_hash, ctx );
   fd_hash_decode_unsafe( &self->accounts_hash, ctx );
   fd_bank_hash_stats_decode_unsafe( &self->stats, ctx );
 }
+fd_bank_hash_info_t * fd_bank_hash_info_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_bank_hash_info_t * self = (fd_bank_hash_info_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_bank_hash_info_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_bank_hash_info_new( self );
+  fd_bank_hash_info_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_bank_hash_info_encode( fd_bank_hash_info_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_hash_encode( &self->accounts_delta_hash, ctx );
@@ -7027,15 +8074,16 @@ int fd_bank_hash_info_encode( fd_bank_hash_info_t const * self, fd_bincode_encod
 }
 int fd_bank_hash_info_decode_offsets( fd_bank_hash_info_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->accounts_delta_hash_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->accounts_hash_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->stats_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_bank_hash_stats_decode_preflight( ctx );
+  err = fd_bank_hash_stats_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -7053,6 +8101,7 @@ void fd_bank_hash_info_destroy( fd_bank_hash_info_t * self, fd_bincode_destroy_c
 
 ulong fd_bank_hash_info_footprint( void ){ return FD_BANK_HASH_INFO_FOOTPRINT; }
 ulong fd_bank_hash_info_align( void ){ return FD_BANK_HASH_INFO_ALIGN; }
+FD_STATIC_ASSERT( sizeof(fd_bank_hash_info_t)==104UL, fd_bank_hash_info_view );
 
 void fd_bank_hash_info_walk( void * w, fd_bank_hash_info_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_bank_hash_info", level++ );
@@ -7080,13 +8129,33 @@ int fd_slot_map_pair_decode( fd_slot_map_pair_t * self, fd_bincode_decode_ctx_t
   fd_slot_map_pair_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_slot_map_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_slot_map_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 40, ctx );
 }
+int fd_slot_map_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_slot_map_pair_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_slot_map_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_slot_map_pair_t);
+  int err = fd_slot_map_pair_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_slot_map_pair_decode_unsafe( fd_slot_map_pair_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->slot, ctx );
   fd_hash_decode_unsafe( &self->hash, ctx );
 }
+fd_slot_map_pair_t * fd_slot_map_pair_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_slot_map_pair_t * self = (fd_slot_map_pair_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_slot_map_pair_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_slot_map_pair_new( self );
+  fd_slot_map_pair_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_slot_map_pair_encode( fd_slot_map_pair_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->slot, ctx );
@@ -7097,12 +8166,13 @@ int fd_slot_map_pair_encode( fd_slot_map_pair_t const * self, fd_bincode_encode_
 }
 int fd_slot_map_pair_decode_offsets( fd_slot_map_pair_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->slot_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->hash_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -7116,6 +8186,7 @@ void fd_slot_map_pair_destroy( fd_slot_map_pair_t * self, fd_bincode_destroy_ctx
 
 ulong fd_slot_map_pair_footprint( void ){ return FD_SLOT_MAP_PAIR_FOOTPRINT; }
 ulong fd_slot_map_pair_align( void ){ return FD_SLOT_MAP_PAIR_ALIGN; }
+FD_STATIC_ASSERT( sizeof(fd_slot_map_pair_t)==40UL, fd_slot_map_pair_view );
 
 void fd_slot_map_pair_walk( void * w, fd_slot_map_pair_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_slot_map_pair", level++ );
@@ -7141,13 +8212,33 @@ int fd_snapshot_acc_vec_decode( fd_snapshot_acc_vec_t * self, fd_bincode_decode_
   fd_snapshot_acc_vec_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_snapshot_acc_vec_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_snapshot_acc_vec_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 16, ctx );
 }
+int fd_snapshot_acc_vec_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_snapshot_acc_vec_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_snapshot_acc_vec_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_snapshot_acc_vec_t);
+  int err = fd_snapshot_acc_vec_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_snapshot_acc_vec_decode_unsafe( fd_snapshot_acc_vec_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->id, ctx );
   fd_bincode_uint64_decode_unsafe( &self->file_sz, ctx );
 }
+fd_snapshot_acc_vec_t * fd_snapshot_acc_vec_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_snapshot_acc_vec_t * self = (fd_snapshot_acc_vec_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_snapshot_acc_vec_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_snapshot_acc_vec_new( self );
+  fd_snapshot_acc_vec_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_snapshot_acc_vec_encode( fd_snapshot_acc_vec_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->id, ctx );
@@ -7158,6 +8249,7 @@ int fd_snapshot_acc_vec_encode( fd_snapshot_acc_vec_t const * self, fd_bincode_e
 }
 int fd_snapshot_acc_vec_decode_offsets( fd_snapshot_acc_vec_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->id_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -7175,6 +8267,7 @@ void fd_snapshot_acc_vec_destroy( fd_snapshot_acc_vec_t * self, fd_bincode_destr
 
 ulong fd_snapshot_acc_vec_footprint( void ){ return FD_SNAPSHOT_ACC_VEC_FOOTPRINT; }
 ulong fd_snapshot_acc_vec_align( void ){ return FD_SNAPSHOT_ACC_VEC_ALIGN; }
+FD_STATIC_ASSERT( sizeof(fd_snapshot_acc_vec_t)==16UL, fd_snapshot_acc_vec_view );
 
 void fd_snapshot_acc_vec_walk( void * w, fd_snapshot_acc_vec_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_snapshot_acc_vec", level++ );
@@ -7200,7 +8293,7 @@ int fd_snapshot_slot_acc_vecs_decode( fd_snapshot_slot_acc_vecs_t * self, fd_bin
   fd_snapshot_slot_acc_vecs_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_snapshot_slot_acc_vecs_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_snapshot_slot_acc_vecs_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -7208,13 +8301,25 @@ int fd_snapshot_slot_acc_vecs_decode_preflight( fd_bincode_decode_ctx_t * ctx )
   err = fd_bincode_uint64_decode( &account_vecs_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( account_vecs_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_SNAPSHOT_ACC_VEC_ALIGN, FD_SNAPSHOT_ACC_VEC_FOOTPRINT*account_vecs_len );
     for( ulong i=0; i < account_vecs_len; i++ ) {
-      err = fd_snapshot_acc_vec_decode_preflight( ctx );
+      err = fd_snapshot_acc_vec_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_snapshot_slot_acc_vecs_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_snapshot_slot_acc_vecs_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_snapshot_slot_acc_vecs_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_snapshot_slot_acc_vecs_t);
+  int err = fd_snapshot_slot_acc_vecs_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_snapshot_slot_acc_vecs_decode_unsafe( fd_snapshot_slot_acc_vecs_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->slot, ctx );
   fd_bincode_uint64_decode_unsafe( &self->account_vecs_len, ctx );
@@ -7227,6 +8332,15 @@ void fd_snapshot_slot_acc_vecs_decode_unsafe( fd_snapshot_slot_acc_vecs_t * self
   } else
     self->account_vecs = NULL;
 }
+fd_snapshot_slot_acc_vecs_t * fd_snapshot_slot_acc_vecs_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_snapshot_slot_acc_vecs_t * self = (fd_snapshot_slot_acc_vecs_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_snapshot_slot_acc_vecs_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_snapshot_slot_acc_vecs_new( self );
+  fd_snapshot_slot_acc_vecs_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_snapshot_slot_acc_vecs_encode( fd_snapshot_slot_acc_vecs_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->slot, ctx );
@@ -7243,6 +8357,7 @@ int fd_snapshot_slot_acc_vecs_encode( fd_snapshot_slot_acc_vecs_t const * self,
 }
 int fd_snapshot_slot_acc_vecs_decode_offsets( fd_snapshot_slot_acc_vecs_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->slot_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -7252,8 +8367,9 @@ int fd_snapshot_slot_acc_vecs_decode_offsets( fd_snapshot_slot_acc_vecs_off_t *
   err = fd_bincode_uint64_decode( &account_vecs_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( account_vecs_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_SNAPSHOT_ACC_VEC_ALIGN, FD_SNAPSHOT_ACC_VEC_FOOTPRINT*account_vecs_len );
     for( ulong i=0; i < account_vecs_len; i++ ) {
-      err = fd_snapshot_acc_vec_decode_preflight( ctx );
+      err = fd_snapshot_acc_vec_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -7309,7 +8425,7 @@ FD_FN_PURE uchar fd_reward_type_is_voting(fd_reward_type_t const * self) {
   return self->discriminant == 3;
 }
 void fd_reward_type_inner_new( fd_reward_type_inner_t * self, uint discriminant );
-int fd_reward_type_inner_decode_preflight( uint discriminant, fd_bincode_decode_ctx_t * ctx ) {
+int fd_reward_type_inner_decode_footprint( uint discriminant, fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   switch (discriminant) {
   case 0: {
@@ -7354,16 +8470,36 @@ int fd_reward_type_decode( fd_reward_type_t * self, fd_bincode_decode_ctx_t * ct
   fd_reward_type_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_reward_type_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_reward_type_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   uint discriminant = 0;
   int err = fd_bincode_uint32_decode( &discriminant, ctx );
   if( FD_UNLIKELY( err ) ) return err;
-  return fd_reward_type_inner_decode_preflight( discriminant, ctx );
+  return fd_reward_type_inner_decode_footprint( discriminant, ctx, total_sz );
+}
+int fd_reward_type_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_reward_type_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_reward_type_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_reward_type_t);
+  int err = fd_reward_type_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
 }
 void fd_reward_type_decode_unsafe( fd_reward_type_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint32_decode_unsafe( &self->discriminant, ctx );
   fd_reward_type_inner_decode_unsafe( &self->inner, self->discriminant, ctx );
 }
+fd_reward_type_t * fd_reward_type_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_reward_type_t * self = (fd_reward_type_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_reward_type_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_reward_type_new( self );
+  fd_reward_type_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 void fd_reward_type_inner_new( fd_reward_type_inner_t * self, uint discriminant ) {
   switch( discriminant ) {
   case 0: {
@@ -7451,14 +8587,15 @@ int fd_solana_accounts_db_fields_decode( fd_solana_accounts_db_fields_t * self,
   fd_solana_accounts_db_fields_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_solana_accounts_db_fields_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_solana_accounts_db_fields_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   ulong storages_len;
   err = fd_bincode_uint64_decode( &storages_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( storages_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_SNAPSHOT_SLOT_ACC_VECS_ALIGN, FD_SNAPSHOT_SLOT_ACC_VECS_FOOTPRINT*storages_len );
     for( ulong i=0; i < storages_len; i++ ) {
-      err = fd_snapshot_slot_acc_vecs_decode_preflight( ctx );
+      err = fd_snapshot_slot_acc_vecs_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -7466,12 +8603,13 @@ int fd_solana_accounts_db_fields_decode_preflight( fd_bincode_decode_ctx_t * ctx
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_bank_hash_info_decode_preflight( ctx );
+  err = fd_bank_hash_info_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   ulong historical_roots_len;
   err = fd_bincode_uint64_decode( &historical_roots_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( historical_roots_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, sizeof(ulong)*historical_roots_len );
     for( ulong i=0; i < historical_roots_len; i++ ) {
       err = fd_bincode_uint64_decode_preflight( ctx );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -7481,13 +8619,25 @@ int fd_solana_accounts_db_fields_decode_preflight( fd_bincode_decode_ctx_t * ctx
   err = fd_bincode_uint64_decode( &historical_roots_with_hash_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( historical_roots_with_hash_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_SLOT_MAP_PAIR_ALIGN, FD_SLOT_MAP_PAIR_FOOTPRINT*historical_roots_with_hash_len );
     for( ulong i=0; i < historical_roots_with_hash_len; i++ ) {
-      err = fd_slot_map_pair_decode_preflight( ctx );
+      err = fd_slot_map_pair_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_solana_accounts_db_fields_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_solana_accounts_db_fields_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_solana_accounts_db_fields_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_solana_accounts_db_fields_t);
+  int err = fd_solana_accounts_db_fields_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_solana_accounts_db_fields_decode_unsafe( fd_solana_accounts_db_fields_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->storages_len, ctx );
   if( self->storages_len ) {
@@ -7519,6 +8669,15 @@ void fd_solana_accounts_db_fields_decode_unsafe( fd_solana_accounts_db_fields_t
   } else
     self->historical_roots_with_hash = NULL;
 }
+fd_solana_accounts_db_fields_t * fd_solana_accounts_db_fields_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_solana_accounts_db_fields_t * self = (fd_solana_accounts_db_fields_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_solana_accounts_db_fields_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_solana_accounts_db_fields_new( self );
+  fd_solana_accounts_db_fields_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_solana_accounts_db_fields_encode( fd_solana_accounts_db_fields_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->storages_len, ctx );
@@ -7554,14 +8713,16 @@ int fd_solana_accounts_db_fields_encode( fd_solana_accounts_db_fields_t const *
 }
 int fd_solana_accounts_db_fields_decode_offsets( fd_solana_accounts_db_fields_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->storages_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong storages_len;
   err = fd_bincode_uint64_decode( &storages_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( storages_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_SNAPSHOT_SLOT_ACC_VECS_ALIGN, FD_SNAPSHOT_SLOT_ACC_VECS_FOOTPRINT*storages_len );
     for( ulong i=0; i < storages_len; i++ ) {
-      err = fd_snapshot_slot_acc_vecs_decode_preflight( ctx );
+      err = fd_snapshot_slot_acc_vecs_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -7572,13 +8733,14 @@ int fd_solana_accounts_db_fields_decode_offsets( fd_solana_accounts_db_fields_of
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->bank_hash_info_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_bank_hash_info_decode_preflight( ctx );
+  err = fd_bank_hash_info_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->historical_roots_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong historical_roots_len;
   err = fd_bincode_uint64_decode( &historical_roots_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( historical_roots_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, sizeof(ulong)*historical_roots_len );
     for( ulong i=0; i < historical_roots_len; i++ ) {
       err = fd_bincode_uint64_decode_preflight( ctx );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -7589,8 +8751,9 @@ int fd_solana_accounts_db_fields_decode_offsets( fd_solana_accounts_db_fields_of
   err = fd_bincode_uint64_decode( &historical_roots_with_hash_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( historical_roots_with_hash_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_SLOT_MAP_PAIR_ALIGN, FD_SLOT_MAP_PAIR_FOOTPRINT*historical_roots_with_hash_len );
     for( ulong i=0; i < historical_roots_with_hash_len; i++ ) {
-      err = fd_slot_map_pair_decode_preflight( ctx );
+      err = fd_slot_map_pair_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -7681,9 +8844,9 @@ int fd_versioned_epoch_stakes_current_decode( fd_versioned_epoch_stakes_current_
   fd_versioned_epoch_stakes_current_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_versioned_epoch_stakes_current_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_versioned_epoch_stakes_current_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_stakes_stake_decode_preflight( ctx );
+  err = fd_stakes_stake_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -7691,8 +8854,9 @@ int fd_versioned_epoch_stakes_current_decode_preflight( fd_bincode_decode_ctx_t
   err = fd_bincode_uint64_decode( &node_id_to_vote_accounts_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( node_id_to_vote_accounts_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_PUBKEY_NODE_VOTE_ACCOUNTS_PAIR_ALIGN, FD_PUBKEY_NODE_VOTE_ACCOUNTS_PAIR_FOOTPRINT*node_id_to_vote_accounts_len );
     for( ulong i=0; i < node_id_to_vote_accounts_len; i++ ) {
-      err = fd_pubkey_node_vote_accounts_pair_decode_preflight( ctx );
+      err = fd_pubkey_node_vote_accounts_pair_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -7700,13 +8864,25 @@ int fd_versioned_epoch_stakes_current_decode_preflight( fd_bincode_decode_ctx_t
   err = fd_bincode_uint64_decode( &epoch_authorized_voters_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( epoch_authorized_voters_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_PUBKEY_PUBKEY_PAIR_ALIGN, FD_PUBKEY_PUBKEY_PAIR_FOOTPRINT*epoch_authorized_voters_len );
     for( ulong i=0; i < epoch_authorized_voters_len; i++ ) {
-      err = fd_pubkey_pubkey_pair_decode_preflight( ctx );
+      err = fd_pubkey_pubkey_pair_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_versioned_epoch_stakes_current_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_versioned_epoch_stakes_current_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_versioned_epoch_stakes_current_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_versioned_epoch_stakes_current_t);
+  int err = fd_versioned_epoch_stakes_current_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_versioned_epoch_stakes_current_decode_unsafe( fd_versioned_epoch_stakes_current_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_stakes_stake_decode_unsafe( &self->stakes, ctx );
   fd_bincode_uint64_decode_unsafe( &self->total_stake, ctx );
@@ -7729,6 +8905,15 @@ void fd_versioned_epoch_stakes_current_decode_unsafe( fd_versioned_epoch_stakes_
   } else
     self->epoch_authorized_voters = NULL;
 }
+fd_versioned_epoch_stakes_current_t * fd_versioned_epoch_stakes_current_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_versioned_epoch_stakes_current_t * self = (fd_versioned_epoch_stakes_current_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_versioned_epoch_stakes_current_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_versioned_epoch_stakes_current_new( self );
+  fd_versioned_epoch_stakes_current_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_versioned_epoch_stakes_current_encode( fd_versioned_epoch_stakes_current_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_stakes_stake_encode( &self->stakes, ctx );
@@ -7755,9 +8940,10 @@ int fd_versioned_epoch_stakes_current_encode( fd_versioned_epoch_stakes_current_
 }
 int fd_versioned_epoch_stakes_current_decode_offsets( fd_versioned_epoch_stakes_current_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->stakes_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_stakes_stake_decode_preflight( ctx );
+  err = fd_stakes_stake_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->total_stake_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -7767,8 +8953,9 @@ int fd_versioned_epoch_stakes_current_decode_offsets( fd_versioned_epoch_stakes_
   err = fd_bincode_uint64_decode( &node_id_to_vote_accounts_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( node_id_to_vote_accounts_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_PUBKEY_NODE_VOTE_ACCOUNTS_PAIR_ALIGN, FD_PUBKEY_NODE_VOTE_ACCOUNTS_PAIR_FOOTPRINT*node_id_to_vote_accounts_len );
     for( ulong i=0; i < node_id_to_vote_accounts_len; i++ ) {
-      err = fd_pubkey_node_vote_accounts_pair_decode_preflight( ctx );
+      err = fd_pubkey_node_vote_accounts_pair_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -7777,8 +8964,9 @@ int fd_versioned_epoch_stakes_current_decode_offsets( fd_versioned_epoch_stakes_
   err = fd_bincode_uint64_decode( &epoch_authorized_voters_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( epoch_authorized_voters_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_PUBKEY_PUBKEY_PAIR_ALIGN, FD_PUBKEY_PUBKEY_PAIR_FOOTPRINT*epoch_authorized_voters_len );
     for( ulong i=0; i < epoch_authorized_voters_len; i++ ) {
-      err = fd_pubkey_pubkey_pair_decode_preflight( ctx );
+      err = fd_pubkey_pubkey_pair_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -7846,11 +9034,11 @@ FD_FN_PURE uchar fd_versioned_epoch_stakes_is_Current(fd_versioned_epoch_stakes_
   return self->discriminant == 0;
 }
 void fd_versioned_epoch_stakes_inner_new( fd_versioned_epoch_stakes_inner_t * self, uint discriminant );
-int fd_versioned_epoch_stakes_inner_decode_preflight( uint discriminant, fd_bincode_decode_ctx_t * ctx ) {
+int fd_versioned_epoch_stakes_inner_decode_footprint( uint discriminant, fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   switch (discriminant) {
   case 0: {
-    err = fd_versioned_epoch_stakes_current_decode_preflight( ctx );
+    err = fd_versioned_epoch_stakes_current_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
@@ -7876,16 +9064,36 @@ int fd_versioned_epoch_stakes_decode( fd_versioned_epoch_stakes_t * self, fd_bin
   fd_versioned_epoch_stakes_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_versioned_epoch_stakes_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_versioned_epoch_stakes_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   uint discriminant = 0;
   int err = fd_bincode_uint32_decode( &discriminant, ctx );
   if( FD_UNLIKELY( err ) ) return err;
-  return fd_versioned_epoch_stakes_inner_decode_preflight( discriminant, ctx );
+  return fd_versioned_epoch_stakes_inner_decode_footprint( discriminant, ctx, total_sz );
+}
+int fd_versioned_epoch_stakes_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_versioned_epoch_stakes_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_versioned_epoch_stakes_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_versioned_epoch_stakes_t);
+  int err = fd_versioned_epoch_stakes_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
 }
 void fd_versioned_epoch_stakes_decode_unsafe( fd_versioned_epoch_stakes_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint32_decode_unsafe( &self->discriminant, ctx );
   fd_versioned_epoch_stakes_inner_decode_unsafe( &self->inner, self->discriminant, ctx );
 }
+fd_versioned_epoch_stakes_t * fd_versioned_epoch_stakes_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_versioned_epoch_stakes_t * self = (fd_versioned_epoch_stakes_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_versioned_epoch_stakes_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_versioned_epoch_stakes_new( self );
+  fd_versioned_epoch_stakes_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 void fd_versioned_epoch_stakes_inner_new( fd_versioned_epoch_stakes_inner_t * self, uint discriminant ) {
   switch( discriminant ) {
   case 0: {
@@ -7970,18 +9178,38 @@ int fd_versioned_epoch_stakes_pair_decode( fd_versioned_epoch_stakes_pair_t * se
   fd_versioned_epoch_stakes_pair_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_versioned_epoch_stakes_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_versioned_epoch_stakes_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_versioned_epoch_stakes_decode_preflight( ctx );
+  err = fd_versioned_epoch_stakes_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_versioned_epoch_stakes_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_versioned_epoch_stakes_pair_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_versioned_epoch_stakes_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_versioned_epoch_stakes_pair_t);
+  int err = fd_versioned_epoch_stakes_pair_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_versioned_epoch_stakes_pair_decode_unsafe( fd_versioned_epoch_stakes_pair_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->epoch, ctx );
   fd_versioned_epoch_stakes_decode_unsafe( &self->val, ctx );
 }
+fd_versioned_epoch_stakes_pair_t * fd_versioned_epoch_stakes_pair_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_versioned_epoch_stakes_pair_t * self = (fd_versioned_epoch_stakes_pair_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_versioned_epoch_stakes_pair_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_versioned_epoch_stakes_pair_new( self );
+  fd_versioned_epoch_stakes_pair_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_versioned_epoch_stakes_pair_encode( fd_versioned_epoch_stakes_pair_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->epoch, ctx );
@@ -7992,12 +9220,13 @@ int fd_versioned_epoch_stakes_pair_encode( fd_versioned_epoch_stakes_pair_t cons
 }
 int fd_versioned_epoch_stakes_pair_decode_offsets( fd_versioned_epoch_stakes_pair_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->epoch_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->val_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_versioned_epoch_stakes_decode_preflight( ctx );
+  err = fd_versioned_epoch_stakes_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -8036,9 +9265,9 @@ int fd_reward_info_decode( fd_reward_info_t * self, fd_bincode_decode_ctx_t * ct
   fd_reward_info_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_reward_info_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_reward_info_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_reward_type_decode_preflight( ctx );
+  err = fd_reward_type_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -8048,12 +9277,32 @@ int fd_reward_info_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_reward_info_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_reward_info_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_reward_info_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_reward_info_t);
+  int err = fd_reward_info_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_reward_info_decode_unsafe( fd_reward_info_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_reward_type_decode_unsafe( &self->reward_type, ctx );
   fd_bincode_uint64_decode_unsafe( &self->lamports, ctx );
   fd_bincode_uint64_decode_unsafe( &self->post_balance, ctx );
   fd_bincode_uint64_decode_unsafe( &self->commission, ctx );
 }
+fd_reward_info_t * fd_reward_info_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_reward_info_t * self = (fd_reward_info_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_reward_info_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_reward_info_new( self );
+  fd_reward_info_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_reward_info_encode( fd_reward_info_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_reward_type_encode( &self->reward_type, ctx );
@@ -8068,9 +9317,10 @@ int fd_reward_info_encode( fd_reward_info_t const * self, fd_bincode_encode_ctx_
 }
 int fd_reward_info_decode_offsets( fd_reward_info_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->reward_type_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_reward_type_decode_preflight( ctx );
+  err = fd_reward_type_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->lamports_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -8122,12 +9372,32 @@ int fd_slot_lthash_decode( fd_slot_lthash_t * self, fd_bincode_decode_ctx_t * ct
   fd_slot_lthash_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_slot_lthash_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_slot_lthash_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 2048, ctx );
 }
+int fd_slot_lthash_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_slot_lthash_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_slot_lthash_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_slot_lthash_t);
+  int err = fd_slot_lthash_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_slot_lthash_decode_unsafe( fd_slot_lthash_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_bytes_decode_unsafe( &self->lthash[0], sizeof(self->lthash), ctx );
 }
+fd_slot_lthash_t * fd_slot_lthash_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_slot_lthash_t * self = (fd_slot_lthash_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_slot_lthash_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_slot_lthash_new( self );
+  fd_slot_lthash_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_slot_lthash_encode( fd_slot_lthash_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_bytes_encode( self->lthash, sizeof(self->lthash), ctx );
@@ -8200,6 +9470,7 @@ int fd_slot_lthash_encode_archival( fd_slot_lthash_t const * self, fd_bincode_en
 }
 int fd_slot_lthash_decode_offsets( fd_slot_lthash_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->lthash_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_bytes_decode_preflight( 2048, ctx );
@@ -8214,6 +9485,7 @@ void fd_slot_lthash_destroy( fd_slot_lthash_t * self, fd_bincode_destroy_ctx_t *
 
 ulong fd_slot_lthash_footprint( void ){ return FD_SLOT_LTHASH_FOOTPRINT; }
 ulong fd_slot_lthash_align( void ){ return FD_SLOT_LTHASH_ALIGN; }
+FD_STATIC_ASSERT( sizeof(fd_slot_lthash_t)==2048UL, fd_slot_lthash_view );
 
 void fd_slot_lthash_walk( void * w, fd_slot_lthash_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_slot_lthash", level++ );
@@ -8237,11 +9509,11 @@ int fd_solana_manifest_decode( fd_solana_manifest_t * self, fd_bincode_decode_ct
   fd_solana_manifest_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_solana_manifest_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_solana_manifest_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_deserializable_versioned_bank_decode_preflight( ctx );
+  err = fd_deserializable_versioned_bank_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_solana_accounts_db_fields_decode_preflight( ctx );
+  err = fd_solana_accounts_db_fields_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -8251,7 +9523,8 @@ int fd_solana_manifest_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
-      err = fd_bank_incremental_snapshot_persistence_decode_preflight( ctx );
+      *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_BANK_INCREMENTAL_SNAPSHOT_PERSISTENCE_ALIGN, FD_BANK_INCREMENTAL_SNAPSHOT_PERSISTENCE_FOOTPRINT );
+      err = fd_bank_incremental_snapshot_persistence_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -8261,7 +9534,8 @@ int fd_solana_manifest_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
-      err = fd_hash_decode_preflight( ctx );
+      *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_HASH_ALIGN, FD_HASH_FOOTPRINT );
+      err = fd_hash_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -8270,8 +9544,9 @@ int fd_solana_manifest_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   err = fd_bincode_uint64_decode( &versioned_epoch_stakes_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( versioned_epoch_stakes_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_VERSIONED_EPOCH_STAKES_PAIR_ALIGN, FD_VERSIONED_EPOCH_STAKES_PAIR_FOOTPRINT*versioned_epoch_stakes_len );
     for( ulong i=0; i < versioned_epoch_stakes_len; i++ ) {
-      err = fd_versioned_epoch_stakes_pair_decode_preflight( ctx );
+      err = fd_versioned_epoch_stakes_pair_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -8281,12 +9556,24 @@ int fd_solana_manifest_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
-      err = fd_slot_lthash_decode_preflight( ctx );
+      *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_SLOT_LTHASH_ALIGN, FD_SLOT_LTHASH_FOOTPRINT );
+      err = fd_slot_lthash_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_solana_manifest_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_solana_manifest_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_solana_manifest_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_solana_manifest_t);
+  int err = fd_solana_manifest_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_solana_manifest_decode_unsafe( fd_solana_manifest_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_deserializable_versioned_bank_decode_unsafe( &self->bank, ctx );
   fd_solana_accounts_db_fields_decode_unsafe( &self->accounts_db, ctx );
@@ -8335,6 +9622,15 @@ void fd_solana_manifest_decode_unsafe( fd_solana_manifest_t * self, fd_bincode_d
       self->lthash = NULL;
   }
 }
+fd_solana_manifest_t * fd_solana_manifest_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_solana_manifest_t * self = (fd_solana_manifest_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_solana_manifest_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_solana_manifest_new( self );
+  fd_solana_manifest_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_solana_manifest_encode( fd_solana_manifest_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_deserializable_versioned_bank_encode( &self->bank, ctx );
@@ -8382,12 +9678,13 @@ int fd_solana_manifest_encode( fd_solana_manifest_t const * self, fd_bincode_enc
 }
 int fd_solana_manifest_decode_offsets( fd_solana_manifest_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->bank_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_deserializable_versioned_bank_decode_preflight( ctx );
+  err = fd_deserializable_versioned_bank_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->accounts_db_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_solana_accounts_db_fields_decode_preflight( ctx );
+  err = fd_solana_accounts_db_fields_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->lamports_per_signature_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -8399,7 +9696,8 @@ int fd_solana_manifest_decode_offsets( fd_solana_manifest_off_t * self, fd_binco
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
-      err = fd_bank_incremental_snapshot_persistence_decode_preflight( ctx );
+      *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_BANK_INCREMENTAL_SNAPSHOT_PERSISTENCE_ALIGN, FD_BANK_INCREMENTAL_SNAPSHOT_PERSISTENCE_FOOTPRINT );
+      err = fd_bank_incremental_snapshot_persistence_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -8410,7 +9708,8 @@ int fd_solana_manifest_decode_offsets( fd_solana_manifest_off_t * self, fd_binco
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
-      err = fd_hash_decode_preflight( ctx );
+      *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_HASH_ALIGN, FD_HASH_FOOTPRINT );
+      err = fd_hash_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -8420,8 +9719,9 @@ int fd_solana_manifest_decode_offsets( fd_solana_manifest_off_t * self, fd_binco
   err = fd_bincode_uint64_decode( &versioned_epoch_stakes_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( versioned_epoch_stakes_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_VERSIONED_EPOCH_STAKES_PAIR_ALIGN, FD_VERSIONED_EPOCH_STAKES_PAIR_FOOTPRINT*versioned_epoch_stakes_len );
     for( ulong i=0; i < versioned_epoch_stakes_len; i++ ) {
-      err = fd_versioned_epoch_stakes_pair_decode_preflight( ctx );
+      err = fd_versioned_epoch_stakes_pair_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -8432,7 +9732,8 @@ int fd_solana_manifest_decode_offsets( fd_solana_manifest_off_t * self, fd_binco
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
-      err = fd_slot_lthash_decode_preflight( ctx );
+      *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_SLOT_LTHASH_ALIGN, FD_SLOT_LTHASH_FOOTPRINT );
+      err = fd_slot_lthash_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -8536,11 +9837,11 @@ int fd_solana_manifest_serializable_decode( fd_solana_manifest_serializable_t *
   fd_solana_manifest_serializable_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_solana_manifest_serializable_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_solana_manifest_serializable_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_serializable_versioned_bank_decode_preflight( ctx );
+  err = fd_serializable_versioned_bank_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_solana_accounts_db_fields_decode_preflight( ctx );
+  err = fd_solana_accounts_db_fields_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -8550,7 +9851,8 @@ int fd_solana_manifest_serializable_decode_preflight( fd_bincode_decode_ctx_t *
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
-      err = fd_bank_incremental_snapshot_persistence_decode_preflight( ctx );
+      *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_BANK_INCREMENTAL_SNAPSHOT_PERSISTENCE_ALIGN, FD_BANK_INCREMENTAL_SNAPSHOT_PERSISTENCE_FOOTPRINT );
+      err = fd_bank_incremental_snapshot_persistence_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -8560,7 +9862,8 @@ int fd_solana_manifest_serializable_decode_preflight( fd_bincode_decode_ctx_t *
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
-      err = fd_hash_decode_preflight( ctx );
+      *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_HASH_ALIGN, FD_HASH_FOOTPRINT );
+      err = fd_hash_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -8569,13 +9872,25 @@ int fd_solana_manifest_serializable_decode_preflight( fd_bincode_decode_ctx_t *
   err = fd_bincode_uint64_decode( &versioned_epoch_stakes_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( versioned_epoch_stakes_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_VERSIONED_EPOCH_STAKES_PAIR_ALIGN, FD_VERSIONED_EPOCH_STAKES_PAIR_FOOTPRINT*versioned_epoch_stakes_len );
     for( ulong i=0; i < versioned_epoch_stakes_len; i++ ) {
-      err = fd_versioned_epoch_stakes_pair_decode_preflight( ctx );
+      err = fd_versioned_epoch_stakes_pair_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_solana_manifest_serializable_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_solana_manifest_serializable_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_solana_manifest_serializable_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_solana_manifest_serializable_t);
+  int err = fd_solana_manifest_serializable_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_solana_manifest_serializable_decode_unsafe( fd_solana_manifest_serializable_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_serializable_versioned_bank_decode_unsafe( &self->bank, ctx );
   fd_solana_accounts_db_fields_decode_unsafe( &self->accounts_db, ctx );
@@ -8613,6 +9928,15 @@ void fd_solana_manifest_serializable_decode_unsafe( fd_solana_manifest_serializa
   } else
     self->versioned_epoch_stakes = NULL;
 }
+fd_solana_manifest_serializable_t * fd_solana_manifest_serializable_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_solana_manifest_serializable_t * self = (fd_solana_manifest_serializable_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_solana_manifest_serializable_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_solana_manifest_serializable_new( self );
+  fd_solana_manifest_serializable_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_solana_manifest_serializable_encode( fd_solana_manifest_serializable_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_serializable_versioned_bank_encode( &self->bank, ctx );
@@ -8651,12 +9975,13 @@ int fd_solana_manifest_serializable_encode( fd_solana_manifest_serializable_t co
 }
 int fd_solana_manifest_serializable_decode_offsets( fd_solana_manifest_serializable_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->bank_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_serializable_versioned_bank_decode_preflight( ctx );
+  err = fd_serializable_versioned_bank_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->accounts_db_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_solana_accounts_db_fields_decode_preflight( ctx );
+  err = fd_solana_accounts_db_fields_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->lamports_per_signature_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -8668,7 +9993,8 @@ int fd_solana_manifest_serializable_decode_offsets( fd_solana_manifest_serializa
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
-      err = fd_bank_incremental_snapshot_persistence_decode_preflight( ctx );
+      *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_BANK_INCREMENTAL_SNAPSHOT_PERSISTENCE_ALIGN, FD_BANK_INCREMENTAL_SNAPSHOT_PERSISTENCE_FOOTPRINT );
+      err = fd_bank_incremental_snapshot_persistence_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -8679,7 +10005,8 @@ int fd_solana_manifest_serializable_decode_offsets( fd_solana_manifest_serializa
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
-      err = fd_hash_decode_preflight( ctx );
+      *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_HASH_ALIGN, FD_HASH_FOOTPRINT );
+      err = fd_hash_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -8689,8 +10016,9 @@ int fd_solana_manifest_serializable_decode_offsets( fd_solana_manifest_serializa
   err = fd_bincode_uint64_decode( &versioned_epoch_stakes_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( versioned_epoch_stakes_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_VERSIONED_EPOCH_STAKES_PAIR_ALIGN, FD_VERSIONED_EPOCH_STAKES_PAIR_FOOTPRINT*versioned_epoch_stakes_len );
     for( ulong i=0; i < versioned_epoch_stakes_len; i++ ) {
-      err = fd_versioned_epoch_stakes_pair_decode_preflight( ctx );
+      err = fd_versioned_epoch_stakes_pair_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -8780,13 +10108,33 @@ int fd_rust_duration_decode( fd_rust_duration_t * self, fd_bincode_decode_ctx_t
   fd_rust_duration_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_rust_duration_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_rust_duration_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 12, ctx );
 }
+int fd_rust_duration_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_rust_duration_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_rust_duration_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_rust_duration_t);
+  int err = fd_rust_duration_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_rust_duration_decode_unsafe( fd_rust_duration_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->seconds, ctx );
   fd_bincode_uint32_decode_unsafe( &self->nanoseconds, ctx );
 }
+fd_rust_duration_t * fd_rust_duration_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_rust_duration_t * self = (fd_rust_duration_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_rust_duration_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_rust_duration_new( self );
+  fd_rust_duration_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_rust_duration_encode( fd_rust_duration_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->seconds, ctx );
@@ -8797,6 +10145,7 @@ int fd_rust_duration_encode( fd_rust_duration_t const * self, fd_bincode_encode_
 }
 int fd_rust_duration_decode_offsets( fd_rust_duration_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->seconds_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -8839,15 +10188,16 @@ int fd_poh_config_decode( fd_poh_config_t * self, fd_bincode_decode_ctx_t * ctx
   fd_poh_config_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_poh_config_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_poh_config_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_rust_duration_decode_preflight( ctx );
+  err = fd_rust_duration_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   {
     uchar o;
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
+      *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, sizeof(ulong) );
       err = fd_bincode_uint64_decode_preflight( ctx );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
@@ -8863,6 +10213,17 @@ int fd_poh_config_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_poh_config_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_poh_config_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_poh_config_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_poh_config_t);
+  int err = fd_poh_config_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_poh_config_decode_unsafe( fd_poh_config_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_rust_duration_decode_unsafe( &self->target_tick_duration, ctx );
   {
@@ -8883,6 +10244,15 @@ void fd_poh_config_decode_unsafe( fd_poh_config_t * self, fd_bincode_decode_ctx_
     }
   }
 }
+fd_poh_config_t * fd_poh_config_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_poh_config_t * self = (fd_poh_config_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_poh_config_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_poh_config_new( self );
+  fd_poh_config_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_poh_config_encode( fd_poh_config_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_rust_duration_encode( &self->target_tick_duration, ctx );
@@ -8906,9 +10276,10 @@ int fd_poh_config_encode( fd_poh_config_t const * self, fd_bincode_encode_ctx_t
 }
 int fd_poh_config_decode_offsets( fd_poh_config_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->target_tick_duration_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_rust_duration_decode_preflight( ctx );
+  err = fd_rust_duration_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->target_tick_count_off = (uint)( (ulong)ctx->data - (ulong)data );
   {
@@ -8916,6 +10287,7 @@ int fd_poh_config_decode_offsets( fd_poh_config_off_t * self, fd_bincode_decode_
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
+      *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, sizeof(ulong) );
       err = fd_bincode_uint64_decode_preflight( ctx );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
@@ -8990,21 +10362,33 @@ int fd_string_pubkey_pair_decode( fd_string_pubkey_pair_t * self, fd_bincode_dec
   fd_string_pubkey_pair_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_string_pubkey_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_string_pubkey_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   ulong string_len;
   err = fd_bincode_uint64_decode( &string_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( string_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, string_len );
     err = fd_bincode_bytes_decode_preflight( string_len, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     err = !fd_utf8_verify( (char const *) ctx->data - string_len, string_len );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   }
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_string_pubkey_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_string_pubkey_pair_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_string_pubkey_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_string_pubkey_pair_t);
+  int err = fd_string_pubkey_pair_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_string_pubkey_pair_decode_unsafe( fd_string_pubkey_pair_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->string_len, ctx );
   if( self->string_len ) {
@@ -9014,6 +10398,15 @@ void fd_string_pubkey_pair_decode_unsafe( fd_string_pubkey_pair_t * self, fd_bin
     self->string = NULL;
   fd_pubkey_decode_unsafe( &self->pubkey, ctx );
 }
+fd_string_pubkey_pair_t * fd_string_pubkey_pair_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_string_pubkey_pair_t * self = (fd_string_pubkey_pair_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_string_pubkey_pair_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_string_pubkey_pair_new( self );
+  fd_string_pubkey_pair_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_string_pubkey_pair_encode( fd_string_pubkey_pair_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->string_len, ctx );
@@ -9028,19 +10421,21 @@ int fd_string_pubkey_pair_encode( fd_string_pubkey_pair_t const * self, fd_binco
 }
 int fd_string_pubkey_pair_decode_offsets( fd_string_pubkey_pair_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->string_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong string_len;
   err = fd_bincode_uint64_decode( &string_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( string_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, string_len );
     err = fd_bincode_bytes_decode_preflight( string_len, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     err = !fd_utf8_verify( (char const *) ctx->data - string_len, string_len );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   }
   self->pubkey_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -9086,18 +10481,38 @@ int fd_pubkey_account_pair_decode( fd_pubkey_account_pair_t * self, fd_bincode_d
   fd_pubkey_account_pair_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_pubkey_account_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_pubkey_account_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_solana_account_decode_preflight( ctx );
+  err = fd_solana_account_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_pubkey_account_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_pubkey_account_pair_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_pubkey_account_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_pubkey_account_pair_t);
+  int err = fd_pubkey_account_pair_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_pubkey_account_pair_decode_unsafe( fd_pubkey_account_pair_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->key, ctx );
   fd_solana_account_decode_unsafe( &self->account, ctx );
 }
+fd_pubkey_account_pair_t * fd_pubkey_account_pair_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_pubkey_account_pair_t * self = (fd_pubkey_account_pair_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_pubkey_account_pair_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_pubkey_account_pair_new( self );
+  fd_pubkey_account_pair_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_pubkey_account_pair_encode( fd_pubkey_account_pair_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->key, ctx );
@@ -9108,12 +10523,13 @@ int fd_pubkey_account_pair_encode( fd_pubkey_account_pair_t const * self, fd_bin
 }
 int fd_pubkey_account_pair_decode_offsets( fd_pubkey_account_pair_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->key_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->account_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_solana_account_decode_preflight( ctx );
+  err = fd_solana_account_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -9154,7 +10570,7 @@ int fd_genesis_solana_decode( fd_genesis_solana_t * self, fd_bincode_decode_ctx_
   fd_genesis_solana_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_genesis_solana_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_genesis_solana_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -9162,8 +10578,9 @@ int fd_genesis_solana_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   err = fd_bincode_uint64_decode( &accounts_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( accounts_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_PUBKEY_ACCOUNT_PAIR_ALIGN, FD_PUBKEY_ACCOUNT_PAIR_FOOTPRINT*accounts_len );
     for( ulong i=0; i < accounts_len; i++ ) {
-      err = fd_pubkey_account_pair_decode_preflight( ctx );
+      err = fd_pubkey_account_pair_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -9171,8 +10588,9 @@ int fd_genesis_solana_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   err = fd_bincode_uint64_decode( &native_instruction_processors_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( native_instruction_processors_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_STRING_PUBKEY_PAIR_ALIGN, FD_STRING_PUBKEY_PAIR_FOOTPRINT*native_instruction_processors_len );
     for( ulong i=0; i < native_instruction_processors_len; i++ ) {
-      err = fd_string_pubkey_pair_decode_preflight( ctx );
+      err = fd_string_pubkey_pair_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -9180,8 +10598,9 @@ int fd_genesis_solana_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   err = fd_bincode_uint64_decode( &rewards_pools_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( rewards_pools_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_PUBKEY_ACCOUNT_PAIR_ALIGN, FD_PUBKEY_ACCOUNT_PAIR_FOOTPRINT*rewards_pools_len );
     for( ulong i=0; i < rewards_pools_len; i++ ) {
-      err = fd_pubkey_account_pair_decode_preflight( ctx );
+      err = fd_pubkey_account_pair_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -9189,22 +10608,33 @@ int fd_genesis_solana_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_poh_config_decode_preflight( ctx );
+  err = fd_poh_config_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_fee_rate_governor_decode_preflight( ctx );
+  err = fd_fee_rate_governor_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_rent_decode_preflight( ctx );
+  err = fd_rent_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_inflation_decode_preflight( ctx );
+  err = fd_inflation_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_epoch_schedule_decode_preflight( ctx );
+  err = fd_epoch_schedule_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint32_decode_preflight( ctx );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_genesis_solana_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_genesis_solana_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_genesis_solana_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_genesis_solana_t);
+  int err = fd_genesis_solana_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_genesis_solana_decode_unsafe( fd_genesis_solana_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->creation_time, ctx );
   fd_bincode_uint64_decode_unsafe( &self->accounts_len, ctx );
@@ -9244,6 +10674,15 @@ void fd_genesis_solana_decode_unsafe( fd_genesis_solana_t * self, fd_bincode_dec
   fd_epoch_schedule_decode_unsafe( &self->epoch_schedule, ctx );
   fd_bincode_uint32_decode_unsafe( &self->cluster_type, ctx );
 }
+fd_genesis_solana_t * fd_genesis_solana_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_genesis_solana_t * self = (fd_genesis_solana_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_genesis_solana_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_genesis_solana_new( self );
+  fd_genesis_solana_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_genesis_solana_encode( fd_genesis_solana_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->creation_time, ctx );
@@ -9294,6 +10733,7 @@ int fd_genesis_solana_encode( fd_genesis_solana_t const * self, fd_bincode_encod
 }
 int fd_genesis_solana_decode_offsets( fd_genesis_solana_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->creation_time_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -9303,8 +10743,9 @@ int fd_genesis_solana_decode_offsets( fd_genesis_solana_off_t * self, fd_bincode
   err = fd_bincode_uint64_decode( &accounts_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( accounts_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_PUBKEY_ACCOUNT_PAIR_ALIGN, FD_PUBKEY_ACCOUNT_PAIR_FOOTPRINT*accounts_len );
     for( ulong i=0; i < accounts_len; i++ ) {
-      err = fd_pubkey_account_pair_decode_preflight( ctx );
+      err = fd_pubkey_account_pair_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -9313,8 +10754,9 @@ int fd_genesis_solana_decode_offsets( fd_genesis_solana_off_t * self, fd_bincode
   err = fd_bincode_uint64_decode( &native_instruction_processors_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( native_instruction_processors_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_STRING_PUBKEY_PAIR_ALIGN, FD_STRING_PUBKEY_PAIR_FOOTPRINT*native_instruction_processors_len );
     for( ulong i=0; i < native_instruction_processors_len; i++ ) {
-      err = fd_string_pubkey_pair_decode_preflight( ctx );
+      err = fd_string_pubkey_pair_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -9323,8 +10765,9 @@ int fd_genesis_solana_decode_offsets( fd_genesis_solana_off_t * self, fd_bincode
   err = fd_bincode_uint64_decode( &rewards_pools_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( rewards_pools_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_PUBKEY_ACCOUNT_PAIR_ALIGN, FD_PUBKEY_ACCOUNT_PAIR_FOOTPRINT*rewards_pools_len );
     for( ulong i=0; i < rewards_pools_len; i++ ) {
-      err = fd_pubkey_account_pair_decode_preflight( ctx );
+      err = fd_pubkey_account_pair_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -9335,22 +10778,22 @@ int fd_genesis_solana_decode_offsets( fd_genesis_solana_off_t * self, fd_bincode
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->poh_config_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_poh_config_decode_preflight( ctx );
+  err = fd_poh_config_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->__backwards_compat_with_v0_23_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->fee_rate_governor_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_fee_rate_governor_decode_preflight( ctx );
+  err = fd_fee_rate_governor_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->rent_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_rent_decode_preflight( ctx );
+  err = fd_rent_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->inflation_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_inflation_decode_preflight( ctx );
+  err = fd_inflation_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->epoch_schedule_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_epoch_schedule_decode_preflight( ctx );
+  err = fd_epoch_schedule_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->cluster_type_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint32_decode_preflight( ctx );
@@ -9467,9 +10910,20 @@ int fd_sol_sysvar_clock_decode( fd_sol_sysvar_clock_t * self, fd_bincode_decode_
   fd_sol_sysvar_clock_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_sol_sysvar_clock_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_sol_sysvar_clock_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 40, ctx );
 }
+int fd_sol_sysvar_clock_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_sol_sysvar_clock_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_sol_sysvar_clock_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_sol_sysvar_clock_t);
+  int err = fd_sol_sysvar_clock_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_sol_sysvar_clock_decode_unsafe( fd_sol_sysvar_clock_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->slot, ctx );
   fd_bincode_uint64_decode_unsafe( (ulong *) &self->epoch_start_timestamp, ctx );
@@ -9477,6 +10931,15 @@ void fd_sol_sysvar_clock_decode_unsafe( fd_sol_sysvar_clock_t * self, fd_bincode
   fd_bincode_uint64_decode_unsafe( &self->leader_schedule_epoch, ctx );
   fd_bincode_uint64_decode_unsafe( (ulong *) &self->unix_timestamp, ctx );
 }
+fd_sol_sysvar_clock_t * fd_sol_sysvar_clock_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_sol_sysvar_clock_t * self = (fd_sol_sysvar_clock_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_sol_sysvar_clock_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_sol_sysvar_clock_new( self );
+  fd_sol_sysvar_clock_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_sol_sysvar_clock_encode( fd_sol_sysvar_clock_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->slot, ctx );
@@ -9493,6 +10956,7 @@ int fd_sol_sysvar_clock_encode( fd_sol_sysvar_clock_t const * self, fd_bincode_e
 }
 int fd_sol_sysvar_clock_decode_offsets( fd_sol_sysvar_clock_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->slot_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -9519,6 +10983,7 @@ void fd_sol_sysvar_clock_destroy( fd_sol_sysvar_clock_t * self, fd_bincode_destr
 
 ulong fd_sol_sysvar_clock_footprint( void ){ return FD_SOL_SYSVAR_CLOCK_FOOTPRINT; }
 ulong fd_sol_sysvar_clock_align( void ){ return FD_SOL_SYSVAR_CLOCK_ALIGN; }
+FD_STATIC_ASSERT( sizeof(fd_sol_sysvar_clock_t)==40UL, fd_sol_sysvar_clock_view );
 
 void fd_sol_sysvar_clock_walk( void * w, fd_sol_sysvar_clock_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_sol_sysvar_clock", level++ );
@@ -9550,12 +11015,32 @@ int fd_sol_sysvar_last_restart_slot_decode( fd_sol_sysvar_last_restart_slot_t *
   fd_sol_sysvar_last_restart_slot_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_sol_sysvar_last_restart_slot_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_sol_sysvar_last_restart_slot_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 8, ctx );
 }
+int fd_sol_sysvar_last_restart_slot_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_sol_sysvar_last_restart_slot_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_sol_sysvar_last_restart_slot_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_sol_sysvar_last_restart_slot_t);
+  int err = fd_sol_sysvar_last_restart_slot_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_sol_sysvar_last_restart_slot_decode_unsafe( fd_sol_sysvar_last_restart_slot_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->slot, ctx );
 }
+fd_sol_sysvar_last_restart_slot_t * fd_sol_sysvar_last_restart_slot_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_sol_sysvar_last_restart_slot_t * self = (fd_sol_sysvar_last_restart_slot_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_sol_sysvar_last_restart_slot_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_sol_sysvar_last_restart_slot_new( self );
+  fd_sol_sysvar_last_restart_slot_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_sol_sysvar_last_restart_slot_encode( fd_sol_sysvar_last_restart_slot_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->slot, ctx );
@@ -9628,6 +11113,7 @@ int fd_sol_sysvar_last_restart_slot_encode_archival( fd_sol_sysvar_last_restart_
 }
 int fd_sol_sysvar_last_restart_slot_decode_offsets( fd_sol_sysvar_last_restart_slot_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->slot_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -9642,6 +11128,7 @@ void fd_sol_sysvar_last_restart_slot_destroy( fd_sol_sysvar_last_restart_slot_t
 
 ulong fd_sol_sysvar_last_restart_slot_footprint( void ){ return FD_SOL_SYSVAR_LAST_RESTART_SLOT_FOOTPRINT; }
 ulong fd_sol_sysvar_last_restart_slot_align( void ){ return FD_SOL_SYSVAR_LAST_RESTART_SLOT_ALIGN; }
+FD_STATIC_ASSERT( sizeof(fd_sol_sysvar_last_restart_slot_t)==8UL, fd_sol_sysvar_last_restart_slot_view );
 
 void fd_sol_sysvar_last_restart_slot_walk( void * w, fd_sol_sysvar_last_restart_slot_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_sol_sysvar_last_restart_slot", level++ );
@@ -9665,13 +11152,33 @@ int fd_vote_lockout_decode( fd_vote_lockout_t * self, fd_bincode_decode_ctx_t *
   fd_vote_lockout_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_vote_lockout_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_vote_lockout_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 12, ctx );
 }
+int fd_vote_lockout_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_vote_lockout_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_vote_lockout_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_vote_lockout_t);
+  int err = fd_vote_lockout_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_vote_lockout_decode_unsafe( fd_vote_lockout_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->slot, ctx );
   fd_bincode_uint32_decode_unsafe( &self->confirmation_count, ctx );
 }
+fd_vote_lockout_t * fd_vote_lockout_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_vote_lockout_t * self = (fd_vote_lockout_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_vote_lockout_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_vote_lockout_new( self );
+  fd_vote_lockout_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_vote_lockout_encode( fd_vote_lockout_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->slot, ctx );
@@ -9682,6 +11189,7 @@ int fd_vote_lockout_encode( fd_vote_lockout_t const * self, fd_bincode_encode_ct
 }
 int fd_vote_lockout_decode_offsets( fd_vote_lockout_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->slot_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -9724,7 +11232,7 @@ int fd_lockout_offset_decode( fd_lockout_offset_t * self, fd_bincode_decode_ctx_
   fd_lockout_offset_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_lockout_offset_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_lockout_offset_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   err = fd_bincode_varint_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -9732,10 +11240,30 @@ int fd_lockout_offset_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_lockout_offset_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_lockout_offset_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_lockout_offset_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_lockout_offset_t);
+  int err = fd_lockout_offset_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_lockout_offset_decode_unsafe( fd_lockout_offset_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_varint_decode_unsafe( &self->offset, ctx );
   fd_bincode_uint8_decode_unsafe( &self->confirmation_count, ctx );
 }
+fd_lockout_offset_t * fd_lockout_offset_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_lockout_offset_t * self = (fd_lockout_offset_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_lockout_offset_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_lockout_offset_new( self );
+  fd_lockout_offset_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_lockout_offset_encode( fd_lockout_offset_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_varint_encode( self->offset, ctx );
@@ -9746,6 +11274,7 @@ int fd_lockout_offset_encode( fd_lockout_offset_t const * self, fd_bincode_encod
 }
 int fd_lockout_offset_decode_offsets( fd_lockout_offset_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->offset_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_varint_decode_preflight( ctx );
@@ -9788,13 +11317,33 @@ int fd_vote_authorized_voter_decode( fd_vote_authorized_voter_t * self, fd_binco
   fd_vote_authorized_voter_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_vote_authorized_voter_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_vote_authorized_voter_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 40, ctx );
 }
+int fd_vote_authorized_voter_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_vote_authorized_voter_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_vote_authorized_voter_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_vote_authorized_voter_t);
+  int err = fd_vote_authorized_voter_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_vote_authorized_voter_decode_unsafe( fd_vote_authorized_voter_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->epoch, ctx );
   fd_pubkey_decode_unsafe( &self->pubkey, ctx );
 }
+fd_vote_authorized_voter_t * fd_vote_authorized_voter_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_vote_authorized_voter_t * self = (fd_vote_authorized_voter_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_vote_authorized_voter_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_vote_authorized_voter_new( self );
+  fd_vote_authorized_voter_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_vote_authorized_voter_encode( fd_vote_authorized_voter_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->epoch, ctx );
@@ -9805,12 +11354,13 @@ int fd_vote_authorized_voter_encode( fd_vote_authorized_voter_t const * self, fd
 }
 int fd_vote_authorized_voter_decode_offsets( fd_vote_authorized_voter_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->epoch_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->pubkey_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->parent_off = (uint)( (ulong)ctx->data - (ulong)data );
   self->left_off = (uint)( (ulong)ctx->data - (ulong)data );
@@ -9853,14 +11403,34 @@ int fd_vote_prior_voter_decode( fd_vote_prior_voter_t * self, fd_bincode_decode_
   fd_vote_prior_voter_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_vote_prior_voter_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_vote_prior_voter_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 48, ctx );
 }
+int fd_vote_prior_voter_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_vote_prior_voter_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_vote_prior_voter_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_vote_prior_voter_t);
+  int err = fd_vote_prior_voter_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_vote_prior_voter_decode_unsafe( fd_vote_prior_voter_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->pubkey, ctx );
   fd_bincode_uint64_decode_unsafe( &self->epoch_start, ctx );
   fd_bincode_uint64_decode_unsafe( &self->epoch_end, ctx );
 }
+fd_vote_prior_voter_t * fd_vote_prior_voter_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_vote_prior_voter_t * self = (fd_vote_prior_voter_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_vote_prior_voter_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_vote_prior_voter_new( self );
+  fd_vote_prior_voter_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_vote_prior_voter_encode( fd_vote_prior_voter_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->pubkey, ctx );
@@ -9873,9 +11443,10 @@ int fd_vote_prior_voter_encode( fd_vote_prior_voter_t const * self, fd_bincode_e
 }
 int fd_vote_prior_voter_decode_offsets( fd_vote_prior_voter_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->pubkey_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->epoch_start_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -9895,6 +11466,7 @@ void fd_vote_prior_voter_destroy( fd_vote_prior_voter_t * self, fd_bincode_destr
 
 ulong fd_vote_prior_voter_footprint( void ){ return FD_VOTE_PRIOR_VOTER_FOOTPRINT; }
 ulong fd_vote_prior_voter_align( void ){ return FD_VOTE_PRIOR_VOTER_ALIGN; }
+FD_STATIC_ASSERT( sizeof(fd_vote_prior_voter_t)==48UL, fd_vote_prior_voter_view );
 
 void fd_vote_prior_voter_walk( void * w, fd_vote_prior_voter_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_vote_prior_voter", level++ );
@@ -9922,15 +11494,35 @@ int fd_vote_prior_voter_0_23_5_decode( fd_vote_prior_voter_0_23_5_t * self, fd_b
   fd_vote_prior_voter_0_23_5_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_vote_prior_voter_0_23_5_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_vote_prior_voter_0_23_5_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 56, ctx );
 }
+int fd_vote_prior_voter_0_23_5_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_vote_prior_voter_0_23_5_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_vote_prior_voter_0_23_5_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_vote_prior_voter_0_23_5_t);
+  int err = fd_vote_prior_voter_0_23_5_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_vote_prior_voter_0_23_5_decode_unsafe( fd_vote_prior_voter_0_23_5_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->pubkey, ctx );
   fd_bincode_uint64_decode_unsafe( &self->epoch_start, ctx );
   fd_bincode_uint64_decode_unsafe( &self->epoch_end, ctx );
   fd_bincode_uint64_decode_unsafe( &self->slot, ctx );
 }
+fd_vote_prior_voter_0_23_5_t * fd_vote_prior_voter_0_23_5_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_vote_prior_voter_0_23_5_t * self = (fd_vote_prior_voter_0_23_5_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_vote_prior_voter_0_23_5_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_vote_prior_voter_0_23_5_new( self );
+  fd_vote_prior_voter_0_23_5_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_vote_prior_voter_0_23_5_encode( fd_vote_prior_voter_0_23_5_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->pubkey, ctx );
@@ -9945,9 +11537,10 @@ int fd_vote_prior_voter_0_23_5_encode( fd_vote_prior_voter_0_23_5_t const * self
 }
 int fd_vote_prior_voter_0_23_5_decode_offsets( fd_vote_prior_voter_0_23_5_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->pubkey_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->epoch_start_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -9970,6 +11563,7 @@ void fd_vote_prior_voter_0_23_5_destroy( fd_vote_prior_voter_0_23_5_t * self, fd
 
 ulong fd_vote_prior_voter_0_23_5_footprint( void ){ return FD_VOTE_PRIOR_VOTER_0_23_5_FOOTPRINT; }
 ulong fd_vote_prior_voter_0_23_5_align( void ){ return FD_VOTE_PRIOR_VOTER_0_23_5_ALIGN; }
+FD_STATIC_ASSERT( sizeof(fd_vote_prior_voter_0_23_5_t)==56UL, fd_vote_prior_voter_0_23_5_view );
 
 void fd_vote_prior_voter_0_23_5_walk( void * w, fd_vote_prior_voter_0_23_5_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_vote_prior_voter_0_23_5", level++ );
@@ -9999,14 +11593,34 @@ int fd_vote_epoch_credits_decode( fd_vote_epoch_credits_t * self, fd_bincode_dec
   fd_vote_epoch_credits_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_vote_epoch_credits_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_vote_epoch_credits_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 24, ctx );
 }
+int fd_vote_epoch_credits_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_vote_epoch_credits_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_vote_epoch_credits_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_vote_epoch_credits_t);
+  int err = fd_vote_epoch_credits_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_vote_epoch_credits_decode_unsafe( fd_vote_epoch_credits_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->epoch, ctx );
   fd_bincode_uint64_decode_unsafe( &self->credits, ctx );
   fd_bincode_uint64_decode_unsafe( &self->prev_credits, ctx );
 }
+fd_vote_epoch_credits_t * fd_vote_epoch_credits_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_vote_epoch_credits_t * self = (fd_vote_epoch_credits_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_vote_epoch_credits_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_vote_epoch_credits_new( self );
+  fd_vote_epoch_credits_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_vote_epoch_credits_encode( fd_vote_epoch_credits_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->epoch, ctx );
@@ -10019,6 +11633,7 @@ int fd_vote_epoch_credits_encode( fd_vote_epoch_credits_t const * self, fd_binco
 }
 int fd_vote_epoch_credits_decode_offsets( fd_vote_epoch_credits_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->epoch_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -10039,6 +11654,7 @@ void fd_vote_epoch_credits_destroy( fd_vote_epoch_credits_t * self, fd_bincode_d
 
 ulong fd_vote_epoch_credits_footprint( void ){ return FD_VOTE_EPOCH_CREDITS_FOOTPRINT; }
 ulong fd_vote_epoch_credits_align( void ){ return FD_VOTE_EPOCH_CREDITS_ALIGN; }
+FD_STATIC_ASSERT( sizeof(fd_vote_epoch_credits_t)==24UL, fd_vote_epoch_credits_view );
 
 void fd_vote_epoch_credits_walk( void * w, fd_vote_epoch_credits_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_vote_epoch_credits", level++ );
@@ -10066,13 +11682,33 @@ int fd_vote_block_timestamp_decode( fd_vote_block_timestamp_t * self, fd_bincode
   fd_vote_block_timestamp_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_vote_block_timestamp_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_vote_block_timestamp_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 16, ctx );
 }
+int fd_vote_block_timestamp_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_vote_block_timestamp_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_vote_block_timestamp_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_vote_block_timestamp_t);
+  int err = fd_vote_block_timestamp_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_vote_block_timestamp_decode_unsafe( fd_vote_block_timestamp_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->slot, ctx );
   fd_bincode_uint64_decode_unsafe( (ulong *) &self->timestamp, ctx );
 }
+fd_vote_block_timestamp_t * fd_vote_block_timestamp_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_vote_block_timestamp_t * self = (fd_vote_block_timestamp_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_vote_block_timestamp_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_vote_block_timestamp_new( self );
+  fd_vote_block_timestamp_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_vote_block_timestamp_encode( fd_vote_block_timestamp_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->slot, ctx );
@@ -10083,6 +11719,7 @@ int fd_vote_block_timestamp_encode( fd_vote_block_timestamp_t const * self, fd_b
 }
 int fd_vote_block_timestamp_decode_offsets( fd_vote_block_timestamp_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->slot_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -10100,6 +11737,7 @@ void fd_vote_block_timestamp_destroy( fd_vote_block_timestamp_t * self, fd_binco
 
 ulong fd_vote_block_timestamp_footprint( void ){ return FD_VOTE_BLOCK_TIMESTAMP_FOOTPRINT; }
 ulong fd_vote_block_timestamp_align( void ){ return FD_VOTE_BLOCK_TIMESTAMP_ALIGN; }
+FD_STATIC_ASSERT( sizeof(fd_vote_block_timestamp_t)==16UL, fd_vote_block_timestamp_view );
 
 void fd_vote_block_timestamp_walk( void * w, fd_vote_block_timestamp_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_vote_block_timestamp", level++ );
@@ -10125,10 +11763,10 @@ int fd_vote_prior_voters_decode( fd_vote_prior_voters_t * self, fd_bincode_decod
   fd_vote_prior_voters_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_vote_prior_voters_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_vote_prior_voters_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   for( ulong i=0; i<32; i++ ) {
-    err = fd_vote_prior_voter_decode_preflight( ctx );
+    err = fd_vote_prior_voter_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   }
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -10137,6 +11775,17 @@ int fd_vote_prior_voters_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_vote_prior_voters_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_vote_prior_voters_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_vote_prior_voters_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_vote_prior_voters_t);
+  int err = fd_vote_prior_voters_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_vote_prior_voters_decode_unsafe( fd_vote_prior_voters_t * self, fd_bincode_decode_ctx_t * ctx ) {
   for( ulong i=0; i<32; i++ ) {
     fd_vote_prior_voter_decode_unsafe( self->buf + i, ctx );
@@ -10144,6 +11793,15 @@ void fd_vote_prior_voters_decode_unsafe( fd_vote_prior_voters_t * self, fd_binco
   fd_bincode_uint64_decode_unsafe( &self->idx, ctx );
   fd_bincode_bool_decode_unsafe( &self->is_empty, ctx );
 }
+fd_vote_prior_voters_t * fd_vote_prior_voters_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_vote_prior_voters_t * self = (fd_vote_prior_voters_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_vote_prior_voters_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_vote_prior_voters_new( self );
+  fd_vote_prior_voters_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_vote_prior_voters_encode( fd_vote_prior_voters_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   for( ulong i=0; i<32; i++ ) {
@@ -10158,10 +11816,11 @@ int fd_vote_prior_voters_encode( fd_vote_prior_voters_t const * self, fd_bincode
 }
 int fd_vote_prior_voters_decode_offsets( fd_vote_prior_voters_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->buf_off = (uint)( (ulong)ctx->data - (ulong)data );
   for( ulong i=0; i<32; i++ ) {
-    err = fd_vote_prior_voter_decode_preflight( ctx );
+    err = fd_vote_prior_voter_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   }
   self->idx_off = (uint)( (ulong)ctx->data - (ulong)data );
@@ -10215,15 +11874,35 @@ int fd_vote_prior_voters_0_23_5_decode( fd_vote_prior_voters_0_23_5_t * self, fd
   fd_vote_prior_voters_0_23_5_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_vote_prior_voters_0_23_5_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_vote_prior_voters_0_23_5_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 1800, ctx );
 }
+int fd_vote_prior_voters_0_23_5_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_vote_prior_voters_0_23_5_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_vote_prior_voters_0_23_5_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_vote_prior_voters_0_23_5_t);
+  int err = fd_vote_prior_voters_0_23_5_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_vote_prior_voters_0_23_5_decode_unsafe( fd_vote_prior_voters_0_23_5_t * self, fd_bincode_decode_ctx_t * ctx ) {
   for( ulong i=0; i<32; i++ ) {
     fd_vote_prior_voter_0_23_5_decode_unsafe( self->buf + i, ctx );
   }
   fd_bincode_uint64_decode_unsafe( &self->idx, ctx );
 }
+fd_vote_prior_voters_0_23_5_t * fd_vote_prior_voters_0_23_5_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_vote_prior_voters_0_23_5_t * self = (fd_vote_prior_voters_0_23_5_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_vote_prior_voters_0_23_5_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_vote_prior_voters_0_23_5_new( self );
+  fd_vote_prior_voters_0_23_5_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_vote_prior_voters_0_23_5_encode( fd_vote_prior_voters_0_23_5_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   for( ulong i=0; i<32; i++ ) {
@@ -10236,10 +11915,11 @@ int fd_vote_prior_voters_0_23_5_encode( fd_vote_prior_voters_0_23_5_t const * se
 }
 int fd_vote_prior_voters_0_23_5_decode_offsets( fd_vote_prior_voters_0_23_5_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->buf_off = (uint)( (ulong)ctx->data - (ulong)data );
   for( ulong i=0; i<32; i++ ) {
-    err = fd_vote_prior_voter_0_23_5_decode_preflight( ctx );
+    err = fd_vote_prior_voter_0_23_5_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   }
   self->idx_off = (uint)( (ulong)ctx->data - (ulong)data );
@@ -10259,6 +11939,7 @@ void fd_vote_prior_voters_0_23_5_destroy( fd_vote_prior_voters_0_23_5_t * self,
 
 ulong fd_vote_prior_voters_0_23_5_footprint( void ){ return FD_VOTE_PRIOR_VOTERS_0_23_5_FOOTPRINT; }
 ulong fd_vote_prior_voters_0_23_5_align( void ){ return FD_VOTE_PRIOR_VOTERS_0_23_5_ALIGN; }
+FD_STATIC_ASSERT( sizeof(fd_vote_prior_voters_0_23_5_t)==1800UL, fd_vote_prior_voters_0_23_5_view );
 
 void fd_vote_prior_voters_0_23_5_walk( void * w, fd_vote_prior_voters_0_23_5_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_vote_prior_voters_0_23_5", level++ );
@@ -10288,13 +11969,33 @@ int fd_landed_vote_decode( fd_landed_vote_t * self, fd_bincode_decode_ctx_t * ct
   fd_landed_vote_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_landed_vote_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_landed_vote_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 13, ctx );
 }
+int fd_landed_vote_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_landed_vote_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_landed_vote_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_landed_vote_t);
+  int err = fd_landed_vote_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_landed_vote_decode_unsafe( fd_landed_vote_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint8_decode_unsafe( &self->latency, ctx );
   fd_vote_lockout_decode_unsafe( &self->lockout, ctx );
 }
+fd_landed_vote_t * fd_landed_vote_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_landed_vote_t * self = (fd_landed_vote_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_landed_vote_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_landed_vote_new( self );
+  fd_landed_vote_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_landed_vote_encode( fd_landed_vote_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint8_encode( (uchar)(self->latency), ctx );
@@ -10305,12 +12006,13 @@ int fd_landed_vote_encode( fd_landed_vote_t const * self, fd_bincode_encode_ctx_
 }
 int fd_landed_vote_decode_offsets( fd_landed_vote_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->latency_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint8_decode_preflight( ctx );
   if( FD_UNLIKELY( err ) ) return err;
   self->lockout_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_vote_lockout_decode_preflight( ctx );
+  err = fd_vote_lockout_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -10349,23 +12051,24 @@ int fd_vote_state_0_23_5_decode( fd_vote_state_0_23_5_t * self, fd_bincode_decod
   fd_vote_state_0_23_5_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_vote_state_0_23_5_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_vote_state_0_23_5_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_vote_prior_voters_0_23_5_decode_preflight( ctx );
+  err = fd_vote_prior_voters_0_23_5_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint8_decode_preflight( ctx );
   if( FD_UNLIKELY( err ) ) return err;
   ulong votes_len;
   err = fd_bincode_uint64_decode( &votes_len, ctx );
   if( FD_UNLIKELY( err ) ) return err;
+  *total_sz = fd_bincode_footprint_alloc( *total_sz, deq_fd_vote_lockout_t_align(), deq_fd_vote_lockout_t_footprint( fd_ulong_max( votes_len, 32 ) ) );
   ulong votes_sz;
   if( FD_UNLIKELY( __builtin_umull_overflow( votes_len, 12, &votes_sz ) ) ) return FD_BINCODE_ERR_UNDERFLOW;
   err = fd_bincode_bytes_decode_preflight( votes_sz, ctx );
@@ -10382,14 +12085,26 @@ int fd_vote_state_0_23_5_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   ulong epoch_credits_len;
   err = fd_bincode_uint64_decode( &epoch_credits_len, ctx );
   if( FD_UNLIKELY( err ) ) return err;
+  *total_sz = fd_bincode_footprint_alloc( *total_sz, deq_fd_vote_epoch_credits_t_align(), deq_fd_vote_epoch_credits_t_footprint( fd_ulong_max( epoch_credits_len, 64 ) ) );
   ulong epoch_credits_sz;
   if( FD_UNLIKELY( __builtin_umull_overflow( epoch_credits_len, 24, &epoch_credits_sz ) ) ) return FD_BINCODE_ERR_UNDERFLOW;
   err = fd_bincode_bytes_decode_preflight( epoch_credits_sz, ctx );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_vote_block_timestamp_decode_preflight( ctx );
+  err = fd_vote_block_timestamp_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_vote_state_0_23_5_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_vote_state_0_23_5_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_vote_state_0_23_5_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_vote_state_0_23_5_t);
+  int err = fd_vote_state_0_23_5_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_vote_state_0_23_5_decode_unsafe( fd_vote_state_0_23_5_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->node_pubkey, ctx );
   fd_pubkey_decode_unsafe( &self->authorized_voter, ctx );
@@ -10425,6 +12140,15 @@ void fd_vote_state_0_23_5_decode_unsafe( fd_vote_state_0_23_5_t * self, fd_binco
   }
   fd_vote_block_timestamp_decode_unsafe( &self->last_timestamp, ctx );
 }
+fd_vote_state_0_23_5_t * fd_vote_state_0_23_5_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_vote_state_0_23_5_t * self = (fd_vote_state_0_23_5_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_vote_state_0_23_5_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_vote_state_0_23_5_new( self );
+  fd_vote_state_0_23_5_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_vote_state_0_23_5_encode( fd_vote_state_0_23_5_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->node_pubkey, ctx );
@@ -10479,21 +12203,22 @@ int fd_vote_state_0_23_5_encode( fd_vote_state_0_23_5_t const * self, fd_bincode
 }
 int fd_vote_state_0_23_5_decode_offsets( fd_vote_state_0_23_5_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->node_pubkey_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->authorized_voter_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->authorized_voter_epoch_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->prior_voters_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_vote_prior_voters_0_23_5_decode_preflight( ctx );
+  err = fd_vote_prior_voters_0_23_5_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->authorized_withdrawer_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->commission_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint8_decode_preflight( ctx );
@@ -10502,6 +12227,7 @@ int fd_vote_state_0_23_5_decode_offsets( fd_vote_state_0_23_5_off_t * self, fd_b
   ulong votes_len;
   err = fd_bincode_uint64_decode( &votes_len, ctx );
   if( FD_UNLIKELY( err ) ) return err;
+  *total_sz = fd_bincode_footprint_alloc( *total_sz, deq_fd_vote_lockout_t_align(), deq_fd_vote_lockout_t_footprint( fd_ulong_max( votes_len, 32 ) ) );
   ulong votes_sz;
   if( FD_UNLIKELY( __builtin_umull_overflow( votes_len, 12, &votes_sz ) ) ) return FD_BINCODE_ERR_UNDERFLOW;
   err = fd_bincode_bytes_decode_preflight( votes_sz, ctx );
@@ -10520,12 +12246,13 @@ int fd_vote_state_0_23_5_decode_offsets( fd_vote_state_0_23_5_off_t * self, fd_b
   ulong epoch_credits_len;
   err = fd_bincode_uint64_decode( &epoch_credits_len, ctx );
   if( FD_UNLIKELY( err ) ) return err;
+  *total_sz = fd_bincode_footprint_alloc( *total_sz, deq_fd_vote_epoch_credits_t_align(), deq_fd_vote_epoch_credits_t_footprint( fd_ulong_max( epoch_credits_len, 64 ) ) );
   ulong epoch_credits_sz;
   if( FD_UNLIKELY( __builtin_umull_overflow( epoch_credits_len, 24, &epoch_credits_sz ) ) ) return FD_BINCODE_ERR_UNDERFLOW;
   err = fd_bincode_bytes_decode_preflight( epoch_credits_sz, ctx );
   if( FD_UNLIKELY( err ) ) return err;
   self->last_timestamp_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_vote_block_timestamp_decode_preflight( ctx );
+  err = fd_vote_block_timestamp_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -10656,17 +12383,31 @@ int fd_vote_authorized_voters_decode( fd_vote_authorized_voters_t * self, fd_bin
   fd_vote_authorized_voters_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_vote_authorized_voters_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_vote_authorized_voters_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   ulong fd_vote_authorized_voters_treap_len;
   err = fd_bincode_uint64_decode( &fd_vote_authorized_voters_treap_len, ctx );
   if( FD_UNLIKELY( err ) ) return err;
+  ulong fd_vote_authorized_voters_treap_max = fd_ulong_max( fd_ulong_max( fd_vote_authorized_voters_treap_len, FD_VOTE_AUTHORIZED_VOTERS_MIN ), 1UL );
+  *total_sz = fd_bincode_footprint_alloc( *total_sz, fd_vote_authorized_voters_pool_align(), fd_vote_authorized_voters_pool_footprint( fd_vote_authorized_voters_treap_max ) );
+  *total_sz = fd_bincode_footprint_alloc( *total_sz, fd_vote_authorized_voters_treap_align(), fd_vote_authorized_voters_treap_footprint( fd_vote_authorized_voters_treap_max ) );
   for( ulong i=0; i < fd_vote_authorized_voters_treap_len; i++ ) {
-    err = fd_vote_authorized_voter_decode_preflight( ctx );
+    err = fd_vote_authorized_voter_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY ( err ) ) return err;
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_vote_authorized_voters_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_vote_authorized_voters_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_vote_authorized_voters_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_vote_authorized_voters_t);
+  int err = fd_vote_authorized_voters_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_vote_authorized_voters_decode_unsafe( fd_vote_authorized_voters_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_destroy_ctx_t destroy_ctx = { .valloc = ctx->valloc };
   ulong fd_vote_authorized_voters_treap_len;
@@ -10689,6 +12430,15 @@ void fd_vote_authorized_voters_decode_unsafe( fd_vote_authorized_voters_t * self
     fd_vote_authorized_voters_treap_ele_insert( self->treap, ele, self->pool ); /* this cannot fail */
   }
 }
+fd_vote_authorized_voters_t * fd_vote_authorized_voters_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_vote_authorized_voters_t * self = (fd_vote_authorized_voters_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_vote_authorized_voters_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_vote_authorized_voters_new( self );
+  fd_vote_authorized_voters_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_vote_authorized_voters_encode( fd_vote_authorized_voters_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   if( self->treap ) {
@@ -10711,13 +12461,17 @@ int fd_vote_authorized_voters_encode( fd_vote_authorized_voters_t const * self,
 }
 int fd_vote_authorized_voters_decode_offsets( fd_vote_authorized_voters_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->fd_vote_authorized_voters_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong fd_vote_authorized_voters_treap_len;
   err = fd_bincode_uint64_decode( &fd_vote_authorized_voters_treap_len, ctx );
   if( FD_UNLIKELY( err ) ) return err;
+  ulong fd_vote_authorized_voters_treap_max = fd_ulong_max( fd_ulong_max( fd_vote_authorized_voters_treap_len, FD_VOTE_AUTHORIZED_VOTERS_MIN ), 1UL );
+  *total_sz = fd_bincode_footprint_alloc( *total_sz, fd_vote_authorized_voters_pool_align(), fd_vote_authorized_voters_pool_footprint( fd_vote_authorized_voters_treap_max ) );
+  *total_sz = fd_bincode_footprint_alloc( *total_sz, fd_vote_authorized_voters_treap_align(), fd_vote_authorized_voters_treap_footprint( fd_vote_authorized_voters_treap_max ) );
   for( ulong i=0; i < fd_vote_authorized_voters_treap_len; i++ ) {
-    err = fd_vote_authorized_voter_decode_preflight( ctx );
+    err = fd_vote_authorized_voter_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY ( err ) ) return err;
   }
   return FD_BINCODE_SUCCESS;
@@ -10779,17 +12533,18 @@ int fd_vote_state_1_14_11_decode( fd_vote_state_1_14_11_t * self, fd_bincode_dec
   fd_vote_state_1_14_11_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_vote_state_1_14_11_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_vote_state_1_14_11_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint8_decode_preflight( ctx );
   if( FD_UNLIKELY( err ) ) return err;
   ulong votes_len;
   err = fd_bincode_uint64_decode( &votes_len, ctx );
   if( FD_UNLIKELY( err ) ) return err;
+  *total_sz = fd_bincode_footprint_alloc( *total_sz, deq_fd_vote_lockout_t_align(), deq_fd_vote_lockout_t_footprint( fd_ulong_max( votes_len, 32 ) ) );
   ulong votes_sz;
   if( FD_UNLIKELY( __builtin_umull_overflow( votes_len, 12, &votes_sz ) ) ) return FD_BINCODE_ERR_UNDERFLOW;
   err = fd_bincode_bytes_decode_preflight( votes_sz, ctx );
@@ -10803,21 +12558,33 @@ int fd_vote_state_1_14_11_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
-  err = fd_vote_authorized_voters_decode_preflight( ctx );
+  err = fd_vote_authorized_voters_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_vote_prior_voters_decode_preflight( ctx );
+  err = fd_vote_prior_voters_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   ulong epoch_credits_len;
   err = fd_bincode_uint64_decode( &epoch_credits_len, ctx );
   if( FD_UNLIKELY( err ) ) return err;
+  *total_sz = fd_bincode_footprint_alloc( *total_sz, deq_fd_vote_epoch_credits_t_align(), deq_fd_vote_epoch_credits_t_footprint( fd_ulong_max( epoch_credits_len, 64 ) ) );
   ulong epoch_credits_sz;
   if( FD_UNLIKELY( __builtin_umull_overflow( epoch_credits_len, 24, &epoch_credits_sz ) ) ) return FD_BINCODE_ERR_UNDERFLOW;
   err = fd_bincode_bytes_decode_preflight( epoch_credits_sz, ctx );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_vote_block_timestamp_decode_preflight( ctx );
+  err = fd_vote_block_timestamp_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_vote_state_1_14_11_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_vote_state_1_14_11_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_vote_state_1_14_11_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_vote_state_1_14_11_t);
+  int err = fd_vote_state_1_14_11_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_vote_state_1_14_11_decode_unsafe( fd_vote_state_1_14_11_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->node_pubkey, ctx );
   fd_pubkey_decode_unsafe( &self->authorized_withdrawer, ctx );
@@ -10852,6 +12619,15 @@ void fd_vote_state_1_14_11_decode_unsafe( fd_vote_state_1_14_11_t * self, fd_bin
   }
   fd_vote_block_timestamp_decode_unsafe( &self->last_timestamp, ctx );
 }
+fd_vote_state_1_14_11_t * fd_vote_state_1_14_11_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_vote_state_1_14_11_t * self = (fd_vote_state_1_14_11_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_vote_state_1_14_11_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_vote_state_1_14_11_new( self );
+  fd_vote_state_1_14_11_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_vote_state_1_14_11_encode( fd_vote_state_1_14_11_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->node_pubkey, ctx );
@@ -10904,12 +12680,13 @@ int fd_vote_state_1_14_11_encode( fd_vote_state_1_14_11_t const * self, fd_binco
 }
 int fd_vote_state_1_14_11_decode_offsets( fd_vote_state_1_14_11_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->node_pubkey_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->authorized_withdrawer_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->commission_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint8_decode_preflight( ctx );
@@ -10918,6 +12695,7 @@ int fd_vote_state_1_14_11_decode_offsets( fd_vote_state_1_14_11_off_t * self, fd
   ulong votes_len;
   err = fd_bincode_uint64_decode( &votes_len, ctx );
   if( FD_UNLIKELY( err ) ) return err;
+  *total_sz = fd_bincode_footprint_alloc( *total_sz, deq_fd_vote_lockout_t_align(), deq_fd_vote_lockout_t_footprint( fd_ulong_max( votes_len, 32 ) ) );
   ulong votes_sz;
   if( FD_UNLIKELY( __builtin_umull_overflow( votes_len, 12, &votes_sz ) ) ) return FD_BINCODE_ERR_UNDERFLOW;
   err = fd_bincode_bytes_decode_preflight( votes_sz, ctx );
@@ -10933,21 +12711,22 @@ int fd_vote_state_1_14_11_decode_offsets( fd_vote_state_1_14_11_off_t * self, fd
     }
   }
   self->authorized_voters_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_vote_authorized_voters_decode_preflight( ctx );
+  err = fd_vote_authorized_voters_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->prior_voters_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_vote_prior_voters_decode_preflight( ctx );
+  err = fd_vote_prior_voters_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->epoch_credits_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong epoch_credits_len;
   err = fd_bincode_uint64_decode( &epoch_credits_len, ctx );
   if( FD_UNLIKELY( err ) ) return err;
+  *total_sz = fd_bincode_footprint_alloc( *total_sz, deq_fd_vote_epoch_credits_t_align(), deq_fd_vote_epoch_credits_t_footprint( fd_ulong_max( epoch_credits_len, 64 ) ) );
   ulong epoch_credits_sz;
   if( FD_UNLIKELY( __builtin_umull_overflow( epoch_credits_len, 24, &epoch_credits_sz ) ) ) return FD_BINCODE_ERR_UNDERFLOW;
   err = fd_bincode_bytes_decode_preflight( epoch_credits_sz, ctx );
   if( FD_UNLIKELY( err ) ) return err;
   self->last_timestamp_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_vote_block_timestamp_decode_preflight( ctx );
+  err = fd_vote_block_timestamp_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -11076,17 +12855,18 @@ int fd_vote_state_decode( fd_vote_state_t * self, fd_bincode_decode_ctx_t * ctx
   fd_vote_state_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_vote_state_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_vote_state_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint8_decode_preflight( ctx );
   if( FD_UNLIKELY( err ) ) return err;
   ulong votes_len;
   err = fd_bincode_uint64_decode( &votes_len, ctx );
   if( FD_UNLIKELY( err ) ) return err;
+  *total_sz = fd_bincode_footprint_alloc( *total_sz, deq_fd_landed_vote_t_align(), deq_fd_landed_vote_t_footprint( fd_ulong_max( votes_len, 32 ) ) );
   ulong votes_sz;
   if( FD_UNLIKELY( __builtin_umull_overflow( votes_len, 13, &votes_sz ) ) ) return FD_BINCODE_ERR_UNDERFLOW;
   err = fd_bincode_bytes_decode_preflight( votes_sz, ctx );
@@ -11100,21 +12880,33 @@ int fd_vote_state_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
-  err = fd_vote_authorized_voters_decode_preflight( ctx );
+  err = fd_vote_authorized_voters_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_vote_prior_voters_decode_preflight( ctx );
+  err = fd_vote_prior_voters_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   ulong epoch_credits_len;
   err = fd_bincode_uint64_decode( &epoch_credits_len, ctx );
   if( FD_UNLIKELY( err ) ) return err;
+  *total_sz = fd_bincode_footprint_alloc( *total_sz, deq_fd_vote_epoch_credits_t_align(), deq_fd_vote_epoch_credits_t_footprint( fd_ulong_max( epoch_credits_len, 64 ) ) );
   ulong epoch_credits_sz;
   if( FD_UNLIKELY( __builtin_umull_overflow( epoch_credits_len, 24, &epoch_credits_sz ) ) ) return FD_BINCODE_ERR_UNDERFLOW;
   err = fd_bincode_bytes_decode_preflight( epoch_credits_sz, ctx );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_vote_block_timestamp_decode_preflight( ctx );
+  err = fd_vote_block_timestamp_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_vote_state_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_vote_state_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_vote_state_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_vote_state_t);
+  int err = fd_vote_state_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_vote_state_decode_unsafe( fd_vote_state_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->node_pubkey, ctx );
   fd_pubkey_decode_unsafe( &self->authorized_withdrawer, ctx );
@@ -11149,6 +12941,15 @@ void fd_vote_state_decode_unsafe( fd_vote_state_t * self, fd_bincode_decode_ctx_
   }
   fd_vote_block_timestamp_decode_unsafe( &self->last_timestamp, ctx );
 }
+fd_vote_state_t * fd_vote_state_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_vote_state_t * self = (fd_vote_state_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_vote_state_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_vote_state_new( self );
+  fd_vote_state_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_vote_state_encode( fd_vote_state_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->node_pubkey, ctx );
@@ -11201,12 +13002,13 @@ int fd_vote_state_encode( fd_vote_state_t const * self, fd_bincode_encode_ctx_t
 }
 int fd_vote_state_decode_offsets( fd_vote_state_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->node_pubkey_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->authorized_withdrawer_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->commission_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint8_decode_preflight( ctx );
@@ -11215,6 +13017,7 @@ int fd_vote_state_decode_offsets( fd_vote_state_off_t * self, fd_bincode_decode_
   ulong votes_len;
   err = fd_bincode_uint64_decode( &votes_len, ctx );
   if( FD_UNLIKELY( err ) ) return err;
+  *total_sz = fd_bincode_footprint_alloc( *total_sz, deq_fd_landed_vote_t_align(), deq_fd_landed_vote_t_footprint( fd_ulong_max( votes_len, 32 ) ) );
   ulong votes_sz;
   if( FD_UNLIKELY( __builtin_umull_overflow( votes_len, 13, &votes_sz ) ) ) return FD_BINCODE_ERR_UNDERFLOW;
   err = fd_bincode_bytes_decode_preflight( votes_sz, ctx );
@@ -11230,21 +13033,22 @@ int fd_vote_state_decode_offsets( fd_vote_state_off_t * self, fd_bincode_decode_
     }
   }
   self->authorized_voters_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_vote_authorized_voters_decode_preflight( ctx );
+  err = fd_vote_authorized_voters_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->prior_voters_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_vote_prior_voters_decode_preflight( ctx );
+  err = fd_vote_prior_voters_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->epoch_credits_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong epoch_credits_len;
   err = fd_bincode_uint64_decode( &epoch_credits_len, ctx );
   if( FD_UNLIKELY( err ) ) return err;
+  *total_sz = fd_bincode_footprint_alloc( *total_sz, deq_fd_vote_epoch_credits_t_align(), deq_fd_vote_epoch_credits_t_footprint( fd_ulong_max( epoch_credits_len, 64 ) ) );
   ulong epoch_credits_sz;
   if( FD_UNLIKELY( __builtin_umull_overflow( epoch_credits_len, 24, &epoch_credits_sz ) ) ) return FD_BINCODE_ERR_UNDERFLOW;
   err = fd_bincode_bytes_decode_preflight( epoch_credits_sz, ctx );
   if( FD_UNLIKELY( err ) ) return err;
   self->last_timestamp_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_vote_block_timestamp_decode_preflight( ctx );
+  err = fd_vote_block_timestamp_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -11372,21 +13176,21 @@ FD_FN_PURE uchar fd_vote_state_versioned_is_current(fd_vote_state_versioned_t co
   return self->discriminant == 2;
 }
 void fd_vote_state_versioned_inner_new( fd_vote_state_versioned_inner_t * self, uint discriminant );
-int fd_vote_state_versioned_inner_decode_preflight( uint discriminant, fd_bincode_decode_ctx_t * ctx ) {
+int fd_vote_state_versioned_inner_decode_footprint( uint discriminant, fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   switch (discriminant) {
   case 0: {
-    err = fd_vote_state_0_23_5_decode_preflight( ctx );
+    err = fd_vote_state_0_23_5_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 1: {
-    err = fd_vote_state_1_14_11_decode_preflight( ctx );
+    err = fd_vote_state_1_14_11_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 2: {
-    err = fd_vote_state_decode_preflight( ctx );
+    err = fd_vote_state_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
@@ -11420,16 +13224,36 @@ int fd_vote_state_versioned_decode( fd_vote_state_versioned_t * self, fd_bincode
   fd_vote_state_versioned_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_vote_state_versioned_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_vote_state_versioned_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   uint discriminant = 0;
   int err = fd_bincode_uint32_decode( &discriminant, ctx );
   if( FD_UNLIKELY( err ) ) return err;
-  return fd_vote_state_versioned_inner_decode_preflight( discriminant, ctx );
+  return fd_vote_state_versioned_inner_decode_footprint( discriminant, ctx, total_sz );
+}
+int fd_vote_state_versioned_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_vote_state_versioned_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_vote_state_versioned_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_vote_state_versioned_t);
+  int err = fd_vote_state_versioned_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
 }
 void fd_vote_state_versioned_decode_unsafe( fd_vote_state_versioned_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint32_decode_unsafe( &self->discriminant, ctx );
   fd_vote_state_versioned_inner_decode_unsafe( &self->inner, self->discriminant, ctx );
 }
+fd_vote_state_versioned_t * fd_vote_state_versioned_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_vote_state_versioned_t * self = (fd_vote_state_versioned_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_vote_state_versioned_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_vote_state_versioned_new( self );
+  fd_vote_state_versioned_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 void fd_vote_state_versioned_inner_new( fd_vote_state_versioned_inner_t * self, uint discriminant ) {
   switch( discriminant ) {
   case 0: {
@@ -11558,11 +13382,12 @@ int fd_vote_state_update_decode( fd_vote_state_update_t * self, fd_bincode_decod
   fd_vote_state_update_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_vote_state_update_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_vote_state_update_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   ulong lockouts_len;
   err = fd_bincode_uint64_decode( &lockouts_len, ctx );
   if( FD_UNLIKELY( err ) ) return err;
+  *total_sz = fd_bincode_footprint_alloc( *total_sz, deq_fd_vote_lockout_t_align(), deq_fd_vote_lockout_t_footprint( fd_ulong_max( lockouts_len, 32 ) ) );
   ulong lockouts_sz;
   if( FD_UNLIKELY( __builtin_umull_overflow( lockouts_len, 12, &lockouts_sz ) ) ) return FD_BINCODE_ERR_UNDERFLOW;
   err = fd_bincode_bytes_decode_preflight( lockouts_sz, ctx );
@@ -11576,7 +13401,7 @@ int fd_vote_state_update_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   {
     uchar o;
@@ -11589,6 +13414,17 @@ int fd_vote_state_update_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_vote_state_update_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_vote_state_update_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_vote_state_update_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_vote_state_update_t);
+  int err = fd_vote_state_update_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_vote_state_update_decode_unsafe( fd_vote_state_update_t * self, fd_bincode_decode_ctx_t * ctx ) {
   ulong lockouts_len;
   fd_bincode_uint64_decode_unsafe( &lockouts_len, ctx );
@@ -11617,6 +13453,15 @@ void fd_vote_state_update_decode_unsafe( fd_vote_state_update_t * self, fd_binco
     }
   }
 }
+fd_vote_state_update_t * fd_vote_state_update_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_vote_state_update_t * self = (fd_vote_state_update_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_vote_state_update_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_vote_state_update_new( self );
+  fd_vote_state_update_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_vote_state_update_encode( fd_vote_state_update_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   if( self->lockouts ) {
@@ -11651,11 +13496,13 @@ int fd_vote_state_update_encode( fd_vote_state_update_t const * self, fd_bincode
 }
 int fd_vote_state_update_decode_offsets( fd_vote_state_update_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->lockouts_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong lockouts_len;
   err = fd_bincode_uint64_decode( &lockouts_len, ctx );
   if( FD_UNLIKELY( err ) ) return err;
+  *total_sz = fd_bincode_footprint_alloc( *total_sz, deq_fd_vote_lockout_t_align(), deq_fd_vote_lockout_t_footprint( fd_ulong_max( lockouts_len, 32 ) ) );
   ulong lockouts_sz;
   if( FD_UNLIKELY( __builtin_umull_overflow( lockouts_len, 12, &lockouts_sz ) ) ) return FD_BINCODE_ERR_UNDERFLOW;
   err = fd_bincode_bytes_decode_preflight( lockouts_sz, ctx );
@@ -11671,7 +13518,7 @@ int fd_vote_state_update_decode_offsets( fd_vote_state_update_off_t * self, fd_b
     }
   }
   self->hash_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->timestamp_off = (uint)( (ulong)ctx->data - (ulong)data );
   {
@@ -11773,7 +13620,7 @@ int fd_compact_vote_state_update_decode( fd_compact_vote_state_update_t * self,
   fd_compact_vote_state_update_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_compact_vote_state_update_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_compact_vote_state_update_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -11781,12 +13628,13 @@ int fd_compact_vote_state_update_decode_preflight( fd_bincode_decode_ctx_t * ctx
   err = fd_bincode_compact_u16_decode( &lockouts_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( lockouts_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_LOCKOUT_OFFSET_ALIGN, FD_LOCKOUT_OFFSET_FOOTPRINT*lockouts_len );
     for( ulong i=0; i < lockouts_len; i++ ) {
-      err = fd_lockout_offset_decode_preflight( ctx );
+      err = fd_lockout_offset_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   {
     uchar o;
@@ -11799,6 +13647,17 @@ int fd_compact_vote_state_update_decode_preflight( fd_bincode_decode_ctx_t * ctx
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_compact_vote_state_update_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_compact_vote_state_update_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_compact_vote_state_update_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_compact_vote_state_update_t);
+  int err = fd_compact_vote_state_update_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_compact_vote_state_update_decode_unsafe( fd_compact_vote_state_update_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->root, ctx );
   fd_bincode_compact_u16_decode_unsafe( &self->lockouts_len, ctx );
@@ -11820,6 +13679,15 @@ void fd_compact_vote_state_update_decode_unsafe( fd_compact_vote_state_update_t
     }
   }
 }
+fd_compact_vote_state_update_t * fd_compact_vote_state_update_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_compact_vote_state_update_t * self = (fd_compact_vote_state_update_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_compact_vote_state_update_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_compact_vote_state_update_new( self );
+  fd_compact_vote_state_update_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_compact_vote_state_update_encode( fd_compact_vote_state_update_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->root, ctx );
@@ -11844,6 +13712,7 @@ int fd_compact_vote_state_update_encode( fd_compact_vote_state_update_t const *
 }
 int fd_compact_vote_state_update_decode_offsets( fd_compact_vote_state_update_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->root_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -11853,13 +13722,14 @@ int fd_compact_vote_state_update_decode_offsets( fd_compact_vote_state_update_of
   err = fd_bincode_compact_u16_decode( &lockouts_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( lockouts_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_LOCKOUT_OFFSET_ALIGN, FD_LOCKOUT_OFFSET_FOOTPRINT*lockouts_len );
     for( ulong i=0; i < lockouts_len; i++ ) {
-      err = fd_lockout_offset_decode_preflight( ctx );
+      err = fd_lockout_offset_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
   self->hash_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->timestamp_off = (uint)( (ulong)ctx->data - (ulong)data );
   {
@@ -11938,18 +13808,38 @@ int fd_compact_vote_state_update_switch_decode( fd_compact_vote_state_update_swi
   fd_compact_vote_state_update_switch_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_compact_vote_state_update_switch_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_compact_vote_state_update_switch_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_compact_vote_state_update_decode_preflight( ctx );
+  err = fd_compact_vote_state_update_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_compact_vote_state_update_switch_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_compact_vote_state_update_switch_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_compact_vote_state_update_switch_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_compact_vote_state_update_switch_t);
+  int err = fd_compact_vote_state_update_switch_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_compact_vote_state_update_switch_decode_unsafe( fd_compact_vote_state_update_switch_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_compact_vote_state_update_decode_unsafe( &self->compact_vote_state_update, ctx );
   fd_hash_decode_unsafe( &self->hash, ctx );
 }
+fd_compact_vote_state_update_switch_t * fd_compact_vote_state_update_switch_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_compact_vote_state_update_switch_t * self = (fd_compact_vote_state_update_switch_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_compact_vote_state_update_switch_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_compact_vote_state_update_switch_new( self );
+  fd_compact_vote_state_update_switch_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_compact_vote_state_update_switch_encode( fd_compact_vote_state_update_switch_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_compact_vote_state_update_encode( &self->compact_vote_state_update, ctx );
@@ -11960,12 +13850,13 @@ int fd_compact_vote_state_update_switch_encode( fd_compact_vote_state_update_swi
 }
 int fd_compact_vote_state_update_switch_decode_offsets( fd_compact_vote_state_update_switch_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->compact_vote_state_update_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_compact_vote_state_update_decode_preflight( ctx );
+  err = fd_compact_vote_state_update_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->hash_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -12006,18 +13897,19 @@ int fd_compact_tower_sync_decode( fd_compact_tower_sync_t * self, fd_bincode_dec
   fd_compact_tower_sync_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_compact_tower_sync_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_compact_tower_sync_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   ushort lockout_offsets_len;
   err = fd_bincode_compact_u16_decode( &lockout_offsets_len, ctx );
   if( FD_UNLIKELY( err ) ) return err;
+  *total_sz = fd_bincode_footprint_alloc( *total_sz, deq_fd_lockout_offset_t_align(), deq_fd_lockout_offset_t_footprint( fd_ulong_max( lockout_offsets_len, 32 ) ) );
   for( ulong i = 0; i < lockout_offsets_len; ++i ) {
-    err = fd_lockout_offset_decode_preflight( ctx );
+    err = fd_lockout_offset_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
   }
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   {
     uchar o;
@@ -12028,10 +13920,21 @@ int fd_compact_tower_sync_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_compact_tower_sync_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_compact_tower_sync_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_compact_tower_sync_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_compact_tower_sync_t);
+  int err = fd_compact_tower_sync_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_compact_tower_sync_decode_unsafe( fd_compact_tower_sync_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->root, ctx );
   ushort lockout_offsets_len;
@@ -12054,6 +13957,15 @@ void fd_compact_tower_sync_decode_unsafe( fd_compact_tower_sync_t * self, fd_bin
   }
   fd_hash_decode_unsafe( &self->block_id, ctx );
 }
+fd_compact_tower_sync_t * fd_compact_tower_sync_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_compact_tower_sync_t * self = (fd_compact_tower_sync_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_compact_tower_sync_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_compact_tower_sync_new( self );
+  fd_compact_tower_sync_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_compact_tower_sync_encode( fd_compact_tower_sync_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->root, ctx );
@@ -12086,6 +13998,7 @@ int fd_compact_tower_sync_encode( fd_compact_tower_sync_t const * self, fd_binco
 }
 int fd_compact_tower_sync_decode_offsets( fd_compact_tower_sync_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->root_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -12094,12 +14007,13 @@ int fd_compact_tower_sync_decode_offsets( fd_compact_tower_sync_off_t * self, fd
   ushort lockout_offsets_len;
   err = fd_bincode_compact_u16_decode( &lockout_offsets_len, ctx );
   if( FD_UNLIKELY( err ) ) return err;
+  *total_sz = fd_bincode_footprint_alloc( *total_sz, deq_fd_lockout_offset_t_align(), deq_fd_lockout_offset_t_footprint( fd_ulong_max( lockout_offsets_len, 32 ) ) );
   for( ulong i = 0; i < lockout_offsets_len; ++i ) {
-    err = fd_lockout_offset_decode_preflight( ctx );
+    err = fd_lockout_offset_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
   }
   self->hash_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->timestamp_off = (uint)( (ulong)ctx->data - (ulong)data );
   {
@@ -12112,7 +14026,7 @@ int fd_compact_tower_sync_decode_offsets( fd_compact_tower_sync_off_t * self, fd
     }
   }
   self->block_id_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -12282,18 +14196,38 @@ int fd_tower_sync_switch_decode( fd_tower_sync_switch_t * self, fd_bincode_decod
   fd_tower_sync_switch_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_tower_sync_switch_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_tower_sync_switch_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_tower_sync_decode_preflight( ctx );
+  err = fd_tower_sync_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_tower_sync_switch_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_tower_sync_switch_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_tower_sync_switch_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_tower_sync_switch_t);
+  int err = fd_tower_sync_switch_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_tower_sync_switch_decode_unsafe( fd_tower_sync_switch_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_tower_sync_decode_unsafe( &self->tower_sync, ctx );
   fd_hash_decode_unsafe( &self->hash, ctx );
 }
+fd_tower_sync_switch_t * fd_tower_sync_switch_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_tower_sync_switch_t * self = (fd_tower_sync_switch_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_tower_sync_switch_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_tower_sync_switch_new( self );
+  fd_tower_sync_switch_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_tower_sync_switch_encode( fd_tower_sync_switch_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_tower_sync_encode( &self->tower_sync, ctx );
@@ -12304,12 +14238,13 @@ int fd_tower_sync_switch_encode( fd_tower_sync_switch_t const * self, fd_bincode
 }
 int fd_tower_sync_switch_decode_offsets( fd_tower_sync_switch_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->tower_sync_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_tower_sync_decode_preflight( ctx );
+  err = fd_tower_sync_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->hash_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -12350,12 +14285,13 @@ int fd_slot_history_inner_decode( fd_slot_history_inner_t * self, fd_bincode_dec
   fd_slot_history_inner_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_slot_history_inner_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_slot_history_inner_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   ulong blocks_len;
   err = fd_bincode_uint64_decode( &blocks_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( blocks_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, sizeof(ulong)*blocks_len );
     for( ulong i=0; i < blocks_len; i++ ) {
       err = fd_bincode_uint64_decode_preflight( ctx );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -12363,6 +14299,17 @@ int fd_slot_history_inner_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_slot_history_inner_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_slot_history_inner_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_slot_history_inner_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_slot_history_inner_t);
+  int err = fd_slot_history_inner_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_slot_history_inner_decode_unsafe( fd_slot_history_inner_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->blocks_len, ctx );
   if( self->blocks_len ) {
@@ -12373,6 +14320,15 @@ void fd_slot_history_inner_decode_unsafe( fd_slot_history_inner_t * self, fd_bin
   } else
     self->blocks = NULL;
 }
+fd_slot_history_inner_t * fd_slot_history_inner_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_slot_history_inner_t * self = (fd_slot_history_inner_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_slot_history_inner_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_slot_history_inner_new( self );
+  fd_slot_history_inner_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_slot_history_inner_encode( fd_slot_history_inner_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->blocks_len, ctx );
@@ -12386,12 +14342,14 @@ int fd_slot_history_inner_encode( fd_slot_history_inner_t const * self, fd_binco
 }
 int fd_slot_history_inner_decode_offsets( fd_slot_history_inner_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->blocks_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong blocks_len;
   err = fd_bincode_uint64_decode( &blocks_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( blocks_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, sizeof(ulong)*blocks_len );
     for( ulong i=0; i < blocks_len; i++ ) {
       err = fd_bincode_uint64_decode_preflight( ctx );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -12442,14 +14400,15 @@ int fd_slot_history_bitvec_decode( fd_slot_history_bitvec_t * self, fd_bincode_d
   fd_slot_history_bitvec_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_slot_history_bitvec_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_slot_history_bitvec_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   {
     uchar o;
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
-      err = fd_slot_history_inner_decode_preflight( ctx );
+      *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_SLOT_HISTORY_INNER_ALIGN, FD_SLOT_HISTORY_INNER_FOOTPRINT );
+      err = fd_slot_history_inner_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -12457,6 +14416,17 @@ int fd_slot_history_bitvec_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_slot_history_bitvec_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_slot_history_bitvec_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_slot_history_bitvec_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_slot_history_bitvec_t);
+  int err = fd_slot_history_bitvec_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_slot_history_bitvec_decode_unsafe( fd_slot_history_bitvec_t * self, fd_bincode_decode_ctx_t * ctx ) {
   {
     uchar o;
@@ -12470,6 +14440,15 @@ void fd_slot_history_bitvec_decode_unsafe( fd_slot_history_bitvec_t * self, fd_b
   }
   fd_bincode_uint64_decode_unsafe( &self->len, ctx );
 }
+fd_slot_history_bitvec_t * fd_slot_history_bitvec_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_slot_history_bitvec_t * self = (fd_slot_history_bitvec_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_slot_history_bitvec_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_slot_history_bitvec_new( self );
+  fd_slot_history_bitvec_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_slot_history_bitvec_encode( fd_slot_history_bitvec_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   if( self->bits != NULL ) {
@@ -12487,6 +14466,7 @@ int fd_slot_history_bitvec_encode( fd_slot_history_bitvec_t const * self, fd_bin
 }
 int fd_slot_history_bitvec_decode_offsets( fd_slot_history_bitvec_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->bits_off = (uint)( (ulong)ctx->data - (ulong)data );
   {
@@ -12494,7 +14474,8 @@ int fd_slot_history_bitvec_decode_offsets( fd_slot_history_bitvec_off_t * self,
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
-      err = fd_slot_history_inner_decode_preflight( ctx );
+      *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_SLOT_HISTORY_INNER_ALIGN, FD_SLOT_HISTORY_INNER_FOOTPRINT );
+      err = fd_slot_history_inner_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -12548,18 +14529,38 @@ int fd_slot_history_decode( fd_slot_history_t * self, fd_bincode_decode_ctx_t *
   fd_slot_history_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_slot_history_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_slot_history_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_slot_history_bitvec_decode_preflight( ctx );
+  err = fd_slot_history_bitvec_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_slot_history_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_slot_history_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_slot_history_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_slot_history_t);
+  int err = fd_slot_history_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_slot_history_decode_unsafe( fd_slot_history_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_slot_history_bitvec_decode_unsafe( &self->bits, ctx );
   fd_bincode_uint64_decode_unsafe( &self->next_slot, ctx );
 }
+fd_slot_history_t * fd_slot_history_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_slot_history_t * self = (fd_slot_history_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_slot_history_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_slot_history_new( self );
+  fd_slot_history_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_slot_history_encode( fd_slot_history_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_slot_history_bitvec_encode( &self->bits, ctx );
@@ -12570,9 +14571,10 @@ int fd_slot_history_encode( fd_slot_history_t const * self, fd_bincode_encode_ct
 }
 int fd_slot_history_decode_offsets( fd_slot_history_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->bits_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_slot_history_bitvec_decode_preflight( ctx );
+  err = fd_slot_history_bitvec_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->next_slot_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -12614,13 +14616,33 @@ int fd_slot_hash_decode( fd_slot_hash_t * self, fd_bincode_decode_ctx_t * ctx )
   fd_slot_hash_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_slot_hash_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_slot_hash_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 40, ctx );
 }
+int fd_slot_hash_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_slot_hash_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_slot_hash_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_slot_hash_t);
+  int err = fd_slot_hash_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_slot_hash_decode_unsafe( fd_slot_hash_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->slot, ctx );
   fd_hash_decode_unsafe( &self->hash, ctx );
 }
+fd_slot_hash_t * fd_slot_hash_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_slot_hash_t * self = (fd_slot_hash_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_slot_hash_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_slot_hash_new( self );
+  fd_slot_hash_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_slot_hash_encode( fd_slot_hash_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->slot, ctx );
@@ -12631,12 +14653,13 @@ int fd_slot_hash_encode( fd_slot_hash_t const * self, fd_bincode_encode_ctx_t *
 }
 int fd_slot_hash_decode_offsets( fd_slot_hash_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->slot_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->hash_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -12650,6 +14673,7 @@ void fd_slot_hash_destroy( fd_slot_hash_t * self, fd_bincode_destroy_ctx_t * ctx
 
 ulong fd_slot_hash_footprint( void ){ return FD_SLOT_HASH_FOOTPRINT; }
 ulong fd_slot_hash_align( void ){ return FD_SLOT_HASH_ALIGN; }
+FD_STATIC_ASSERT( sizeof(fd_slot_hash_t)==40UL, fd_slot_hash_view );
 
 void fd_slot_hash_walk( void * w, fd_slot_hash_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_slot_hash", level++ );
@@ -12675,17 +14699,29 @@ int fd_slot_hashes_decode( fd_slot_hashes_t * self, fd_bincode_decode_ctx_t * ct
   fd_slot_hashes_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_slot_hashes_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_slot_hashes_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   ulong hashes_len;
   err = fd_bincode_uint64_decode( &hashes_len, ctx );
   if( FD_UNLIKELY( err ) ) return err;
+  *total_sz = fd_bincode_footprint_alloc( *total_sz, deq_fd_slot_hash_t_align(), deq_fd_slot_hash_t_footprint( fd_ulong_max( hashes_len, 512 ) ) );
   ulong hashes_sz;
   if( FD_UNLIKELY( __builtin_umull_overflow( hashes_len, 40, &hashes_sz ) ) ) return FD_BINCODE_ERR_UNDERFLOW;
   err = fd_bincode_bytes_decode_preflight( hashes_sz, ctx );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_slot_hashes_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_slot_hashes_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_slot_hashes_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_slot_hashes_t);
+  int err = fd_slot_hashes_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_slot_hashes_decode_unsafe( fd_slot_hashes_t * self, fd_bincode_decode_ctx_t * ctx ) {
   ulong hashes_len;
   fd_bincode_uint64_decode_unsafe( &hashes_len, ctx );
@@ -12697,6 +14733,15 @@ void fd_slot_hashes_decode_unsafe( fd_slot_hashes_t * self, fd_bincode_decode_ct
     fd_slot_hash_decode_unsafe( elem, ctx );
   }
 }
+fd_slot_hashes_t * fd_slot_hashes_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_slot_hashes_t * self = (fd_slot_hashes_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_slot_hashes_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_slot_hashes_new( self );
+  fd_slot_hashes_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_slot_hashes_encode( fd_slot_hashes_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   if( self->hashes ) {
@@ -12717,11 +14762,13 @@ int fd_slot_hashes_encode( fd_slot_hashes_t const * self, fd_bincode_encode_ctx_
 }
 int fd_slot_hashes_decode_offsets( fd_slot_hashes_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->hashes_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong hashes_len;
   err = fd_bincode_uint64_decode( &hashes_len, ctx );
   if( FD_UNLIKELY( err ) ) return err;
+  *total_sz = fd_bincode_footprint_alloc( *total_sz, deq_fd_slot_hash_t_align(), deq_fd_slot_hash_t_footprint( fd_ulong_max( hashes_len, 512 ) ) );
   ulong hashes_sz;
   if( FD_UNLIKELY( __builtin_umull_overflow( hashes_len, 40, &hashes_sz ) ) ) return FD_BINCODE_ERR_UNDERFLOW;
   err = fd_bincode_bytes_decode_preflight( hashes_sz, ctx );
@@ -12788,13 +14835,33 @@ int fd_block_block_hash_entry_decode( fd_block_block_hash_entry_t * self, fd_bin
   fd_block_block_hash_entry_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_block_block_hash_entry_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_block_block_hash_entry_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 40, ctx );
 }
+int fd_block_block_hash_entry_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_block_block_hash_entry_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_block_block_hash_entry_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_block_block_hash_entry_t);
+  int err = fd_block_block_hash_entry_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_block_block_hash_entry_decode_unsafe( fd_block_block_hash_entry_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_hash_decode_unsafe( &self->blockhash, ctx );
   fd_fee_calculator_decode_unsafe( &self->fee_calculator, ctx );
 }
+fd_block_block_hash_entry_t * fd_block_block_hash_entry_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_block_block_hash_entry_t * self = (fd_block_block_hash_entry_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_block_block_hash_entry_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_block_block_hash_entry_new( self );
+  fd_block_block_hash_entry_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_block_block_hash_entry_encode( fd_block_block_hash_entry_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_hash_encode( &self->blockhash, ctx );
@@ -12805,12 +14872,13 @@ int fd_block_block_hash_entry_encode( fd_block_block_hash_entry_t const * self,
 }
 int fd_block_block_hash_entry_decode_offsets( fd_block_block_hash_entry_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->blockhash_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->fee_calculator_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_fee_calculator_decode_preflight( ctx );
+  err = fd_fee_calculator_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -12826,6 +14894,7 @@ void fd_block_block_hash_entry_destroy( fd_block_block_hash_entry_t * self, fd_b
 
 ulong fd_block_block_hash_entry_footprint( void ){ return FD_BLOCK_BLOCK_HASH_ENTRY_FOOTPRINT; }
 ulong fd_block_block_hash_entry_align( void ){ return FD_BLOCK_BLOCK_HASH_ENTRY_ALIGN; }
+FD_STATIC_ASSERT( sizeof(fd_block_block_hash_entry_t)==40UL, fd_block_block_hash_entry_view );
 
 void fd_block_block_hash_entry_walk( void * w, fd_block_block_hash_entry_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_block_block_hash_entry", level++ );
@@ -12851,17 +14920,29 @@ int fd_recent_block_hashes_decode( fd_recent_block_hashes_t * self, fd_bincode_d
   fd_recent_block_hashes_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_recent_block_hashes_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_recent_block_hashes_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   ulong hashes_len;
   err = fd_bincode_uint64_decode( &hashes_len, ctx );
   if( FD_UNLIKELY( err ) ) return err;
+  *total_sz = fd_bincode_footprint_alloc( *total_sz, deq_fd_block_block_hash_entry_t_align(), deq_fd_block_block_hash_entry_t_footprint( fd_ulong_max( hashes_len, 151 ) ) );
   ulong hashes_sz;
   if( FD_UNLIKELY( __builtin_umull_overflow( hashes_len, 40, &hashes_sz ) ) ) return FD_BINCODE_ERR_UNDERFLOW;
   err = fd_bincode_bytes_decode_preflight( hashes_sz, ctx );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_recent_block_hashes_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_recent_block_hashes_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_recent_block_hashes_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_recent_block_hashes_t);
+  int err = fd_recent_block_hashes_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_recent_block_hashes_decode_unsafe( fd_recent_block_hashes_t * self, fd_bincode_decode_ctx_t * ctx ) {
   ulong hashes_len;
   fd_bincode_uint64_decode_unsafe( &hashes_len, ctx );
@@ -12873,6 +14954,15 @@ void fd_recent_block_hashes_decode_unsafe( fd_recent_block_hashes_t * self, fd_b
     fd_block_block_hash_entry_decode_unsafe( elem, ctx );
   }
 }
+fd_recent_block_hashes_t * fd_recent_block_hashes_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_recent_block_hashes_t * self = (fd_recent_block_hashes_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_recent_block_hashes_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_recent_block_hashes_new( self );
+  fd_recent_block_hashes_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_recent_block_hashes_encode( fd_recent_block_hashes_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   if( self->hashes ) {
@@ -12893,11 +14983,13 @@ int fd_recent_block_hashes_encode( fd_recent_block_hashes_t const * self, fd_bin
 }
 int fd_recent_block_hashes_decode_offsets( fd_recent_block_hashes_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->hashes_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong hashes_len;
   err = fd_bincode_uint64_decode( &hashes_len, ctx );
   if( FD_UNLIKELY( err ) ) return err;
+  *total_sz = fd_bincode_footprint_alloc( *total_sz, deq_fd_block_block_hash_entry_t_align(), deq_fd_block_block_hash_entry_t_footprint( fd_ulong_max( hashes_len, 151 ) ) );
   ulong hashes_sz;
   if( FD_UNLIKELY( __builtin_umull_overflow( hashes_len, 40, &hashes_sz ) ) ) return FD_BINCODE_ERR_UNDERFLOW;
   err = fd_bincode_bytes_decode_preflight( hashes_sz, ctx );
@@ -12964,7 +15056,7 @@ int fd_slot_meta_decode( fd_slot_meta_t * self, fd_bincode_decode_ctx_t * ctx )
   fd_slot_meta_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_slot_meta_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_slot_meta_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -12982,6 +15074,7 @@ int fd_slot_meta_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   err = fd_bincode_uint64_decode( &next_slot_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( next_slot_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, sizeof(ulong)*next_slot_len );
     for( ulong i=0; i < next_slot_len; i++ ) {
       err = fd_bincode_uint64_decode_preflight( ctx );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -12993,6 +15086,7 @@ int fd_slot_meta_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   err = fd_bincode_uint64_decode( &entry_end_indexes_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( entry_end_indexes_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, sizeof(uint)*entry_end_indexes_len );
     for( ulong i=0; i < entry_end_indexes_len; i++ ) {
       err = fd_bincode_uint32_decode_preflight( ctx );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -13000,6 +15094,17 @@ int fd_slot_meta_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_slot_meta_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_slot_meta_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_slot_meta_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_slot_meta_t);
+  int err = fd_slot_meta_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_slot_meta_decode_unsafe( fd_slot_meta_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->slot, ctx );
   fd_bincode_uint64_decode_unsafe( &self->consumed, ctx );
@@ -13025,6 +15130,15 @@ void fd_slot_meta_decode_unsafe( fd_slot_meta_t * self, fd_bincode_decode_ctx_t
   } else
     self->entry_end_indexes = NULL;
 }
+fd_slot_meta_t * fd_slot_meta_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_slot_meta_t * self = (fd_slot_meta_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_slot_meta_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_slot_meta_new( self );
+  fd_slot_meta_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_slot_meta_encode( fd_slot_meta_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->slot, ctx );
@@ -13059,6 +15173,7 @@ int fd_slot_meta_encode( fd_slot_meta_t const * self, fd_bincode_encode_ctx_t *
 }
 int fd_slot_meta_decode_offsets( fd_slot_meta_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->slot_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -13083,6 +15198,7 @@ int fd_slot_meta_decode_offsets( fd_slot_meta_off_t * self, fd_bincode_decode_ct
   err = fd_bincode_uint64_decode( &next_slot_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( next_slot_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, sizeof(ulong)*next_slot_len );
     for( ulong i=0; i < next_slot_len; i++ ) {
       err = fd_bincode_uint64_decode_preflight( ctx );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -13096,6 +15212,7 @@ int fd_slot_meta_decode_offsets( fd_slot_meta_off_t * self, fd_bincode_decode_ct
   err = fd_bincode_uint64_decode( &entry_end_indexes_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( entry_end_indexes_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, sizeof(uint)*entry_end_indexes_len );
     for( ulong i=0; i < entry_end_indexes_len; i++ ) {
       err = fd_bincode_uint32_decode_preflight( ctx );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -13174,14 +15291,34 @@ int fd_clock_timestamp_vote_decode( fd_clock_timestamp_vote_t * self, fd_bincode
   fd_clock_timestamp_vote_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_clock_timestamp_vote_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_clock_timestamp_vote_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 48, ctx );
 }
+int fd_clock_timestamp_vote_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_clock_timestamp_vote_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_clock_timestamp_vote_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_clock_timestamp_vote_t);
+  int err = fd_clock_timestamp_vote_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_clock_timestamp_vote_decode_unsafe( fd_clock_timestamp_vote_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->pubkey, ctx );
   fd_bincode_uint64_decode_unsafe( (ulong *) &self->timestamp, ctx );
   fd_bincode_uint64_decode_unsafe( &self->slot, ctx );
 }
+fd_clock_timestamp_vote_t * fd_clock_timestamp_vote_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_clock_timestamp_vote_t * self = (fd_clock_timestamp_vote_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_clock_timestamp_vote_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_clock_timestamp_vote_new( self );
+  fd_clock_timestamp_vote_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_clock_timestamp_vote_encode( fd_clock_timestamp_vote_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->pubkey, ctx );
@@ -13295,9 +15432,10 @@ int fd_clock_timestamp_vote_encode_archival( fd_clock_timestamp_vote_t const * s
 }
 int fd_clock_timestamp_vote_decode_offsets( fd_clock_timestamp_vote_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->pubkey_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->timestamp_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -13317,6 +15455,7 @@ void fd_clock_timestamp_vote_destroy( fd_clock_timestamp_vote_t * self, fd_binco
 
 ulong fd_clock_timestamp_vote_footprint( void ){ return FD_CLOCK_TIMESTAMP_VOTE_FOOTPRINT; }
 ulong fd_clock_timestamp_vote_align( void ){ return FD_CLOCK_TIMESTAMP_VOTE_ALIGN; }
+FD_STATIC_ASSERT( sizeof(fd_clock_timestamp_vote_t)==48UL, fd_clock_timestamp_vote_view );
 
 void fd_clock_timestamp_vote_walk( void * w, fd_clock_timestamp_vote_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_clock_timestamp_vote", level++ );
@@ -13344,17 +15483,29 @@ int fd_clock_timestamp_votes_decode( fd_clock_timestamp_votes_t * self, fd_binco
   fd_clock_timestamp_votes_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_clock_timestamp_votes_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_clock_timestamp_votes_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   ulong votes_len;
   err = fd_bincode_uint64_decode( &votes_len, ctx );
   if( FD_UNLIKELY( err ) ) return err;
+  *total_sz = fd_bincode_footprint_alloc( *total_sz, fd_clock_timestamp_vote_t_map_align(), fd_clock_timestamp_vote_t_map_footprint( fd_ulong_max( votes_len, 15000 ) ) );
   for( ulong i=0; i < votes_len; i++ ) {
-    err = fd_clock_timestamp_vote_decode_preflight( ctx );
+    err = fd_clock_timestamp_vote_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_clock_timestamp_votes_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_clock_timestamp_votes_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_clock_timestamp_votes_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_clock_timestamp_votes_t);
+  int err = fd_clock_timestamp_votes_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_clock_timestamp_votes_decode_unsafe( fd_clock_timestamp_votes_t * self, fd_bincode_decode_ctx_t * ctx ) {
   ulong votes_len;
   fd_bincode_uint64_decode_unsafe( &votes_len, ctx );
@@ -13369,6 +15520,15 @@ void fd_clock_timestamp_votes_decode_unsafe( fd_clock_timestamp_votes_t * self,
     fd_clock_timestamp_vote_t_map_insert( self->votes_pool, &self->votes_root, node );
   }
 }
+fd_clock_timestamp_votes_t * fd_clock_timestamp_votes_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_clock_timestamp_votes_t * self = (fd_clock_timestamp_votes_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_clock_timestamp_votes_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_clock_timestamp_votes_new( self );
+  fd_clock_timestamp_votes_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_clock_timestamp_votes_encode( fd_clock_timestamp_votes_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   if( self->votes_root ) {
@@ -13488,13 +15648,15 @@ int fd_clock_timestamp_votes_encode_archival( fd_clock_timestamp_votes_t const *
 }
 int fd_clock_timestamp_votes_decode_offsets( fd_clock_timestamp_votes_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->votes_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong votes_len;
   err = fd_bincode_uint64_decode( &votes_len, ctx );
   if( FD_UNLIKELY( err ) ) return err;
+  *total_sz = fd_bincode_footprint_alloc( *total_sz, fd_clock_timestamp_vote_t_map_align(), fd_clock_timestamp_vote_t_map_footprint( fd_ulong_max( votes_len, 15000 ) ) );
   for( ulong i=0; i < votes_len; i++ ) {
-    err = fd_clock_timestamp_vote_decode_preflight( ctx );
+    err = fd_clock_timestamp_vote_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
   }
   return FD_BINCODE_SUCCESS;
@@ -13547,12 +15709,32 @@ int fd_sysvar_fees_decode( fd_sysvar_fees_t * self, fd_bincode_decode_ctx_t * ct
   fd_sysvar_fees_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_sysvar_fees_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_sysvar_fees_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 8, ctx );
 }
+int fd_sysvar_fees_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_sysvar_fees_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_sysvar_fees_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_sysvar_fees_t);
+  int err = fd_sysvar_fees_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_sysvar_fees_decode_unsafe( fd_sysvar_fees_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_fee_calculator_decode_unsafe( &self->fee_calculator, ctx );
 }
+fd_sysvar_fees_t * fd_sysvar_fees_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_sysvar_fees_t * self = (fd_sysvar_fees_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_sysvar_fees_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_sysvar_fees_new( self );
+  fd_sysvar_fees_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_sysvar_fees_encode( fd_sysvar_fees_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_fee_calculator_encode( &self->fee_calculator, ctx );
@@ -13561,9 +15743,10 @@ int fd_sysvar_fees_encode( fd_sysvar_fees_t const * self, fd_bincode_encode_ctx_
 }
 int fd_sysvar_fees_decode_offsets( fd_sysvar_fees_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->fee_calculator_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_fee_calculator_decode_preflight( ctx );
+  err = fd_fee_calculator_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -13577,6 +15760,7 @@ void fd_sysvar_fees_destroy( fd_sysvar_fees_t * self, fd_bincode_destroy_ctx_t *
 
 ulong fd_sysvar_fees_footprint( void ){ return FD_SYSVAR_FEES_FOOTPRINT; }
 ulong fd_sysvar_fees_align( void ){ return FD_SYSVAR_FEES_ALIGN; }
+FD_STATIC_ASSERT( sizeof(fd_sysvar_fees_t)==8UL, fd_sysvar_fees_view );
 
 void fd_sysvar_fees_walk( void * w, fd_sysvar_fees_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_sysvar_fees", level++ );
@@ -13600,13 +15784,13 @@ int fd_sysvar_epoch_rewards_decode( fd_sysvar_epoch_rewards_t * self, fd_bincode
   fd_sysvar_epoch_rewards_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_sysvar_epoch_rewards_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_sysvar_epoch_rewards_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint128_decode_preflight( ctx );
   if( FD_UNLIKELY( err ) ) return err;
@@ -13618,6 +15802,17 @@ int fd_sysvar_epoch_rewards_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_sysvar_epoch_rewards_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_sysvar_epoch_rewards_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_sysvar_epoch_rewards_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_sysvar_epoch_rewards_t);
+  int err = fd_sysvar_epoch_rewards_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_sysvar_epoch_rewards_decode_unsafe( fd_sysvar_epoch_rewards_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->distribution_starting_block_height, ctx );
   fd_bincode_uint64_decode_unsafe( &self->num_partitions, ctx );
@@ -13627,6 +15822,15 @@ void fd_sysvar_epoch_rewards_decode_unsafe( fd_sysvar_epoch_rewards_t * self, fd
   fd_bincode_uint64_decode_unsafe( &self->distributed_rewards, ctx );
   fd_bincode_bool_decode_unsafe( &self->active, ctx );
 }
+fd_sysvar_epoch_rewards_t * fd_sysvar_epoch_rewards_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_sysvar_epoch_rewards_t * self = (fd_sysvar_epoch_rewards_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_sysvar_epoch_rewards_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_sysvar_epoch_rewards_new( self );
+  fd_sysvar_epoch_rewards_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_sysvar_epoch_rewards_encode( fd_sysvar_epoch_rewards_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->distribution_starting_block_height, ctx );
@@ -13647,6 +15851,7 @@ int fd_sysvar_epoch_rewards_encode( fd_sysvar_epoch_rewards_t const * self, fd_b
 }
 int fd_sysvar_epoch_rewards_decode_offsets( fd_sysvar_epoch_rewards_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->distribution_starting_block_height_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -13655,7 +15860,7 @@ int fd_sysvar_epoch_rewards_decode_offsets( fd_sysvar_epoch_rewards_off_t * self
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->parent_blockhash_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->total_points_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint128_decode_preflight( ctx );
@@ -13716,18 +15921,38 @@ int fd_config_keys_pair_decode( fd_config_keys_pair_t * self, fd_bincode_decode_
   fd_config_keys_pair_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_config_keys_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_config_keys_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_bool_decode_preflight( ctx );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_config_keys_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_config_keys_pair_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_config_keys_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_config_keys_pair_t);
+  int err = fd_config_keys_pair_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_config_keys_pair_decode_unsafe( fd_config_keys_pair_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->key, ctx );
   fd_bincode_bool_decode_unsafe( &self->signer, ctx );
 }
+fd_config_keys_pair_t * fd_config_keys_pair_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_config_keys_pair_t * self = (fd_config_keys_pair_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_config_keys_pair_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_config_keys_pair_new( self );
+  fd_config_keys_pair_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_config_keys_pair_encode( fd_config_keys_pair_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->key, ctx );
@@ -13738,9 +15963,10 @@ int fd_config_keys_pair_encode( fd_config_keys_pair_t const * self, fd_bincode_e
 }
 int fd_config_keys_pair_decode_offsets( fd_config_keys_pair_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->key_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->signer_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_bool_decode_preflight( ctx );
@@ -13782,14 +16008,15 @@ int fd_stake_config_decode( fd_stake_config_t * self, fd_bincode_decode_ctx_t *
   fd_stake_config_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_stake_config_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_stake_config_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   ushort config_keys_len;
   err = fd_bincode_compact_u16_decode( &config_keys_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( config_keys_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_CONFIG_KEYS_PAIR_ALIGN, FD_CONFIG_KEYS_PAIR_FOOTPRINT*config_keys_len );
     for( ulong i=0; i < config_keys_len; i++ ) {
-      err = fd_config_keys_pair_decode_preflight( ctx );
+      err = fd_config_keys_pair_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -13799,6 +16026,17 @@ int fd_stake_config_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_stake_config_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_stake_config_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_stake_config_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_stake_config_t);
+  int err = fd_stake_config_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_stake_config_decode_unsafe( fd_stake_config_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_compact_u16_decode_unsafe( &self->config_keys_len, ctx );
   if( self->config_keys_len ) {
@@ -13812,6 +16050,15 @@ void fd_stake_config_decode_unsafe( fd_stake_config_t * self, fd_bincode_decode_
   fd_bincode_double_decode_unsafe( &self->warmup_cooldown_rate, ctx );
   fd_bincode_uint8_decode_unsafe( &self->slash_penalty, ctx );
 }
+fd_stake_config_t * fd_stake_config_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_stake_config_t * self = (fd_stake_config_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_stake_config_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_stake_config_new( self );
+  fd_stake_config_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_stake_config_encode( fd_stake_config_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_compact_u16_encode( &self->config_keys_len, ctx );
@@ -13830,14 +16077,16 @@ int fd_stake_config_encode( fd_stake_config_t const * self, fd_bincode_encode_ct
 }
 int fd_stake_config_decode_offsets( fd_stake_config_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->config_keys_off = (uint)( (ulong)ctx->data - (ulong)data );
   ushort config_keys_len;
   err = fd_bincode_compact_u16_decode( &config_keys_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( config_keys_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_CONFIG_KEYS_PAIR_ALIGN, FD_CONFIG_KEYS_PAIR_FOOTPRINT*config_keys_len );
     for( ulong i=0; i < config_keys_len; i++ ) {
-      err = fd_config_keys_pair_decode_preflight( ctx );
+      err = fd_config_keys_pair_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -13900,14 +16149,15 @@ int fd_feature_entry_decode( fd_feature_entry_t * self, fd_bincode_decode_ctx_t
   fd_feature_entry_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_feature_entry_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_feature_entry_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   ulong description_len;
   err = fd_bincode_uint64_decode( &description_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( description_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, description_len );
     err = fd_bincode_bytes_decode_preflight( description_len, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     err = !fd_utf8_verify( (char const *) ctx->data - description_len, description_len );
@@ -13917,6 +16167,17 @@ int fd_feature_entry_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_feature_entry_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_feature_entry_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_feature_entry_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_feature_entry_t);
+  int err = fd_feature_entry_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_feature_entry_decode_unsafe( fd_feature_entry_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->pubkey, ctx );
   fd_bincode_uint64_decode_unsafe( &self->description_len, ctx );
@@ -13927,6 +16188,15 @@ void fd_feature_entry_decode_unsafe( fd_feature_entry_t * self, fd_bincode_decod
     self->description = NULL;
   fd_bincode_uint64_decode_unsafe( &self->since_slot, ctx );
 }
+fd_feature_entry_t * fd_feature_entry_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_feature_entry_t * self = (fd_feature_entry_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_feature_entry_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_feature_entry_new( self );
+  fd_feature_entry_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_feature_entry_encode( fd_feature_entry_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->pubkey, ctx );
@@ -13943,15 +16213,17 @@ int fd_feature_entry_encode( fd_feature_entry_t const * self, fd_bincode_encode_
 }
 int fd_feature_entry_decode_offsets( fd_feature_entry_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->pubkey_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->description_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong description_len;
   err = fd_bincode_uint64_decode( &description_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( description_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, description_len );
     err = fd_bincode_bytes_decode_preflight( description_len, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     err = !fd_utf8_verify( (char const *) ctx->data - description_len, description_len );
@@ -14006,23 +16278,23 @@ int fd_firedancer_bank_decode( fd_firedancer_bank_t * self, fd_bincode_decode_ct
   fd_firedancer_bank_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_firedancer_bank_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_firedancer_bank_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_stakes_decode_preflight( ctx );
+  err = fd_stakes_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_recent_block_hashes_decode_preflight( ctx );
+  err = fd_recent_block_hashes_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_clock_timestamp_votes_decode_preflight( ctx );
+  err = fd_clock_timestamp_votes_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_fee_rate_governor_decode_preflight( ctx );
+  err = fd_fee_rate_governor_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -14042,22 +16314,33 @@ int fd_firedancer_bank_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_inflation_decode_preflight( ctx );
+  err = fd_inflation_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_epoch_schedule_decode_preflight( ctx );
+  err = fd_epoch_schedule_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_rent_decode_preflight( ctx );
+  err = fd_rent_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_vote_accounts_decode_preflight( ctx );
+  err = fd_vote_accounts_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_sol_sysvar_last_restart_slot_decode_preflight( ctx );
+  err = fd_sol_sysvar_last_restart_slot_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_firedancer_bank_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_firedancer_bank_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_firedancer_bank_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_firedancer_bank_t);
+  int err = fd_firedancer_bank_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_firedancer_bank_decode_unsafe( fd_firedancer_bank_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_stakes_decode_unsafe( &self->stakes, ctx );
   fd_recent_block_hashes_decode_unsafe( &self->recent_block_hashes, ctx );
@@ -14084,6 +16367,15 @@ void fd_firedancer_bank_decode_unsafe( fd_firedancer_bank_t * self, fd_bincode_d
   fd_vote_accounts_decode_unsafe( &self->epoch_stakes, ctx );
   fd_sol_sysvar_last_restart_slot_decode_unsafe( &self->last_restart_slot, ctx );
 }
+fd_firedancer_bank_t * fd_firedancer_bank_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_firedancer_bank_t * self = (fd_firedancer_bank_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_firedancer_bank_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_firedancer_bank_new( self );
+  fd_firedancer_bank_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_firedancer_bank_encode( fd_firedancer_bank_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_stakes_encode( &self->stakes, ctx );
@@ -14138,15 +16430,16 @@ int fd_firedancer_bank_encode( fd_firedancer_bank_t const * self, fd_bincode_enc
 }
 int fd_firedancer_bank_decode_offsets( fd_firedancer_bank_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->stakes_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_stakes_decode_preflight( ctx );
+  err = fd_stakes_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->recent_block_hashes_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_recent_block_hashes_decode_preflight( ctx );
+  err = fd_recent_block_hashes_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->timestamp_votes_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_clock_timestamp_votes_decode_preflight( ctx );
+  err = fd_clock_timestamp_votes_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->slot_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -14155,13 +16448,13 @@ int fd_firedancer_bank_decode_offsets( fd_firedancer_bank_off_t * self, fd_binco
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->poh_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->banks_hash_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->fee_rate_governor_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_fee_rate_governor_decode_preflight( ctx );
+  err = fd_fee_rate_governor_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->capitalization_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -14191,13 +16484,13 @@ int fd_firedancer_bank_decode_offsets( fd_firedancer_bank_off_t * self, fd_binco
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->inflation_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_inflation_decode_preflight( ctx );
+  err = fd_inflation_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->epoch_schedule_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_epoch_schedule_decode_preflight( ctx );
+  err = fd_epoch_schedule_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->rent_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_rent_decode_preflight( ctx );
+  err = fd_rent_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->collected_fees_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -14206,10 +16499,10 @@ int fd_firedancer_bank_decode_offsets( fd_firedancer_bank_off_t * self, fd_binco
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->epoch_stakes_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_vote_accounts_decode_preflight( ctx );
+  err = fd_vote_accounts_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->last_restart_slot_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_sol_sysvar_last_restart_slot_decode_preflight( ctx );
+  err = fd_sol_sysvar_last_restart_slot_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -14314,7 +16607,7 @@ FD_FN_PURE uchar fd_cluster_type_is_Development(fd_cluster_type_t const * self)
   return self->discriminant == 3;
 }
 void fd_cluster_type_inner_new( fd_cluster_type_inner_t * self, uint discriminant );
-int fd_cluster_type_inner_decode_preflight( uint discriminant, fd_bincode_decode_ctx_t * ctx ) {
+int fd_cluster_type_inner_decode_footprint( uint discriminant, fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   switch (discriminant) {
   case 0: {
@@ -14359,16 +16652,36 @@ int fd_cluster_type_decode( fd_cluster_type_t * self, fd_bincode_decode_ctx_t *
   fd_cluster_type_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_cluster_type_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_cluster_type_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   uint discriminant = 0;
   int err = fd_bincode_uint32_decode( &discriminant, ctx );
   if( FD_UNLIKELY( err ) ) return err;
-  return fd_cluster_type_inner_decode_preflight( discriminant, ctx );
+  return fd_cluster_type_inner_decode_footprint( discriminant, ctx, total_sz );
+}
+int fd_cluster_type_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_cluster_type_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_cluster_type_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_cluster_type_t);
+  int err = fd_cluster_type_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
 }
 void fd_cluster_type_decode_unsafe( fd_cluster_type_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint32_decode_unsafe( &self->discriminant, ctx );
   fd_cluster_type_inner_decode_unsafe( &self->inner, self->discriminant, ctx );
 }
+fd_cluster_type_t * fd_cluster_type_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_cluster_type_t * self = (fd_cluster_type_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_cluster_type_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_cluster_type_new( self );
+  fd_cluster_type_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 void fd_cluster_type_inner_new( fd_cluster_type_inner_t * self, uint discriminant ) {
   switch( discriminant ) {
   case 0: {
@@ -14456,9 +16769,9 @@ int fd_epoch_bank_decode( fd_epoch_bank_t * self, fd_bincode_decode_ctx_t * ctx
   fd_epoch_bank_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_epoch_bank_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_epoch_bank_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_stakes_decode_preflight( ctx );
+  err = fd_stakes_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -14472,11 +16785,11 @@ int fd_epoch_bank_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_inflation_decode_preflight( ctx );
+  err = fd_inflation_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_epoch_schedule_decode_preflight( ctx );
+  err = fd_epoch_schedule_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_rent_decode_preflight( ctx );
+  err = fd_rent_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -14484,7 +16797,7 @@ int fd_epoch_bank_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint32_decode_preflight( ctx );
   if( FD_UNLIKELY( err ) ) return err;
@@ -14492,12 +16805,23 @@ int fd_epoch_bank_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
     err = fd_bincode_uint32_decode_preflight( ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   }
-  err = fd_vote_accounts_decode_preflight( ctx );
+  err = fd_vote_accounts_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_epoch_schedule_decode_preflight( ctx );
+  err = fd_epoch_schedule_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_epoch_bank_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_epoch_bank_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_epoch_bank_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_epoch_bank_t);
+  int err = fd_epoch_bank_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_epoch_bank_decode_unsafe( fd_epoch_bank_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_stakes_decode_unsafe( &self->stakes, ctx );
   fd_bincode_uint64_decode_unsafe( &self->hashes_per_tick, ctx );
@@ -14520,6 +16844,15 @@ void fd_epoch_bank_decode_unsafe( fd_epoch_bank_t * self, fd_bincode_decode_ctx_
   fd_vote_accounts_decode_unsafe( &self->next_epoch_stakes, ctx );
   fd_epoch_schedule_decode_unsafe( &self->rent_epoch_schedule, ctx );
 }
+fd_epoch_bank_t * fd_epoch_bank_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_epoch_bank_t * self = (fd_epoch_bank_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_epoch_bank_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_epoch_bank_new( self );
+  fd_epoch_bank_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_epoch_bank_encode( fd_epoch_bank_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_stakes_encode( &self->stakes, ctx );
@@ -14944,9 +17277,10 @@ int fd_epoch_bank_encode_archival( fd_epoch_bank_t const * self, fd_bincode_enco
 }
 int fd_epoch_bank_decode_offsets( fd_epoch_bank_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->stakes_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_stakes_decode_preflight( ctx );
+  err = fd_stakes_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->hashes_per_tick_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -14967,13 +17301,13 @@ int fd_epoch_bank_decode_offsets( fd_epoch_bank_off_t * self, fd_bincode_decode_
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->inflation_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_inflation_decode_preflight( ctx );
+  err = fd_inflation_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->epoch_schedule_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_epoch_schedule_decode_preflight( ctx );
+  err = fd_epoch_schedule_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->rent_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_rent_decode_preflight( ctx );
+  err = fd_rent_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->eah_start_slot_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -14985,7 +17319,7 @@ int fd_epoch_bank_decode_offsets( fd_epoch_bank_off_t * self, fd_bincode_decode_
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->genesis_hash_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->cluster_type_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint32_decode_preflight( ctx );
@@ -14996,10 +17330,10 @@ int fd_epoch_bank_decode_offsets( fd_epoch_bank_off_t * self, fd_bincode_decode_
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   }
   self->next_epoch_stakes_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_vote_accounts_decode_preflight( ctx );
+  err = fd_vote_accounts_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->rent_epoch_schedule_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_epoch_schedule_decode_preflight( ctx );
+  err = fd_epoch_schedule_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -15085,21 +17419,21 @@ int fd_slot_bank_decode( fd_slot_bank_t * self, fd_bincode_decode_ctx_t * ctx )
   fd_slot_bank_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_slot_bank_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_slot_bank_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_clock_timestamp_votes_decode_preflight( ctx );
+  err = fd_clock_timestamp_votes_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_fee_rate_governor_decode_preflight( ctx );
+  err = fd_fee_rate_governor_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -15113,23 +17447,23 @@ int fd_slot_bank_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_vote_accounts_decode_preflight( ctx );
+  err = fd_vote_accounts_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_sol_sysvar_last_restart_slot_decode_preflight( ctx );
+  err = fd_sol_sysvar_last_restart_slot_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_account_keys_decode_preflight( ctx );
+  err = fd_account_keys_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_account_keys_decode_preflight( ctx );
+  err = fd_account_keys_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_slot_lthash_decode_preflight( ctx );
+  err = fd_slot_lthash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_block_hash_queue_decode_preflight( ctx );
+  err = fd_block_hash_queue_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -15144,10 +17478,21 @@ int fd_slot_bank_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
-  err = fd_hard_forks_decode_preflight( ctx );
+  err = fd_hard_forks_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_slot_bank_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_slot_bank_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_slot_bank_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_slot_bank_t);
+  int err = fd_slot_bank_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_slot_bank_decode_unsafe( fd_slot_bank_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_clock_timestamp_votes_decode_unsafe( &self->timestamp_votes, ctx );
   fd_bincode_uint64_decode_unsafe( &self->slot, ctx );
@@ -15183,6 +17528,15 @@ void fd_slot_bank_decode_unsafe( fd_slot_bank_t * self, fd_bincode_decode_ctx_t
   }
   fd_hard_forks_decode_unsafe( &self->hard_forks, ctx );
 }
+fd_slot_bank_t * fd_slot_bank_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_slot_bank_t * self = (fd_slot_bank_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_slot_bank_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_slot_bank_new( self );
+  fd_slot_bank_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_slot_bank_encode( fd_slot_bank_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_clock_timestamp_votes_encode( &self->timestamp_votes, ctx );
@@ -15803,9 +18157,10 @@ int fd_slot_bank_encode_archival( fd_slot_bank_t const * self, fd_bincode_encode
 }
 int fd_slot_bank_decode_offsets( fd_slot_bank_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->timestamp_votes_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_clock_timestamp_votes_decode_preflight( ctx );
+  err = fd_clock_timestamp_votes_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->slot_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -15814,16 +18169,16 @@ int fd_slot_bank_decode_offsets( fd_slot_bank_off_t * self, fd_bincode_decode_ct
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->poh_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->banks_hash_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->epoch_account_hash_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->fee_rate_governor_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_fee_rate_governor_decode_preflight( ctx );
+  err = fd_fee_rate_governor_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->capitalization_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -15844,16 +18199,16 @@ int fd_slot_bank_decode_offsets( fd_slot_bank_off_t * self, fd_bincode_decode_ct
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->epoch_stakes_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_vote_accounts_decode_preflight( ctx );
+  err = fd_vote_accounts_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->last_restart_slot_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_sol_sysvar_last_restart_slot_decode_preflight( ctx );
+  err = fd_sol_sysvar_last_restart_slot_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->stake_account_keys_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_account_keys_decode_preflight( ctx );
+  err = fd_account_keys_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->vote_account_keys_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_account_keys_decode_preflight( ctx );
+  err = fd_account_keys_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->lamports_per_signature_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -15862,13 +18217,13 @@ int fd_slot_bank_decode_offsets( fd_slot_bank_off_t * self, fd_bincode_decode_ct
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->lthash_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_slot_lthash_decode_preflight( ctx );
+  err = fd_slot_lthash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->block_hash_queue_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_block_hash_queue_decode_preflight( ctx );
+  err = fd_block_hash_queue_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->prev_banks_hash_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->parent_signature_cnt_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -15887,7 +18242,7 @@ int fd_slot_bank_decode_offsets( fd_slot_bank_off_t * self, fd_bincode_decode_ct
     }
   }
   self->hard_forks_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_hard_forks_decode_preflight( ctx );
+  err = fd_hard_forks_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -16008,15 +18363,35 @@ int fd_prev_epoch_inflation_rewards_decode( fd_prev_epoch_inflation_rewards_t *
   fd_prev_epoch_inflation_rewards_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_prev_epoch_inflation_rewards_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_prev_epoch_inflation_rewards_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 32, ctx );
 }
+int fd_prev_epoch_inflation_rewards_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_prev_epoch_inflation_rewards_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_prev_epoch_inflation_rewards_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_prev_epoch_inflation_rewards_t);
+  int err = fd_prev_epoch_inflation_rewards_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_prev_epoch_inflation_rewards_decode_unsafe( fd_prev_epoch_inflation_rewards_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->validator_rewards, ctx );
   fd_bincode_double_decode_unsafe( &self->prev_epoch_duration_in_years, ctx );
   fd_bincode_double_decode_unsafe( &self->validator_rate, ctx );
   fd_bincode_double_decode_unsafe( &self->foundation_rate, ctx );
 }
+fd_prev_epoch_inflation_rewards_t * fd_prev_epoch_inflation_rewards_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_prev_epoch_inflation_rewards_t * self = (fd_prev_epoch_inflation_rewards_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_prev_epoch_inflation_rewards_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_prev_epoch_inflation_rewards_new( self );
+  fd_prev_epoch_inflation_rewards_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_prev_epoch_inflation_rewards_encode( fd_prev_epoch_inflation_rewards_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->validator_rewards, ctx );
@@ -16031,6 +18406,7 @@ int fd_prev_epoch_inflation_rewards_encode( fd_prev_epoch_inflation_rewards_t co
 }
 int fd_prev_epoch_inflation_rewards_decode_offsets( fd_prev_epoch_inflation_rewards_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->validator_rewards_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -16054,6 +18430,7 @@ void fd_prev_epoch_inflation_rewards_destroy( fd_prev_epoch_inflation_rewards_t
 
 ulong fd_prev_epoch_inflation_rewards_footprint( void ){ return FD_PREV_EPOCH_INFLATION_REWARDS_FOOTPRINT; }
 ulong fd_prev_epoch_inflation_rewards_align( void ){ return FD_PREV_EPOCH_INFLATION_REWARDS_ALIGN; }
+FD_STATIC_ASSERT( sizeof(fd_prev_epoch_inflation_rewards_t)==32UL, fd_prev_epoch_inflation_rewards_view );
 
 void fd_prev_epoch_inflation_rewards_walk( void * w, fd_prev_epoch_inflation_rewards_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_prev_epoch_inflation_rewards", level++ );
@@ -16083,28 +18460,41 @@ int fd_vote_decode( fd_vote_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_vote_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_vote_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_vote_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   ulong slots_len;
   err = fd_bincode_uint64_decode( &slots_len, ctx );
   if( FD_UNLIKELY( err ) ) return err;
+  *total_sz = fd_bincode_footprint_alloc( *total_sz, deq_ulong_align(), deq_ulong_footprint( fd_ulong_max( slots_len, 1UL ) ) );
   ulong slots_sz;
   if( FD_UNLIKELY( __builtin_umull_overflow( slots_len, 8, &slots_sz ) ) ) return FD_BINCODE_ERR_UNDERFLOW;
   err = fd_bincode_bytes_decode_preflight( slots_sz, ctx );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   {
     uchar o;
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
+      *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, sizeof(long) );
       err = fd_bincode_int64_decode_preflight( ctx );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_vote_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_vote_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_vote_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_vote_t);
+  int err = fd_vote_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_vote_decode_unsafe( fd_vote_t * self, fd_bincode_decode_ctx_t * ctx ) {
   ulong slots_len;
   fd_bincode_uint64_decode_unsafe( &slots_len, ctx );
@@ -16124,6 +18514,15 @@ void fd_vote_decode_unsafe( fd_vote_t * self, fd_bincode_decode_ctx_t * ctx ) {
       self->timestamp = NULL;
   }
 }
+fd_vote_t * fd_vote_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_vote_t * self = (fd_vote_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_vote_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_vote_new( self );
+  fd_vote_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_vote_encode( fd_vote_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   if( self->slots ) {
@@ -16154,17 +18553,19 @@ int fd_vote_encode( fd_vote_t const * self, fd_bincode_encode_ctx_t * ctx ) {
 }
 int fd_vote_decode_offsets( fd_vote_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->slots_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong slots_len;
   err = fd_bincode_uint64_decode( &slots_len, ctx );
   if( FD_UNLIKELY( err ) ) return err;
+  *total_sz = fd_bincode_footprint_alloc( *total_sz, deq_ulong_align(), deq_ulong_footprint( fd_ulong_max( slots_len, 1UL ) ) );
   ulong slots_sz;
   if( FD_UNLIKELY( __builtin_umull_overflow( slots_len, 8, &slots_sz ) ) ) return FD_BINCODE_ERR_UNDERFLOW;
   err = fd_bincode_bytes_decode_preflight( slots_sz, ctx );
   if( FD_UNLIKELY( err ) ) return err;
   self->hash_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->timestamp_off = (uint)( (ulong)ctx->data - (ulong)data );
   {
@@ -16172,6 +18573,7 @@ int fd_vote_decode_offsets( fd_vote_off_t * self, fd_bincode_decode_ctx_t * ctx
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
+      *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, sizeof(long) );
       err = fd_bincode_int64_decode_preflight( ctx );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
@@ -16249,15 +18651,35 @@ int fd_vote_init_decode( fd_vote_init_t * self, fd_bincode_decode_ctx_t * ctx )
   fd_vote_init_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_vote_init_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_vote_init_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 97, ctx );
 }
+int fd_vote_init_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_vote_init_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_vote_init_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_vote_init_t);
+  int err = fd_vote_init_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_vote_init_decode_unsafe( fd_vote_init_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->node_pubkey, ctx );
   fd_pubkey_decode_unsafe( &self->authorized_voter, ctx );
   fd_pubkey_decode_unsafe( &self->authorized_withdrawer, ctx );
   fd_bincode_uint8_decode_unsafe( &self->commission, ctx );
 }
+fd_vote_init_t * fd_vote_init_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_vote_init_t * self = (fd_vote_init_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_vote_init_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_vote_init_new( self );
+  fd_vote_init_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_vote_init_encode( fd_vote_init_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->node_pubkey, ctx );
@@ -16272,15 +18694,16 @@ int fd_vote_init_encode( fd_vote_init_t const * self, fd_bincode_encode_ctx_t *
 }
 int fd_vote_init_decode_offsets( fd_vote_init_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->node_pubkey_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->authorized_voter_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->authorized_withdrawer_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->commission_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint8_decode_preflight( ctx );
@@ -16326,7 +18749,7 @@ FD_FN_PURE uchar fd_vote_authorize_is_withdrawer(fd_vote_authorize_t const * sel
   return self->discriminant == 1;
 }
 void fd_vote_authorize_inner_new( fd_vote_authorize_inner_t * self, uint discriminant );
-int fd_vote_authorize_inner_decode_preflight( uint discriminant, fd_bincode_decode_ctx_t * ctx ) {
+int fd_vote_authorize_inner_decode_footprint( uint discriminant, fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   switch (discriminant) {
   case 0: {
@@ -16359,16 +18782,36 @@ int fd_vote_authorize_decode( fd_vote_authorize_t * self, fd_bincode_decode_ctx_
   fd_vote_authorize_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_vote_authorize_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_vote_authorize_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   uint discriminant = 0;
   int err = fd_bincode_uint32_decode( &discriminant, ctx );
   if( FD_UNLIKELY( err ) ) return err;
-  return fd_vote_authorize_inner_decode_preflight( discriminant, ctx );
+  return fd_vote_authorize_inner_decode_footprint( discriminant, ctx, total_sz );
+}
+int fd_vote_authorize_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_vote_authorize_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_vote_authorize_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_vote_authorize_t);
+  int err = fd_vote_authorize_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
 }
 void fd_vote_authorize_decode_unsafe( fd_vote_authorize_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint32_decode_unsafe( &self->discriminant, ctx );
   fd_vote_authorize_inner_decode_unsafe( &self->inner, self->discriminant, ctx );
 }
+fd_vote_authorize_t * fd_vote_authorize_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_vote_authorize_t * self = (fd_vote_authorize_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_vote_authorize_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_vote_authorize_new( self );
+  fd_vote_authorize_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 void fd_vote_authorize_inner_new( fd_vote_authorize_inner_t * self, uint discriminant ) {
   switch( discriminant ) {
   case 0: {
@@ -16442,18 +18885,38 @@ int fd_vote_authorize_pubkey_decode( fd_vote_authorize_pubkey_t * self, fd_binco
   fd_vote_authorize_pubkey_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_vote_authorize_pubkey_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_vote_authorize_pubkey_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_vote_authorize_decode_preflight( ctx );
+  err = fd_vote_authorize_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_vote_authorize_pubkey_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_vote_authorize_pubkey_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_vote_authorize_pubkey_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_vote_authorize_pubkey_t);
+  int err = fd_vote_authorize_pubkey_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_vote_authorize_pubkey_decode_unsafe( fd_vote_authorize_pubkey_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->pubkey, ctx );
   fd_vote_authorize_decode_unsafe( &self->vote_authorize, ctx );
 }
+fd_vote_authorize_pubkey_t * fd_vote_authorize_pubkey_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_vote_authorize_pubkey_t * self = (fd_vote_authorize_pubkey_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_vote_authorize_pubkey_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_vote_authorize_pubkey_new( self );
+  fd_vote_authorize_pubkey_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_vote_authorize_pubkey_encode( fd_vote_authorize_pubkey_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->pubkey, ctx );
@@ -16464,12 +18927,13 @@ int fd_vote_authorize_pubkey_encode( fd_vote_authorize_pubkey_t const * self, fd
 }
 int fd_vote_authorize_pubkey_decode_offsets( fd_vote_authorize_pubkey_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->pubkey_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->vote_authorize_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_vote_authorize_decode_preflight( ctx );
+  err = fd_vote_authorize_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -16510,18 +18974,38 @@ int fd_vote_switch_decode( fd_vote_switch_t * self, fd_bincode_decode_ctx_t * ct
   fd_vote_switch_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_vote_switch_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_vote_switch_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_vote_decode_preflight( ctx );
+  err = fd_vote_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_vote_switch_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_vote_switch_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_vote_switch_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_vote_switch_t);
+  int err = fd_vote_switch_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_vote_switch_decode_unsafe( fd_vote_switch_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_vote_decode_unsafe( &self->vote, ctx );
   fd_hash_decode_unsafe( &self->hash, ctx );
 }
+fd_vote_switch_t * fd_vote_switch_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_vote_switch_t * self = (fd_vote_switch_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_vote_switch_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_vote_switch_new( self );
+  fd_vote_switch_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_vote_switch_encode( fd_vote_switch_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_vote_encode( &self->vote, ctx );
@@ -16532,12 +19016,13 @@ int fd_vote_switch_encode( fd_vote_switch_t const * self, fd_bincode_encode_ctx_
 }
 int fd_vote_switch_decode_offsets( fd_vote_switch_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->vote_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_vote_decode_preflight( ctx );
+  err = fd_vote_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->hash_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -16578,18 +19063,38 @@ int fd_update_vote_state_switch_decode( fd_update_vote_state_switch_t * self, fd
   fd_update_vote_state_switch_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_update_vote_state_switch_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_update_vote_state_switch_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_vote_state_update_decode_preflight( ctx );
+  err = fd_vote_state_update_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_update_vote_state_switch_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_update_vote_state_switch_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_update_vote_state_switch_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_update_vote_state_switch_t);
+  int err = fd_update_vote_state_switch_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_update_vote_state_switch_decode_unsafe( fd_update_vote_state_switch_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_vote_state_update_decode_unsafe( &self->vote_state_update, ctx );
   fd_hash_decode_unsafe( &self->hash, ctx );
 }
+fd_update_vote_state_switch_t * fd_update_vote_state_switch_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_update_vote_state_switch_t * self = (fd_update_vote_state_switch_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_update_vote_state_switch_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_update_vote_state_switch_new( self );
+  fd_update_vote_state_switch_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_update_vote_state_switch_encode( fd_update_vote_state_switch_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_vote_state_update_encode( &self->vote_state_update, ctx );
@@ -16600,12 +19105,13 @@ int fd_update_vote_state_switch_encode( fd_update_vote_state_switch_t const * se
 }
 int fd_update_vote_state_switch_decode_offsets( fd_update_vote_state_switch_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->vote_state_update_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_vote_state_update_decode_preflight( ctx );
+  err = fd_vote_state_update_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->hash_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -16646,25 +19152,37 @@ int fd_vote_authorize_with_seed_args_decode( fd_vote_authorize_with_seed_args_t
   fd_vote_authorize_with_seed_args_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_vote_authorize_with_seed_args_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_vote_authorize_with_seed_args_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_vote_authorize_decode_preflight( ctx );
+  err = fd_vote_authorize_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   ulong current_authority_derived_key_seed_len;
   err = fd_bincode_uint64_decode( &current_authority_derived_key_seed_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( current_authority_derived_key_seed_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, current_authority_derived_key_seed_len );
     err = fd_bincode_bytes_decode_preflight( current_authority_derived_key_seed_len, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     err = !fd_utf8_verify( (char const *) ctx->data - current_authority_derived_key_seed_len, current_authority_derived_key_seed_len );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   }
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_vote_authorize_with_seed_args_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_vote_authorize_with_seed_args_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_vote_authorize_with_seed_args_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_vote_authorize_with_seed_args_t);
+  int err = fd_vote_authorize_with_seed_args_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_vote_authorize_with_seed_args_decode_unsafe( fd_vote_authorize_with_seed_args_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_vote_authorize_decode_unsafe( &self->authorization_type, ctx );
   fd_pubkey_decode_unsafe( &self->current_authority_derived_key_owner, ctx );
@@ -16676,6 +19194,15 @@ void fd_vote_authorize_with_seed_args_decode_unsafe( fd_vote_authorize_with_seed
     self->current_authority_derived_key_seed = NULL;
   fd_pubkey_decode_unsafe( &self->new_authority, ctx );
 }
+fd_vote_authorize_with_seed_args_t * fd_vote_authorize_with_seed_args_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_vote_authorize_with_seed_args_t * self = (fd_vote_authorize_with_seed_args_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_vote_authorize_with_seed_args_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_vote_authorize_with_seed_args_new( self );
+  fd_vote_authorize_with_seed_args_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_vote_authorize_with_seed_args_encode( fd_vote_authorize_with_seed_args_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_vote_authorize_encode( &self->authorization_type, ctx );
@@ -16694,25 +19221,27 @@ int fd_vote_authorize_with_seed_args_encode( fd_vote_authorize_with_seed_args_t
 }
 int fd_vote_authorize_with_seed_args_decode_offsets( fd_vote_authorize_with_seed_args_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->authorization_type_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_vote_authorize_decode_preflight( ctx );
+  err = fd_vote_authorize_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->current_authority_derived_key_owner_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->current_authority_derived_key_seed_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong current_authority_derived_key_seed_len;
   err = fd_bincode_uint64_decode( &current_authority_derived_key_seed_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( current_authority_derived_key_seed_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, current_authority_derived_key_seed_len );
     err = fd_bincode_bytes_decode_preflight( current_authority_derived_key_seed_len, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     err = !fd_utf8_verify( (char const *) ctx->data - current_authority_derived_key_seed_len, current_authority_derived_key_seed_len );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   }
   self->new_authority_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -16766,16 +19295,17 @@ int fd_vote_authorize_checked_with_seed_args_decode( fd_vote_authorize_checked_w
   fd_vote_authorize_checked_with_seed_args_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_vote_authorize_checked_with_seed_args_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_vote_authorize_checked_with_seed_args_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_vote_authorize_decode_preflight( ctx );
+  err = fd_vote_authorize_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   ulong current_authority_derived_key_seed_len;
   err = fd_bincode_uint64_decode( &current_authority_derived_key_seed_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( current_authority_derived_key_seed_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, current_authority_derived_key_seed_len );
     err = fd_bincode_bytes_decode_preflight( current_authority_derived_key_seed_len, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     err = !fd_utf8_verify( (char const *) ctx->data - current_authority_derived_key_seed_len, current_authority_derived_key_seed_len );
@@ -16783,6 +19313,17 @@ int fd_vote_authorize_checked_with_seed_args_decode_preflight( fd_bincode_decode
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_vote_authorize_checked_with_seed_args_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_vote_authorize_checked_with_seed_args_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_vote_authorize_checked_with_seed_args_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_vote_authorize_checked_with_seed_args_t);
+  int err = fd_vote_authorize_checked_with_seed_args_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_vote_authorize_checked_with_seed_args_decode_unsafe( fd_vote_authorize_checked_with_seed_args_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_vote_authorize_decode_unsafe( &self->authorization_type, ctx );
   fd_pubkey_decode_unsafe( &self->current_authority_derived_key_owner, ctx );
@@ -16793,6 +19334,15 @@ void fd_vote_authorize_checked_with_seed_args_decode_unsafe( fd_vote_authorize_c
   } else
     self->current_authority_derived_key_seed = NULL;
 }
+fd_vote_authorize_checked_with_seed_args_t * fd_vote_authorize_checked_with_seed_args_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_vote_authorize_checked_with_seed_args_t * self = (fd_vote_authorize_checked_with_seed_args_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_vote_authorize_checked_with_seed_args_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_vote_authorize_checked_with_seed_args_new( self );
+  fd_vote_authorize_checked_with_seed_args_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_vote_authorize_checked_with_seed_args_encode( fd_vote_authorize_checked_with_seed_args_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_vote_authorize_encode( &self->authorization_type, ctx );
@@ -16809,18 +19359,20 @@ int fd_vote_authorize_checked_with_seed_args_encode( fd_vote_authorize_checked_w
 }
 int fd_vote_authorize_checked_with_seed_args_decode_offsets( fd_vote_authorize_checked_with_seed_args_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->authorization_type_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_vote_authorize_decode_preflight( ctx );
+  err = fd_vote_authorize_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->current_authority_derived_key_owner_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->current_authority_derived_key_seed_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong current_authority_derived_key_seed_len;
   err = fd_bincode_uint64_decode( &current_authority_derived_key_seed_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( current_authority_derived_key_seed_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, current_authority_derived_key_seed_len );
     err = fd_bincode_bytes_decode_preflight( current_authority_derived_key_seed_len, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     err = !fd_utf8_verify( (char const *) ctx->data - current_authority_derived_key_seed_len, current_authority_derived_key_seed_len );
@@ -16912,21 +19464,21 @@ FD_FN_PURE uchar fd_vote_instruction_is_tower_sync_switch(fd_vote_instruction_t
   return self->discriminant == 15;
 }
 void fd_vote_instruction_inner_new( fd_vote_instruction_inner_t * self, uint discriminant );
-int fd_vote_instruction_inner_decode_preflight( uint discriminant, fd_bincode_decode_ctx_t * ctx ) {
+int fd_vote_instruction_inner_decode_footprint( uint discriminant, fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   switch (discriminant) {
   case 0: {
-    err = fd_vote_init_decode_preflight( ctx );
+    err = fd_vote_init_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 1: {
-    err = fd_vote_authorize_pubkey_decode_preflight( ctx );
+    err = fd_vote_authorize_pubkey_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 2: {
-    err = fd_vote_decode_preflight( ctx );
+    err = fd_vote_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
@@ -16944,52 +19496,52 @@ int fd_vote_instruction_inner_decode_preflight( uint discriminant, fd_bincode_de
     return FD_BINCODE_SUCCESS;
   }
   case 6: {
-    err = fd_vote_switch_decode_preflight( ctx );
+    err = fd_vote_switch_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 7: {
-    err = fd_vote_authorize_decode_preflight( ctx );
+    err = fd_vote_authorize_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 8: {
-    err = fd_vote_state_update_decode_preflight( ctx );
+    err = fd_vote_state_update_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 9: {
-    err = fd_update_vote_state_switch_decode_preflight( ctx );
+    err = fd_update_vote_state_switch_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 10: {
-    err = fd_vote_authorize_with_seed_args_decode_preflight( ctx );
+    err = fd_vote_authorize_with_seed_args_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 11: {
-    err = fd_vote_authorize_checked_with_seed_args_decode_preflight( ctx );
+    err = fd_vote_authorize_checked_with_seed_args_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 12: {
-    err = fd_compact_vote_state_update_decode_preflight( ctx );
+    err = fd_compact_vote_state_update_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 13: {
-    err = fd_compact_vote_state_update_switch_decode_preflight( ctx );
+    err = fd_compact_vote_state_update_switch_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 14: {
-    err = fd_tower_sync_decode_preflight( ctx );
+    err = fd_tower_sync_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 15: {
-    err = fd_tower_sync_switch_decode_preflight( ctx );
+    err = fd_tower_sync_switch_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
@@ -17074,16 +19626,36 @@ int fd_vote_instruction_decode( fd_vote_instruction_t * self, fd_bincode_decode_
   fd_vote_instruction_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_vote_instruction_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_vote_instruction_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   uint discriminant = 0;
   int err = fd_bincode_uint32_decode( &discriminant, ctx );
   if( FD_UNLIKELY( err ) ) return err;
-  return fd_vote_instruction_inner_decode_preflight( discriminant, ctx );
+  return fd_vote_instruction_inner_decode_footprint( discriminant, ctx, total_sz );
+}
+int fd_vote_instruction_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_vote_instruction_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_vote_instruction_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_vote_instruction_t);
+  int err = fd_vote_instruction_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
 }
 void fd_vote_instruction_decode_unsafe( fd_vote_instruction_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint32_decode_unsafe( &self->discriminant, ctx );
   fd_vote_instruction_inner_decode_unsafe( &self->inner, self->discriminant, ctx );
 }
+fd_vote_instruction_t * fd_vote_instruction_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_vote_instruction_t * self = (fd_vote_instruction_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_vote_instruction_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_vote_instruction_new( self );
+  fd_vote_instruction_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 void fd_vote_instruction_inner_new( fd_vote_instruction_inner_t * self, uint discriminant ) {
   switch( discriminant ) {
   case 0: {
@@ -17479,14 +20051,34 @@ int fd_system_program_instruction_create_account_decode( fd_system_program_instr
   fd_system_program_instruction_create_account_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_system_program_instruction_create_account_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_system_program_instruction_create_account_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 48, ctx );
 }
+int fd_system_program_instruction_create_account_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_system_program_instruction_create_account_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_system_program_instruction_create_account_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_system_program_instruction_create_account_t);
+  int err = fd_system_program_instruction_create_account_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_system_program_instruction_create_account_decode_unsafe( fd_system_program_instruction_create_account_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->lamports, ctx );
   fd_bincode_uint64_decode_unsafe( &self->space, ctx );
   fd_pubkey_decode_unsafe( &self->owner, ctx );
 }
+fd_system_program_instruction_create_account_t * fd_system_program_instruction_create_account_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_system_program_instruction_create_account_t * self = (fd_system_program_instruction_create_account_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_system_program_instruction_create_account_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_system_program_instruction_create_account_new( self );
+  fd_system_program_instruction_create_account_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_system_program_instruction_create_account_encode( fd_system_program_instruction_create_account_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->lamports, ctx );
@@ -17499,6 +20091,7 @@ int fd_system_program_instruction_create_account_encode( fd_system_program_instr
 }
 int fd_system_program_instruction_create_account_decode_offsets( fd_system_program_instruction_create_account_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->lamports_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -17507,7 +20100,7 @@ int fd_system_program_instruction_create_account_decode_offsets( fd_system_progr
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->owner_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -17521,6 +20114,7 @@ void fd_system_program_instruction_create_account_destroy( fd_system_program_ins
 
 ulong fd_system_program_instruction_create_account_footprint( void ){ return FD_SYSTEM_PROGRAM_INSTRUCTION_CREATE_ACCOUNT_FOOTPRINT; }
 ulong fd_system_program_instruction_create_account_align( void ){ return FD_SYSTEM_PROGRAM_INSTRUCTION_CREATE_ACCOUNT_ALIGN; }
+FD_STATIC_ASSERT( sizeof(fd_system_program_instruction_create_account_t)==48UL, fd_system_program_instruction_create_account_view );
 
 void fd_system_program_instruction_create_account_walk( void * w, fd_system_program_instruction_create_account_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_system_program_instruction_create_account", level++ );
@@ -17548,14 +20142,15 @@ int fd_system_program_instruction_create_account_with_seed_decode( fd_system_pro
   fd_system_program_instruction_create_account_with_seed_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_system_program_instruction_create_account_with_seed_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_system_program_instruction_create_account_with_seed_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   ulong seed_len;
   err = fd_bincode_uint64_decode( &seed_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( seed_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, seed_len );
     err = fd_bincode_bytes_decode_preflight( seed_len, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     err = !fd_utf8_verify( (char const *) ctx->data - seed_len, seed_len );
@@ -17565,10 +20160,21 @@ int fd_system_program_instruction_create_account_with_seed_decode_preflight( fd_
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_system_program_instruction_create_account_with_seed_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_system_program_instruction_create_account_with_seed_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_system_program_instruction_create_account_with_seed_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_system_program_instruction_create_account_with_seed_t);
+  int err = fd_system_program_instruction_create_account_with_seed_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_system_program_instruction_create_account_with_seed_decode_unsafe( fd_system_program_instruction_create_account_with_seed_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->base, ctx );
   fd_bincode_uint64_decode_unsafe( &self->seed_len, ctx );
@@ -17581,6 +20187,15 @@ void fd_system_program_instruction_create_account_with_seed_decode_unsafe( fd_sy
   fd_bincode_uint64_decode_unsafe( &self->space, ctx );
   fd_pubkey_decode_unsafe( &self->owner, ctx );
 }
+fd_system_program_instruction_create_account_with_seed_t * fd_system_program_instruction_create_account_with_seed_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_system_program_instruction_create_account_with_seed_t * self = (fd_system_program_instruction_create_account_with_seed_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_system_program_instruction_create_account_with_seed_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_system_program_instruction_create_account_with_seed_new( self );
+  fd_system_program_instruction_create_account_with_seed_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_system_program_instruction_create_account_with_seed_encode( fd_system_program_instruction_create_account_with_seed_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->base, ctx );
@@ -17601,15 +20216,17 @@ int fd_system_program_instruction_create_account_with_seed_encode( fd_system_pro
 }
 int fd_system_program_instruction_create_account_with_seed_decode_offsets( fd_system_program_instruction_create_account_with_seed_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->base_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->seed_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong seed_len;
   err = fd_bincode_uint64_decode( &seed_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( seed_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, seed_len );
     err = fd_bincode_bytes_decode_preflight( seed_len, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     err = !fd_utf8_verify( (char const *) ctx->data - seed_len, seed_len );
@@ -17622,7 +20239,7 @@ int fd_system_program_instruction_create_account_with_seed_decode_offsets( fd_sy
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->owner_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -17676,14 +20293,15 @@ int fd_system_program_instruction_allocate_with_seed_decode( fd_system_program_i
   fd_system_program_instruction_allocate_with_seed_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_system_program_instruction_allocate_with_seed_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_system_program_instruction_allocate_with_seed_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   ulong seed_len;
   err = fd_bincode_uint64_decode( &seed_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( seed_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, seed_len );
     err = fd_bincode_bytes_decode_preflight( seed_len, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     err = !fd_utf8_verify( (char const *) ctx->data - seed_len, seed_len );
@@ -17691,10 +20309,21 @@ int fd_system_program_instruction_allocate_with_seed_decode_preflight( fd_bincod
   }
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_system_program_instruction_allocate_with_seed_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_system_program_instruction_allocate_with_seed_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_system_program_instruction_allocate_with_seed_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_system_program_instruction_allocate_with_seed_t);
+  int err = fd_system_program_instruction_allocate_with_seed_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_system_program_instruction_allocate_with_seed_decode_unsafe( fd_system_program_instruction_allocate_with_seed_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->base, ctx );
   fd_bincode_uint64_decode_unsafe( &self->seed_len, ctx );
@@ -17706,6 +20335,15 @@ void fd_system_program_instruction_allocate_with_seed_decode_unsafe( fd_system_p
   fd_bincode_uint64_decode_unsafe( &self->space, ctx );
   fd_pubkey_decode_unsafe( &self->owner, ctx );
 }
+fd_system_program_instruction_allocate_with_seed_t * fd_system_program_instruction_allocate_with_seed_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_system_program_instruction_allocate_with_seed_t * self = (fd_system_program_instruction_allocate_with_seed_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_system_program_instruction_allocate_with_seed_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_system_program_instruction_allocate_with_seed_new( self );
+  fd_system_program_instruction_allocate_with_seed_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_system_program_instruction_allocate_with_seed_encode( fd_system_program_instruction_allocate_with_seed_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->base, ctx );
@@ -17724,15 +20362,17 @@ int fd_system_program_instruction_allocate_with_seed_encode( fd_system_program_i
 }
 int fd_system_program_instruction_allocate_with_seed_decode_offsets( fd_system_program_instruction_allocate_with_seed_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->base_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->seed_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong seed_len;
   err = fd_bincode_uint64_decode( &seed_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( seed_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, seed_len );
     err = fd_bincode_bytes_decode_preflight( seed_len, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     err = !fd_utf8_verify( (char const *) ctx->data - seed_len, seed_len );
@@ -17742,7 +20382,7 @@ int fd_system_program_instruction_allocate_with_seed_decode_offsets( fd_system_p
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->owner_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -17794,23 +20434,35 @@ int fd_system_program_instruction_assign_with_seed_decode( fd_system_program_ins
   fd_system_program_instruction_assign_with_seed_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_system_program_instruction_assign_with_seed_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_system_program_instruction_assign_with_seed_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   ulong seed_len;
   err = fd_bincode_uint64_decode( &seed_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( seed_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, seed_len );
     err = fd_bincode_bytes_decode_preflight( seed_len, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     err = !fd_utf8_verify( (char const *) ctx->data - seed_len, seed_len );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   }
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_system_program_instruction_assign_with_seed_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_system_program_instruction_assign_with_seed_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_system_program_instruction_assign_with_seed_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_system_program_instruction_assign_with_seed_t);
+  int err = fd_system_program_instruction_assign_with_seed_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_system_program_instruction_assign_with_seed_decode_unsafe( fd_system_program_instruction_assign_with_seed_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->base, ctx );
   fd_bincode_uint64_decode_unsafe( &self->seed_len, ctx );
@@ -17821,6 +20473,15 @@ void fd_system_program_instruction_assign_with_seed_decode_unsafe( fd_system_pro
     self->seed = NULL;
   fd_pubkey_decode_unsafe( &self->owner, ctx );
 }
+fd_system_program_instruction_assign_with_seed_t * fd_system_program_instruction_assign_with_seed_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_system_program_instruction_assign_with_seed_t * self = (fd_system_program_instruction_assign_with_seed_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_system_program_instruction_assign_with_seed_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_system_program_instruction_assign_with_seed_new( self );
+  fd_system_program_instruction_assign_with_seed_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_system_program_instruction_assign_with_seed_encode( fd_system_program_instruction_assign_with_seed_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->base, ctx );
@@ -17837,22 +20498,24 @@ int fd_system_program_instruction_assign_with_seed_encode( fd_system_program_ins
 }
 int fd_system_program_instruction_assign_with_seed_decode_offsets( fd_system_program_instruction_assign_with_seed_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->base_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->seed_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong seed_len;
   err = fd_bincode_uint64_decode( &seed_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( seed_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, seed_len );
     err = fd_bincode_bytes_decode_preflight( seed_len, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     err = !fd_utf8_verify( (char const *) ctx->data - seed_len, seed_len );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   }
   self->owner_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -17902,7 +20565,7 @@ int fd_system_program_instruction_transfer_with_seed_decode( fd_system_program_i
   fd_system_program_instruction_transfer_with_seed_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_system_program_instruction_transfer_with_seed_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_system_program_instruction_transfer_with_seed_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -17910,15 +20573,27 @@ int fd_system_program_instruction_transfer_with_seed_decode_preflight( fd_bincod
   err = fd_bincode_uint64_decode( &from_seed_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( from_seed_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, from_seed_len );
     err = fd_bincode_bytes_decode_preflight( from_seed_len, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     err = !fd_utf8_verify( (char const *) ctx->data - from_seed_len, from_seed_len );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   }
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_system_program_instruction_transfer_with_seed_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_system_program_instruction_transfer_with_seed_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_system_program_instruction_transfer_with_seed_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_system_program_instruction_transfer_with_seed_t);
+  int err = fd_system_program_instruction_transfer_with_seed_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_system_program_instruction_transfer_with_seed_decode_unsafe( fd_system_program_instruction_transfer_with_seed_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->lamports, ctx );
   fd_bincode_uint64_decode_unsafe( &self->from_seed_len, ctx );
@@ -17929,6 +20604,15 @@ void fd_system_program_instruction_transfer_with_seed_decode_unsafe( fd_system_p
     self->from_seed = NULL;
   fd_pubkey_decode_unsafe( &self->from_owner, ctx );
 }
+fd_system_program_instruction_transfer_with_seed_t * fd_system_program_instruction_transfer_with_seed_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_system_program_instruction_transfer_with_seed_t * self = (fd_system_program_instruction_transfer_with_seed_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_system_program_instruction_transfer_with_seed_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_system_program_instruction_transfer_with_seed_new( self );
+  fd_system_program_instruction_transfer_with_seed_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_system_program_instruction_transfer_with_seed_encode( fd_system_program_instruction_transfer_with_seed_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->lamports, ctx );
@@ -17945,6 +20629,7 @@ int fd_system_program_instruction_transfer_with_seed_encode( fd_system_program_i
 }
 int fd_system_program_instruction_transfer_with_seed_decode_offsets( fd_system_program_instruction_transfer_with_seed_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->lamports_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -17954,13 +20639,14 @@ int fd_system_program_instruction_transfer_with_seed_decode_offsets( fd_system_p
   err = fd_bincode_uint64_decode( &from_seed_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( from_seed_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, from_seed_len );
     err = fd_bincode_bytes_decode_preflight( from_seed_len, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     err = !fd_utf8_verify( (char const *) ctx->data - from_seed_len, from_seed_len );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   }
   self->from_owner_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -18037,16 +20723,16 @@ FD_FN_PURE uchar fd_system_program_instruction_is_upgrade_nonce_account(fd_syste
   return self->discriminant == 12;
 }
 void fd_system_program_instruction_inner_new( fd_system_program_instruction_inner_t * self, uint discriminant );
-int fd_system_program_instruction_inner_decode_preflight( uint discriminant, fd_bincode_decode_ctx_t * ctx ) {
+int fd_system_program_instruction_inner_decode_footprint( uint discriminant, fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   switch (discriminant) {
   case 0: {
-    err = fd_system_program_instruction_create_account_decode_preflight( ctx );
+    err = fd_system_program_instruction_create_account_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 1: {
-    err = fd_pubkey_decode_preflight( ctx );
+    err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
@@ -18056,7 +20742,7 @@ int fd_system_program_instruction_inner_decode_preflight( uint discriminant, fd_
     return FD_BINCODE_SUCCESS;
   }
   case 3: {
-    err = fd_system_program_instruction_create_account_with_seed_decode_preflight( ctx );
+    err = fd_system_program_instruction_create_account_with_seed_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
@@ -18069,12 +20755,12 @@ int fd_system_program_instruction_inner_decode_preflight( uint discriminant, fd_
     return FD_BINCODE_SUCCESS;
   }
   case 6: {
-    err = fd_pubkey_decode_preflight( ctx );
+    err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 7: {
-    err = fd_pubkey_decode_preflight( ctx );
+    err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
@@ -18084,17 +20770,17 @@ int fd_system_program_instruction_inner_decode_preflight( uint discriminant, fd_
     return FD_BINCODE_SUCCESS;
   }
   case 9: {
-    err = fd_system_program_instruction_allocate_with_seed_decode_preflight( ctx );
+    err = fd_system_program_instruction_allocate_with_seed_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 10: {
-    err = fd_system_program_instruction_assign_with_seed_decode_preflight( ctx );
+    err = fd_system_program_instruction_assign_with_seed_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 11: {
-    err = fd_system_program_instruction_transfer_with_seed_decode_preflight( ctx );
+    err = fd_system_program_instruction_transfer_with_seed_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
@@ -18169,16 +20855,36 @@ int fd_system_program_instruction_decode( fd_system_program_instruction_t * self
   fd_system_program_instruction_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_system_program_instruction_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_system_program_instruction_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   uint discriminant = 0;
   int err = fd_bincode_uint32_decode( &discriminant, ctx );
   if( FD_UNLIKELY( err ) ) return err;
-  return fd_system_program_instruction_inner_decode_preflight( discriminant, ctx );
+  return fd_system_program_instruction_inner_decode_footprint( discriminant, ctx, total_sz );
+}
+int fd_system_program_instruction_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_system_program_instruction_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_system_program_instruction_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_system_program_instruction_t);
+  int err = fd_system_program_instruction_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
 }
 void fd_system_program_instruction_decode_unsafe( fd_system_program_instruction_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint32_decode_unsafe( &self->discriminant, ctx );
   fd_system_program_instruction_inner_decode_unsafe( &self->inner, self->discriminant, ctx );
 }
+fd_system_program_instruction_t * fd_system_program_instruction_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_system_program_instruction_t * self = (fd_system_program_instruction_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_system_program_instruction_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_system_program_instruction_new( self );
+  fd_system_program_instruction_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 void fd_system_program_instruction_inner_new( fd_system_program_instruction_inner_t * self, uint discriminant ) {
   switch( discriminant ) {
   case 0: {
@@ -18508,7 +21214,7 @@ FD_FN_PURE uchar fd_system_error_is_nonce_unexpected_blockhash_value(fd_system_e
   return self->discriminant == 8;
 }
 void fd_system_error_inner_new( fd_system_error_inner_t * self, uint discriminant );
-int fd_system_error_inner_decode_preflight( uint discriminant, fd_bincode_decode_ctx_t * ctx ) {
+int fd_system_error_inner_decode_footprint( uint discriminant, fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   switch (discriminant) {
   case 0: {
@@ -18583,16 +21289,36 @@ int fd_system_error_decode( fd_system_error_t * self, fd_bincode_decode_ctx_t *
   fd_system_error_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_system_error_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_system_error_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   uint discriminant = 0;
   int err = fd_bincode_uint32_decode( &discriminant, ctx );
   if( FD_UNLIKELY( err ) ) return err;
-  return fd_system_error_inner_decode_preflight( discriminant, ctx );
+  return fd_system_error_inner_decode_footprint( discriminant, ctx, total_sz );
+}
+int fd_system_error_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_system_error_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_system_error_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_system_error_t);
+  int err = fd_system_error_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
 }
 void fd_system_error_decode_unsafe( fd_system_error_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint32_decode_unsafe( &self->discriminant, ctx );
   fd_system_error_inner_decode_unsafe( &self->inner, self->discriminant, ctx );
 }
+fd_system_error_t * fd_system_error_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_system_error_t * self = (fd_system_error_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_system_error_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_system_error_new( self );
+  fd_system_error_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 void fd_system_error_inner_new( fd_system_error_inner_t * self, uint discriminant ) {
   switch( discriminant ) {
   case 0: {
@@ -18715,13 +21441,33 @@ int fd_stake_authorized_decode( fd_stake_authorized_t * self, fd_bincode_decode_
   fd_stake_authorized_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_stake_authorized_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_stake_authorized_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 64, ctx );
 }
+int fd_stake_authorized_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_stake_authorized_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_stake_authorized_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_stake_authorized_t);
+  int err = fd_stake_authorized_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_stake_authorized_decode_unsafe( fd_stake_authorized_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->staker, ctx );
   fd_pubkey_decode_unsafe( &self->withdrawer, ctx );
 }
+fd_stake_authorized_t * fd_stake_authorized_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_stake_authorized_t * self = (fd_stake_authorized_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_stake_authorized_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_stake_authorized_new( self );
+  fd_stake_authorized_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_stake_authorized_encode( fd_stake_authorized_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->staker, ctx );
@@ -18732,12 +21478,13 @@ int fd_stake_authorized_encode( fd_stake_authorized_t const * self, fd_bincode_e
 }
 int fd_stake_authorized_decode_offsets( fd_stake_authorized_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->staker_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->withdrawer_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -18753,6 +21500,7 @@ void fd_stake_authorized_destroy( fd_stake_authorized_t * self, fd_bincode_destr
 
 ulong fd_stake_authorized_footprint( void ){ return FD_STAKE_AUTHORIZED_FOOTPRINT; }
 ulong fd_stake_authorized_align( void ){ return FD_STAKE_AUTHORIZED_ALIGN; }
+FD_STATIC_ASSERT( sizeof(fd_stake_authorized_t)==64UL, fd_stake_authorized_view );
 
 void fd_stake_authorized_walk( void * w, fd_stake_authorized_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_stake_authorized", level++ );
@@ -18778,14 +21526,34 @@ int fd_stake_lockup_decode( fd_stake_lockup_t * self, fd_bincode_decode_ctx_t *
   fd_stake_lockup_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_stake_lockup_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_stake_lockup_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 48, ctx );
 }
+int fd_stake_lockup_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_stake_lockup_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_stake_lockup_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_stake_lockup_t);
+  int err = fd_stake_lockup_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_stake_lockup_decode_unsafe( fd_stake_lockup_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( (ulong *) &self->unix_timestamp, ctx );
   fd_bincode_uint64_decode_unsafe( &self->epoch, ctx );
   fd_pubkey_decode_unsafe( &self->custodian, ctx );
 }
+fd_stake_lockup_t * fd_stake_lockup_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_stake_lockup_t * self = (fd_stake_lockup_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_stake_lockup_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_stake_lockup_new( self );
+  fd_stake_lockup_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_stake_lockup_encode( fd_stake_lockup_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( (ulong)self->unix_timestamp, ctx );
@@ -18798,6 +21566,7 @@ int fd_stake_lockup_encode( fd_stake_lockup_t const * self, fd_bincode_encode_ct
 }
 int fd_stake_lockup_decode_offsets( fd_stake_lockup_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->unix_timestamp_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -18806,7 +21575,7 @@ int fd_stake_lockup_decode_offsets( fd_stake_lockup_off_t * self, fd_bincode_dec
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->custodian_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -18820,6 +21589,7 @@ void fd_stake_lockup_destroy( fd_stake_lockup_t * self, fd_bincode_destroy_ctx_t
 
 ulong fd_stake_lockup_footprint( void ){ return FD_STAKE_LOCKUP_FOOTPRINT; }
 ulong fd_stake_lockup_align( void ){ return FD_STAKE_LOCKUP_ALIGN; }
+FD_STATIC_ASSERT( sizeof(fd_stake_lockup_t)==48UL, fd_stake_lockup_view );
 
 void fd_stake_lockup_walk( void * w, fd_stake_lockup_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_stake_lockup", level++ );
@@ -18847,13 +21617,33 @@ int fd_stake_instruction_initialize_decode( fd_stake_instruction_initialize_t *
   fd_stake_instruction_initialize_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_stake_instruction_initialize_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_stake_instruction_initialize_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 112, ctx );
 }
+int fd_stake_instruction_initialize_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_stake_instruction_initialize_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_stake_instruction_initialize_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_stake_instruction_initialize_t);
+  int err = fd_stake_instruction_initialize_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_stake_instruction_initialize_decode_unsafe( fd_stake_instruction_initialize_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_stake_authorized_decode_unsafe( &self->authorized, ctx );
   fd_stake_lockup_decode_unsafe( &self->lockup, ctx );
 }
+fd_stake_instruction_initialize_t * fd_stake_instruction_initialize_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_stake_instruction_initialize_t * self = (fd_stake_instruction_initialize_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_stake_instruction_initialize_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_stake_instruction_initialize_new( self );
+  fd_stake_instruction_initialize_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_stake_instruction_initialize_encode( fd_stake_instruction_initialize_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_stake_authorized_encode( &self->authorized, ctx );
@@ -18864,12 +21654,13 @@ int fd_stake_instruction_initialize_encode( fd_stake_instruction_initialize_t co
 }
 int fd_stake_instruction_initialize_decode_offsets( fd_stake_instruction_initialize_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->authorized_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_stake_authorized_decode_preflight( ctx );
+  err = fd_stake_authorized_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->lockup_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_stake_lockup_decode_preflight( ctx );
+  err = fd_stake_lockup_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -18885,6 +21676,7 @@ void fd_stake_instruction_initialize_destroy( fd_stake_instruction_initialize_t
 
 ulong fd_stake_instruction_initialize_footprint( void ){ return FD_STAKE_INSTRUCTION_INITIALIZE_FOOTPRINT; }
 ulong fd_stake_instruction_initialize_align( void ){ return FD_STAKE_INSTRUCTION_INITIALIZE_ALIGN; }
+FD_STATIC_ASSERT( sizeof(fd_stake_instruction_initialize_t)==112UL, fd_stake_instruction_initialize_view );
 
 void fd_stake_instruction_initialize_walk( void * w, fd_stake_instruction_initialize_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_stake_instruction_initialize", level++ );
@@ -18910,23 +21702,35 @@ int fd_stake_lockup_custodian_args_decode( fd_stake_lockup_custodian_args_t * se
   fd_stake_lockup_custodian_args_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_stake_lockup_custodian_args_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_stake_lockup_custodian_args_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_stake_lockup_decode_preflight( ctx );
+  err = fd_stake_lockup_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_sol_sysvar_clock_decode_preflight( ctx );
+  err = fd_sol_sysvar_clock_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   {
     uchar o;
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
-      err = fd_pubkey_decode_preflight( ctx );
+      *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_PUBKEY_ALIGN, FD_PUBKEY_FOOTPRINT );
+      err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_stake_lockup_custodian_args_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_stake_lockup_custodian_args_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_stake_lockup_custodian_args_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_stake_lockup_custodian_args_t);
+  int err = fd_stake_lockup_custodian_args_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_stake_lockup_custodian_args_decode_unsafe( fd_stake_lockup_custodian_args_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_stake_lockup_decode_unsafe( &self->lockup, ctx );
   fd_sol_sysvar_clock_decode_unsafe( &self->clock, ctx );
@@ -18941,6 +21745,15 @@ void fd_stake_lockup_custodian_args_decode_unsafe( fd_stake_lockup_custodian_arg
       self->custodian = NULL;
   }
 }
+fd_stake_lockup_custodian_args_t * fd_stake_lockup_custodian_args_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_stake_lockup_custodian_args_t * self = (fd_stake_lockup_custodian_args_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_stake_lockup_custodian_args_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_stake_lockup_custodian_args_new( self );
+  fd_stake_lockup_custodian_args_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_stake_lockup_custodian_args_encode( fd_stake_lockup_custodian_args_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_stake_lockup_encode( &self->lockup, ctx );
@@ -18960,12 +21773,13 @@ int fd_stake_lockup_custodian_args_encode( fd_stake_lockup_custodian_args_t cons
 }
 int fd_stake_lockup_custodian_args_decode_offsets( fd_stake_lockup_custodian_args_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->lockup_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_stake_lockup_decode_preflight( ctx );
+  err = fd_stake_lockup_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->clock_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_sol_sysvar_clock_decode_preflight( ctx );
+  err = fd_sol_sysvar_clock_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->custodian_off = (uint)( (ulong)ctx->data - (ulong)data );
   {
@@ -18973,7 +21787,8 @@ int fd_stake_lockup_custodian_args_decode_offsets( fd_stake_lockup_custodian_arg
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
-      err = fd_pubkey_decode_preflight( ctx );
+      *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_PUBKEY_ALIGN, FD_PUBKEY_FOOTPRINT );
+      err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -19026,7 +21841,7 @@ FD_FN_PURE uchar fd_stake_authorize_is_withdrawer(fd_stake_authorize_t const * s
   return self->discriminant == 1;
 }
 void fd_stake_authorize_inner_new( fd_stake_authorize_inner_t * self, uint discriminant );
-int fd_stake_authorize_inner_decode_preflight( uint discriminant, fd_bincode_decode_ctx_t * ctx ) {
+int fd_stake_authorize_inner_decode_footprint( uint discriminant, fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   switch (discriminant) {
   case 0: {
@@ -19059,16 +21874,36 @@ int fd_stake_authorize_decode( fd_stake_authorize_t * self, fd_bincode_decode_ct
   fd_stake_authorize_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_stake_authorize_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_stake_authorize_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   uint discriminant = 0;
   int err = fd_bincode_uint32_decode( &discriminant, ctx );
   if( FD_UNLIKELY( err ) ) return err;
-  return fd_stake_authorize_inner_decode_preflight( discriminant, ctx );
+  return fd_stake_authorize_inner_decode_footprint( discriminant, ctx, total_sz );
+}
+int fd_stake_authorize_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_stake_authorize_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_stake_authorize_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_stake_authorize_t);
+  int err = fd_stake_authorize_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
 }
 void fd_stake_authorize_decode_unsafe( fd_stake_authorize_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint32_decode_unsafe( &self->discriminant, ctx );
   fd_stake_authorize_inner_decode_unsafe( &self->inner, self->discriminant, ctx );
 }
+fd_stake_authorize_t * fd_stake_authorize_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_stake_authorize_t * self = (fd_stake_authorize_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_stake_authorize_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_stake_authorize_new( self );
+  fd_stake_authorize_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 void fd_stake_authorize_inner_new( fd_stake_authorize_inner_t * self, uint discriminant ) {
   switch( discriminant ) {
   case 0: {
@@ -19142,18 +21977,38 @@ int fd_stake_instruction_authorize_decode( fd_stake_instruction_authorize_t * se
   fd_stake_instruction_authorize_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_stake_instruction_authorize_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_stake_instruction_authorize_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_stake_authorize_decode_preflight( ctx );
+  err = fd_stake_authorize_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_stake_instruction_authorize_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_stake_instruction_authorize_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_stake_instruction_authorize_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_stake_instruction_authorize_t);
+  int err = fd_stake_instruction_authorize_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_stake_instruction_authorize_decode_unsafe( fd_stake_instruction_authorize_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->pubkey, ctx );
   fd_stake_authorize_decode_unsafe( &self->stake_authorize, ctx );
 }
+fd_stake_instruction_authorize_t * fd_stake_instruction_authorize_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_stake_instruction_authorize_t * self = (fd_stake_instruction_authorize_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_stake_instruction_authorize_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_stake_instruction_authorize_new( self );
+  fd_stake_instruction_authorize_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_stake_instruction_authorize_encode( fd_stake_instruction_authorize_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->pubkey, ctx );
@@ -19164,12 +22019,13 @@ int fd_stake_instruction_authorize_encode( fd_stake_instruction_authorize_t cons
 }
 int fd_stake_instruction_authorize_decode_offsets( fd_stake_instruction_authorize_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->pubkey_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->stake_authorize_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_stake_authorize_decode_preflight( ctx );
+  err = fd_stake_authorize_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -19210,25 +22066,37 @@ int fd_authorize_with_seed_args_decode( fd_authorize_with_seed_args_t * self, fd
   fd_authorize_with_seed_args_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_authorize_with_seed_args_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_authorize_with_seed_args_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_stake_authorize_decode_preflight( ctx );
+  err = fd_stake_authorize_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   ulong authority_seed_len;
   err = fd_bincode_uint64_decode( &authority_seed_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( authority_seed_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, authority_seed_len );
     err = fd_bincode_bytes_decode_preflight( authority_seed_len, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     err = !fd_utf8_verify( (char const *) ctx->data - authority_seed_len, authority_seed_len );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   }
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_authorize_with_seed_args_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_authorize_with_seed_args_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_authorize_with_seed_args_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_authorize_with_seed_args_t);
+  int err = fd_authorize_with_seed_args_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_authorize_with_seed_args_decode_unsafe( fd_authorize_with_seed_args_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->new_authorized_pubkey, ctx );
   fd_stake_authorize_decode_unsafe( &self->stake_authorize, ctx );
@@ -19240,6 +22108,15 @@ void fd_authorize_with_seed_args_decode_unsafe( fd_authorize_with_seed_args_t *
     self->authority_seed = NULL;
   fd_pubkey_decode_unsafe( &self->authority_owner, ctx );
 }
+fd_authorize_with_seed_args_t * fd_authorize_with_seed_args_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_authorize_with_seed_args_t * self = (fd_authorize_with_seed_args_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_authorize_with_seed_args_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_authorize_with_seed_args_new( self );
+  fd_authorize_with_seed_args_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_authorize_with_seed_args_encode( fd_authorize_with_seed_args_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->new_authorized_pubkey, ctx );
@@ -19258,25 +22135,27 @@ int fd_authorize_with_seed_args_encode( fd_authorize_with_seed_args_t const * se
 }
 int fd_authorize_with_seed_args_decode_offsets( fd_authorize_with_seed_args_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->new_authorized_pubkey_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->stake_authorize_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_stake_authorize_decode_preflight( ctx );
+  err = fd_stake_authorize_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->authority_seed_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong authority_seed_len;
   err = fd_bincode_uint64_decode( &authority_seed_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( authority_seed_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, authority_seed_len );
     err = fd_bincode_bytes_decode_preflight( authority_seed_len, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     err = !fd_utf8_verify( (char const *) ctx->data - authority_seed_len, authority_seed_len );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   }
   self->authority_owner_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -19330,23 +22209,35 @@ int fd_authorize_checked_with_seed_args_decode( fd_authorize_checked_with_seed_a
   fd_authorize_checked_with_seed_args_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_authorize_checked_with_seed_args_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_authorize_checked_with_seed_args_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_stake_authorize_decode_preflight( ctx );
+  err = fd_stake_authorize_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   ulong authority_seed_len;
   err = fd_bincode_uint64_decode( &authority_seed_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( authority_seed_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, authority_seed_len );
     err = fd_bincode_bytes_decode_preflight( authority_seed_len, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     err = !fd_utf8_verify( (char const *) ctx->data - authority_seed_len, authority_seed_len );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   }
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_authorize_checked_with_seed_args_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_authorize_checked_with_seed_args_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_authorize_checked_with_seed_args_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_authorize_checked_with_seed_args_t);
+  int err = fd_authorize_checked_with_seed_args_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_authorize_checked_with_seed_args_decode_unsafe( fd_authorize_checked_with_seed_args_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_stake_authorize_decode_unsafe( &self->stake_authorize, ctx );
   fd_bincode_uint64_decode_unsafe( &self->authority_seed_len, ctx );
@@ -19357,6 +22248,15 @@ void fd_authorize_checked_with_seed_args_decode_unsafe( fd_authorize_checked_wit
     self->authority_seed = NULL;
   fd_pubkey_decode_unsafe( &self->authority_owner, ctx );
 }
+fd_authorize_checked_with_seed_args_t * fd_authorize_checked_with_seed_args_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_authorize_checked_with_seed_args_t * self = (fd_authorize_checked_with_seed_args_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_authorize_checked_with_seed_args_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_authorize_checked_with_seed_args_new( self );
+  fd_authorize_checked_with_seed_args_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_authorize_checked_with_seed_args_encode( fd_authorize_checked_with_seed_args_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_stake_authorize_encode( &self->stake_authorize, ctx );
@@ -19373,22 +22273,24 @@ int fd_authorize_checked_with_seed_args_encode( fd_authorize_checked_with_seed_a
 }
 int fd_authorize_checked_with_seed_args_decode_offsets( fd_authorize_checked_with_seed_args_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->stake_authorize_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_stake_authorize_decode_preflight( ctx );
+  err = fd_stake_authorize_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->authority_seed_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong authority_seed_len;
   err = fd_bincode_uint64_decode( &authority_seed_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( authority_seed_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, authority_seed_len );
     err = fd_bincode_bytes_decode_preflight( authority_seed_len, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     err = !fd_utf8_verify( (char const *) ctx->data - authority_seed_len, authority_seed_len );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   }
   self->authority_owner_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -19438,13 +22340,14 @@ int fd_lockup_checked_args_decode( fd_lockup_checked_args_t * self, fd_bincode_d
   fd_lockup_checked_args_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_lockup_checked_args_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_lockup_checked_args_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   {
     uchar o;
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
+      *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, sizeof(long) );
       err = fd_bincode_int64_decode_preflight( ctx );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
@@ -19454,12 +22357,24 @@ int fd_lockup_checked_args_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
+      *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, sizeof(ulong) );
       err = fd_bincode_uint64_decode_preflight( ctx );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_lockup_checked_args_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_lockup_checked_args_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_lockup_checked_args_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_lockup_checked_args_t);
+  int err = fd_lockup_checked_args_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_lockup_checked_args_decode_unsafe( fd_lockup_checked_args_t * self, fd_bincode_decode_ctx_t * ctx ) {
   {
     uchar o;
@@ -19480,6 +22395,15 @@ void fd_lockup_checked_args_decode_unsafe( fd_lockup_checked_args_t * self, fd_b
       self->epoch = NULL;
   }
 }
+fd_lockup_checked_args_t * fd_lockup_checked_args_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_lockup_checked_args_t * self = (fd_lockup_checked_args_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_lockup_checked_args_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_lockup_checked_args_new( self );
+  fd_lockup_checked_args_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_lockup_checked_args_encode( fd_lockup_checked_args_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   if( self->unix_timestamp != NULL ) {
@@ -19504,6 +22428,7 @@ int fd_lockup_checked_args_encode( fd_lockup_checked_args_t const * self, fd_bin
 }
 int fd_lockup_checked_args_decode_offsets( fd_lockup_checked_args_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->unix_timestamp_off = (uint)( (ulong)ctx->data - (ulong)data );
   {
@@ -19511,6 +22436,7 @@ int fd_lockup_checked_args_decode_offsets( fd_lockup_checked_args_off_t * self,
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
+      *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, sizeof(long) );
       err = fd_bincode_int64_decode_preflight( ctx );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
@@ -19521,6 +22447,7 @@ int fd_lockup_checked_args_decode_offsets( fd_lockup_checked_args_off_t * self,
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
+      *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, sizeof(ulong) );
       err = fd_bincode_uint64_decode_preflight( ctx );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
@@ -19582,13 +22509,14 @@ int fd_lockup_args_decode( fd_lockup_args_t * self, fd_bincode_decode_ctx_t * ct
   fd_lockup_args_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_lockup_args_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_lockup_args_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   {
     uchar o;
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
+      *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, sizeof(long) );
       err = fd_bincode_int64_decode_preflight( ctx );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
@@ -19598,6 +22526,7 @@ int fd_lockup_args_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
+      *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, sizeof(ulong) );
       err = fd_bincode_uint64_decode_preflight( ctx );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
@@ -19607,12 +22536,24 @@ int fd_lockup_args_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
-      err = fd_pubkey_decode_preflight( ctx );
+      *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_PUBKEY_ALIGN, FD_PUBKEY_FOOTPRINT );
+      err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_lockup_args_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_lockup_args_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_lockup_args_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_lockup_args_t);
+  int err = fd_lockup_args_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_lockup_args_decode_unsafe( fd_lockup_args_t * self, fd_bincode_decode_ctx_t * ctx ) {
   {
     uchar o;
@@ -19643,6 +22584,15 @@ void fd_lockup_args_decode_unsafe( fd_lockup_args_t * self, fd_bincode_decode_ct
       self->custodian = NULL;
   }
 }
+fd_lockup_args_t * fd_lockup_args_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_lockup_args_t * self = (fd_lockup_args_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_lockup_args_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_lockup_args_new( self );
+  fd_lockup_args_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_lockup_args_encode( fd_lockup_args_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   if( self->unix_timestamp != NULL ) {
@@ -19676,6 +22626,7 @@ int fd_lockup_args_encode( fd_lockup_args_t const * self, fd_bincode_encode_ctx_
 }
 int fd_lockup_args_decode_offsets( fd_lockup_args_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->unix_timestamp_off = (uint)( (ulong)ctx->data - (ulong)data );
   {
@@ -19683,6 +22634,7 @@ int fd_lockup_args_decode_offsets( fd_lockup_args_off_t * self, fd_bincode_decod
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
+      *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, sizeof(long) );
       err = fd_bincode_int64_decode_preflight( ctx );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
@@ -19693,6 +22645,7 @@ int fd_lockup_args_decode_offsets( fd_lockup_args_off_t * self, fd_bincode_decod
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
+      *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, sizeof(ulong) );
       err = fd_bincode_uint64_decode_preflight( ctx );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
@@ -19703,7 +22656,8 @@ int fd_lockup_args_decode_offsets( fd_lockup_args_off_t * self, fd_bincode_decod
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
-      err = fd_pubkey_decode_preflight( ctx );
+      *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_PUBKEY_ALIGN, FD_PUBKEY_FOOTPRINT );
+      err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -19822,16 +22776,16 @@ FD_FN_PURE uchar fd_stake_instruction_is_move_lamports(fd_stake_instruction_t co
   return self->discriminant == 17;
 }
 void fd_stake_instruction_inner_new( fd_stake_instruction_inner_t * self, uint discriminant );
-int fd_stake_instruction_inner_decode_preflight( uint discriminant, fd_bincode_decode_ctx_t * ctx ) {
+int fd_stake_instruction_inner_decode_footprint( uint discriminant, fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   switch (discriminant) {
   case 0: {
-    err = fd_stake_instruction_initialize_decode_preflight( ctx );
+    err = fd_stake_instruction_initialize_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 1: {
-    err = fd_stake_instruction_authorize_decode_preflight( ctx );
+    err = fd_stake_instruction_authorize_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
@@ -19852,7 +22806,7 @@ int fd_stake_instruction_inner_decode_preflight( uint discriminant, fd_bincode_d
     return FD_BINCODE_SUCCESS;
   }
   case 6: {
-    err = fd_lockup_args_decode_preflight( ctx );
+    err = fd_lockup_args_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
@@ -19860,7 +22814,7 @@ int fd_stake_instruction_inner_decode_preflight( uint discriminant, fd_bincode_d
     return FD_BINCODE_SUCCESS;
   }
   case 8: {
-    err = fd_authorize_with_seed_args_decode_preflight( ctx );
+    err = fd_authorize_with_seed_args_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
@@ -19868,17 +22822,17 @@ int fd_stake_instruction_inner_decode_preflight( uint discriminant, fd_bincode_d
     return FD_BINCODE_SUCCESS;
   }
   case 10: {
-    err = fd_stake_authorize_decode_preflight( ctx );
+    err = fd_stake_authorize_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 11: {
-    err = fd_authorize_checked_with_seed_args_decode_preflight( ctx );
+    err = fd_authorize_checked_with_seed_args_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 12: {
-    err = fd_lockup_checked_args_decode_preflight( ctx );
+    err = fd_lockup_checked_args_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
@@ -19984,16 +22938,36 @@ int fd_stake_instruction_decode( fd_stake_instruction_t * self, fd_bincode_decod
   fd_stake_instruction_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_stake_instruction_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_stake_instruction_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   uint discriminant = 0;
   int err = fd_bincode_uint32_decode( &discriminant, ctx );
   if( FD_UNLIKELY( err ) ) return err;
-  return fd_stake_instruction_inner_decode_preflight( discriminant, ctx );
+  return fd_stake_instruction_inner_decode_footprint( discriminant, ctx, total_sz );
+}
+int fd_stake_instruction_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_stake_instruction_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_stake_instruction_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_stake_instruction_t);
+  int err = fd_stake_instruction_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
 }
 void fd_stake_instruction_decode_unsafe( fd_stake_instruction_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint32_decode_unsafe( &self->discriminant, ctx );
   fd_stake_instruction_inner_decode_unsafe( &self->inner, self->discriminant, ctx );
 }
+fd_stake_instruction_t * fd_stake_instruction_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_stake_instruction_t * self = (fd_stake_instruction_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_stake_instruction_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_stake_instruction_new( self );
+  fd_stake_instruction_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 void fd_stake_instruction_inner_new( fd_stake_instruction_inner_t * self, uint discriminant ) {
   switch( discriminant ) {
   case 0: {
@@ -20339,14 +23313,34 @@ int fd_stake_meta_decode( fd_stake_meta_t * self, fd_bincode_decode_ctx_t * ctx
   fd_stake_meta_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_stake_meta_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_stake_meta_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 120, ctx );
 }
+int fd_stake_meta_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_stake_meta_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_stake_meta_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_stake_meta_t);
+  int err = fd_stake_meta_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_stake_meta_decode_unsafe( fd_stake_meta_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->rent_exempt_reserve, ctx );
   fd_stake_authorized_decode_unsafe( &self->authorized, ctx );
   fd_stake_lockup_decode_unsafe( &self->lockup, ctx );
 }
+fd_stake_meta_t * fd_stake_meta_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_stake_meta_t * self = (fd_stake_meta_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_stake_meta_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_stake_meta_new( self );
+  fd_stake_meta_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_stake_meta_encode( fd_stake_meta_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->rent_exempt_reserve, ctx );
@@ -20359,15 +23353,16 @@ int fd_stake_meta_encode( fd_stake_meta_t const * self, fd_bincode_encode_ctx_t
 }
 int fd_stake_meta_decode_offsets( fd_stake_meta_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->rent_exempt_reserve_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->authorized_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_stake_authorized_decode_preflight( ctx );
+  err = fd_stake_authorized_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->lockup_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_stake_lockup_decode_preflight( ctx );
+  err = fd_stake_lockup_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -20383,6 +23378,7 @@ void fd_stake_meta_destroy( fd_stake_meta_t * self, fd_bincode_destroy_ctx_t * c
 
 ulong fd_stake_meta_footprint( void ){ return FD_STAKE_META_FOOTPRINT; }
 ulong fd_stake_meta_align( void ){ return FD_STAKE_META_ALIGN; }
+FD_STATIC_ASSERT( sizeof(fd_stake_meta_t)==120UL, fd_stake_meta_view );
 
 void fd_stake_meta_walk( void * w, fd_stake_meta_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_stake_meta", level++ );
@@ -20410,12 +23406,32 @@ int fd_stake_flags_decode( fd_stake_flags_t * self, fd_bincode_decode_ctx_t * ct
   fd_stake_flags_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_stake_flags_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_stake_flags_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 1, ctx );
 }
+int fd_stake_flags_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_stake_flags_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_stake_flags_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_stake_flags_t);
+  int err = fd_stake_flags_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_stake_flags_decode_unsafe( fd_stake_flags_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint8_decode_unsafe( &self->bits, ctx );
 }
+fd_stake_flags_t * fd_stake_flags_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_stake_flags_t * self = (fd_stake_flags_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_stake_flags_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_stake_flags_new( self );
+  fd_stake_flags_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_stake_flags_encode( fd_stake_flags_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint8_encode( (uchar)(self->bits), ctx );
@@ -20424,6 +23440,7 @@ int fd_stake_flags_encode( fd_stake_flags_t const * self, fd_bincode_encode_ctx_
 }
 int fd_stake_flags_decode_offsets( fd_stake_flags_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->bits_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint8_decode_preflight( ctx );
@@ -20461,12 +23478,32 @@ int fd_stake_state_v2_initialized_decode( fd_stake_state_v2_initialized_t * self
   fd_stake_state_v2_initialized_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_stake_state_v2_initialized_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_stake_state_v2_initialized_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 120, ctx );
 }
+int fd_stake_state_v2_initialized_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_stake_state_v2_initialized_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_stake_state_v2_initialized_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_stake_state_v2_initialized_t);
+  int err = fd_stake_state_v2_initialized_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_stake_state_v2_initialized_decode_unsafe( fd_stake_state_v2_initialized_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_stake_meta_decode_unsafe( &self->meta, ctx );
 }
+fd_stake_state_v2_initialized_t * fd_stake_state_v2_initialized_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_stake_state_v2_initialized_t * self = (fd_stake_state_v2_initialized_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_stake_state_v2_initialized_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_stake_state_v2_initialized_new( self );
+  fd_stake_state_v2_initialized_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_stake_state_v2_initialized_encode( fd_stake_state_v2_initialized_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_stake_meta_encode( &self->meta, ctx );
@@ -20475,9 +23512,10 @@ int fd_stake_state_v2_initialized_encode( fd_stake_state_v2_initialized_t const
 }
 int fd_stake_state_v2_initialized_decode_offsets( fd_stake_state_v2_initialized_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->meta_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_stake_meta_decode_preflight( ctx );
+  err = fd_stake_meta_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -20491,6 +23529,7 @@ void fd_stake_state_v2_initialized_destroy( fd_stake_state_v2_initialized_t * se
 
 ulong fd_stake_state_v2_initialized_footprint( void ){ return FD_STAKE_STATE_V2_INITIALIZED_FOOTPRINT; }
 ulong fd_stake_state_v2_initialized_align( void ){ return FD_STAKE_STATE_V2_INITIALIZED_ALIGN; }
+FD_STATIC_ASSERT( sizeof(fd_stake_state_v2_initialized_t)==120UL, fd_stake_state_v2_initialized_view );
 
 void fd_stake_state_v2_initialized_walk( void * w, fd_stake_state_v2_initialized_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_stake_state_v2_initialized", level++ );
@@ -20514,14 +23553,34 @@ int fd_stake_state_v2_stake_decode( fd_stake_state_v2_stake_t * self, fd_bincode
   fd_stake_state_v2_stake_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_stake_state_v2_stake_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_stake_state_v2_stake_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 193, ctx );
 }
+int fd_stake_state_v2_stake_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_stake_state_v2_stake_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_stake_state_v2_stake_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_stake_state_v2_stake_t);
+  int err = fd_stake_state_v2_stake_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_stake_state_v2_stake_decode_unsafe( fd_stake_state_v2_stake_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_stake_meta_decode_unsafe( &self->meta, ctx );
   fd_stake_decode_unsafe( &self->stake, ctx );
   fd_stake_flags_decode_unsafe( &self->stake_flags, ctx );
 }
+fd_stake_state_v2_stake_t * fd_stake_state_v2_stake_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_stake_state_v2_stake_t * self = (fd_stake_state_v2_stake_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_stake_state_v2_stake_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_stake_state_v2_stake_new( self );
+  fd_stake_state_v2_stake_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_stake_state_v2_stake_encode( fd_stake_state_v2_stake_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_stake_meta_encode( &self->meta, ctx );
@@ -20534,15 +23593,16 @@ int fd_stake_state_v2_stake_encode( fd_stake_state_v2_stake_t const * self, fd_b
 }
 int fd_stake_state_v2_stake_decode_offsets( fd_stake_state_v2_stake_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->meta_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_stake_meta_decode_preflight( ctx );
+  err = fd_stake_meta_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->stake_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_stake_decode_preflight( ctx );
+  err = fd_stake_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->stake_flags_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_stake_flags_decode_preflight( ctx );
+  err = fd_stake_flags_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -20589,19 +23649,19 @@ FD_FN_PURE uchar fd_stake_state_v2_is_rewards_pool(fd_stake_state_v2_t const * s
   return self->discriminant == 3;
 }
 void fd_stake_state_v2_inner_new( fd_stake_state_v2_inner_t * self, uint discriminant );
-int fd_stake_state_v2_inner_decode_preflight( uint discriminant, fd_bincode_decode_ctx_t * ctx ) {
+int fd_stake_state_v2_inner_decode_footprint( uint discriminant, fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   switch (discriminant) {
   case 0: {
     return FD_BINCODE_SUCCESS;
   }
   case 1: {
-    err = fd_stake_state_v2_initialized_decode_preflight( ctx );
+    err = fd_stake_state_v2_initialized_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 2: {
-    err = fd_stake_state_v2_stake_decode_preflight( ctx );
+    err = fd_stake_state_v2_stake_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
@@ -20640,16 +23700,36 @@ int fd_stake_state_v2_decode( fd_stake_state_v2_t * self, fd_bincode_decode_ctx_
   fd_stake_state_v2_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_stake_state_v2_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_stake_state_v2_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   uint discriminant = 0;
   int err = fd_bincode_uint32_decode( &discriminant, ctx );
   if( FD_UNLIKELY( err ) ) return err;
-  return fd_stake_state_v2_inner_decode_preflight( discriminant, ctx );
+  return fd_stake_state_v2_inner_decode_footprint( discriminant, ctx, total_sz );
+}
+int fd_stake_state_v2_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_stake_state_v2_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_stake_state_v2_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_stake_state_v2_t);
+  int err = fd_stake_state_v2_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
 }
 void fd_stake_state_v2_decode_unsafe( fd_stake_state_v2_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint32_decode_unsafe( &self->discriminant, ctx );
   fd_stake_state_v2_inner_decode_unsafe( &self->inner, self->discriminant, ctx );
 }
+fd_stake_state_v2_t * fd_stake_state_v2_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_stake_state_v2_t * self = (fd_stake_state_v2_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_stake_state_v2_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_stake_state_v2_new( self );
+  fd_stake_state_v2_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 void fd_stake_state_v2_inner_new( fd_stake_state_v2_inner_t * self, uint discriminant ) {
   switch( discriminant ) {
   case 0: {
@@ -20770,14 +23850,34 @@ int fd_nonce_data_decode( fd_nonce_data_t * self, fd_bincode_decode_ctx_t * ctx
   fd_nonce_data_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_nonce_data_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_nonce_data_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 72, ctx );
 }
+int fd_nonce_data_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_nonce_data_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_nonce_data_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_nonce_data_t);
+  int err = fd_nonce_data_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_nonce_data_decode_unsafe( fd_nonce_data_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->authority, ctx );
   fd_hash_decode_unsafe( &self->durable_nonce, ctx );
   fd_fee_calculator_decode_unsafe( &self->fee_calculator, ctx );
 }
+fd_nonce_data_t * fd_nonce_data_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_nonce_data_t * self = (fd_nonce_data_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_nonce_data_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_nonce_data_new( self );
+  fd_nonce_data_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_nonce_data_encode( fd_nonce_data_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->authority, ctx );
@@ -20790,15 +23890,16 @@ int fd_nonce_data_encode( fd_nonce_data_t const * self, fd_bincode_encode_ctx_t
 }
 int fd_nonce_data_decode_offsets( fd_nonce_data_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->authority_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->durable_nonce_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->fee_calculator_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_fee_calculator_decode_preflight( ctx );
+  err = fd_fee_calculator_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -20816,6 +23917,7 @@ void fd_nonce_data_destroy( fd_nonce_data_t * self, fd_bincode_destroy_ctx_t * c
 
 ulong fd_nonce_data_footprint( void ){ return FD_NONCE_DATA_FOOTPRINT; }
 ulong fd_nonce_data_align( void ){ return FD_NONCE_DATA_ALIGN; }
+FD_STATIC_ASSERT( sizeof(fd_nonce_data_t)==72UL, fd_nonce_data_view );
 
 void fd_nonce_data_walk( void * w, fd_nonce_data_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_nonce_data", level++ );
@@ -20839,14 +23941,14 @@ FD_FN_PURE uchar fd_nonce_state_is_initialized(fd_nonce_state_t const * self) {
   return self->discriminant == 1;
 }
 void fd_nonce_state_inner_new( fd_nonce_state_inner_t * self, uint discriminant );
-int fd_nonce_state_inner_decode_preflight( uint discriminant, fd_bincode_decode_ctx_t * ctx ) {
+int fd_nonce_state_inner_decode_footprint( uint discriminant, fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   switch (discriminant) {
   case 0: {
     return FD_BINCODE_SUCCESS;
   }
   case 1: {
-    err = fd_nonce_data_decode_preflight( ctx );
+    err = fd_nonce_data_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
@@ -20875,16 +23977,36 @@ int fd_nonce_state_decode( fd_nonce_state_t * self, fd_bincode_decode_ctx_t * ct
   fd_nonce_state_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_nonce_state_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_nonce_state_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   uint discriminant = 0;
   int err = fd_bincode_uint32_decode( &discriminant, ctx );
   if( FD_UNLIKELY( err ) ) return err;
-  return fd_nonce_state_inner_decode_preflight( discriminant, ctx );
+  return fd_nonce_state_inner_decode_footprint( discriminant, ctx, total_sz );
+}
+int fd_nonce_state_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_nonce_state_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_nonce_state_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_nonce_state_t);
+  int err = fd_nonce_state_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
 }
 void fd_nonce_state_decode_unsafe( fd_nonce_state_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint32_decode_unsafe( &self->discriminant, ctx );
   fd_nonce_state_inner_decode_unsafe( &self->inner, self->discriminant, ctx );
 }
+fd_nonce_state_t * fd_nonce_state_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_nonce_state_t * self = (fd_nonce_state_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_nonce_state_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_nonce_state_new( self );
+  fd_nonce_state_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 void fd_nonce_state_inner_new( fd_nonce_state_inner_t * self, uint discriminant ) {
   switch( discriminant ) {
   case 0: {
@@ -20972,16 +24094,16 @@ FD_FN_PURE uchar fd_nonce_state_versions_is_current(fd_nonce_state_versions_t co
   return self->discriminant == 1;
 }
 void fd_nonce_state_versions_inner_new( fd_nonce_state_versions_inner_t * self, uint discriminant );
-int fd_nonce_state_versions_inner_decode_preflight( uint discriminant, fd_bincode_decode_ctx_t * ctx ) {
+int fd_nonce_state_versions_inner_decode_footprint( uint discriminant, fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   switch (discriminant) {
   case 0: {
-    err = fd_nonce_state_decode_preflight( ctx );
+    err = fd_nonce_state_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 1: {
-    err = fd_nonce_state_decode_preflight( ctx );
+    err = fd_nonce_state_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
@@ -21011,16 +24133,36 @@ int fd_nonce_state_versions_decode( fd_nonce_state_versions_t * self, fd_bincode
   fd_nonce_state_versions_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_nonce_state_versions_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_nonce_state_versions_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   uint discriminant = 0;
   int err = fd_bincode_uint32_decode( &discriminant, ctx );
   if( FD_UNLIKELY( err ) ) return err;
-  return fd_nonce_state_versions_inner_decode_preflight( discriminant, ctx );
+  return fd_nonce_state_versions_inner_decode_footprint( discriminant, ctx, total_sz );
+}
+int fd_nonce_state_versions_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_nonce_state_versions_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_nonce_state_versions_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_nonce_state_versions_t);
+  int err = fd_nonce_state_versions_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
 }
 void fd_nonce_state_versions_decode_unsafe( fd_nonce_state_versions_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint32_decode_unsafe( &self->discriminant, ctx );
   fd_nonce_state_versions_inner_decode_unsafe( &self->inner, self->discriminant, ctx );
 }
+fd_nonce_state_versions_t * fd_nonce_state_versions_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_nonce_state_versions_t * self = (fd_nonce_state_versions_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_nonce_state_versions_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_nonce_state_versions_new( self );
+  fd_nonce_state_versions_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 void fd_nonce_state_versions_inner_new( fd_nonce_state_versions_inner_t * self, uint discriminant ) {
   switch( discriminant ) {
   case 0: {
@@ -21127,13 +24269,33 @@ int fd_compute_budget_program_instruction_request_units_deprecated_decode( fd_co
   fd_compute_budget_program_instruction_request_units_deprecated_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_compute_budget_program_instruction_request_units_deprecated_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_compute_budget_program_instruction_request_units_deprecated_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 8, ctx );
 }
+int fd_compute_budget_program_instruction_request_units_deprecated_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_compute_budget_program_instruction_request_units_deprecated_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_compute_budget_program_instruction_request_units_deprecated_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_compute_budget_program_instruction_request_units_deprecated_t);
+  int err = fd_compute_budget_program_instruction_request_units_deprecated_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_compute_budget_program_instruction_request_units_deprecated_decode_unsafe( fd_compute_budget_program_instruction_request_units_deprecated_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint32_decode_unsafe( &self->units, ctx );
   fd_bincode_uint32_decode_unsafe( &self->additional_fee, ctx );
 }
+fd_compute_budget_program_instruction_request_units_deprecated_t * fd_compute_budget_program_instruction_request_units_deprecated_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_compute_budget_program_instruction_request_units_deprecated_t * self = (fd_compute_budget_program_instruction_request_units_deprecated_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_compute_budget_program_instruction_request_units_deprecated_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_compute_budget_program_instruction_request_units_deprecated_new( self );
+  fd_compute_budget_program_instruction_request_units_deprecated_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_compute_budget_program_instruction_request_units_deprecated_encode( fd_compute_budget_program_instruction_request_units_deprecated_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint32_encode( self->units, ctx );
@@ -21144,6 +24306,7 @@ int fd_compute_budget_program_instruction_request_units_deprecated_encode( fd_co
 }
 int fd_compute_budget_program_instruction_request_units_deprecated_decode_offsets( fd_compute_budget_program_instruction_request_units_deprecated_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->units_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint32_decode_preflight( ctx );
@@ -21161,6 +24324,7 @@ void fd_compute_budget_program_instruction_request_units_deprecated_destroy( fd_
 
 ulong fd_compute_budget_program_instruction_request_units_deprecated_footprint( void ){ return FD_COMPUTE_BUDGET_PROGRAM_INSTRUCTION_REQUEST_UNITS_DEPRECATED_FOOTPRINT; }
 ulong fd_compute_budget_program_instruction_request_units_deprecated_align( void ){ return FD_COMPUTE_BUDGET_PROGRAM_INSTRUCTION_REQUEST_UNITS_DEPRECATED_ALIGN; }
+FD_STATIC_ASSERT( sizeof(fd_compute_budget_program_instruction_request_units_deprecated_t)==8UL, fd_compute_budget_program_instruction_request_units_deprecated_view );
 
 void fd_compute_budget_program_instruction_request_units_deprecated_walk( void * w, fd_compute_budget_program_instruction_request_units_deprecated_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_compute_budget_program_instruction_request_units_deprecated", level++ );
@@ -21191,11 +24355,11 @@ FD_FN_PURE uchar fd_compute_budget_program_instruction_is_set_loaded_accounts_da
   return self->discriminant == 4;
 }
 void fd_compute_budget_program_instruction_inner_new( fd_compute_budget_program_instruction_inner_t * self, uint discriminant );
-int fd_compute_budget_program_instruction_inner_decode_preflight( uint discriminant, fd_bincode_decode_ctx_t * ctx ) {
+int fd_compute_budget_program_instruction_inner_decode_footprint( uint discriminant, fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   switch (discriminant) {
   case 0: {
-    err = fd_compute_budget_program_instruction_request_units_deprecated_decode_preflight( ctx );
+    err = fd_compute_budget_program_instruction_request_units_deprecated_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
@@ -21257,11 +24421,22 @@ int fd_compute_budget_program_instruction_decode( fd_compute_budget_program_inst
   fd_compute_budget_program_instruction_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_compute_budget_program_instruction_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_compute_budget_program_instruction_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   ushort discriminant = 0;
   int err = fd_bincode_compact_u16_decode( &discriminant, ctx );
   if( FD_UNLIKELY( err ) ) return err;
-  return fd_compute_budget_program_instruction_inner_decode_preflight( discriminant, ctx );
+  return fd_compute_budget_program_instruction_inner_decode_footprint( discriminant, ctx, total_sz );
+}
+int fd_compute_budget_program_instruction_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_compute_budget_program_instruction_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_compute_budget_program_instruction_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_compute_budget_program_instruction_t);
+  int err = fd_compute_budget_program_instruction_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
 }
 void fd_compute_budget_program_instruction_decode_unsafe( fd_compute_budget_program_instruction_t * self, fd_bincode_decode_ctx_t * ctx ) {
   ushort tmp = 0;
@@ -21269,6 +24444,15 @@ void fd_compute_budget_program_instruction_decode_unsafe( fd_compute_budget_prog
   self->discriminant = tmp;
   fd_compute_budget_program_instruction_inner_decode_unsafe( &self->inner, self->discriminant, ctx );
 }
+fd_compute_budget_program_instruction_t * fd_compute_budget_program_instruction_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_compute_budget_program_instruction_t * self = (fd_compute_budget_program_instruction_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_compute_budget_program_instruction_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_compute_budget_program_instruction_new( self );
+  fd_compute_budget_program_instruction_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 void fd_compute_budget_program_instruction_inner_new( fd_compute_budget_program_instruction_inner_t * self, uint discriminant ) {
   switch( discriminant ) {
   case 0: {
@@ -21433,19 +24617,31 @@ int fd_config_keys_decode( fd_config_keys_t * self, fd_bincode_decode_ctx_t * ct
   fd_config_keys_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_config_keys_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_config_keys_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   ushort keys_len;
   err = fd_bincode_compact_u16_decode( &keys_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( keys_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_CONFIG_KEYS_PAIR_ALIGN, FD_CONFIG_KEYS_PAIR_FOOTPRINT*keys_len );
     for( ulong i=0; i < keys_len; i++ ) {
-      err = fd_config_keys_pair_decode_preflight( ctx );
+      err = fd_config_keys_pair_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_config_keys_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_config_keys_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_config_keys_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_config_keys_t);
+  int err = fd_config_keys_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_config_keys_decode_unsafe( fd_config_keys_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_compact_u16_decode_unsafe( &self->keys_len, ctx );
   if( self->keys_len ) {
@@ -21457,6 +24653,15 @@ void fd_config_keys_decode_unsafe( fd_config_keys_t * self, fd_bincode_decode_ct
   } else
     self->keys = NULL;
 }
+fd_config_keys_t * fd_config_keys_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_config_keys_t * self = (fd_config_keys_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_config_keys_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_config_keys_new( self );
+  fd_config_keys_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_config_keys_encode( fd_config_keys_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_compact_u16_encode( &self->keys_len, ctx );
@@ -21471,14 +24676,16 @@ int fd_config_keys_encode( fd_config_keys_t const * self, fd_bincode_encode_ctx_
 }
 int fd_config_keys_decode_offsets( fd_config_keys_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->keys_off = (uint)( (ulong)ctx->data - (ulong)data );
   ushort keys_len;
   err = fd_bincode_compact_u16_decode( &keys_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( keys_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_CONFIG_KEYS_PAIR_ALIGN, FD_CONFIG_KEYS_PAIR_FOOTPRINT*keys_len );
     for( ulong i=0; i < keys_len; i++ ) {
-      err = fd_config_keys_pair_decode_preflight( ctx );
+      err = fd_config_keys_pair_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -21531,7 +24738,7 @@ int fd_bpf_loader_program_instruction_write_decode( fd_bpf_loader_program_instru
   fd_bpf_loader_program_instruction_write_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_bpf_loader_program_instruction_write_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_bpf_loader_program_instruction_write_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   err = fd_bincode_uint32_decode_preflight( ctx );
   if( FD_UNLIKELY( err ) ) return err;
@@ -21539,11 +24746,23 @@ int fd_bpf_loader_program_instruction_write_decode_preflight( fd_bincode_decode_
   err = fd_bincode_uint64_decode( &bytes_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( bytes_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, bytes_len );
     err = fd_bincode_bytes_decode_preflight( bytes_len, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_bpf_loader_program_instruction_write_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_bpf_loader_program_instruction_write_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_bpf_loader_program_instruction_write_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_bpf_loader_program_instruction_write_t);
+  int err = fd_bpf_loader_program_instruction_write_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_bpf_loader_program_instruction_write_decode_unsafe( fd_bpf_loader_program_instruction_write_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint32_decode_unsafe( &self->offset, ctx );
   fd_bincode_uint64_decode_unsafe( &self->bytes_len, ctx );
@@ -21553,6 +24772,15 @@ void fd_bpf_loader_program_instruction_write_decode_unsafe( fd_bpf_loader_progra
   } else
     self->bytes = NULL;
 }
+fd_bpf_loader_program_instruction_write_t * fd_bpf_loader_program_instruction_write_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_bpf_loader_program_instruction_write_t * self = (fd_bpf_loader_program_instruction_write_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_bpf_loader_program_instruction_write_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_bpf_loader_program_instruction_write_new( self );
+  fd_bpf_loader_program_instruction_write_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_bpf_loader_program_instruction_write_encode( fd_bpf_loader_program_instruction_write_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint32_encode( self->offset, ctx );
@@ -21567,6 +24795,7 @@ int fd_bpf_loader_program_instruction_write_encode( fd_bpf_loader_program_instru
 }
 int fd_bpf_loader_program_instruction_write_decode_offsets( fd_bpf_loader_program_instruction_write_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->offset_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint32_decode_preflight( ctx );
@@ -21576,6 +24805,7 @@ int fd_bpf_loader_program_instruction_write_decode_offsets( fd_bpf_loader_progra
   err = fd_bincode_uint64_decode( &bytes_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( bytes_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, bytes_len );
     err = fd_bincode_bytes_decode_preflight( bytes_len, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   }
@@ -21617,11 +24847,11 @@ FD_FN_PURE uchar fd_bpf_loader_program_instruction_is_finalize(fd_bpf_loader_pro
   return self->discriminant == 1;
 }
 void fd_bpf_loader_program_instruction_inner_new( fd_bpf_loader_program_instruction_inner_t * self, uint discriminant );
-int fd_bpf_loader_program_instruction_inner_decode_preflight( uint discriminant, fd_bincode_decode_ctx_t * ctx ) {
+int fd_bpf_loader_program_instruction_inner_decode_footprint( uint discriminant, fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   switch (discriminant) {
   case 0: {
-    err = fd_bpf_loader_program_instruction_write_decode_preflight( ctx );
+    err = fd_bpf_loader_program_instruction_write_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
@@ -21653,16 +24883,36 @@ int fd_bpf_loader_program_instruction_decode( fd_bpf_loader_program_instruction_
   fd_bpf_loader_program_instruction_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_bpf_loader_program_instruction_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_bpf_loader_program_instruction_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   uint discriminant = 0;
   int err = fd_bincode_uint32_decode( &discriminant, ctx );
   if( FD_UNLIKELY( err ) ) return err;
-  return fd_bpf_loader_program_instruction_inner_decode_preflight( discriminant, ctx );
+  return fd_bpf_loader_program_instruction_inner_decode_footprint( discriminant, ctx, total_sz );
+}
+int fd_bpf_loader_program_instruction_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_bpf_loader_program_instruction_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_bpf_loader_program_instruction_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_bpf_loader_program_instruction_t);
+  int err = fd_bpf_loader_program_instruction_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
 }
 void fd_bpf_loader_program_instruction_decode_unsafe( fd_bpf_loader_program_instruction_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint32_decode_unsafe( &self->discriminant, ctx );
   fd_bpf_loader_program_instruction_inner_decode_unsafe( &self->inner, self->discriminant, ctx );
 }
+fd_bpf_loader_program_instruction_t * fd_bpf_loader_program_instruction_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_bpf_loader_program_instruction_t * self = (fd_bpf_loader_program_instruction_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_bpf_loader_program_instruction_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_bpf_loader_program_instruction_new( self );
+  fd_bpf_loader_program_instruction_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 void fd_bpf_loader_program_instruction_inner_new( fd_bpf_loader_program_instruction_inner_t * self, uint discriminant ) {
   switch( discriminant ) {
   case 0: {
@@ -21754,7 +25004,7 @@ int fd_loader_v4_program_instruction_write_decode( fd_loader_v4_program_instruct
   fd_loader_v4_program_instruction_write_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_loader_v4_program_instruction_write_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_loader_v4_program_instruction_write_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   err = fd_bincode_uint32_decode_preflight( ctx );
   if( FD_UNLIKELY( err ) ) return err;
@@ -21762,11 +25012,23 @@ int fd_loader_v4_program_instruction_write_decode_preflight( fd_bincode_decode_c
   err = fd_bincode_uint64_decode( &bytes_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( bytes_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, bytes_len );
     err = fd_bincode_bytes_decode_preflight( bytes_len, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_loader_v4_program_instruction_write_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_loader_v4_program_instruction_write_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_loader_v4_program_instruction_write_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_loader_v4_program_instruction_write_t);
+  int err = fd_loader_v4_program_instruction_write_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_loader_v4_program_instruction_write_decode_unsafe( fd_loader_v4_program_instruction_write_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint32_decode_unsafe( &self->offset, ctx );
   fd_bincode_uint64_decode_unsafe( &self->bytes_len, ctx );
@@ -21776,6 +25038,15 @@ void fd_loader_v4_program_instruction_write_decode_unsafe( fd_loader_v4_program_
   } else
     self->bytes = NULL;
 }
+fd_loader_v4_program_instruction_write_t * fd_loader_v4_program_instruction_write_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_loader_v4_program_instruction_write_t * self = (fd_loader_v4_program_instruction_write_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_loader_v4_program_instruction_write_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_loader_v4_program_instruction_write_new( self );
+  fd_loader_v4_program_instruction_write_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_loader_v4_program_instruction_write_encode( fd_loader_v4_program_instruction_write_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint32_encode( self->offset, ctx );
@@ -21790,6 +25061,7 @@ int fd_loader_v4_program_instruction_write_encode( fd_loader_v4_program_instruct
 }
 int fd_loader_v4_program_instruction_write_decode_offsets( fd_loader_v4_program_instruction_write_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->offset_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint32_decode_preflight( ctx );
@@ -21799,6 +25071,7 @@ int fd_loader_v4_program_instruction_write_decode_offsets( fd_loader_v4_program_
   err = fd_bincode_uint64_decode( &bytes_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( bytes_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, bytes_len );
     err = fd_bincode_bytes_decode_preflight( bytes_len, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   }
@@ -21844,12 +25117,32 @@ int fd_loader_v4_program_instruction_truncate_decode( fd_loader_v4_program_instr
   fd_loader_v4_program_instruction_truncate_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_loader_v4_program_instruction_truncate_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_loader_v4_program_instruction_truncate_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 4, ctx );
 }
+int fd_loader_v4_program_instruction_truncate_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_loader_v4_program_instruction_truncate_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_loader_v4_program_instruction_truncate_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_loader_v4_program_instruction_truncate_t);
+  int err = fd_loader_v4_program_instruction_truncate_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_loader_v4_program_instruction_truncate_decode_unsafe( fd_loader_v4_program_instruction_truncate_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint32_decode_unsafe( &self->new_size, ctx );
 }
+fd_loader_v4_program_instruction_truncate_t * fd_loader_v4_program_instruction_truncate_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_loader_v4_program_instruction_truncate_t * self = (fd_loader_v4_program_instruction_truncate_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_loader_v4_program_instruction_truncate_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_loader_v4_program_instruction_truncate_new( self );
+  fd_loader_v4_program_instruction_truncate_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_loader_v4_program_instruction_truncate_encode( fd_loader_v4_program_instruction_truncate_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint32_encode( self->new_size, ctx );
@@ -21858,6 +25151,7 @@ int fd_loader_v4_program_instruction_truncate_encode( fd_loader_v4_program_instr
 }
 int fd_loader_v4_program_instruction_truncate_decode_offsets( fd_loader_v4_program_instruction_truncate_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->new_size_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint32_decode_preflight( ctx );
@@ -21903,16 +25197,16 @@ FD_FN_PURE uchar fd_loader_v4_program_instruction_is_finalize(fd_loader_v4_progr
   return self->discriminant == 5;
 }
 void fd_loader_v4_program_instruction_inner_new( fd_loader_v4_program_instruction_inner_t * self, uint discriminant );
-int fd_loader_v4_program_instruction_inner_decode_preflight( uint discriminant, fd_bincode_decode_ctx_t * ctx ) {
+int fd_loader_v4_program_instruction_inner_decode_footprint( uint discriminant, fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   switch (discriminant) {
   case 0: {
-    err = fd_loader_v4_program_instruction_write_decode_preflight( ctx );
+    err = fd_loader_v4_program_instruction_write_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 1: {
-    err = fd_loader_v4_program_instruction_truncate_decode_preflight( ctx );
+    err = fd_loader_v4_program_instruction_truncate_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
@@ -21966,16 +25260,36 @@ int fd_loader_v4_program_instruction_decode( fd_loader_v4_program_instruction_t
   fd_loader_v4_program_instruction_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_loader_v4_program_instruction_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_loader_v4_program_instruction_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   uint discriminant = 0;
   int err = fd_bincode_uint32_decode( &discriminant, ctx );
   if( FD_UNLIKELY( err ) ) return err;
-  return fd_loader_v4_program_instruction_inner_decode_preflight( discriminant, ctx );
+  return fd_loader_v4_program_instruction_inner_decode_footprint( discriminant, ctx, total_sz );
+}
+int fd_loader_v4_program_instruction_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_loader_v4_program_instruction_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_loader_v4_program_instruction_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_loader_v4_program_instruction_t);
+  int err = fd_loader_v4_program_instruction_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
 }
 void fd_loader_v4_program_instruction_decode_unsafe( fd_loader_v4_program_instruction_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint32_decode_unsafe( &self->discriminant, ctx );
   fd_loader_v4_program_instruction_inner_decode_unsafe( &self->inner, self->discriminant, ctx );
 }
+fd_loader_v4_program_instruction_t * fd_loader_v4_program_instruction_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_loader_v4_program_instruction_t * self = (fd_loader_v4_program_instruction_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_loader_v4_program_instruction_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_loader_v4_program_instruction_new( self );
+  fd_loader_v4_program_instruction_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 void fd_loader_v4_program_instruction_inner_new( fd_loader_v4_program_instruction_inner_t * self, uint discriminant ) {
   switch( discriminant ) {
   case 0: {
@@ -22110,7 +25424,7 @@ int fd_bpf_upgradeable_loader_program_instruction_write_decode( fd_bpf_upgradeab
   fd_bpf_upgradeable_loader_program_instruction_write_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_bpf_upgradeable_loader_program_instruction_write_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_bpf_upgradeable_loader_program_instruction_write_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   err = fd_bincode_uint32_decode_preflight( ctx );
   if( FD_UNLIKELY( err ) ) return err;
@@ -22118,11 +25432,23 @@ int fd_bpf_upgradeable_loader_program_instruction_write_decode_preflight( fd_bin
   err = fd_bincode_uint64_decode( &bytes_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( bytes_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, bytes_len );
     err = fd_bincode_bytes_decode_preflight( bytes_len, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_bpf_upgradeable_loader_program_instruction_write_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_bpf_upgradeable_loader_program_instruction_write_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_bpf_upgradeable_loader_program_instruction_write_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_bpf_upgradeable_loader_program_instruction_write_t);
+  int err = fd_bpf_upgradeable_loader_program_instruction_write_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_bpf_upgradeable_loader_program_instruction_write_decode_unsafe( fd_bpf_upgradeable_loader_program_instruction_write_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint32_decode_unsafe( &self->offset, ctx );
   fd_bincode_uint64_decode_unsafe( &self->bytes_len, ctx );
@@ -22132,6 +25458,15 @@ void fd_bpf_upgradeable_loader_program_instruction_write_decode_unsafe( fd_bpf_u
   } else
     self->bytes = NULL;
 }
+fd_bpf_upgradeable_loader_program_instruction_write_t * fd_bpf_upgradeable_loader_program_instruction_write_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_bpf_upgradeable_loader_program_instruction_write_t * self = (fd_bpf_upgradeable_loader_program_instruction_write_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_bpf_upgradeable_loader_program_instruction_write_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_bpf_upgradeable_loader_program_instruction_write_new( self );
+  fd_bpf_upgradeable_loader_program_instruction_write_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_bpf_upgradeable_loader_program_instruction_write_encode( fd_bpf_upgradeable_loader_program_instruction_write_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint32_encode( self->offset, ctx );
@@ -22146,6 +25481,7 @@ int fd_bpf_upgradeable_loader_program_instruction_write_encode( fd_bpf_upgradeab
 }
 int fd_bpf_upgradeable_loader_program_instruction_write_decode_offsets( fd_bpf_upgradeable_loader_program_instruction_write_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->offset_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint32_decode_preflight( ctx );
@@ -22155,6 +25491,7 @@ int fd_bpf_upgradeable_loader_program_instruction_write_decode_offsets( fd_bpf_u
   err = fd_bincode_uint64_decode( &bytes_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( bytes_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, bytes_len );
     err = fd_bincode_bytes_decode_preflight( bytes_len, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   }
@@ -22200,12 +25537,32 @@ int fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_decod
   fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 8, ctx );
 }
+int fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_t);
+  int err = fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_decode_unsafe( fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->max_data_len, ctx );
 }
+fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_t * fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_t * self = (fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_new( self );
+  fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_encode( fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->max_data_len, ctx );
@@ -22214,6 +25571,7 @@ int fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_encod
 }
 int fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_decode_offsets( fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->max_data_len_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -22228,6 +25586,7 @@ void fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_dest
 
 ulong fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_footprint( void ){ return FD_BPF_UPGRADEABLE_LOADER_PROGRAM_INSTRUCTION_DEPLOY_WITH_MAX_DATA_LEN_FOOTPRINT; }
 ulong fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_align( void ){ return FD_BPF_UPGRADEABLE_LOADER_PROGRAM_INSTRUCTION_DEPLOY_WITH_MAX_DATA_LEN_ALIGN; }
+FD_STATIC_ASSERT( sizeof(fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_t)==8UL, fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_view );
 
 void fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_walk( void * w, fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len", level++ );
@@ -22251,12 +25610,32 @@ int fd_bpf_upgradeable_loader_program_instruction_extend_program_decode( fd_bpf_
   fd_bpf_upgradeable_loader_program_instruction_extend_program_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_bpf_upgradeable_loader_program_instruction_extend_program_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_bpf_upgradeable_loader_program_instruction_extend_program_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 4, ctx );
 }
+int fd_bpf_upgradeable_loader_program_instruction_extend_program_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_bpf_upgradeable_loader_program_instruction_extend_program_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_bpf_upgradeable_loader_program_instruction_extend_program_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_bpf_upgradeable_loader_program_instruction_extend_program_t);
+  int err = fd_bpf_upgradeable_loader_program_instruction_extend_program_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_bpf_upgradeable_loader_program_instruction_extend_program_decode_unsafe( fd_bpf_upgradeable_loader_program_instruction_extend_program_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint32_decode_unsafe( &self->additional_bytes, ctx );
 }
+fd_bpf_upgradeable_loader_program_instruction_extend_program_t * fd_bpf_upgradeable_loader_program_instruction_extend_program_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_bpf_upgradeable_loader_program_instruction_extend_program_t * self = (fd_bpf_upgradeable_loader_program_instruction_extend_program_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_bpf_upgradeable_loader_program_instruction_extend_program_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_bpf_upgradeable_loader_program_instruction_extend_program_new( self );
+  fd_bpf_upgradeable_loader_program_instruction_extend_program_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_bpf_upgradeable_loader_program_instruction_extend_program_encode( fd_bpf_upgradeable_loader_program_instruction_extend_program_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint32_encode( self->additional_bytes, ctx );
@@ -22265,6 +25644,7 @@ int fd_bpf_upgradeable_loader_program_instruction_extend_program_encode( fd_bpf_
 }
 int fd_bpf_upgradeable_loader_program_instruction_extend_program_decode_offsets( fd_bpf_upgradeable_loader_program_instruction_extend_program_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->additional_bytes_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint32_decode_preflight( ctx );
@@ -22316,19 +25696,19 @@ FD_FN_PURE uchar fd_bpf_upgradeable_loader_program_instruction_is_set_authority_
   return self->discriminant == 7;
 }
 void fd_bpf_upgradeable_loader_program_instruction_inner_new( fd_bpf_upgradeable_loader_program_instruction_inner_t * self, uint discriminant );
-int fd_bpf_upgradeable_loader_program_instruction_inner_decode_preflight( uint discriminant, fd_bincode_decode_ctx_t * ctx ) {
+int fd_bpf_upgradeable_loader_program_instruction_inner_decode_footprint( uint discriminant, fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   switch (discriminant) {
   case 0: {
     return FD_BINCODE_SUCCESS;
   }
   case 1: {
-    err = fd_bpf_upgradeable_loader_program_instruction_write_decode_preflight( ctx );
+    err = fd_bpf_upgradeable_loader_program_instruction_write_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 2: {
-    err = fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_decode_preflight( ctx );
+    err = fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
@@ -22342,7 +25722,7 @@ int fd_bpf_upgradeable_loader_program_instruction_inner_decode_preflight( uint d
     return FD_BINCODE_SUCCESS;
   }
   case 6: {
-    err = fd_bpf_upgradeable_loader_program_instruction_extend_program_decode_preflight( ctx );
+    err = fd_bpf_upgradeable_loader_program_instruction_extend_program_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
@@ -22394,16 +25774,36 @@ int fd_bpf_upgradeable_loader_program_instruction_decode( fd_bpf_upgradeable_loa
   fd_bpf_upgradeable_loader_program_instruction_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_bpf_upgradeable_loader_program_instruction_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_bpf_upgradeable_loader_program_instruction_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   uint discriminant = 0;
   int err = fd_bincode_uint32_decode( &discriminant, ctx );
   if( FD_UNLIKELY( err ) ) return err;
-  return fd_bpf_upgradeable_loader_program_instruction_inner_decode_preflight( discriminant, ctx );
+  return fd_bpf_upgradeable_loader_program_instruction_inner_decode_footprint( discriminant, ctx, total_sz );
+}
+int fd_bpf_upgradeable_loader_program_instruction_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_bpf_upgradeable_loader_program_instruction_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_bpf_upgradeable_loader_program_instruction_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_bpf_upgradeable_loader_program_instruction_t);
+  int err = fd_bpf_upgradeable_loader_program_instruction_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
 }
 void fd_bpf_upgradeable_loader_program_instruction_decode_unsafe( fd_bpf_upgradeable_loader_program_instruction_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint32_decode_unsafe( &self->discriminant, ctx );
   fd_bpf_upgradeable_loader_program_instruction_inner_decode_unsafe( &self->inner, self->discriminant, ctx );
 }
+fd_bpf_upgradeable_loader_program_instruction_t * fd_bpf_upgradeable_loader_program_instruction_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_bpf_upgradeable_loader_program_instruction_t * self = (fd_bpf_upgradeable_loader_program_instruction_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_bpf_upgradeable_loader_program_instruction_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_bpf_upgradeable_loader_program_instruction_new( self );
+  fd_bpf_upgradeable_loader_program_instruction_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 void fd_bpf_upgradeable_loader_program_instruction_inner_new( fd_bpf_upgradeable_loader_program_instruction_inner_t * self, uint discriminant ) {
   switch( discriminant ) {
   case 0: {
@@ -22567,19 +25967,31 @@ int fd_bpf_upgradeable_loader_state_buffer_decode( fd_bpf_upgradeable_loader_sta
   fd_bpf_upgradeable_loader_state_buffer_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_bpf_upgradeable_loader_state_buffer_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_bpf_upgradeable_loader_state_buffer_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   {
     uchar o;
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
-      err = fd_pubkey_decode_preflight( ctx );
+      *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_PUBKEY_ALIGN, FD_PUBKEY_FOOTPRINT );
+      err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_bpf_upgradeable_loader_state_buffer_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_bpf_upgradeable_loader_state_buffer_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_bpf_upgradeable_loader_state_buffer_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_bpf_upgradeable_loader_state_buffer_t);
+  int err = fd_bpf_upgradeable_loader_state_buffer_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_bpf_upgradeable_loader_state_buffer_decode_unsafe( fd_bpf_upgradeable_loader_state_buffer_t * self, fd_bincode_decode_ctx_t * ctx ) {
   {
     uchar o;
@@ -22592,6 +26004,15 @@ void fd_bpf_upgradeable_loader_state_buffer_decode_unsafe( fd_bpf_upgradeable_lo
       self->authority_address = NULL;
   }
 }
+fd_bpf_upgradeable_loader_state_buffer_t * fd_bpf_upgradeable_loader_state_buffer_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_bpf_upgradeable_loader_state_buffer_t * self = (fd_bpf_upgradeable_loader_state_buffer_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_bpf_upgradeable_loader_state_buffer_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_bpf_upgradeable_loader_state_buffer_new( self );
+  fd_bpf_upgradeable_loader_state_buffer_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_bpf_upgradeable_loader_state_buffer_encode( fd_bpf_upgradeable_loader_state_buffer_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   if( self->authority_address != NULL ) {
@@ -22607,6 +26028,7 @@ int fd_bpf_upgradeable_loader_state_buffer_encode( fd_bpf_upgradeable_loader_sta
 }
 int fd_bpf_upgradeable_loader_state_buffer_decode_offsets( fd_bpf_upgradeable_loader_state_buffer_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->authority_address_off = (uint)( (ulong)ctx->data - (ulong)data );
   {
@@ -22614,7 +26036,8 @@ int fd_bpf_upgradeable_loader_state_buffer_decode_offsets( fd_bpf_upgradeable_lo
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
-      err = fd_pubkey_decode_preflight( ctx );
+      *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_PUBKEY_ALIGN, FD_PUBKEY_FOOTPRINT );
+      err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -22663,12 +26086,32 @@ int fd_bpf_upgradeable_loader_state_program_decode( fd_bpf_upgradeable_loader_st
   fd_bpf_upgradeable_loader_state_program_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_bpf_upgradeable_loader_state_program_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_bpf_upgradeable_loader_state_program_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 32, ctx );
 }
+int fd_bpf_upgradeable_loader_state_program_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_bpf_upgradeable_loader_state_program_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_bpf_upgradeable_loader_state_program_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_bpf_upgradeable_loader_state_program_t);
+  int err = fd_bpf_upgradeable_loader_state_program_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_bpf_upgradeable_loader_state_program_decode_unsafe( fd_bpf_upgradeable_loader_state_program_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->programdata_address, ctx );
 }
+fd_bpf_upgradeable_loader_state_program_t * fd_bpf_upgradeable_loader_state_program_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_bpf_upgradeable_loader_state_program_t * self = (fd_bpf_upgradeable_loader_state_program_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_bpf_upgradeable_loader_state_program_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_bpf_upgradeable_loader_state_program_new( self );
+  fd_bpf_upgradeable_loader_state_program_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_bpf_upgradeable_loader_state_program_encode( fd_bpf_upgradeable_loader_state_program_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->programdata_address, ctx );
@@ -22677,9 +26120,10 @@ int fd_bpf_upgradeable_loader_state_program_encode( fd_bpf_upgradeable_loader_st
 }
 int fd_bpf_upgradeable_loader_state_program_decode_offsets( fd_bpf_upgradeable_loader_state_program_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->programdata_address_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -22693,6 +26137,7 @@ void fd_bpf_upgradeable_loader_state_program_destroy( fd_bpf_upgradeable_loader_
 
 ulong fd_bpf_upgradeable_loader_state_program_footprint( void ){ return FD_BPF_UPGRADEABLE_LOADER_STATE_PROGRAM_FOOTPRINT; }
 ulong fd_bpf_upgradeable_loader_state_program_align( void ){ return FD_BPF_UPGRADEABLE_LOADER_STATE_PROGRAM_ALIGN; }
+FD_STATIC_ASSERT( sizeof(fd_bpf_upgradeable_loader_state_program_t)==32UL, fd_bpf_upgradeable_loader_state_program_view );
 
 void fd_bpf_upgradeable_loader_state_program_walk( void * w, fd_bpf_upgradeable_loader_state_program_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_bpf_upgradeable_loader_state_program", level++ );
@@ -22716,7 +26161,7 @@ int fd_bpf_upgradeable_loader_state_program_data_decode( fd_bpf_upgradeable_load
   fd_bpf_upgradeable_loader_state_program_data_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_bpf_upgradeable_loader_state_program_data_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_bpf_upgradeable_loader_state_program_data_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -22725,12 +26170,24 @@ int fd_bpf_upgradeable_loader_state_program_data_decode_preflight( fd_bincode_de
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
-      err = fd_pubkey_decode_preflight( ctx );
+      *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_PUBKEY_ALIGN, FD_PUBKEY_FOOTPRINT );
+      err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_bpf_upgradeable_loader_state_program_data_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_bpf_upgradeable_loader_state_program_data_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_bpf_upgradeable_loader_state_program_data_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_bpf_upgradeable_loader_state_program_data_t);
+  int err = fd_bpf_upgradeable_loader_state_program_data_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_bpf_upgradeable_loader_state_program_data_decode_unsafe( fd_bpf_upgradeable_loader_state_program_data_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->slot, ctx );
   {
@@ -22744,6 +26201,15 @@ void fd_bpf_upgradeable_loader_state_program_data_decode_unsafe( fd_bpf_upgradea
       self->upgrade_authority_address = NULL;
   }
 }
+fd_bpf_upgradeable_loader_state_program_data_t * fd_bpf_upgradeable_loader_state_program_data_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_bpf_upgradeable_loader_state_program_data_t * self = (fd_bpf_upgradeable_loader_state_program_data_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_bpf_upgradeable_loader_state_program_data_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_bpf_upgradeable_loader_state_program_data_new( self );
+  fd_bpf_upgradeable_loader_state_program_data_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_bpf_upgradeable_loader_state_program_data_encode( fd_bpf_upgradeable_loader_state_program_data_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->slot, ctx );
@@ -22761,6 +26227,7 @@ int fd_bpf_upgradeable_loader_state_program_data_encode( fd_bpf_upgradeable_load
 }
 int fd_bpf_upgradeable_loader_state_program_data_decode_offsets( fd_bpf_upgradeable_loader_state_program_data_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->slot_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -22771,7 +26238,8 @@ int fd_bpf_upgradeable_loader_state_program_data_decode_offsets( fd_bpf_upgradea
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
-      err = fd_pubkey_decode_preflight( ctx );
+      *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_PUBKEY_ALIGN, FD_PUBKEY_FOOTPRINT );
+      err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -22824,24 +26292,24 @@ FD_FN_PURE uchar fd_bpf_upgradeable_loader_state_is_program_data(fd_bpf_upgradea
   return self->discriminant == 3;
 }
 void fd_bpf_upgradeable_loader_state_inner_new( fd_bpf_upgradeable_loader_state_inner_t * self, uint discriminant );
-int fd_bpf_upgradeable_loader_state_inner_decode_preflight( uint discriminant, fd_bincode_decode_ctx_t * ctx ) {
+int fd_bpf_upgradeable_loader_state_inner_decode_footprint( uint discriminant, fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   switch (discriminant) {
   case 0: {
     return FD_BINCODE_SUCCESS;
   }
   case 1: {
-    err = fd_bpf_upgradeable_loader_state_buffer_decode_preflight( ctx );
+    err = fd_bpf_upgradeable_loader_state_buffer_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 2: {
-    err = fd_bpf_upgradeable_loader_state_program_decode_preflight( ctx );
+    err = fd_bpf_upgradeable_loader_state_program_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 3: {
-    err = fd_bpf_upgradeable_loader_state_program_data_decode_preflight( ctx );
+    err = fd_bpf_upgradeable_loader_state_program_data_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
@@ -22878,16 +26346,36 @@ int fd_bpf_upgradeable_loader_state_decode( fd_bpf_upgradeable_loader_state_t *
   fd_bpf_upgradeable_loader_state_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_bpf_upgradeable_loader_state_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_bpf_upgradeable_loader_state_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   uint discriminant = 0;
   int err = fd_bincode_uint32_decode( &discriminant, ctx );
   if( FD_UNLIKELY( err ) ) return err;
-  return fd_bpf_upgradeable_loader_state_inner_decode_preflight( discriminant, ctx );
+  return fd_bpf_upgradeable_loader_state_inner_decode_footprint( discriminant, ctx, total_sz );
+}
+int fd_bpf_upgradeable_loader_state_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_bpf_upgradeable_loader_state_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_bpf_upgradeable_loader_state_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_bpf_upgradeable_loader_state_t);
+  int err = fd_bpf_upgradeable_loader_state_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
 }
 void fd_bpf_upgradeable_loader_state_decode_unsafe( fd_bpf_upgradeable_loader_state_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint32_decode_unsafe( &self->discriminant, ctx );
   fd_bpf_upgradeable_loader_state_inner_decode_unsafe( &self->inner, self->discriminant, ctx );
 }
+fd_bpf_upgradeable_loader_state_t * fd_bpf_upgradeable_loader_state_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_bpf_upgradeable_loader_state_t * self = (fd_bpf_upgradeable_loader_state_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_bpf_upgradeable_loader_state_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_bpf_upgradeable_loader_state_new( self );
+  fd_bpf_upgradeable_loader_state_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 void fd_bpf_upgradeable_loader_state_inner_new( fd_bpf_upgradeable_loader_state_inner_t * self, uint discriminant ) {
   switch( discriminant ) {
   case 0: {
@@ -23023,14 +26511,34 @@ int fd_loader_v4_state_decode( fd_loader_v4_state_t * self, fd_bincode_decode_ct
   fd_loader_v4_state_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_loader_v4_state_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_loader_v4_state_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 48, ctx );
 }
+int fd_loader_v4_state_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_loader_v4_state_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_loader_v4_state_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_loader_v4_state_t);
+  int err = fd_loader_v4_state_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_loader_v4_state_decode_unsafe( fd_loader_v4_state_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->slot, ctx );
   fd_pubkey_decode_unsafe( &self->authority_address_or_next_version, ctx );
   fd_bincode_uint64_decode_unsafe( &self->status, ctx );
 }
+fd_loader_v4_state_t * fd_loader_v4_state_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_loader_v4_state_t * self = (fd_loader_v4_state_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_loader_v4_state_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_loader_v4_state_new( self );
+  fd_loader_v4_state_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_loader_v4_state_encode( fd_loader_v4_state_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->slot, ctx );
@@ -23043,12 +26551,13 @@ int fd_loader_v4_state_encode( fd_loader_v4_state_t const * self, fd_bincode_enc
 }
 int fd_loader_v4_state_decode_offsets( fd_loader_v4_state_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->slot_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->authority_address_or_next_version_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->status_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -23065,6 +26574,7 @@ void fd_loader_v4_state_destroy( fd_loader_v4_state_t * self, fd_bincode_destroy
 
 ulong fd_loader_v4_state_footprint( void ){ return FD_LOADER_V4_STATE_FOOTPRINT; }
 ulong fd_loader_v4_state_align( void ){ return FD_LOADER_V4_STATE_ALIGN; }
+FD_STATIC_ASSERT( sizeof(fd_loader_v4_state_t)==48UL, fd_loader_v4_state_view );
 
 void fd_loader_v4_state_walk( void * w, fd_loader_v4_state_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_loader_v4_state", level++ );
@@ -23092,18 +26602,38 @@ int fd_frozen_hash_status_decode( fd_frozen_hash_status_t * self, fd_bincode_dec
   fd_frozen_hash_status_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_frozen_hash_status_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_frozen_hash_status_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_bool_decode_preflight( ctx );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_frozen_hash_status_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_frozen_hash_status_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_frozen_hash_status_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_frozen_hash_status_t);
+  int err = fd_frozen_hash_status_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_frozen_hash_status_decode_unsafe( fd_frozen_hash_status_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_hash_decode_unsafe( &self->frozen_hash, ctx );
   fd_bincode_bool_decode_unsafe( &self->is_duplicate_confirmed, ctx );
 }
+fd_frozen_hash_status_t * fd_frozen_hash_status_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_frozen_hash_status_t * self = (fd_frozen_hash_status_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_frozen_hash_status_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_frozen_hash_status_new( self );
+  fd_frozen_hash_status_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_frozen_hash_status_encode( fd_frozen_hash_status_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_hash_encode( &self->frozen_hash, ctx );
@@ -23114,9 +26644,10 @@ int fd_frozen_hash_status_encode( fd_frozen_hash_status_t const * self, fd_binco
 }
 int fd_frozen_hash_status_decode_offsets( fd_frozen_hash_status_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->frozen_hash_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->is_duplicate_confirmed_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_bool_decode_preflight( ctx );
@@ -23151,11 +26682,11 @@ FD_FN_PURE uchar fd_frozen_hash_versioned_is_current(fd_frozen_hash_versioned_t
   return self->discriminant == 0;
 }
 void fd_frozen_hash_versioned_inner_new( fd_frozen_hash_versioned_inner_t * self, uint discriminant );
-int fd_frozen_hash_versioned_inner_decode_preflight( uint discriminant, fd_bincode_decode_ctx_t * ctx ) {
+int fd_frozen_hash_versioned_inner_decode_footprint( uint discriminant, fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   switch (discriminant) {
   case 0: {
-    err = fd_frozen_hash_status_decode_preflight( ctx );
+    err = fd_frozen_hash_status_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
@@ -23181,16 +26712,36 @@ int fd_frozen_hash_versioned_decode( fd_frozen_hash_versioned_t * self, fd_binco
   fd_frozen_hash_versioned_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_frozen_hash_versioned_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_frozen_hash_versioned_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   uint discriminant = 0;
   int err = fd_bincode_uint32_decode( &discriminant, ctx );
   if( FD_UNLIKELY( err ) ) return err;
-  return fd_frozen_hash_versioned_inner_decode_preflight( discriminant, ctx );
+  return fd_frozen_hash_versioned_inner_decode_footprint( discriminant, ctx, total_sz );
+}
+int fd_frozen_hash_versioned_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_frozen_hash_versioned_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_frozen_hash_versioned_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_frozen_hash_versioned_t);
+  int err = fd_frozen_hash_versioned_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
 }
 void fd_frozen_hash_versioned_decode_unsafe( fd_frozen_hash_versioned_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint32_decode_unsafe( &self->discriminant, ctx );
   fd_frozen_hash_versioned_inner_decode_unsafe( &self->inner, self->discriminant, ctx );
 }
+fd_frozen_hash_versioned_t * fd_frozen_hash_versioned_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_frozen_hash_versioned_t * self = (fd_frozen_hash_versioned_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_frozen_hash_versioned_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_frozen_hash_versioned_new( self );
+  fd_frozen_hash_versioned_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 void fd_frozen_hash_versioned_inner_new( fd_frozen_hash_versioned_inner_t * self, uint discriminant ) {
   switch( discriminant ) {
   case 0: {
@@ -23275,7 +26826,7 @@ int fd_lookup_table_meta_decode( fd_lookup_table_meta_t * self, fd_bincode_decod
   fd_lookup_table_meta_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_lookup_table_meta_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_lookup_table_meta_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -23288,7 +26839,7 @@ int fd_lookup_table_meta_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
-      err = fd_pubkey_decode_preflight( ctx );
+      err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -23296,6 +26847,17 @@ int fd_lookup_table_meta_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_lookup_table_meta_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_lookup_table_meta_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_lookup_table_meta_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_lookup_table_meta_t);
+  int err = fd_lookup_table_meta_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_lookup_table_meta_decode_unsafe( fd_lookup_table_meta_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->deactivation_slot, ctx );
   fd_bincode_uint64_decode_unsafe( &self->last_extended_slot, ctx );
@@ -23311,6 +26873,15 @@ void fd_lookup_table_meta_decode_unsafe( fd_lookup_table_meta_t * self, fd_binco
   }
   fd_bincode_uint16_decode_unsafe( &self->_padding, ctx );
 }
+fd_lookup_table_meta_t * fd_lookup_table_meta_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_lookup_table_meta_t * self = (fd_lookup_table_meta_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_lookup_table_meta_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_lookup_table_meta_new( self );
+  fd_lookup_table_meta_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_lookup_table_meta_encode( fd_lookup_table_meta_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->deactivation_slot, ctx );
@@ -23331,6 +26902,7 @@ int fd_lookup_table_meta_encode( fd_lookup_table_meta_t const * self, fd_bincode
 }
 int fd_lookup_table_meta_decode_offsets( fd_lookup_table_meta_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->deactivation_slot_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -23347,7 +26919,7 @@ int fd_lookup_table_meta_decode_offsets( fd_lookup_table_meta_off_t * self, fd_b
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
-      err = fd_pubkey_decode_preflight( ctx );
+      err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -23406,15 +26978,35 @@ int fd_address_lookup_table_decode( fd_address_lookup_table_t * self, fd_bincode
   fd_address_lookup_table_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_address_lookup_table_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_address_lookup_table_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_lookup_table_meta_decode_preflight( ctx );
+  err = fd_lookup_table_meta_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_address_lookup_table_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_address_lookup_table_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_address_lookup_table_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_address_lookup_table_t);
+  int err = fd_address_lookup_table_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_address_lookup_table_decode_unsafe( fd_address_lookup_table_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_lookup_table_meta_decode_unsafe( &self->meta, ctx );
 }
+fd_address_lookup_table_t * fd_address_lookup_table_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_address_lookup_table_t * self = (fd_address_lookup_table_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_address_lookup_table_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_address_lookup_table_new( self );
+  fd_address_lookup_table_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_address_lookup_table_encode( fd_address_lookup_table_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_lookup_table_meta_encode( &self->meta, ctx );
@@ -23423,9 +27015,10 @@ int fd_address_lookup_table_encode( fd_address_lookup_table_t const * self, fd_b
 }
 int fd_address_lookup_table_decode_offsets( fd_address_lookup_table_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->meta_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_lookup_table_meta_decode_preflight( ctx );
+  err = fd_lookup_table_meta_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -23458,14 +27051,14 @@ FD_FN_PURE uchar fd_address_lookup_table_state_is_lookup_table(fd_address_lookup
   return self->discriminant == 1;
 }
 void fd_address_lookup_table_state_inner_new( fd_address_lookup_table_state_inner_t * self, uint discriminant );
-int fd_address_lookup_table_state_inner_decode_preflight( uint discriminant, fd_bincode_decode_ctx_t * ctx ) {
+int fd_address_lookup_table_state_inner_decode_footprint( uint discriminant, fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   switch (discriminant) {
   case 0: {
     return FD_BINCODE_SUCCESS;
   }
   case 1: {
-    err = fd_address_lookup_table_decode_preflight( ctx );
+    err = fd_address_lookup_table_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
@@ -23494,16 +27087,36 @@ int fd_address_lookup_table_state_decode( fd_address_lookup_table_state_t * self
   fd_address_lookup_table_state_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_address_lookup_table_state_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_address_lookup_table_state_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   uint discriminant = 0;
   int err = fd_bincode_uint32_decode( &discriminant, ctx );
   if( FD_UNLIKELY( err ) ) return err;
-  return fd_address_lookup_table_state_inner_decode_preflight( discriminant, ctx );
+  return fd_address_lookup_table_state_inner_decode_footprint( discriminant, ctx, total_sz );
+}
+int fd_address_lookup_table_state_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_address_lookup_table_state_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_address_lookup_table_state_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_address_lookup_table_state_t);
+  int err = fd_address_lookup_table_state_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
 }
 void fd_address_lookup_table_state_decode_unsafe( fd_address_lookup_table_state_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint32_decode_unsafe( &self->discriminant, ctx );
   fd_address_lookup_table_state_inner_decode_unsafe( &self->inner, self->discriminant, ctx );
 }
+fd_address_lookup_table_state_t * fd_address_lookup_table_state_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_address_lookup_table_state_t * self = (fd_address_lookup_table_state_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_address_lookup_table_state_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_address_lookup_table_state_new( self );
+  fd_address_lookup_table_state_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 void fd_address_lookup_table_state_inner_new( fd_address_lookup_table_state_inner_t * self, uint discriminant ) {
   switch( discriminant ) {
   case 0: {
@@ -23595,17 +27208,29 @@ int fd_gossip_bitvec_u8_inner_decode( fd_gossip_bitvec_u8_inner_t * self, fd_bin
   fd_gossip_bitvec_u8_inner_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_gossip_bitvec_u8_inner_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_gossip_bitvec_u8_inner_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   ulong vec_len;
   err = fd_bincode_uint64_decode( &vec_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( vec_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, vec_len );
     err = fd_bincode_bytes_decode_preflight( vec_len, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_gossip_bitvec_u8_inner_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_gossip_bitvec_u8_inner_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_gossip_bitvec_u8_inner_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_gossip_bitvec_u8_inner_t);
+  int err = fd_gossip_bitvec_u8_inner_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_gossip_bitvec_u8_inner_decode_unsafe( fd_gossip_bitvec_u8_inner_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->vec_len, ctx );
   if( self->vec_len ) {
@@ -23614,6 +27239,15 @@ void fd_gossip_bitvec_u8_inner_decode_unsafe( fd_gossip_bitvec_u8_inner_t * self
   } else
     self->vec = NULL;
 }
+fd_gossip_bitvec_u8_inner_t * fd_gossip_bitvec_u8_inner_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_gossip_bitvec_u8_inner_t * self = (fd_gossip_bitvec_u8_inner_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_gossip_bitvec_u8_inner_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_gossip_bitvec_u8_inner_new( self );
+  fd_gossip_bitvec_u8_inner_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_gossip_bitvec_u8_inner_encode( fd_gossip_bitvec_u8_inner_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->vec_len, ctx );
@@ -23626,12 +27260,14 @@ int fd_gossip_bitvec_u8_inner_encode( fd_gossip_bitvec_u8_inner_t const * self,
 }
 int fd_gossip_bitvec_u8_inner_decode_offsets( fd_gossip_bitvec_u8_inner_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->vec_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong vec_len;
   err = fd_bincode_uint64_decode( &vec_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( vec_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, vec_len );
     err = fd_bincode_bytes_decode_preflight( vec_len, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   }
@@ -23675,14 +27311,14 @@ int fd_gossip_bitvec_u8_decode( fd_gossip_bitvec_u8_t * self, fd_bincode_decode_
   fd_gossip_bitvec_u8_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_gossip_bitvec_u8_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_gossip_bitvec_u8_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   {
     uchar o;
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
-      err = fd_gossip_bitvec_u8_inner_decode_preflight( ctx );
+      err = fd_gossip_bitvec_u8_inner_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -23690,6 +27326,17 @@ int fd_gossip_bitvec_u8_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_gossip_bitvec_u8_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_gossip_bitvec_u8_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_gossip_bitvec_u8_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_gossip_bitvec_u8_t);
+  int err = fd_gossip_bitvec_u8_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_gossip_bitvec_u8_decode_unsafe( fd_gossip_bitvec_u8_t * self, fd_bincode_decode_ctx_t * ctx ) {
   {
     uchar o;
@@ -23702,6 +27349,15 @@ void fd_gossip_bitvec_u8_decode_unsafe( fd_gossip_bitvec_u8_t * self, fd_bincode
   }
   fd_bincode_uint64_decode_unsafe( &self->len, ctx );
 }
+fd_gossip_bitvec_u8_t * fd_gossip_bitvec_u8_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_gossip_bitvec_u8_t * self = (fd_gossip_bitvec_u8_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_gossip_bitvec_u8_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_gossip_bitvec_u8_new( self );
+  fd_gossip_bitvec_u8_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_gossip_bitvec_u8_encode( fd_gossip_bitvec_u8_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_bool_encode( self->has_bits, ctx );
@@ -23716,6 +27372,7 @@ int fd_gossip_bitvec_u8_encode( fd_gossip_bitvec_u8_t const * self, fd_bincode_e
 }
 int fd_gossip_bitvec_u8_decode_offsets( fd_gossip_bitvec_u8_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->bits_off = (uint)( (ulong)ctx->data - (ulong)data );
   {
@@ -23723,7 +27380,7 @@ int fd_gossip_bitvec_u8_decode_offsets( fd_gossip_bitvec_u8_off_t * self, fd_bin
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
-      err = fd_gossip_bitvec_u8_inner_decode_preflight( ctx );
+      err = fd_gossip_bitvec_u8_inner_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -23776,12 +27433,13 @@ int fd_gossip_bitvec_u64_inner_decode( fd_gossip_bitvec_u64_inner_t * self, fd_b
   fd_gossip_bitvec_u64_inner_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_gossip_bitvec_u64_inner_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_gossip_bitvec_u64_inner_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   ulong vec_len;
   err = fd_bincode_uint64_decode( &vec_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( vec_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, sizeof(ulong)*vec_len );
     for( ulong i=0; i < vec_len; i++ ) {
       err = fd_bincode_uint64_decode_preflight( ctx );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -23789,6 +27447,17 @@ int fd_gossip_bitvec_u64_inner_decode_preflight( fd_bincode_decode_ctx_t * ctx )
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_gossip_bitvec_u64_inner_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_gossip_bitvec_u64_inner_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_gossip_bitvec_u64_inner_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_gossip_bitvec_u64_inner_t);
+  int err = fd_gossip_bitvec_u64_inner_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_gossip_bitvec_u64_inner_decode_unsafe( fd_gossip_bitvec_u64_inner_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->vec_len, ctx );
   if( self->vec_len ) {
@@ -23799,6 +27468,15 @@ void fd_gossip_bitvec_u64_inner_decode_unsafe( fd_gossip_bitvec_u64_inner_t * se
   } else
     self->vec = NULL;
 }
+fd_gossip_bitvec_u64_inner_t * fd_gossip_bitvec_u64_inner_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_gossip_bitvec_u64_inner_t * self = (fd_gossip_bitvec_u64_inner_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_gossip_bitvec_u64_inner_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_gossip_bitvec_u64_inner_new( self );
+  fd_gossip_bitvec_u64_inner_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_gossip_bitvec_u64_inner_encode( fd_gossip_bitvec_u64_inner_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->vec_len, ctx );
@@ -23812,12 +27490,14 @@ int fd_gossip_bitvec_u64_inner_encode( fd_gossip_bitvec_u64_inner_t const * self
 }
 int fd_gossip_bitvec_u64_inner_decode_offsets( fd_gossip_bitvec_u64_inner_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->vec_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong vec_len;
   err = fd_bincode_uint64_decode( &vec_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( vec_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, sizeof(ulong)*vec_len );
     for( ulong i=0; i < vec_len; i++ ) {
       err = fd_bincode_uint64_decode_preflight( ctx );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -23868,14 +27548,14 @@ int fd_gossip_bitvec_u64_decode( fd_gossip_bitvec_u64_t * self, fd_bincode_decod
   fd_gossip_bitvec_u64_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_gossip_bitvec_u64_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_gossip_bitvec_u64_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   {
     uchar o;
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
-      err = fd_gossip_bitvec_u64_inner_decode_preflight( ctx );
+      err = fd_gossip_bitvec_u64_inner_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -23883,6 +27563,17 @@ int fd_gossip_bitvec_u64_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_gossip_bitvec_u64_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_gossip_bitvec_u64_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_gossip_bitvec_u64_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_gossip_bitvec_u64_t);
+  int err = fd_gossip_bitvec_u64_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_gossip_bitvec_u64_decode_unsafe( fd_gossip_bitvec_u64_t * self, fd_bincode_decode_ctx_t * ctx ) {
   {
     uchar o;
@@ -23895,6 +27586,15 @@ void fd_gossip_bitvec_u64_decode_unsafe( fd_gossip_bitvec_u64_t * self, fd_binco
   }
   fd_bincode_uint64_decode_unsafe( &self->len, ctx );
 }
+fd_gossip_bitvec_u64_t * fd_gossip_bitvec_u64_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_gossip_bitvec_u64_t * self = (fd_gossip_bitvec_u64_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_gossip_bitvec_u64_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_gossip_bitvec_u64_new( self );
+  fd_gossip_bitvec_u64_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_gossip_bitvec_u64_encode( fd_gossip_bitvec_u64_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_bool_encode( self->has_bits, ctx );
@@ -23909,6 +27609,7 @@ int fd_gossip_bitvec_u64_encode( fd_gossip_bitvec_u64_t const * self, fd_bincode
 }
 int fd_gossip_bitvec_u64_decode_offsets( fd_gossip_bitvec_u64_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->bits_off = (uint)( (ulong)ctx->data - (ulong)data );
   {
@@ -23916,7 +27617,7 @@ int fd_gossip_bitvec_u64_decode_offsets( fd_gossip_bitvec_u64_off_t * self, fd_b
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
-      err = fd_gossip_bitvec_u64_inner_decode_preflight( ctx );
+      err = fd_gossip_bitvec_u64_inner_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -23969,14 +27670,34 @@ int fd_gossip_ping_decode( fd_gossip_ping_t * self, fd_bincode_decode_ctx_t * ct
   fd_gossip_ping_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_gossip_ping_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_gossip_ping_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 128, ctx );
 }
+int fd_gossip_ping_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_gossip_ping_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_gossip_ping_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_gossip_ping_t);
+  int err = fd_gossip_ping_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_gossip_ping_decode_unsafe( fd_gossip_ping_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->from, ctx );
   fd_hash_decode_unsafe( &self->token, ctx );
   fd_signature_decode_unsafe( &self->signature, ctx );
 }
+fd_gossip_ping_t * fd_gossip_ping_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_gossip_ping_t * self = (fd_gossip_ping_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_gossip_ping_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_gossip_ping_new( self );
+  fd_gossip_ping_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_gossip_ping_encode( fd_gossip_ping_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->from, ctx );
@@ -23989,15 +27710,16 @@ int fd_gossip_ping_encode( fd_gossip_ping_t const * self, fd_bincode_encode_ctx_
 }
 int fd_gossip_ping_decode_offsets( fd_gossip_ping_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->from_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->token_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->signature_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_signature_decode_preflight( ctx );
+  err = fd_signature_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -24015,6 +27737,7 @@ void fd_gossip_ping_destroy( fd_gossip_ping_t * self, fd_bincode_destroy_ctx_t *
 
 ulong fd_gossip_ping_footprint( void ){ return FD_GOSSIP_PING_FOOTPRINT; }
 ulong fd_gossip_ping_align( void ){ return FD_GOSSIP_PING_ALIGN; }
+FD_STATIC_ASSERT( sizeof(fd_gossip_ping_t)==128UL, fd_gossip_ping_view );
 
 void fd_gossip_ping_walk( void * w, fd_gossip_ping_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_gossip_ping", level++ );
@@ -24038,16 +27761,16 @@ FD_FN_PURE uchar fd_gossip_ip_addr_is_ip6(fd_gossip_ip_addr_t const * self) {
   return self->discriminant == 1;
 }
 void fd_gossip_ip_addr_inner_new( fd_gossip_ip_addr_inner_t * self, uint discriminant );
-int fd_gossip_ip_addr_inner_decode_preflight( uint discriminant, fd_bincode_decode_ctx_t * ctx ) {
+int fd_gossip_ip_addr_inner_decode_footprint( uint discriminant, fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   switch (discriminant) {
   case 0: {
-    err = fd_gossip_ip4_addr_decode_preflight( ctx );
+    err = fd_gossip_ip4_addr_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 1: {
-    err = fd_gossip_ip6_addr_decode_preflight( ctx );
+    err = fd_gossip_ip6_addr_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
@@ -24077,16 +27800,36 @@ int fd_gossip_ip_addr_decode( fd_gossip_ip_addr_t * self, fd_bincode_decode_ctx_
   fd_gossip_ip_addr_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_gossip_ip_addr_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_gossip_ip_addr_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   uint discriminant = 0;
   int err = fd_bincode_uint32_decode( &discriminant, ctx );
   if( FD_UNLIKELY( err ) ) return err;
-  return fd_gossip_ip_addr_inner_decode_preflight( discriminant, ctx );
+  return fd_gossip_ip_addr_inner_decode_footprint( discriminant, ctx, total_sz );
+}
+int fd_gossip_ip_addr_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_gossip_ip_addr_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_gossip_ip_addr_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_gossip_ip_addr_t);
+  int err = fd_gossip_ip_addr_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
 }
 void fd_gossip_ip_addr_decode_unsafe( fd_gossip_ip_addr_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint32_decode_unsafe( &self->discriminant, ctx );
   fd_gossip_ip_addr_inner_decode_unsafe( &self->inner, self->discriminant, ctx );
 }
+fd_gossip_ip_addr_t * fd_gossip_ip_addr_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_gossip_ip_addr_t * self = (fd_gossip_ip_addr_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_gossip_ip_addr_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_gossip_ip_addr_new( self );
+  fd_gossip_ip_addr_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 void fd_gossip_ip_addr_inner_new( fd_gossip_ip_addr_inner_t * self, uint discriminant ) {
   switch( discriminant ) {
   case 0: {
@@ -24193,27 +27936,39 @@ int fd_gossip_prune_data_decode( fd_gossip_prune_data_t * self, fd_bincode_decod
   fd_gossip_prune_data_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_gossip_prune_data_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_gossip_prune_data_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   ulong prunes_len;
   err = fd_bincode_uint64_decode( &prunes_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( prunes_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_PUBKEY_ALIGN, FD_PUBKEY_FOOTPRINT*prunes_len );
     for( ulong i=0; i < prunes_len; i++ ) {
-      err = fd_pubkey_decode_preflight( ctx );
+      err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
-  err = fd_signature_decode_preflight( ctx );
+  err = fd_signature_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_gossip_prune_data_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_gossip_prune_data_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_gossip_prune_data_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_gossip_prune_data_t);
+  int err = fd_gossip_prune_data_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_gossip_prune_data_decode_unsafe( fd_gossip_prune_data_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->pubkey, ctx );
   fd_bincode_uint64_decode_unsafe( &self->prunes_len, ctx );
@@ -24229,6 +27984,15 @@ void fd_gossip_prune_data_decode_unsafe( fd_gossip_prune_data_t * self, fd_binco
   fd_pubkey_decode_unsafe( &self->destination, ctx );
   fd_bincode_uint64_decode_unsafe( &self->wallclock, ctx );
 }
+fd_gossip_prune_data_t * fd_gossip_prune_data_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_gossip_prune_data_t * self = (fd_gossip_prune_data_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_gossip_prune_data_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_gossip_prune_data_new( self );
+  fd_gossip_prune_data_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_gossip_prune_data_encode( fd_gossip_prune_data_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->pubkey, ctx );
@@ -24251,25 +28015,27 @@ int fd_gossip_prune_data_encode( fd_gossip_prune_data_t const * self, fd_bincode
 }
 int fd_gossip_prune_data_decode_offsets( fd_gossip_prune_data_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->pubkey_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->prunes_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong prunes_len;
   err = fd_bincode_uint64_decode( &prunes_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( prunes_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_PUBKEY_ALIGN, FD_PUBKEY_FOOTPRINT*prunes_len );
     for( ulong i=0; i < prunes_len; i++ ) {
-      err = fd_pubkey_decode_preflight( ctx );
+      err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
   self->signature_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_signature_decode_preflight( ctx );
+  err = fd_signature_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->destination_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->wallclock_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -24336,25 +28102,37 @@ int fd_gossip_prune_sign_data_decode( fd_gossip_prune_sign_data_t * self, fd_bin
   fd_gossip_prune_sign_data_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_gossip_prune_sign_data_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_gossip_prune_sign_data_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   ulong prunes_len;
   err = fd_bincode_uint64_decode( &prunes_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( prunes_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_PUBKEY_ALIGN, FD_PUBKEY_FOOTPRINT*prunes_len );
     for( ulong i=0; i < prunes_len; i++ ) {
-      err = fd_pubkey_decode_preflight( ctx );
+      err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_gossip_prune_sign_data_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_gossip_prune_sign_data_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_gossip_prune_sign_data_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_gossip_prune_sign_data_t);
+  int err = fd_gossip_prune_sign_data_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_gossip_prune_sign_data_decode_unsafe( fd_gossip_prune_sign_data_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->pubkey, ctx );
   fd_bincode_uint64_decode_unsafe( &self->prunes_len, ctx );
@@ -24369,6 +28147,15 @@ void fd_gossip_prune_sign_data_decode_unsafe( fd_gossip_prune_sign_data_t * self
   fd_pubkey_decode_unsafe( &self->destination, ctx );
   fd_bincode_uint64_decode_unsafe( &self->wallclock, ctx );
 }
+fd_gossip_prune_sign_data_t * fd_gossip_prune_sign_data_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_gossip_prune_sign_data_t * self = (fd_gossip_prune_sign_data_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_gossip_prune_sign_data_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_gossip_prune_sign_data_new( self );
+  fd_gossip_prune_sign_data_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_gossip_prune_sign_data_encode( fd_gossip_prune_sign_data_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->pubkey, ctx );
@@ -24389,22 +28176,24 @@ int fd_gossip_prune_sign_data_encode( fd_gossip_prune_sign_data_t const * self,
 }
 int fd_gossip_prune_sign_data_decode_offsets( fd_gossip_prune_sign_data_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->pubkey_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->prunes_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong prunes_len;
   err = fd_bincode_uint64_decode( &prunes_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( prunes_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_PUBKEY_ALIGN, FD_PUBKEY_FOOTPRINT*prunes_len );
     for( ulong i=0; i < prunes_len; i++ ) {
-      err = fd_pubkey_decode_preflight( ctx );
+      err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
   self->destination_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->wallclock_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -24467,21 +28256,33 @@ int fd_gossip_prune_sign_data_with_prefix_decode( fd_gossip_prune_sign_data_with
   fd_gossip_prune_sign_data_with_prefix_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_gossip_prune_sign_data_with_prefix_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_gossip_prune_sign_data_with_prefix_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   ulong prefix_len;
   err = fd_bincode_uint64_decode( &prefix_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( prefix_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, prefix_len );
     err = fd_bincode_bytes_decode_preflight( prefix_len, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     err = !fd_utf8_verify( (char const *) ctx->data - prefix_len, prefix_len );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   }
-  err = fd_gossip_prune_sign_data_decode_preflight( ctx );
+  err = fd_gossip_prune_sign_data_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_gossip_prune_sign_data_with_prefix_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_gossip_prune_sign_data_with_prefix_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_gossip_prune_sign_data_with_prefix_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_gossip_prune_sign_data_with_prefix_t);
+  int err = fd_gossip_prune_sign_data_with_prefix_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_gossip_prune_sign_data_with_prefix_decode_unsafe( fd_gossip_prune_sign_data_with_prefix_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->prefix_len, ctx );
   if( self->prefix_len ) {
@@ -24491,6 +28292,15 @@ void fd_gossip_prune_sign_data_with_prefix_decode_unsafe( fd_gossip_prune_sign_d
     self->prefix = NULL;
   fd_gossip_prune_sign_data_decode_unsafe( &self->data, ctx );
 }
+fd_gossip_prune_sign_data_with_prefix_t * fd_gossip_prune_sign_data_with_prefix_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_gossip_prune_sign_data_with_prefix_t * self = (fd_gossip_prune_sign_data_with_prefix_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_gossip_prune_sign_data_with_prefix_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_gossip_prune_sign_data_with_prefix_new( self );
+  fd_gossip_prune_sign_data_with_prefix_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_gossip_prune_sign_data_with_prefix_encode( fd_gossip_prune_sign_data_with_prefix_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->prefix_len, ctx );
@@ -24505,19 +28315,21 @@ int fd_gossip_prune_sign_data_with_prefix_encode( fd_gossip_prune_sign_data_with
 }
 int fd_gossip_prune_sign_data_with_prefix_decode_offsets( fd_gossip_prune_sign_data_with_prefix_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->prefix_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong prefix_len;
   err = fd_bincode_uint64_decode( &prefix_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( prefix_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, prefix_len );
     err = fd_bincode_bytes_decode_preflight( prefix_len, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     err = !fd_utf8_verify( (char const *) ctx->data - prefix_len, prefix_len );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   }
   self->data_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_gossip_prune_sign_data_decode_preflight( ctx );
+  err = fd_gossip_prune_sign_data_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -24563,18 +28375,38 @@ int fd_gossip_socket_addr_old_decode( fd_gossip_socket_addr_old_t * self, fd_bin
   fd_gossip_socket_addr_old_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_gossip_socket_addr_old_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_gossip_socket_addr_old_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_gossip_ip_addr_decode_preflight( ctx );
+  err = fd_gossip_ip_addr_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint16_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_gossip_socket_addr_old_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_gossip_socket_addr_old_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_gossip_socket_addr_old_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_gossip_socket_addr_old_t);
+  int err = fd_gossip_socket_addr_old_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_gossip_socket_addr_old_decode_unsafe( fd_gossip_socket_addr_old_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_gossip_ip_addr_decode_unsafe( &self->addr, ctx );
   fd_bincode_uint16_decode_unsafe( &self->port, ctx );
 }
+fd_gossip_socket_addr_old_t * fd_gossip_socket_addr_old_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_gossip_socket_addr_old_t * self = (fd_gossip_socket_addr_old_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_gossip_socket_addr_old_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_gossip_socket_addr_old_new( self );
+  fd_gossip_socket_addr_old_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_gossip_socket_addr_old_encode( fd_gossip_socket_addr_old_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_gossip_ip_addr_encode( &self->addr, ctx );
@@ -24585,9 +28417,10 @@ int fd_gossip_socket_addr_old_encode( fd_gossip_socket_addr_old_t const * self,
 }
 int fd_gossip_socket_addr_old_decode_offsets( fd_gossip_socket_addr_old_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->addr_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_gossip_ip_addr_decode_preflight( ctx );
+  err = fd_gossip_ip_addr_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->port_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint16_decode_preflight( ctx );
@@ -24629,18 +28462,38 @@ int fd_gossip_socket_addr_ip4_decode( fd_gossip_socket_addr_ip4_t * self, fd_bin
   fd_gossip_socket_addr_ip4_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_gossip_socket_addr_ip4_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_gossip_socket_addr_ip4_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_gossip_ip4_addr_decode_preflight( ctx );
+  err = fd_gossip_ip4_addr_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint16_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_gossip_socket_addr_ip4_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_gossip_socket_addr_ip4_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_gossip_socket_addr_ip4_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_gossip_socket_addr_ip4_t);
+  int err = fd_gossip_socket_addr_ip4_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_gossip_socket_addr_ip4_decode_unsafe( fd_gossip_socket_addr_ip4_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_gossip_ip4_addr_decode_unsafe( &self->addr, ctx );
   fd_bincode_uint16_decode_unsafe( &self->port, ctx );
 }
+fd_gossip_socket_addr_ip4_t * fd_gossip_socket_addr_ip4_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_gossip_socket_addr_ip4_t * self = (fd_gossip_socket_addr_ip4_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_gossip_socket_addr_ip4_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_gossip_socket_addr_ip4_new( self );
+  fd_gossip_socket_addr_ip4_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_gossip_socket_addr_ip4_encode( fd_gossip_socket_addr_ip4_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_gossip_ip4_addr_encode( &self->addr, ctx );
@@ -24651,9 +28504,10 @@ int fd_gossip_socket_addr_ip4_encode( fd_gossip_socket_addr_ip4_t const * self,
 }
 int fd_gossip_socket_addr_ip4_decode_offsets( fd_gossip_socket_addr_ip4_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->addr_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_gossip_ip4_addr_decode_preflight( ctx );
+  err = fd_gossip_ip4_addr_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->port_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint16_decode_preflight( ctx );
@@ -24695,9 +28549,9 @@ int fd_gossip_socket_addr_ip6_decode( fd_gossip_socket_addr_ip6_t * self, fd_bin
   fd_gossip_socket_addr_ip6_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_gossip_socket_addr_ip6_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_gossip_socket_addr_ip6_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_gossip_ip6_addr_decode_preflight( ctx );
+  err = fd_gossip_ip6_addr_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint16_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -24707,12 +28561,32 @@ int fd_gossip_socket_addr_ip6_decode_preflight( fd_bincode_decode_ctx_t * ctx )
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_gossip_socket_addr_ip6_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_gossip_socket_addr_ip6_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_gossip_socket_addr_ip6_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_gossip_socket_addr_ip6_t);
+  int err = fd_gossip_socket_addr_ip6_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_gossip_socket_addr_ip6_decode_unsafe( fd_gossip_socket_addr_ip6_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_gossip_ip6_addr_decode_unsafe( &self->addr, ctx );
   fd_bincode_uint16_decode_unsafe( &self->port, ctx );
   fd_bincode_uint32_decode_unsafe( &self->flowinfo, ctx );
   fd_bincode_uint32_decode_unsafe( &self->scope_id, ctx );
 }
+fd_gossip_socket_addr_ip6_t * fd_gossip_socket_addr_ip6_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_gossip_socket_addr_ip6_t * self = (fd_gossip_socket_addr_ip6_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_gossip_socket_addr_ip6_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_gossip_socket_addr_ip6_new( self );
+  fd_gossip_socket_addr_ip6_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_gossip_socket_addr_ip6_encode( fd_gossip_socket_addr_ip6_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_gossip_ip6_addr_encode( &self->addr, ctx );
@@ -24727,9 +28601,10 @@ int fd_gossip_socket_addr_ip6_encode( fd_gossip_socket_addr_ip6_t const * self,
 }
 int fd_gossip_socket_addr_ip6_decode_offsets( fd_gossip_socket_addr_ip6_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->addr_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_gossip_ip6_addr_decode_preflight( ctx );
+  err = fd_gossip_ip6_addr_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->port_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint16_decode_preflight( ctx );
@@ -24777,16 +28652,16 @@ FD_FN_PURE uchar fd_gossip_socket_addr_is_ip6(fd_gossip_socket_addr_t const * se
   return self->discriminant == 1;
 }
 void fd_gossip_socket_addr_inner_new( fd_gossip_socket_addr_inner_t * self, uint discriminant );
-int fd_gossip_socket_addr_inner_decode_preflight( uint discriminant, fd_bincode_decode_ctx_t * ctx ) {
+int fd_gossip_socket_addr_inner_decode_footprint( uint discriminant, fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   switch (discriminant) {
   case 0: {
-    err = fd_gossip_socket_addr_ip4_decode_preflight( ctx );
+    err = fd_gossip_socket_addr_ip4_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 1: {
-    err = fd_gossip_socket_addr_ip6_decode_preflight( ctx );
+    err = fd_gossip_socket_addr_ip6_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
@@ -24816,16 +28691,36 @@ int fd_gossip_socket_addr_decode( fd_gossip_socket_addr_t * self, fd_bincode_dec
   fd_gossip_socket_addr_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_gossip_socket_addr_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_gossip_socket_addr_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   uint discriminant = 0;
   int err = fd_bincode_uint32_decode( &discriminant, ctx );
   if( FD_UNLIKELY( err ) ) return err;
-  return fd_gossip_socket_addr_inner_decode_preflight( discriminant, ctx );
+  return fd_gossip_socket_addr_inner_decode_footprint( discriminant, ctx, total_sz );
+}
+int fd_gossip_socket_addr_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_gossip_socket_addr_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_gossip_socket_addr_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_gossip_socket_addr_t);
+  int err = fd_gossip_socket_addr_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
 }
 void fd_gossip_socket_addr_decode_unsafe( fd_gossip_socket_addr_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint32_decode_unsafe( &self->discriminant, ctx );
   fd_gossip_socket_addr_inner_decode_unsafe( &self->inner, self->discriminant, ctx );
 }
+fd_gossip_socket_addr_t * fd_gossip_socket_addr_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_gossip_socket_addr_t * self = (fd_gossip_socket_addr_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_gossip_socket_addr_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_gossip_socket_addr_new( self );
+  fd_gossip_socket_addr_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 void fd_gossip_socket_addr_inner_new( fd_gossip_socket_addr_inner_t * self, uint discriminant ) {
   switch( discriminant ) {
   case 0: {
@@ -24932,29 +28827,29 @@ int fd_gossip_contact_info_v1_decode( fd_gossip_contact_info_v1_t * self, fd_bin
   fd_gossip_contact_info_v1_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_gossip_contact_info_v1_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_gossip_contact_info_v1_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_gossip_socket_addr_decode_preflight( ctx );
+  err = fd_gossip_socket_addr_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_gossip_socket_addr_decode_preflight( ctx );
+  err = fd_gossip_socket_addr_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_gossip_socket_addr_decode_preflight( ctx );
+  err = fd_gossip_socket_addr_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_gossip_socket_addr_decode_preflight( ctx );
+  err = fd_gossip_socket_addr_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_gossip_socket_addr_decode_preflight( ctx );
+  err = fd_gossip_socket_addr_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_gossip_socket_addr_decode_preflight( ctx );
+  err = fd_gossip_socket_addr_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_gossip_socket_addr_decode_preflight( ctx );
+  err = fd_gossip_socket_addr_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_gossip_socket_addr_decode_preflight( ctx );
+  err = fd_gossip_socket_addr_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_gossip_socket_addr_decode_preflight( ctx );
+  err = fd_gossip_socket_addr_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_gossip_socket_addr_decode_preflight( ctx );
+  err = fd_gossip_socket_addr_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -24962,6 +28857,17 @@ int fd_gossip_contact_info_v1_decode_preflight( fd_bincode_decode_ctx_t * ctx )
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_gossip_contact_info_v1_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_gossip_contact_info_v1_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_gossip_contact_info_v1_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_gossip_contact_info_v1_t);
+  int err = fd_gossip_contact_info_v1_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_gossip_contact_info_v1_decode_unsafe( fd_gossip_contact_info_v1_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->id, ctx );
   fd_gossip_socket_addr_decode_unsafe( &self->gossip, ctx );
@@ -24977,6 +28883,15 @@ void fd_gossip_contact_info_v1_decode_unsafe( fd_gossip_contact_info_v1_t * self
   fd_bincode_uint64_decode_unsafe( &self->wallclock, ctx );
   fd_bincode_uint16_decode_unsafe( &self->shred_version, ctx );
 }
+fd_gossip_contact_info_v1_t * fd_gossip_contact_info_v1_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_gossip_contact_info_v1_t * self = (fd_gossip_contact_info_v1_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_gossip_contact_info_v1_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_gossip_contact_info_v1_new( self );
+  fd_gossip_contact_info_v1_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_gossip_contact_info_v1_encode( fd_gossip_contact_info_v1_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->id, ctx );
@@ -25009,39 +28924,40 @@ int fd_gossip_contact_info_v1_encode( fd_gossip_contact_info_v1_t const * self,
 }
 int fd_gossip_contact_info_v1_decode_offsets( fd_gossip_contact_info_v1_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->id_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->gossip_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_gossip_socket_addr_decode_preflight( ctx );
+  err = fd_gossip_socket_addr_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->tvu_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_gossip_socket_addr_decode_preflight( ctx );
+  err = fd_gossip_socket_addr_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->tvu_fwd_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_gossip_socket_addr_decode_preflight( ctx );
+  err = fd_gossip_socket_addr_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->repair_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_gossip_socket_addr_decode_preflight( ctx );
+  err = fd_gossip_socket_addr_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->tpu_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_gossip_socket_addr_decode_preflight( ctx );
+  err = fd_gossip_socket_addr_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->tpu_fwd_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_gossip_socket_addr_decode_preflight( ctx );
+  err = fd_gossip_socket_addr_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->tpu_vote_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_gossip_socket_addr_decode_preflight( ctx );
+  err = fd_gossip_socket_addr_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->rpc_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_gossip_socket_addr_decode_preflight( ctx );
+  err = fd_gossip_socket_addr_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->rpc_pubsub_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_gossip_socket_addr_decode_preflight( ctx );
+  err = fd_gossip_socket_addr_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->serve_repair_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_gossip_socket_addr_decode_preflight( ctx );
+  err = fd_gossip_socket_addr_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->wallclock_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -25128,24 +29044,44 @@ int fd_gossip_vote_decode( fd_gossip_vote_t * self, fd_bincode_decode_ctx_t * ct
   fd_gossip_vote_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_gossip_vote_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_gossip_vote_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   err = fd_bincode_uint8_decode_preflight( ctx );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_flamenco_txn_decode_preflight( ctx );
+  err = fd_flamenco_txn_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_gossip_vote_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_gossip_vote_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_gossip_vote_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_gossip_vote_t);
+  int err = fd_gossip_vote_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_gossip_vote_decode_unsafe( fd_gossip_vote_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint8_decode_unsafe( &self->index, ctx );
   fd_pubkey_decode_unsafe( &self->from, ctx );
   fd_flamenco_txn_decode_unsafe( &self->txn, ctx );
   fd_bincode_uint64_decode_unsafe( &self->wallclock, ctx );
 }
+fd_gossip_vote_t * fd_gossip_vote_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_gossip_vote_t * self = (fd_gossip_vote_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_gossip_vote_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_gossip_vote_new( self );
+  fd_gossip_vote_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_gossip_vote_encode( fd_gossip_vote_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint8_encode( (uchar)(self->index), ctx );
@@ -25160,15 +29096,16 @@ int fd_gossip_vote_encode( fd_gossip_vote_t const * self, fd_bincode_encode_ctx_
 }
 int fd_gossip_vote_decode_offsets( fd_gossip_vote_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->index_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint8_decode_preflight( ctx );
   if( FD_UNLIKELY( err ) ) return err;
   self->from_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->txn_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_flamenco_txn_decode_preflight( ctx );
+  err = fd_flamenco_txn_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->wallclock_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -25216,11 +29153,11 @@ int fd_gossip_lowest_slot_decode( fd_gossip_lowest_slot_t * self, fd_bincode_dec
   fd_gossip_lowest_slot_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_gossip_lowest_slot_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_gossip_lowest_slot_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   err = fd_bincode_uint8_decode_preflight( ctx );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -25230,6 +29167,7 @@ int fd_gossip_lowest_slot_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   err = fd_bincode_uint64_decode( &slots_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( slots_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, sizeof(ulong)*slots_len );
     for( ulong i=0; i < slots_len; i++ ) {
       err = fd_bincode_uint64_decode_preflight( ctx );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -25241,6 +29179,17 @@ int fd_gossip_lowest_slot_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_gossip_lowest_slot_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_gossip_lowest_slot_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_gossip_lowest_slot_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_gossip_lowest_slot_t);
+  int err = fd_gossip_lowest_slot_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_gossip_lowest_slot_decode_unsafe( fd_gossip_lowest_slot_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint8_decode_unsafe( &self->u8, ctx );
   fd_pubkey_decode_unsafe( &self->from, ctx );
@@ -25257,6 +29206,15 @@ void fd_gossip_lowest_slot_decode_unsafe( fd_gossip_lowest_slot_t * self, fd_bin
   fd_bincode_uint64_decode_unsafe( &self->i_dont_know, ctx );
   fd_bincode_uint64_decode_unsafe( &self->wallclock, ctx );
 }
+fd_gossip_lowest_slot_t * fd_gossip_lowest_slot_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_gossip_lowest_slot_t * self = (fd_gossip_lowest_slot_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_gossip_lowest_slot_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_gossip_lowest_slot_new( self );
+  fd_gossip_lowest_slot_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_gossip_lowest_slot_encode( fd_gossip_lowest_slot_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint8_encode( (uchar)(self->u8), ctx );
@@ -25282,12 +29240,13 @@ int fd_gossip_lowest_slot_encode( fd_gossip_lowest_slot_t const * self, fd_binco
 }
 int fd_gossip_lowest_slot_decode_offsets( fd_gossip_lowest_slot_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->u8_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint8_decode_preflight( ctx );
   if( FD_UNLIKELY( err ) ) return err;
   self->from_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->root_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -25300,6 +29259,7 @@ int fd_gossip_lowest_slot_decode_offsets( fd_gossip_lowest_slot_off_t * self, fd
   err = fd_bincode_uint64_decode( &slots_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( slots_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, sizeof(ulong)*slots_len );
     for( ulong i=0; i < slots_len; i++ ) {
       err = fd_bincode_uint64_decode_preflight( ctx );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -25370,16 +29330,17 @@ int fd_gossip_slot_hashes_decode( fd_gossip_slot_hashes_t * self, fd_bincode_dec
   fd_gossip_slot_hashes_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_gossip_slot_hashes_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_gossip_slot_hashes_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   ulong hashes_len;
   err = fd_bincode_uint64_decode( &hashes_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( hashes_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_SLOT_HASH_ALIGN, FD_SLOT_HASH_FOOTPRINT*hashes_len );
     for( ulong i=0; i < hashes_len; i++ ) {
-      err = fd_slot_hash_decode_preflight( ctx );
+      err = fd_slot_hash_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -25387,6 +29348,17 @@ int fd_gossip_slot_hashes_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_gossip_slot_hashes_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_gossip_slot_hashes_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_gossip_slot_hashes_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_gossip_slot_hashes_t);
+  int err = fd_gossip_slot_hashes_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_gossip_slot_hashes_decode_unsafe( fd_gossip_slot_hashes_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->from, ctx );
   fd_bincode_uint64_decode_unsafe( &self->hashes_len, ctx );
@@ -25400,6 +29372,15 @@ void fd_gossip_slot_hashes_decode_unsafe( fd_gossip_slot_hashes_t * self, fd_bin
     self->hashes = NULL;
   fd_bincode_uint64_decode_unsafe( &self->wallclock, ctx );
 }
+fd_gossip_slot_hashes_t * fd_gossip_slot_hashes_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_gossip_slot_hashes_t * self = (fd_gossip_slot_hashes_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_gossip_slot_hashes_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_gossip_slot_hashes_new( self );
+  fd_gossip_slot_hashes_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_gossip_slot_hashes_encode( fd_gossip_slot_hashes_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->from, ctx );
@@ -25418,17 +29399,19 @@ int fd_gossip_slot_hashes_encode( fd_gossip_slot_hashes_t const * self, fd_binco
 }
 int fd_gossip_slot_hashes_decode_offsets( fd_gossip_slot_hashes_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->from_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->hashes_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong hashes_len;
   err = fd_bincode_uint64_decode( &hashes_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( hashes_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_SLOT_HASH_ALIGN, FD_SLOT_HASH_FOOTPRINT*hashes_len );
     for( ulong i=0; i < hashes_len; i++ ) {
-      err = fd_slot_hash_decode_preflight( ctx );
+      err = fd_slot_hash_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -25489,21 +29472,41 @@ int fd_gossip_slots_decode( fd_gossip_slots_t * self, fd_bincode_decode_ctx_t *
   fd_gossip_slots_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_gossip_slots_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_gossip_slots_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_gossip_bitvec_u8_decode_preflight( ctx );
+  err = fd_gossip_bitvec_u8_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_gossip_slots_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_gossip_slots_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_gossip_slots_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_gossip_slots_t);
+  int err = fd_gossip_slots_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_gossip_slots_decode_unsafe( fd_gossip_slots_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->first_slot, ctx );
   fd_bincode_uint64_decode_unsafe( &self->num, ctx );
   fd_gossip_bitvec_u8_decode_unsafe( &self->slots, ctx );
 }
+fd_gossip_slots_t * fd_gossip_slots_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_gossip_slots_t * self = (fd_gossip_slots_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_gossip_slots_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_gossip_slots_new( self );
+  fd_gossip_slots_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_gossip_slots_encode( fd_gossip_slots_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->first_slot, ctx );
@@ -25516,6 +29519,7 @@ int fd_gossip_slots_encode( fd_gossip_slots_t const * self, fd_bincode_encode_ct
 }
 int fd_gossip_slots_decode_offsets( fd_gossip_slots_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->first_slot_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -25524,7 +29528,7 @@ int fd_gossip_slots_decode_offsets( fd_gossip_slots_off_t * self, fd_bincode_dec
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->slots_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_gossip_bitvec_u8_decode_preflight( ctx );
+  err = fd_gossip_bitvec_u8_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -25565,7 +29569,7 @@ int fd_gossip_flate2_slots_decode( fd_gossip_flate2_slots_t * self, fd_bincode_d
   fd_gossip_flate2_slots_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_gossip_flate2_slots_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_gossip_flate2_slots_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -25575,11 +29579,23 @@ int fd_gossip_flate2_slots_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   err = fd_bincode_uint64_decode( &compressed_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( compressed_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, compressed_len );
     err = fd_bincode_bytes_decode_preflight( compressed_len, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_gossip_flate2_slots_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_gossip_flate2_slots_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_gossip_flate2_slots_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_gossip_flate2_slots_t);
+  int err = fd_gossip_flate2_slots_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_gossip_flate2_slots_decode_unsafe( fd_gossip_flate2_slots_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->first_slot, ctx );
   fd_bincode_uint64_decode_unsafe( &self->num, ctx );
@@ -25590,6 +29606,15 @@ void fd_gossip_flate2_slots_decode_unsafe( fd_gossip_flate2_slots_t * self, fd_b
   } else
     self->compressed = NULL;
 }
+fd_gossip_flate2_slots_t * fd_gossip_flate2_slots_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_gossip_flate2_slots_t * self = (fd_gossip_flate2_slots_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_gossip_flate2_slots_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_gossip_flate2_slots_new( self );
+  fd_gossip_flate2_slots_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_gossip_flate2_slots_encode( fd_gossip_flate2_slots_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->first_slot, ctx );
@@ -25606,6 +29631,7 @@ int fd_gossip_flate2_slots_encode( fd_gossip_flate2_slots_t const * self, fd_bin
 }
 int fd_gossip_flate2_slots_decode_offsets( fd_gossip_flate2_slots_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->first_slot_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -25618,6 +29644,7 @@ int fd_gossip_flate2_slots_decode_offsets( fd_gossip_flate2_slots_off_t * self,
   err = fd_bincode_uint64_decode( &compressed_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( compressed_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, compressed_len );
     err = fd_bincode_bytes_decode_preflight( compressed_len, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   }
@@ -25661,16 +29688,16 @@ FD_FN_PURE uchar fd_gossip_slots_enum_is_uncompressed(fd_gossip_slots_enum_t con
   return self->discriminant == 1;
 }
 void fd_gossip_slots_enum_inner_new( fd_gossip_slots_enum_inner_t * self, uint discriminant );
-int fd_gossip_slots_enum_inner_decode_preflight( uint discriminant, fd_bincode_decode_ctx_t * ctx ) {
+int fd_gossip_slots_enum_inner_decode_footprint( uint discriminant, fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   switch (discriminant) {
   case 0: {
-    err = fd_gossip_flate2_slots_decode_preflight( ctx );
+    err = fd_gossip_flate2_slots_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 1: {
-    err = fd_gossip_slots_decode_preflight( ctx );
+    err = fd_gossip_slots_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
@@ -25700,16 +29727,36 @@ int fd_gossip_slots_enum_decode( fd_gossip_slots_enum_t * self, fd_bincode_decod
   fd_gossip_slots_enum_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_gossip_slots_enum_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_gossip_slots_enum_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   uint discriminant = 0;
   int err = fd_bincode_uint32_decode( &discriminant, ctx );
   if( FD_UNLIKELY( err ) ) return err;
-  return fd_gossip_slots_enum_inner_decode_preflight( discriminant, ctx );
+  return fd_gossip_slots_enum_inner_decode_footprint( discriminant, ctx, total_sz );
+}
+int fd_gossip_slots_enum_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_gossip_slots_enum_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_gossip_slots_enum_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_gossip_slots_enum_t);
+  int err = fd_gossip_slots_enum_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
 }
 void fd_gossip_slots_enum_decode_unsafe( fd_gossip_slots_enum_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint32_decode_unsafe( &self->discriminant, ctx );
   fd_gossip_slots_enum_inner_decode_unsafe( &self->inner, self->discriminant, ctx );
 }
+fd_gossip_slots_enum_t * fd_gossip_slots_enum_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_gossip_slots_enum_t * self = (fd_gossip_slots_enum_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_gossip_slots_enum_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_gossip_slots_enum_new( self );
+  fd_gossip_slots_enum_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 void fd_gossip_slots_enum_inner_new( fd_gossip_slots_enum_inner_t * self, uint discriminant ) {
   switch( discriminant ) {
   case 0: {
@@ -25816,18 +29863,19 @@ int fd_gossip_epoch_slots_decode( fd_gossip_epoch_slots_t * self, fd_bincode_dec
   fd_gossip_epoch_slots_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_gossip_epoch_slots_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_gossip_epoch_slots_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   err = fd_bincode_uint8_decode_preflight( ctx );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   ulong slots_len;
   err = fd_bincode_uint64_decode( &slots_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( slots_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_GOSSIP_SLOTS_ENUM_ALIGN, FD_GOSSIP_SLOTS_ENUM_FOOTPRINT*slots_len );
     for( ulong i=0; i < slots_len; i++ ) {
-      err = fd_gossip_slots_enum_decode_preflight( ctx );
+      err = fd_gossip_slots_enum_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -25835,6 +29883,17 @@ int fd_gossip_epoch_slots_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_gossip_epoch_slots_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_gossip_epoch_slots_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_gossip_epoch_slots_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_gossip_epoch_slots_t);
+  int err = fd_gossip_epoch_slots_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_gossip_epoch_slots_decode_unsafe( fd_gossip_epoch_slots_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint8_decode_unsafe( &self->u8, ctx );
   fd_pubkey_decode_unsafe( &self->from, ctx );
@@ -25849,6 +29908,15 @@ void fd_gossip_epoch_slots_decode_unsafe( fd_gossip_epoch_slots_t * self, fd_bin
     self->slots = NULL;
   fd_bincode_uint64_decode_unsafe( &self->wallclock, ctx );
 }
+fd_gossip_epoch_slots_t * fd_gossip_epoch_slots_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_gossip_epoch_slots_t * self = (fd_gossip_epoch_slots_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_gossip_epoch_slots_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_gossip_epoch_slots_new( self );
+  fd_gossip_epoch_slots_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_gossip_epoch_slots_encode( fd_gossip_epoch_slots_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint8_encode( (uchar)(self->u8), ctx );
@@ -25869,20 +29937,22 @@ int fd_gossip_epoch_slots_encode( fd_gossip_epoch_slots_t const * self, fd_binco
 }
 int fd_gossip_epoch_slots_decode_offsets( fd_gossip_epoch_slots_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->u8_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint8_decode_preflight( ctx );
   if( FD_UNLIKELY( err ) ) return err;
   self->from_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->slots_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong slots_len;
   err = fd_bincode_uint64_decode( &slots_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( slots_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_GOSSIP_SLOTS_ENUM_ALIGN, FD_GOSSIP_SLOTS_ENUM_FOOTPRINT*slots_len );
     for( ulong i=0; i < slots_len; i++ ) {
-      err = fd_gossip_slots_enum_decode_preflight( ctx );
+      err = fd_gossip_slots_enum_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -25945,9 +30015,9 @@ int fd_gossip_version_v1_decode( fd_gossip_version_v1_t * self, fd_bincode_decod
   fd_gossip_version_v1_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_gossip_version_v1_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_gossip_version_v1_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -25968,6 +30038,17 @@ int fd_gossip_version_v1_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_gossip_version_v1_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_gossip_version_v1_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_gossip_version_v1_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_gossip_version_v1_t);
+  int err = fd_gossip_version_v1_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_gossip_version_v1_decode_unsafe( fd_gossip_version_v1_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->from, ctx );
   fd_bincode_uint64_decode_unsafe( &self->wallclock, ctx );
@@ -25983,6 +30064,15 @@ void fd_gossip_version_v1_decode_unsafe( fd_gossip_version_v1_t * self, fd_binco
     }
   }
 }
+fd_gossip_version_v1_t * fd_gossip_version_v1_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_gossip_version_v1_t * self = (fd_gossip_version_v1_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_gossip_version_v1_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_gossip_version_v1_new( self );
+  fd_gossip_version_v1_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_gossip_version_v1_encode( fd_gossip_version_v1_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->from, ctx );
@@ -26005,9 +30095,10 @@ int fd_gossip_version_v1_encode( fd_gossip_version_v1_t const * self, fd_bincode
 }
 int fd_gossip_version_v1_decode_offsets( fd_gossip_version_v1_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->from_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->wallclock_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -26086,9 +30177,9 @@ int fd_gossip_version_v2_decode( fd_gossip_version_v2_t * self, fd_bincode_decod
   fd_gossip_version_v2_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_gossip_version_v2_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_gossip_version_v2_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -26111,6 +30202,17 @@ int fd_gossip_version_v2_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_gossip_version_v2_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_gossip_version_v2_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_gossip_version_v2_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_gossip_version_v2_t);
+  int err = fd_gossip_version_v2_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_gossip_version_v2_decode_unsafe( fd_gossip_version_v2_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->from, ctx );
   fd_bincode_uint64_decode_unsafe( &self->wallclock, ctx );
@@ -26127,6 +30229,15 @@ void fd_gossip_version_v2_decode_unsafe( fd_gossip_version_v2_t * self, fd_binco
   }
   fd_bincode_uint32_decode_unsafe( &self->feature_set, ctx );
 }
+fd_gossip_version_v2_t * fd_gossip_version_v2_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_gossip_version_v2_t * self = (fd_gossip_version_v2_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_gossip_version_v2_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_gossip_version_v2_new( self );
+  fd_gossip_version_v2_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_gossip_version_v2_encode( fd_gossip_version_v2_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->from, ctx );
@@ -26151,9 +30262,10 @@ int fd_gossip_version_v2_encode( fd_gossip_version_v2_t const * self, fd_bincode
 }
 int fd_gossip_version_v2_decode_offsets( fd_gossip_version_v2_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->from_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->wallclock_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -26237,7 +30349,7 @@ int fd_gossip_version_v3_decode( fd_gossip_version_v3_t * self, fd_bincode_decod
   fd_gossip_version_v3_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_gossip_version_v3_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_gossip_version_v3_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   do { ushort _tmp; err = fd_bincode_compact_u16_decode( &_tmp, ctx ); } while(0);
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -26253,6 +30365,17 @@ int fd_gossip_version_v3_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_gossip_version_v3_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_gossip_version_v3_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_gossip_version_v3_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_gossip_version_v3_t);
+  int err = fd_gossip_version_v3_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_gossip_version_v3_decode_unsafe( fd_gossip_version_v3_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_compact_u16_decode_unsafe( &self->major, ctx );
   fd_bincode_compact_u16_decode_unsafe( &self->minor, ctx );
@@ -26261,6 +30384,15 @@ void fd_gossip_version_v3_decode_unsafe( fd_gossip_version_v3_t * self, fd_binco
   fd_bincode_uint32_decode_unsafe( &self->feature_set, ctx );
   fd_bincode_compact_u16_decode_unsafe( &self->client, ctx );
 }
+fd_gossip_version_v3_t * fd_gossip_version_v3_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_gossip_version_v3_t * self = (fd_gossip_version_v3_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_gossip_version_v3_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_gossip_version_v3_new( self );
+  fd_gossip_version_v3_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_gossip_version_v3_encode( fd_gossip_version_v3_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_compact_u16_encode( &self->major, ctx );
@@ -26279,6 +30411,7 @@ int fd_gossip_version_v3_encode( fd_gossip_version_v3_t const * self, fd_bincode
 }
 int fd_gossip_version_v3_decode_offsets( fd_gossip_version_v3_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->major_off = (uint)( (ulong)ctx->data - (ulong)data );
   do { ushort _tmp; err = fd_bincode_compact_u16_decode( &_tmp, ctx ); } while(0);
@@ -26341,15 +30474,35 @@ int fd_gossip_node_instance_decode( fd_gossip_node_instance_t * self, fd_bincode
   fd_gossip_node_instance_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_gossip_node_instance_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_gossip_node_instance_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 56, ctx );
 }
+int fd_gossip_node_instance_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_gossip_node_instance_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_gossip_node_instance_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_gossip_node_instance_t);
+  int err = fd_gossip_node_instance_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_gossip_node_instance_decode_unsafe( fd_gossip_node_instance_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->from, ctx );
   fd_bincode_uint64_decode_unsafe( &self->wallclock, ctx );
   fd_bincode_uint64_decode_unsafe( (ulong *) &self->timestamp, ctx );
   fd_bincode_uint64_decode_unsafe( &self->token, ctx );
 }
+fd_gossip_node_instance_t * fd_gossip_node_instance_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_gossip_node_instance_t * self = (fd_gossip_node_instance_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_gossip_node_instance_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_gossip_node_instance_new( self );
+  fd_gossip_node_instance_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_gossip_node_instance_encode( fd_gossip_node_instance_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->from, ctx );
@@ -26364,9 +30517,10 @@ int fd_gossip_node_instance_encode( fd_gossip_node_instance_t const * self, fd_b
 }
 int fd_gossip_node_instance_decode_offsets( fd_gossip_node_instance_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->from_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->wallclock_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -26389,6 +30543,7 @@ void fd_gossip_node_instance_destroy( fd_gossip_node_instance_t * self, fd_binco
 
 ulong fd_gossip_node_instance_footprint( void ){ return FD_GOSSIP_NODE_INSTANCE_FOOTPRINT; }
 ulong fd_gossip_node_instance_align( void ){ return FD_GOSSIP_NODE_INSTANCE_ALIGN; }
+FD_STATIC_ASSERT( sizeof(fd_gossip_node_instance_t)==56UL, fd_gossip_node_instance_view );
 
 void fd_gossip_node_instance_walk( void * w, fd_gossip_node_instance_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_gossip_node_instance", level++ );
@@ -26418,11 +30573,11 @@ int fd_gossip_duplicate_shred_decode( fd_gossip_duplicate_shred_t * self, fd_bin
   fd_gossip_duplicate_shred_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_gossip_duplicate_shred_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_gossip_duplicate_shred_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   err = fd_bincode_uint16_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -26440,11 +30595,23 @@ int fd_gossip_duplicate_shred_decode_preflight( fd_bincode_decode_ctx_t * ctx )
   err = fd_bincode_uint64_decode( &chunk_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( chunk_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, chunk_len );
     err = fd_bincode_bytes_decode_preflight( chunk_len, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_gossip_duplicate_shred_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_gossip_duplicate_shred_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_gossip_duplicate_shred_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_gossip_duplicate_shred_t);
+  int err = fd_gossip_duplicate_shred_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_gossip_duplicate_shred_decode_unsafe( fd_gossip_duplicate_shred_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint16_decode_unsafe( &self->duplicate_shred_index, ctx );
   fd_pubkey_decode_unsafe( &self->from, ctx );
@@ -26461,6 +30628,15 @@ void fd_gossip_duplicate_shred_decode_unsafe( fd_gossip_duplicate_shred_t * self
   } else
     self->chunk = NULL;
 }
+fd_gossip_duplicate_shred_t * fd_gossip_duplicate_shred_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_gossip_duplicate_shred_t * self = (fd_gossip_duplicate_shred_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_gossip_duplicate_shred_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_gossip_duplicate_shred_new( self );
+  fd_gossip_duplicate_shred_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_gossip_duplicate_shred_encode( fd_gossip_duplicate_shred_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint16_encode( self->duplicate_shred_index, ctx );
@@ -26489,12 +30665,13 @@ int fd_gossip_duplicate_shred_encode( fd_gossip_duplicate_shred_t const * self,
 }
 int fd_gossip_duplicate_shred_decode_offsets( fd_gossip_duplicate_shred_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->duplicate_shred_index_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint16_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->from_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->wallclock_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -26519,6 +30696,7 @@ int fd_gossip_duplicate_shred_decode_offsets( fd_gossip_duplicate_shred_off_t *
   err = fd_bincode_uint64_decode( &chunk_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( chunk_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, chunk_len );
     err = fd_bincode_bytes_decode_preflight( chunk_len, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   }
@@ -26580,18 +30758,19 @@ int fd_gossip_incremental_snapshot_hashes_decode( fd_gossip_incremental_snapshot
   fd_gossip_incremental_snapshot_hashes_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_gossip_incremental_snapshot_hashes_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_gossip_incremental_snapshot_hashes_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_slot_hash_decode_preflight( ctx );
+  err = fd_slot_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   ulong hashes_len;
   err = fd_bincode_uint64_decode( &hashes_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( hashes_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_SLOT_HASH_ALIGN, FD_SLOT_HASH_FOOTPRINT*hashes_len );
     for( ulong i=0; i < hashes_len; i++ ) {
-      err = fd_slot_hash_decode_preflight( ctx );
+      err = fd_slot_hash_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -26599,6 +30778,17 @@ int fd_gossip_incremental_snapshot_hashes_decode_preflight( fd_bincode_decode_ct
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_gossip_incremental_snapshot_hashes_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_gossip_incremental_snapshot_hashes_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_gossip_incremental_snapshot_hashes_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_gossip_incremental_snapshot_hashes_t);
+  int err = fd_gossip_incremental_snapshot_hashes_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_gossip_incremental_snapshot_hashes_decode_unsafe( fd_gossip_incremental_snapshot_hashes_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->from, ctx );
   fd_slot_hash_decode_unsafe( &self->base_hash, ctx );
@@ -26613,6 +30803,15 @@ void fd_gossip_incremental_snapshot_hashes_decode_unsafe( fd_gossip_incremental_
     self->hashes = NULL;
   fd_bincode_uint64_decode_unsafe( &self->wallclock, ctx );
 }
+fd_gossip_incremental_snapshot_hashes_t * fd_gossip_incremental_snapshot_hashes_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_gossip_incremental_snapshot_hashes_t * self = (fd_gossip_incremental_snapshot_hashes_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_gossip_incremental_snapshot_hashes_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_gossip_incremental_snapshot_hashes_new( self );
+  fd_gossip_incremental_snapshot_hashes_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_gossip_incremental_snapshot_hashes_encode( fd_gossip_incremental_snapshot_hashes_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->from, ctx );
@@ -26633,20 +30832,22 @@ int fd_gossip_incremental_snapshot_hashes_encode( fd_gossip_incremental_snapshot
 }
 int fd_gossip_incremental_snapshot_hashes_decode_offsets( fd_gossip_incremental_snapshot_hashes_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->from_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->base_hash_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_slot_hash_decode_preflight( ctx );
+  err = fd_slot_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->hashes_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong hashes_len;
   err = fd_bincode_uint64_decode( &hashes_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( hashes_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_SLOT_HASH_ALIGN, FD_SLOT_HASH_FOOTPRINT*hashes_len );
     for( ulong i=0; i < hashes_len; i++ ) {
-      err = fd_slot_hash_decode_preflight( ctx );
+      err = fd_slot_hash_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -26711,7 +30912,7 @@ int fd_gossip_socket_entry_decode( fd_gossip_socket_entry_t * self, fd_bincode_d
   fd_gossip_socket_entry_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_gossip_socket_entry_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_gossip_socket_entry_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   err = fd_bincode_uint8_decode_preflight( ctx );
   if( FD_UNLIKELY( err ) ) return err;
@@ -26721,11 +30922,31 @@ int fd_gossip_socket_entry_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_gossip_socket_entry_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_gossip_socket_entry_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_gossip_socket_entry_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_gossip_socket_entry_t);
+  int err = fd_gossip_socket_entry_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_gossip_socket_entry_decode_unsafe( fd_gossip_socket_entry_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint8_decode_unsafe( &self->key, ctx );
   fd_bincode_uint8_decode_unsafe( &self->index, ctx );
   fd_bincode_compact_u16_decode_unsafe( &self->offset, ctx );
 }
+fd_gossip_socket_entry_t * fd_gossip_socket_entry_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_gossip_socket_entry_t * self = (fd_gossip_socket_entry_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_gossip_socket_entry_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_gossip_socket_entry_new( self );
+  fd_gossip_socket_entry_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_gossip_socket_entry_encode( fd_gossip_socket_entry_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint8_encode( (uchar)(self->key), ctx );
@@ -26738,6 +30959,7 @@ int fd_gossip_socket_entry_encode( fd_gossip_socket_entry_t const * self, fd_bin
 }
 int fd_gossip_socket_entry_decode_offsets( fd_gossip_socket_entry_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->key_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint8_decode_preflight( ctx );
@@ -26785,9 +31007,9 @@ int fd_gossip_contact_info_v2_decode( fd_gossip_contact_info_v2_t * self, fd_bin
   fd_gossip_contact_info_v2_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_gossip_contact_info_v2_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_gossip_contact_info_v2_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_varint_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -26795,14 +31017,15 @@ int fd_gossip_contact_info_v2_decode_preflight( fd_bincode_decode_ctx_t * ctx )
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   err = fd_bincode_uint16_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_gossip_version_v3_decode_preflight( ctx );
+  err = fd_gossip_version_v3_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   ushort addrs_len;
   err = fd_bincode_compact_u16_decode( &addrs_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( addrs_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_GOSSIP_IP_ADDR_ALIGN, FD_GOSSIP_IP_ADDR_FOOTPRINT*addrs_len );
     for( ulong i=0; i < addrs_len; i++ ) {
-      err = fd_gossip_ip_addr_decode_preflight( ctx );
+      err = fd_gossip_ip_addr_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -26810,8 +31033,9 @@ int fd_gossip_contact_info_v2_decode_preflight( fd_bincode_decode_ctx_t * ctx )
   err = fd_bincode_compact_u16_decode( &sockets_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( sockets_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_GOSSIP_SOCKET_ENTRY_ALIGN, FD_GOSSIP_SOCKET_ENTRY_FOOTPRINT*sockets_len );
     for( ulong i=0; i < sockets_len; i++ ) {
-      err = fd_gossip_socket_entry_decode_preflight( ctx );
+      err = fd_gossip_socket_entry_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -26819,6 +31043,7 @@ int fd_gossip_contact_info_v2_decode_preflight( fd_bincode_decode_ctx_t * ctx )
   err = fd_bincode_compact_u16_decode( &extensions_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( extensions_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, sizeof(uint)*extensions_len );
     for( ulong i=0; i < extensions_len; i++ ) {
       err = fd_bincode_uint32_decode_preflight( ctx );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -26826,6 +31051,17 @@ int fd_gossip_contact_info_v2_decode_preflight( fd_bincode_decode_ctx_t * ctx )
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_gossip_contact_info_v2_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_gossip_contact_info_v2_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_gossip_contact_info_v2_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_gossip_contact_info_v2_t);
+  int err = fd_gossip_contact_info_v2_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_gossip_contact_info_v2_decode_unsafe( fd_gossip_contact_info_v2_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->from, ctx );
   fd_bincode_varint_decode_unsafe( &self->wallclock, ctx );
@@ -26859,6 +31095,15 @@ void fd_gossip_contact_info_v2_decode_unsafe( fd_gossip_contact_info_v2_t * self
   } else
     self->extensions = NULL;
 }
+fd_gossip_contact_info_v2_t * fd_gossip_contact_info_v2_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_gossip_contact_info_v2_t * self = (fd_gossip_contact_info_v2_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_gossip_contact_info_v2_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_gossip_contact_info_v2_new( self );
+  fd_gossip_contact_info_v2_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_gossip_contact_info_v2_encode( fd_gossip_contact_info_v2_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->from, ctx );
@@ -26898,9 +31143,10 @@ int fd_gossip_contact_info_v2_encode( fd_gossip_contact_info_v2_t const * self,
 }
 int fd_gossip_contact_info_v2_decode_offsets( fd_gossip_contact_info_v2_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->from_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->wallclock_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_varint_decode_preflight( ctx );
@@ -26912,15 +31158,16 @@ int fd_gossip_contact_info_v2_decode_offsets( fd_gossip_contact_info_v2_off_t *
   err = fd_bincode_uint16_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->version_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_gossip_version_v3_decode_preflight( ctx );
+  err = fd_gossip_version_v3_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->addrs_off = (uint)( (ulong)ctx->data - (ulong)data );
   ushort addrs_len;
   err = fd_bincode_compact_u16_decode( &addrs_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( addrs_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_GOSSIP_IP_ADDR_ALIGN, FD_GOSSIP_IP_ADDR_FOOTPRINT*addrs_len );
     for( ulong i=0; i < addrs_len; i++ ) {
-      err = fd_gossip_ip_addr_decode_preflight( ctx );
+      err = fd_gossip_ip_addr_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -26929,8 +31176,9 @@ int fd_gossip_contact_info_v2_decode_offsets( fd_gossip_contact_info_v2_off_t *
   err = fd_bincode_compact_u16_decode( &sockets_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( sockets_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_GOSSIP_SOCKET_ENTRY_ALIGN, FD_GOSSIP_SOCKET_ENTRY_FOOTPRINT*sockets_len );
     for( ulong i=0; i < sockets_len; i++ ) {
-      err = fd_gossip_socket_entry_decode_preflight( ctx );
+      err = fd_gossip_socket_entry_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -26939,6 +31187,7 @@ int fd_gossip_contact_info_v2_decode_offsets( fd_gossip_contact_info_v2_off_t *
   err = fd_bincode_compact_u16_decode( &extensions_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( extensions_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, sizeof(uint)*extensions_len );
     for( ulong i=0; i < extensions_len; i++ ) {
       err = fd_bincode_uint32_decode_preflight( ctx );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -27040,15 +31289,35 @@ int fd_restart_run_length_encoding_inner_decode( fd_restart_run_length_encoding_
   fd_restart_run_length_encoding_inner_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_restart_run_length_encoding_inner_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_restart_run_length_encoding_inner_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   do { ushort _tmp; err = fd_bincode_compact_u16_decode( &_tmp, ctx ); } while(0);
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_restart_run_length_encoding_inner_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_restart_run_length_encoding_inner_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_restart_run_length_encoding_inner_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_restart_run_length_encoding_inner_t);
+  int err = fd_restart_run_length_encoding_inner_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_restart_run_length_encoding_inner_decode_unsafe( fd_restart_run_length_encoding_inner_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_compact_u16_decode_unsafe( &self->bits, ctx );
 }
+fd_restart_run_length_encoding_inner_t * fd_restart_run_length_encoding_inner_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_restart_run_length_encoding_inner_t * self = (fd_restart_run_length_encoding_inner_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_restart_run_length_encoding_inner_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_restart_run_length_encoding_inner_new( self );
+  fd_restart_run_length_encoding_inner_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_restart_run_length_encoding_inner_encode( fd_restart_run_length_encoding_inner_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_compact_u16_encode( &self->bits, ctx );
@@ -27057,6 +31326,7 @@ int fd_restart_run_length_encoding_inner_encode( fd_restart_run_length_encoding_
 }
 int fd_restart_run_length_encoding_inner_decode_offsets( fd_restart_run_length_encoding_inner_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->bits_off = (uint)( (ulong)ctx->data - (ulong)data );
   do { ushort _tmp; err = fd_bincode_compact_u16_decode( &_tmp, ctx ); } while(0);
@@ -27094,19 +31364,31 @@ int fd_restart_run_length_encoding_decode( fd_restart_run_length_encoding_t * se
   fd_restart_run_length_encoding_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_restart_run_length_encoding_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_restart_run_length_encoding_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   ulong offsets_len;
   err = fd_bincode_uint64_decode( &offsets_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( offsets_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_RESTART_RUN_LENGTH_ENCODING_INNER_ALIGN, FD_RESTART_RUN_LENGTH_ENCODING_INNER_FOOTPRINT*offsets_len );
     for( ulong i=0; i < offsets_len; i++ ) {
-      err = fd_restart_run_length_encoding_inner_decode_preflight( ctx );
+      err = fd_restart_run_length_encoding_inner_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_restart_run_length_encoding_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_restart_run_length_encoding_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_restart_run_length_encoding_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_restart_run_length_encoding_t);
+  int err = fd_restart_run_length_encoding_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_restart_run_length_encoding_decode_unsafe( fd_restart_run_length_encoding_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->offsets_len, ctx );
   if( self->offsets_len ) {
@@ -27118,6 +31400,15 @@ void fd_restart_run_length_encoding_decode_unsafe( fd_restart_run_length_encodin
   } else
     self->offsets = NULL;
 }
+fd_restart_run_length_encoding_t * fd_restart_run_length_encoding_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_restart_run_length_encoding_t * self = (fd_restart_run_length_encoding_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_restart_run_length_encoding_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_restart_run_length_encoding_new( self );
+  fd_restart_run_length_encoding_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_restart_run_length_encoding_encode( fd_restart_run_length_encoding_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->offsets_len, ctx );
@@ -27132,14 +31423,16 @@ int fd_restart_run_length_encoding_encode( fd_restart_run_length_encoding_t cons
 }
 int fd_restart_run_length_encoding_decode_offsets( fd_restart_run_length_encoding_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->offsets_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong offsets_len;
   err = fd_bincode_uint64_decode( &offsets_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( offsets_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_RESTART_RUN_LENGTH_ENCODING_INNER_ALIGN, FD_RESTART_RUN_LENGTH_ENCODING_INNER_FOOTPRINT*offsets_len );
     for( ulong i=0; i < offsets_len; i++ ) {
-      err = fd_restart_run_length_encoding_inner_decode_preflight( ctx );
+      err = fd_restart_run_length_encoding_inner_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -27191,17 +31484,29 @@ int fd_restart_raw_offsets_bitvec_u8_inner_decode( fd_restart_raw_offsets_bitvec
   fd_restart_raw_offsets_bitvec_u8_inner_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_restart_raw_offsets_bitvec_u8_inner_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_restart_raw_offsets_bitvec_u8_inner_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   ulong bits_len;
   err = fd_bincode_uint64_decode( &bits_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( bits_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, bits_len );
     err = fd_bincode_bytes_decode_preflight( bits_len, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_restart_raw_offsets_bitvec_u8_inner_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_restart_raw_offsets_bitvec_u8_inner_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_restart_raw_offsets_bitvec_u8_inner_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_restart_raw_offsets_bitvec_u8_inner_t);
+  int err = fd_restart_raw_offsets_bitvec_u8_inner_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_restart_raw_offsets_bitvec_u8_inner_decode_unsafe( fd_restart_raw_offsets_bitvec_u8_inner_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->bits_len, ctx );
   if( self->bits_len ) {
@@ -27210,6 +31515,15 @@ void fd_restart_raw_offsets_bitvec_u8_inner_decode_unsafe( fd_restart_raw_offset
   } else
     self->bits = NULL;
 }
+fd_restart_raw_offsets_bitvec_u8_inner_t * fd_restart_raw_offsets_bitvec_u8_inner_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_restart_raw_offsets_bitvec_u8_inner_t * self = (fd_restart_raw_offsets_bitvec_u8_inner_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_restart_raw_offsets_bitvec_u8_inner_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_restart_raw_offsets_bitvec_u8_inner_new( self );
+  fd_restart_raw_offsets_bitvec_u8_inner_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_restart_raw_offsets_bitvec_u8_inner_encode( fd_restart_raw_offsets_bitvec_u8_inner_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->bits_len, ctx );
@@ -27222,12 +31536,14 @@ int fd_restart_raw_offsets_bitvec_u8_inner_encode( fd_restart_raw_offsets_bitvec
 }
 int fd_restart_raw_offsets_bitvec_u8_inner_decode_offsets( fd_restart_raw_offsets_bitvec_u8_inner_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->bits_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong bits_len;
   err = fd_bincode_uint64_decode( &bits_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( bits_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, bits_len );
     err = fd_bincode_bytes_decode_preflight( bits_len, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   }
@@ -27271,14 +31587,14 @@ int fd_restart_raw_offsets_bitvec_decode( fd_restart_raw_offsets_bitvec_t * self
   fd_restart_raw_offsets_bitvec_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_restart_raw_offsets_bitvec_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_restart_raw_offsets_bitvec_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   {
     uchar o;
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
-      err = fd_restart_raw_offsets_bitvec_u8_inner_decode_preflight( ctx );
+      err = fd_restart_raw_offsets_bitvec_u8_inner_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -27286,6 +31602,17 @@ int fd_restart_raw_offsets_bitvec_decode_preflight( fd_bincode_decode_ctx_t * ct
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_restart_raw_offsets_bitvec_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_restart_raw_offsets_bitvec_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_restart_raw_offsets_bitvec_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_restart_raw_offsets_bitvec_t);
+  int err = fd_restart_raw_offsets_bitvec_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_restart_raw_offsets_bitvec_decode_unsafe( fd_restart_raw_offsets_bitvec_t * self, fd_bincode_decode_ctx_t * ctx ) {
   {
     uchar o;
@@ -27298,6 +31625,15 @@ void fd_restart_raw_offsets_bitvec_decode_unsafe( fd_restart_raw_offsets_bitvec_
   }
   fd_bincode_uint64_decode_unsafe( &self->len, ctx );
 }
+fd_restart_raw_offsets_bitvec_t * fd_restart_raw_offsets_bitvec_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_restart_raw_offsets_bitvec_t * self = (fd_restart_raw_offsets_bitvec_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_restart_raw_offsets_bitvec_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_restart_raw_offsets_bitvec_new( self );
+  fd_restart_raw_offsets_bitvec_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_restart_raw_offsets_bitvec_encode( fd_restart_raw_offsets_bitvec_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_bool_encode( self->has_bits, ctx );
@@ -27312,6 +31648,7 @@ int fd_restart_raw_offsets_bitvec_encode( fd_restart_raw_offsets_bitvec_t const
 }
 int fd_restart_raw_offsets_bitvec_decode_offsets( fd_restart_raw_offsets_bitvec_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->bits_off = (uint)( (ulong)ctx->data - (ulong)data );
   {
@@ -27319,7 +31656,7 @@ int fd_restart_raw_offsets_bitvec_decode_offsets( fd_restart_raw_offsets_bitvec_
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
-      err = fd_restart_raw_offsets_bitvec_u8_inner_decode_preflight( ctx );
+      err = fd_restart_raw_offsets_bitvec_u8_inner_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -27372,15 +31709,35 @@ int fd_restart_raw_offsets_decode( fd_restart_raw_offsets_t * self, fd_bincode_d
   fd_restart_raw_offsets_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_restart_raw_offsets_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_restart_raw_offsets_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_restart_raw_offsets_bitvec_decode_preflight( ctx );
+  err = fd_restart_raw_offsets_bitvec_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_restart_raw_offsets_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_restart_raw_offsets_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_restart_raw_offsets_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_restart_raw_offsets_t);
+  int err = fd_restart_raw_offsets_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_restart_raw_offsets_decode_unsafe( fd_restart_raw_offsets_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_restart_raw_offsets_bitvec_decode_unsafe( &self->offsets, ctx );
 }
+fd_restart_raw_offsets_t * fd_restart_raw_offsets_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_restart_raw_offsets_t * self = (fd_restart_raw_offsets_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_restart_raw_offsets_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_restart_raw_offsets_new( self );
+  fd_restart_raw_offsets_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_restart_raw_offsets_encode( fd_restart_raw_offsets_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_restart_raw_offsets_bitvec_encode( &self->offsets, ctx );
@@ -27389,9 +31746,10 @@ int fd_restart_raw_offsets_encode( fd_restart_raw_offsets_t const * self, fd_bin
 }
 int fd_restart_raw_offsets_decode_offsets( fd_restart_raw_offsets_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->offsets_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_restart_raw_offsets_bitvec_decode_preflight( ctx );
+  err = fd_restart_raw_offsets_bitvec_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -27424,16 +31782,16 @@ FD_FN_PURE uchar fd_restart_slots_offsets_is_raw_offsets(fd_restart_slots_offset
   return self->discriminant == 1;
 }
 void fd_restart_slots_offsets_inner_new( fd_restart_slots_offsets_inner_t * self, uint discriminant );
-int fd_restart_slots_offsets_inner_decode_preflight( uint discriminant, fd_bincode_decode_ctx_t * ctx ) {
+int fd_restart_slots_offsets_inner_decode_footprint( uint discriminant, fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   switch (discriminant) {
   case 0: {
-    err = fd_restart_run_length_encoding_decode_preflight( ctx );
+    err = fd_restart_run_length_encoding_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 1: {
-    err = fd_restart_raw_offsets_decode_preflight( ctx );
+    err = fd_restart_raw_offsets_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
@@ -27463,16 +31821,36 @@ int fd_restart_slots_offsets_decode( fd_restart_slots_offsets_t * self, fd_binco
   fd_restart_slots_offsets_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_restart_slots_offsets_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_restart_slots_offsets_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   uint discriminant = 0;
   int err = fd_bincode_uint32_decode( &discriminant, ctx );
   if( FD_UNLIKELY( err ) ) return err;
-  return fd_restart_slots_offsets_inner_decode_preflight( discriminant, ctx );
+  return fd_restart_slots_offsets_inner_decode_footprint( discriminant, ctx, total_sz );
+}
+int fd_restart_slots_offsets_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_restart_slots_offsets_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_restart_slots_offsets_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_restart_slots_offsets_t);
+  int err = fd_restart_slots_offsets_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
 }
 void fd_restart_slots_offsets_decode_unsafe( fd_restart_slots_offsets_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint32_decode_unsafe( &self->discriminant, ctx );
   fd_restart_slots_offsets_inner_decode_unsafe( &self->inner, self->discriminant, ctx );
 }
+fd_restart_slots_offsets_t * fd_restart_slots_offsets_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_restart_slots_offsets_t * self = (fd_restart_slots_offsets_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_restart_slots_offsets_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_restart_slots_offsets_new( self );
+  fd_restart_slots_offsets_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 void fd_restart_slots_offsets_inner_new( fd_restart_slots_offsets_inner_t * self, uint discriminant ) {
   switch( discriminant ) {
   case 0: {
@@ -27579,22 +31957,33 @@ int fd_gossip_restart_last_voted_fork_slots_decode( fd_gossip_restart_last_voted
   fd_gossip_restart_last_voted_fork_slots_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_gossip_restart_last_voted_fork_slots_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_gossip_restart_last_voted_fork_slots_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_restart_slots_offsets_decode_preflight( ctx );
+  err = fd_restart_slots_offsets_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint16_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_gossip_restart_last_voted_fork_slots_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_gossip_restart_last_voted_fork_slots_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_gossip_restart_last_voted_fork_slots_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_gossip_restart_last_voted_fork_slots_t);
+  int err = fd_gossip_restart_last_voted_fork_slots_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_gossip_restart_last_voted_fork_slots_decode_unsafe( fd_gossip_restart_last_voted_fork_slots_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->from, ctx );
   fd_bincode_uint64_decode_unsafe( &self->wallclock, ctx );
@@ -27603,6 +31992,15 @@ void fd_gossip_restart_last_voted_fork_slots_decode_unsafe( fd_gossip_restart_la
   fd_hash_decode_unsafe( &self->last_voted_hash, ctx );
   fd_bincode_uint16_decode_unsafe( &self->shred_version, ctx );
 }
+fd_gossip_restart_last_voted_fork_slots_t * fd_gossip_restart_last_voted_fork_slots_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_gossip_restart_last_voted_fork_slots_t * self = (fd_gossip_restart_last_voted_fork_slots_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_gossip_restart_last_voted_fork_slots_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_gossip_restart_last_voted_fork_slots_new( self );
+  fd_gossip_restart_last_voted_fork_slots_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_gossip_restart_last_voted_fork_slots_encode( fd_gossip_restart_last_voted_fork_slots_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->from, ctx );
@@ -27621,21 +32019,22 @@ int fd_gossip_restart_last_voted_fork_slots_encode( fd_gossip_restart_last_voted
 }
 int fd_gossip_restart_last_voted_fork_slots_decode_offsets( fd_gossip_restart_last_voted_fork_slots_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->from_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->wallclock_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->offsets_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_restart_slots_offsets_decode_preflight( ctx );
+  err = fd_restart_slots_offsets_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->last_voted_slot_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->last_voted_hash_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->shred_version_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint16_decode_preflight( ctx );
@@ -27689,9 +32088,20 @@ int fd_gossip_restart_heaviest_fork_decode( fd_gossip_restart_heaviest_fork_t *
   fd_gossip_restart_heaviest_fork_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_gossip_restart_heaviest_fork_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_gossip_restart_heaviest_fork_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 90, ctx );
 }
+int fd_gossip_restart_heaviest_fork_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_gossip_restart_heaviest_fork_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_gossip_restart_heaviest_fork_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_gossip_restart_heaviest_fork_t);
+  int err = fd_gossip_restart_heaviest_fork_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_gossip_restart_heaviest_fork_decode_unsafe( fd_gossip_restart_heaviest_fork_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->from, ctx );
   fd_bincode_uint64_decode_unsafe( &self->wallclock, ctx );
@@ -27700,6 +32110,15 @@ void fd_gossip_restart_heaviest_fork_decode_unsafe( fd_gossip_restart_heaviest_f
   fd_bincode_uint64_decode_unsafe( &self->observed_stake, ctx );
   fd_bincode_uint16_decode_unsafe( &self->shred_version, ctx );
 }
+fd_gossip_restart_heaviest_fork_t * fd_gossip_restart_heaviest_fork_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_gossip_restart_heaviest_fork_t * self = (fd_gossip_restart_heaviest_fork_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_gossip_restart_heaviest_fork_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_gossip_restart_heaviest_fork_new( self );
+  fd_gossip_restart_heaviest_fork_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_gossip_restart_heaviest_fork_encode( fd_gossip_restart_heaviest_fork_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->from, ctx );
@@ -27718,9 +32137,10 @@ int fd_gossip_restart_heaviest_fork_encode( fd_gossip_restart_heaviest_fork_t co
 }
 int fd_gossip_restart_heaviest_fork_decode_offsets( fd_gossip_restart_heaviest_fork_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->from_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->wallclock_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -27729,7 +32149,7 @@ int fd_gossip_restart_heaviest_fork_decode_offsets( fd_gossip_restart_heaviest_f
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->last_slot_hash_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->observed_stake_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -27816,76 +32236,76 @@ FD_FN_PURE uchar fd_crds_data_is_restart_heaviest_fork(fd_crds_data_t const * se
   return self->discriminant == 13;
 }
 void fd_crds_data_inner_new( fd_crds_data_inner_t * self, uint discriminant );
-int fd_crds_data_inner_decode_preflight( uint discriminant, fd_bincode_decode_ctx_t * ctx ) {
+int fd_crds_data_inner_decode_footprint( uint discriminant, fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   switch (discriminant) {
   case 0: {
-    err = fd_gossip_contact_info_v1_decode_preflight( ctx );
+    err = fd_gossip_contact_info_v1_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 1: {
-    err = fd_gossip_vote_decode_preflight( ctx );
+    err = fd_gossip_vote_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 2: {
-    err = fd_gossip_lowest_slot_decode_preflight( ctx );
+    err = fd_gossip_lowest_slot_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 3: {
-    err = fd_gossip_slot_hashes_decode_preflight( ctx );
+    err = fd_gossip_slot_hashes_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 4: {
-    err = fd_gossip_slot_hashes_decode_preflight( ctx );
+    err = fd_gossip_slot_hashes_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 5: {
-    err = fd_gossip_epoch_slots_decode_preflight( ctx );
+    err = fd_gossip_epoch_slots_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 6: {
-    err = fd_gossip_version_v1_decode_preflight( ctx );
+    err = fd_gossip_version_v1_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 7: {
-    err = fd_gossip_version_v2_decode_preflight( ctx );
+    err = fd_gossip_version_v2_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 8: {
-    err = fd_gossip_node_instance_decode_preflight( ctx );
+    err = fd_gossip_node_instance_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 9: {
-    err = fd_gossip_duplicate_shred_decode_preflight( ctx );
+    err = fd_gossip_duplicate_shred_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 10: {
-    err = fd_gossip_incremental_snapshot_hashes_decode_preflight( ctx );
+    err = fd_gossip_incremental_snapshot_hashes_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 11: {
-    err = fd_gossip_contact_info_v2_decode_preflight( ctx );
+    err = fd_gossip_contact_info_v2_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 12: {
-    err = fd_gossip_restart_last_voted_fork_slots_decode_preflight( ctx );
+    err = fd_gossip_restart_last_voted_fork_slots_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 13: {
-    err = fd_gossip_restart_heaviest_fork_decode_preflight( ctx );
+    err = fd_gossip_restart_heaviest_fork_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
@@ -27963,16 +32383,36 @@ int fd_crds_data_decode( fd_crds_data_t * self, fd_bincode_decode_ctx_t * ctx )
   fd_crds_data_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_crds_data_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_crds_data_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   uint discriminant = 0;
   int err = fd_bincode_uint32_decode( &discriminant, ctx );
   if( FD_UNLIKELY( err ) ) return err;
-  return fd_crds_data_inner_decode_preflight( discriminant, ctx );
+  return fd_crds_data_inner_decode_footprint( discriminant, ctx, total_sz );
+}
+int fd_crds_data_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_crds_data_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_crds_data_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_crds_data_t);
+  int err = fd_crds_data_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
 }
 void fd_crds_data_decode_unsafe( fd_crds_data_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint32_decode_unsafe( &self->discriminant, ctx );
   fd_crds_data_inner_decode_unsafe( &self->inner, self->discriminant, ctx );
 }
+fd_crds_data_t * fd_crds_data_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_crds_data_t * self = (fd_crds_data_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_crds_data_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_crds_data_new( self );
+  fd_crds_data_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 void fd_crds_data_inner_new( fd_crds_data_inner_t * self, uint discriminant ) {
   switch( discriminant ) {
   case 0: {
@@ -28343,23 +32783,35 @@ int fd_crds_bloom_decode( fd_crds_bloom_t * self, fd_bincode_decode_ctx_t * ctx
   fd_crds_bloom_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_crds_bloom_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_crds_bloom_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   ulong keys_len;
   err = fd_bincode_uint64_decode( &keys_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( keys_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, sizeof(ulong)*keys_len );
     for( ulong i=0; i < keys_len; i++ ) {
       err = fd_bincode_uint64_decode_preflight( ctx );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
-  err = fd_gossip_bitvec_u64_decode_preflight( ctx );
+  err = fd_gossip_bitvec_u64_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_crds_bloom_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_crds_bloom_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_crds_bloom_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_crds_bloom_t);
+  int err = fd_crds_bloom_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_crds_bloom_decode_unsafe( fd_crds_bloom_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->keys_len, ctx );
   if( self->keys_len ) {
@@ -28372,6 +32824,15 @@ void fd_crds_bloom_decode_unsafe( fd_crds_bloom_t * self, fd_bincode_decode_ctx_
   fd_gossip_bitvec_u64_decode_unsafe( &self->bits, ctx );
   fd_bincode_uint64_decode_unsafe( &self->num_bits_set, ctx );
 }
+fd_crds_bloom_t * fd_crds_bloom_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_crds_bloom_t * self = (fd_crds_bloom_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_crds_bloom_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_crds_bloom_new( self );
+  fd_crds_bloom_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_crds_bloom_encode( fd_crds_bloom_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->keys_len, ctx );
@@ -28389,19 +32850,21 @@ int fd_crds_bloom_encode( fd_crds_bloom_t const * self, fd_bincode_encode_ctx_t
 }
 int fd_crds_bloom_decode_offsets( fd_crds_bloom_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->keys_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong keys_len;
   err = fd_bincode_uint64_decode( &keys_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( keys_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, sizeof(ulong)*keys_len );
     for( ulong i=0; i < keys_len; i++ ) {
       err = fd_bincode_uint64_decode_preflight( ctx );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
   self->bits_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_gossip_bitvec_u64_decode_preflight( ctx );
+  err = fd_gossip_bitvec_u64_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->num_bits_set_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -28457,9 +32920,9 @@ int fd_crds_filter_decode( fd_crds_filter_t * self, fd_bincode_decode_ctx_t * ct
   fd_crds_filter_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_crds_filter_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_crds_filter_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_crds_bloom_decode_preflight( ctx );
+  err = fd_crds_bloom_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -28467,11 +32930,31 @@ int fd_crds_filter_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_crds_filter_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_crds_filter_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_crds_filter_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_crds_filter_t);
+  int err = fd_crds_filter_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_crds_filter_decode_unsafe( fd_crds_filter_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_crds_bloom_decode_unsafe( &self->filter, ctx );
   fd_bincode_uint64_decode_unsafe( &self->mask, ctx );
   fd_bincode_uint32_decode_unsafe( &self->mask_bits, ctx );
 }
+fd_crds_filter_t * fd_crds_filter_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_crds_filter_t * self = (fd_crds_filter_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_crds_filter_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_crds_filter_new( self );
+  fd_crds_filter_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_crds_filter_encode( fd_crds_filter_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_crds_bloom_encode( &self->filter, ctx );
@@ -28484,9 +32967,10 @@ int fd_crds_filter_encode( fd_crds_filter_t const * self, fd_bincode_encode_ctx_
 }
 int fd_crds_filter_decode_offsets( fd_crds_filter_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->filter_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_crds_bloom_decode_preflight( ctx );
+  err = fd_crds_bloom_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->mask_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -28533,18 +33017,38 @@ int fd_crds_value_decode( fd_crds_value_t * self, fd_bincode_decode_ctx_t * ctx
   fd_crds_value_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_crds_value_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_crds_value_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_signature_decode_preflight( ctx );
+  err = fd_signature_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_crds_data_decode_preflight( ctx );
+  err = fd_crds_data_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_crds_value_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_crds_value_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_crds_value_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_crds_value_t);
+  int err = fd_crds_value_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_crds_value_decode_unsafe( fd_crds_value_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_signature_decode_unsafe( &self->signature, ctx );
   fd_crds_data_decode_unsafe( &self->data, ctx );
 }
+fd_crds_value_t * fd_crds_value_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_crds_value_t * self = (fd_crds_value_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_crds_value_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_crds_value_new( self );
+  fd_crds_value_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_crds_value_encode( fd_crds_value_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_signature_encode( &self->signature, ctx );
@@ -28555,12 +33059,13 @@ int fd_crds_value_encode( fd_crds_value_t const * self, fd_bincode_encode_ctx_t
 }
 int fd_crds_value_decode_offsets( fd_crds_value_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->signature_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_signature_decode_preflight( ctx );
+  err = fd_signature_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->data_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_crds_data_decode_preflight( ctx );
+  err = fd_crds_data_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -28601,18 +33106,38 @@ int fd_gossip_pull_req_decode( fd_gossip_pull_req_t * self, fd_bincode_decode_ct
   fd_gossip_pull_req_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_gossip_pull_req_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_gossip_pull_req_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_crds_filter_decode_preflight( ctx );
+  err = fd_crds_filter_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_crds_value_decode_preflight( ctx );
+  err = fd_crds_value_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_gossip_pull_req_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_gossip_pull_req_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_gossip_pull_req_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_gossip_pull_req_t);
+  int err = fd_gossip_pull_req_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_gossip_pull_req_decode_unsafe( fd_gossip_pull_req_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_crds_filter_decode_unsafe( &self->filter, ctx );
   fd_crds_value_decode_unsafe( &self->value, ctx );
 }
+fd_gossip_pull_req_t * fd_gossip_pull_req_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_gossip_pull_req_t * self = (fd_gossip_pull_req_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_gossip_pull_req_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_gossip_pull_req_new( self );
+  fd_gossip_pull_req_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_gossip_pull_req_encode( fd_gossip_pull_req_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_crds_filter_encode( &self->filter, ctx );
@@ -28623,12 +33148,13 @@ int fd_gossip_pull_req_encode( fd_gossip_pull_req_t const * self, fd_bincode_enc
 }
 int fd_gossip_pull_req_decode_offsets( fd_gossip_pull_req_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->filter_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_crds_filter_decode_preflight( ctx );
+  err = fd_crds_filter_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->value_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_crds_value_decode_preflight( ctx );
+  err = fd_crds_value_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -28669,21 +33195,33 @@ int fd_gossip_pull_resp_decode( fd_gossip_pull_resp_t * self, fd_bincode_decode_
   fd_gossip_pull_resp_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_gossip_pull_resp_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_gossip_pull_resp_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   ulong crds_len;
   err = fd_bincode_uint64_decode( &crds_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( crds_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_CRDS_VALUE_ALIGN, FD_CRDS_VALUE_FOOTPRINT*crds_len );
     for( ulong i=0; i < crds_len; i++ ) {
-      err = fd_crds_value_decode_preflight( ctx );
+      err = fd_crds_value_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_gossip_pull_resp_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_gossip_pull_resp_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_gossip_pull_resp_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_gossip_pull_resp_t);
+  int err = fd_gossip_pull_resp_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_gossip_pull_resp_decode_unsafe( fd_gossip_pull_resp_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->pubkey, ctx );
   fd_bincode_uint64_decode_unsafe( &self->crds_len, ctx );
@@ -28696,6 +33234,15 @@ void fd_gossip_pull_resp_decode_unsafe( fd_gossip_pull_resp_t * self, fd_bincode
   } else
     self->crds = NULL;
 }
+fd_gossip_pull_resp_t * fd_gossip_pull_resp_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_gossip_pull_resp_t * self = (fd_gossip_pull_resp_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_gossip_pull_resp_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_gossip_pull_resp_new( self );
+  fd_gossip_pull_resp_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_gossip_pull_resp_encode( fd_gossip_pull_resp_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->pubkey, ctx );
@@ -28712,17 +33259,19 @@ int fd_gossip_pull_resp_encode( fd_gossip_pull_resp_t const * self, fd_bincode_e
 }
 int fd_gossip_pull_resp_decode_offsets( fd_gossip_pull_resp_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->pubkey_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->crds_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong crds_len;
   err = fd_bincode_uint64_decode( &crds_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( crds_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_CRDS_VALUE_ALIGN, FD_CRDS_VALUE_FOOTPRINT*crds_len );
     for( ulong i=0; i < crds_len; i++ ) {
-      err = fd_crds_value_decode_preflight( ctx );
+      err = fd_crds_value_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -28778,21 +33327,33 @@ int fd_gossip_push_msg_decode( fd_gossip_push_msg_t * self, fd_bincode_decode_ct
   fd_gossip_push_msg_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_gossip_push_msg_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_gossip_push_msg_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   ulong crds_len;
   err = fd_bincode_uint64_decode( &crds_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( crds_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_CRDS_VALUE_ALIGN, FD_CRDS_VALUE_FOOTPRINT*crds_len );
     for( ulong i=0; i < crds_len; i++ ) {
-      err = fd_crds_value_decode_preflight( ctx );
+      err = fd_crds_value_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_gossip_push_msg_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_gossip_push_msg_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_gossip_push_msg_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_gossip_push_msg_t);
+  int err = fd_gossip_push_msg_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_gossip_push_msg_decode_unsafe( fd_gossip_push_msg_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->pubkey, ctx );
   fd_bincode_uint64_decode_unsafe( &self->crds_len, ctx );
@@ -28805,6 +33366,15 @@ void fd_gossip_push_msg_decode_unsafe( fd_gossip_push_msg_t * self, fd_bincode_d
   } else
     self->crds = NULL;
 }
+fd_gossip_push_msg_t * fd_gossip_push_msg_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_gossip_push_msg_t * self = (fd_gossip_push_msg_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_gossip_push_msg_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_gossip_push_msg_new( self );
+  fd_gossip_push_msg_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_gossip_push_msg_encode( fd_gossip_push_msg_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->pubkey, ctx );
@@ -28821,17 +33391,19 @@ int fd_gossip_push_msg_encode( fd_gossip_push_msg_t const * self, fd_bincode_enc
 }
 int fd_gossip_push_msg_decode_offsets( fd_gossip_push_msg_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->pubkey_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->crds_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong crds_len;
   err = fd_bincode_uint64_decode( &crds_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( crds_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_CRDS_VALUE_ALIGN, FD_CRDS_VALUE_FOOTPRINT*crds_len );
     for( ulong i=0; i < crds_len; i++ ) {
-      err = fd_crds_value_decode_preflight( ctx );
+      err = fd_crds_value_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -28887,18 +33459,38 @@ int fd_gossip_prune_msg_decode( fd_gossip_prune_msg_t * self, fd_bincode_decode_
   fd_gossip_prune_msg_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_gossip_prune_msg_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_gossip_prune_msg_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_gossip_prune_data_decode_preflight( ctx );
+  err = fd_gossip_prune_data_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_gossip_prune_msg_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_gossip_prune_msg_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_gossip_prune_msg_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_gossip_prune_msg_t);
+  int err = fd_gossip_prune_msg_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_gossip_prune_msg_decode_unsafe( fd_gossip_prune_msg_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->pubkey, ctx );
   fd_gossip_prune_data_decode_unsafe( &self->data, ctx );
 }
+fd_gossip_prune_msg_t * fd_gossip_prune_msg_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_gossip_prune_msg_t * self = (fd_gossip_prune_msg_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_gossip_prune_msg_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_gossip_prune_msg_new( self );
+  fd_gossip_prune_msg_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_gossip_prune_msg_encode( fd_gossip_prune_msg_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->pubkey, ctx );
@@ -28909,12 +33501,13 @@ int fd_gossip_prune_msg_encode( fd_gossip_prune_msg_t const * self, fd_bincode_e
 }
 int fd_gossip_prune_msg_decode_offsets( fd_gossip_prune_msg_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->pubkey_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->data_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_gossip_prune_data_decode_preflight( ctx );
+  err = fd_gossip_prune_data_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -28963,36 +33556,36 @@ FD_FN_PURE uchar fd_gossip_msg_is_pong(fd_gossip_msg_t const * self) {
   return self->discriminant == 5;
 }
 void fd_gossip_msg_inner_new( fd_gossip_msg_inner_t * self, uint discriminant );
-int fd_gossip_msg_inner_decode_preflight( uint discriminant, fd_bincode_decode_ctx_t * ctx ) {
+int fd_gossip_msg_inner_decode_footprint( uint discriminant, fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   switch (discriminant) {
   case 0: {
-    err = fd_gossip_pull_req_decode_preflight( ctx );
+    err = fd_gossip_pull_req_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 1: {
-    err = fd_gossip_pull_resp_decode_preflight( ctx );
+    err = fd_gossip_pull_resp_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 2: {
-    err = fd_gossip_push_msg_decode_preflight( ctx );
+    err = fd_gossip_push_msg_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 3: {
-    err = fd_gossip_prune_msg_decode_preflight( ctx );
+    err = fd_gossip_prune_msg_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 4: {
-    err = fd_gossip_ping_decode_preflight( ctx );
+    err = fd_gossip_ping_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 5: {
-    err = fd_gossip_ping_decode_preflight( ctx );
+    err = fd_gossip_ping_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
@@ -29038,16 +33631,36 @@ int fd_gossip_msg_decode( fd_gossip_msg_t * self, fd_bincode_decode_ctx_t * ctx
   fd_gossip_msg_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_gossip_msg_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_gossip_msg_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   uint discriminant = 0;
   int err = fd_bincode_uint32_decode( &discriminant, ctx );
   if( FD_UNLIKELY( err ) ) return err;
-  return fd_gossip_msg_inner_decode_preflight( discriminant, ctx );
+  return fd_gossip_msg_inner_decode_footprint( discriminant, ctx, total_sz );
+}
+int fd_gossip_msg_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_gossip_msg_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_gossip_msg_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_gossip_msg_t);
+  int err = fd_gossip_msg_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
 }
 void fd_gossip_msg_decode_unsafe( fd_gossip_msg_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint32_decode_unsafe( &self->discriminant, ctx );
   fd_gossip_msg_inner_decode_unsafe( &self->inner, self->discriminant, ctx );
 }
+fd_gossip_msg_t * fd_gossip_msg_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_gossip_msg_t * self = (fd_gossip_msg_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_gossip_msg_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_gossip_msg_new( self );
+  fd_gossip_msg_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 void fd_gossip_msg_inner_new( fd_gossip_msg_inner_t * self, uint discriminant ) {
   switch( discriminant ) {
   case 0: {
@@ -29242,13 +33855,33 @@ int fd_addrlut_create_decode( fd_addrlut_create_t * self, fd_bincode_decode_ctx_
   fd_addrlut_create_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_addrlut_create_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_addrlut_create_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 9, ctx );
 }
+int fd_addrlut_create_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_addrlut_create_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_addrlut_create_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_addrlut_create_t);
+  int err = fd_addrlut_create_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_addrlut_create_decode_unsafe( fd_addrlut_create_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->recent_slot, ctx );
   fd_bincode_uint8_decode_unsafe( &self->bump_seed, ctx );
 }
+fd_addrlut_create_t * fd_addrlut_create_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_addrlut_create_t * self = (fd_addrlut_create_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_addrlut_create_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_addrlut_create_new( self );
+  fd_addrlut_create_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_addrlut_create_encode( fd_addrlut_create_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->recent_slot, ctx );
@@ -29259,6 +33892,7 @@ int fd_addrlut_create_encode( fd_addrlut_create_t const * self, fd_bincode_encod
 }
 int fd_addrlut_create_decode_offsets( fd_addrlut_create_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->recent_slot_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -29301,19 +33935,31 @@ int fd_addrlut_extend_decode( fd_addrlut_extend_t * self, fd_bincode_decode_ctx_
   fd_addrlut_extend_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_addrlut_extend_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_addrlut_extend_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   ulong new_addrs_len;
   err = fd_bincode_uint64_decode( &new_addrs_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( new_addrs_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_PUBKEY_ALIGN, FD_PUBKEY_FOOTPRINT*new_addrs_len );
     for( ulong i=0; i < new_addrs_len; i++ ) {
-      err = fd_pubkey_decode_preflight( ctx );
+      err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_addrlut_extend_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_addrlut_extend_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_addrlut_extend_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_addrlut_extend_t);
+  int err = fd_addrlut_extend_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_addrlut_extend_decode_unsafe( fd_addrlut_extend_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->new_addrs_len, ctx );
   if( self->new_addrs_len ) {
@@ -29325,6 +33971,15 @@ void fd_addrlut_extend_decode_unsafe( fd_addrlut_extend_t * self, fd_bincode_dec
   } else
     self->new_addrs = NULL;
 }
+fd_addrlut_extend_t * fd_addrlut_extend_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_addrlut_extend_t * self = (fd_addrlut_extend_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_addrlut_extend_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_addrlut_extend_new( self );
+  fd_addrlut_extend_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_addrlut_extend_encode( fd_addrlut_extend_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->new_addrs_len, ctx );
@@ -29339,14 +33994,16 @@ int fd_addrlut_extend_encode( fd_addrlut_extend_t const * self, fd_bincode_encod
 }
 int fd_addrlut_extend_decode_offsets( fd_addrlut_extend_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->new_addrs_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong new_addrs_len;
   err = fd_bincode_uint64_decode( &new_addrs_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( new_addrs_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_PUBKEY_ALIGN, FD_PUBKEY_FOOTPRINT*new_addrs_len );
     for( ulong i=0; i < new_addrs_len; i++ ) {
-      err = fd_pubkey_decode_preflight( ctx );
+      err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -29403,11 +34060,11 @@ FD_FN_PURE uchar fd_addrlut_instruction_is_close_lut(fd_addrlut_instruction_t co
   return self->discriminant == 4;
 }
 void fd_addrlut_instruction_inner_new( fd_addrlut_instruction_inner_t * self, uint discriminant );
-int fd_addrlut_instruction_inner_decode_preflight( uint discriminant, fd_bincode_decode_ctx_t * ctx ) {
+int fd_addrlut_instruction_inner_decode_footprint( uint discriminant, fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   switch (discriminant) {
   case 0: {
-    err = fd_addrlut_create_decode_preflight( ctx );
+    err = fd_addrlut_create_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
@@ -29415,7 +34072,7 @@ int fd_addrlut_instruction_inner_decode_preflight( uint discriminant, fd_bincode
     return FD_BINCODE_SUCCESS;
   }
   case 2: {
-    err = fd_addrlut_extend_decode_preflight( ctx );
+    err = fd_addrlut_extend_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
@@ -29460,16 +34117,36 @@ int fd_addrlut_instruction_decode( fd_addrlut_instruction_t * self, fd_bincode_d
   fd_addrlut_instruction_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_addrlut_instruction_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_addrlut_instruction_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   uint discriminant = 0;
   int err = fd_bincode_uint32_decode( &discriminant, ctx );
   if( FD_UNLIKELY( err ) ) return err;
-  return fd_addrlut_instruction_inner_decode_preflight( discriminant, ctx );
+  return fd_addrlut_instruction_inner_decode_footprint( discriminant, ctx, total_sz );
+}
+int fd_addrlut_instruction_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_addrlut_instruction_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_addrlut_instruction_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_addrlut_instruction_t);
+  int err = fd_addrlut_instruction_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
 }
 void fd_addrlut_instruction_decode_unsafe( fd_addrlut_instruction_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint32_decode_unsafe( &self->discriminant, ctx );
   fd_addrlut_instruction_inner_decode_unsafe( &self->inner, self->discriminant, ctx );
 }
+fd_addrlut_instruction_t * fd_addrlut_instruction_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_addrlut_instruction_t * self = (fd_addrlut_instruction_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_addrlut_instruction_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_addrlut_instruction_new( self );
+  fd_addrlut_instruction_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 void fd_addrlut_instruction_inner_new( fd_addrlut_instruction_inner_t * self, uint discriminant ) {
   switch( discriminant ) {
   case 0: {
@@ -29597,9 +34274,20 @@ int fd_repair_request_header_decode( fd_repair_request_header_t * self, fd_binco
   fd_repair_request_header_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_repair_request_header_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_repair_request_header_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 140, ctx );
 }
+int fd_repair_request_header_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_repair_request_header_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_repair_request_header_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_repair_request_header_t);
+  int err = fd_repair_request_header_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_repair_request_header_decode_unsafe( fd_repair_request_header_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_signature_decode_unsafe( &self->signature, ctx );
   fd_pubkey_decode_unsafe( &self->sender, ctx );
@@ -29607,6 +34295,15 @@ void fd_repair_request_header_decode_unsafe( fd_repair_request_header_t * self,
   fd_bincode_uint64_decode_unsafe( (ulong *) &self->timestamp, ctx );
   fd_bincode_uint32_decode_unsafe( &self->nonce, ctx );
 }
+fd_repair_request_header_t * fd_repair_request_header_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_repair_request_header_t * self = (fd_repair_request_header_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_repair_request_header_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_repair_request_header_new( self );
+  fd_repair_request_header_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_repair_request_header_encode( fd_repair_request_header_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_signature_encode( &self->signature, ctx );
@@ -29623,15 +34320,16 @@ int fd_repair_request_header_encode( fd_repair_request_header_t const * self, fd
 }
 int fd_repair_request_header_decode_offsets( fd_repair_request_header_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->signature_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_signature_decode_preflight( ctx );
+  err = fd_signature_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->sender_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->recipient_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->timestamp_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -29686,14 +34384,34 @@ int fd_repair_window_index_decode( fd_repair_window_index_t * self, fd_bincode_d
   fd_repair_window_index_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_repair_window_index_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_repair_window_index_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 156, ctx );
 }
+int fd_repair_window_index_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_repair_window_index_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_repair_window_index_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_repair_window_index_t);
+  int err = fd_repair_window_index_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_repair_window_index_decode_unsafe( fd_repair_window_index_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_repair_request_header_decode_unsafe( &self->header, ctx );
   fd_bincode_uint64_decode_unsafe( &self->slot, ctx );
   fd_bincode_uint64_decode_unsafe( &self->shred_index, ctx );
 }
+fd_repair_window_index_t * fd_repair_window_index_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_repair_window_index_t * self = (fd_repair_window_index_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_repair_window_index_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_repair_window_index_new( self );
+  fd_repair_window_index_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_repair_window_index_encode( fd_repair_window_index_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_repair_request_header_encode( &self->header, ctx );
@@ -29706,9 +34424,10 @@ int fd_repair_window_index_encode( fd_repair_window_index_t const * self, fd_bin
 }
 int fd_repair_window_index_decode_offsets( fd_repair_window_index_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->header_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_repair_request_header_decode_preflight( ctx );
+  err = fd_repair_request_header_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->slot_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -29755,14 +34474,34 @@ int fd_repair_highest_window_index_decode( fd_repair_highest_window_index_t * se
   fd_repair_highest_window_index_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_repair_highest_window_index_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_repair_highest_window_index_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 156, ctx );
 }
+int fd_repair_highest_window_index_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_repair_highest_window_index_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_repair_highest_window_index_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_repair_highest_window_index_t);
+  int err = fd_repair_highest_window_index_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_repair_highest_window_index_decode_unsafe( fd_repair_highest_window_index_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_repair_request_header_decode_unsafe( &self->header, ctx );
   fd_bincode_uint64_decode_unsafe( &self->slot, ctx );
   fd_bincode_uint64_decode_unsafe( &self->shred_index, ctx );
 }
+fd_repair_highest_window_index_t * fd_repair_highest_window_index_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_repair_highest_window_index_t * self = (fd_repair_highest_window_index_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_repair_highest_window_index_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_repair_highest_window_index_new( self );
+  fd_repair_highest_window_index_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_repair_highest_window_index_encode( fd_repair_highest_window_index_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_repair_request_header_encode( &self->header, ctx );
@@ -29775,9 +34514,10 @@ int fd_repair_highest_window_index_encode( fd_repair_highest_window_index_t cons
 }
 int fd_repair_highest_window_index_decode_offsets( fd_repair_highest_window_index_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->header_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_repair_request_header_decode_preflight( ctx );
+  err = fd_repair_request_header_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->slot_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -29824,13 +34564,33 @@ int fd_repair_orphan_decode( fd_repair_orphan_t * self, fd_bincode_decode_ctx_t
   fd_repair_orphan_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_repair_orphan_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_repair_orphan_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 148, ctx );
 }
+int fd_repair_orphan_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_repair_orphan_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_repair_orphan_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_repair_orphan_t);
+  int err = fd_repair_orphan_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_repair_orphan_decode_unsafe( fd_repair_orphan_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_repair_request_header_decode_unsafe( &self->header, ctx );
   fd_bincode_uint64_decode_unsafe( &self->slot, ctx );
 }
+fd_repair_orphan_t * fd_repair_orphan_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_repair_orphan_t * self = (fd_repair_orphan_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_repair_orphan_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_repair_orphan_new( self );
+  fd_repair_orphan_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_repair_orphan_encode( fd_repair_orphan_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_repair_request_header_encode( &self->header, ctx );
@@ -29841,9 +34601,10 @@ int fd_repair_orphan_encode( fd_repair_orphan_t const * self, fd_bincode_encode_
 }
 int fd_repair_orphan_decode_offsets( fd_repair_orphan_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->header_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_repair_request_header_decode_preflight( ctx );
+  err = fd_repair_request_header_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->slot_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -29885,13 +34646,33 @@ int fd_repair_ancestor_hashes_decode( fd_repair_ancestor_hashes_t * self, fd_bin
   fd_repair_ancestor_hashes_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_repair_ancestor_hashes_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_repair_ancestor_hashes_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 148, ctx );
 }
+int fd_repair_ancestor_hashes_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_repair_ancestor_hashes_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_repair_ancestor_hashes_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_repair_ancestor_hashes_t);
+  int err = fd_repair_ancestor_hashes_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_repair_ancestor_hashes_decode_unsafe( fd_repair_ancestor_hashes_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_repair_request_header_decode_unsafe( &self->header, ctx );
   fd_bincode_uint64_decode_unsafe( &self->slot, ctx );
 }
+fd_repair_ancestor_hashes_t * fd_repair_ancestor_hashes_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_repair_ancestor_hashes_t * self = (fd_repair_ancestor_hashes_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_repair_ancestor_hashes_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_repair_ancestor_hashes_new( self );
+  fd_repair_ancestor_hashes_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_repair_ancestor_hashes_encode( fd_repair_ancestor_hashes_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_repair_request_header_encode( &self->header, ctx );
@@ -29902,9 +34683,10 @@ int fd_repair_ancestor_hashes_encode( fd_repair_ancestor_hashes_t const * self,
 }
 int fd_repair_ancestor_hashes_decode_offsets( fd_repair_ancestor_hashes_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->header_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_repair_request_header_decode_preflight( ctx );
+  err = fd_repair_request_header_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->slot_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -29972,7 +34754,7 @@ FD_FN_PURE uchar fd_repair_protocol_is_ancestor_hashes(fd_repair_protocol_t cons
   return self->discriminant == 11;
 }
 void fd_repair_protocol_inner_new( fd_repair_protocol_inner_t * self, uint discriminant );
-int fd_repair_protocol_inner_decode_preflight( uint discriminant, fd_bincode_decode_ctx_t * ctx ) {
+int fd_repair_protocol_inner_decode_footprint( uint discriminant, fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   switch (discriminant) {
   case 0: {
@@ -29997,27 +34779,27 @@ int fd_repair_protocol_inner_decode_preflight( uint discriminant, fd_bincode_dec
     return FD_BINCODE_SUCCESS;
   }
   case 7: {
-    err = fd_gossip_ping_decode_preflight( ctx );
+    err = fd_gossip_ping_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 8: {
-    err = fd_repair_window_index_decode_preflight( ctx );
+    err = fd_repair_window_index_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 9: {
-    err = fd_repair_highest_window_index_decode_preflight( ctx );
+    err = fd_repair_highest_window_index_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 10: {
-    err = fd_repair_orphan_decode_preflight( ctx );
+    err = fd_repair_orphan_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
   case 11: {
-    err = fd_repair_ancestor_hashes_decode_preflight( ctx );
+    err = fd_repair_ancestor_hashes_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
@@ -30080,16 +34862,36 @@ int fd_repair_protocol_decode( fd_repair_protocol_t * self, fd_bincode_decode_ct
   fd_repair_protocol_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_repair_protocol_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_repair_protocol_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   uint discriminant = 0;
   int err = fd_bincode_uint32_decode( &discriminant, ctx );
   if( FD_UNLIKELY( err ) ) return err;
-  return fd_repair_protocol_inner_decode_preflight( discriminant, ctx );
+  return fd_repair_protocol_inner_decode_footprint( discriminant, ctx, total_sz );
+}
+int fd_repair_protocol_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_repair_protocol_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_repair_protocol_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_repair_protocol_t);
+  int err = fd_repair_protocol_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
 }
 void fd_repair_protocol_decode_unsafe( fd_repair_protocol_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint32_decode_unsafe( &self->discriminant, ctx );
   fd_repair_protocol_inner_decode_unsafe( &self->inner, self->discriminant, ctx );
 }
+fd_repair_protocol_t * fd_repair_protocol_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_repair_protocol_t * self = (fd_repair_protocol_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_repair_protocol_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_repair_protocol_new( self );
+  fd_repair_protocol_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 void fd_repair_protocol_inner_new( fd_repair_protocol_inner_t * self, uint discriminant ) {
   switch( discriminant ) {
   case 0: {
@@ -30304,11 +35106,11 @@ FD_FN_PURE uchar fd_repair_response_is_ping(fd_repair_response_t const * self) {
   return self->discriminant == 0;
 }
 void fd_repair_response_inner_new( fd_repair_response_inner_t * self, uint discriminant );
-int fd_repair_response_inner_decode_preflight( uint discriminant, fd_bincode_decode_ctx_t * ctx ) {
+int fd_repair_response_inner_decode_footprint( uint discriminant, fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   switch (discriminant) {
   case 0: {
-    err = fd_gossip_ping_decode_preflight( ctx );
+    err = fd_gossip_ping_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
@@ -30334,16 +35136,36 @@ int fd_repair_response_decode( fd_repair_response_t * self, fd_bincode_decode_ct
   fd_repair_response_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_repair_response_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_repair_response_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   uint discriminant = 0;
   int err = fd_bincode_uint32_decode( &discriminant, ctx );
   if( FD_UNLIKELY( err ) ) return err;
-  return fd_repair_response_inner_decode_preflight( discriminant, ctx );
+  return fd_repair_response_inner_decode_footprint( discriminant, ctx, total_sz );
+}
+int fd_repair_response_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_repair_response_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_repair_response_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_repair_response_t);
+  int err = fd_repair_response_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
 }
 void fd_repair_response_decode_unsafe( fd_repair_response_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint32_decode_unsafe( &self->discriminant, ctx );
   fd_repair_response_inner_decode_unsafe( &self->inner, self->discriminant, ctx );
 }
+fd_repair_response_t * fd_repair_response_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_repair_response_t * self = (fd_repair_response_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_repair_response_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_repair_response_new( self );
+  fd_repair_response_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 void fd_repair_response_inner_new( fd_repair_response_inner_t * self, uint discriminant ) {
   switch( discriminant ) {
   case 0: {
@@ -30580,7 +35402,7 @@ FD_FN_PURE uchar fd_instr_error_enum_is_builtin_programs_must_consume_compute_un
   return self->discriminant == 53;
 }
 void fd_instr_error_enum_inner_new( fd_instr_error_enum_inner_t * self, uint discriminant );
-int fd_instr_error_enum_inner_decode_preflight( uint discriminant, fd_bincode_decode_ctx_t * ctx ) {
+int fd_instr_error_enum_inner_decode_footprint( uint discriminant, fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   switch (discriminant) {
   case 0: {
@@ -30723,6 +35545,7 @@ int fd_instr_error_enum_inner_decode_preflight( uint discriminant, fd_bincode_de
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     err = fd_bincode_bytes_decode_preflight( slen, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 1UL, slen + 1 );
     return FD_BINCODE_SUCCESS;
   }
   case 45: {
@@ -30938,16 +35761,36 @@ int fd_instr_error_enum_decode( fd_instr_error_enum_t * self, fd_bincode_decode_
   fd_instr_error_enum_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_instr_error_enum_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_instr_error_enum_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   uint discriminant = 0;
   int err = fd_bincode_uint32_decode( &discriminant, ctx );
   if( FD_UNLIKELY( err ) ) return err;
-  return fd_instr_error_enum_inner_decode_preflight( discriminant, ctx );
+  return fd_instr_error_enum_inner_decode_footprint( discriminant, ctx, total_sz );
+}
+int fd_instr_error_enum_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_instr_error_enum_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_instr_error_enum_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_instr_error_enum_t);
+  int err = fd_instr_error_enum_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
 }
 void fd_instr_error_enum_decode_unsafe( fd_instr_error_enum_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint32_decode_unsafe( &self->discriminant, ctx );
   fd_instr_error_enum_inner_decode_unsafe( &self->inner, self->discriminant, ctx );
 }
+fd_instr_error_enum_t * fd_instr_error_enum_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_instr_error_enum_t * self = (fd_instr_error_enum_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_instr_error_enum_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_instr_error_enum_new( self );
+  fd_instr_error_enum_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 void fd_instr_error_enum_inner_new( fd_instr_error_enum_inner_t * self, uint discriminant ) {
   switch( discriminant ) {
   case 0: {
@@ -31421,18 +36264,38 @@ int fd_txn_instr_error_decode( fd_txn_instr_error_t * self, fd_bincode_decode_ct
   fd_txn_instr_error_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_txn_instr_error_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_txn_instr_error_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   err = fd_bincode_uint8_decode_preflight( ctx );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_instr_error_enum_decode_preflight( ctx );
+  err = fd_instr_error_enum_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_txn_instr_error_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_txn_instr_error_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_txn_instr_error_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_txn_instr_error_t);
+  int err = fd_txn_instr_error_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_txn_instr_error_decode_unsafe( fd_txn_instr_error_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint8_decode_unsafe( &self->instr_idx, ctx );
   fd_instr_error_enum_decode_unsafe( &self->error, ctx );
 }
+fd_txn_instr_error_t * fd_txn_instr_error_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_txn_instr_error_t * self = (fd_txn_instr_error_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_txn_instr_error_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_txn_instr_error_new( self );
+  fd_txn_instr_error_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_txn_instr_error_encode( fd_txn_instr_error_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint8_encode( (uchar)(self->instr_idx), ctx );
@@ -31443,12 +36306,13 @@ int fd_txn_instr_error_encode( fd_txn_instr_error_t const * self, fd_bincode_enc
 }
 int fd_txn_instr_error_decode_offsets( fd_txn_instr_error_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->instr_idx_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint8_decode_preflight( ctx );
   if( FD_UNLIKELY( err ) ) return err;
   self->error_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_instr_error_enum_decode_preflight( ctx );
+  err = fd_instr_error_enum_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -31588,7 +36452,7 @@ FD_FN_PURE uchar fd_txn_error_enum_is_unbalanced_transaction(fd_txn_error_enum_t
   return self->discriminant == 36;
 }
 void fd_txn_error_enum_inner_new( fd_txn_error_enum_inner_t * self, uint discriminant );
-int fd_txn_error_enum_inner_decode_preflight( uint discriminant, fd_bincode_decode_ctx_t * ctx ) {
+int fd_txn_error_enum_inner_decode_footprint( uint discriminant, fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   switch (discriminant) {
   case 0: {
@@ -31616,7 +36480,7 @@ int fd_txn_error_enum_inner_decode_preflight( uint discriminant, fd_bincode_deco
     return FD_BINCODE_SUCCESS;
   }
   case 8: {
-    err = fd_txn_instr_error_decode_preflight( ctx );
+    err = fd_txn_instr_error_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
@@ -31843,16 +36707,36 @@ int fd_txn_error_enum_decode( fd_txn_error_enum_t * self, fd_bincode_decode_ctx_
   fd_txn_error_enum_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_txn_error_enum_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_txn_error_enum_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   uint discriminant = 0;
   int err = fd_bincode_uint32_decode( &discriminant, ctx );
   if( FD_UNLIKELY( err ) ) return err;
-  return fd_txn_error_enum_inner_decode_preflight( discriminant, ctx );
+  return fd_txn_error_enum_inner_decode_footprint( discriminant, ctx, total_sz );
+}
+int fd_txn_error_enum_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_txn_error_enum_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_txn_error_enum_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_txn_error_enum_t);
+  int err = fd_txn_error_enum_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
 }
 void fd_txn_error_enum_decode_unsafe( fd_txn_error_enum_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint32_decode_unsafe( &self->discriminant, ctx );
   fd_txn_error_enum_inner_decode_unsafe( &self->inner, self->discriminant, ctx );
 }
+fd_txn_error_enum_t * fd_txn_error_enum_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_txn_error_enum_t * self = (fd_txn_error_enum_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_txn_error_enum_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_txn_error_enum_new( self );
+  fd_txn_error_enum_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 void fd_txn_error_enum_inner_new( fd_txn_error_enum_inner_t * self, uint discriminant ) {
   switch( discriminant ) {
   case 0: {
@@ -32224,14 +37108,14 @@ FD_FN_PURE uchar fd_txn_result_is_error(fd_txn_result_t const * self) {
   return self->discriminant == 1;
 }
 void fd_txn_result_inner_new( fd_txn_result_inner_t * self, uint discriminant );
-int fd_txn_result_inner_decode_preflight( uint discriminant, fd_bincode_decode_ctx_t * ctx ) {
+int fd_txn_result_inner_decode_footprint( uint discriminant, fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   switch (discriminant) {
   case 0: {
     return FD_BINCODE_SUCCESS;
   }
   case 1: {
-    err = fd_txn_error_enum_decode_preflight( ctx );
+    err = fd_txn_error_enum_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
     return FD_BINCODE_SUCCESS;
   }
@@ -32260,16 +37144,36 @@ int fd_txn_result_decode( fd_txn_result_t * self, fd_bincode_decode_ctx_t * ctx
   fd_txn_result_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_txn_result_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_txn_result_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   uint discriminant = 0;
   int err = fd_bincode_uint32_decode( &discriminant, ctx );
   if( FD_UNLIKELY( err ) ) return err;
-  return fd_txn_result_inner_decode_preflight( discriminant, ctx );
+  return fd_txn_result_inner_decode_footprint( discriminant, ctx, total_sz );
+}
+int fd_txn_result_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_txn_result_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_txn_result_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_txn_result_t);
+  int err = fd_txn_result_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
 }
 void fd_txn_result_decode_unsafe( fd_txn_result_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint32_decode_unsafe( &self->discriminant, ctx );
   fd_txn_result_inner_decode_unsafe( &self->inner, self->discriminant, ctx );
 }
+fd_txn_result_t * fd_txn_result_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_txn_result_t * self = (fd_txn_result_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_txn_result_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_txn_result_new( self );
+  fd_txn_result_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 void fd_txn_result_inner_new( fd_txn_result_inner_t * self, uint discriminant ) {
   switch( discriminant ) {
   case 0: {
@@ -32361,18 +37265,38 @@ int fd_cache_status_decode( fd_cache_status_t * self, fd_bincode_decode_ctx_t *
   fd_cache_status_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_cache_status_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_cache_status_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   err = fd_bincode_bytes_decode_preflight( 20, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
-  err = fd_txn_result_decode_preflight( ctx );
+  err = fd_txn_result_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_cache_status_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_cache_status_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_cache_status_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_cache_status_t);
+  int err = fd_cache_status_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_cache_status_decode_unsafe( fd_cache_status_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_bytes_decode_unsafe( self->key_slice, 20, ctx );
   fd_txn_result_decode_unsafe( &self->result, ctx );
 }
+fd_cache_status_t * fd_cache_status_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_cache_status_t * self = (fd_cache_status_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_cache_status_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_cache_status_new( self );
+  fd_cache_status_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_cache_status_encode( fd_cache_status_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_bytes_encode( self->key_slice, 20, ctx );
@@ -32383,12 +37307,13 @@ int fd_cache_status_encode( fd_cache_status_t const * self, fd_bincode_encode_ct
 }
 int fd_cache_status_decode_offsets( fd_cache_status_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->key_slice_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_bytes_decode_preflight( 20, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   self->result_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_txn_result_decode_preflight( ctx );
+  err = fd_txn_result_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -32427,7 +37352,7 @@ int fd_status_value_decode( fd_status_value_t * self, fd_bincode_decode_ctx_t *
   fd_status_value_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_status_value_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_status_value_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -32435,13 +37360,25 @@ int fd_status_value_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   err = fd_bincode_uint64_decode( &statuses_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( statuses_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_CACHE_STATUS_ALIGN, FD_CACHE_STATUS_FOOTPRINT*statuses_len );
     for( ulong i=0; i < statuses_len; i++ ) {
-      err = fd_cache_status_decode_preflight( ctx );
+      err = fd_cache_status_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_status_value_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_status_value_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_status_value_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_status_value_t);
+  int err = fd_status_value_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_status_value_decode_unsafe( fd_status_value_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->txn_idx, ctx );
   fd_bincode_uint64_decode_unsafe( &self->statuses_len, ctx );
@@ -32454,6 +37391,15 @@ void fd_status_value_decode_unsafe( fd_status_value_t * self, fd_bincode_decode_
   } else
     self->statuses = NULL;
 }
+fd_status_value_t * fd_status_value_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_status_value_t * self = (fd_status_value_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_status_value_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_status_value_new( self );
+  fd_status_value_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_status_value_encode( fd_status_value_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->txn_idx, ctx );
@@ -32470,6 +37416,7 @@ int fd_status_value_encode( fd_status_value_t const * self, fd_bincode_encode_ct
 }
 int fd_status_value_decode_offsets( fd_status_value_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->txn_idx_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -32479,8 +37426,9 @@ int fd_status_value_decode_offsets( fd_status_value_off_t * self, fd_bincode_dec
   err = fd_bincode_uint64_decode( &statuses_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( statuses_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_CACHE_STATUS_ALIGN, FD_CACHE_STATUS_FOOTPRINT*statuses_len );
     for( ulong i=0; i < statuses_len; i++ ) {
-      err = fd_cache_status_decode_preflight( ctx );
+      err = fd_cache_status_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -32534,18 +37482,38 @@ int fd_status_pair_decode( fd_status_pair_t * self, fd_bincode_decode_ctx_t * ct
   fd_status_pair_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_status_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_status_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_status_value_decode_preflight( ctx );
+  err = fd_status_value_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_status_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_status_pair_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_status_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_status_pair_t);
+  int err = fd_status_pair_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_status_pair_decode_unsafe( fd_status_pair_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_hash_decode_unsafe( &self->hash, ctx );
   fd_status_value_decode_unsafe( &self->value, ctx );
 }
+fd_status_pair_t * fd_status_pair_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_status_pair_t * self = (fd_status_pair_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_status_pair_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_status_pair_new( self );
+  fd_status_pair_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_status_pair_encode( fd_status_pair_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_hash_encode( &self->hash, ctx );
@@ -32556,12 +37524,13 @@ int fd_status_pair_encode( fd_status_pair_t const * self, fd_bincode_encode_ctx_
 }
 int fd_status_pair_decode_offsets( fd_status_pair_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->hash_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_hash_decode_preflight( ctx );
+  err = fd_hash_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->value_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_status_value_decode_preflight( ctx );
+  err = fd_status_value_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -32602,7 +37571,7 @@ int fd_slot_delta_decode( fd_slot_delta_t * self, fd_bincode_decode_ctx_t * ctx
   fd_slot_delta_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_slot_delta_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_slot_delta_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   err = fd_bincode_uint64_decode_preflight( ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
@@ -32612,13 +37581,25 @@ int fd_slot_delta_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   err = fd_bincode_uint64_decode( &slot_delta_vec_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( slot_delta_vec_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_STATUS_PAIR_ALIGN, FD_STATUS_PAIR_FOOTPRINT*slot_delta_vec_len );
     for( ulong i=0; i < slot_delta_vec_len; i++ ) {
-      err = fd_status_pair_decode_preflight( ctx );
+      err = fd_status_pair_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_slot_delta_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_slot_delta_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_slot_delta_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_slot_delta_t);
+  int err = fd_slot_delta_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_slot_delta_decode_unsafe( fd_slot_delta_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->slot, ctx );
   fd_bincode_bool_decode_unsafe( &self->is_root, ctx );
@@ -32632,6 +37613,15 @@ void fd_slot_delta_decode_unsafe( fd_slot_delta_t * self, fd_bincode_decode_ctx_
   } else
     self->slot_delta_vec = NULL;
 }
+fd_slot_delta_t * fd_slot_delta_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_slot_delta_t * self = (fd_slot_delta_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_slot_delta_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_slot_delta_new( self );
+  fd_slot_delta_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_slot_delta_encode( fd_slot_delta_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->slot, ctx );
@@ -32650,6 +37640,7 @@ int fd_slot_delta_encode( fd_slot_delta_t const * self, fd_bincode_encode_ctx_t
 }
 int fd_slot_delta_decode_offsets( fd_slot_delta_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->slot_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -32662,8 +37653,9 @@ int fd_slot_delta_decode_offsets( fd_slot_delta_off_t * self, fd_bincode_decode_
   err = fd_bincode_uint64_decode( &slot_delta_vec_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( slot_delta_vec_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_STATUS_PAIR_ALIGN, FD_STATUS_PAIR_FOOTPRINT*slot_delta_vec_len );
     for( ulong i=0; i < slot_delta_vec_len; i++ ) {
-      err = fd_status_pair_decode_preflight( ctx );
+      err = fd_status_pair_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -32719,19 +37711,31 @@ int fd_bank_slot_deltas_decode( fd_bank_slot_deltas_t * self, fd_bincode_decode_
   fd_bank_slot_deltas_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_bank_slot_deltas_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_bank_slot_deltas_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   ulong slot_deltas_len;
   err = fd_bincode_uint64_decode( &slot_deltas_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( slot_deltas_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_SLOT_DELTA_ALIGN, FD_SLOT_DELTA_FOOTPRINT*slot_deltas_len );
     for( ulong i=0; i < slot_deltas_len; i++ ) {
-      err = fd_slot_delta_decode_preflight( ctx );
+      err = fd_slot_delta_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_bank_slot_deltas_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_bank_slot_deltas_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_bank_slot_deltas_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_bank_slot_deltas_t);
+  int err = fd_bank_slot_deltas_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_bank_slot_deltas_decode_unsafe( fd_bank_slot_deltas_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->slot_deltas_len, ctx );
   if( self->slot_deltas_len ) {
@@ -32743,6 +37747,15 @@ void fd_bank_slot_deltas_decode_unsafe( fd_bank_slot_deltas_t * self, fd_bincode
   } else
     self->slot_deltas = NULL;
 }
+fd_bank_slot_deltas_t * fd_bank_slot_deltas_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_bank_slot_deltas_t * self = (fd_bank_slot_deltas_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_bank_slot_deltas_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_bank_slot_deltas_new( self );
+  fd_bank_slot_deltas_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_bank_slot_deltas_encode( fd_bank_slot_deltas_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->slot_deltas_len, ctx );
@@ -32757,14 +37770,16 @@ int fd_bank_slot_deltas_encode( fd_bank_slot_deltas_t const * self, fd_bincode_e
 }
 int fd_bank_slot_deltas_decode_offsets( fd_bank_slot_deltas_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->slot_deltas_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong slot_deltas_len;
   err = fd_bincode_uint64_decode( &slot_deltas_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( slot_deltas_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_SLOT_DELTA_ALIGN, FD_SLOT_DELTA_FOOTPRINT*slot_deltas_len );
     for( ulong i=0; i < slot_deltas_len; i++ ) {
-      err = fd_slot_delta_decode_preflight( ctx );
+      err = fd_slot_delta_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -32816,18 +37831,38 @@ int fd_pubkey_rewardinfo_pair_decode( fd_pubkey_rewardinfo_pair_t * self, fd_bin
   fd_pubkey_rewardinfo_pair_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_pubkey_rewardinfo_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_pubkey_rewardinfo_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_reward_info_decode_preflight( ctx );
+  err = fd_reward_info_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_pubkey_rewardinfo_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_pubkey_rewardinfo_pair_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_pubkey_rewardinfo_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_pubkey_rewardinfo_pair_t);
+  int err = fd_pubkey_rewardinfo_pair_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_pubkey_rewardinfo_pair_decode_unsafe( fd_pubkey_rewardinfo_pair_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->pubkey, ctx );
   fd_reward_info_decode_unsafe( &self->reward_info, ctx );
 }
+fd_pubkey_rewardinfo_pair_t * fd_pubkey_rewardinfo_pair_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_pubkey_rewardinfo_pair_t * self = (fd_pubkey_rewardinfo_pair_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_pubkey_rewardinfo_pair_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_pubkey_rewardinfo_pair_new( self );
+  fd_pubkey_rewardinfo_pair_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_pubkey_rewardinfo_pair_encode( fd_pubkey_rewardinfo_pair_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->pubkey, ctx );
@@ -32838,12 +37873,13 @@ int fd_pubkey_rewardinfo_pair_encode( fd_pubkey_rewardinfo_pair_t const * self,
 }
 int fd_pubkey_rewardinfo_pair_decode_offsets( fd_pubkey_rewardinfo_pair_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->pubkey_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->reward_info_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_reward_info_decode_preflight( ctx );
+  err = fd_reward_info_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -32884,19 +37920,31 @@ int fd_optional_account_decode( fd_optional_account_t * self, fd_bincode_decode_
   fd_optional_account_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_optional_account_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_optional_account_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   {
     uchar o;
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
-      err = fd_solana_account_decode_preflight( ctx );
+      *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_SOLANA_ACCOUNT_ALIGN, FD_SOLANA_ACCOUNT_FOOTPRINT );
+      err = fd_solana_account_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_optional_account_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_optional_account_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_optional_account_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_optional_account_t);
+  int err = fd_optional_account_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_optional_account_decode_unsafe( fd_optional_account_t * self, fd_bincode_decode_ctx_t * ctx ) {
   {
     uchar o;
@@ -32909,6 +37957,15 @@ void fd_optional_account_decode_unsafe( fd_optional_account_t * self, fd_bincode
       self->account = NULL;
   }
 }
+fd_optional_account_t * fd_optional_account_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_optional_account_t * self = (fd_optional_account_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_optional_account_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_optional_account_new( self );
+  fd_optional_account_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_optional_account_encode( fd_optional_account_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   if( self->account != NULL ) {
@@ -32924,6 +37981,7 @@ int fd_optional_account_encode( fd_optional_account_t const * self, fd_bincode_e
 }
 int fd_optional_account_decode_offsets( fd_optional_account_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->account_off = (uint)( (ulong)ctx->data - (ulong)data );
   {
@@ -32931,7 +37989,8 @@ int fd_optional_account_decode_offsets( fd_optional_account_off_t * self, fd_bin
     err = fd_bincode_bool_decode( &o, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     if( o ) {
-      err = fd_solana_account_decode_preflight( ctx );
+      *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_SOLANA_ACCOUNT_ALIGN, FD_SOLANA_ACCOUNT_FOOTPRINT );
+      err = fd_solana_account_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -32980,14 +38039,34 @@ int fd_calculated_stake_points_decode( fd_calculated_stake_points_t * self, fd_b
   fd_calculated_stake_points_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_calculated_stake_points_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_calculated_stake_points_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 25, ctx );
 }
+int fd_calculated_stake_points_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_calculated_stake_points_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_calculated_stake_points_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_calculated_stake_points_t);
+  int err = fd_calculated_stake_points_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_calculated_stake_points_decode_unsafe( fd_calculated_stake_points_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint128_decode_unsafe( &self->points, ctx );
   fd_bincode_uint64_decode_unsafe( &self->new_credits_observed, ctx );
   fd_bincode_uint8_decode_unsafe( &self->force_credits_update_with_skipped_reward, ctx );
 }
+fd_calculated_stake_points_t * fd_calculated_stake_points_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_calculated_stake_points_t * self = (fd_calculated_stake_points_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_calculated_stake_points_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_calculated_stake_points_new( self );
+  fd_calculated_stake_points_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_calculated_stake_points_encode( fd_calculated_stake_points_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint128_encode( self->points, ctx );
@@ -33000,6 +38079,7 @@ int fd_calculated_stake_points_encode( fd_calculated_stake_points_t const * self
 }
 int fd_calculated_stake_points_decode_offsets( fd_calculated_stake_points_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->points_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint128_decode_preflight( ctx );
@@ -33047,14 +38127,34 @@ int fd_calculated_stake_rewards_decode( fd_calculated_stake_rewards_t * self, fd
   fd_calculated_stake_rewards_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_calculated_stake_rewards_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_calculated_stake_rewards_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 24, ctx );
 }
+int fd_calculated_stake_rewards_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_calculated_stake_rewards_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_calculated_stake_rewards_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_calculated_stake_rewards_t);
+  int err = fd_calculated_stake_rewards_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_calculated_stake_rewards_decode_unsafe( fd_calculated_stake_rewards_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->staker_rewards, ctx );
   fd_bincode_uint64_decode_unsafe( &self->voter_rewards, ctx );
   fd_bincode_uint64_decode_unsafe( &self->new_credits_observed, ctx );
 }
+fd_calculated_stake_rewards_t * fd_calculated_stake_rewards_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_calculated_stake_rewards_t * self = (fd_calculated_stake_rewards_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_calculated_stake_rewards_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_calculated_stake_rewards_new( self );
+  fd_calculated_stake_rewards_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_calculated_stake_rewards_encode( fd_calculated_stake_rewards_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->staker_rewards, ctx );
@@ -33067,6 +38167,7 @@ int fd_calculated_stake_rewards_encode( fd_calculated_stake_rewards_t const * se
 }
 int fd_calculated_stake_rewards_decode_offsets( fd_calculated_stake_rewards_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->staker_rewards_off = (uint)( (ulong)ctx->data - (ulong)data );
   err = fd_bincode_uint64_decode_preflight( ctx );
@@ -33087,6 +38188,7 @@ void fd_calculated_stake_rewards_destroy( fd_calculated_stake_rewards_t * self,
 
 ulong fd_calculated_stake_rewards_footprint( void ){ return FD_CALCULATED_STAKE_REWARDS_FOOTPRINT; }
 ulong fd_calculated_stake_rewards_align( void ){ return FD_CALCULATED_STAKE_REWARDS_ALIGN; }
+FD_STATIC_ASSERT( sizeof(fd_calculated_stake_rewards_t)==24UL, fd_calculated_stake_rewards_view );
 
 void fd_calculated_stake_rewards_walk( void * w, fd_calculated_stake_rewards_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_calculated_stake_rewards", level++ );
@@ -33114,12 +38216,13 @@ int fd_duplicate_slot_proof_decode( fd_duplicate_slot_proof_t * self, fd_bincode
   fd_duplicate_slot_proof_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_duplicate_slot_proof_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_duplicate_slot_proof_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   ulong shred1_len;
   err = fd_bincode_uint64_decode( &shred1_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( shred1_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, shred1_len );
     err = fd_bincode_bytes_decode_preflight( shred1_len, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   }
@@ -33127,11 +38230,23 @@ int fd_duplicate_slot_proof_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   err = fd_bincode_uint64_decode( &shred2_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( shred2_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, shred2_len );
     err = fd_bincode_bytes_decode_preflight( shred2_len, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_duplicate_slot_proof_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_duplicate_slot_proof_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_duplicate_slot_proof_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_duplicate_slot_proof_t);
+  int err = fd_duplicate_slot_proof_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_duplicate_slot_proof_decode_unsafe( fd_duplicate_slot_proof_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->shred1_len, ctx );
   if( self->shred1_len ) {
@@ -33146,6 +38261,15 @@ void fd_duplicate_slot_proof_decode_unsafe( fd_duplicate_slot_proof_t * self, fd
   } else
     self->shred2 = NULL;
 }
+fd_duplicate_slot_proof_t * fd_duplicate_slot_proof_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_duplicate_slot_proof_t * self = (fd_duplicate_slot_proof_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_duplicate_slot_proof_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_duplicate_slot_proof_new( self );
+  fd_duplicate_slot_proof_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_duplicate_slot_proof_encode( fd_duplicate_slot_proof_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->shred1_len, ctx );
@@ -33164,12 +38288,14 @@ int fd_duplicate_slot_proof_encode( fd_duplicate_slot_proof_t const * self, fd_b
 }
 int fd_duplicate_slot_proof_decode_offsets( fd_duplicate_slot_proof_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->shred1_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong shred1_len;
   err = fd_bincode_uint64_decode( &shred1_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( shred1_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, shred1_len );
     err = fd_bincode_bytes_decode_preflight( shred1_len, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   }
@@ -33178,6 +38304,7 @@ int fd_duplicate_slot_proof_decode_offsets( fd_duplicate_slot_proof_off_t * self
   err = fd_bincode_uint64_decode( &shred2_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( shred2_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, 8UL, shred2_len );
     err = fd_bincode_bytes_decode_preflight( shred2_len, ctx );
     if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   }
@@ -33230,13 +38357,33 @@ int fd_epoch_info_pair_decode( fd_epoch_info_pair_t * self, fd_bincode_decode_ct
   fd_epoch_info_pair_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_epoch_info_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_epoch_info_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   return fd_bincode_bytes_decode_preflight( 104, ctx );
 }
+int fd_epoch_info_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_epoch_info_pair_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_epoch_info_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_epoch_info_pair_t);
+  int err = fd_epoch_info_pair_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_epoch_info_pair_decode_unsafe( fd_epoch_info_pair_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->account, ctx );
   fd_stake_decode_unsafe( &self->stake, ctx );
 }
+fd_epoch_info_pair_t * fd_epoch_info_pair_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_epoch_info_pair_t * self = (fd_epoch_info_pair_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_epoch_info_pair_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_epoch_info_pair_new( self );
+  fd_epoch_info_pair_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_epoch_info_pair_encode( fd_epoch_info_pair_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->account, ctx );
@@ -33247,12 +38394,13 @@ int fd_epoch_info_pair_encode( fd_epoch_info_pair_t const * self, fd_bincode_enc
 }
 int fd_epoch_info_pair_decode_offsets( fd_epoch_info_pair_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->account_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->stake_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_stake_decode_preflight( ctx );
+  err = fd_stake_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -33268,6 +38416,7 @@ void fd_epoch_info_pair_destroy( fd_epoch_info_pair_t * self, fd_bincode_destroy
 
 ulong fd_epoch_info_pair_footprint( void ){ return FD_EPOCH_INFO_PAIR_FOOTPRINT; }
 ulong fd_epoch_info_pair_align( void ){ return FD_EPOCH_INFO_PAIR_ALIGN; }
+FD_STATIC_ASSERT( sizeof(fd_epoch_info_pair_t)==104UL, fd_epoch_info_pair_view );
 
 void fd_epoch_info_pair_walk( void * w, fd_epoch_info_pair_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {
   fun( w, self, name, FD_FLAMENCO_TYPE_MAP, "fd_epoch_info_pair", level++ );
@@ -33293,18 +38442,38 @@ int fd_vote_info_pair_decode( fd_vote_info_pair_t * self, fd_bincode_decode_ctx_
   fd_vote_info_pair_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_vote_info_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_vote_info_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
-  err = fd_vote_state_versioned_decode_preflight( ctx );
+  err = fd_vote_state_versioned_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
+int fd_vote_info_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_vote_info_pair_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_vote_info_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_vote_info_pair_t);
+  int err = fd_vote_info_pair_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_vote_info_pair_decode_unsafe( fd_vote_info_pair_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_pubkey_decode_unsafe( &self->account, ctx );
   fd_vote_state_versioned_decode_unsafe( &self->state, ctx );
 }
+fd_vote_info_pair_t * fd_vote_info_pair_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_vote_info_pair_t * self = (fd_vote_info_pair_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_vote_info_pair_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_vote_info_pair_new( self );
+  fd_vote_info_pair_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_vote_info_pair_encode( fd_vote_info_pair_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_pubkey_encode( &self->account, ctx );
@@ -33315,12 +38484,13 @@ int fd_vote_info_pair_encode( fd_vote_info_pair_t const * self, fd_bincode_encod
 }
 int fd_vote_info_pair_decode_offsets( fd_vote_info_pair_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->account_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_pubkey_decode_preflight( ctx );
+  err = fd_pubkey_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   self->state_off = (uint)( (ulong)ctx->data - (ulong)data );
-  err = fd_vote_state_versioned_decode_preflight( ctx );
+  err = fd_vote_state_versioned_decode_footprint_inner( ctx, total_sz );
   if( FD_UNLIKELY( err ) ) return err;
   return FD_BINCODE_SUCCESS;
 }
@@ -33361,26 +38531,39 @@ int fd_epoch_info_decode( fd_epoch_info_t * self, fd_bincode_decode_ctx_t * ctx
   fd_epoch_info_decode_unsafe( self, ctx );
   return FD_BINCODE_SUCCESS;
 }
-int fd_epoch_info_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+int fd_epoch_info_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   int err;
   ulong stake_infos_len;
   err = fd_bincode_uint64_decode( &stake_infos_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( stake_infos_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_EPOCH_INFO_PAIR_ALIGN, FD_EPOCH_INFO_PAIR_FOOTPRINT*stake_infos_len );
     for( ulong i=0; i < stake_infos_len; i++ ) {
-      err = fd_epoch_info_pair_decode_preflight( ctx );
+      err = fd_epoch_info_pair_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
   ulong vote_states_len;
   err = fd_bincode_uint64_decode( &vote_states_len, ctx );
   if( FD_UNLIKELY( err ) ) return err;
+  *total_sz = fd_bincode_footprint_alloc( *total_sz, fd_vote_info_pair_t_map_align(), fd_vote_info_pair_t_map_footprint( fd_ulong_max( vote_states_len, 1UL ) ) );
   for( ulong i=0; i < vote_states_len; i++ ) {
-    err = fd_vote_info_pair_decode_preflight( ctx );
+    err = fd_vote_info_pair_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
   }
   return FD_BINCODE_SUCCESS;
 }
+int fd_epoch_info_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_epoch_info_decode_footprint_inner( ctx, &total_sz );
+}
+int fd_epoch_info_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_epoch_info_t);
+  int err = fd_epoch_info_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
 void fd_epoch_info_decode_unsafe( fd_epoch_info_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->stake_infos_len, ctx );
   if( self->stake_infos_len ) {
@@ -33404,6 +38587,15 @@ void fd_epoch_info_decode_unsafe( fd_epoch_info_t * self, fd_bincode_decode_ctx_
     fd_vote_info_pair_t_map_insert( self->vote_states_pool, &self->vote_states_root, node );
   }
 }
+fd_epoch_info_t * fd_epoch_info_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_epoch_info_t * self = (fd_epoch_info_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_epoch_info_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_epoch_info_new( self );
+  fd_epoch_info_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
 int fd_epoch_info_encode( fd_epoch_info_t const * self, fd_bincode_encode_ctx_t * ctx ) {
   int err;
   err = fd_bincode_uint64_encode( self->stake_infos_len, ctx );
@@ -33431,14 +38623,16 @@ int fd_epoch_info_encode( fd_epoch_info_t const * self, fd_bincode_encode_ctx_t
 }
 int fd_epoch_info_decode_offsets( fd_epoch_info_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   uchar const * data = ctx->data;
+  ulong total_sz[1] = { 0UL };
   int err;
   self->stake_infos_off = (uint)( (ulong)ctx->data - (ulong)data );
   ulong stake_infos_len;
   err = fd_bincode_uint64_decode( &stake_infos_len, ctx );
   if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
   if( stake_infos_len ) {
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, FD_EPOCH_INFO_PAIR_ALIGN, FD_EPOCH_INFO_PAIR_FOOTPRINT*stake_infos_len );
     for( ulong i=0; i < stake_infos_len; i++ ) {
-      err = fd_epoch_info_pair_decode_preflight( ctx );
+      err = fd_epoch_info_pair_decode_footprint_inner( ctx, total_sz );
       if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;
     }
   }
@@ -33446,8 +38640,9 @@ int fd_epoch_info_decode_offsets( fd_epoch_info_off_t * self, fd_bincode_decode_
   ulong vote_states_len;
   err = fd_bincode_uint64_decode( &vote_states_len, ctx );
   if( FD_UNLIKELY( err ) ) return err;
+  *total_sz = fd_bincode_footprint_alloc( *total_sz, fd_vote_info_pair_t_map_align(), fd_vote_info_pair_t_map_footprint( fd_ulong_max( vote_states_len, 1UL ) ) );
   for( ulong i=0; i < vote_states_len; i++ ) {
-    err = fd_vote_info_pair_decode_preflight( ctx );
+    err = fd_vote_info_pair_decode_footprint_inner( ctx, total_sz );
     if( FD_UNLIKELY( err ) ) return err;
   }
   return FD_BINCODE_SUCCESS;
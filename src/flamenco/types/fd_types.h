@@ -5178,6 +5178,9 @@ void fd_hash_new( fd_hash_t * self );
 int fd_hash_decode( fd_hash_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_hash_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_hash_decode_unsafe( fd_hash_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_hash_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_hash_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_hash_t * fd_hash_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_hash_encode( fd_hash_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_hash_destroy( fd_hash_t * self, fd_bincode_destroy_ctx_t * ctx );
 void fd_hash_walk( void * w, fd_hash_t const * self, fd_types_walk_fn_t fun, const char * name, uint level );
@@ -5189,6 +5192,9 @@ void fd_signature_new( fd_signature_t * self );
 int fd_signature_decode( fd_signature_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_signature_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_signature_decode_unsafe( fd_signature_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_signature_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_signature_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_signature_t * fd_signature_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_signature_encode( fd_signature_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_signature_destroy( fd_signature_t * self, fd_bincode_destroy_ctx_t * ctx );
 void fd_signature_walk( void * w, fd_signature_t const * self, fd_types_walk_fn_t fun, const char * name, uint level );
@@ -5200,6 +5206,9 @@ void fd_gossip_ip4_addr_new( fd_gossip_ip4_addr_t * self );
 int fd_gossip_ip4_addr_decode( fd_gossip_ip4_addr_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_ip4_addr_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_ip4_addr_decode_unsafe( fd_gossip_ip4_addr_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_gossip_ip4_addr_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_ip4_addr_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_gossip_ip4_addr_t * fd_gossip_ip4_addr_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_ip4_addr_encode( fd_gossip_ip4_addr_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_gossip_ip4_addr_destroy( fd_gossip_ip4_addr_t * self, fd_bincode_destroy_ctx_t * ctx );
 void fd_gossip_ip4_addr_walk( void * w, fd_gossip_ip4_addr_t const * self, fd_types_walk_fn_t fun, const char * name, uint level );
@@ -5211,6 +5220,9 @@ void fd_gossip_ip6_addr_new( fd_gossip_ip6_addr_t * self );
 int fd_gossip_ip6_addr_decode( fd_gossip_ip6_addr_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_ip6_addr_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_ip6_addr_decode_unsafe( fd_gossip_ip6_addr_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_gossip_ip6_addr_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_ip6_addr_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_gossip_ip6_addr_t * fd_gossip_ip6_addr_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_ip6_addr_encode( fd_gossip_ip6_addr_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_gossip_ip6_addr_destroy( fd_gossip_ip6_addr_t * self, fd_bincode_destroy_ctx_t * ctx );
 void fd_gossip_ip6_addr_walk( void * w, fd_gossip_ip6_addr_t const * self, fd_types_walk_fn_t fun, const char * name, uint level );
@@ -5222,6 +5234,9 @@ void fd_feature_new( fd_feature_t * self );
 int fd_feature_decode( fd_feature_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_feature_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_feature_decode_unsafe( fd_feature_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_feature_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_feature_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_feature_t * fd_feature_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_feature_decode_offsets( fd_feature_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_feature_encode( fd_feature_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_feature_destroy( fd_feature_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5234,6 +5249,9 @@ void fd_fee_calculator_new( fd_fee_calculator_t * self );
 int fd_fee_calculator_decode( fd_fee_calculator_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_fee_calculator_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_fee_calculator_decode_unsafe( fd_fee_calculator_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_fee_calculator_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_fee_calculator_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_fee_calculator_t * fd_fee_calculator_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_fee_calculator_decode_offsets( fd_fee_calculator_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_fee_calculator_encode( fd_fee_calculator_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_fee_calculator_destroy( fd_fee_calculator_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5245,11 +5263,21 @@ int fd_fee_calculator_decode_archival( fd_fee_calculator_t * self, fd_bincode_de
 int fd_fee_calculator_decode_archival_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_fee_calculator_decode_archival_unsafe( fd_fee_calculator_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_fee_calculator_encode_archival( fd_fee_calculator_t const * self, fd_bincode_encode_ctx_t * ctx );
+/* fd_fee_calculator_view returns a zero-copy view of the fd_fee_calculator_t encoded at
+   data (whose bincode encoding matches its in-memory layout).
+   Returns NULL if data_sz is too small or data is misaligned. */
+static inline fd_fee_calculator_t const * fd_fee_calculator_view( void const * data, ulong data_sz ) {
+  if( FD_UNLIKELY( data_sz<8UL || !fd_ulong_is_aligned( (ulong)data, alignof(fd_fee_calculator_t) ) ) ) return NULL;
+  return (fd_fee_calculator_t const *)data;
+}
 
 void fd_hash_age_new( fd_hash_age_t * self );
 int fd_hash_age_decode( fd_hash_age_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_hash_age_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_hash_age_decode_unsafe( fd_hash_age_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_hash_age_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_hash_age_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_hash_age_t * fd_hash_age_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_hash_age_decode_offsets( fd_hash_age_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_hash_age_encode( fd_hash_age_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_hash_age_destroy( fd_hash_age_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5261,11 +5289,21 @@ int fd_hash_age_decode_archival( fd_hash_age_t * self, fd_bincode_decode_ctx_t *
 int fd_hash_age_decode_archival_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_hash_age_decode_archival_unsafe( fd_hash_age_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_hash_age_encode_archival( fd_hash_age_t const * self, fd_bincode_encode_ctx_t * ctx );
+/* fd_hash_age_view returns a zero-copy view of the fd_hash_age_t encoded at
+   data (whose bincode encoding matches its in-memory layout).
+   Returns NULL if data_sz is too small or data is misaligned. */
+static inline fd_hash_age_t const * fd_hash_age_view( void const * data, ulong data_sz ) {
+  if( FD_UNLIKELY( data_sz<24UL || !fd_ulong_is_aligned( (ulong)data, alignof(fd_hash_age_t) ) ) ) return NULL;
+  return (fd_hash_age_t const *)data;
+}
 
 void fd_hash_hash_age_pair_new( fd_hash_hash_age_pair_t * self );
 int fd_hash_hash_age_pair_decode( fd_hash_hash_age_pair_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_hash_hash_age_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_hash_hash_age_pair_decode_unsafe( fd_hash_hash_age_pair_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_hash_hash_age_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_hash_hash_age_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_hash_hash_age_pair_t * fd_hash_hash_age_pair_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_hash_hash_age_pair_decode_offsets( fd_hash_hash_age_pair_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_hash_hash_age_pair_encode( fd_hash_hash_age_pair_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_hash_hash_age_pair_destroy( fd_hash_hash_age_pair_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5277,11 +5315,21 @@ int fd_hash_hash_age_pair_decode_archival( fd_hash_hash_age_pair_t * self, fd_bi
 int fd_hash_hash_age_pair_decode_archival_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_hash_hash_age_pair_decode_archival_unsafe( fd_hash_hash_age_pair_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_hash_hash_age_pair_encode_archival( fd_hash_hash_age_pair_t const * self, fd_bincode_encode_ctx_t * ctx );
+/* fd_hash_hash_age_pair_view returns a zero-copy view of the fd_hash_hash_age_pair_t encoded at
+   data (whose bincode encoding matches its in-memory layout).
+   Returns NULL if data_sz is too small or data is misaligned. */
+static inline fd_hash_hash_age_pair_t const * fd_hash_hash_age_pair_view( void const * data, ulong data_sz ) {
+  if( FD_UNLIKELY( data_sz<56UL || !fd_ulong_is_aligned( (ulong)data, alignof(fd_hash_hash_age_pair_t) ) ) ) return NULL;
+  return (fd_hash_hash_age_pair_t const *)data;
+}
 
 void fd_block_hash_vec_new( fd_block_hash_vec_t * self );
 int fd_block_hash_vec_decode( fd_block_hash_vec_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_block_hash_vec_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_block_hash_vec_decode_unsafe( fd_block_hash_vec_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_block_hash_vec_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_block_hash_vec_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_block_hash_vec_t * fd_block_hash_vec_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_block_hash_vec_decode_offsets( fd_block_hash_vec_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_block_hash_vec_encode( fd_block_hash_vec_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_block_hash_vec_destroy( fd_block_hash_vec_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5294,6 +5342,9 @@ void fd_block_hash_queue_new( fd_block_hash_queue_t * self );
 int fd_block_hash_queue_decode( fd_block_hash_queue_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_block_hash_queue_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_block_hash_queue_decode_unsafe( fd_block_hash_queue_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_block_hash_queue_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_block_hash_queue_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_block_hash_queue_t * fd_block_hash_queue_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_block_hash_queue_decode_offsets( fd_block_hash_queue_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_block_hash_queue_encode( fd_block_hash_queue_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_block_hash_queue_destroy( fd_block_hash_queue_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5310,6 +5361,9 @@ void fd_fee_rate_governor_new( fd_fee_rate_governor_t * self );
 int fd_fee_rate_governor_decode( fd_fee_rate_governor_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_fee_rate_governor_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_fee_rate_governor_decode_unsafe( fd_fee_rate_governor_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_fee_rate_governor_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_fee_rate_governor_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_fee_rate_governor_t * fd_fee_rate_governor_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_fee_rate_governor_decode_offsets( fd_fee_rate_governor_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_fee_rate_governor_encode( fd_fee_rate_governor_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_fee_rate_governor_destroy( fd_fee_rate_governor_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5326,6 +5380,9 @@ void fd_slot_pair_new( fd_slot_pair_t * self );
 int fd_slot_pair_decode( fd_slot_pair_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_slot_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_slot_pair_decode_unsafe( fd_slot_pair_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_slot_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_slot_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_slot_pair_t * fd_slot_pair_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_slot_pair_decode_offsets( fd_slot_pair_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_slot_pair_encode( fd_slot_pair_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_slot_pair_destroy( fd_slot_pair_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5337,11 +5394,21 @@ int fd_slot_pair_decode_archival( fd_slot_pair_t * self, fd_bincode_decode_ctx_t
 int fd_slot_pair_decode_archival_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_slot_pair_decode_archival_unsafe( fd_slot_pair_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_slot_pair_encode_archival( fd_slot_pair_t const * self, fd_bincode_encode_ctx_t * ctx );
+/* fd_slot_pair_view returns a zero-copy view of the fd_slot_pair_t encoded at
+   data (whose bincode encoding matches its in-memory layout).
+   Returns NULL if data_sz is too small or data is misaligned. */
+static inline fd_slot_pair_t const * fd_slot_pair_view( void const * data, ulong data_sz ) {
+  if( FD_UNLIKELY( data_sz<16UL || !fd_ulong_is_aligned( (ulong)data, alignof(fd_slot_pair_t) ) ) ) return NULL;
+  return (fd_slot_pair_t const *)data;
+}
 
 void fd_hard_forks_new( fd_hard_forks_t * self );
 int fd_hard_forks_decode( fd_hard_forks_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_hard_forks_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_hard_forks_decode_unsafe( fd_hard_forks_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_hard_forks_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_hard_forks_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_hard_forks_t * fd_hard_forks_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_hard_forks_decode_offsets( fd_hard_forks_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_hard_forks_encode( fd_hard_forks_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_hard_forks_destroy( fd_hard_forks_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5358,6 +5425,9 @@ void fd_inflation_new( fd_inflation_t * self );
 int fd_inflation_decode( fd_inflation_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_inflation_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_inflation_decode_unsafe( fd_inflation_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_inflation_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_inflation_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_inflation_t * fd_inflation_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_inflation_decode_offsets( fd_inflation_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_inflation_encode( fd_inflation_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_inflation_destroy( fd_inflation_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5369,11 +5439,21 @@ int fd_inflation_decode_archival( fd_inflation_t * self, fd_bincode_decode_ctx_t
 int fd_inflation_decode_archival_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_inflation_decode_archival_unsafe( fd_inflation_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_inflation_encode_archival( fd_inflation_t const * self, fd_bincode_encode_ctx_t * ctx );
+/* fd_inflation_view returns a zero-copy view of the fd_inflation_t encoded at
+   data (whose bincode encoding matches its in-memory layout).
+   Returns NULL if data_sz is too small or data is misaligned. */
+static inline fd_inflation_t const * fd_inflation_view( void const * data, ulong data_sz ) {
+  if( FD_UNLIKELY( data_sz<48UL || !fd_ulong_is_aligned( (ulong)data, alignof(fd_inflation_t) ) ) ) return NULL;
+  return (fd_inflation_t const *)data;
+}
 
 void fd_rent_new( fd_rent_t * self );
 int fd_rent_decode( fd_rent_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_rent_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_rent_decode_unsafe( fd_rent_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_rent_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_rent_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_rent_t * fd_rent_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_rent_decode_offsets( fd_rent_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_rent_encode( fd_rent_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_rent_destroy( fd_rent_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5390,6 +5470,9 @@ void fd_epoch_schedule_new( fd_epoch_schedule_t * self );
 int fd_epoch_schedule_decode( fd_epoch_schedule_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_epoch_schedule_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_epoch_schedule_decode_unsafe( fd_epoch_schedule_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_epoch_schedule_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_epoch_schedule_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_epoch_schedule_t * fd_epoch_schedule_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_epoch_schedule_decode_offsets( fd_epoch_schedule_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_epoch_schedule_encode( fd_epoch_schedule_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_epoch_schedule_destroy( fd_epoch_schedule_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5406,6 +5489,9 @@ void fd_rent_collector_new( fd_rent_collector_t * self );
 int fd_rent_collector_decode( fd_rent_collector_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_rent_collector_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_rent_collector_decode_unsafe( fd_rent_collector_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_rent_collector_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_rent_collector_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_rent_collector_t * fd_rent_collector_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_rent_collector_decode_offsets( fd_rent_collector_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_rent_collector_encode( fd_rent_collector_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_rent_collector_destroy( fd_rent_collector_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5418,6 +5504,9 @@ void fd_stake_history_entry_new( fd_stake_history_entry_t * self );
 int fd_stake_history_entry_decode( fd_stake_history_entry_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_history_entry_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_stake_history_entry_decode_unsafe( fd_stake_history_entry_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_stake_history_entry_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_stake_history_entry_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_stake_history_entry_t * fd_stake_history_entry_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_history_entry_decode_offsets( fd_stake_history_entry_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_history_entry_encode( fd_stake_history_entry_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_stake_history_entry_destroy( fd_stake_history_entry_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5429,11 +5518,21 @@ int fd_stake_history_entry_decode_archival( fd_stake_history_entry_t * self, fd_
 int fd_stake_history_entry_decode_archival_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_stake_history_entry_decode_archival_unsafe( fd_stake_history_entry_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_history_entry_encode_archival( fd_stake_history_entry_t const * self, fd_bincode_encode_ctx_t * ctx );
+/* fd_stake_history_entry_view returns a zero-copy view of the fd_stake_history_entry_t encoded at
+   data (whose bincode encoding matches its in-memory layout).
+   Returns NULL if data_sz is too small or data is misaligned. */
+static inline fd_stake_history_entry_t const * fd_stake_history_entry_view( void const * data, ulong data_sz ) {
+  if( FD_UNLIKELY( data_sz<32UL || !fd_ulong_is_aligned( (ulong)data, alignof(fd_stake_history_entry_t) ) ) ) return NULL;
+  return (fd_stake_history_entry_t const *)data;
+}
 
 void fd_stake_history_new( fd_stake_history_t * self );
 int fd_stake_history_decode( fd_stake_history_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_history_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_stake_history_decode_unsafe( fd_stake_history_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_stake_history_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_stake_history_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_stake_history_t * fd_stake_history_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_history_decode_offsets( fd_stake_history_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_history_encode( fd_stake_history_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_stake_history_destroy( fd_stake_history_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5450,6 +5549,9 @@ void fd_solana_account_new( fd_solana_account_t * self );
 int fd_solana_account_decode( fd_solana_account_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_solana_account_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_solana_account_decode_unsafe( fd_solana_account_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_solana_account_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_solana_account_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_solana_account_t * fd_solana_account_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_solana_account_decode_offsets( fd_solana_account_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_solana_account_encode( fd_solana_account_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_solana_account_destroy( fd_solana_account_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5462,6 +5564,9 @@ void fd_vote_accounts_pair_new( fd_vote_accounts_pair_t * self );
 int fd_vote_accounts_pair_decode( fd_vote_accounts_pair_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_accounts_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_vote_accounts_pair_decode_unsafe( fd_vote_accounts_pair_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_vote_accounts_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_accounts_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_vote_accounts_pair_t * fd_vote_accounts_pair_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_accounts_pair_decode_offsets( fd_vote_accounts_pair_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_accounts_pair_encode( fd_vote_accounts_pair_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_vote_accounts_pair_destroy( fd_vote_accounts_pair_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5478,6 +5583,9 @@ void fd_vote_accounts_pair_serializable_new( fd_vote_accounts_pair_serializable_
 int fd_vote_accounts_pair_serializable_decode( fd_vote_accounts_pair_serializable_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_accounts_pair_serializable_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_vote_accounts_pair_serializable_decode_unsafe( fd_vote_accounts_pair_serializable_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_vote_accounts_pair_serializable_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_accounts_pair_serializable_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_vote_accounts_pair_serializable_t * fd_vote_accounts_pair_serializable_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_accounts_pair_serializable_decode_offsets( fd_vote_accounts_pair_serializable_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_accounts_pair_serializable_encode( fd_vote_accounts_pair_serializable_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_vote_accounts_pair_serializable_destroy( fd_vote_accounts_pair_serializable_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5490,6 +5598,9 @@ void fd_vote_accounts_serializable_new( fd_vote_accounts_serializable_t * self )
 int fd_vote_accounts_serializable_decode( fd_vote_accounts_serializable_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_accounts_serializable_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_vote_accounts_serializable_decode_unsafe( fd_vote_accounts_serializable_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_vote_accounts_serializable_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_accounts_serializable_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_vote_accounts_serializable_t * fd_vote_accounts_serializable_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_accounts_serializable_decode_offsets( fd_vote_accounts_serializable_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_accounts_serializable_encode( fd_vote_accounts_serializable_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_vote_accounts_serializable_destroy( fd_vote_accounts_serializable_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5502,6 +5613,9 @@ void fd_vote_accounts_new( fd_vote_accounts_t * self );
 int fd_vote_accounts_decode( fd_vote_accounts_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_accounts_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_vote_accounts_decode_unsafe( fd_vote_accounts_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_vote_accounts_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_accounts_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_vote_accounts_t * fd_vote_accounts_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_accounts_decode_offsets( fd_vote_accounts_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_accounts_encode( fd_vote_accounts_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_vote_accounts_destroy( fd_vote_accounts_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5518,6 +5632,9 @@ void fd_account_keys_pair_new( fd_account_keys_pair_t * self );
 int fd_account_keys_pair_decode( fd_account_keys_pair_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_account_keys_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_account_keys_pair_decode_unsafe( fd_account_keys_pair_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_account_keys_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_account_keys_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_account_keys_pair_t * fd_account_keys_pair_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_account_keys_pair_decode_offsets( fd_account_keys_pair_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_account_keys_pair_encode( fd_account_keys_pair_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_account_keys_pair_destroy( fd_account_keys_pair_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5534,6 +5651,9 @@ void fd_account_keys_new( fd_account_keys_t * self );
 int fd_account_keys_decode( fd_account_keys_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_account_keys_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_account_keys_decode_unsafe( fd_account_keys_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_account_keys_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_account_keys_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_account_keys_t * fd_account_keys_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_account_keys_decode_offsets( fd_account_keys_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_account_keys_encode( fd_account_keys_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_account_keys_destroy( fd_account_keys_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5550,6 +5670,9 @@ void fd_stake_weight_new( fd_stake_weight_t * self );
 int fd_stake_weight_decode( fd_stake_weight_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_weight_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_stake_weight_decode_unsafe( fd_stake_weight_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_stake_weight_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_stake_weight_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_stake_weight_t * fd_stake_weight_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_weight_decode_offsets( fd_stake_weight_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_weight_encode( fd_stake_weight_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_stake_weight_destroy( fd_stake_weight_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5557,11 +5680,21 @@ void fd_stake_weight_walk( void * w, fd_stake_weight_t const * self, fd_types_wa
 ulong fd_stake_weight_size( fd_stake_weight_t const * self );
 ulong fd_stake_weight_footprint( void );
 ulong fd_stake_weight_align( void );
+/* fd_stake_weight_view returns a zero-copy view of the fd_stake_weight_t encoded at
+   data (whose bincode encoding matches its in-memory layout).
+   Returns NULL if data_sz is too small or data is misaligned. */
+static inline fd_stake_weight_t const * fd_stake_weight_view( void const * data, ulong data_sz ) {
+  if( FD_UNLIKELY( data_sz<40UL || !fd_ulong_is_aligned( (ulong)data, alignof(fd_stake_weight_t) ) ) ) return NULL;
+  return (fd_stake_weight_t const *)data;
+}
 
 void fd_stake_weights_new( fd_stake_weights_t * self );
 int fd_stake_weights_decode( fd_stake_weights_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_weights_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_stake_weights_decode_unsafe( fd_stake_weights_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_stake_weights_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_stake_weights_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_stake_weights_t * fd_stake_weights_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_weights_decode_offsets( fd_stake_weights_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_weights_encode( fd_stake_weights_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_stake_weights_destroy( fd_stake_weights_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5574,6 +5707,9 @@ void fd_delegation_new( fd_delegation_t * self );
 int fd_delegation_decode( fd_delegation_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_delegation_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_delegation_decode_unsafe( fd_delegation_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_delegation_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_delegation_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_delegation_t * fd_delegation_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_delegation_decode_offsets( fd_delegation_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_delegation_encode( fd_delegation_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_delegation_destroy( fd_delegation_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5585,11 +5721,21 @@ int fd_delegation_decode_archival( fd_delegation_t * self, fd_bincode_decode_ctx
 int fd_delegation_decode_archival_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_delegation_decode_archival_unsafe( fd_delegation_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_delegation_encode_archival( fd_delegation_t const * self, fd_bincode_encode_ctx_t * ctx );
+/* fd_delegation_view returns a zero-copy view of the fd_delegation_t encoded at
+   data (whose bincode encoding matches its in-memory layout).
+   Returns NULL if data_sz is too small or data is misaligned. */
+static inline fd_delegation_t const * fd_delegation_view( void const * data, ulong data_sz ) {
+  if( FD_UNLIKELY( data_sz<64UL || !fd_ulong_is_aligned( (ulong)data, alignof(fd_delegation_t) ) ) ) return NULL;
+  return (fd_delegation_t const *)data;
+}
 
 void fd_delegation_pair_new( fd_delegation_pair_t * self );
 int fd_delegation_pair_decode( fd_delegation_pair_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_delegation_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_delegation_pair_decode_unsafe( fd_delegation_pair_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_delegation_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_delegation_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_delegation_pair_t * fd_delegation_pair_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_delegation_pair_decode_offsets( fd_delegation_pair_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_delegation_pair_encode( fd_delegation_pair_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_delegation_pair_destroy( fd_delegation_pair_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5601,11 +5747,21 @@ int fd_delegation_pair_decode_archival( fd_delegation_pair_t * self, fd_bincode_
 int fd_delegation_pair_decode_archival_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_delegation_pair_decode_archival_unsafe( fd_delegation_pair_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_delegation_pair_encode_archival( fd_delegation_pair_t const * self, fd_bincode_encode_ctx_t * ctx );
+/* fd_delegation_pair_view returns a zero-copy view of the fd_delegation_pair_t encoded at
+   data (whose bincode encoding matches its in-memory layout).
+   Returns NULL if data_sz is too small or data is misaligned. */
+static inline fd_delegation_pair_t const * fd_delegation_pair_view( void const * data, ulong data_sz ) {
+  if( FD_UNLIKELY( data_sz<96UL || !fd_ulong_is_aligned( (ulong)data, alignof(fd_delegation_pair_t) ) ) ) return NULL;
+  return (fd_delegation_pair_t const *)data;
+}
 
 void fd_stake_new( fd_stake_t * self );
 int fd_stake_decode( fd_stake_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_stake_decode_unsafe( fd_stake_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_stake_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_stake_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_stake_t * fd_stake_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_decode_offsets( fd_stake_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_encode( fd_stake_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_stake_destroy( fd_stake_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5613,11 +5769,21 @@ void fd_stake_walk( void * w, fd_stake_t const * self, fd_types_walk_fn_t fun, c
 ulong fd_stake_size( fd_stake_t const * self );
 ulong fd_stake_footprint( void );
 ulong fd_stake_align( void );
+/* fd_stake_view returns a zero-copy view of the fd_stake_t encoded at
+   data (whose bincode encoding matches its in-memory layout).
+   Returns NULL if data_sz is too small or data is misaligned. */
+static inline fd_stake_t const * fd_stake_view( void const * data, ulong data_sz ) {
+  if( FD_UNLIKELY( data_sz<72UL || !fd_ulong_is_aligned( (ulong)data, alignof(fd_stake_t) ) ) ) return NULL;
+  return (fd_stake_t const *)data;
+}
 
 void fd_stake_pair_new( fd_stake_pair_t * self );
 int fd_stake_pair_decode( fd_stake_pair_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_stake_pair_decode_unsafe( fd_stake_pair_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_stake_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_stake_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_stake_pair_t * fd_stake_pair_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_pair_decode_offsets( fd_stake_pair_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_pair_encode( fd_stake_pair_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_stake_pair_destroy( fd_stake_pair_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5625,11 +5791,21 @@ void fd_stake_pair_walk( void * w, fd_stake_pair_t const * self, fd_types_walk_f
 ulong fd_stake_pair_size( fd_stake_pair_t const * self );
 ulong fd_stake_pair_footprint( void );
 ulong fd_stake_pair_align( void );
+/* fd_stake_pair_view returns a zero-copy view of the fd_stake_pair_t encoded at
+   data (whose bincode encoding matches its in-memory layout).
+   Returns NULL if data_sz is too small or data is misaligned. */
+static inline fd_stake_pair_t const * fd_stake_pair_view( void const * data, ulong data_sz ) {
+  if( FD_UNLIKELY( data_sz<104UL || !fd_ulong_is_aligned( (ulong)data, alignof(fd_stake_pair_t) ) ) ) return NULL;
+  return (fd_stake_pair_t const *)data;
+}
 
 void fd_stakes_new( fd_stakes_t * self );
 int fd_stakes_decode( fd_stakes_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_stakes_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_stakes_decode_unsafe( fd_stakes_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_stakes_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_stakes_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_stakes_t * fd_stakes_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_stakes_decode_offsets( fd_stakes_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_stakes_encode( fd_stakes_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_stakes_destroy( fd_stakes_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5646,6 +5822,9 @@ void fd_stakes_serializable_new( fd_stakes_serializable_t * self );
 int fd_stakes_serializable_decode( fd_stakes_serializable_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_stakes_serializable_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_stakes_serializable_decode_unsafe( fd_stakes_serializable_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_stakes_serializable_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_stakes_serializable_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_stakes_serializable_t * fd_stakes_serializable_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_stakes_serializable_decode_offsets( fd_stakes_serializable_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_stakes_serializable_encode( fd_stakes_serializable_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_stakes_serializable_destroy( fd_stakes_serializable_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5658,6 +5837,9 @@ void fd_stakes_stake_new( fd_stakes_stake_t * self );
 int fd_stakes_stake_decode( fd_stakes_stake_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_stakes_stake_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_stakes_stake_decode_unsafe( fd_stakes_stake_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_stakes_stake_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_stakes_stake_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_stakes_stake_t * fd_stakes_stake_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_stakes_stake_decode_offsets( fd_stakes_stake_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_stakes_stake_encode( fd_stakes_stake_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_stakes_stake_destroy( fd_stakes_stake_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5670,6 +5852,9 @@ void fd_bank_incremental_snapshot_persistence_new( fd_bank_incremental_snapshot_
 int fd_bank_incremental_snapshot_persistence_decode( fd_bank_incremental_snapshot_persistence_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_bank_incremental_snapshot_persistence_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_bank_incremental_snapshot_persistence_decode_unsafe( fd_bank_incremental_snapshot_persistence_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_bank_incremental_snapshot_persistence_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_bank_incremental_snapshot_persistence_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_bank_incremental_snapshot_persistence_t * fd_bank_incremental_snapshot_persistence_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_bank_incremental_snapshot_persistence_decode_offsets( fd_bank_incremental_snapshot_persistence_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_bank_incremental_snapshot_persistence_encode( fd_bank_incremental_snapshot_persistence_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_bank_incremental_snapshot_persistence_destroy( fd_bank_incremental_snapshot_persistence_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5677,11 +5862,21 @@ void fd_bank_incremental_snapshot_persistence_walk( void * w, fd_bank_incrementa
 ulong fd_bank_incremental_snapshot_persistence_size( fd_bank_incremental_snapshot_persistence_t const * self );
 ulong fd_bank_incremental_snapshot_persistence_footprint( void );
 ulong fd_bank_incremental_snapshot_persistence_align( void );
+/* fd_bank_incremental_snapshot_persistence_view returns a zero-copy view of the fd_bank_incremental_snapshot_persistence_t encoded at
+   data (whose bincode encoding matches its in-memory layout).
+   Returns NULL if data_sz is too small or data is misaligned. */
+static inline fd_bank_incremental_snapshot_persistence_t const * fd_bank_incremental_snapshot_persistence_view( void const * data, ulong data_sz ) {
+  if( FD_UNLIKELY( data_sz<88UL || !fd_ulong_is_aligned( (ulong)data, alignof(fd_bank_incremental_snapshot_persistence_t) ) ) ) return NULL;
+  return (fd_bank_incremental_snapshot_persistence_t const *)data;
+}
 
 void fd_node_vote_accounts_new( fd_node_vote_accounts_t * self );
 int fd_node_vote_accounts_decode( fd_node_vote_accounts_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_node_vote_accounts_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_node_vote_accounts_decode_unsafe( fd_node_vote_accounts_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_node_vote_accounts_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_node_vote_accounts_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_node_vote_accounts_t * fd_node_vote_accounts_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_node_vote_accounts_decode_offsets( fd_node_vote_accounts_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_node_vote_accounts_encode( fd_node_vote_accounts_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_node_vote_accounts_destroy( fd_node_vote_accounts_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5694,6 +5889,9 @@ void fd_pubkey_node_vote_accounts_pair_new( fd_pubkey_node_vote_accounts_pair_t
 int fd_pubkey_node_vote_accounts_pair_decode( fd_pubkey_node_vote_accounts_pair_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_pubkey_node_vote_accounts_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_pubkey_node_vote_accounts_pair_decode_unsafe( fd_pubkey_node_vote_accounts_pair_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_pubkey_node_vote_accounts_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_pubkey_node_vote_accounts_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_pubkey_node_vote_accounts_pair_t * fd_pubkey_node_vote_accounts_pair_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_pubkey_node_vote_accounts_pair_decode_offsets( fd_pubkey_node_vote_accounts_pair_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_pubkey_node_vote_accounts_pair_encode( fd_pubkey_node_vote_accounts_pair_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_pubkey_node_vote_accounts_pair_destroy( fd_pubkey_node_vote_accounts_pair_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5706,6 +5904,9 @@ void fd_pubkey_pubkey_pair_new( fd_pubkey_pubkey_pair_t * self );
 int fd_pubkey_pubkey_pair_decode( fd_pubkey_pubkey_pair_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_pubkey_pubkey_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_pubkey_pubkey_pair_decode_unsafe( fd_pubkey_pubkey_pair_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_pubkey_pubkey_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_pubkey_pubkey_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_pubkey_pubkey_pair_t * fd_pubkey_pubkey_pair_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_pubkey_pubkey_pair_decode_offsets( fd_pubkey_pubkey_pair_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_pubkey_pubkey_pair_encode( fd_pubkey_pubkey_pair_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_pubkey_pubkey_pair_destroy( fd_pubkey_pubkey_pair_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5713,11 +5914,21 @@ void fd_pubkey_pubkey_pair_walk( void * w, fd_pubkey_pubkey_pair_t const * self,
 ulong fd_pubkey_pubkey_pair_size( fd_pubkey_pubkey_pair_t const * self );
 ulong fd_pubkey_pubkey_pair_footprint( void );
 ulong fd_pubkey_pubkey_pair_align( void );
+/* fd_pubkey_pubkey_pair_view returns a zero-copy view of the fd_pubkey_pubkey_pair_t encoded at
+   data (whose bincode encoding matches its in-memory layout).
+   Returns NULL if data_sz is too small or data is misaligned. */
+static inline fd_pubkey_pubkey_pair_t const * fd_pubkey_pubkey_pair_view( void const * data, ulong data_sz ) {
+  if( FD_UNLIKELY( data_sz<64UL || !fd_ulong_is_aligned( (ulong)data, alignof(fd_pubkey_pubkey_pair_t) ) ) ) return NULL;
+  return (fd_pubkey_pubkey_pair_t const *)data;
+}
 
 void fd_epoch_stakes_new( fd_epoch_stakes_t * self );
 int fd_epoch_stakes_decode( fd_epoch_stakes_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_epoch_stakes_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_epoch_stakes_decode_unsafe( fd_epoch_stakes_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_epoch_stakes_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_epoch_stakes_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_epoch_stakes_t * fd_epoch_stakes_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_epoch_stakes_decode_offsets( fd_epoch_stakes_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_epoch_stakes_encode( fd_epoch_stakes_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_epoch_stakes_destroy( fd_epoch_stakes_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5730,6 +5941,9 @@ void fd_epoch_epoch_stakes_pair_new( fd_epoch_epoch_stakes_pair_t * self );
 int fd_epoch_epoch_stakes_pair_decode( fd_epoch_epoch_stakes_pair_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_epoch_epoch_stakes_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_epoch_epoch_stakes_pair_decode_unsafe( fd_epoch_epoch_stakes_pair_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_epoch_epoch_stakes_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_epoch_epoch_stakes_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_epoch_epoch_stakes_pair_t * fd_epoch_epoch_stakes_pair_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_epoch_epoch_stakes_pair_decode_offsets( fd_epoch_epoch_stakes_pair_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_epoch_epoch_stakes_pair_encode( fd_epoch_epoch_stakes_pair_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_epoch_epoch_stakes_pair_destroy( fd_epoch_epoch_stakes_pair_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5742,6 +5956,9 @@ void fd_pubkey_u64_pair_new( fd_pubkey_u64_pair_t * self );
 int fd_pubkey_u64_pair_decode( fd_pubkey_u64_pair_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_pubkey_u64_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_pubkey_u64_pair_decode_unsafe( fd_pubkey_u64_pair_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_pubkey_u64_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_pubkey_u64_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_pubkey_u64_pair_t * fd_pubkey_u64_pair_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_pubkey_u64_pair_decode_offsets( fd_pubkey_u64_pair_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_pubkey_u64_pair_encode( fd_pubkey_u64_pair_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_pubkey_u64_pair_destroy( fd_pubkey_u64_pair_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5749,11 +5966,21 @@ void fd_pubkey_u64_pair_walk( void * w, fd_pubkey_u64_pair_t const * self, fd_ty
 ulong fd_pubkey_u64_pair_size( fd_pubkey_u64_pair_t const * self );
 ulong fd_pubkey_u64_pair_footprint( void );
 ulong fd_pubkey_u64_pair_align( void );
+/* fd_pubkey_u64_pair_view returns a zero-copy view of the fd_pubkey_u64_pair_t encoded at
+   data (whose bincode encoding matches its in-memory layout).
+   Returns NULL if data_sz is too small or data is misaligned. */
+static inline fd_pubkey_u64_pair_t const * fd_pubkey_u64_pair_view( void const * data, ulong data_sz ) {
+  if( FD_UNLIKELY( data_sz<40UL || !fd_ulong_is_aligned( (ulong)data, alignof(fd_pubkey_u64_pair_t) ) ) ) return NULL;
+  return (fd_pubkey_u64_pair_t const *)data;
+}
 
 void fd_unused_accounts_new( fd_unused_accounts_t * self );
 int fd_unused_accounts_decode( fd_unused_accounts_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_unused_accounts_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_unused_accounts_decode_unsafe( fd_unused_accounts_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_unused_accounts_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_unused_accounts_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_unused_accounts_t * fd_unused_accounts_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_unused_accounts_decode_offsets( fd_unused_accounts_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_unused_accounts_encode( fd_unused_accounts_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_unused_accounts_destroy( fd_unused_accounts_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5766,6 +5993,9 @@ void fd_deserializable_versioned_bank_new( fd_deserializable_versioned_bank_t *
 int fd_deserializable_versioned_bank_decode( fd_deserializable_versioned_bank_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_deserializable_versioned_bank_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_deserializable_versioned_bank_decode_unsafe( fd_deserializable_versioned_bank_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_deserializable_versioned_bank_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_deserializable_versioned_bank_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_deserializable_versioned_bank_t * fd_deserializable_versioned_bank_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_deserializable_versioned_bank_decode_offsets( fd_deserializable_versioned_bank_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_deserializable_versioned_bank_encode( fd_deserializable_versioned_bank_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_deserializable_versioned_bank_destroy( fd_deserializable_versioned_bank_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5778,6 +6008,9 @@ void fd_serializable_versioned_bank_new( fd_serializable_versioned_bank_t * self
 int fd_serializable_versioned_bank_decode( fd_serializable_versioned_bank_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_serializable_versioned_bank_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_serializable_versioned_bank_decode_unsafe( fd_serializable_versioned_bank_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_serializable_versioned_bank_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_serializable_versioned_bank_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_serializable_versioned_bank_t * fd_serializable_versioned_bank_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_serializable_versioned_bank_decode_offsets( fd_serializable_versioned_bank_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_serializable_versioned_bank_encode( fd_serializable_versioned_bank_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_serializable_versioned_bank_destroy( fd_serializable_versioned_bank_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5790,6 +6023,9 @@ void fd_bank_hash_stats_new( fd_bank_hash_stats_t * self );
 int fd_bank_hash_stats_decode( fd_bank_hash_stats_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_bank_hash_stats_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_bank_hash_stats_decode_unsafe( fd_bank_hash_stats_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_bank_hash_stats_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_bank_hash_stats_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_bank_hash_stats_t * fd_bank_hash_stats_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_bank_hash_stats_decode_offsets( fd_bank_hash_stats_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_bank_hash_stats_encode( fd_bank_hash_stats_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_bank_hash_stats_destroy( fd_bank_hash_stats_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5797,11 +6033,21 @@ void fd_bank_hash_stats_walk( void * w, fd_bank_hash_stats_t const * self, fd_ty
 ulong fd_bank_hash_stats_size( fd_bank_hash_stats_t const * self );
 ulong fd_bank_hash_stats_footprint( void );
 ulong fd_bank_hash_stats_align( void );
+/* fd_bank_hash_stats_view returns a zero-copy view of the fd_bank_hash_stats_t encoded at
+   data (whose bincode encoding matches its in-memory layout).
+   Returns NULL if data_sz is too small or data is misaligned. */
+static inline fd_bank_hash_stats_t const * fd_bank_hash_stats_view( void const * data, ulong data_sz ) {
+  if( FD_UNLIKELY( data_sz<40UL || !fd_ulong_is_aligned( (ulong)data, alignof(fd_bank_hash_stats_t) ) ) ) return NULL;
+  return (fd_bank_hash_stats_t const *)data;
+}
 
 void fd_bank_hash_info_new( fd_bank_hash_info_t * self );
 int fd_bank_hash_info_decode( fd_bank_hash_info_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_bank_hash_info_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_bank_hash_info_decode_unsafe( fd_bank_hash_info_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_bank_hash_info_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_bank_hash_info_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_bank_hash_info_t * fd_bank_hash_info_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_bank_hash_info_decode_offsets( fd_bank_hash_info_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_bank_hash_info_encode( fd_bank_hash_info_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_bank_hash_info_destroy( fd_bank_hash_info_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5809,11 +6055,21 @@ void fd_bank_hash_info_walk( void * w, fd_bank_hash_info_t const * self, fd_type
 ulong fd_bank_hash_info_size( fd_bank_hash_info_t const * self );
 ulong fd_bank_hash_info_footprint( void );
 ulong fd_bank_hash_info_align( void );
+/* fd_bank_hash_info_view returns a zero-copy view of the fd_bank_hash_info_t encoded at
+   data (whose bincode encoding matches its in-memory layout).
+   Returns NULL if data_sz is too small or data is misaligned. */
+static inline fd_bank_hash_info_t const * fd_bank_hash_info_view( void const * data, ulong data_sz ) {
+  if( FD_UNLIKELY( data_sz<104UL || !fd_ulong_is_aligned( (ulong)data, alignof(fd_bank_hash_info_t) ) ) ) return NULL;
+  return (fd_bank_hash_info_t const *)data;
+}
 
 void fd_slot_map_pair_new( fd_slot_map_pair_t * self );
 int fd_slot_map_pair_decode( fd_slot_map_pair_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_slot_map_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_slot_map_pair_decode_unsafe( fd_slot_map_pair_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_slot_map_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_slot_map_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_slot_map_pair_t * fd_slot_map_pair_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_slot_map_pair_decode_offsets( fd_slot_map_pair_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_slot_map_pair_encode( fd_slot_map_pair_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_slot_map_pair_destroy( fd_slot_map_pair_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5821,11 +6077,21 @@ void fd_slot_map_pair_walk( void * w, fd_slot_map_pair_t const * self, fd_types_
 ulong fd_slot_map_pair_size( fd_slot_map_pair_t const * self );
 ulong fd_slot_map_pair_footprint( void );
 ulong fd_slot_map_pair_align( void );
+/* fd_slot_map_pair_view returns a zero-copy view of the fd_slot_map_pair_t encoded at
+   data (whose bincode encoding matches its in-memory layout).
+   Returns NULL if data_sz is too small or data is misaligned. */
+static inline fd_slot_map_pair_t const * fd_slot_map_pair_view( void const * data, ulong data_sz ) {
+  if( FD_UNLIKELY( data_sz<40UL || !fd_ulong_is_aligned( (ulong)data, alignof(fd_slot_map_pair_t) ) ) ) return NULL;
+  return (fd_slot_map_pair_t const *)data;
+}
 
 void fd_snapshot_acc_vec_new( fd_snapshot_acc_vec_t * self );
 int fd_snapshot_acc_vec_decode( fd_snapshot_acc_vec_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_snapshot_acc_vec_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_snapshot_acc_vec_decode_unsafe( fd_snapshot_acc_vec_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_snapshot_acc_vec_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_snapshot_acc_vec_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_snapshot_acc_vec_t * fd_snapshot_acc_vec_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_snapshot_acc_vec_decode_offsets( fd_snapshot_acc_vec_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_snapshot_acc_vec_encode( fd_snapshot_acc_vec_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_snapshot_acc_vec_destroy( fd_snapshot_acc_vec_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5833,11 +6099,21 @@ void fd_snapshot_acc_vec_walk( void * w, fd_snapshot_acc_vec_t const * self, fd_
 ulong fd_snapshot_acc_vec_size( fd_snapshot_acc_vec_t const * self );
 ulong fd_snapshot_acc_vec_footprint( void );
 ulong fd_snapshot_acc_vec_align( void );
+/* fd_snapshot_acc_vec_view returns a zero-copy view of the fd_snapshot_acc_vec_t encoded at
+   data (whose bincode encoding matches its in-memory layout).
+   Returns NULL if data_sz is too small or data is misaligned. */
+static inline fd_snapshot_acc_vec_t const * fd_snapshot_acc_vec_view( void const * data, ulong data_sz ) {
+  if( FD_UNLIKELY( data_sz<16UL || !fd_ulong_is_aligned( (ulong)data, alignof(fd_snapshot_acc_vec_t) ) ) ) return NULL;
+  return (fd_snapshot_acc_vec_t const *)data;
+}
 
 void fd_snapshot_slot_acc_vecs_new( fd_snapshot_slot_acc_vecs_t * self );
 int fd_snapshot_slot_acc_vecs_decode( fd_snapshot_slot_acc_vecs_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_snapshot_slot_acc_vecs_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_snapshot_slot_acc_vecs_decode_unsafe( fd_snapshot_slot_acc_vecs_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_snapshot_slot_acc_vecs_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_snapshot_slot_acc_vecs_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_snapshot_slot_acc_vecs_t * fd_snapshot_slot_acc_vecs_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_snapshot_slot_acc_vecs_decode_offsets( fd_snapshot_slot_acc_vecs_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_snapshot_slot_acc_vecs_encode( fd_snapshot_slot_acc_vecs_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_snapshot_slot_acc_vecs_destroy( fd_snapshot_slot_acc_vecs_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5851,6 +6127,9 @@ void fd_reward_type_new( fd_reward_type_t * self );
 int fd_reward_type_decode( fd_reward_type_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_reward_type_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_reward_type_decode_unsafe( fd_reward_type_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_reward_type_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_reward_type_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_reward_type_t * fd_reward_type_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_reward_type_encode( fd_reward_type_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_reward_type_destroy( fd_reward_type_t * self, fd_bincode_destroy_ctx_t * ctx );
 void fd_reward_type_walk( void * w, fd_reward_type_t const * self, fd_types_walk_fn_t fun, const char *name, uint level );
@@ -5872,6 +6151,9 @@ void fd_solana_accounts_db_fields_new( fd_solana_accounts_db_fields_t * self );
 int fd_solana_accounts_db_fields_decode( fd_solana_accounts_db_fields_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_solana_accounts_db_fields_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_solana_accounts_db_fields_decode_unsafe( fd_solana_accounts_db_fields_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_solana_accounts_db_fields_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_solana_accounts_db_fields_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_solana_accounts_db_fields_t * fd_solana_accounts_db_fields_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_solana_accounts_db_fields_decode_offsets( fd_solana_accounts_db_fields_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_solana_accounts_db_fields_encode( fd_solana_accounts_db_fields_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_solana_accounts_db_fields_destroy( fd_solana_accounts_db_fields_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5884,6 +6166,9 @@ void fd_versioned_epoch_stakes_current_new( fd_versioned_epoch_stakes_current_t
 int fd_versioned_epoch_stakes_current_decode( fd_versioned_epoch_stakes_current_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_versioned_epoch_stakes_current_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_versioned_epoch_stakes_current_decode_unsafe( fd_versioned_epoch_stakes_current_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_versioned_epoch_stakes_current_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_versioned_epoch_stakes_current_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_versioned_epoch_stakes_current_t * fd_versioned_epoch_stakes_current_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_versioned_epoch_stakes_current_decode_offsets( fd_versioned_epoch_stakes_current_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_versioned_epoch_stakes_current_encode( fd_versioned_epoch_stakes_current_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_versioned_epoch_stakes_current_destroy( fd_versioned_epoch_stakes_current_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5897,6 +6182,9 @@ void fd_versioned_epoch_stakes_new( fd_versioned_epoch_stakes_t * self );
 int fd_versioned_epoch_stakes_decode( fd_versioned_epoch_stakes_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_versioned_epoch_stakes_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_versioned_epoch_stakes_decode_unsafe( fd_versioned_epoch_stakes_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_versioned_epoch_stakes_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_versioned_epoch_stakes_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_versioned_epoch_stakes_t * fd_versioned_epoch_stakes_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_versioned_epoch_stakes_encode( fd_versioned_epoch_stakes_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_versioned_epoch_stakes_destroy( fd_versioned_epoch_stakes_t * self, fd_bincode_destroy_ctx_t * ctx );
 void fd_versioned_epoch_stakes_walk( void * w, fd_versioned_epoch_stakes_t const * self, fd_types_walk_fn_t fun, const char *name, uint level );
@@ -5912,6 +6200,9 @@ void fd_versioned_epoch_stakes_pair_new( fd_versioned_epoch_stakes_pair_t * self
 int fd_versioned_epoch_stakes_pair_decode( fd_versioned_epoch_stakes_pair_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_versioned_epoch_stakes_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_versioned_epoch_stakes_pair_decode_unsafe( fd_versioned_epoch_stakes_pair_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_versioned_epoch_stakes_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_versioned_epoch_stakes_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_versioned_epoch_stakes_pair_t * fd_versioned_epoch_stakes_pair_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_versioned_epoch_stakes_pair_decode_offsets( fd_versioned_epoch_stakes_pair_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_versioned_epoch_stakes_pair_encode( fd_versioned_epoch_stakes_pair_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_versioned_epoch_stakes_pair_destroy( fd_versioned_epoch_stakes_pair_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5924,6 +6215,9 @@ void fd_reward_info_new( fd_reward_info_t * self );
 int fd_reward_info_decode( fd_reward_info_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_reward_info_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_reward_info_decode_unsafe( fd_reward_info_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_reward_info_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_reward_info_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_reward_info_t * fd_reward_info_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_reward_info_decode_offsets( fd_reward_info_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_reward_info_encode( fd_reward_info_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_reward_info_destroy( fd_reward_info_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5936,6 +6230,9 @@ void fd_slot_lthash_new( fd_slot_lthash_t * self );
 int fd_slot_lthash_decode( fd_slot_lthash_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_slot_lthash_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_slot_lthash_decode_unsafe( fd_slot_lthash_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_slot_lthash_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_slot_lthash_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_slot_lthash_t * fd_slot_lthash_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_slot_lthash_decode_offsets( fd_slot_lthash_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_slot_lthash_encode( fd_slot_lthash_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_slot_lthash_destroy( fd_slot_lthash_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5947,11 +6244,21 @@ int fd_slot_lthash_decode_archival( fd_slot_lthash_t * self, fd_bincode_decode_c
 int fd_slot_lthash_decode_archival_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_slot_lthash_decode_archival_unsafe( fd_slot_lthash_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_slot_lthash_encode_archival( fd_slot_lthash_t const * self, fd_bincode_encode_ctx_t * ctx );
+/* fd_slot_lthash_view returns a zero-copy view of the fd_slot_lthash_t encoded at
+   data (whose bincode encoding matches its in-memory layout).
+   Returns NULL if data_sz is too small or data is misaligned. */
+static inline fd_slot_lthash_t const * fd_slot_lthash_view( void const * data, ulong data_sz ) {
+  if( FD_UNLIKELY( data_sz<2048UL || !fd_ulong_is_aligned( (ulong)data, alignof(fd_slot_lthash_t) ) ) ) return NULL;
+  return (fd_slot_lthash_t const *)data;
+}
 
 void fd_solana_manifest_new( fd_solana_manifest_t * self );
 int fd_solana_manifest_decode( fd_solana_manifest_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_solana_manifest_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_solana_manifest_decode_unsafe( fd_solana_manifest_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_solana_manifest_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_solana_manifest_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_solana_manifest_t * fd_solana_manifest_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_solana_manifest_decode_offsets( fd_solana_manifest_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_solana_manifest_encode( fd_solana_manifest_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_solana_manifest_destroy( fd_solana_manifest_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5964,6 +6271,9 @@ void fd_solana_manifest_serializable_new( fd_solana_manifest_serializable_t * se
 int fd_solana_manifest_serializable_decode( fd_solana_manifest_serializable_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_solana_manifest_serializable_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_solana_manifest_serializable_decode_unsafe( fd_solana_manifest_serializable_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_solana_manifest_serializable_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_solana_manifest_serializable_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_solana_manifest_serializable_t * fd_solana_manifest_serializable_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_solana_manifest_serializable_decode_offsets( fd_solana_manifest_serializable_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_solana_manifest_serializable_encode( fd_solana_manifest_serializable_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_solana_manifest_serializable_destroy( fd_solana_manifest_serializable_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5976,6 +6286,9 @@ void fd_rust_duration_new( fd_rust_duration_t * self );
 int fd_rust_duration_decode( fd_rust_duration_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_rust_duration_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_rust_duration_decode_unsafe( fd_rust_duration_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_rust_duration_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_rust_duration_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_rust_duration_t * fd_rust_duration_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_rust_duration_decode_offsets( fd_rust_duration_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_rust_duration_encode( fd_rust_duration_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_rust_duration_destroy( fd_rust_duration_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -5988,6 +6301,9 @@ void fd_poh_config_new( fd_poh_config_t * self );
 int fd_poh_config_decode( fd_poh_config_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_poh_config_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_poh_config_decode_unsafe( fd_poh_config_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_poh_config_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_poh_config_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_poh_config_t * fd_poh_config_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_poh_config_decode_offsets( fd_poh_config_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_poh_config_encode( fd_poh_config_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_poh_config_destroy( fd_poh_config_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6000,6 +6316,9 @@ void fd_string_pubkey_pair_new( fd_string_pubkey_pair_t * self );
 int fd_string_pubkey_pair_decode( fd_string_pubkey_pair_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_string_pubkey_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_string_pubkey_pair_decode_unsafe( fd_string_pubkey_pair_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_string_pubkey_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_string_pubkey_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_string_pubkey_pair_t * fd_string_pubkey_pair_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_string_pubkey_pair_decode_offsets( fd_string_pubkey_pair_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_string_pubkey_pair_encode( fd_string_pubkey_pair_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_string_pubkey_pair_destroy( fd_string_pubkey_pair_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6012,6 +6331,9 @@ void fd_pubkey_account_pair_new( fd_pubkey_account_pair_t * self );
 int fd_pubkey_account_pair_decode( fd_pubkey_account_pair_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_pubkey_account_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_pubkey_account_pair_decode_unsafe( fd_pubkey_account_pair_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_pubkey_account_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_pubkey_account_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_pubkey_account_pair_t * fd_pubkey_account_pair_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_pubkey_account_pair_decode_offsets( fd_pubkey_account_pair_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_pubkey_account_pair_encode( fd_pubkey_account_pair_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_pubkey_account_pair_destroy( fd_pubkey_account_pair_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6024,6 +6346,9 @@ void fd_genesis_solana_new( fd_genesis_solana_t * self );
 int fd_genesis_solana_decode( fd_genesis_solana_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_genesis_solana_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_genesis_solana_decode_unsafe( fd_genesis_solana_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_genesis_solana_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_genesis_solana_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_genesis_solana_t * fd_genesis_solana_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_genesis_solana_decode_offsets( fd_genesis_solana_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_genesis_solana_encode( fd_genesis_solana_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_genesis_solana_destroy( fd_genesis_solana_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6036,6 +6361,9 @@ void fd_sol_sysvar_clock_new( fd_sol_sysvar_clock_t * self );
 int fd_sol_sysvar_clock_decode( fd_sol_sysvar_clock_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_sol_sysvar_clock_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_sol_sysvar_clock_decode_unsafe( fd_sol_sysvar_clock_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_sol_sysvar_clock_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_sol_sysvar_clock_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_sol_sysvar_clock_t * fd_sol_sysvar_clock_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_sol_sysvar_clock_decode_offsets( fd_sol_sysvar_clock_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_sol_sysvar_clock_encode( fd_sol_sysvar_clock_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_sol_sysvar_clock_destroy( fd_sol_sysvar_clock_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6043,11 +6371,21 @@ void fd_sol_sysvar_clock_walk( void * w, fd_sol_sysvar_clock_t const * self, fd_
 ulong fd_sol_sysvar_clock_size( fd_sol_sysvar_clock_t const * self );
 ulong fd_sol_sysvar_clock_footprint( void );
 ulong fd_sol_sysvar_clock_align( void );
+/* fd_sol_sysvar_clock_view returns a zero-copy view of the fd_sol_sysvar_clock_t encoded at
+   data (whose bincode encoding matches its in-memory layout).
+   Returns NULL if data_sz is too small or data is misaligned. */
+static inline fd_sol_sysvar_clock_t const * fd_sol_sysvar_clock_view( void const * data, ulong data_sz ) {
+  if( FD_UNLIKELY( data_sz<40UL || !fd_ulong_is_aligned( (ulong)data, alignof(fd_sol_sysvar_clock_t) ) ) ) return NULL;
+  return (fd_sol_sysvar_clock_t const *)data;
+}
 
 void fd_sol_sysvar_last_restart_slot_new( fd_sol_sysvar_last_restart_slot_t * self );
 int fd_sol_sysvar_last_restart_slot_decode( fd_sol_sysvar_last_restart_slot_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_sol_sysvar_last_restart_slot_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_sol_sysvar_last_restart_slot_decode_unsafe( fd_sol_sysvar_last_restart_slot_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_sol_sysvar_last_restart_slot_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_sol_sysvar_last_restart_slot_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_sol_sysvar_last_restart_slot_t * fd_sol_sysvar_last_restart_slot_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_sol_sysvar_last_restart_slot_decode_offsets( fd_sol_sysvar_last_restart_slot_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_sol_sysvar_last_restart_slot_encode( fd_sol_sysvar_last_restart_slot_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_sol_sysvar_last_restart_slot_destroy( fd_sol_sysvar_last_restart_slot_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6059,11 +6397,21 @@ int fd_sol_sysvar_last_restart_slot_decode_archival( fd_sol_sysvar_last_restart_
 int fd_sol_sysvar_last_restart_slot_decode_archival_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_sol_sysvar_last_restart_slot_decode_archival_unsafe( fd_sol_sysvar_last_restart_slot_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_sol_sysvar_last_restart_slot_encode_archival( fd_sol_sysvar_last_restart_slot_t const * self, fd_bincode_encode_ctx_t * ctx );
+/* fd_sol_sysvar_last_restart_slot_view returns a zero-copy view of the fd_sol_sysvar_last_restart_slot_t encoded at
+   data (whose bincode encoding matches its in-memory layout).
+   Returns NULL if data_sz is too small or data is misaligned. */
+static inline fd_sol_sysvar_last_restart_slot_t const * fd_sol_sysvar_last_restart_slot_view( void const * data, ulong data_sz ) {
+  if( FD_UNLIKELY( data_sz<8UL || !fd_ulong_is_aligned( (ulong)data, alignof(fd_sol_sysvar_last_restart_slot_t) ) ) ) return NULL;
+  return (fd_sol_sysvar_last_restart_slot_t const *)data;
+}
 
 void fd_vote_lockout_new( fd_vote_lockout_t * self );
 int fd_vote_lockout_decode( fd_vote_lockout_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_lockout_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_vote_lockout_decode_unsafe( fd_vote_lockout_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_vote_lockout_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_lockout_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_vote_lockout_t * fd_vote_lockout_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_lockout_decode_offsets( fd_vote_lockout_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_lockout_encode( fd_vote_lockout_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_vote_lockout_destroy( fd_vote_lockout_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6076,6 +6424,9 @@ void fd_lockout_offset_new( fd_lockout_offset_t * self );
 int fd_lockout_offset_decode( fd_lockout_offset_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_lockout_offset_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_lockout_offset_decode_unsafe( fd_lockout_offset_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_lockout_offset_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_lockout_offset_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_lockout_offset_t * fd_lockout_offset_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_lockout_offset_decode_offsets( fd_lockout_offset_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_lockout_offset_encode( fd_lockout_offset_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_lockout_offset_destroy( fd_lockout_offset_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6088,6 +6439,9 @@ void fd_vote_authorized_voter_new( fd_vote_authorized_voter_t * self );
 int fd_vote_authorized_voter_decode( fd_vote_authorized_voter_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_authorized_voter_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_vote_authorized_voter_decode_unsafe( fd_vote_authorized_voter_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_vote_authorized_voter_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_authorized_voter_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_vote_authorized_voter_t * fd_vote_authorized_voter_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_authorized_voter_decode_offsets( fd_vote_authorized_voter_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_authorized_voter_encode( fd_vote_authorized_voter_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_vote_authorized_voter_destroy( fd_vote_authorized_voter_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6100,6 +6454,9 @@ void fd_vote_prior_voter_new( fd_vote_prior_voter_t * self );
 int fd_vote_prior_voter_decode( fd_vote_prior_voter_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_prior_voter_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_vote_prior_voter_decode_unsafe( fd_vote_prior_voter_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_vote_prior_voter_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_prior_voter_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_vote_prior_voter_t * fd_vote_prior_voter_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_prior_voter_decode_offsets( fd_vote_prior_voter_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_prior_voter_encode( fd_vote_prior_voter_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_vote_prior_voter_destroy( fd_vote_prior_voter_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6107,11 +6464,21 @@ void fd_vote_prior_voter_walk( void * w, fd_vote_prior_voter_t const * self, fd_
 ulong fd_vote_prior_voter_size( fd_vote_prior_voter_t const * self );
 ulong fd_vote_prior_voter_footprint( void );
 ulong fd_vote_prior_voter_align( void );
+/* fd_vote_prior_voter_view returns a zero-copy view of the fd_vote_prior_voter_t encoded at
+   data (whose bincode encoding matches its in-memory layout).
+   Returns NULL if data_sz is too small or data is misaligned. */
+static inline fd_vote_prior_voter_t const * fd_vote_prior_voter_view( void const * data, ulong data_sz ) {
+  if( FD_UNLIKELY( data_sz<48UL || !fd_ulong_is_aligned( (ulong)data, alignof(fd_vote_prior_voter_t) ) ) ) return NULL;
+  return (fd_vote_prior_voter_t const *)data;
+}
 
 void fd_vote_prior_voter_0_23_5_new( fd_vote_prior_voter_0_23_5_t * self );
 int fd_vote_prior_voter_0_23_5_decode( fd_vote_prior_voter_0_23_5_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_prior_voter_0_23_5_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_vote_prior_voter_0_23_5_decode_unsafe( fd_vote_prior_voter_0_23_5_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_vote_prior_voter_0_23_5_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_prior_voter_0_23_5_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_vote_prior_voter_0_23_5_t * fd_vote_prior_voter_0_23_5_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_prior_voter_0_23_5_decode_offsets( fd_vote_prior_voter_0_23_5_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_prior_voter_0_23_5_encode( fd_vote_prior_voter_0_23_5_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_vote_prior_voter_0_23_5_destroy( fd_vote_prior_voter_0_23_5_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6119,11 +6486,21 @@ void fd_vote_prior_voter_0_23_5_walk( void * w, fd_vote_prior_voter_0_23_5_t con
 ulong fd_vote_prior_voter_0_23_5_size( fd_vote_prior_voter_0_23_5_t const * self );
 ulong fd_vote_prior_voter_0_23_5_footprint( void );
 ulong fd_vote_prior_voter_0_23_5_align( void );
+/* fd_vote_prior_voter_0_23_5_view returns a zero-copy view of the fd_vote_prior_voter_0_23_5_t encoded at
+   data (whose bincode encoding matches its in-memory layout).
+   Returns NULL if data_sz is too small or data is misaligned. */
+static inline fd_vote_prior_voter_0_23_5_t const * fd_vote_prior_voter_0_23_5_view( void const * data, ulong data_sz ) {
+  if( FD_UNLIKELY( data_sz<56UL || !fd_ulong_is_aligned( (ulong)data, alignof(fd_vote_prior_voter_0_23_5_t) ) ) ) return NULL;
+  return (fd_vote_prior_voter_0_23_5_t const *)data;
+}
 
 void fd_vote_epoch_credits_new( fd_vote_epoch_credits_t * self );
 int fd_vote_epoch_credits_decode( fd_vote_epoch_credits_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_epoch_credits_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_vote_epoch_credits_decode_unsafe( fd_vote_epoch_credits_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_vote_epoch_credits_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_epoch_credits_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_vote_epoch_credits_t * fd_vote_epoch_credits_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_epoch_credits_decode_offsets( fd_vote_epoch_credits_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_epoch_credits_encode( fd_vote_epoch_credits_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_vote_epoch_credits_destroy( fd_vote_epoch_credits_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6131,11 +6508,21 @@ void fd_vote_epoch_credits_walk( void * w, fd_vote_epoch_credits_t const * self,
 ulong fd_vote_epoch_credits_size( fd_vote_epoch_credits_t const * self );
 ulong fd_vote_epoch_credits_footprint( void );
 ulong fd_vote_epoch_credits_align( void );
+/* fd_vote_epoch_credits_view returns a zero-copy view of the fd_vote_epoch_credits_t encoded at
+   data (whose bincode encoding matches its in-memory layout).
+   Returns NULL if data_sz is too small or data is misaligned. */
+static inline fd_vote_epoch_credits_t const * fd_vote_epoch_credits_view( void const * data, ulong data_sz ) {
+  if( FD_UNLIKELY( data_sz<24UL || !fd_ulong_is_aligned( (ulong)data, alignof(fd_vote_epoch_credits_t) ) ) ) return NULL;
+  return (fd_vote_epoch_credits_t const *)data;
+}
 
 void fd_vote_block_timestamp_new( fd_vote_block_timestamp_t * self );
 int fd_vote_block_timestamp_decode( fd_vote_block_timestamp_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_block_timestamp_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_vote_block_timestamp_decode_unsafe( fd_vote_block_timestamp_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_vote_block_timestamp_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_block_timestamp_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_vote_block_timestamp_t * fd_vote_block_timestamp_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_block_timestamp_decode_offsets( fd_vote_block_timestamp_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_block_timestamp_encode( fd_vote_block_timestamp_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_vote_block_timestamp_destroy( fd_vote_block_timestamp_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6143,11 +6530,21 @@ void fd_vote_block_timestamp_walk( void * w, fd_vote_block_timestamp_t const * s
 ulong fd_vote_block_timestamp_size( fd_vote_block_timestamp_t const * self );
 ulong fd_vote_block_timestamp_footprint( void );
 ulong fd_vote_block_timestamp_align( void );
+/* fd_vote_block_timestamp_view returns a zero-copy view of the fd_vote_block_timestamp_t encoded at
+   data (whose bincode encoding matches its in-memory layout).
+   Returns NULL if data_sz is too small or data is misaligned. */
+static inline fd_vote_block_timestamp_t const * fd_vote_block_timestamp_view( void const * data, ulong data_sz ) {
+  if( FD_UNLIKELY( data_sz<16UL || !fd_ulong_is_aligned( (ulong)data, alignof(fd_vote_block_timestamp_t) ) ) ) return NULL;
+  return (fd_vote_block_timestamp_t const *)data;
+}
 
 void fd_vote_prior_voters_new( fd_vote_prior_voters_t * self );
 int fd_vote_prior_voters_decode( fd_vote_prior_voters_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_prior_voters_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_vote_prior_voters_decode_unsafe( fd_vote_prior_voters_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_vote_prior_voters_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_prior_voters_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_vote_prior_voters_t * fd_vote_prior_voters_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_prior_voters_decode_offsets( fd_vote_prior_voters_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_prior_voters_encode( fd_vote_prior_voters_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_vote_prior_voters_destroy( fd_vote_prior_voters_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6160,6 +6557,9 @@ void fd_vote_prior_voters_0_23_5_new( fd_vote_prior_voters_0_23_5_t * self );
 int fd_vote_prior_voters_0_23_5_decode( fd_vote_prior_voters_0_23_5_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_prior_voters_0_23_5_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_vote_prior_voters_0_23_5_decode_unsafe( fd_vote_prior_voters_0_23_5_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_vote_prior_voters_0_23_5_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_prior_voters_0_23_5_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_vote_prior_voters_0_23_5_t * fd_vote_prior_voters_0_23_5_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_prior_voters_0_23_5_decode_offsets( fd_vote_prior_voters_0_23_5_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_prior_voters_0_23_5_encode( fd_vote_prior_voters_0_23_5_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_vote_prior_voters_0_23_5_destroy( fd_vote_prior_voters_0_23_5_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6167,11 +6567,21 @@ void fd_vote_prior_voters_0_23_5_walk( void * w, fd_vote_prior_voters_0_23_5_t c
 ulong fd_vote_prior_voters_0_23_5_size( fd_vote_prior_voters_0_23_5_t const * self );
 ulong fd_vote_prior_voters_0_23_5_footprint( void );
 ulong fd_vote_prior_voters_0_23_5_align( void );
+/* fd_vote_prior_voters_0_23_5_view returns a zero-copy view of the fd_vote_prior_voters_0_23_5_t encoded at
+   data (whose bincode encoding matches its in-memory layout).
+   Returns NULL if data_sz is too small or data is misaligned. */
+static inline fd_vote_prior_voters_0_23_5_t const * fd_vote_prior_voters_0_23_5_view( void const * data, ulong data_sz ) {
+  if( FD_UNLIKELY( data_sz<1800UL || !fd_ulong_is_aligned( (ulong)data, alignof(fd_vote_prior_voters_0_23_5_t) ) ) ) return NULL;
+  return (fd_vote_prior_voters_0_23_5_t const *)data;
+}
 
 void fd_landed_vote_new( fd_landed_vote_t * self );
 int fd_landed_vote_decode( fd_landed_vote_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_landed_vote_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_landed_vote_decode_unsafe( fd_landed_vote_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_landed_vote_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_landed_vote_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_landed_vote_t * fd_landed_vote_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_landed_vote_decode_offsets( fd_landed_vote_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_landed_vote_encode( fd_landed_vote_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_landed_vote_destroy( fd_landed_vote_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6184,6 +6594,9 @@ void fd_vote_state_0_23_5_new( fd_vote_state_0_23_5_t * self );
 int fd_vote_state_0_23_5_decode( fd_vote_state_0_23_5_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_state_0_23_5_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_vote_state_0_23_5_decode_unsafe( fd_vote_state_0_23_5_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_vote_state_0_23_5_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_state_0_23_5_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_vote_state_0_23_5_t * fd_vote_state_0_23_5_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_state_0_23_5_decode_offsets( fd_vote_state_0_23_5_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_state_0_23_5_encode( fd_vote_state_0_23_5_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_vote_state_0_23_5_destroy( fd_vote_state_0_23_5_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6196,6 +6609,9 @@ void fd_vote_authorized_voters_new( fd_vote_authorized_voters_t * self );
 int fd_vote_authorized_voters_decode( fd_vote_authorized_voters_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_authorized_voters_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_vote_authorized_voters_decode_unsafe( fd_vote_authorized_voters_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_vote_authorized_voters_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_authorized_voters_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_vote_authorized_voters_t * fd_vote_authorized_voters_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_authorized_voters_decode_offsets( fd_vote_authorized_voters_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_authorized_voters_encode( fd_vote_authorized_voters_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_vote_authorized_voters_destroy( fd_vote_authorized_voters_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6208,6 +6624,9 @@ void fd_vote_state_1_14_11_new( fd_vote_state_1_14_11_t * self );
 int fd_vote_state_1_14_11_decode( fd_vote_state_1_14_11_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_state_1_14_11_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_vote_state_1_14_11_decode_unsafe( fd_vote_state_1_14_11_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_vote_state_1_14_11_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_state_1_14_11_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_vote_state_1_14_11_t * fd_vote_state_1_14_11_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_state_1_14_11_decode_offsets( fd_vote_state_1_14_11_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_state_1_14_11_encode( fd_vote_state_1_14_11_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_vote_state_1_14_11_destroy( fd_vote_state_1_14_11_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6220,6 +6639,9 @@ void fd_vote_state_new( fd_vote_state_t * self );
 int fd_vote_state_decode( fd_vote_state_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_state_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_vote_state_decode_unsafe( fd_vote_state_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_vote_state_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_state_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_vote_state_t * fd_vote_state_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_state_decode_offsets( fd_vote_state_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_state_encode( fd_vote_state_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_vote_state_destroy( fd_vote_state_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6233,6 +6655,9 @@ void fd_vote_state_versioned_new( fd_vote_state_versioned_t * self );
 int fd_vote_state_versioned_decode( fd_vote_state_versioned_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_state_versioned_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_vote_state_versioned_decode_unsafe( fd_vote_state_versioned_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_vote_state_versioned_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_state_versioned_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_vote_state_versioned_t * fd_vote_state_versioned_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_state_versioned_decode_offsets( fd_vote_state_versioned_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_state_versioned_encode( fd_vote_state_versioned_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_vote_state_versioned_destroy( fd_vote_state_versioned_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6253,6 +6678,9 @@ void fd_vote_state_update_new( fd_vote_state_update_t * self );
 int fd_vote_state_update_decode( fd_vote_state_update_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_state_update_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_vote_state_update_decode_unsafe( fd_vote_state_update_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_vote_state_update_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_state_update_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_vote_state_update_t * fd_vote_state_update_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_state_update_decode_offsets( fd_vote_state_update_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_state_update_encode( fd_vote_state_update_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_vote_state_update_destroy( fd_vote_state_update_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6265,6 +6693,9 @@ void fd_compact_vote_state_update_new( fd_compact_vote_state_update_t * self );
 int fd_compact_vote_state_update_decode( fd_compact_vote_state_update_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_compact_vote_state_update_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_compact_vote_state_update_decode_unsafe( fd_compact_vote_state_update_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_compact_vote_state_update_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_compact_vote_state_update_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_compact_vote_state_update_t * fd_compact_vote_state_update_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_compact_vote_state_update_decode_offsets( fd_compact_vote_state_update_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_compact_vote_state_update_encode( fd_compact_vote_state_update_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_compact_vote_state_update_destroy( fd_compact_vote_state_update_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6277,6 +6708,9 @@ void fd_compact_vote_state_update_switch_new( fd_compact_vote_state_update_switc
 int fd_compact_vote_state_update_switch_decode( fd_compact_vote_state_update_switch_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_compact_vote_state_update_switch_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_compact_vote_state_update_switch_decode_unsafe( fd_compact_vote_state_update_switch_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_compact_vote_state_update_switch_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_compact_vote_state_update_switch_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_compact_vote_state_update_switch_t * fd_compact_vote_state_update_switch_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_compact_vote_state_update_switch_decode_offsets( fd_compact_vote_state_update_switch_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_compact_vote_state_update_switch_encode( fd_compact_vote_state_update_switch_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_compact_vote_state_update_switch_destroy( fd_compact_vote_state_update_switch_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6289,6 +6723,9 @@ void fd_compact_tower_sync_new( fd_compact_tower_sync_t * self );
 int fd_compact_tower_sync_decode( fd_compact_tower_sync_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_compact_tower_sync_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_compact_tower_sync_decode_unsafe( fd_compact_tower_sync_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_compact_tower_sync_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_compact_tower_sync_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_compact_tower_sync_t * fd_compact_tower_sync_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_compact_tower_sync_decode_offsets( fd_compact_tower_sync_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_compact_tower_sync_encode( fd_compact_tower_sync_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_compact_tower_sync_destroy( fd_compact_tower_sync_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6301,6 +6738,9 @@ void fd_tower_sync_new( fd_tower_sync_t * self );
 int fd_tower_sync_decode( fd_tower_sync_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_tower_sync_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_tower_sync_decode_unsafe( fd_tower_sync_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_tower_sync_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_tower_sync_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_tower_sync_t * fd_tower_sync_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_tower_sync_decode_offsets( fd_tower_sync_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_tower_sync_encode( fd_tower_sync_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_tower_sync_destroy( fd_tower_sync_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6313,6 +6753,9 @@ void fd_tower_sync_switch_new( fd_tower_sync_switch_t * self );
 int fd_tower_sync_switch_decode( fd_tower_sync_switch_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_tower_sync_switch_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_tower_sync_switch_decode_unsafe( fd_tower_sync_switch_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_tower_sync_switch_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_tower_sync_switch_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_tower_sync_switch_t * fd_tower_sync_switch_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_tower_sync_switch_decode_offsets( fd_tower_sync_switch_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_tower_sync_switch_encode( fd_tower_sync_switch_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_tower_sync_switch_destroy( fd_tower_sync_switch_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6325,6 +6768,9 @@ void fd_slot_history_inner_new( fd_slot_history_inner_t * self );
 int fd_slot_history_inner_decode( fd_slot_history_inner_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_slot_history_inner_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_slot_history_inner_decode_unsafe( fd_slot_history_inner_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_slot_history_inner_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_slot_history_inner_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_slot_history_inner_t * fd_slot_history_inner_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_slot_history_inner_decode_offsets( fd_slot_history_inner_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_slot_history_inner_encode( fd_slot_history_inner_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_slot_history_inner_destroy( fd_slot_history_inner_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6337,6 +6783,9 @@ void fd_slot_history_bitvec_new( fd_slot_history_bitvec_t * self );
 int fd_slot_history_bitvec_decode( fd_slot_history_bitvec_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_slot_history_bitvec_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_slot_history_bitvec_decode_unsafe( fd_slot_history_bitvec_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_slot_history_bitvec_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_slot_history_bitvec_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_slot_history_bitvec_t * fd_slot_history_bitvec_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_slot_history_bitvec_decode_offsets( fd_slot_history_bitvec_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_slot_history_bitvec_encode( fd_slot_history_bitvec_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_slot_history_bitvec_destroy( fd_slot_history_bitvec_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6349,6 +6798,9 @@ void fd_slot_history_new( fd_slot_history_t * self );
 int fd_slot_history_decode( fd_slot_history_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_slot_history_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_slot_history_decode_unsafe( fd_slot_history_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_slot_history_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_slot_history_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_slot_history_t * fd_slot_history_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_slot_history_decode_offsets( fd_slot_history_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_slot_history_encode( fd_slot_history_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_slot_history_destroy( fd_slot_history_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6361,6 +6813,9 @@ void fd_slot_hash_new( fd_slot_hash_t * self );
 int fd_slot_hash_decode( fd_slot_hash_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_slot_hash_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_slot_hash_decode_unsafe( fd_slot_hash_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_slot_hash_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_slot_hash_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_slot_hash_t * fd_slot_hash_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_slot_hash_decode_offsets( fd_slot_hash_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_slot_hash_encode( fd_slot_hash_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_slot_hash_destroy( fd_slot_hash_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6368,11 +6823,21 @@ void fd_slot_hash_walk( void * w, fd_slot_hash_t const * self, fd_types_walk_fn_
 ulong fd_slot_hash_size( fd_slot_hash_t const * self );
 ulong fd_slot_hash_footprint( void );
 ulong fd_slot_hash_align( void );
+/* fd_slot_hash_view returns a zero-copy view of the fd_slot_hash_t encoded at
+   data (whose bincode encoding matches its in-memory layout).
+   Returns NULL if data_sz is too small or data is misaligned. */
+static inline fd_slot_hash_t const * fd_slot_hash_view( void const * data, ulong data_sz ) {
+  if( FD_UNLIKELY( data_sz<40UL || !fd_ulong_is_aligned( (ulong)data, alignof(fd_slot_hash_t) ) ) ) return NULL;
+  return (fd_slot_hash_t const *)data;
+}
 
 void fd_slot_hashes_new( fd_slot_hashes_t * self );
 int fd_slot_hashes_decode( fd_slot_hashes_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_slot_hashes_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_slot_hashes_decode_unsafe( fd_slot_hashes_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_slot_hashes_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_slot_hashes_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_slot_hashes_t * fd_slot_hashes_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_slot_hashes_decode_offsets( fd_slot_hashes_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_slot_hashes_encode( fd_slot_hashes_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_slot_hashes_destroy( fd_slot_hashes_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6385,6 +6850,9 @@ void fd_block_block_hash_entry_new( fd_block_block_hash_entry_t * self );
 int fd_block_block_hash_entry_decode( fd_block_block_hash_entry_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_block_block_hash_entry_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_block_block_hash_entry_decode_unsafe( fd_block_block_hash_entry_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_block_block_hash_entry_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_block_block_hash_entry_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_block_block_hash_entry_t * fd_block_block_hash_entry_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_block_block_hash_entry_decode_offsets( fd_block_block_hash_entry_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_block_block_hash_entry_encode( fd_block_block_hash_entry_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_block_block_hash_entry_destroy( fd_block_block_hash_entry_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6392,11 +6860,21 @@ void fd_block_block_hash_entry_walk( void * w, fd_block_block_hash_entry_t const
 ulong fd_block_block_hash_entry_size( fd_block_block_hash_entry_t const * self );
 ulong fd_block_block_hash_entry_footprint( void );
 ulong fd_block_block_hash_entry_align( void );
+/* fd_block_block_hash_entry_view returns a zero-copy view of the fd_block_block_hash_entry_t encoded at
+   data (whose bincode encoding matches its in-memory layout).
+   Returns NULL if data_sz is too small or data is misaligned. */
+static inline fd_block_block_hash_entry_t const * fd_block_block_hash_entry_view( void const * data, ulong data_sz ) {
+  if( FD_UNLIKELY( data_sz<40UL || !fd_ulong_is_aligned( (ulong)data, alignof(fd_block_block_hash_entry_t) ) ) ) return NULL;
+  return (fd_block_block_hash_entry_t const *)data;
+}
 
 void fd_recent_block_hashes_new( fd_recent_block_hashes_t * self );
 int fd_recent_block_hashes_decode( fd_recent_block_hashes_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_recent_block_hashes_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_recent_block_hashes_decode_unsafe( fd_recent_block_hashes_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_recent_block_hashes_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_recent_block_hashes_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_recent_block_hashes_t * fd_recent_block_hashes_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_recent_block_hashes_decode_offsets( fd_recent_block_hashes_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_recent_block_hashes_encode( fd_recent_block_hashes_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_recent_block_hashes_destroy( fd_recent_block_hashes_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6409,6 +6887,9 @@ void fd_slot_meta_new( fd_slot_meta_t * self );
 int fd_slot_meta_decode( fd_slot_meta_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_slot_meta_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_slot_meta_decode_unsafe( fd_slot_meta_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_slot_meta_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_slot_meta_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_slot_meta_t * fd_slot_meta_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_slot_meta_decode_offsets( fd_slot_meta_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_slot_meta_encode( fd_slot_meta_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_slot_meta_destroy( fd_slot_meta_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6421,6 +6902,9 @@ void fd_clock_timestamp_vote_new( fd_clock_timestamp_vote_t * self );
 int fd_clock_timestamp_vote_decode( fd_clock_timestamp_vote_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_clock_timestamp_vote_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_clock_timestamp_vote_decode_unsafe( fd_clock_timestamp_vote_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_clock_timestamp_vote_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_clock_timestamp_vote_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_clock_timestamp_vote_t * fd_clock_timestamp_vote_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_clock_timestamp_vote_decode_offsets( fd_clock_timestamp_vote_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_clock_timestamp_vote_encode( fd_clock_timestamp_vote_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_clock_timestamp_vote_destroy( fd_clock_timestamp_vote_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6432,11 +6916,21 @@ int fd_clock_timestamp_vote_decode_archival( fd_clock_timestamp_vote_t * self, f
 int fd_clock_timestamp_vote_decode_archival_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_clock_timestamp_vote_decode_archival_unsafe( fd_clock_timestamp_vote_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_clock_timestamp_vote_encode_archival( fd_clock_timestamp_vote_t const * self, fd_bincode_encode_ctx_t * ctx );
+/* fd_clock_timestamp_vote_view returns a zero-copy view of the fd_clock_timestamp_vote_t encoded at
+   data (whose bincode encoding matches its in-memory layout).
+   Returns NULL if data_sz is too small or data is misaligned. */
+static inline fd_clock_timestamp_vote_t const * fd_clock_timestamp_vote_view( void const * data, ulong data_sz ) {
+  if( FD_UNLIKELY( data_sz<48UL || !fd_ulong_is_aligned( (ulong)data, alignof(fd_clock_timestamp_vote_t) ) ) ) return NULL;
+  return (fd_clock_timestamp_vote_t const *)data;
+}
 
 void fd_clock_timestamp_votes_new( fd_clock_timestamp_votes_t * self );
 int fd_clock_timestamp_votes_decode( fd_clock_timestamp_votes_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_clock_timestamp_votes_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_clock_timestamp_votes_decode_unsafe( fd_clock_timestamp_votes_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_clock_timestamp_votes_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_clock_timestamp_votes_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_clock_timestamp_votes_t * fd_clock_timestamp_votes_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_clock_timestamp_votes_decode_offsets( fd_clock_timestamp_votes_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_clock_timestamp_votes_encode( fd_clock_timestamp_votes_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_clock_timestamp_votes_destroy( fd_clock_timestamp_votes_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6453,6 +6947,9 @@ void fd_sysvar_fees_new( fd_sysvar_fees_t * self );
 int fd_sysvar_fees_decode( fd_sysvar_fees_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_sysvar_fees_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_sysvar_fees_decode_unsafe( fd_sysvar_fees_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_sysvar_fees_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_sysvar_fees_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_sysvar_fees_t * fd_sysvar_fees_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_sysvar_fees_decode_offsets( fd_sysvar_fees_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_sysvar_fees_encode( fd_sysvar_fees_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_sysvar_fees_destroy( fd_sysvar_fees_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6460,11 +6957,21 @@ void fd_sysvar_fees_walk( void * w, fd_sysvar_fees_t const * self, fd_types_walk
 ulong fd_sysvar_fees_size( fd_sysvar_fees_t const * self );
 ulong fd_sysvar_fees_footprint( void );
 ulong fd_sysvar_fees_align( void );
+/* fd_sysvar_fees_view returns a zero-copy view of the fd_sysvar_fees_t encoded at
+   data (whose bincode encoding matches its in-memory layout).
+   Returns NULL if data_sz is too small or data is misaligned. */
+static inline fd_sysvar_fees_t const * fd_sysvar_fees_view( void const * data, ulong data_sz ) {
+  if( FD_UNLIKELY( data_sz<8UL || !fd_ulong_is_aligned( (ulong)data, alignof(fd_sysvar_fees_t) ) ) ) return NULL;
+  return (fd_sysvar_fees_t const *)data;
+}
 
 void fd_sysvar_epoch_rewards_new( fd_sysvar_epoch_rewards_t * self );
 int fd_sysvar_epoch_rewards_decode( fd_sysvar_epoch_rewards_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_sysvar_epoch_rewards_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_sysvar_epoch_rewards_decode_unsafe( fd_sysvar_epoch_rewards_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_sysvar_epoch_rewards_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_sysvar_epoch_rewards_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_sysvar_epoch_rewards_t * fd_sysvar_epoch_rewards_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_sysvar_epoch_rewards_decode_offsets( fd_sysvar_epoch_rewards_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_sysvar_epoch_rewards_encode( fd_sysvar_epoch_rewards_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_sysvar_epoch_rewards_destroy( fd_sysvar_epoch_rewards_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6477,6 +6984,9 @@ void fd_config_keys_pair_new( fd_config_keys_pair_t * self );
 int fd_config_keys_pair_decode( fd_config_keys_pair_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_config_keys_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_config_keys_pair_decode_unsafe( fd_config_keys_pair_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_config_keys_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_config_keys_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_config_keys_pair_t * fd_config_keys_pair_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_config_keys_pair_decode_offsets( fd_config_keys_pair_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_config_keys_pair_encode( fd_config_keys_pair_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_config_keys_pair_destroy( fd_config_keys_pair_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6489,6 +6999,9 @@ void fd_stake_config_new( fd_stake_config_t * self );
 int fd_stake_config_decode( fd_stake_config_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_config_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_stake_config_decode_unsafe( fd_stake_config_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_stake_config_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_stake_config_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_stake_config_t * fd_stake_config_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_config_decode_offsets( fd_stake_config_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_config_encode( fd_stake_config_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_stake_config_destroy( fd_stake_config_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6501,6 +7014,9 @@ void fd_feature_entry_new( fd_feature_entry_t * self );
 int fd_feature_entry_decode( fd_feature_entry_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_feature_entry_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_feature_entry_decode_unsafe( fd_feature_entry_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_feature_entry_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_feature_entry_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_feature_entry_t * fd_feature_entry_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_feature_entry_decode_offsets( fd_feature_entry_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_feature_entry_encode( fd_feature_entry_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_feature_entry_destroy( fd_feature_entry_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6513,6 +7029,9 @@ void fd_firedancer_bank_new( fd_firedancer_bank_t * self );
 int fd_firedancer_bank_decode( fd_firedancer_bank_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_firedancer_bank_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_firedancer_bank_decode_unsafe( fd_firedancer_bank_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_firedancer_bank_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_firedancer_bank_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_firedancer_bank_t * fd_firedancer_bank_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_firedancer_bank_decode_offsets( fd_firedancer_bank_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_firedancer_bank_encode( fd_firedancer_bank_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_firedancer_bank_destroy( fd_firedancer_bank_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6526,6 +7045,9 @@ void fd_cluster_type_new( fd_cluster_type_t * self );
 int fd_cluster_type_decode( fd_cluster_type_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_cluster_type_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_cluster_type_decode_unsafe( fd_cluster_type_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_cluster_type_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_cluster_type_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_cluster_type_t * fd_cluster_type_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_cluster_type_encode( fd_cluster_type_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_cluster_type_destroy( fd_cluster_type_t * self, fd_bincode_destroy_ctx_t * ctx );
 void fd_cluster_type_walk( void * w, fd_cluster_type_t const * self, fd_types_walk_fn_t fun, const char *name, uint level );
@@ -6547,6 +7069,9 @@ void fd_epoch_bank_new( fd_epoch_bank_t * self );
 int fd_epoch_bank_decode( fd_epoch_bank_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_epoch_bank_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_epoch_bank_decode_unsafe( fd_epoch_bank_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_epoch_bank_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_epoch_bank_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_epoch_bank_t * fd_epoch_bank_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_epoch_bank_decode_offsets( fd_epoch_bank_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_epoch_bank_encode( fd_epoch_bank_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_epoch_bank_destroy( fd_epoch_bank_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6563,6 +7088,9 @@ void fd_slot_bank_new( fd_slot_bank_t * self );
 int fd_slot_bank_decode( fd_slot_bank_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_slot_bank_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_slot_bank_decode_unsafe( fd_slot_bank_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_slot_bank_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_slot_bank_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_slot_bank_t * fd_slot_bank_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_slot_bank_decode_offsets( fd_slot_bank_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_slot_bank_encode( fd_slot_bank_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_slot_bank_destroy( fd_slot_bank_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6579,6 +7107,9 @@ void fd_prev_epoch_inflation_rewards_new( fd_prev_epoch_inflation_rewards_t * se
 int fd_prev_epoch_inflation_rewards_decode( fd_prev_epoch_inflation_rewards_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_prev_epoch_inflation_rewards_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_prev_epoch_inflation_rewards_decode_unsafe( fd_prev_epoch_inflation_rewards_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_prev_epoch_inflation_rewards_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_prev_epoch_inflation_rewards_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_prev_epoch_inflation_rewards_t * fd_prev_epoch_inflation_rewards_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_prev_epoch_inflation_rewards_decode_offsets( fd_prev_epoch_inflation_rewards_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_prev_epoch_inflation_rewards_encode( fd_prev_epoch_inflation_rewards_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_prev_epoch_inflation_rewards_destroy( fd_prev_epoch_inflation_rewards_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6586,11 +7117,21 @@ void fd_prev_epoch_inflation_rewards_walk( void * w, fd_prev_epoch_inflation_rew
 ulong fd_prev_epoch_inflation_rewards_size( fd_prev_epoch_inflation_rewards_t const * self );
 ulong fd_prev_epoch_inflation_rewards_footprint( void );
 ulong fd_prev_epoch_inflation_rewards_align( void );
+/* fd_prev_epoch_inflation_rewards_view returns a zero-copy view of the fd_prev_epoch_inflation_rewards_t encoded at
+   data (whose bincode encoding matches its in-memory layout).
+   Returns NULL if data_sz is too small or data is misaligned. */
+static inline fd_prev_epoch_inflation_rewards_t const * fd_prev_epoch_inflation_rewards_view( void const * data, ulong data_sz ) {
+  if( FD_UNLIKELY( data_sz<32UL || !fd_ulong_is_aligned( (ulong)data, alignof(fd_prev_epoch_inflation_rewards_t) ) ) ) return NULL;
+  return (fd_prev_epoch_inflation_rewards_t const *)data;
+}
 
 void fd_vote_new( fd_vote_t * self );
 int fd_vote_decode( fd_vote_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_vote_decode_unsafe( fd_vote_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_vote_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_vote_t * fd_vote_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_decode_offsets( fd_vote_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_encode( fd_vote_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_vote_destroy( fd_vote_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6603,6 +7144,9 @@ void fd_vote_init_new( fd_vote_init_t * self );
 int fd_vote_init_decode( fd_vote_init_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_init_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_vote_init_decode_unsafe( fd_vote_init_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_vote_init_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_init_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_vote_init_t * fd_vote_init_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_init_decode_offsets( fd_vote_init_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_init_encode( fd_vote_init_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_vote_init_destroy( fd_vote_init_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6616,6 +7160,9 @@ void fd_vote_authorize_new( fd_vote_authorize_t * self );
 int fd_vote_authorize_decode( fd_vote_authorize_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_authorize_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_vote_authorize_decode_unsafe( fd_vote_authorize_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_vote_authorize_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_authorize_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_vote_authorize_t * fd_vote_authorize_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_authorize_encode( fd_vote_authorize_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_vote_authorize_destroy( fd_vote_authorize_t * self, fd_bincode_destroy_ctx_t * ctx );
 void fd_vote_authorize_walk( void * w, fd_vote_authorize_t const * self, fd_types_walk_fn_t fun, const char *name, uint level );
@@ -6633,6 +7180,9 @@ void fd_vote_authorize_pubkey_new( fd_vote_authorize_pubkey_t * self );
 int fd_vote_authorize_pubkey_decode( fd_vote_authorize_pubkey_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_authorize_pubkey_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_vote_authorize_pubkey_decode_unsafe( fd_vote_authorize_pubkey_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_vote_authorize_pubkey_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_authorize_pubkey_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_vote_authorize_pubkey_t * fd_vote_authorize_pubkey_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_authorize_pubkey_decode_offsets( fd_vote_authorize_pubkey_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_authorize_pubkey_encode( fd_vote_authorize_pubkey_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_vote_authorize_pubkey_destroy( fd_vote_authorize_pubkey_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6645,6 +7195,9 @@ void fd_vote_switch_new( fd_vote_switch_t * self );
 int fd_vote_switch_decode( fd_vote_switch_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_switch_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_vote_switch_decode_unsafe( fd_vote_switch_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_vote_switch_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_switch_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_vote_switch_t * fd_vote_switch_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_switch_decode_offsets( fd_vote_switch_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_switch_encode( fd_vote_switch_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_vote_switch_destroy( fd_vote_switch_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6657,6 +7210,9 @@ void fd_update_vote_state_switch_new( fd_update_vote_state_switch_t * self );
 int fd_update_vote_state_switch_decode( fd_update_vote_state_switch_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_update_vote_state_switch_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_update_vote_state_switch_decode_unsafe( fd_update_vote_state_switch_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_update_vote_state_switch_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_update_vote_state_switch_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_update_vote_state_switch_t * fd_update_vote_state_switch_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_update_vote_state_switch_decode_offsets( fd_update_vote_state_switch_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_update_vote_state_switch_encode( fd_update_vote_state_switch_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_update_vote_state_switch_destroy( fd_update_vote_state_switch_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6669,6 +7225,9 @@ void fd_vote_authorize_with_seed_args_new( fd_vote_authorize_with_seed_args_t *
 int fd_vote_authorize_with_seed_args_decode( fd_vote_authorize_with_seed_args_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_authorize_with_seed_args_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_vote_authorize_with_seed_args_decode_unsafe( fd_vote_authorize_with_seed_args_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_vote_authorize_with_seed_args_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_authorize_with_seed_args_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_vote_authorize_with_seed_args_t * fd_vote_authorize_with_seed_args_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_authorize_with_seed_args_decode_offsets( fd_vote_authorize_with_seed_args_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_authorize_with_seed_args_encode( fd_vote_authorize_with_seed_args_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_vote_authorize_with_seed_args_destroy( fd_vote_authorize_with_seed_args_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6681,6 +7240,9 @@ void fd_vote_authorize_checked_with_seed_args_new( fd_vote_authorize_checked_wit
 int fd_vote_authorize_checked_with_seed_args_decode( fd_vote_authorize_checked_with_seed_args_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_authorize_checked_with_seed_args_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_vote_authorize_checked_with_seed_args_decode_unsafe( fd_vote_authorize_checked_with_seed_args_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_vote_authorize_checked_with_seed_args_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_authorize_checked_with_seed_args_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_vote_authorize_checked_with_seed_args_t * fd_vote_authorize_checked_with_seed_args_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_authorize_checked_with_seed_args_decode_offsets( fd_vote_authorize_checked_with_seed_args_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_authorize_checked_with_seed_args_encode( fd_vote_authorize_checked_with_seed_args_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_vote_authorize_checked_with_seed_args_destroy( fd_vote_authorize_checked_with_seed_args_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6694,6 +7256,9 @@ void fd_vote_instruction_new( fd_vote_instruction_t * self );
 int fd_vote_instruction_decode( fd_vote_instruction_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_instruction_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_vote_instruction_decode_unsafe( fd_vote_instruction_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_vote_instruction_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_instruction_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_vote_instruction_t * fd_vote_instruction_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_instruction_encode( fd_vote_instruction_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_vote_instruction_destroy( fd_vote_instruction_t * self, fd_bincode_destroy_ctx_t * ctx );
 void fd_vote_instruction_walk( void * w, fd_vote_instruction_t const * self, fd_types_walk_fn_t fun, const char *name, uint level );
@@ -6739,6 +7304,9 @@ void fd_system_program_instruction_create_account_new( fd_system_program_instruc
 int fd_system_program_instruction_create_account_decode( fd_system_program_instruction_create_account_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_system_program_instruction_create_account_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_system_program_instruction_create_account_decode_unsafe( fd_system_program_instruction_create_account_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_system_program_instruction_create_account_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_system_program_instruction_create_account_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_system_program_instruction_create_account_t * fd_system_program_instruction_create_account_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_system_program_instruction_create_account_decode_offsets( fd_system_program_instruction_create_account_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_system_program_instruction_create_account_encode( fd_system_program_instruction_create_account_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_system_program_instruction_create_account_destroy( fd_system_program_instruction_create_account_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6746,11 +7314,21 @@ void fd_system_program_instruction_create_account_walk( void * w, fd_system_prog
 ulong fd_system_program_instruction_create_account_size( fd_system_program_instruction_create_account_t const * self );
 ulong fd_system_program_instruction_create_account_footprint( void );
 ulong fd_system_program_instruction_create_account_align( void );
+/* fd_system_program_instruction_create_account_view returns a zero-copy view of the fd_system_program_instruction_create_account_t encoded at
+   data (whose bincode encoding matches its in-memory layout).
+   Returns NULL if data_sz is too small or data is misaligned. */
+static inline fd_system_program_instruction_create_account_t const * fd_system_program_instruction_create_account_view( void const * data, ulong data_sz ) {
+  if( FD_UNLIKELY( data_sz<48UL || !fd_ulong_is_aligned( (ulong)data, alignof(fd_system_program_instruction_create_account_t) ) ) ) return NULL;
+  return (fd_system_program_instruction_create_account_t const *)data;
+}
 
 void fd_system_program_instruction_create_account_with_seed_new( fd_system_program_instruction_create_account_with_seed_t * self );
 int fd_system_program_instruction_create_account_with_seed_decode( fd_system_program_instruction_create_account_with_seed_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_system_program_instruction_create_account_with_seed_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_system_program_instruction_create_account_with_seed_decode_unsafe( fd_system_program_instruction_create_account_with_seed_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_system_program_instruction_create_account_with_seed_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_system_program_instruction_create_account_with_seed_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_system_program_instruction_create_account_with_seed_t * fd_system_program_instruction_create_account_with_seed_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_system_program_instruction_create_account_with_seed_decode_offsets( fd_system_program_instruction_create_account_with_seed_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_system_program_instruction_create_account_with_seed_encode( fd_system_program_instruction_create_account_with_seed_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_system_program_instruction_create_account_with_seed_destroy( fd_system_program_instruction_create_account_with_seed_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6763,6 +7341,9 @@ void fd_system_program_instruction_allocate_with_seed_new( fd_system_program_ins
 int fd_system_program_instruction_allocate_with_seed_decode( fd_system_program_instruction_allocate_with_seed_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_system_program_instruction_allocate_with_seed_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_system_program_instruction_allocate_with_seed_decode_unsafe( fd_system_program_instruction_allocate_with_seed_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_system_program_instruction_allocate_with_seed_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_system_program_instruction_allocate_with_seed_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_system_program_instruction_allocate_with_seed_t * fd_system_program_instruction_allocate_with_seed_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_system_program_instruction_allocate_with_seed_decode_offsets( fd_system_program_instruction_allocate_with_seed_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_system_program_instruction_allocate_with_seed_encode( fd_system_program_instruction_allocate_with_seed_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_system_program_instruction_allocate_with_seed_destroy( fd_system_program_instruction_allocate_with_seed_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6775,6 +7356,9 @@ void fd_system_program_instruction_assign_with_seed_new( fd_system_program_instr
 int fd_system_program_instruction_assign_with_seed_decode( fd_system_program_instruction_assign_with_seed_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_system_program_instruction_assign_with_seed_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_system_program_instruction_assign_with_seed_decode_unsafe( fd_system_program_instruction_assign_with_seed_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_system_program_instruction_assign_with_seed_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_system_program_instruction_assign_with_seed_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_system_program_instruction_assign_with_seed_t * fd_system_program_instruction_assign_with_seed_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_system_program_instruction_assign_with_seed_decode_offsets( fd_system_program_instruction_assign_with_seed_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_system_program_instruction_assign_with_seed_encode( fd_system_program_instruction_assign_with_seed_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_system_program_instruction_assign_with_seed_destroy( fd_system_program_instruction_assign_with_seed_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6787,6 +7371,9 @@ void fd_system_program_instruction_transfer_with_seed_new( fd_system_program_ins
 int fd_system_program_instruction_transfer_with_seed_decode( fd_system_program_instruction_transfer_with_seed_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_system_program_instruction_transfer_with_seed_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_system_program_instruction_transfer_with_seed_decode_unsafe( fd_system_program_instruction_transfer_with_seed_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_system_program_instruction_transfer_with_seed_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_system_program_instruction_transfer_with_seed_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_system_program_instruction_transfer_with_seed_t * fd_system_program_instruction_transfer_with_seed_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_system_program_instruction_transfer_with_seed_decode_offsets( fd_system_program_instruction_transfer_with_seed_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_system_program_instruction_transfer_with_seed_encode( fd_system_program_instruction_transfer_with_seed_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_system_program_instruction_transfer_with_seed_destroy( fd_system_program_instruction_transfer_with_seed_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6800,6 +7387,9 @@ void fd_system_program_instruction_new( fd_system_program_instruction_t * self )
 int fd_system_program_instruction_decode( fd_system_program_instruction_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_system_program_instruction_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_system_program_instruction_decode_unsafe( fd_system_program_instruction_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_system_program_instruction_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_system_program_instruction_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_system_program_instruction_t * fd_system_program_instruction_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_system_program_instruction_encode( fd_system_program_instruction_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_system_program_instruction_destroy( fd_system_program_instruction_t * self, fd_bincode_destroy_ctx_t * ctx );
 void fd_system_program_instruction_walk( void * w, fd_system_program_instruction_t const * self, fd_types_walk_fn_t fun, const char *name, uint level );
@@ -6840,6 +7430,9 @@ void fd_system_error_new( fd_system_error_t * self );
 int fd_system_error_decode( fd_system_error_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_system_error_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_system_error_decode_unsafe( fd_system_error_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_system_error_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_system_error_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_system_error_t * fd_system_error_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_system_error_encode( fd_system_error_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_system_error_destroy( fd_system_error_t * self, fd_bincode_destroy_ctx_t * ctx );
 void fd_system_error_walk( void * w, fd_system_error_t const * self, fd_types_walk_fn_t fun, const char *name, uint level );
@@ -6871,6 +7464,9 @@ void fd_stake_authorized_new( fd_stake_authorized_t * self );
 int fd_stake_authorized_decode( fd_stake_authorized_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_authorized_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_stake_authorized_decode_unsafe( fd_stake_authorized_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_stake_authorized_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_stake_authorized_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_stake_authorized_t * fd_stake_authorized_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_authorized_decode_offsets( fd_stake_authorized_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_authorized_encode( fd_stake_authorized_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_stake_authorized_destroy( fd_stake_authorized_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6878,11 +7474,21 @@ void fd_stake_authorized_walk( void * w, fd_stake_authorized_t const * self, fd_
 ulong fd_stake_authorized_size( fd_stake_authorized_t const * self );
 ulong fd_stake_authorized_footprint( void );
 ulong fd_stake_authorized_align( void );
+/* fd_stake_authorized_view returns a zero-copy view of the fd_stake_authorized_t encoded at
+   data (whose bincode encoding matches its in-memory layout).
+   Returns NULL if data_sz is too small or data is misaligned. */
+static inline fd_stake_authorized_t const * fd_stake_authorized_view( void const * data, ulong data_sz ) {
+  if( FD_UNLIKELY( data_sz<64UL || !fd_ulong_is_aligned( (ulong)data, alignof(fd_stake_authorized_t) ) ) ) return NULL;
+  return (fd_stake_authorized_t const *)data;
+}
 
 void fd_stake_lockup_new( fd_stake_lockup_t * self );
 int fd_stake_lockup_decode( fd_stake_lockup_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_lockup_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_stake_lockup_decode_unsafe( fd_stake_lockup_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_stake_lockup_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_stake_lockup_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_stake_lockup_t * fd_stake_lockup_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_lockup_decode_offsets( fd_stake_lockup_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_lockup_encode( fd_stake_lockup_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_stake_lockup_destroy( fd_stake_lockup_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6890,11 +7496,21 @@ void fd_stake_lockup_walk( void * w, fd_stake_lockup_t const * self, fd_types_wa
 ulong fd_stake_lockup_size( fd_stake_lockup_t const * self );
 ulong fd_stake_lockup_footprint( void );
 ulong fd_stake_lockup_align( void );
+/* fd_stake_lockup_view returns a zero-copy view of the fd_stake_lockup_t encoded at
+   data (whose bincode encoding matches its in-memory layout).
+   Returns NULL if data_sz is too small or data is misaligned. */
+static inline fd_stake_lockup_t const * fd_stake_lockup_view( void const * data, ulong data_sz ) {
+  if( FD_UNLIKELY( data_sz<48UL || !fd_ulong_is_aligned( (ulong)data, alignof(fd_stake_lockup_t) ) ) ) return NULL;
+  return (fd_stake_lockup_t const *)data;
+}
 
 void fd_stake_instruction_initialize_new( fd_stake_instruction_initialize_t * self );
 int fd_stake_instruction_initialize_decode( fd_stake_instruction_initialize_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_instruction_initialize_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_stake_instruction_initialize_decode_unsafe( fd_stake_instruction_initialize_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_stake_instruction_initialize_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_stake_instruction_initialize_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_stake_instruction_initialize_t * fd_stake_instruction_initialize_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_instruction_initialize_decode_offsets( fd_stake_instruction_initialize_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_instruction_initialize_encode( fd_stake_instruction_initialize_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_stake_instruction_initialize_destroy( fd_stake_instruction_initialize_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6902,11 +7518,21 @@ void fd_stake_instruction_initialize_walk( void * w, fd_stake_instruction_initia
 ulong fd_stake_instruction_initialize_size( fd_stake_instruction_initialize_t const * self );
 ulong fd_stake_instruction_initialize_footprint( void );
 ulong fd_stake_instruction_initialize_align( void );
+/* fd_stake_instruction_initialize_view returns a zero-copy view of the fd_stake_instruction_initialize_t encoded at
+   data (whose bincode encoding matches its in-memory layout).
+   Returns NULL if data_sz is too small or data is misaligned. */
+static inline fd_stake_instruction_initialize_t const * fd_stake_instruction_initialize_view( void const * data, ulong data_sz ) {
+  if( FD_UNLIKELY( data_sz<112UL || !fd_ulong_is_aligned( (ulong)data, alignof(fd_stake_instruction_initialize_t) ) ) ) return NULL;
+  return (fd_stake_instruction_initialize_t const *)data;
+}
 
 void fd_stake_lockup_custodian_args_new( fd_stake_lockup_custodian_args_t * self );
 int fd_stake_lockup_custodian_args_decode( fd_stake_lockup_custodian_args_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_lockup_custodian_args_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_stake_lockup_custodian_args_decode_unsafe( fd_stake_lockup_custodian_args_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_stake_lockup_custodian_args_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_stake_lockup_custodian_args_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_stake_lockup_custodian_args_t * fd_stake_lockup_custodian_args_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_lockup_custodian_args_decode_offsets( fd_stake_lockup_custodian_args_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_lockup_custodian_args_encode( fd_stake_lockup_custodian_args_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_stake_lockup_custodian_args_destroy( fd_stake_lockup_custodian_args_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6920,6 +7546,9 @@ void fd_stake_authorize_new( fd_stake_authorize_t * self );
 int fd_stake_authorize_decode( fd_stake_authorize_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_authorize_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_stake_authorize_decode_unsafe( fd_stake_authorize_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_stake_authorize_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_stake_authorize_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_stake_authorize_t * fd_stake_authorize_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_authorize_encode( fd_stake_authorize_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_stake_authorize_destroy( fd_stake_authorize_t * self, fd_bincode_destroy_ctx_t * ctx );
 void fd_stake_authorize_walk( void * w, fd_stake_authorize_t const * self, fd_types_walk_fn_t fun, const char *name, uint level );
@@ -6937,6 +7566,9 @@ void fd_stake_instruction_authorize_new( fd_stake_instruction_authorize_t * self
 int fd_stake_instruction_authorize_decode( fd_stake_instruction_authorize_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_instruction_authorize_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_stake_instruction_authorize_decode_unsafe( fd_stake_instruction_authorize_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_stake_instruction_authorize_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_stake_instruction_authorize_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_stake_instruction_authorize_t * fd_stake_instruction_authorize_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_instruction_authorize_decode_offsets( fd_stake_instruction_authorize_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_instruction_authorize_encode( fd_stake_instruction_authorize_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_stake_instruction_authorize_destroy( fd_stake_instruction_authorize_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6949,6 +7581,9 @@ void fd_authorize_with_seed_args_new( fd_authorize_with_seed_args_t * self );
 int fd_authorize_with_seed_args_decode( fd_authorize_with_seed_args_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_authorize_with_seed_args_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_authorize_with_seed_args_decode_unsafe( fd_authorize_with_seed_args_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_authorize_with_seed_args_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_authorize_with_seed_args_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_authorize_with_seed_args_t * fd_authorize_with_seed_args_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_authorize_with_seed_args_decode_offsets( fd_authorize_with_seed_args_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_authorize_with_seed_args_encode( fd_authorize_with_seed_args_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_authorize_with_seed_args_destroy( fd_authorize_with_seed_args_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6961,6 +7596,9 @@ void fd_authorize_checked_with_seed_args_new( fd_authorize_checked_with_seed_arg
 int fd_authorize_checked_with_seed_args_decode( fd_authorize_checked_with_seed_args_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_authorize_checked_with_seed_args_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_authorize_checked_with_seed_args_decode_unsafe( fd_authorize_checked_with_seed_args_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_authorize_checked_with_seed_args_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_authorize_checked_with_seed_args_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_authorize_checked_with_seed_args_t * fd_authorize_checked_with_seed_args_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_authorize_checked_with_seed_args_decode_offsets( fd_authorize_checked_with_seed_args_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_authorize_checked_with_seed_args_encode( fd_authorize_checked_with_seed_args_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_authorize_checked_with_seed_args_destroy( fd_authorize_checked_with_seed_args_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6973,6 +7611,9 @@ void fd_lockup_checked_args_new( fd_lockup_checked_args_t * self );
 int fd_lockup_checked_args_decode( fd_lockup_checked_args_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_lockup_checked_args_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_lockup_checked_args_decode_unsafe( fd_lockup_checked_args_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_lockup_checked_args_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_lockup_checked_args_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_lockup_checked_args_t * fd_lockup_checked_args_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_lockup_checked_args_decode_offsets( fd_lockup_checked_args_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_lockup_checked_args_encode( fd_lockup_checked_args_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_lockup_checked_args_destroy( fd_lockup_checked_args_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6985,6 +7626,9 @@ void fd_lockup_args_new( fd_lockup_args_t * self );
 int fd_lockup_args_decode( fd_lockup_args_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_lockup_args_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_lockup_args_decode_unsafe( fd_lockup_args_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_lockup_args_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_lockup_args_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_lockup_args_t * fd_lockup_args_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_lockup_args_decode_offsets( fd_lockup_args_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_lockup_args_encode( fd_lockup_args_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_lockup_args_destroy( fd_lockup_args_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -6998,6 +7642,9 @@ void fd_stake_instruction_new( fd_stake_instruction_t * self );
 int fd_stake_instruction_decode( fd_stake_instruction_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_instruction_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_stake_instruction_decode_unsafe( fd_stake_instruction_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_stake_instruction_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_stake_instruction_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_stake_instruction_t * fd_stake_instruction_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_instruction_encode( fd_stake_instruction_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_stake_instruction_destroy( fd_stake_instruction_t * self, fd_bincode_destroy_ctx_t * ctx );
 void fd_stake_instruction_walk( void * w, fd_stake_instruction_t const * self, fd_types_walk_fn_t fun, const char *name, uint level );
@@ -7047,6 +7694,9 @@ void fd_stake_meta_new( fd_stake_meta_t * self );
 int fd_stake_meta_decode( fd_stake_meta_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_meta_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_stake_meta_decode_unsafe( fd_stake_meta_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_stake_meta_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_stake_meta_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_stake_meta_t * fd_stake_meta_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_meta_decode_offsets( fd_stake_meta_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_meta_encode( fd_stake_meta_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_stake_meta_destroy( fd_stake_meta_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7054,11 +7704,21 @@ void fd_stake_meta_walk( void * w, fd_stake_meta_t const * self, fd_types_walk_f
 ulong fd_stake_meta_size( fd_stake_meta_t const * self );
 ulong fd_stake_meta_footprint( void );
 ulong fd_stake_meta_align( void );
+/* fd_stake_meta_view returns a zero-copy view of the fd_stake_meta_t encoded at
+   data (whose bincode encoding matches its in-memory layout).
+   Returns NULL if data_sz is too small or data is misaligned. */
+static inline fd_stake_meta_t const * fd_stake_meta_view( void const * data, ulong data_sz ) {
+  if( FD_UNLIKELY( data_sz<120UL || !fd_ulong_is_aligned( (ulong)data, alignof(fd_stake_meta_t) ) ) ) return NULL;
+  return (fd_stake_meta_t const *)data;
+}
 
 void fd_stake_flags_new( fd_stake_flags_t * self );
 int fd_stake_flags_decode( fd_stake_flags_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_flags_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_stake_flags_decode_unsafe( fd_stake_flags_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_stake_flags_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_stake_flags_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_stake_flags_t * fd_stake_flags_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_flags_decode_offsets( fd_stake_flags_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_flags_encode( fd_stake_flags_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_stake_flags_destroy( fd_stake_flags_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7071,6 +7731,9 @@ void fd_stake_state_v2_initialized_new( fd_stake_state_v2_initialized_t * self )
 int fd_stake_state_v2_initialized_decode( fd_stake_state_v2_initialized_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_state_v2_initialized_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_stake_state_v2_initialized_decode_unsafe( fd_stake_state_v2_initialized_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_stake_state_v2_initialized_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_stake_state_v2_initialized_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_stake_state_v2_initialized_t * fd_stake_state_v2_initialized_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_state_v2_initialized_decode_offsets( fd_stake_state_v2_initialized_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_state_v2_initialized_encode( fd_stake_state_v2_initialized_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_stake_state_v2_initialized_destroy( fd_stake_state_v2_initialized_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7078,11 +7741,21 @@ void fd_stake_state_v2_initialized_walk( void * w, fd_stake_state_v2_initialized
 ulong fd_stake_state_v2_initialized_size( fd_stake_state_v2_initialized_t const * self );
 ulong fd_stake_state_v2_initialized_footprint( void );
 ulong fd_stake_state_v2_initialized_align( void );
+/* fd_stake_state_v2_initialized_view returns a zero-copy view of the fd_stake_state_v2_initialized_t encoded at
+   data (whose bincode encoding matches its in-memory layout).
+   Returns NULL if data_sz is too small or data is misaligned. */
+static inline fd_stake_state_v2_initialized_t const * fd_stake_state_v2_initialized_view( void const * data, ulong data_sz ) {
+  if( FD_UNLIKELY( data_sz<120UL || !fd_ulong_is_aligned( (ulong)data, alignof(fd_stake_state_v2_initialized_t) ) ) ) return NULL;
+  return (fd_stake_state_v2_initialized_t const *)data;
+}
 
 void fd_stake_state_v2_stake_new( fd_stake_state_v2_stake_t * self );
 int fd_stake_state_v2_stake_decode( fd_stake_state_v2_stake_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_state_v2_stake_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_stake_state_v2_stake_decode_unsafe( fd_stake_state_v2_stake_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_stake_state_v2_stake_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_stake_state_v2_stake_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_stake_state_v2_stake_t * fd_stake_state_v2_stake_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_state_v2_stake_decode_offsets( fd_stake_state_v2_stake_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_state_v2_stake_encode( fd_stake_state_v2_stake_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_stake_state_v2_stake_destroy( fd_stake_state_v2_stake_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7096,6 +7769,9 @@ void fd_stake_state_v2_new( fd_stake_state_v2_t * self );
 int fd_stake_state_v2_decode( fd_stake_state_v2_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_state_v2_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_stake_state_v2_decode_unsafe( fd_stake_state_v2_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_stake_state_v2_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_stake_state_v2_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_stake_state_v2_t * fd_stake_state_v2_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_stake_state_v2_encode( fd_stake_state_v2_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_stake_state_v2_destroy( fd_stake_state_v2_t * self, fd_bincode_destroy_ctx_t * ctx );
 void fd_stake_state_v2_walk( void * w, fd_stake_state_v2_t const * self, fd_types_walk_fn_t fun, const char *name, uint level );
@@ -7117,6 +7793,9 @@ void fd_nonce_data_new( fd_nonce_data_t * self );
 int fd_nonce_data_decode( fd_nonce_data_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_nonce_data_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_nonce_data_decode_unsafe( fd_nonce_data_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_nonce_data_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_nonce_data_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_nonce_data_t * fd_nonce_data_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_nonce_data_decode_offsets( fd_nonce_data_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_nonce_data_encode( fd_nonce_data_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_nonce_data_destroy( fd_nonce_data_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7124,12 +7803,22 @@ void fd_nonce_data_walk( void * w, fd_nonce_data_t const * self, fd_types_walk_f
 ulong fd_nonce_data_size( fd_nonce_data_t const * self );
 ulong fd_nonce_data_footprint( void );
 ulong fd_nonce_data_align( void );
+/* fd_nonce_data_view returns a zero-copy view of the fd_nonce_data_t encoded at
+   data (whose bincode encoding matches its in-memory layout).
+   Returns NULL if data_sz is too small or data is misaligned. */
+static inline fd_nonce_data_t const * fd_nonce_data_view( void const * data, ulong data_sz ) {
+  if( FD_UNLIKELY( data_sz<72UL || !fd_ulong_is_aligned( (ulong)data, alignof(fd_nonce_data_t) ) ) ) return NULL;
+  return (fd_nonce_data_t const *)data;
+}
 
 void fd_nonce_state_new_disc( fd_nonce_state_t * self, uint discriminant );
 void fd_nonce_state_new( fd_nonce_state_t * self );
 int fd_nonce_state_decode( fd_nonce_state_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_nonce_state_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_nonce_state_decode_unsafe( fd_nonce_state_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_nonce_state_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_nonce_state_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_nonce_state_t * fd_nonce_state_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_nonce_state_encode( fd_nonce_state_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_nonce_state_destroy( fd_nonce_state_t * self, fd_bincode_destroy_ctx_t * ctx );
 void fd_nonce_state_walk( void * w, fd_nonce_state_t const * self, fd_types_walk_fn_t fun, const char *name, uint level );
@@ -7148,6 +7837,9 @@ void fd_nonce_state_versions_new( fd_nonce_state_versions_t * self );
 int fd_nonce_state_versions_decode( fd_nonce_state_versions_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_nonce_state_versions_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_nonce_state_versions_decode_unsafe( fd_nonce_state_versions_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_nonce_state_versions_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_nonce_state_versions_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_nonce_state_versions_t * fd_nonce_state_versions_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_nonce_state_versions_encode( fd_nonce_state_versions_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_nonce_state_versions_destroy( fd_nonce_state_versions_t * self, fd_bincode_destroy_ctx_t * ctx );
 void fd_nonce_state_versions_walk( void * w, fd_nonce_state_versions_t const * self, fd_types_walk_fn_t fun, const char *name, uint level );
@@ -7165,6 +7857,9 @@ void fd_compute_budget_program_instruction_request_units_deprecated_new( fd_comp
 int fd_compute_budget_program_instruction_request_units_deprecated_decode( fd_compute_budget_program_instruction_request_units_deprecated_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_compute_budget_program_instruction_request_units_deprecated_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_compute_budget_program_instruction_request_units_deprecated_decode_unsafe( fd_compute_budget_program_instruction_request_units_deprecated_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_compute_budget_program_instruction_request_units_deprecated_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_compute_budget_program_instruction_request_units_deprecated_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_compute_budget_program_instruction_request_units_deprecated_t * fd_compute_budget_program_instruction_request_units_deprecated_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_compute_budget_program_instruction_request_units_deprecated_decode_offsets( fd_compute_budget_program_instruction_request_units_deprecated_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_compute_budget_program_instruction_request_units_deprecated_encode( fd_compute_budget_program_instruction_request_units_deprecated_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_compute_budget_program_instruction_request_units_deprecated_destroy( fd_compute_budget_program_instruction_request_units_deprecated_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7172,12 +7867,22 @@ void fd_compute_budget_program_instruction_request_units_deprecated_walk( void *
 ulong fd_compute_budget_program_instruction_request_units_deprecated_size( fd_compute_budget_program_instruction_request_units_deprecated_t const * self );
 ulong fd_compute_budget_program_instruction_request_units_deprecated_footprint( void );
 ulong fd_compute_budget_program_instruction_request_units_deprecated_align( void );
+/* fd_compute_budget_program_instruction_request_units_deprecated_view returns a zero-copy view of the fd_compute_budget_program_instruction_request_units_deprecated_t encoded at
+   data (whose bincode encoding matches its in-memory layout).
+   Returns NULL if data_sz is too small or data is misaligned. */
+static inline fd_compute_budget_program_instruction_request_units_deprecated_t const * fd_compute_budget_program_instruction_request_units_deprecated_view( void const * data, ulong data_sz ) {
+  if( FD_UNLIKELY( data_sz<8UL || !fd_ulong_is_aligned( (ulong)data, alignof(fd_compute_budget_program_instruction_request_units_deprecated_t) ) ) ) return NULL;
+  return (fd_compute_budget_program_instruction_request_units_deprecated_t const *)data;
+}
 
 void fd_compute_budget_program_instruction_new_disc( fd_compute_budget_program_instruction_t * self, uint discriminant );
 void fd_compute_budget_program_instruction_new( fd_compute_budget_program_instruction_t * self );
 int fd_compute_budget_program_instruction_decode( fd_compute_budget_program_instruction_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_compute_budget_program_instruction_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_compute_budget_program_instruction_decode_unsafe( fd_compute_budget_program_instruction_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_compute_budget_program_instruction_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_compute_budget_program_instruction_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_compute_budget_program_instruction_t * fd_compute_budget_program_instruction_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_compute_budget_program_instruction_encode( fd_compute_budget_program_instruction_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_compute_budget_program_instruction_destroy( fd_compute_budget_program_instruction_t * self, fd_bincode_destroy_ctx_t * ctx );
 void fd_compute_budget_program_instruction_walk( void * w, fd_compute_budget_program_instruction_t const * self, fd_types_walk_fn_t fun, const char *name, uint level );
@@ -7201,6 +7906,9 @@ void fd_config_keys_new( fd_config_keys_t * self );
 int fd_config_keys_decode( fd_config_keys_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_config_keys_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_config_keys_decode_unsafe( fd_config_keys_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_config_keys_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_config_keys_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_config_keys_t * fd_config_keys_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_config_keys_decode_offsets( fd_config_keys_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_config_keys_encode( fd_config_keys_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_config_keys_destroy( fd_config_keys_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7213,6 +7921,9 @@ void fd_bpf_loader_program_instruction_write_new( fd_bpf_loader_program_instruct
 int fd_bpf_loader_program_instruction_write_decode( fd_bpf_loader_program_instruction_write_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_bpf_loader_program_instruction_write_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_bpf_loader_program_instruction_write_decode_unsafe( fd_bpf_loader_program_instruction_write_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_bpf_loader_program_instruction_write_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_bpf_loader_program_instruction_write_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_bpf_loader_program_instruction_write_t * fd_bpf_loader_program_instruction_write_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_bpf_loader_program_instruction_write_decode_offsets( fd_bpf_loader_program_instruction_write_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_bpf_loader_program_instruction_write_encode( fd_bpf_loader_program_instruction_write_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_bpf_loader_program_instruction_write_destroy( fd_bpf_loader_program_instruction_write_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7226,6 +7937,9 @@ void fd_bpf_loader_program_instruction_new( fd_bpf_loader_program_instruction_t
 int fd_bpf_loader_program_instruction_decode( fd_bpf_loader_program_instruction_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_bpf_loader_program_instruction_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_bpf_loader_program_instruction_decode_unsafe( fd_bpf_loader_program_instruction_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_bpf_loader_program_instruction_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_bpf_loader_program_instruction_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_bpf_loader_program_instruction_t * fd_bpf_loader_program_instruction_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_bpf_loader_program_instruction_encode( fd_bpf_loader_program_instruction_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_bpf_loader_program_instruction_destroy( fd_bpf_loader_program_instruction_t * self, fd_bincode_destroy_ctx_t * ctx );
 void fd_bpf_loader_program_instruction_walk( void * w, fd_bpf_loader_program_instruction_t const * self, fd_types_walk_fn_t fun, const char *name, uint level );
@@ -7243,6 +7957,9 @@ void fd_loader_v4_program_instruction_write_new( fd_loader_v4_program_instructio
 int fd_loader_v4_program_instruction_write_decode( fd_loader_v4_program_instruction_write_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_loader_v4_program_instruction_write_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_loader_v4_program_instruction_write_decode_unsafe( fd_loader_v4_program_instruction_write_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_loader_v4_program_instruction_write_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_loader_v4_program_instruction_write_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_loader_v4_program_instruction_write_t * fd_loader_v4_program_instruction_write_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_loader_v4_program_instruction_write_decode_offsets( fd_loader_v4_program_instruction_write_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_loader_v4_program_instruction_write_encode( fd_loader_v4_program_instruction_write_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_loader_v4_program_instruction_write_destroy( fd_loader_v4_program_instruction_write_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7255,6 +7972,9 @@ void fd_loader_v4_program_instruction_truncate_new( fd_loader_v4_program_instruc
 int fd_loader_v4_program_instruction_truncate_decode( fd_loader_v4_program_instruction_truncate_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_loader_v4_program_instruction_truncate_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_loader_v4_program_instruction_truncate_decode_unsafe( fd_loader_v4_program_instruction_truncate_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_loader_v4_program_instruction_truncate_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_loader_v4_program_instruction_truncate_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_loader_v4_program_instruction_truncate_t * fd_loader_v4_program_instruction_truncate_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_loader_v4_program_instruction_truncate_decode_offsets( fd_loader_v4_program_instruction_truncate_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_loader_v4_program_instruction_truncate_encode( fd_loader_v4_program_instruction_truncate_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_loader_v4_program_instruction_truncate_destroy( fd_loader_v4_program_instruction_truncate_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7268,6 +7988,9 @@ void fd_loader_v4_program_instruction_new( fd_loader_v4_program_instruction_t *
 int fd_loader_v4_program_instruction_decode( fd_loader_v4_program_instruction_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_loader_v4_program_instruction_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_loader_v4_program_instruction_decode_unsafe( fd_loader_v4_program_instruction_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_loader_v4_program_instruction_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_loader_v4_program_instruction_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_loader_v4_program_instruction_t * fd_loader_v4_program_instruction_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_loader_v4_program_instruction_encode( fd_loader_v4_program_instruction_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_loader_v4_program_instruction_destroy( fd_loader_v4_program_instruction_t * self, fd_bincode_destroy_ctx_t * ctx );
 void fd_loader_v4_program_instruction_walk( void * w, fd_loader_v4_program_instruction_t const * self, fd_types_walk_fn_t fun, const char *name, uint level );
@@ -7293,6 +8016,9 @@ void fd_bpf_upgradeable_loader_program_instruction_write_new( fd_bpf_upgradeable
 int fd_bpf_upgradeable_loader_program_instruction_write_decode( fd_bpf_upgradeable_loader_program_instruction_write_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_bpf_upgradeable_loader_program_instruction_write_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_bpf_upgradeable_loader_program_instruction_write_decode_unsafe( fd_bpf_upgradeable_loader_program_instruction_write_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_bpf_upgradeable_loader_program_instruction_write_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_bpf_upgradeable_loader_program_instruction_write_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_bpf_upgradeable_loader_program_instruction_write_t * fd_bpf_upgradeable_loader_program_instruction_write_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_bpf_upgradeable_loader_program_instruction_write_decode_offsets( fd_bpf_upgradeable_loader_program_instruction_write_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_bpf_upgradeable_loader_program_instruction_write_encode( fd_bpf_upgradeable_loader_program_instruction_write_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_bpf_upgradeable_loader_program_instruction_write_destroy( fd_bpf_upgradeable_loader_program_instruction_write_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7305,6 +8031,9 @@ void fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_new(
 int fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_decode( fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_decode_unsafe( fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_t * fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_decode_offsets( fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_encode( fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_destroy( fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7312,11 +8041,21 @@ void fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_walk
 ulong fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_size( fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_t const * self );
 ulong fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_footprint( void );
 ulong fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_align( void );
+/* fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_view returns a zero-copy view of the fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_t encoded at
+   data (whose bincode encoding matches its in-memory layout).
+   Returns NULL if data_sz is too small or data is misaligned. */
+static inline fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_t const * fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_view( void const * data, ulong data_sz ) {
+  if( FD_UNLIKELY( data_sz<8UL || !fd_ulong_is_aligned( (ulong)data, alignof(fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_t) ) ) ) return NULL;
+  return (fd_bpf_upgradeable_loader_program_instruction_deploy_with_max_data_len_t const *)data;
+}
 
 void fd_bpf_upgradeable_loader_program_instruction_extend_program_new( fd_bpf_upgradeable_loader_program_instruction_extend_program_t * self );
 int fd_bpf_upgradeable_loader_program_instruction_extend_program_decode( fd_bpf_upgradeable_loader_program_instruction_extend_program_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_bpf_upgradeable_loader_program_instruction_extend_program_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_bpf_upgradeable_loader_program_instruction_extend_program_decode_unsafe( fd_bpf_upgradeable_loader_program_instruction_extend_program_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_bpf_upgradeable_loader_program_instruction_extend_program_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_bpf_upgradeable_loader_program_instruction_extend_program_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_bpf_upgradeable_loader_program_instruction_extend_program_t * fd_bpf_upgradeable_loader_program_instruction_extend_program_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_bpf_upgradeable_loader_program_instruction_extend_program_decode_offsets( fd_bpf_upgradeable_loader_program_instruction_extend_program_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_bpf_upgradeable_loader_program_instruction_extend_program_encode( fd_bpf_upgradeable_loader_program_instruction_extend_program_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_bpf_upgradeable_loader_program_instruction_extend_program_destroy( fd_bpf_upgradeable_loader_program_instruction_extend_program_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7330,6 +8069,9 @@ void fd_bpf_upgradeable_loader_program_instruction_new( fd_bpf_upgradeable_loade
 int fd_bpf_upgradeable_loader_program_instruction_decode( fd_bpf_upgradeable_loader_program_instruction_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_bpf_upgradeable_loader_program_instruction_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_bpf_upgradeable_loader_program_instruction_decode_unsafe( fd_bpf_upgradeable_loader_program_instruction_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_bpf_upgradeable_loader_program_instruction_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_bpf_upgradeable_loader_program_instruction_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_bpf_upgradeable_loader_program_instruction_t * fd_bpf_upgradeable_loader_program_instruction_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_bpf_upgradeable_loader_program_instruction_encode( fd_bpf_upgradeable_loader_program_instruction_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_bpf_upgradeable_loader_program_instruction_destroy( fd_bpf_upgradeable_loader_program_instruction_t * self, fd_bincode_destroy_ctx_t * ctx );
 void fd_bpf_upgradeable_loader_program_instruction_walk( void * w, fd_bpf_upgradeable_loader_program_instruction_t const * self, fd_types_walk_fn_t fun, const char *name, uint level );
@@ -7359,6 +8101,9 @@ void fd_bpf_upgradeable_loader_state_buffer_new( fd_bpf_upgradeable_loader_state
 int fd_bpf_upgradeable_loader_state_buffer_decode( fd_bpf_upgradeable_loader_state_buffer_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_bpf_upgradeable_loader_state_buffer_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_bpf_upgradeable_loader_state_buffer_decode_unsafe( fd_bpf_upgradeable_loader_state_buffer_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_bpf_upgradeable_loader_state_buffer_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_bpf_upgradeable_loader_state_buffer_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_bpf_upgradeable_loader_state_buffer_t * fd_bpf_upgradeable_loader_state_buffer_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_bpf_upgradeable_loader_state_buffer_decode_offsets( fd_bpf_upgradeable_loader_state_buffer_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_bpf_upgradeable_loader_state_buffer_encode( fd_bpf_upgradeable_loader_state_buffer_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_bpf_upgradeable_loader_state_buffer_destroy( fd_bpf_upgradeable_loader_state_buffer_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7371,6 +8116,9 @@ void fd_bpf_upgradeable_loader_state_program_new( fd_bpf_upgradeable_loader_stat
 int fd_bpf_upgradeable_loader_state_program_decode( fd_bpf_upgradeable_loader_state_program_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_bpf_upgradeable_loader_state_program_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_bpf_upgradeable_loader_state_program_decode_unsafe( fd_bpf_upgradeable_loader_state_program_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_bpf_upgradeable_loader_state_program_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_bpf_upgradeable_loader_state_program_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_bpf_upgradeable_loader_state_program_t * fd_bpf_upgradeable_loader_state_program_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_bpf_upgradeable_loader_state_program_decode_offsets( fd_bpf_upgradeable_loader_state_program_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_bpf_upgradeable_loader_state_program_encode( fd_bpf_upgradeable_loader_state_program_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_bpf_upgradeable_loader_state_program_destroy( fd_bpf_upgradeable_loader_state_program_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7378,11 +8126,21 @@ void fd_bpf_upgradeable_loader_state_program_walk( void * w, fd_bpf_upgradeable_
 ulong fd_bpf_upgradeable_loader_state_program_size( fd_bpf_upgradeable_loader_state_program_t const * self );
 ulong fd_bpf_upgradeable_loader_state_program_footprint( void );
 ulong fd_bpf_upgradeable_loader_state_program_align( void );
+/* fd_bpf_upgradeable_loader_state_program_view returns a zero-copy view of the fd_bpf_upgradeable_loader_state_program_t encoded at
+   data (whose bincode encoding matches its in-memory layout).
+   Returns NULL if data_sz is too small or data is misaligned. */
+static inline fd_bpf_upgradeable_loader_state_program_t const * fd_bpf_upgradeable_loader_state_program_view( void const * data, ulong data_sz ) {
+  if( FD_UNLIKELY( data_sz<32UL || !fd_ulong_is_aligned( (ulong)data, alignof(fd_bpf_upgradeable_loader_state_program_t) ) ) ) return NULL;
+  return (fd_bpf_upgradeable_loader_state_program_t const *)data;
+}
 
 void fd_bpf_upgradeable_loader_state_program_data_new( fd_bpf_upgradeable_loader_state_program_data_t * self );
 int fd_bpf_upgradeable_loader_state_program_data_decode( fd_bpf_upgradeable_loader_state_program_data_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_bpf_upgradeable_loader_state_program_data_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_bpf_upgradeable_loader_state_program_data_decode_unsafe( fd_bpf_upgradeable_loader_state_program_data_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_bpf_upgradeable_loader_state_program_data_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_bpf_upgradeable_loader_state_program_data_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_bpf_upgradeable_loader_state_program_data_t * fd_bpf_upgradeable_loader_state_program_data_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_bpf_upgradeable_loader_state_program_data_decode_offsets( fd_bpf_upgradeable_loader_state_program_data_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_bpf_upgradeable_loader_state_program_data_encode( fd_bpf_upgradeable_loader_state_program_data_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_bpf_upgradeable_loader_state_program_data_destroy( fd_bpf_upgradeable_loader_state_program_data_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7396,6 +8154,9 @@ void fd_bpf_upgradeable_loader_state_new( fd_bpf_upgradeable_loader_state_t * se
 int fd_bpf_upgradeable_loader_state_decode( fd_bpf_upgradeable_loader_state_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_bpf_upgradeable_loader_state_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_bpf_upgradeable_loader_state_decode_unsafe( fd_bpf_upgradeable_loader_state_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_bpf_upgradeable_loader_state_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_bpf_upgradeable_loader_state_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_bpf_upgradeable_loader_state_t * fd_bpf_upgradeable_loader_state_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_bpf_upgradeable_loader_state_encode( fd_bpf_upgradeable_loader_state_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_bpf_upgradeable_loader_state_destroy( fd_bpf_upgradeable_loader_state_t * self, fd_bincode_destroy_ctx_t * ctx );
 void fd_bpf_upgradeable_loader_state_walk( void * w, fd_bpf_upgradeable_loader_state_t const * self, fd_types_walk_fn_t fun, const char *name, uint level );
@@ -7417,6 +8178,9 @@ void fd_loader_v4_state_new( fd_loader_v4_state_t * self );
 int fd_loader_v4_state_decode( fd_loader_v4_state_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_loader_v4_state_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_loader_v4_state_decode_unsafe( fd_loader_v4_state_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_loader_v4_state_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_loader_v4_state_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_loader_v4_state_t * fd_loader_v4_state_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_loader_v4_state_decode_offsets( fd_loader_v4_state_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_loader_v4_state_encode( fd_loader_v4_state_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_loader_v4_state_destroy( fd_loader_v4_state_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7424,11 +8188,21 @@ void fd_loader_v4_state_walk( void * w, fd_loader_v4_state_t const * self, fd_ty
 ulong fd_loader_v4_state_size( fd_loader_v4_state_t const * self );
 ulong fd_loader_v4_state_footprint( void );
 ulong fd_loader_v4_state_align( void );
+/* fd_loader_v4_state_view returns a zero-copy view of the fd_loader_v4_state_t encoded at
+   data (whose bincode encoding matches its in-memory layout).
+   Returns NULL if data_sz is too small or data is misaligned. */
+static inline fd_loader_v4_state_t const * fd_loader_v4_state_view( void const * data, ulong data_sz ) {
+  if( FD_UNLIKELY( data_sz<48UL || !fd_ulong_is_aligned( (ulong)data, alignof(fd_loader_v4_state_t) ) ) ) return NULL;
+  return (fd_loader_v4_state_t const *)data;
+}
 
 void fd_frozen_hash_status_new( fd_frozen_hash_status_t * self );
 int fd_frozen_hash_status_decode( fd_frozen_hash_status_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_frozen_hash_status_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_frozen_hash_status_decode_unsafe( fd_frozen_hash_status_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_frozen_hash_status_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_frozen_hash_status_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_frozen_hash_status_t * fd_frozen_hash_status_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_frozen_hash_status_decode_offsets( fd_frozen_hash_status_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_frozen_hash_status_encode( fd_frozen_hash_status_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_frozen_hash_status_destroy( fd_frozen_hash_status_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7442,6 +8216,9 @@ void fd_frozen_hash_versioned_new( fd_frozen_hash_versioned_t * self );
 int fd_frozen_hash_versioned_decode( fd_frozen_hash_versioned_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_frozen_hash_versioned_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_frozen_hash_versioned_decode_unsafe( fd_frozen_hash_versioned_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_frozen_hash_versioned_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_frozen_hash_versioned_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_frozen_hash_versioned_t * fd_frozen_hash_versioned_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_frozen_hash_versioned_encode( fd_frozen_hash_versioned_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_frozen_hash_versioned_destroy( fd_frozen_hash_versioned_t * self, fd_bincode_destroy_ctx_t * ctx );
 void fd_frozen_hash_versioned_walk( void * w, fd_frozen_hash_versioned_t const * self, fd_types_walk_fn_t fun, const char *name, uint level );
@@ -7457,6 +8234,9 @@ void fd_lookup_table_meta_new( fd_lookup_table_meta_t * self );
 int fd_lookup_table_meta_decode( fd_lookup_table_meta_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_lookup_table_meta_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_lookup_table_meta_decode_unsafe( fd_lookup_table_meta_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_lookup_table_meta_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_lookup_table_meta_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_lookup_table_meta_t * fd_lookup_table_meta_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_lookup_table_meta_decode_offsets( fd_lookup_table_meta_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_lookup_table_meta_encode( fd_lookup_table_meta_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_lookup_table_meta_destroy( fd_lookup_table_meta_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7469,6 +8249,9 @@ void fd_address_lookup_table_new( fd_address_lookup_table_t * self );
 int fd_address_lookup_table_decode( fd_address_lookup_table_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_address_lookup_table_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_address_lookup_table_decode_unsafe( fd_address_lookup_table_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_address_lookup_table_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_address_lookup_table_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_address_lookup_table_t * fd_address_lookup_table_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_address_lookup_table_decode_offsets( fd_address_lookup_table_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_address_lookup_table_encode( fd_address_lookup_table_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_address_lookup_table_destroy( fd_address_lookup_table_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7482,6 +8265,9 @@ void fd_address_lookup_table_state_new( fd_address_lookup_table_state_t * self )
 int fd_address_lookup_table_state_decode( fd_address_lookup_table_state_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_address_lookup_table_state_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_address_lookup_table_state_decode_unsafe( fd_address_lookup_table_state_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_address_lookup_table_state_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_address_lookup_table_state_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_address_lookup_table_state_t * fd_address_lookup_table_state_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_address_lookup_table_state_encode( fd_address_lookup_table_state_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_address_lookup_table_state_destroy( fd_address_lookup_table_state_t * self, fd_bincode_destroy_ctx_t * ctx );
 void fd_address_lookup_table_state_walk( void * w, fd_address_lookup_table_state_t const * self, fd_types_walk_fn_t fun, const char *name, uint level );
@@ -7499,6 +8285,9 @@ void fd_gossip_bitvec_u8_inner_new( fd_gossip_bitvec_u8_inner_t * self );
 int fd_gossip_bitvec_u8_inner_decode( fd_gossip_bitvec_u8_inner_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_bitvec_u8_inner_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_bitvec_u8_inner_decode_unsafe( fd_gossip_bitvec_u8_inner_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_gossip_bitvec_u8_inner_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_bitvec_u8_inner_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_gossip_bitvec_u8_inner_t * fd_gossip_bitvec_u8_inner_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_bitvec_u8_inner_decode_offsets( fd_gossip_bitvec_u8_inner_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_bitvec_u8_inner_encode( fd_gossip_bitvec_u8_inner_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_gossip_bitvec_u8_inner_destroy( fd_gossip_bitvec_u8_inner_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7511,6 +8300,9 @@ void fd_gossip_bitvec_u8_new( fd_gossip_bitvec_u8_t * self );
 int fd_gossip_bitvec_u8_decode( fd_gossip_bitvec_u8_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_bitvec_u8_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_bitvec_u8_decode_unsafe( fd_gossip_bitvec_u8_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_gossip_bitvec_u8_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_bitvec_u8_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_gossip_bitvec_u8_t * fd_gossip_bitvec_u8_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_bitvec_u8_decode_offsets( fd_gossip_bitvec_u8_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_bitvec_u8_encode( fd_gossip_bitvec_u8_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_gossip_bitvec_u8_destroy( fd_gossip_bitvec_u8_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7523,6 +8315,9 @@ void fd_gossip_bitvec_u64_inner_new( fd_gossip_bitvec_u64_inner_t * self );
 int fd_gossip_bitvec_u64_inner_decode( fd_gossip_bitvec_u64_inner_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_bitvec_u64_inner_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_bitvec_u64_inner_decode_unsafe( fd_gossip_bitvec_u64_inner_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_gossip_bitvec_u64_inner_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_bitvec_u64_inner_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_gossip_bitvec_u64_inner_t * fd_gossip_bitvec_u64_inner_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_bitvec_u64_inner_decode_offsets( fd_gossip_bitvec_u64_inner_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_bitvec_u64_inner_encode( fd_gossip_bitvec_u64_inner_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_gossip_bitvec_u64_inner_destroy( fd_gossip_bitvec_u64_inner_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7535,6 +8330,9 @@ void fd_gossip_bitvec_u64_new( fd_gossip_bitvec_u64_t * self );
 int fd_gossip_bitvec_u64_decode( fd_gossip_bitvec_u64_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_bitvec_u64_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_bitvec_u64_decode_unsafe( fd_gossip_bitvec_u64_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_gossip_bitvec_u64_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_bitvec_u64_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_gossip_bitvec_u64_t * fd_gossip_bitvec_u64_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_bitvec_u64_decode_offsets( fd_gossip_bitvec_u64_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_bitvec_u64_encode( fd_gossip_bitvec_u64_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_gossip_bitvec_u64_destroy( fd_gossip_bitvec_u64_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7547,6 +8345,9 @@ void fd_gossip_ping_new( fd_gossip_ping_t * self );
 int fd_gossip_ping_decode( fd_gossip_ping_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_ping_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_ping_decode_unsafe( fd_gossip_ping_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_gossip_ping_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_ping_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_gossip_ping_t * fd_gossip_ping_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_ping_decode_offsets( fd_gossip_ping_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_ping_encode( fd_gossip_ping_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_gossip_ping_destroy( fd_gossip_ping_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7554,12 +8355,22 @@ void fd_gossip_ping_walk( void * w, fd_gossip_ping_t const * self, fd_types_walk
 ulong fd_gossip_ping_size( fd_gossip_ping_t const * self );
 ulong fd_gossip_ping_footprint( void );
 ulong fd_gossip_ping_align( void );
+/* fd_gossip_ping_view returns a zero-copy view of the fd_gossip_ping_t encoded at
+   data (whose bincode encoding matches its in-memory layout).
+   Returns NULL if data_sz is too small or data is misaligned. */
+static inline fd_gossip_ping_t const * fd_gossip_ping_view( void const * data, ulong data_sz ) {
+  if( FD_UNLIKELY( data_sz<128UL || !fd_ulong_is_aligned( (ulong)data, alignof(fd_gossip_ping_t) ) ) ) return NULL;
+  return (fd_gossip_ping_t const *)data;
+}
 
 void fd_gossip_ip_addr_new_disc( fd_gossip_ip_addr_t * self, uint discriminant );
 void fd_gossip_ip_addr_new( fd_gossip_ip_addr_t * self );
 int fd_gossip_ip_addr_decode( fd_gossip_ip_addr_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_ip_addr_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_ip_addr_decode_unsafe( fd_gossip_ip_addr_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_gossip_ip_addr_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_ip_addr_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_gossip_ip_addr_t * fd_gossip_ip_addr_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_ip_addr_encode( fd_gossip_ip_addr_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_gossip_ip_addr_destroy( fd_gossip_ip_addr_t * self, fd_bincode_destroy_ctx_t * ctx );
 void fd_gossip_ip_addr_walk( void * w, fd_gossip_ip_addr_t const * self, fd_types_walk_fn_t fun, const char *name, uint level );
@@ -7577,6 +8388,9 @@ void fd_gossip_prune_data_new( fd_gossip_prune_data_t * self );
 int fd_gossip_prune_data_decode( fd_gossip_prune_data_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_prune_data_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_prune_data_decode_unsafe( fd_gossip_prune_data_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_gossip_prune_data_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_prune_data_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_gossip_prune_data_t * fd_gossip_prune_data_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_prune_data_decode_offsets( fd_gossip_prune_data_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_prune_data_encode( fd_gossip_prune_data_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_gossip_prune_data_destroy( fd_gossip_prune_data_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7589,6 +8403,9 @@ void fd_gossip_prune_sign_data_new( fd_gossip_prune_sign_data_t * self );
 int fd_gossip_prune_sign_data_decode( fd_gossip_prune_sign_data_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_prune_sign_data_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_prune_sign_data_decode_unsafe( fd_gossip_prune_sign_data_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_gossip_prune_sign_data_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_prune_sign_data_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_gossip_prune_sign_data_t * fd_gossip_prune_sign_data_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_prune_sign_data_decode_offsets( fd_gossip_prune_sign_data_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_prune_sign_data_encode( fd_gossip_prune_sign_data_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_gossip_prune_sign_data_destroy( fd_gossip_prune_sign_data_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7601,6 +8418,9 @@ void fd_gossip_prune_sign_data_with_prefix_new( fd_gossip_prune_sign_data_with_p
 int fd_gossip_prune_sign_data_with_prefix_decode( fd_gossip_prune_sign_data_with_prefix_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_prune_sign_data_with_prefix_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_prune_sign_data_with_prefix_decode_unsafe( fd_gossip_prune_sign_data_with_prefix_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_gossip_prune_sign_data_with_prefix_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_prune_sign_data_with_prefix_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_gossip_prune_sign_data_with_prefix_t * fd_gossip_prune_sign_data_with_prefix_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_prune_sign_data_with_prefix_decode_offsets( fd_gossip_prune_sign_data_with_prefix_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_prune_sign_data_with_prefix_encode( fd_gossip_prune_sign_data_with_prefix_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_gossip_prune_sign_data_with_prefix_destroy( fd_gossip_prune_sign_data_with_prefix_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7613,6 +8433,9 @@ void fd_gossip_socket_addr_old_new( fd_gossip_socket_addr_old_t * self );
 int fd_gossip_socket_addr_old_decode( fd_gossip_socket_addr_old_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_socket_addr_old_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_socket_addr_old_decode_unsafe( fd_gossip_socket_addr_old_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_gossip_socket_addr_old_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_socket_addr_old_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_gossip_socket_addr_old_t * fd_gossip_socket_addr_old_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_socket_addr_old_decode_offsets( fd_gossip_socket_addr_old_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_socket_addr_old_encode( fd_gossip_socket_addr_old_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_gossip_socket_addr_old_destroy( fd_gossip_socket_addr_old_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7625,6 +8448,9 @@ void fd_gossip_socket_addr_ip4_new( fd_gossip_socket_addr_ip4_t * self );
 int fd_gossip_socket_addr_ip4_decode( fd_gossip_socket_addr_ip4_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_socket_addr_ip4_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_socket_addr_ip4_decode_unsafe( fd_gossip_socket_addr_ip4_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_gossip_socket_addr_ip4_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_socket_addr_ip4_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_gossip_socket_addr_ip4_t * fd_gossip_socket_addr_ip4_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_socket_addr_ip4_decode_offsets( fd_gossip_socket_addr_ip4_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_socket_addr_ip4_encode( fd_gossip_socket_addr_ip4_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_gossip_socket_addr_ip4_destroy( fd_gossip_socket_addr_ip4_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7637,6 +8463,9 @@ void fd_gossip_socket_addr_ip6_new( fd_gossip_socket_addr_ip6_t * self );
 int fd_gossip_socket_addr_ip6_decode( fd_gossip_socket_addr_ip6_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_socket_addr_ip6_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_socket_addr_ip6_decode_unsafe( fd_gossip_socket_addr_ip6_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_gossip_socket_addr_ip6_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_socket_addr_ip6_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_gossip_socket_addr_ip6_t * fd_gossip_socket_addr_ip6_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_socket_addr_ip6_decode_offsets( fd_gossip_socket_addr_ip6_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_socket_addr_ip6_encode( fd_gossip_socket_addr_ip6_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_gossip_socket_addr_ip6_destroy( fd_gossip_socket_addr_ip6_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7650,6 +8479,9 @@ void fd_gossip_socket_addr_new( fd_gossip_socket_addr_t * self );
 int fd_gossip_socket_addr_decode( fd_gossip_socket_addr_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_socket_addr_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_socket_addr_decode_unsafe( fd_gossip_socket_addr_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_gossip_socket_addr_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_socket_addr_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_gossip_socket_addr_t * fd_gossip_socket_addr_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_socket_addr_encode( fd_gossip_socket_addr_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_gossip_socket_addr_destroy( fd_gossip_socket_addr_t * self, fd_bincode_destroy_ctx_t * ctx );
 void fd_gossip_socket_addr_walk( void * w, fd_gossip_socket_addr_t const * self, fd_types_walk_fn_t fun, const char *name, uint level );
@@ -7667,6 +8499,9 @@ void fd_gossip_contact_info_v1_new( fd_gossip_contact_info_v1_t * self );
 int fd_gossip_contact_info_v1_decode( fd_gossip_contact_info_v1_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_contact_info_v1_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_contact_info_v1_decode_unsafe( fd_gossip_contact_info_v1_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_gossip_contact_info_v1_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_contact_info_v1_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_gossip_contact_info_v1_t * fd_gossip_contact_info_v1_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_contact_info_v1_decode_offsets( fd_gossip_contact_info_v1_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_contact_info_v1_encode( fd_gossip_contact_info_v1_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_gossip_contact_info_v1_destroy( fd_gossip_contact_info_v1_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7679,6 +8514,9 @@ void fd_gossip_vote_new( fd_gossip_vote_t * self );
 int fd_gossip_vote_decode( fd_gossip_vote_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_vote_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_vote_decode_unsafe( fd_gossip_vote_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_gossip_vote_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_vote_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_gossip_vote_t * fd_gossip_vote_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_vote_decode_offsets( fd_gossip_vote_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_vote_encode( fd_gossip_vote_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_gossip_vote_destroy( fd_gossip_vote_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7691,6 +8529,9 @@ void fd_gossip_lowest_slot_new( fd_gossip_lowest_slot_t * self );
 int fd_gossip_lowest_slot_decode( fd_gossip_lowest_slot_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_lowest_slot_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_lowest_slot_decode_unsafe( fd_gossip_lowest_slot_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_gossip_lowest_slot_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_lowest_slot_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_gossip_lowest_slot_t * fd_gossip_lowest_slot_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_lowest_slot_decode_offsets( fd_gossip_lowest_slot_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_lowest_slot_encode( fd_gossip_lowest_slot_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_gossip_lowest_slot_destroy( fd_gossip_lowest_slot_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7703,6 +8544,9 @@ void fd_gossip_slot_hashes_new( fd_gossip_slot_hashes_t * self );
 int fd_gossip_slot_hashes_decode( fd_gossip_slot_hashes_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_slot_hashes_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_slot_hashes_decode_unsafe( fd_gossip_slot_hashes_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_gossip_slot_hashes_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_slot_hashes_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_gossip_slot_hashes_t * fd_gossip_slot_hashes_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_slot_hashes_decode_offsets( fd_gossip_slot_hashes_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_slot_hashes_encode( fd_gossip_slot_hashes_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_gossip_slot_hashes_destroy( fd_gossip_slot_hashes_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7715,6 +8559,9 @@ void fd_gossip_slots_new( fd_gossip_slots_t * self );
 int fd_gossip_slots_decode( fd_gossip_slots_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_slots_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_slots_decode_unsafe( fd_gossip_slots_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_gossip_slots_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_slots_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_gossip_slots_t * fd_gossip_slots_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_slots_decode_offsets( fd_gossip_slots_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_slots_encode( fd_gossip_slots_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_gossip_slots_destroy( fd_gossip_slots_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7727,6 +8574,9 @@ void fd_gossip_flate2_slots_new( fd_gossip_flate2_slots_t * self );
 int fd_gossip_flate2_slots_decode( fd_gossip_flate2_slots_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_flate2_slots_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_flate2_slots_decode_unsafe( fd_gossip_flate2_slots_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_gossip_flate2_slots_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_flate2_slots_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_gossip_flate2_slots_t * fd_gossip_flate2_slots_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_flate2_slots_decode_offsets( fd_gossip_flate2_slots_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_flate2_slots_encode( fd_gossip_flate2_slots_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_gossip_flate2_slots_destroy( fd_gossip_flate2_slots_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7740,6 +8590,9 @@ void fd_gossip_slots_enum_new( fd_gossip_slots_enum_t * self );
 int fd_gossip_slots_enum_decode( fd_gossip_slots_enum_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_slots_enum_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_slots_enum_decode_unsafe( fd_gossip_slots_enum_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_gossip_slots_enum_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_slots_enum_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_gossip_slots_enum_t * fd_gossip_slots_enum_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_slots_enum_encode( fd_gossip_slots_enum_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_gossip_slots_enum_destroy( fd_gossip_slots_enum_t * self, fd_bincode_destroy_ctx_t * ctx );
 void fd_gossip_slots_enum_walk( void * w, fd_gossip_slots_enum_t const * self, fd_types_walk_fn_t fun, const char *name, uint level );
@@ -7757,6 +8610,9 @@ void fd_gossip_epoch_slots_new( fd_gossip_epoch_slots_t * self );
 int fd_gossip_epoch_slots_decode( fd_gossip_epoch_slots_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_epoch_slots_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_epoch_slots_decode_unsafe( fd_gossip_epoch_slots_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_gossip_epoch_slots_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_epoch_slots_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_gossip_epoch_slots_t * fd_gossip_epoch_slots_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_epoch_slots_decode_offsets( fd_gossip_epoch_slots_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_epoch_slots_encode( fd_gossip_epoch_slots_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_gossip_epoch_slots_destroy( fd_gossip_epoch_slots_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7769,6 +8625,9 @@ void fd_gossip_version_v1_new( fd_gossip_version_v1_t * self );
 int fd_gossip_version_v1_decode( fd_gossip_version_v1_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_version_v1_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_version_v1_decode_unsafe( fd_gossip_version_v1_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_gossip_version_v1_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_version_v1_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_gossip_version_v1_t * fd_gossip_version_v1_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_version_v1_decode_offsets( fd_gossip_version_v1_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_version_v1_encode( fd_gossip_version_v1_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_gossip_version_v1_destroy( fd_gossip_version_v1_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7781,6 +8640,9 @@ void fd_gossip_version_v2_new( fd_gossip_version_v2_t * self );
 int fd_gossip_version_v2_decode( fd_gossip_version_v2_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_version_v2_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_version_v2_decode_unsafe( fd_gossip_version_v2_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_gossip_version_v2_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_version_v2_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_gossip_version_v2_t * fd_gossip_version_v2_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_version_v2_decode_offsets( fd_gossip_version_v2_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_version_v2_encode( fd_gossip_version_v2_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_gossip_version_v2_destroy( fd_gossip_version_v2_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7793,6 +8655,9 @@ void fd_gossip_version_v3_new( fd_gossip_version_v3_t * self );
 int fd_gossip_version_v3_decode( fd_gossip_version_v3_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_version_v3_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_version_v3_decode_unsafe( fd_gossip_version_v3_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_gossip_version_v3_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_version_v3_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_gossip_version_v3_t * fd_gossip_version_v3_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_version_v3_decode_offsets( fd_gossip_version_v3_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_version_v3_encode( fd_gossip_version_v3_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_gossip_version_v3_destroy( fd_gossip_version_v3_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7805,6 +8670,9 @@ void fd_gossip_node_instance_new( fd_gossip_node_instance_t * self );
 int fd_gossip_node_instance_decode( fd_gossip_node_instance_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_node_instance_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_node_instance_decode_unsafe( fd_gossip_node_instance_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_gossip_node_instance_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_node_instance_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_gossip_node_instance_t * fd_gossip_node_instance_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_node_instance_decode_offsets( fd_gossip_node_instance_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_node_instance_encode( fd_gossip_node_instance_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_gossip_node_instance_destroy( fd_gossip_node_instance_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7812,11 +8680,21 @@ void fd_gossip_node_instance_walk( void * w, fd_gossip_node_instance_t const * s
 ulong fd_gossip_node_instance_size( fd_gossip_node_instance_t const * self );
 ulong fd_gossip_node_instance_footprint( void );
 ulong fd_gossip_node_instance_align( void );
+/* fd_gossip_node_instance_view returns a zero-copy view of the fd_gossip_node_instance_t encoded at
+   data (whose bincode encoding matches its in-memory layout).
+   Returns NULL if data_sz is too small or data is misaligned. */
+static inline fd_gossip_node_instance_t const * fd_gossip_node_instance_view( void const * data, ulong data_sz ) {
+  if( FD_UNLIKELY( data_sz<56UL || !fd_ulong_is_aligned( (ulong)data, alignof(fd_gossip_node_instance_t) ) ) ) return NULL;
+  return (fd_gossip_node_instance_t const *)data;
+}
 
 void fd_gossip_duplicate_shred_new( fd_gossip_duplicate_shred_t * self );
 int fd_gossip_duplicate_shred_decode( fd_gossip_duplicate_shred_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_duplicate_shred_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_duplicate_shred_decode_unsafe( fd_gossip_duplicate_shred_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_gossip_duplicate_shred_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_duplicate_shred_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_gossip_duplicate_shred_t * fd_gossip_duplicate_shred_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_duplicate_shred_decode_offsets( fd_gossip_duplicate_shred_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_duplicate_shred_encode( fd_gossip_duplicate_shred_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_gossip_duplicate_shred_destroy( fd_gossip_duplicate_shred_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7829,6 +8707,9 @@ void fd_gossip_incremental_snapshot_hashes_new( fd_gossip_incremental_snapshot_h
 int fd_gossip_incremental_snapshot_hashes_decode( fd_gossip_incremental_snapshot_hashes_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_incremental_snapshot_hashes_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_incremental_snapshot_hashes_decode_unsafe( fd_gossip_incremental_snapshot_hashes_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_gossip_incremental_snapshot_hashes_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_incremental_snapshot_hashes_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_gossip_incremental_snapshot_hashes_t * fd_gossip_incremental_snapshot_hashes_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_incremental_snapshot_hashes_decode_offsets( fd_gossip_incremental_snapshot_hashes_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_incremental_snapshot_hashes_encode( fd_gossip_incremental_snapshot_hashes_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_gossip_incremental_snapshot_hashes_destroy( fd_gossip_incremental_snapshot_hashes_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7841,6 +8722,9 @@ void fd_gossip_socket_entry_new( fd_gossip_socket_entry_t * self );
 int fd_gossip_socket_entry_decode( fd_gossip_socket_entry_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_socket_entry_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_socket_entry_decode_unsafe( fd_gossip_socket_entry_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_gossip_socket_entry_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_socket_entry_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_gossip_socket_entry_t * fd_gossip_socket_entry_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_socket_entry_decode_offsets( fd_gossip_socket_entry_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_socket_entry_encode( fd_gossip_socket_entry_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_gossip_socket_entry_destroy( fd_gossip_socket_entry_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7853,6 +8737,9 @@ void fd_gossip_contact_info_v2_new( fd_gossip_contact_info_v2_t * self );
 int fd_gossip_contact_info_v2_decode( fd_gossip_contact_info_v2_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_contact_info_v2_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_contact_info_v2_decode_unsafe( fd_gossip_contact_info_v2_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_gossip_contact_info_v2_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_contact_info_v2_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_gossip_contact_info_v2_t * fd_gossip_contact_info_v2_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_contact_info_v2_decode_offsets( fd_gossip_contact_info_v2_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_contact_info_v2_encode( fd_gossip_contact_info_v2_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_gossip_contact_info_v2_destroy( fd_gossip_contact_info_v2_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7865,6 +8752,9 @@ void fd_restart_run_length_encoding_inner_new( fd_restart_run_length_encoding_in
 int fd_restart_run_length_encoding_inner_decode( fd_restart_run_length_encoding_inner_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_restart_run_length_encoding_inner_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_restart_run_length_encoding_inner_decode_unsafe( fd_restart_run_length_encoding_inner_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_restart_run_length_encoding_inner_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_restart_run_length_encoding_inner_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_restart_run_length_encoding_inner_t * fd_restart_run_length_encoding_inner_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_restart_run_length_encoding_inner_decode_offsets( fd_restart_run_length_encoding_inner_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_restart_run_length_encoding_inner_encode( fd_restart_run_length_encoding_inner_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_restart_run_length_encoding_inner_destroy( fd_restart_run_length_encoding_inner_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7877,6 +8767,9 @@ void fd_restart_run_length_encoding_new( fd_restart_run_length_encoding_t * self
 int fd_restart_run_length_encoding_decode( fd_restart_run_length_encoding_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_restart_run_length_encoding_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_restart_run_length_encoding_decode_unsafe( fd_restart_run_length_encoding_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_restart_run_length_encoding_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_restart_run_length_encoding_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_restart_run_length_encoding_t * fd_restart_run_length_encoding_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_restart_run_length_encoding_decode_offsets( fd_restart_run_length_encoding_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_restart_run_length_encoding_encode( fd_restart_run_length_encoding_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_restart_run_length_encoding_destroy( fd_restart_run_length_encoding_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7889,6 +8782,9 @@ void fd_restart_raw_offsets_bitvec_u8_inner_new( fd_restart_raw_offsets_bitvec_u
 int fd_restart_raw_offsets_bitvec_u8_inner_decode( fd_restart_raw_offsets_bitvec_u8_inner_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_restart_raw_offsets_bitvec_u8_inner_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_restart_raw_offsets_bitvec_u8_inner_decode_unsafe( fd_restart_raw_offsets_bitvec_u8_inner_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_restart_raw_offsets_bitvec_u8_inner_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_restart_raw_offsets_bitvec_u8_inner_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_restart_raw_offsets_bitvec_u8_inner_t * fd_restart_raw_offsets_bitvec_u8_inner_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_restart_raw_offsets_bitvec_u8_inner_decode_offsets( fd_restart_raw_offsets_bitvec_u8_inner_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_restart_raw_offsets_bitvec_u8_inner_encode( fd_restart_raw_offsets_bitvec_u8_inner_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_restart_raw_offsets_bitvec_u8_inner_destroy( fd_restart_raw_offsets_bitvec_u8_inner_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7901,6 +8797,9 @@ void fd_restart_raw_offsets_bitvec_new( fd_restart_raw_offsets_bitvec_t * self )
 int fd_restart_raw_offsets_bitvec_decode( fd_restart_raw_offsets_bitvec_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_restart_raw_offsets_bitvec_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_restart_raw_offsets_bitvec_decode_unsafe( fd_restart_raw_offsets_bitvec_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_restart_raw_offsets_bitvec_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_restart_raw_offsets_bitvec_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_restart_raw_offsets_bitvec_t * fd_restart_raw_offsets_bitvec_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_restart_raw_offsets_bitvec_decode_offsets( fd_restart_raw_offsets_bitvec_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_restart_raw_offsets_bitvec_encode( fd_restart_raw_offsets_bitvec_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_restart_raw_offsets_bitvec_destroy( fd_restart_raw_offsets_bitvec_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7913,6 +8812,9 @@ void fd_restart_raw_offsets_new( fd_restart_raw_offsets_t * self );
 int fd_restart_raw_offsets_decode( fd_restart_raw_offsets_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_restart_raw_offsets_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_restart_raw_offsets_decode_unsafe( fd_restart_raw_offsets_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_restart_raw_offsets_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_restart_raw_offsets_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_restart_raw_offsets_t * fd_restart_raw_offsets_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_restart_raw_offsets_decode_offsets( fd_restart_raw_offsets_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_restart_raw_offsets_encode( fd_restart_raw_offsets_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_restart_raw_offsets_destroy( fd_restart_raw_offsets_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7926,6 +8828,9 @@ void fd_restart_slots_offsets_new( fd_restart_slots_offsets_t * self );
 int fd_restart_slots_offsets_decode( fd_restart_slots_offsets_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_restart_slots_offsets_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_restart_slots_offsets_decode_unsafe( fd_restart_slots_offsets_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_restart_slots_offsets_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_restart_slots_offsets_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_restart_slots_offsets_t * fd_restart_slots_offsets_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_restart_slots_offsets_encode( fd_restart_slots_offsets_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_restart_slots_offsets_destroy( fd_restart_slots_offsets_t * self, fd_bincode_destroy_ctx_t * ctx );
 void fd_restart_slots_offsets_walk( void * w, fd_restart_slots_offsets_t const * self, fd_types_walk_fn_t fun, const char *name, uint level );
@@ -7943,6 +8848,9 @@ void fd_gossip_restart_last_voted_fork_slots_new( fd_gossip_restart_last_voted_f
 int fd_gossip_restart_last_voted_fork_slots_decode( fd_gossip_restart_last_voted_fork_slots_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_restart_last_voted_fork_slots_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_restart_last_voted_fork_slots_decode_unsafe( fd_gossip_restart_last_voted_fork_slots_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_gossip_restart_last_voted_fork_slots_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_restart_last_voted_fork_slots_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_gossip_restart_last_voted_fork_slots_t * fd_gossip_restart_last_voted_fork_slots_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_restart_last_voted_fork_slots_decode_offsets( fd_gossip_restart_last_voted_fork_slots_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_restart_last_voted_fork_slots_encode( fd_gossip_restart_last_voted_fork_slots_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_gossip_restart_last_voted_fork_slots_destroy( fd_gossip_restart_last_voted_fork_slots_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7955,6 +8863,9 @@ void fd_gossip_restart_heaviest_fork_new( fd_gossip_restart_heaviest_fork_t * se
 int fd_gossip_restart_heaviest_fork_decode( fd_gossip_restart_heaviest_fork_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_restart_heaviest_fork_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_restart_heaviest_fork_decode_unsafe( fd_gossip_restart_heaviest_fork_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_gossip_restart_heaviest_fork_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_restart_heaviest_fork_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_gossip_restart_heaviest_fork_t * fd_gossip_restart_heaviest_fork_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_restart_heaviest_fork_decode_offsets( fd_gossip_restart_heaviest_fork_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_restart_heaviest_fork_encode( fd_gossip_restart_heaviest_fork_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_gossip_restart_heaviest_fork_destroy( fd_gossip_restart_heaviest_fork_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -7968,6 +8879,9 @@ void fd_crds_data_new( fd_crds_data_t * self );
 int fd_crds_data_decode( fd_crds_data_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_crds_data_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_crds_data_decode_unsafe( fd_crds_data_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_crds_data_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_crds_data_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_crds_data_t * fd_crds_data_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_crds_data_encode( fd_crds_data_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_crds_data_destroy( fd_crds_data_t * self, fd_bincode_destroy_ctx_t * ctx );
 void fd_crds_data_walk( void * w, fd_crds_data_t const * self, fd_types_walk_fn_t fun, const char *name, uint level );
@@ -8009,6 +8923,9 @@ void fd_crds_bloom_new( fd_crds_bloom_t * self );
 int fd_crds_bloom_decode( fd_crds_bloom_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_crds_bloom_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_crds_bloom_decode_unsafe( fd_crds_bloom_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_crds_bloom_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_crds_bloom_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_crds_bloom_t * fd_crds_bloom_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_crds_bloom_decode_offsets( fd_crds_bloom_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_crds_bloom_encode( fd_crds_bloom_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_crds_bloom_destroy( fd_crds_bloom_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -8021,6 +8938,9 @@ void fd_crds_filter_new( fd_crds_filter_t * self );
 int fd_crds_filter_decode( fd_crds_filter_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_crds_filter_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_crds_filter_decode_unsafe( fd_crds_filter_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_crds_filter_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_crds_filter_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_crds_filter_t * fd_crds_filter_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_crds_filter_decode_offsets( fd_crds_filter_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_crds_filter_encode( fd_crds_filter_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_crds_filter_destroy( fd_crds_filter_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -8033,6 +8953,9 @@ void fd_crds_value_new( fd_crds_value_t * self );
 int fd_crds_value_decode( fd_crds_value_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_crds_value_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_crds_value_decode_unsafe( fd_crds_value_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_crds_value_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_crds_value_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_crds_value_t * fd_crds_value_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_crds_value_decode_offsets( fd_crds_value_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_crds_value_encode( fd_crds_value_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_crds_value_destroy( fd_crds_value_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -8045,6 +8968,9 @@ void fd_gossip_pull_req_new( fd_gossip_pull_req_t * self );
 int fd_gossip_pull_req_decode( fd_gossip_pull_req_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_pull_req_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_pull_req_decode_unsafe( fd_gossip_pull_req_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_gossip_pull_req_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_pull_req_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_gossip_pull_req_t * fd_gossip_pull_req_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_pull_req_decode_offsets( fd_gossip_pull_req_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_pull_req_encode( fd_gossip_pull_req_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_gossip_pull_req_destroy( fd_gossip_pull_req_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -8057,6 +8983,9 @@ void fd_gossip_pull_resp_new( fd_gossip_pull_resp_t * self );
 int fd_gossip_pull_resp_decode( fd_gossip_pull_resp_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_pull_resp_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_pull_resp_decode_unsafe( fd_gossip_pull_resp_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_gossip_pull_resp_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_pull_resp_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_gossip_pull_resp_t * fd_gossip_pull_resp_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_pull_resp_decode_offsets( fd_gossip_pull_resp_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_pull_resp_encode( fd_gossip_pull_resp_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_gossip_pull_resp_destroy( fd_gossip_pull_resp_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -8069,6 +8998,9 @@ void fd_gossip_push_msg_new( fd_gossip_push_msg_t * self );
 int fd_gossip_push_msg_decode( fd_gossip_push_msg_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_push_msg_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_push_msg_decode_unsafe( fd_gossip_push_msg_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_gossip_push_msg_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_push_msg_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_gossip_push_msg_t * fd_gossip_push_msg_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_push_msg_decode_offsets( fd_gossip_push_msg_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_push_msg_encode( fd_gossip_push_msg_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_gossip_push_msg_destroy( fd_gossip_push_msg_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -8081,6 +9013,9 @@ void fd_gossip_prune_msg_new( fd_gossip_prune_msg_t * self );
 int fd_gossip_prune_msg_decode( fd_gossip_prune_msg_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_prune_msg_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_prune_msg_decode_unsafe( fd_gossip_prune_msg_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_gossip_prune_msg_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_prune_msg_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_gossip_prune_msg_t * fd_gossip_prune_msg_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_prune_msg_decode_offsets( fd_gossip_prune_msg_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_prune_msg_encode( fd_gossip_prune_msg_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_gossip_prune_msg_destroy( fd_gossip_prune_msg_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -8094,6 +9029,9 @@ void fd_gossip_msg_new( fd_gossip_msg_t * self );
 int fd_gossip_msg_decode( fd_gossip_msg_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_msg_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_gossip_msg_decode_unsafe( fd_gossip_msg_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_gossip_msg_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_gossip_msg_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_gossip_msg_t * fd_gossip_msg_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_gossip_msg_encode( fd_gossip_msg_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_gossip_msg_destroy( fd_gossip_msg_t * self, fd_bincode_destroy_ctx_t * ctx );
 void fd_gossip_msg_walk( void * w, fd_gossip_msg_t const * self, fd_types_walk_fn_t fun, const char *name, uint level );
@@ -8119,6 +9057,9 @@ void fd_addrlut_create_new( fd_addrlut_create_t * self );
 int fd_addrlut_create_decode( fd_addrlut_create_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_addrlut_create_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_addrlut_create_decode_unsafe( fd_addrlut_create_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_addrlut_create_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_addrlut_create_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_addrlut_create_t * fd_addrlut_create_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_addrlut_create_decode_offsets( fd_addrlut_create_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_addrlut_create_encode( fd_addrlut_create_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_addrlut_create_destroy( fd_addrlut_create_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -8131,6 +9072,9 @@ void fd_addrlut_extend_new( fd_addrlut_extend_t * self );
 int fd_addrlut_extend_decode( fd_addrlut_extend_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_addrlut_extend_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_addrlut_extend_decode_unsafe( fd_addrlut_extend_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_addrlut_extend_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_addrlut_extend_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_addrlut_extend_t * fd_addrlut_extend_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_addrlut_extend_decode_offsets( fd_addrlut_extend_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_addrlut_extend_encode( fd_addrlut_extend_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_addrlut_extend_destroy( fd_addrlut_extend_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -8144,6 +9088,9 @@ void fd_addrlut_instruction_new( fd_addrlut_instruction_t * self );
 int fd_addrlut_instruction_decode( fd_addrlut_instruction_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_addrlut_instruction_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_addrlut_instruction_decode_unsafe( fd_addrlut_instruction_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_addrlut_instruction_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_addrlut_instruction_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_addrlut_instruction_t * fd_addrlut_instruction_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_addrlut_instruction_encode( fd_addrlut_instruction_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_addrlut_instruction_destroy( fd_addrlut_instruction_t * self, fd_bincode_destroy_ctx_t * ctx );
 void fd_addrlut_instruction_walk( void * w, fd_addrlut_instruction_t const * self, fd_types_walk_fn_t fun, const char *name, uint level );
@@ -8167,6 +9114,9 @@ void fd_repair_request_header_new( fd_repair_request_header_t * self );
 int fd_repair_request_header_decode( fd_repair_request_header_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_repair_request_header_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_repair_request_header_decode_unsafe( fd_repair_request_header_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_repair_request_header_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_repair_request_header_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_repair_request_header_t * fd_repair_request_header_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_repair_request_header_decode_offsets( fd_repair_request_header_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_repair_request_header_encode( fd_repair_request_header_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_repair_request_header_destroy( fd_repair_request_header_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -8179,6 +9129,9 @@ void fd_repair_window_index_new( fd_repair_window_index_t * self );
 int fd_repair_window_index_decode( fd_repair_window_index_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_repair_window_index_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_repair_window_index_decode_unsafe( fd_repair_window_index_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_repair_window_index_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_repair_window_index_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_repair_window_index_t * fd_repair_window_index_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_repair_window_index_decode_offsets( fd_repair_window_index_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_repair_window_index_encode( fd_repair_window_index_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_repair_window_index_destroy( fd_repair_window_index_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -8191,6 +9144,9 @@ void fd_repair_highest_window_index_new( fd_repair_highest_window_index_t * self
 int fd_repair_highest_window_index_decode( fd_repair_highest_window_index_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_repair_highest_window_index_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_repair_highest_window_index_decode_unsafe( fd_repair_highest_window_index_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_repair_highest_window_index_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_repair_highest_window_index_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_repair_highest_window_index_t * fd_repair_highest_window_index_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_repair_highest_window_index_decode_offsets( fd_repair_highest_window_index_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_repair_highest_window_index_encode( fd_repair_highest_window_index_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_repair_highest_window_index_destroy( fd_repair_highest_window_index_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -8203,6 +9159,9 @@ void fd_repair_orphan_new( fd_repair_orphan_t * self );
 int fd_repair_orphan_decode( fd_repair_orphan_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_repair_orphan_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_repair_orphan_decode_unsafe( fd_repair_orphan_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_repair_orphan_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_repair_orphan_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_repair_orphan_t * fd_repair_orphan_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_repair_orphan_decode_offsets( fd_repair_orphan_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_repair_orphan_encode( fd_repair_orphan_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_repair_orphan_destroy( fd_repair_orphan_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -8215,6 +9174,9 @@ void fd_repair_ancestor_hashes_new( fd_repair_ancestor_hashes_t * self );
 int fd_repair_ancestor_hashes_decode( fd_repair_ancestor_hashes_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_repair_ancestor_hashes_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_repair_ancestor_hashes_decode_unsafe( fd_repair_ancestor_hashes_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_repair_ancestor_hashes_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_repair_ancestor_hashes_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_repair_ancestor_hashes_t * fd_repair_ancestor_hashes_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_repair_ancestor_hashes_decode_offsets( fd_repair_ancestor_hashes_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_repair_ancestor_hashes_encode( fd_repair_ancestor_hashes_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_repair_ancestor_hashes_destroy( fd_repair_ancestor_hashes_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -8228,6 +9190,9 @@ void fd_repair_protocol_new( fd_repair_protocol_t * self );
 int fd_repair_protocol_decode( fd_repair_protocol_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_repair_protocol_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_repair_protocol_decode_unsafe( fd_repair_protocol_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_repair_protocol_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_repair_protocol_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_repair_protocol_t * fd_repair_protocol_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_repair_protocol_encode( fd_repair_protocol_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_repair_protocol_destroy( fd_repair_protocol_t * self, fd_bincode_destroy_ctx_t * ctx );
 void fd_repair_protocol_walk( void * w, fd_repair_protocol_t const * self, fd_types_walk_fn_t fun, const char *name, uint level );
@@ -8266,6 +9231,9 @@ void fd_repair_response_new( fd_repair_response_t * self );
 int fd_repair_response_decode( fd_repair_response_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_repair_response_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_repair_response_decode_unsafe( fd_repair_response_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_repair_response_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_repair_response_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_repair_response_t * fd_repair_response_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_repair_response_encode( fd_repair_response_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_repair_response_destroy( fd_repair_response_t * self, fd_bincode_destroy_ctx_t * ctx );
 void fd_repair_response_walk( void * w, fd_repair_response_t const * self, fd_types_walk_fn_t fun, const char *name, uint level );
@@ -8282,6 +9250,9 @@ void fd_instr_error_enum_new( fd_instr_error_enum_t * self );
 int fd_instr_error_enum_decode( fd_instr_error_enum_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_instr_error_enum_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_instr_error_enum_decode_unsafe( fd_instr_error_enum_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_instr_error_enum_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_instr_error_enum_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_instr_error_enum_t * fd_instr_error_enum_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_instr_error_enum_encode( fd_instr_error_enum_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_instr_error_enum_destroy( fd_instr_error_enum_t * self, fd_bincode_destroy_ctx_t * ctx );
 void fd_instr_error_enum_walk( void * w, fd_instr_error_enum_t const * self, fd_types_walk_fn_t fun, const char *name, uint level );
@@ -8403,6 +9374,9 @@ void fd_txn_instr_error_new( fd_txn_instr_error_t * self );
 int fd_txn_instr_error_decode( fd_txn_instr_error_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_txn_instr_error_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_txn_instr_error_decode_unsafe( fd_txn_instr_error_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_txn_instr_error_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_txn_instr_error_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_txn_instr_error_t * fd_txn_instr_error_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_txn_instr_error_decode_offsets( fd_txn_instr_error_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_txn_instr_error_encode( fd_txn_instr_error_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_txn_instr_error_destroy( fd_txn_instr_error_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -8416,6 +9390,9 @@ void fd_txn_error_enum_new( fd_txn_error_enum_t * self );
 int fd_txn_error_enum_decode( fd_txn_error_enum_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_txn_error_enum_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_txn_error_enum_decode_unsafe( fd_txn_error_enum_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_txn_error_enum_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_txn_error_enum_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_txn_error_enum_t * fd_txn_error_enum_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_txn_error_enum_encode( fd_txn_error_enum_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_txn_error_enum_destroy( fd_txn_error_enum_t * self, fd_bincode_destroy_ctx_t * ctx );
 void fd_txn_error_enum_walk( void * w, fd_txn_error_enum_t const * self, fd_types_walk_fn_t fun, const char *name, uint level );
@@ -8504,6 +9481,9 @@ void fd_txn_result_new( fd_txn_result_t * self );
 int fd_txn_result_decode( fd_txn_result_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_txn_result_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_txn_result_decode_unsafe( fd_txn_result_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_txn_result_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_txn_result_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_txn_result_t * fd_txn_result_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_txn_result_encode( fd_txn_result_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_txn_result_destroy( fd_txn_result_t * self, fd_bincode_destroy_ctx_t * ctx );
 void fd_txn_result_walk( void * w, fd_txn_result_t const * self, fd_types_walk_fn_t fun, const char *name, uint level );
@@ -8521,6 +9501,9 @@ void fd_cache_status_new( fd_cache_status_t * self );
 int fd_cache_status_decode( fd_cache_status_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_cache_status_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_cache_status_decode_unsafe( fd_cache_status_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_cache_status_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_cache_status_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_cache_status_t * fd_cache_status_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_cache_status_decode_offsets( fd_cache_status_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_cache_status_encode( fd_cache_status_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_cache_status_destroy( fd_cache_status_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -8533,6 +9516,9 @@ void fd_status_value_new( fd_status_value_t * self );
 int fd_status_value_decode( fd_status_value_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_status_value_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_status_value_decode_unsafe( fd_status_value_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_status_value_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_status_value_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_status_value_t * fd_status_value_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_status_value_decode_offsets( fd_status_value_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_status_value_encode( fd_status_value_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_status_value_destroy( fd_status_value_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -8545,6 +9531,9 @@ void fd_status_pair_new( fd_status_pair_t * self );
 int fd_status_pair_decode( fd_status_pair_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_status_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_status_pair_decode_unsafe( fd_status_pair_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_status_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_status_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_status_pair_t * fd_status_pair_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_status_pair_decode_offsets( fd_status_pair_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_status_pair_encode( fd_status_pair_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_status_pair_destroy( fd_status_pair_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -8557,6 +9546,9 @@ void fd_slot_delta_new( fd_slot_delta_t * self );
 int fd_slot_delta_decode( fd_slot_delta_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_slot_delta_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_slot_delta_decode_unsafe( fd_slot_delta_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_slot_delta_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_slot_delta_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_slot_delta_t * fd_slot_delta_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_slot_delta_decode_offsets( fd_slot_delta_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_slot_delta_encode( fd_slot_delta_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_slot_delta_destroy( fd_slot_delta_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -8569,6 +9561,9 @@ void fd_bank_slot_deltas_new( fd_bank_slot_deltas_t * self );
 int fd_bank_slot_deltas_decode( fd_bank_slot_deltas_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_bank_slot_deltas_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_bank_slot_deltas_decode_unsafe( fd_bank_slot_deltas_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_bank_slot_deltas_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_bank_slot_deltas_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_bank_slot_deltas_t * fd_bank_slot_deltas_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_bank_slot_deltas_decode_offsets( fd_bank_slot_deltas_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_bank_slot_deltas_encode( fd_bank_slot_deltas_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_bank_slot_deltas_destroy( fd_bank_slot_deltas_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -8581,6 +9576,9 @@ void fd_pubkey_rewardinfo_pair_new( fd_pubkey_rewardinfo_pair_t * self );
 int fd_pubkey_rewardinfo_pair_decode( fd_pubkey_rewardinfo_pair_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_pubkey_rewardinfo_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_pubkey_rewardinfo_pair_decode_unsafe( fd_pubkey_rewardinfo_pair_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_pubkey_rewardinfo_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_pubkey_rewardinfo_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_pubkey_rewardinfo_pair_t * fd_pubkey_rewardinfo_pair_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_pubkey_rewardinfo_pair_decode_offsets( fd_pubkey_rewardinfo_pair_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_pubkey_rewardinfo_pair_encode( fd_pubkey_rewardinfo_pair_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_pubkey_rewardinfo_pair_destroy( fd_pubkey_rewardinfo_pair_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -8593,6 +9591,9 @@ void fd_optional_account_new( fd_optional_account_t * self );
 int fd_optional_account_decode( fd_optional_account_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_optional_account_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_optional_account_decode_unsafe( fd_optional_account_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_optional_account_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_optional_account_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_optional_account_t * fd_optional_account_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_optional_account_decode_offsets( fd_optional_account_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_optional_account_encode( fd_optional_account_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_optional_account_destroy( fd_optional_account_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -8605,6 +9606,9 @@ void fd_calculated_stake_points_new( fd_calculated_stake_points_t * self );
 int fd_calculated_stake_points_decode( fd_calculated_stake_points_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_calculated_stake_points_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_calculated_stake_points_decode_unsafe( fd_calculated_stake_points_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_calculated_stake_points_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_calculated_stake_points_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_calculated_stake_points_t * fd_calculated_stake_points_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_calculated_stake_points_decode_offsets( fd_calculated_stake_points_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_calculated_stake_points_encode( fd_calculated_stake_points_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_calculated_stake_points_destroy( fd_calculated_stake_points_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -8617,6 +9621,9 @@ void fd_calculated_stake_rewards_new( fd_calculated_stake_rewards_t * self );
 int fd_calculated_stake_rewards_decode( fd_calculated_stake_rewards_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_calculated_stake_rewards_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_calculated_stake_rewards_decode_unsafe( fd_calculated_stake_rewards_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_calculated_stake_rewards_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_calculated_stake_rewards_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_calculated_stake_rewards_t * fd_calculated_stake_rewards_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_calculated_stake_rewards_decode_offsets( fd_calculated_stake_rewards_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_calculated_stake_rewards_encode( fd_calculated_stake_rewards_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_calculated_stake_rewards_destroy( fd_calculated_stake_rewards_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -8624,11 +9631,21 @@ void fd_calculated_stake_rewards_walk( void * w, fd_calculated_stake_rewards_t c
 ulong fd_calculated_stake_rewards_size( fd_calculated_stake_rewards_t const * self );
 ulong fd_calculated_stake_rewards_footprint( void );
 ulong fd_calculated_stake_rewards_align( void );
+/* fd_calculated_stake_rewards_view returns a zero-copy view of the fd_calculated_stake_rewards_t encoded at
+   data (whose bincode encoding matches its in-memory layout).
+   Returns NULL if data_sz is too small or data is misaligned. */
+static inline fd_calculated_stake_rewards_t const * fd_calculated_stake_rewards_view( void const * data, ulong data_sz ) {
+  if( FD_UNLIKELY( data_sz<24UL || !fd_ulong_is_aligned( (ulong)data, alignof(fd_calculated_stake_rewards_t) ) ) ) return NULL;
+  return (fd_calculated_stake_rewards_t const *)data;
+}
 
 void fd_duplicate_slot_proof_new( fd_duplicate_slot_proof_t * self );
 int fd_duplicate_slot_proof_decode( fd_duplicate_slot_proof_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_duplicate_slot_proof_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_duplicate_slot_proof_decode_unsafe( fd_duplicate_slot_proof_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_duplicate_slot_proof_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_duplicate_slot_proof_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_duplicate_slot_proof_t * fd_duplicate_slot_proof_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_duplicate_slot_proof_decode_offsets( fd_duplicate_slot_proof_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_duplicate_slot_proof_encode( fd_duplicate_slot_proof_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_duplicate_slot_proof_destroy( fd_duplicate_slot_proof_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -8641,6 +9658,9 @@ void fd_epoch_info_pair_new( fd_epoch_info_pair_t * self );
 int fd_epoch_info_pair_decode( fd_epoch_info_pair_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_epoch_info_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_epoch_info_pair_decode_unsafe( fd_epoch_info_pair_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_epoch_info_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_epoch_info_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_epoch_info_pair_t * fd_epoch_info_pair_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_epoch_info_pair_decode_offsets( fd_epoch_info_pair_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_epoch_info_pair_encode( fd_epoch_info_pair_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_epoch_info_pair_destroy( fd_epoch_info_pair_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -8648,11 +9668,21 @@ void fd_epoch_info_pair_walk( void * w, fd_epoch_info_pair_t const * self, fd_ty
 ulong fd_epoch_info_pair_size( fd_epoch_info_pair_t const * self );
 ulong fd_epoch_info_pair_footprint( void );
 ulong fd_epoch_info_pair_align( void );
+/* fd_epoch_info_pair_view returns a zero-copy view of the fd_epoch_info_pair_t encoded at
+   data (whose bincode encoding matches its in-memory layout).
+   Returns NULL if data_sz is too small or data is misaligned. */
+static inline fd_epoch_info_pair_t const * fd_epoch_info_pair_view( void const * data, ulong data_sz ) {
+  if( FD_UNLIKELY( data_sz<104UL || !fd_ulong_is_aligned( (ulong)data, alignof(fd_epoch_info_pair_t) ) ) ) return NULL;
+  return (fd_epoch_info_pair_t const *)data;
+}
 
 void fd_vote_info_pair_new( fd_vote_info_pair_t * self );
 int fd_vote_info_pair_decode( fd_vote_info_pair_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_info_pair_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_vote_info_pair_decode_unsafe( fd_vote_info_pair_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_vote_info_pair_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_vote_info_pair_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_vote_info_pair_t * fd_vote_info_pair_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_info_pair_decode_offsets( fd_vote_info_pair_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_vote_info_pair_encode( fd_vote_info_pair_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_vote_info_pair_destroy( fd_vote_info_pair_t * self, fd_bincode_destroy_ctx_t * ctx );
@@ -8665,6 +9695,9 @@ void fd_epoch_info_new( fd_epoch_info_t * self );
 int fd_epoch_info_decode( fd_epoch_info_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_epoch_info_decode_preflight( fd_bincode_decode_ctx_t * ctx );
 void fd_epoch_info_decode_unsafe( fd_epoch_info_t * self, fd_bincode_decode_ctx_t * ctx );
+int fd_epoch_info_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+int fd_epoch_info_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+fd_epoch_info_t * fd_epoch_info_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );
 int fd_epoch_info_decode_offsets( fd_epoch_info_off_t * self, fd_bincode_decode_ctx_t * ctx );
 int fd_epoch_info_encode( fd_epoch_info_t const * self, fd_bincode_encode_ctx_t * ctx );
 void fd_epoch_info_destroy( fd_epoch_info_t * self, fd_bincode_destroy_ctx_t * ctx );
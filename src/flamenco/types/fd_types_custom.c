@@ -91,6 +91,19 @@ int fd_tower_sync_decode( fd_tower_sync_t * self, fd_bincode_decode_ctx_t * ctx
 }
 
 int fd_tower_sync_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
+  ulong total_sz = 0UL;
+  return fd_tower_sync_decode_footprint_inner( ctx, &total_sz );
+}
+
+int fd_tower_sync_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_tower_sync_t);
+  int err = fd_tower_sync_decode_footprint_inner( ctx, total_sz );
+  ctx->data = start_data;
+  return err;
+}
+
+int fd_tower_sync_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
   FD_SCRATCH_SCOPE_BEGIN {
     // https://github.com/anza-xyz/agave/blob/v2.0.1/sdk/program/src/vote/state/mod.rs#L1054-L1060
     fd_compact_tower_sync_t compact_tower_sync[1];
@@ -110,6 +123,10 @@ int fd_tower_sync_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
       err = __builtin_uaddl_overflow( root, lockout_offset->offset, &root );
       if( FD_UNLIKELY( err ) ) return err;
     }
+
+    /* See fd_tower_sync_decode_unsafe */
+    ulong lockout_offsets_max = fd_ulong_max( deq_fd_lockout_offset_t_cnt( compact_tower_sync->lockout_offsets ), 32 );
+    *total_sz = fd_bincode_footprint_alloc( *total_sz, deq_fd_vote_lockout_t_align(), deq_fd_vote_lockout_t_footprint( lockout_offsets_max ) );
     return FD_BINCODE_SUCCESS;
   } FD_SCRATCH_SCOPE_END;
 }
@@ -149,6 +166,16 @@ void fd_tower_sync_decode_unsafe( fd_tower_sync_t * self, fd_bincode_decode_ctx_
   fd_hash_decode_unsafe( &self->block_id, ctx );
 }
 
+fd_tower_sync_t * fd_tower_sync_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {
+  fd_tower_sync_t * self = (fd_tower_sync_t *)mem;
+  fd_bincode_arena_t arena[1] = {{ .cur = (ulong)mem + sizeof(fd_tower_sync_t) }};
+  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };
+  fd_tower_sync_new( self );
+  fd_tower_sync_decode_unsafe( self, &inner_ctx );
+  ctx->data = inner_ctx.data;
+  return self;
+}
+
 int fd_tower_sync_decode_offsets( fd_tower_sync_off_t * self, fd_bincode_decode_ctx_t * ctx ) {
   FD_LOG_ERR(( "todo"));
 }
@@ -187,6 +214,12 @@ int fd_solana_vote_account_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {
   return FD_BINCODE_SUCCESS;
 }
 
+/* fd_solana_vote_account_t has no dynamic members */
+
+int fd_solana_vote_account_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {
+  return fd_solana_vote_account_decode_preflight( ctx );
+}
+
 void fd_solana_vote_account_decode_unsafe( fd_solana_vote_account_t * self, fd_bincode_decode_ctx_t * ctx ) {
   fd_bincode_uint64_decode_unsafe( &self->lamports, ctx );
   ulong data_len;
@@ -318,6 +351,28 @@ int fd_solana_vote_account_encode( fd_solana_vote_account_t const * self, fd_bin
   return FD_BINCODE_SUCCESS;
 }
 
+static void *
+fd_bincode_arena_malloc_virtual( void * _self,
+                                 ulong  align,
+                                 ulong  sz ) {
+  fd_bincode_arena_t * arena = (fd_bincode_arena_t *)_self;
+  ulong mem  = fd_ulong_align_up( arena->cur, align );
+  arena->cur = mem + sz;
+  return (void *)mem;
+}
+
+static void
+fd_bincode_arena_free_virtual( void * _self,
+                               void * _addr ) {
+  (void)_self; (void)_addr;
+}
+
+const fd_valloc_vtable_t
+fd_bincode_arena_vtable = {
+  .malloc = fd_bincode_arena_malloc_virtual,
+  .free   = fd_bincode_arena_free_virtual
+};
+
 int fd_archive_decode_skip_field( fd_bincode_decode_ctx_t * ctx, ushort tag ) {
   /* Extract the meta tag */
   tag = tag & (ushort)((1<<6)-1);
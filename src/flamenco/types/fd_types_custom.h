@@ -46,6 +46,9 @@ FD_PROTOTYPES_BEGIN
 #define fd_pubkey_decode           fd_hash_decode
 #define fd_pubkey_decode_preflight fd_hash_decode_preflight
 #define fd_pubkey_decode_unsafe    fd_hash_decode_unsafe
+#define fd_pubkey_decode_footprint fd_hash_decode_footprint
+#define fd_pubkey_decode_footprint_inner fd_hash_decode_footprint_inner
+#define fd_pubkey_decode_inner     fd_hash_decode_inner
 #define fd_pubkey_encode           fd_hash_encode
 #define fd_pubkey_decode_archival  fd_hash_decode
 #define fd_pubkey_encode_archival  fd_hash_encode
@@ -124,6 +127,9 @@ fd_solana_vote_account_decode_unsafe( fd_solana_vote_account_t * self, fd_bincod
 
 #define fd_solana_vote_account_decode_archival_unsafe fd_solana_vote_account_decode_unsafe
 
+int
+fd_solana_vote_account_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );
+
 int
 fd_solana_vote_account_encode( fd_solana_vote_account_t const * self, fd_bincode_encode_ctx_t * ctx );
 
@@ -174,6 +180,31 @@ void
 fd_flamenco_txn_decode_unsafe( fd_flamenco_txn_t *       self,
                                fd_bincode_decode_ctx_t * ctx );
 
+/* fd_flamenco_txn_t has no dynamic members */
+
+static inline int
+fd_flamenco_txn_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx,
+                                        ulong *                   total_sz FD_FN_UNUSED ) {
+  return fd_flamenco_txn_decode_preflight( ctx );
+}
+
+static inline int
+fd_flamenco_txn_decode_footprint( fd_bincode_decode_ctx_t * ctx,
+                                  ulong *                   total_sz ) {
+  void const * start_data = ctx->data;
+  *total_sz = sizeof(fd_flamenco_txn_t);
+  int err = fd_flamenco_txn_decode_preflight( ctx );
+  ctx->data = start_data;
+  return err;
+}
+
+static inline fd_flamenco_txn_t *
+fd_flamenco_txn_decode_inner( void *                    mem,
+                              fd_bincode_decode_ctx_t * ctx ) {
+  fd_flamenco_txn_decode_unsafe( (fd_flamenco_txn_t *)mem, ctx );
+  return (fd_flamenco_txn_t *)mem;
+}
+
 static inline void
 fd_flamenco_txn_destroy( fd_flamenco_txn_t const *  self FD_FN_UNUSED,
                          fd_bincode_destroy_ctx_t * ctx  FD_FN_UNUSED ) {}
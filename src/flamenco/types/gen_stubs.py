@@ -85,6 +85,74 @@ fuzzytypes = {
     "uchar[2048]",
 }
 
+# In-memory alignment of fuzzy types.  Opaque hash types are unions
+# including a ulong array.
+fuzzyalign = {
+    "char": 1, "uchar": 1,
+    "short": 2, "ushort": 2,
+    "int": 4, "uint": 4,
+    "long": 8, "ulong": 8,
+    "double": 8,
+    "uint128": 16,
+    "pubkey": 8,
+    "hash": 8,
+    "signature": 8,
+    "uchar[32]": 1,
+    "uchar[128]": 1,
+    "uchar[2048]": 1,
+}
+
+# Map from struct name to StructType
+structtypes = dict()
+
+# Returns the alignment of fuzzy type t if its in-memory layout is
+# byte-for-byte identical to its bincode encoding, None otherwise
+def viewAlign(t):
+    if t in fuzzyalign:
+        return fuzzyalign[t]
+    if t in structtypes:
+        return structtypes[t].viewAlign()
+    return None
+
+# Returns the call validating a nested object of type t.  Outside of
+# archival decoding this also accounts for its dynamic allocations in
+# the enclosing footprint (see fd_bincode.h, single arena decoding).
+def preflightCall(t, archival):
+    if archival:
+        return f'{t}_decode_archival_preflight( ctx )'
+    return f'{t}_decode_footprint_inner( ctx, total_sz )'
+
+# Emits the footprint accounting for an allocation decode_unsafe makes
+def emitFootprintAlloc(ind, archival, align, sz):
+    if not archival:
+        print(f'{ind}*total_sz = fd_bincode_footprint_alloc( *total_sz, {align}, {sz} );', file=body)
+
+# Emits the decode_preflight, decode_footprint and decode_inner entry
+# points of type n on top of n_decode_footprint_inner
+def emitDecodeFootprint(n):
+    print(f'int {n}_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {{', file=body)
+    print('  ulong total_sz = 0UL;', file=body)
+    print(f'  return {n}_decode_footprint_inner( ctx, &total_sz );', file=body)
+    print('}', file=body)
+    print(f'int {n}_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {{', file=body)
+    print('  void const * start_data = ctx->data;', file=body)
+    print(f'  *total_sz = sizeof({n}_t);', file=body)
+    print(f'  int err = {n}_decode_footprint_inner( ctx, total_sz );', file=body)
+    print('  ctx->data = start_data;', file=body)
+    print('  return err;', file=body)
+    print('}', file=body)
+
+def emitDecodeInner(n):
+    print(f'{n}_t * {n}_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx ) {{', file=body)
+    print(f'  {n}_t * self = ({n}_t *)mem;', file=body)
+    print(f'  fd_bincode_arena_t arena[1] = {{{{ .cur = (ulong)mem + sizeof({n}_t) }}}};', file=body)
+    print('  fd_bincode_decode_ctx_t inner_ctx = { .data = ctx->data, .dataend = ctx->dataend, .valloc = fd_bincode_arena_virtual( arena ) };', file=body)
+    print(f'  {n}_new( self );', file=body)
+    print(f'  {n}_decode_unsafe( self, &inner_ctx );', file=body)
+    print('  ctx->data = inner_ctx.data;', file=body)
+    print('  return self;', file=body)
+    print('}', file=body)
+
 class TypeNode:
     def __init__(self, json):
         self.name = json["name"]
@@ -166,12 +234,13 @@ class PrimitiveMember(TypeNode):
             return False
         return self.type in fuzzytypes
 
-    def string_decode_preflight(n, varint):
+    def string_decode_preflight(n, varint, archival):
         print(f'{indent}  ulong slen;', file=body)
         print(f'{indent}  err = fd_bincode_uint64_decode( &slen, ctx );', file=body)
         print(f'{indent}  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;', file=body)
         print(f'{indent}  err = fd_bincode_bytes_decode_preflight( slen, ctx );', file=body)
         print(f'{indent}  if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;', file=body)
+        emitFootprintAlloc(f'{indent}  ', archival, '1UL', 'slen + 1')
 
     def ushort_decode_preflight(n, varint):
         if varint:
@@ -189,7 +258,6 @@ class PrimitiveMember(TypeNode):
 
     emitDecodePreflightMap = {
         "char" :      lambda n, varint: print(f'{indent}  err = fd_bincode_uint8_decode_preflight( ctx );\n  if( FD_UNLIKELY( err ) ) return err;', file=body),
-        "char*" :     lambda n, varint: PrimitiveMember.string_decode_preflight(n, varint),
         "char[32]" :  lambda n, varint: print(f'{indent}  err = fd_bincode_bytes_decode_preflight( 32, ctx );\n  if( FD_UNLIKELY( err ) ) return err;', file=body),
         "double" :    lambda n, varint: print(f'{indent}  err = fd_bincode_double_decode_preflight( ctx );\n  if( FD_UNLIKELY( err ) ) return err;', file=body),
         "long" :      lambda n, varint: print(f'{indent}  err = fd_bincode_uint64_decode_preflight( ctx );\n  if( FD_UNLIKELY( err ) ) return err;', file=body),
@@ -206,7 +274,10 @@ class PrimitiveMember(TypeNode):
 
     def emitDecodePreflight(self, archival):
         if self.decode:
-            PrimitiveMember.emitDecodePreflightMap[self.type](self.name, self.varint);
+            if self.type == "char*":
+                PrimitiveMember.string_decode_preflight(self.name, self.varint, archival)
+            else:
+                PrimitiveMember.emitDecodePreflightMap[self.type](self.name, self.varint);
 
     def string_decode_unsafe(n, varint):
         print(f'{indent}  ulong slen;', file=body)
@@ -398,7 +469,7 @@ class StructMember(TypeNode):
 
     def emitDecodePreflight(self, archival):
         atag = ('_archival' if archival else '')
-        print(f'{indent}  err = {namespace}_{self.type}_decode{atag}_preflight( ctx );', file=body)
+        print(f'{indent}  err = {preflightCall(namespace+"_"+self.type, archival)};', file=body)
         print(f'{indent}  if( FD_UNLIKELY( err ) ) return err;', file=body)
 
     def emitDecodeUnsafe(self, archival):
@@ -479,16 +550,21 @@ class VectorMember(TypeNode):
         el = el.upper()
 
         if self.element == "uchar":
+            emitFootprintAlloc('    ', archival, '8UL', f'{self.name}_len')
             print(f'    err = fd_bincode_bytes_decode_preflight( {self.name}_len, ctx );', file=body)
             print(f'    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;', file=body)
 
         else:
+            if self.element in simpletypes:
+                emitFootprintAlloc('    ', archival, '8UL', f'sizeof({self.element})*{self.name}_len')
+            else:
+                emitFootprintAlloc('    ', archival, f'{el}_ALIGN', f'{el}_FOOTPRINT*{self.name}_len')
             print(f'    for( ulong i=0; i < {self.name}_len; i++ ) {{', file=body)
 
             if self.element in simpletypes:
                 print(f'      err = fd_bincode_{simpletypes[self.element]}_decode_preflight( ctx );', file=body)
             else:
-                print(f'      err = {namespace}_{self.element}_decode{atag}_preflight( ctx );', file=body)
+                print(f'      err = {preflightCall(namespace+"_"+self.element, archival)};', file=body)
 
             print(f'      if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;', file=body)
             print('    }', file=body)
@@ -672,7 +748,7 @@ class StaticVectorMember(TypeNode):
             if self.element in simpletypes:
                 print(f'      err = fd_bincode_{simpletypes[self.element]}_decode_preflight( ctx );', file=body)
             else:
-                print(f'      err = {namespace}_{self.element}_decode{atag}_preflight( ctx );', file=body)
+                print(f'      err = {preflightCall(namespace+"_"+self.element, archival)};', file=body)
 
             print(f'      if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;', file=body)
             print('    }', file=body)
@@ -776,6 +852,7 @@ class StringMember(VectorMember):
         el = f'{namespace}_{self.element}'
         el = el.upper()
 
+        emitFootprintAlloc('    ', archival, '8UL', f'{self.name}_len')
         print(f'    err = fd_bincode_bytes_decode_preflight( {self.name}_len, ctx );', file=body)
         print(f'    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;', file=body)
         print(f'    err = !fd_utf8_verify( (char const *) ctx->data - {self.name}_len, {self.name}_len );', file=body)
@@ -865,6 +942,11 @@ class DequeMember(TypeNode):
             print(f'  ulong {self.name}_len;', file=body)
             print(f'  err = fd_bincode_uint64_decode( &{self.name}_len, ctx );', file=body)
         print(f'  if( FD_UNLIKELY( err ) ) return err;', file=body)
+        dp = self.prefix()
+        if self.min:
+            emitFootprintAlloc('  ', archival, f'{dp}_align()', f'{dp}_footprint( fd_ulong_max( {self.name}_len, {self.min} ) )')
+        else:
+            emitFootprintAlloc('  ', archival, f'{dp}_align()', f'{dp}_footprint( fd_ulong_max( {self.name}_len, 1UL ) )')
 
         if self.element in fuzzytypes:
             fixedsize = fixedsizetypes[self.element]
@@ -878,7 +960,7 @@ class DequeMember(TypeNode):
             if self.element in simpletypes:
                 print(f'    err = fd_bincode_{simpletypes[self.element]}_decode_preflight( ctx );', file=body)
             else:
-                print(f'    err = {namespace}_{self.element}_decode{atag}_preflight( ctx );', file=body)
+                print(f'    err = {preflightCall(namespace+"_"+self.element, archival)};', file=body)
             print(f'    if( FD_UNLIKELY( err ) ) return err;', file=body)
 
             print('  }', file=body)
@@ -1102,9 +1184,13 @@ class MapMember(TypeNode):
             print(f'  ulong {self.name}_len;', file=body)
             print(f'  err = fd_bincode_uint64_decode( &{self.name}_len, ctx );', file=body)
         print('  if( FD_UNLIKELY( err ) ) return err;', file=body)
+        if self.minalloc > 0:
+            emitFootprintAlloc('  ', archival, f'{mapname}_align()', f'{mapname}_footprint( fd_ulong_max( {self.name}_len, {self.minalloc} ) )')
+        else:
+            emitFootprintAlloc('  ', archival, f'{mapname}_align()', f'{mapname}_footprint( fd_ulong_max( {self.name}_len, 1UL ) )')
 
         print(f'  for( ulong i=0; i < {self.name}_len; i++ ) {{', file=body)
-        print(f'    err = {namespace}_{self.element}_decode{atag}_preflight( ctx );', file=body)
+        print(f'    err = {preflightCall(namespace+"_"+self.element, archival)};', file=body)
         print('    if( FD_UNLIKELY( err ) ) return err;', file=body)
         print('  }', file=body)
 
@@ -1316,9 +1402,14 @@ class TreapMember(TypeNode):
             print(f'  ulong {treap_name}_len;', file=body)
             print(f'  err = fd_bincode_uint64_decode( &{treap_name}_len, ctx );', file=body)
         print('  if( FD_UNLIKELY( err ) ) return err;', file=body)
+        if not archival:
+            pool_name = self.name + '_pool'
+            print(f'  ulong {treap_name}_max = fd_ulong_max( fd_ulong_max( {treap_name}_len, {self.min_name} ), 1UL );', file=body)
+            emitFootprintAlloc('  ', archival, f'{pool_name}_align()', f'{pool_name}_footprint( {treap_name}_max )')
+            emitFootprintAlloc('  ', archival, f'{treap_name}_align()', f'{treap_name}_footprint( {treap_name}_max )')
 
         print(f'  for( ulong i=0; i < {treap_name}_len; i++ ) {{', file=body)
-        print(f'    err = {treap_t.rstrip("_t")}_decode{atag}_preflight( ctx );', file=body)
+        print(f'    err = {preflightCall(treap_t.rstrip("_t"), archival)};', file=body)
         print(f'    if( FD_UNLIKELY ( err ) ) return err;', file=body)
         print('  }', file=body)
 
@@ -1508,11 +1599,15 @@ class OptionMember(TypeNode):
         print('    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;', file=body)
         print('    if( o ) {', file=body)
         if self.element in simpletypes:
+            if not self.flat:
+                emitFootprintAlloc('      ', archival, '8UL', f'sizeof({self.element})')
             print(f'      err = fd_bincode_{simpletypes[self.element]}_decode_preflight( ctx );', file=body)
         else:
             el = f'{namespace}_{self.element}'
             el = el.upper()
-            print(f'      err = {namespace}_{self.element}_decode{atag}_preflight( ctx );', file=body)
+            if not self.flat:
+                emitFootprintAlloc('      ', archival, f'{el}_ALIGN', f'{el}_FOOTPRINT')
+            print(f'      err = {preflightCall(namespace+"_"+self.element, archival)};', file=body)
         print('      if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;', file=body)
         print('    }', file=body)
         print('  }', file=body)
@@ -1694,7 +1789,7 @@ class ArrayMember(TypeNode):
         if self.element in simpletypes:
             print(f'    err = fd_bincode_{simpletypes[self.element]}_decode_preflight( ctx );', file=body)
         else:
-            print(f'    err = {namespace}_{self.element}_decode{atag}_preflight( ctx );', file=body)
+            print(f'    err = {preflightCall(namespace+"_"+self.element, archival)};', file=body)
         print('    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) ) return err;', file=body)
         print('  }', file=body)
 
@@ -1808,6 +1903,9 @@ class OpaqueType(TypeNode):
         print(f"int {n}_decode( {n}_t * self, fd_bincode_decode_ctx_t * ctx );", file=header)
         print(f"int {n}_decode_preflight( fd_bincode_decode_ctx_t * ctx );", file=header)
         print(f"void {n}_decode_unsafe( {n}_t * self, fd_bincode_decode_ctx_t * ctx );", file=header)
+        print(f"int {n}_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );", file=header)
+        print(f"int {n}_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );", file=header)
+        print(f"{n}_t * {n}_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );", file=header)
         print(f"int {n}_encode( {n}_t const * self, fd_bincode_encode_ctx_t * ctx );", file=header)
         print(f"void {n}_destroy( {n}_t * self, fd_bincode_destroy_ctx_t * ctx );", file=header)
         print(f"void {n}_walk( void * w, {n}_t const * self, fd_types_walk_fn_t fun, const char * name, uint level );", file=header)
@@ -1831,13 +1929,15 @@ class OpaqueType(TypeNode):
         print(f'  return FD_BINCODE_SUCCESS;', file=body)
         print(f'}}', file=body)
 
-        print(f'int {n}_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {{', file=body)
+        print(f'int {n}_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {{', file=body)
         print(f'  return fd_bincode_bytes_decode_preflight( sizeof({n}_t), ctx );', file=body)
         print("}", file=body)
+        emitDecodeFootprint(n)
 
         print(f'void {n}_decode_unsafe( {n}_t * self, fd_bincode_decode_ctx_t * ctx ) {{', file=body)
         print(f'  fd_bincode_bytes_decode_unsafe( (uchar*)self, sizeof({n}_t), ctx );', file=body)
         print("}", file=body)
+        emitDecodeInner(n)
 
         print(f'void {n}_new( {n}_t * self ) {{ }}', file=body)
 
@@ -1913,6 +2013,45 @@ class StructType(TypeNode):
                 return False
         return True
 
+    # Returns the alignment of this struct if its in-memory layout is
+    # byte-for-byte identical to its bincode encoding (i.e. all fields
+    # are fuzzy and there is no padding), None otherwise
+    def viewAlign(self):
+        if self.nomethods or self.encoders is False or not self.isFuzzy():
+            return None
+        off = 0
+        align = int(self.alignment)
+        for f in self.fields:
+            if not getattr(f, 'encode', True) or not getattr(f, 'decode', True):
+                return None
+            if isinstance(f, PrimitiveMember) or isinstance(f, StructMember):
+                t = f.type
+                cnt = 1
+            elif isinstance(f, ArrayMember):
+                t = f.element
+                cnt = int(f.length)
+            else:
+                return None
+            a = viewAlign(t)
+            if a is None or off % a != 0:
+                return None
+            off += cnt * fixedsizetypes[t]
+            align = max(align, a)
+        if off % align != 0:
+            return None
+        return align
+
+    def emitView(self):
+        n = self.fullname
+        size = fixedsizetypes[self.name]
+        print(f'/* {n}_view returns a zero-copy view of the {n}_t encoded at', file=header)
+        print(f'   data (whose bincode encoding matches its in-memory layout).', file=header)
+        print(f'   Returns NULL if data_sz is too small or data is misaligned. */', file=header)
+        print(f'static inline {n}_t const * {n}_view( void const * data, ulong data_sz ) {{', file=header)
+        print(f'  if( FD_UNLIKELY( data_sz<{size}UL || !fd_ulong_is_aligned( (ulong)data, alignof({n}_t) ) ) ) return NULL;', file=header)
+        print(f'  return ({n}_t const *)data;', file=header)
+        print('}', file=header)
+
     def emitHeader(self):
         for f in self.fields:
             f.emitPreamble()
@@ -1956,6 +2095,9 @@ class StructType(TypeNode):
         print(f"int {n}_decode( {n}_t * self, fd_bincode_decode_ctx_t * ctx );", file=header)
         print(f"int {n}_decode_preflight( fd_bincode_decode_ctx_t * ctx );", file=header)
         print(f"void {n}_decode_unsafe( {n}_t * self, fd_bincode_decode_ctx_t * ctx );", file=header)
+        print(f"int {n}_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );", file=header)
+        print(f"int {n}_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );", file=header)
+        print(f"{n}_t * {n}_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );", file=header)
         print(f"int {n}_decode_offsets( {n}_off_t * self, fd_bincode_decode_ctx_t * ctx );", file=header)
         print(f"int {n}_encode( {n}_t const * self, fd_bincode_encode_ctx_t * ctx );", file=header)
         print(f"void {n}_destroy( {n}_t * self, fd_bincode_destroy_ctx_t * ctx );", file=header)
@@ -1968,6 +2110,8 @@ class StructType(TypeNode):
             print(f"int {n}_decode_archival_preflight( fd_bincode_decode_ctx_t * ctx );", file=header)
             print(f"void {n}_decode_archival_unsafe( {n}_t * self, fd_bincode_decode_ctx_t * ctx );", file=header)
             print(f"int {n}_encode_archival( {n}_t const * self, fd_bincode_encode_ctx_t * ctx );", file=header)
+        if self.viewAlign() is not None:
+            self.emitView()
         print("", file=header)
 
     def emitEncodeDecode(self, archival):
@@ -1980,7 +2124,11 @@ class StructType(TypeNode):
             self.emitDecodePreflightFixedSize(n)
         else:
             self.emitDecodePreflightComplex(archival, n, atag)
+        if not archival:
+            emitDecodeFootprint(n)
         self.emitDecodeUnsafe(archival, n, atag)
+        if not archival:
+            emitDecodeInner(n)
         self.emitEncode(archival, n, atag)
 
     def emitArchiveTags(self, n):
@@ -2004,12 +2152,15 @@ class StructType(TypeNode):
 
     def emitDecodePreflightFixedSize(self, n):
         size = fixedsizetypes[self.name]
-        print(f'int {n}_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {{', file=body)
+        print(f'int {n}_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {{', file=body)
         print(f'  return fd_bincode_bytes_decode_preflight( {size}, ctx );', file=body)
         print('}', file=body)
 
     def emitDecodePreflightComplex(self, archival, n, atag):
-        print(f'int {n}_decode{atag}_preflight( fd_bincode_decode_ctx_t * ctx ) {{', file=body)
+        if archival:
+            print(f'int {n}_decode{atag}_preflight( fd_bincode_decode_ctx_t * ctx ) {{', file=body)
+        else:
+            print(f'int {n}_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {{', file=body)
         print('  int err;', file=body)
         if archival:
             print('  ushort tag = FD_ARCHIVE_META_SENTINAL;', file=body)
@@ -2113,6 +2264,7 @@ class StructType(TypeNode):
 
             print(f'int {n}_decode_offsets( {n}_off_t * self, fd_bincode_decode_ctx_t * ctx ) {{', file=body)
             print('  uchar const * data = ctx->data;', file=body)
+            print('  ulong total_sz[1] = { 0UL };', file=body)
             print('  int err;', file=body)
             for f in self.fields:
                 print(f'  self->{f.name}_off = (uint)( (ulong)ctx->data - (ulong)data );', file=body)
@@ -2136,6 +2288,8 @@ class StructType(TypeNode):
 
         print(f'ulong {n}_footprint( void ){{ return {n.upper()}_FOOTPRINT; }}', file=body)
         print(f'ulong {n}_align( void ){{ return {n.upper()}_ALIGN; }}', file=body)
+        if self.viewAlign() is not None:
+            print(f'FD_STATIC_ASSERT( sizeof({n}_t)=={fixedsizetypes[self.name]}UL, {n}_view );', file=body)
         print("", file=body)
 
         print(f'void {n}_walk( void * w, {n}_t const * self, fd_types_walk_fn_t fun, const char *name, uint level ) {{', file=body)
@@ -2277,6 +2431,9 @@ class EnumType:
         print(f"int {n}_decode( {n}_t * self, fd_bincode_decode_ctx_t * ctx );", file=header)
         print(f"int {n}_decode_preflight( fd_bincode_decode_ctx_t * ctx );", file=header)
         print(f"void {n}_decode_unsafe( {n}_t * self, fd_bincode_decode_ctx_t * ctx );", file=header)
+        print(f"int {n}_decode_footprint( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );", file=header)
+        print(f"int {n}_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz );", file=header)
+        print(f"{n}_t * {n}_decode_inner( void * mem, fd_bincode_decode_ctx_t * ctx );", file=header)
         if self.zerocopy:
             print(f"int {n}_decode_offsets( {n}_off_t * self, fd_bincode_decode_ctx_t * ctx );", file=header)
         print(f"int {n}_encode( {n}_t const * self, fd_bincode_encode_ctx_t * ctx );", file=header)
@@ -2312,7 +2469,7 @@ class EnumType:
 
         print(f'void {n}_inner_new( {n}_inner_t * self, {self.repr} discriminant );', file=body)
 
-        print(f'int {n}_inner_decode_preflight( {self.repr} discriminant, fd_bincode_decode_ctx_t * ctx ) {{', file=body)
+        print(f'int {n}_inner_decode_footprint( {self.repr} discriminant, fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {{', file=body)
         print('  int err;', file=body)
         print('  switch (discriminant) {', file=body)
         for i, v in enumerate(self.variants):
@@ -2350,7 +2507,7 @@ class EnumType:
         print(f'  return FD_BINCODE_SUCCESS;', file=body)
         print(f'}}', file=body)
 
-        print(f'int {n}_decode_preflight( fd_bincode_decode_ctx_t * ctx ) {{', file=body)
+        print(f'int {n}_decode_footprint_inner( fd_bincode_decode_ctx_t * ctx, ulong * total_sz ) {{', file=body)
         if self.compact:
             print('  ushort discriminant = 0;', file=body)
             print('  int err = fd_bincode_compact_u16_decode( &discriminant, ctx );', file=body)
@@ -2358,8 +2515,9 @@ class EnumType:
             print(f'  {self.repr} discriminant = 0;', file=body)
             print(f'  int err = fd_bincode_{self.repr_codec_stem}_decode( &discriminant, ctx );', file=body)
         print('  if( FD_UNLIKELY( err ) ) return err;', file=body)
-        print(f'  return {n}_inner_decode_preflight( discriminant, ctx );', file=body)
+        print(f'  return {n}_inner_decode_footprint( discriminant, ctx, total_sz );', file=body)
         print("}", file=body)
+        emitDecodeFootprint(n)
 
         print(f'void {n}_decode_unsafe( {n}_t * self, fd_bincode_decode_ctx_t * ctx ) {{', file=body)
         if self.compact:
@@ -2370,6 +2528,7 @@ class EnumType:
             print(f'  fd_bincode_{self.repr_codec_stem}_decode_unsafe( &self->discriminant, ctx );', file=body)
         print(f'  {n}_inner_decode_unsafe( &self->inner, self->discriminant, ctx );', file=body)
         print("}", file=body)
+        emitDecodeInner(n)
 
         print(f'void {n}_inner_new( {n}_inner_t * self, {self.repr} discriminant ) {{', file=body)
         print('  switch( discriminant ) {', file=body)
@@ -2497,6 +2656,8 @@ def main():
     global fixedsizetypes
     global fuzzytypes
     for typeinfo in alltypes:
+        if isinstance(typeinfo, StructType):
+            structtypes[typeinfo.name] = typeinfo
         if typeinfo.isFixedSize():
             fixedsizetypes[typeinfo.name] = typeinfo.fixedSize()
         if typeinfo.isFuzzy():
@@ -55,6 +55,17 @@ typedef int
 (* fd_types_decode_vfn_t)( void *                    self,
                            fd_bincode_decode_ctx_t * d );
 
+typedef int
+(* fd_types_decode_preflight_vfn_t)( fd_bincode_decode_ctx_t * d );
+
+typedef int
+(* fd_types_decode_footprint_vfn_t)( fd_bincode_decode_ctx_t * d,
+                                     ulong *                   total_sz );
+
+typedef void *
+(* fd_types_decode_inner_vfn_t)( void *                    mem,
+                                 fd_bincode_decode_ctx_t * d );
+
 typedef void
 (* fd_types_walk_vfn_t)( void *             walker,
                          void const *       self,
@@ -73,8 +84,11 @@ struct test_fixture {
   ulong const * yml_sz;
   ulong         struct_sz;  /* size of outer struct */
 
-  fd_types_decode_vfn_t decode;
-  fd_types_walk_vfn_t   walk;
+  fd_types_decode_vfn_t           decode;
+  fd_types_decode_preflight_vfn_t decode_preflight;
+  fd_types_decode_footprint_vfn_t decode_footprint;
+  fd_types_decode_inner_vfn_t     decode_inner;
+  fd_types_walk_vfn_t             walk;
 };
 
 typedef struct test_fixture test_fixture_t;
@@ -89,6 +103,9 @@ static const test_fixture_t test_vector[] = {
     .yml_sz    = &test_##id##_yml_sz,                                  \
     .struct_sz = sizeof( fd_##type##_t ),                              \
     .decode    = ( fd_types_decode_vfn_t )fd_##type##_decode,          \
+    .decode_preflight = ( fd_types_decode_preflight_vfn_t )fd_##type##_decode_preflight, \
+    .decode_footprint = ( fd_types_decode_footprint_vfn_t )fd_##type##_decode_footprint, \
+    .decode_inner     = ( fd_types_decode_inner_vfn_t     )fd_##type##_decode_inner,     \
     .walk      = ( fd_types_walk_vfn_t   )fd_##type##_walk },
 TEST_VECTOR( X )
 # undef X
@@ -98,27 +115,14 @@ TEST_VECTOR( X )
 
 /* TEST DEFINITIONS ***************************************************/
 
-/* test_yaml deserializes t->bin and asserts the YAML representation of
-   the result matches t->yaml. */
+/* check_yaml asserts the YAML representation of the decoded object
+   matches t->yaml. */
 
 static void
-test_yaml( test_fixture_t const * t ) {
+check_yaml( test_fixture_t const * t,
+            void const *           decoded ) {
   FD_SCRATCH_SCOPE_BEGIN {
 
-    /* Decode bincode blob */
-
-    ulong bin_sz = *t->bin_sz;
-    fd_bincode_decode_ctx_t decode[1] = {{
-        .data    = t->bin,
-        .dataend = t->bin + bin_sz,
-        .valloc  = fd_scratch_virtual()
-      }};
-
-    void * decoded = fd_scratch_alloc( 64UL, t->struct_sz );
-    int err = t->decode( decoded, decode );
-    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) )
-      FD_LOG_ERR(( "Test '%s' failed: Bincode decode err (%d)", t->name, err ));
-
     /* Encode YAML */
 
     static char yaml_buf[ 1<<20 ];
@@ -150,6 +154,71 @@ test_yaml( test_fixture_t const * t ) {
   } FD_SCRATCH_SCOPE_END;
 }
 
+/* test_yaml deserializes t->bin and asserts the YAML representation of
+   the result matches t->yaml. */
+
+static void
+test_yaml( test_fixture_t const * t ) {
+  FD_SCRATCH_SCOPE_BEGIN {
+
+    /* Decode bincode blob */
+
+    ulong bin_sz = *t->bin_sz;
+    fd_bincode_decode_ctx_t decode[1] = {{
+        .data    = t->bin,
+        .dataend = t->bin + bin_sz,
+        .valloc  = fd_scratch_virtual()
+      }};
+
+    void * decoded = fd_scratch_alloc( 64UL, t->struct_sz );
+    int err = t->decode( decoded, decode );
+    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) )
+      FD_LOG_ERR(( "Test '%s' failed: Bincode decode err (%d)", t->name, err ));
+
+    check_yaml( t, decoded );
+  } FD_SCRATCH_SCOPE_END;
+}
+
+/* test_decode_inner deserializes t->bin into a single region sized by
+   decode_footprint and asserts that the region is not overrun and that
+   the result matches t->yaml. */
+
+static void
+test_decode_inner( test_fixture_t const * t ) {
+  FD_SCRATCH_SCOPE_BEGIN {
+
+    ulong bin_sz = *t->bin_sz;
+    fd_bincode_decode_ctx_t decode[1] = {{
+        .data    = t->bin,
+        .dataend = t->bin + bin_sz
+      }};
+
+    FD_TEST( t->decode_preflight( decode )==FD_BINCODE_SUCCESS );
+    void const * end = decode->data;
+    decode->data = t->bin;
+
+    ulong total_sz = 0UL;
+    int err = t->decode_footprint( decode, &total_sz );
+    if( FD_UNLIKELY( err!=FD_BINCODE_SUCCESS ) )
+      FD_LOG_ERR(( "Test '%s' failed: Bincode decode err (%d)", t->name, err ));
+    FD_TEST( decode->data==t->bin );
+    FD_TEST( total_sz>=t->struct_sz );
+
+    /* Guard bytes past the end of the region catch overruns */
+
+    ulong  guard_sz = 64UL;
+    uchar * mem     = fd_scratch_alloc( FD_BINCODE_ARENA_ALIGN, total_sz+guard_sz );
+    memset( mem+total_sz, 0xa5, guard_sz );
+
+    void * decoded = t->decode_inner( mem, decode );
+    FD_TEST( decoded==mem );
+    FD_TEST( decode->data==end );
+    for( ulong i=0UL; i<guard_sz; i++ ) FD_TEST( mem[ total_sz+i ]==0xa5 );
+
+    check_yaml( t, decoded );
+  } FD_SCRATCH_SCOPE_END;
+}
+
 /* test_idempotent first deserializes t->bin, then re-serializes the
    result.  Asserts that the serialized representation is byte-by-byte
    identical. */
@@ -172,8 +241,9 @@ main( int     argc,
 
   for( test_fixture_t const * t = test_vector; t->name; t++ ) {
 
-    test_yaml      ( t );
-    test_idempotent( t );
+    test_yaml        ( t );
+    test_decode_inner( t );
+    test_idempotent  ( t );
     /* Add more here ... */
 
   }
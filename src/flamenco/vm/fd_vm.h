@@ -19,14 +19,27 @@ struct fd_vm_shadow { ulong r6; ulong r7; ulong r8; ulong r9; ulong r10; ulong p
 typedef struct fd_vm_shadow fd_vm_shadow_t;
 
 /* fd_vm_input_region_t holds information about fragmented memory regions 
-   within the larger input region. */
+   within the larger input region.
+
+   A copy on write region maps borrowed account data read-only in place
+   (haddr) while behaving like a writable region.  Before the first
+   write into the region (or the first access spanning into a
+   neighboring region, since callers assume such accesses are contiguous
+   in the host address space), the region is copied to cow_haddr and
+   haddr is switched over.  Writes into copy on write regions are
+   tracked in [dirty_lo,dirty_hi) such that only the modified bytes need
+   to be written back to the account. */
    
 struct __attribute__((aligned(8UL))) fd_vm_input_region {
    ulong         vaddr_offset; /* Represents offset from the start of the input region. */
    ulong         haddr;        /* Host address corresponding to the start of the mem region. */
+   ulong         cow_haddr;    /* If non-zero, host address the region gets copied to on first write. */
    uint          region_sz;    /* Size of the memory region. */
+   uint          dirty_lo;     /* Region offsets [dirty_lo,dirty_hi) hold all bytes written, */
+   uint          dirty_hi;     /* only maintained for copy on write regions (empty if dirty_hi<=dirty_lo). */
    uchar         is_writable;  /* If the region can be written to or is read-only */
    uchar         is_acct_data; /* Set if this is an account data region (either orig data or resize buffer). */
+   uchar         is_cow;       /* Set if this is a copy on write region (copied iff cow_haddr is zero). */
 };
 typedef struct fd_vm_input_region fd_vm_input_region_t;
 
@@ -210,6 +223,9 @@ struct __attribute__((aligned(FD_VM_HOST_REGION_ALIGN))) fd_vm {
   ulong segv_store_vaddr;
 
   ulong sbpf_version;     /* SBPF version, SIMD-0161 */
+
+  struct fd_jit_prog *       jit_prog; /* If non-NULL, native code of this program to run instead of the interpreter
+                                          (see jit/fd_jit_cache.h).  Only used if FD_VM_HAS_JIT. */
 };
 
 /* FIXME: MOVE ABOVE INTO PRIVATE WHEN CONSTRUCTORS READY */
@@ -330,6 +346,48 @@ fd_vm_is_check_size_enabled( fd_vm_t const * vm ) {
    return !vm->is_deprecated;
 }
 
+/* fd_vm_input_region_cow_copy copies the not yet copied copy on write
+   region to its private copy and switches the region over to it.
+   fd_vm_input_region_cow_touch records that the region offsets
+   [off,off+sz) (clamped to the region) of copy on write region were
+   written.  fd_vm_input_region_cow_copy_all copies all not yet copied
+   copy on write regions of vm and marks them entirely dirty.  This is
+   used before operations (e.g. cross program invocations) that read or
+   replace the borrowed account data behind the regions. */
+
+static inline void
+fd_vm_input_region_cow_copy( fd_vm_input_region_t * region ) {
+  fd_memcpy( (void *)region->cow_haddr, (void const *)region->haddr, region->region_sz );
+  region->haddr     = region->cow_haddr;
+  region->cow_haddr = 0UL;
+}
+
+static inline void
+fd_vm_input_region_cow_touch( fd_vm_input_region_t * region,
+                              ulong                  off,
+                              ulong                  sz ) {
+  uint lo = (uint)fd_ulong_min( off,    (ulong)region->region_sz );
+  uint hi = (uint)fd_ulong_min( off+sz, (ulong)region->region_sz );
+  if( FD_UNLIKELY( lo>=hi ) ) return;
+  if( region->dirty_hi<=region->dirty_lo ) {
+    region->dirty_lo = lo;
+    region->dirty_hi = hi;
+  } else {
+    region->dirty_lo = fd_uint_min( region->dirty_lo, lo );
+    region->dirty_hi = fd_uint_max( region->dirty_hi, hi );
+  }
+}
+
+static inline void
+fd_vm_input_region_cow_copy_all( fd_vm_t * vm ) {
+  for( uint i=0U; i<vm->input_mem_regions_cnt; i++ ) {
+    fd_vm_input_region_t * region = &vm->input_mem_regions[ i ];
+    if( FD_LIKELY( !region->is_cow ) ) continue;
+    if( region->cow_haddr ) fd_vm_input_region_cow_copy( region );
+    fd_vm_input_region_cow_touch( region, 0UL, region->region_sz );
+  }
+}
+
 /* FIXME: make this trace-aware, and move into fd_vm_init
    This is a temporary hack to make the fuzz harness work. */
 int
@@ -445,10 +503,28 @@ fd_vm_exec_trace( fd_vm_t * vm );
 int
 fd_vm_exec_notrace( fd_vm_t * vm );
 
+/* fd_vm_exec_jit runs vm using the native code vm->jit_prog.  Returns
+   FD_VM_ERR_UNSUP without modifying vm if the native code cannot run
+   in this vm's execution context (e.g. complex memory map) or another
+   thread is running it.  Otherwise returns as fd_vm_exec.  fd_vm_exec dispatches to fd_vm_exec_jit when
+   vm is not traced and has native code, falling back to the
+   interpreter on FD_VM_ERR_UNSUP. */
+
+#if FD_VM_HAS_JIT
+int
+fd_vm_exec_jit( fd_vm_t * vm );
+#endif
+
 static inline int
 fd_vm_exec( fd_vm_t * vm ) {
-  if( FD_UNLIKELY( vm->trace ) ) return fd_vm_exec_trace  ( vm );
-  else                           return fd_vm_exec_notrace( vm );
+  if( FD_UNLIKELY( vm->trace ) ) return fd_vm_exec_trace( vm );
+# if FD_VM_HAS_JIT
+  if( FD_UNLIKELY( vm->jit_prog ) ) {
+    int err = fd_vm_exec_jit( vm );
+    if( FD_LIKELY( err!=FD_VM_ERR_UNSUP ) ) return err;
+  }
+# endif
+  return fd_vm_exec_notrace( vm );
 }
 
 FD_PROTOTYPES_END
@@ -13,6 +13,15 @@
 #include "../fd_flamenco_base.h"
 #include "../../ballet/sbpf/fd_sbpf_loader.h" /* FIXME: functionality needed from here probably should be moved here */
 
+/* FD_VM_HAS_JIT is 1 if the target supports executing sBPF programs as
+   native code (see jit/fd_jit.h) and 0 otherwise. */
+
+#if FD_HAS_X86 && FD_HAS_THREADS && FD_HAS_INT128 && FD_HAS_HOSTED
+#define FD_VM_HAS_JIT 1
+#else
+#define FD_VM_HAS_JIT 0
+#endif
+
 /* FD_VM_SUCCESS is zero and returned to indicate that an operation
    completed successfully.  FD_VM_ERR_* are negative integers and
    returned to indicate an operation that failed and why. */
@@ -360,7 +360,8 @@ fd_vm_find_input_mem_region( fd_vm_t const * vm,
   }
 
   /* Binary search to find the correct memory region.  If direct mapping is not
-     enabled, then there is only 1 memory region which spans the input region. */
+     enabled, then there is only 1 memory region which spans the input region
+     (unless account data is mapped copy on write). */
   ulong region_idx = fd_vm_get_input_mem_region_idx( vm, offset );
 
   ulong bytes_left          = sz;
@@ -372,6 +373,7 @@ fd_vm_find_input_mem_region( fd_vm_t const * vm,
   }
 
   ulong start_region_idx = region_idx;
+  int   has_cow          = vm->input_mem_regions[ region_idx ].is_cow;
 
   *is_multi_region = 0;
   while( FD_UNLIKELY( bytes_left>bytes_in_cur_region ) ) {
@@ -385,12 +387,30 @@ fd_vm_find_input_mem_region( fd_vm_t const * vm,
       return sentinel; /* Access is too large */
     }
     bytes_in_cur_region = vm->input_mem_regions[ region_idx ].region_sz;
+    has_cow            |= vm->input_mem_regions[ region_idx ].is_cow;
 
     if( FD_UNLIKELY( write && vm->input_mem_regions[ region_idx ].is_writable==0U ) ) {
       return sentinel; /* Illegal write */
     }
   }
 
+  /* Copy on write regions are copied before they get written and before
+     they get accessed together with a neighboring region (the regions
+     of a copy on write input region are contiguous in the host address
+     space once copied).  Note that input_mem_regions is not part of the
+     vm's const-ness. */
+
+  if( FD_UNLIKELY( has_cow && ( write || *is_multi_region ) ) ) {
+    for( ulong idx=start_region_idx; idx<=region_idx; idx++ ) {
+      fd_vm_input_region_t * region = &vm->input_mem_regions[ idx ];
+      if( FD_LIKELY( !region->is_cow ) ) continue;
+      if( region->cow_haddr ) fd_vm_input_region_cow_copy( region );
+      if( write ) fd_vm_input_region_cow_touch( region, fd_ulong_sat_sub( offset, region->vaddr_offset ),
+                                                fd_ulong_sat_sub( offset+sz, region->vaddr_offset ) -
+                                                fd_ulong_sat_sub( offset,    region->vaddr_offset ) );
+    }
+  }
+
   ulong adjusted_haddr = vm->input_mem_regions[ start_region_idx ].haddr + offset - vm->input_mem_regions[ start_region_idx ].vaddr_offset;
   return adjusted_haddr; 
 }
@@ -7,7 +7,7 @@ FD_TL fd_sbpf_syscalls_t const * fd_jit_syscalls;  /* current syscall table */
 FD_TL uint  fd_jit_segment_cnt;
 FD_TL uint  fd_jit_mem_sz   [ 2*FD_VM_JIT_SEGMENT_MAX ];
 FD_TL ulong fd_jit_mem_haddr[   FD_VM_JIT_SEGMENT_MAX ];
-FD_TL ulong fd_jit_jmp_buf[8];
+FD_TL ulong * fd_jit_jmp_buf;
 FD_TL ulong fd_jit_segfault_vaddr;
 FD_TL ulong fd_jit_segfault_rip;
 
@@ -71,6 +71,7 @@ fd_jit_prog_new( fd_jit_prog_t *            jit_prog,
 
   dasm_State * d = fd_jit_prepare( scratch, layout );
 
+  fd_jit_jmp_buf = jit_prog->jmp_buf;
   fd_jit_compile( &d, prog, syscalls );
   /* above longjmp()'s to fd_jit_compile_abort on failure */
 
@@ -148,10 +149,38 @@ fd_jit_exec( fd_jit_prog_t * jit_prog,
              fd_vm_t *       vm ) {
   int err = fd_jit_vm_compatible( vm );
   if( FD_UNLIKELY( err!=FD_VM_SUCCESS ) ) return err;
+
+  /* The code returns through jit_prog->jmp_buf, so only one thread may
+     run it at a time.  Let the caller interpret if it is busy. */
+
+  if( FD_UNLIKELY( FD_ATOMIC_CAS( &jit_prog->busy, 0UL, 1UL ) ) ) return FD_VM_ERR_UNSUP;
   fd_jit_vm_attach( vm );
-  err = jit_prog->entrypoint( jit_prog->first_rip );
+
+  /* The entrypoint does not push a frame for the entry function, so a
+     halt pops one frame more than was pushed (see ->entrypoint and
+     case 0x95 in fd_jit_compiler.dasc).  A fault leaves frame_cnt at
+     the depth where it happened. */
+
+  vm->frame_cnt = 0UL;
+  ulong ret = jit_prog->entrypoint( jit_prog->first_rip );
   fd_jit_vm_detach();
-  return err;
+
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( jit_prog->busy ) = 0UL;
+
+  if( FD_UNLIKELY( vm->frame_cnt!=ULONG_MAX ) ) {
+    err = (int)(uint)ret;
+    return err<0 ? err : FD_VM_ERR_SIGABORT;
+  }
+
+  vm->frame_cnt = 0UL;
+  vm->reg[0]    = ret;
+  return FD_VM_SUCCESS;
+}
+
+int
+fd_vm_exec_jit( fd_vm_t * vm ) {
+  return fd_jit_exec( vm->jit_prog, vm );
 }
 
 /* fd_dasm_grow_check gets called when DynASM tries to grow a buffer
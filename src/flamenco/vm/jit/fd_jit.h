@@ -16,9 +16,11 @@
 
 /* fd_jit_entrypoint is the entrypoint function of JIT compiled code.
    first_rip is a pointer to the x86 instruction in the host address
-   space that corresponds to the BPF entrypoint. */
+   space that corresponds to the BPF entrypoint.  Returns r0 if the
+   program halted and a zero extended FD_VM_ERR code if it faulted (use
+   fd_jit_exec to tell these apart). */
 
-typedef int (* fd_jit_entrypoint_t)( ulong first_rip );
+typedef ulong (* fd_jit_entrypoint_t)( ulong first_rip );
 
 /* fd_jit_prog_t is an instance of a JIT compiled program.  It is not
    relocatable since the generated code effectively contains absolute
@@ -27,7 +29,11 @@ typedef int (* fd_jit_entrypoint_t)( ulong first_rip );
    fd_jit_prog_t references an external "code" buffer (the memory region
    storing executable code).  During the lifetime of a fd_jit_prog_t
    object, the backing "code" buffer may not be moved, freed, or written
-   to */
+   to.
+
+   The generated code saves its exit context into jmp_buf (its address
+   is embedded into the code).  Hence, a program is executed by at most
+   one thread at a time (see fd_jit_exec). */
 
 struct fd_jit_prog {
   ulong               magic;
@@ -35,6 +41,8 @@ struct fd_jit_prog {
   ulong               code_sz;
   fd_jit_entrypoint_t entrypoint;
   ulong               first_rip;
+  ulong               busy;       /* 1 while a thread executes this program, 0 otherwise */
+  ulong               jmp_buf[8]; /* see fd_jit_jmp_buf */
 };
 
 typedef struct fd_jit_prog fd_jit_prog_t;
@@ -110,11 +118,14 @@ fd_jit_prog_delete( fd_jit_prog_t * prog );
 /* fd_jit_exec executes a compiled program from entrypoint to halt or
    fault.
 
-   On failure, returns NULL and releases any memory back to the caller.
-   Reasons include FD_VM_ERR_{...}:
-
-     UNSUP  JIT compiler does not support the given execution context
-            (e.g. complex memory map) */
+   On halt, returns FD_VM_SUCCESS with the program's return value in
+   vm->reg[0].  On fault, returns an FD_VM_ERR code (the reason is not
+   reliable, see fd_jit_compiler.dasc).  Compute units are not metered
+   (vm->cu is left unchanged).  Returns FD_VM_ERR_UNSUP without running
+   the program if the JIT compiler does not support the given execution
+   context (e.g. complex memory map) or if another thread is currently
+   executing jit_prog (the caller should fall back to the interpreter).
+   fd_jit_exec may be called concurrently on the same jit_prog. */
 
 int
 fd_jit_exec( fd_jit_prog_t * jit_prog,
@@ -0,0 +1,389 @@
+#include "fd_jit_cache.h"
+
+#include <errno.h>
+#include <sys/mman.h>
+
+struct fd_jit_cache_private {
+  ulong magic;        /* ==FD_JIT_CACHE_MAGIC */
+  ulong ent_max;      /* number of entries, power of 2 */
+  ulong code_max;     /* number of code slots */
+  ulong code_slot_sz; /* code slot size, multiple of FD_JIT_CACHE_PAGE_SZ */
+  ulong hot_thresh;   /* queries before a program becomes pending */
+  ulong seed;         /* key hash seed */
+  ulong ent_off;      /* byte offset of the entry table from the cache */
+  ulong owner_off;    /* byte offset of the code slot owner table (entry idx or ULONG_MAX) */
+  ulong code_off;     /* byte offset of the first code slot, page aligned */
+};
+
+/* Code slots are at most 4 GiB (the transpiler estimates code size in
+   float32) and the cache is at most 1 TiB. */
+
+#define FD_JIT_CACHE_CODE_SLOT_SZ_MAX (1UL<<32)
+#define FD_JIT_CACHE_CODE_SZ_MAX      (1UL<<40)
+
+static ulong
+fd_jit_cache_private_layout( ulong   ent_max,
+                             ulong   code_max,
+                             ulong   code_slot_sz,
+                             ulong * ent_off,
+                             ulong * owner_off,
+                             ulong * code_off ) {
+  if( FD_UNLIKELY( (!ent_max) | (!fd_ulong_is_pow2( ent_max )) | (ent_max>(ULONG_MAX/sizeof(fd_jit_cache_ent_t))) ) ) return 0UL;
+  if( FD_UNLIKELY( (!code_max) | (code_max>=(ulong)UINT_MAX) ) ) return 0UL;
+  if( FD_UNLIKELY( (!code_slot_sz) | (code_slot_sz>FD_JIT_CACHE_CODE_SLOT_SZ_MAX) ) ) return 0UL;
+  code_slot_sz = fd_ulong_align_up( code_slot_sz, FD_JIT_CACHE_PAGE_SZ );
+  if( FD_UNLIKELY( code_max>(FD_JIT_CACHE_CODE_SZ_MAX/code_slot_sz) ) ) return 0UL;
+
+  ulong off = 0UL;
+  off  = fd_ulong_align_up( off + sizeof(fd_jit_cache_t), alignof(fd_jit_cache_ent_t) ); *ent_off   = off;
+  off  = fd_ulong_align_up( off + ent_max*sizeof(fd_jit_cache_ent_t), alignof(ulong) );  *owner_off = off;
+  off  = fd_ulong_align_up( off + code_max*sizeof(ulong), FD_JIT_CACHE_PAGE_SZ );        *code_off  = off;
+  off += code_max*code_slot_sz;
+  return fd_ulong_align_up( off, FD_JIT_CACHE_ALIGN );
+}
+
+FD_FN_CONST ulong
+fd_jit_cache_align( void ) {
+  return FD_JIT_CACHE_ALIGN;
+}
+
+FD_FN_CONST ulong
+fd_jit_cache_footprint( ulong ent_max,
+                        ulong code_max,
+                        ulong code_slot_sz ) {
+  ulong ent_off; ulong owner_off; ulong code_off;
+  return fd_jit_cache_private_layout( ent_max, code_max, code_slot_sz, &ent_off, &owner_off, &code_off );
+}
+
+FD_FN_PURE static inline fd_jit_cache_ent_t *
+fd_jit_cache_private_ent( fd_jit_cache_t const * cache ) {
+  return (fd_jit_cache_ent_t *)( (ulong)cache + cache->ent_off );
+}
+
+FD_FN_PURE static inline ulong *
+fd_jit_cache_private_owner( fd_jit_cache_t const * cache ) {
+  return (ulong *)( (ulong)cache + cache->owner_off );
+}
+
+FD_FN_PURE static inline uchar *
+fd_jit_cache_private_code( fd_jit_cache_t const * cache,
+                           ulong                  code_idx ) {
+  return (uchar *)( (ulong)cache + cache->code_off + code_idx*cache->code_slot_sz );
+}
+
+void *
+fd_jit_cache_new( void * shmem,
+                  ulong  ent_max,
+                  ulong  code_max,
+                  ulong  code_slot_sz,
+                  ulong  hot_thresh ) {
+
+  if( FD_UNLIKELY( !shmem ) ) {
+    FD_LOG_WARNING(( "NULL shmem" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)shmem, fd_jit_cache_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned shmem" ));
+    return NULL;
+  }
+
+  ulong ent_off; ulong owner_off; ulong code_off;
+  ulong footprint = fd_jit_cache_private_layout( ent_max, code_max, code_slot_sz, &ent_off, &owner_off, &code_off );
+  if( FD_UNLIKELY( !footprint ) ) {
+    FD_LOG_WARNING(( "bad ent_max, code_max or code_slot_sz" ));
+    return NULL;
+  }
+
+  fd_jit_cache_t * cache = (fd_jit_cache_t *)shmem;
+
+  cache->ent_max      = ent_max;
+  cache->code_max     = code_max;
+  cache->code_slot_sz = fd_ulong_align_up( code_slot_sz, FD_JIT_CACHE_PAGE_SZ );
+  cache->hot_thresh   = hot_thresh;
+  cache->seed         = fd_ulong_hash( (ulong)fd_tickcount() );
+  cache->ent_off      = ent_off;
+  cache->owner_off    = owner_off;
+  cache->code_off     = code_off;
+
+  fd_jit_cache_ent_t * ent = fd_jit_cache_private_ent( cache );
+  for( ulong i=0UL; i<ent_max; i++ ) {
+    memset( ent+i, 0, sizeof(fd_jit_cache_ent_t) );
+    ent[i].state    = FD_JIT_CACHE_STATE_FREE;
+    ent[i].code_idx = UINT_MAX;
+  }
+
+  ulong * owner = fd_jit_cache_private_owner( cache );
+  for( ulong i=0UL; i<code_max; i++ ) owner[i] = ULONG_MAX;
+
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( cache->magic ) = FD_JIT_CACHE_MAGIC;
+  FD_COMPILER_MFENCE();
+
+  return shmem;
+}
+
+fd_jit_cache_t *
+fd_jit_cache_join( void * shcache ) {
+
+  if( FD_UNLIKELY( !shcache ) ) {
+    FD_LOG_WARNING(( "NULL shcache" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)shcache, fd_jit_cache_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned shcache" ));
+    return NULL;
+  }
+
+  fd_jit_cache_t * cache = (fd_jit_cache_t *)shcache;
+
+  if( FD_UNLIKELY( cache->magic!=FD_JIT_CACHE_MAGIC ) ) {
+    FD_LOG_WARNING(( "bad magic" ));
+    return NULL;
+  }
+
+  return cache;
+}
+
+void *
+fd_jit_cache_leave( fd_jit_cache_t * cache ) {
+
+  if( FD_UNLIKELY( !cache ) ) {
+    FD_LOG_WARNING(( "NULL cache" ));
+    return NULL;
+  }
+
+  return (void *)cache;
+}
+
+void *
+fd_jit_cache_delete( void * shcache ) {
+
+  if( FD_UNLIKELY( !shcache ) ) {
+    FD_LOG_WARNING(( "NULL shcache" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)shcache, fd_jit_cache_align() ) ) ) {
+    FD_LOG_WARNING(( "misaligned shcache" ));
+    return NULL;
+  }
+
+  fd_jit_cache_t * cache = (fd_jit_cache_t *)shcache;
+
+  if( FD_UNLIKELY( cache->magic!=FD_JIT_CACHE_MAGIC ) ) {
+    FD_LOG_WARNING(( "bad magic" ));
+    return NULL;
+  }
+
+  /* Give the code region back to the caller in the state it was handed
+     to us */
+
+  void * code    = fd_jit_cache_private_code( cache, 0UL );
+  ulong  code_sz = cache->code_max*cache->code_slot_sz;
+  if( FD_UNLIKELY( mprotect( code, code_sz, PROT_READ|PROT_WRITE ) ) ) {
+    FD_LOG_WARNING(( "mprotect(%p,%lu,PROT_READ|PROT_WRITE) failed (%i-%s)", code, code_sz, errno, fd_io_strerror( errno ) ));
+  }
+
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( cache->magic ) = 0UL;
+  FD_COMPILER_MFENCE();
+
+  return shcache;
+}
+
+FD_FN_PURE ulong fd_jit_cache_ent_max     ( fd_jit_cache_t const * cache ) { return cache->ent_max;      }
+FD_FN_PURE ulong fd_jit_cache_code_max    ( fd_jit_cache_t const * cache ) { return cache->code_max;     }
+FD_FN_PURE ulong fd_jit_cache_code_slot_sz( fd_jit_cache_t const * cache ) { return cache->code_slot_sz; }
+
+FD_FN_PURE fd_jit_cache_ent_t const *
+fd_jit_cache_ent( fd_jit_cache_t const * cache,
+                  ulong                  ent_idx ) {
+  return fd_jit_cache_private_ent( cache ) + ent_idx;
+}
+
+/* fd_jit_cache_private_find returns the entry of program key, claiming
+   a free entry for it if not found and insert is non-zero.  Returns
+   NULL if not found and the key could not be inserted.  Entries are
+   never released, so a lock free linear probe is sufficient. */
+
+static fd_jit_cache_ent_t *
+fd_jit_cache_private_find( fd_jit_cache_t *    cache,
+                           fd_pubkey_t const * key,
+                           int                 insert ) {
+  fd_jit_cache_ent_t * ent  = fd_jit_cache_private_ent( cache );
+  ulong                mask = cache->ent_max - 1UL;
+  ulong                idx  = fd_hash( cache->seed, key, sizeof(fd_pubkey_t) );
+
+  for( ulong probe=0UL; probe<=mask; probe++ ) {
+    fd_jit_cache_ent_t * e = ent + ((idx+probe) & mask);
+
+    for(;;) {
+      int state = FD_VOLATILE_CONST( e->state );
+      if( FD_UNLIKELY( state==FD_JIT_CACHE_STATE_FREE ) ) {
+        if( !insert ) return NULL;
+        if( FD_ATOMIC_CAS( &e->state, FD_JIT_CACHE_STATE_FREE, FD_JIT_CACHE_STATE_CLAIM )!=FD_JIT_CACHE_STATE_FREE ) continue;
+        e->key         = *key;
+        e->hit_cnt     = 0UL;
+        e->want_slot   = ULONG_MAX;
+        e->want_epoch  = ULONG_MAX;
+        e->deploy_slot = ULONG_MAX;
+        e->epoch       = ULONG_MAX;
+        FD_COMPILER_MFENCE();
+        FD_VOLATILE( e->state ) = FD_JIT_CACHE_STATE_COLD;
+        FD_COMPILER_MFENCE();
+        return e;
+      }
+      if( FD_LIKELY( state!=FD_JIT_CACHE_STATE_CLAIM ) ) break;
+      FD_SPIN_PAUSE();
+    }
+
+    if( FD_LIKELY( fd_memeq( &e->key, key, sizeof(fd_pubkey_t) ) ) ) return e;
+  }
+
+  return NULL;
+}
+
+fd_jit_prog_t *
+fd_jit_cache_query( fd_jit_cache_t *    cache,
+                    fd_pubkey_t const * program_id,
+                    ulong               deploy_slot,
+                    ulong               epoch ) {
+  fd_jit_cache_ent_t * e = fd_jit_cache_private_find( cache, program_id, 1 );
+  if( FD_UNLIKELY( !e ) ) return NULL; /* cache full */
+
+  FD_ATOMIC_FETCH_AND_ADD( &e->hit_cnt, 1UL );
+
+  if( FD_LIKELY( FD_VOLATILE_CONST( e->state )==FD_JIT_CACHE_STATE_READY &&
+                 e->deploy_slot==deploy_slot && e->epoch==epoch ) ) return &e->prog;
+
+  FD_VOLATILE( e->want_slot  ) = deploy_slot;
+  FD_VOLATILE( e->want_epoch ) = epoch;
+  return NULL;
+}
+
+/* fd_jit_cache_private_code_acquire returns a free code slot, evicting
+   the native code of the compiled program with the fewest queries if
+   that program has fewer than hit_cnt queries.  Returns ULONG_MAX if
+   no code slot is available. */
+
+static ulong
+fd_jit_cache_private_code_acquire( fd_jit_cache_t * cache,
+                                   ulong            hit_cnt ) {
+  fd_jit_cache_ent_t * ent   = fd_jit_cache_private_ent( cache );
+  ulong *              owner = fd_jit_cache_private_owner( cache );
+
+  ulong victim     = ULONG_MAX;
+  ulong victim_hit = hit_cnt;
+  for( ulong code_idx=0UL; code_idx<cache->code_max; code_idx++ ) {
+    ulong ent_idx = owner[ code_idx ];
+    if( ent_idx==ULONG_MAX ) return code_idx;
+    if( ent[ ent_idx ].state!=FD_JIT_CACHE_STATE_READY ) continue; /* pending, keep */
+    if( ent[ ent_idx ].hit_cnt<victim_hit ) {
+      victim     = code_idx;
+      victim_hit = ent[ ent_idx ].hit_cnt;
+    }
+  }
+  if( victim==ULONG_MAX ) return ULONG_MAX;
+
+  fd_jit_cache_ent_t * e = ent + owner[ victim ];
+  fd_jit_prog_delete( &e->prog );
+  e->state    = FD_JIT_CACHE_STATE_COLD;
+  e->code_idx = UINT_MAX;
+  owner[ victim ] = ULONG_MAX;
+  return victim;
+}
+
+ulong
+fd_jit_cache_pending( fd_jit_cache_t * cache,
+                      ulong *          ent_idx,
+                      ulong            ent_idx_max ) {
+  fd_jit_cache_ent_t * ent   = fd_jit_cache_private_ent( cache );
+  ulong *              owner = fd_jit_cache_private_owner( cache );
+
+  ulong cnt = 0UL;
+  for( ulong i=0UL; (i<cache->ent_max) & (cnt<ent_idx_max); i++ ) {
+    fd_jit_cache_ent_t * e = ent + i;
+
+    int state = e->state;
+    if( state<FD_JIT_CACHE_STATE_COLD            ) continue; /* not tracked */
+    if( e->hit_cnt<cache->hot_thresh             ) continue; /* not hot */
+    if( e->want_slot==ULONG_MAX                  ) continue; /* never missed */
+    if( state!=FD_JIT_CACHE_STATE_COLD &&
+        e->deploy_slot==e->want_slot &&
+        e->epoch      ==e->want_epoch            ) continue; /* up to date */
+
+    if( e->code_idx==UINT_MAX ) {
+      ulong code_idx = fd_jit_cache_private_code_acquire( cache, e->hit_cnt );
+      if( code_idx==ULONG_MAX ) continue;
+      owner[ code_idx ] = i;
+      e->code_idx       = (uint)code_idx;
+    }
+
+    ent_idx[ cnt++ ] = i;
+  }
+
+  return cnt;
+}
+
+int
+fd_jit_cache_compile( fd_jit_cache_t *           cache,
+                      ulong                      ent_idx,
+                      fd_sbpf_program_t const *  prog,
+                      fd_sbpf_syscalls_t const * syscalls,
+                      ulong                      deploy_slot,
+                      ulong                      epoch,
+                      void *                     scratch,
+                      ulong                      scratch_sz ) {
+
+  if( FD_UNLIKELY( (!cache) | (ent_idx>=cache->ent_max) | (!prog) | (!syscalls) | (!scratch) ) ) return FD_VM_ERR_INVAL;
+
+  fd_jit_cache_ent_t * e = fd_jit_cache_private_ent( cache ) + ent_idx;
+  if( FD_UNLIKELY( (e->state<FD_JIT_CACHE_STATE_COLD) | (e->code_idx==UINT_MAX) ) ) return FD_VM_ERR_INVAL;
+
+  if( e->state==FD_JIT_CACHE_STATE_READY ) fd_jit_prog_delete( &e->prog );
+  e->state       = FD_JIT_CACHE_STATE_COLD;
+  e->deploy_slot = deploy_slot;
+  e->epoch       = epoch;
+
+  ulong   code_idx = (ulong)e->code_idx;
+  uchar * code     = fd_jit_cache_private_code( cache, code_idx );
+  ulong   code_sz  = cache->code_slot_sz;
+
+  int err;
+  if( FD_UNLIKELY( mprotect( code, code_sz, PROT_READ|PROT_WRITE ) ) ) {
+    FD_LOG_WARNING(( "mprotect(%p,%lu,PROT_READ|PROT_WRITE) failed (%i-%s)", (void *)code, code_sz, errno, fd_io_strerror( errno ) ));
+    err = FD_VM_ERR_PERM;
+    goto fail;
+  }
+
+  /* Fill the slot with ud2 such that stray jumps trap */
+
+  for( ulong j=0UL; j<code_sz; j+=2UL ) {
+    code[ j    ] = 0x0f;
+    code[ j+1UL] = 0x0b;
+  }
+
+  fd_jit_prog_t * jit_prog = fd_jit_prog_new( &e->prog, prog, syscalls, code, code_sz, scratch, scratch_sz, &err );
+
+  if( FD_UNLIKELY( mprotect( code, code_sz, PROT_READ|PROT_EXEC ) ) ) {
+    FD_LOG_WARNING(( "mprotect(%p,%lu,PROT_READ|PROT_EXEC) failed (%i-%s)", (void *)code, code_sz, errno, fd_io_strerror( errno ) ));
+    if( jit_prog ) fd_jit_prog_delete( jit_prog );
+    err = FD_VM_ERR_PERM;
+    goto fail;
+  }
+
+  if( FD_UNLIKELY( !jit_prog ) ) goto fail;
+
+  FD_COMPILER_MFENCE();
+  e->state = FD_JIT_CACHE_STATE_READY;
+  FD_COMPILER_MFENCE();
+  return FD_VM_SUCCESS;
+
+fail:
+  fd_jit_cache_private_owner( cache )[ code_idx ] = ULONG_MAX;
+  e->code_idx = UINT_MAX;
+  e->state    = FD_JIT_CACHE_STATE_FAILED;
+  return err;
+}
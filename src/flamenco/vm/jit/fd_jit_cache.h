@@ -0,0 +1,196 @@
+#ifndef HEADER_fd_src_flamenco_vm_jit_fd_jit_cache_h
+#define HEADER_fd_src_flamenco_vm_jit_fd_jit_cache_h
+
+/* fd_jit_cache provides a fixed capacity cache of natively compiled
+   sBPF programs that can be shared by all threads of a process that
+   executes transactions.
+
+   Programs are keyed by program account address.  Every execution of a
+   program queries the cache.  When the cache has native code for the
+   program compiled against the same deploy slot and epoch, the caller
+   can run the native code (via fd_vm_t jit_prog).  Otherwise, the
+   caller falls back to the interpreter and the cache counts the
+   invocation.  Programs that reach a hot threshold become pending.
+
+   Pending programs are compiled in bulk in between executions (e.g.
+   after a block finished executing):
+
+     ulong cnt = fd_jit_cache_pending( cache, ent_idx, ent_max );
+     ... for each ent_idx in parallel (e.g. over a tpool) ...
+       load the program deployed as fd_jit_cache_ent_key( cache, idx )
+       fd_jit_cache_compile( cache, idx, prog, syscalls, deploy_slot, epoch, ... );
+
+   The (deploy slot,epoch) tag of a cache entry provides invalidation.
+   A program upgrade changes the deploy slot of the program and a
+   feature activation (which can change the set of syscalls baked into
+   the native code) only happens at epoch boundaries.  Queries with a
+   tag that does not match the compiled code miss and cause the program
+   to be recompiled at the next compile phase if it is still hot.
+
+   Native code lives in page aligned code slots inside the cache's
+   memory region.  Code slots are writable while a program is being
+   compiled and read+execute otherwise (W^X).  Since mprotect is used,
+   the cache should be placed in a normal page backed region (e.g. a
+   normal page wksp).  Compiled code contains absolute addresses and is
+   only valid in the process that compiled it.  When all code slots are
+   in use, a pending program takes over the code slot of the compiled
+   program with the fewest invocations if it has more invocations.
+
+   IMPORTANT SAFETY TIP!  The transpiler is experimental (see fd_jit.h)
+   and does not meter compute units.  The runtime thus does not use the
+   cache.  It must not be used on a consensus critical path until the
+   transpiler meters compute units.
+
+   Concurrency: fd_jit_cache_query can be called concurrently from any
+   number of threads.  Code returned by a query can be run concurrently
+   via fd_jit_exec (which runs a program on one thread at a time and
+   returns FD_VM_ERR_UNSUP to the others, which then interpret it).
+   fd_jit_cache_pending and fd_jit_cache_compile must not overlap with
+   queries or with any execution of code returned by a query.  Compiles
+   of different entries can run concurrently with each other. */
+
+#include "fd_jit.h"
+
+#if FD_HAS_X86 && FD_HAS_THREADS
+
+/* FD_JIT_CACHE_{ALIGN,PAGE_SZ} give the alignment of a cache and the
+   granularity of code slots.  The alignment is at least the page size
+   such that code slots can be mprotect-ed individually. */
+
+#define FD_JIT_CACHE_ALIGN   (4096UL)
+#define FD_JIT_CACHE_PAGE_SZ (4096UL)
+
+#define FD_JIT_CACHE_MAGIC (0xf17ca3e0c0dec0deUL) /* random */
+
+/* FD_JIT_CACHE_STATE_* give the state of a cache entry */
+
+#define FD_JIT_CACHE_STATE_FREE   (0) /* entry not used */
+#define FD_JIT_CACHE_STATE_CLAIM  (1) /* entry being claimed for a program */
+#define FD_JIT_CACHE_STATE_COLD   (2) /* program tracked, no native code */
+#define FD_JIT_CACHE_STATE_READY  (3) /* native code for (deploy_slot,epoch) */
+#define FD_JIT_CACHE_STATE_FAILED (4) /* compile failed for (deploy_slot,epoch) */
+
+struct __attribute__((aligned(64UL))) fd_jit_cache_ent {
+  fd_pubkey_t   key;         /* program account address, valid if state>CLAIM */
+  int           state;       /* FD_JIT_CACHE_STATE_* */
+  uint          code_idx;    /* code slot owned by this entry, UINT_MAX if none */
+  ulong         hit_cnt;     /* number of queries */
+  ulong         want_slot;   /* deploy slot of the most recent query */
+  ulong         want_epoch;  /* epoch of the most recent query */
+  ulong         deploy_slot; /* deploy slot of the compile attempt, valid if READY or FAILED */
+  ulong         epoch;       /* epoch of the compile attempt, valid if READY or FAILED */
+  fd_jit_prog_t prog;        /* native code, valid if READY */
+};
+
+typedef struct fd_jit_cache_ent fd_jit_cache_ent_t;
+
+struct fd_jit_cache_private;
+typedef struct fd_jit_cache_private fd_jit_cache_t;
+
+FD_PROTOTYPES_BEGIN
+
+/* fd_jit_cache_{align,footprint} return the alignment and footprint of
+   a memory region suitable for use as a cache.  ent_max is the number
+   of programs that can be tracked (a power of two, twice the expected
+   number of distinct programs is a good default).  code_max is the
+   number of programs that can have native code at the same time.
+   code_slot_sz is the max native code size of a program in bytes
+   (rounded up to FD_JIT_CACHE_PAGE_SZ).  Returns 0 for invalid
+   parameters. */
+
+FD_FN_CONST ulong
+fd_jit_cache_align( void );
+
+FD_FN_CONST ulong
+fd_jit_cache_footprint( ulong ent_max,
+                        ulong code_max,
+                        ulong code_slot_sz );
+
+/* fd_jit_cache_new formats a memory region with suitable alignment and
+   footprint as a cache.  Programs become pending after hot_thresh
+   queries (0 compiles a program on its first use).  Returns shmem on
+   success and NULL on failure (logs details).  fd_jit_cache_join joins
+   the caller to a cache.  fd_jit_cache_leave leaves a current local
+   join.  fd_jit_cache_delete unformats a memory region used as a cache
+   and makes all code slots writable again.  Usual conventions
+   apply. */
+
+void *
+fd_jit_cache_new( void * shmem,
+                  ulong  ent_max,
+                  ulong  code_max,
+                  ulong  code_slot_sz,
+                  ulong  hot_thresh );
+
+fd_jit_cache_t *
+fd_jit_cache_join( void * shcache );
+
+void *
+fd_jit_cache_leave( fd_jit_cache_t * cache );
+
+void *
+fd_jit_cache_delete( void * shcache );
+
+/* Accessors */
+
+FD_FN_PURE ulong fd_jit_cache_ent_max     ( fd_jit_cache_t const * cache );
+FD_FN_PURE ulong fd_jit_cache_code_max    ( fd_jit_cache_t const * cache );
+FD_FN_PURE ulong fd_jit_cache_code_slot_sz( fd_jit_cache_t const * cache );
+
+/* fd_jit_cache_ent returns a pointer in the caller's address space to
+   entry ent_idx in [0,ent_max) of cache.  Intended for diagnostics and
+   for looking up the key of a pending entry. */
+
+FD_FN_PURE fd_jit_cache_ent_t const *
+fd_jit_cache_ent( fd_jit_cache_t const * cache,
+                  ulong                  ent_idx );
+
+/* fd_jit_cache_query looks up the native code of the program at address
+   program_id deployed at deploy_slot for epoch.  Returns a pointer to
+   the compiled program on a hit.  On a miss, returns NULL and records
+   the invocation (starts tracking the program if not yet tracked and
+   the cache is not full). */
+
+fd_jit_prog_t *
+fd_jit_cache_query( fd_jit_cache_t *    cache,
+                    fd_pubkey_t const * program_id,
+                    ulong               deploy_slot,
+                    ulong               epoch );
+
+/* fd_jit_cache_pending writes the indices of up to ent_idx_max entries
+   that are hot and have no native code matching their most recently
+   queried tag into ent_idx and returns the number written.  Every
+   returned entry is assigned a code slot (evicting colder native code
+   if needed).  Entries that cannot get a code slot are not returned. */
+
+ulong
+fd_jit_cache_pending( fd_jit_cache_t * cache,
+                      ulong *          ent_idx,
+                      ulong            ent_idx_max );
+
+/* fd_jit_cache_compile compiles prog (the program currently deployed at
+   the key of entry ent_idx) into the code slot of the entry.  syscalls
+   is the syscall table programs run with during epoch.  scratch is a
+   region of scratch_sz bytes (at least fd_jit_est_scratch_sz) used
+   during compilation.  ent_idx should have been returned by the most
+   recent fd_jit_cache_pending.  On success, the entry is READY for
+   (deploy_slot,epoch) and FD_VM_SUCCESS is returned.  On failure, the
+   entry is FAILED for (deploy_slot,epoch) (such that the program is not
+   retried until upgraded or until the next epoch) and an FD_VM_ERR code
+   is returned. */
+
+int
+fd_jit_cache_compile( fd_jit_cache_t *           cache,
+                      ulong                      ent_idx,
+                      fd_sbpf_program_t const *  prog,
+                      fd_sbpf_syscalls_t const * syscalls,
+                      ulong                      deploy_slot,
+                      ulong                      epoch,
+                      void *                     scratch,
+                      ulong                      scratch_sz );
+
+FD_PROTOTYPES_END
+
+#endif /* FD_HAS_X86 && FD_HAS_THREADS */
+
+#endif /* HEADER_fd_src_flamenco_vm_jit_fd_jit_cache_h */
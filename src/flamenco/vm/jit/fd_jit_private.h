@@ -65,12 +65,13 @@ extern FD_TL uint  fd_jit_segment_cnt;
 extern FD_TL uint  fd_jit_mem_sz   [ 2*FD_VM_JIT_SEGMENT_MAX ];
 extern FD_TL ulong fd_jit_mem_haddr[   FD_VM_JIT_SEGMENT_MAX ];
 
-/* Thread-local storage for fast return to JIT entrypoint
-   These are a setjmp()-like anchor for quickly exiting out of a VM
-   execution, e.g. in case of a VM fault.
+/* fd_jit_jmp_buf points to the setjmp()-like anchor for quickly
+   exiting out of a VM execution, e.g. in case of a VM fault.  Set to
+   the jmp_buf of the program being compiled while compiling (the
+   address is embedded into the generated code, see fd_jit_prog_t).
    Slots: 0=rbx 1=rbp 2=r12 3=r13 4=r14 5=r15 6=rsp 7=rip */
 
-extern FD_TL ulong fd_jit_jmp_buf[8];
+extern FD_TL ulong * fd_jit_jmp_buf;
 
 /* Thread-local storage for exception handling */
 
@@ -0,0 +1,282 @@
+#include "fd_jit_cache.h"
+#include "../../../util/tpool/fd_tpool.h"
+
+FD_STATIC_ASSERT( FD_JIT_CACHE_ALIGN>=FD_JIT_CACHE_PAGE_SZ, layout );
+FD_STATIC_ASSERT( sizeof(fd_jit_cache_ent_t)==192UL,        layout );
+
+#define ENT_MAX      (16UL)
+#define CODE_MAX     (2UL)
+#define CODE_SLOT_SZ (16384UL)
+#define HOT_THRESH   (3UL)
+
+static uchar cache_mem[ 65536 ] __attribute__((aligned(FD_JIT_CACHE_ALIGN)));
+static uchar scratch  [ 65536 ] __attribute__((aligned(64)));
+static uchar syscalls_mem[ 1UL<<16 ] __attribute__((aligned(128)));
+
+static fd_vm_t vm[1];
+
+#define MT_ITER_CNT (100000UL)
+
+static ulong volatile mt_start;
+
+/* mov64 r0, imm; exit (or mod64 r0, 0; exit if op is 0x97) */
+
+static void
+make_prog( fd_sbpf_program_t * prog,
+           ulong *             text,
+           ulong               op,
+           uint                imm ) {
+  text[0] = op | ((ulong)imm<<32);
+  text[1] = 0x95UL;
+  memset( prog, 0, sizeof(fd_sbpf_program_t) );
+  prog->rodata    = text;
+  prog->rodata_sz = 16UL;
+  prog->text      = text;
+  prog->text_cnt  = 2UL;
+  prog->text_sz   = 16UL;
+  prog->entry_pc  = 0UL;
+}
+
+static int
+run_vm( fd_vm_t *       vm,
+        fd_jit_prog_t * jit_prog,
+        ulong           r1 ) {
+  fd_vm_input_region_t input_region = { .vaddr_offset = 0UL, .haddr = 0UL, .region_sz = 0U, .is_writable = 0U };
+  memset( vm->reg, 0, sizeof(vm->reg) );
+  vm->reg[1]                = r1;
+  vm->input_mem_regions     = &input_region;
+  vm->input_mem_regions_cnt = 1U;
+  vm->frame_cnt             = 0UL;
+  vm->reg[10]               = FD_VM_MEM_MAP_STACK_REGION_START + 0x1000;
+  vm->jit_prog              = jit_prog;
+  int err = fd_vm_exec_jit( vm );
+  vm->jit_prog              = NULL;
+  vm->input_mem_regions     = NULL;
+  vm->input_mem_regions_cnt = 0U;
+  return err;
+}
+
+static int
+run( fd_jit_prog_t * jit_prog ) {
+  return run_vm( vm, jit_prog, 0UL );
+}
+
+/* mt_task runs the cached program at args (r0=7/r1) alternately with
+   r1=1 (returns 7) and r1=0 (faults) on worker thread t0 with its own
+   vm.  Runs rejected because the other worker is executing the program
+   (which would fall back to the interpreter) are skipped.  Stores the
+   number of mismatches at reduce[t0].  Workers wait for mt_start such
+   that they run at the same time. */
+
+static void
+mt_task( void * tpool,
+         ulong  t0,     ulong t1,
+         void * args,
+         void * reduce, ulong stride,
+         ulong  l0,     ulong l1,
+         ulong  m0,     ulong m1,
+         ulong  n0,     ulong n1 ) {
+  (void)tpool; (void)t1; (void)stride; (void)l0; (void)l1; (void)m0; (void)m1; (void)n0; (void)n1;
+  fd_jit_prog_t * prog = (fd_jit_prog_t *)args;
+  while( !mt_start ) FD_SPIN_PAUSE();
+
+  fd_vm_t tvm[1];
+  memset( tvm, 0, sizeof(fd_vm_t) );
+  ulong bad = 0UL;
+  for( ulong i=0UL; i<MT_ITER_CNT; i++ ) {
+    ulong r1  = (ulong)!(i&1UL);
+    int   err = run_vm( tvm, prog, r1 );
+    if( err==FD_VM_ERR_UNSUP ) continue; /* busy */
+    if( r1 ) bad += (err!=FD_VM_SUCCESS) | (tvm->reg[0]!=7UL);
+    else     bad += err==FD_VM_SUCCESS;
+  }
+  ((ulong *)reduce)[ t0 ] = bad;
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  FD_TEST( fd_jit_cache_align()==FD_JIT_CACHE_ALIGN );
+  FD_TEST( !fd_jit_cache_footprint( 0UL,   CODE_MAX, CODE_SLOT_SZ ) );
+  FD_TEST( !fd_jit_cache_footprint( 3UL,   CODE_MAX, CODE_SLOT_SZ ) );
+  FD_TEST( !fd_jit_cache_footprint( 16UL,  0UL,      CODE_SLOT_SZ ) );
+  FD_TEST( !fd_jit_cache_footprint( 16UL,  CODE_MAX, 0UL          ) );
+  ulong footprint = fd_jit_cache_footprint( ENT_MAX, CODE_MAX, CODE_SLOT_SZ );
+  FD_TEST( footprint && footprint<=sizeof(cache_mem) );
+  FD_TEST( fd_ulong_is_aligned( footprint, FD_JIT_CACHE_ALIGN ) );
+  FD_TEST( fd_jit_cache_footprint( ENT_MAX, CODE_MAX, CODE_SLOT_SZ-1UL )==footprint ); /* slot rounded up to page */
+
+  FD_TEST( !fd_jit_cache_new( NULL,          ENT_MAX, CODE_MAX, CODE_SLOT_SZ, HOT_THRESH ) );
+  FD_TEST( !fd_jit_cache_new( cache_mem+1UL, ENT_MAX, CODE_MAX, CODE_SLOT_SZ, HOT_THRESH ) );
+  FD_TEST( !fd_jit_cache_new( cache_mem,     3UL,     CODE_MAX, CODE_SLOT_SZ, HOT_THRESH ) );
+  FD_TEST( !fd_jit_cache_join( NULL ) );
+  FD_TEST( !fd_jit_cache_join( cache_mem ) ); /* not formatted */
+
+  fd_jit_cache_t * cache = fd_jit_cache_join( fd_jit_cache_new( cache_mem, ENT_MAX, CODE_MAX, CODE_SLOT_SZ, HOT_THRESH ) );
+  FD_TEST( cache );
+  FD_TEST( fd_jit_cache_ent_max     ( cache )==ENT_MAX      );
+  FD_TEST( fd_jit_cache_code_max    ( cache )==CODE_MAX     );
+  FD_TEST( fd_jit_cache_code_slot_sz( cache )==CODE_SLOT_SZ );
+
+  fd_sbpf_syscalls_t * syscalls = fd_sbpf_syscalls_join( fd_sbpf_syscalls_new( syscalls_mem ) );
+  FD_TEST( fd_sbpf_syscalls_footprint()<=sizeof(syscalls_mem) );
+  FD_TEST( syscalls );
+  FD_TEST( fd_jit_est_scratch_sz( 16UL )<=sizeof(scratch) );
+
+  memset( vm, 0, sizeof(fd_vm_t) ); /* fd_vm objects are not needed to run native code */
+
+  fd_pubkey_t key[3];
+  for( ulong i=0UL; i<3UL; i++ ) memset( key+i, (int)(0x10+i), sizeof(fd_pubkey_t) );
+
+  ulong ent_idx[ ENT_MAX ];
+
+  /* Programs become pending after HOT_THRESH misses */
+
+  for( ulong i=0UL; i<HOT_THRESH-1UL; i++ ) FD_TEST( !fd_jit_cache_query( cache, key+0, 100UL, 1UL ) );
+  FD_TEST( !fd_jit_cache_pending( cache, ent_idx, ENT_MAX ) );
+  FD_TEST( !fd_jit_cache_query( cache, key+0, 100UL, 1UL ) );
+  FD_TEST( fd_jit_cache_pending( cache, ent_idx, ENT_MAX )==1UL );
+  FD_TEST( fd_memeq( &fd_jit_cache_ent( cache, ent_idx[0] )->key, key+0, sizeof(fd_pubkey_t) ) );
+  FD_TEST( !fd_jit_cache_pending( cache, ent_idx, 0UL ) );
+
+  /* Compile and run */
+
+  ulong             text[2];
+  fd_sbpf_program_t prog[1];
+  make_prog( prog, text, 0xb7UL, 42U );
+  FD_TEST( fd_jit_cache_compile( cache, ent_idx[0], prog, syscalls, 100UL, 1UL, scratch, sizeof(scratch) )==FD_VM_SUCCESS );
+  FD_TEST( fd_jit_cache_ent( cache, ent_idx[0] )->state==FD_JIT_CACHE_STATE_READY );
+  FD_TEST( !fd_jit_cache_pending( cache, ent_idx, ENT_MAX ) );
+
+  fd_jit_prog_t * jit_prog = fd_jit_cache_query( cache, key+0, 100UL, 1UL );
+  FD_TEST( jit_prog );
+  FD_TEST( run( jit_prog )==FD_VM_SUCCESS );
+  FD_TEST( vm->reg[0]==42UL );
+
+  /* Unsupported execution contexts are left to the interpreter */
+
+  vm->jit_prog = jit_prog;
+  FD_TEST( fd_vm_exec_jit( vm )==FD_VM_ERR_UNSUP ); /* no input region */
+  vm->jit_prog = NULL;
+
+  jit_prog->busy = 1UL; /* another thread is executing the program */
+  FD_TEST( run( jit_prog )==FD_VM_ERR_UNSUP );
+  jit_prog->busy = 0UL;
+  FD_TEST( run( jit_prog )==FD_VM_SUCCESS );
+
+  /* Faults are reported as errors */
+
+  FD_TEST( !fd_jit_cache_query( cache, key+0, 99UL, 1UL ) );
+  FD_TEST( fd_jit_cache_pending( cache, ent_idx, ENT_MAX )==1UL );
+  make_prog( prog, text, 0x97UL, 0U );
+  FD_TEST( fd_jit_cache_compile( cache, ent_idx[0], prog, syscalls, 99UL, 1UL, scratch, sizeof(scratch) )==FD_VM_SUCCESS );
+  FD_TEST( run( fd_jit_cache_query( cache, key+0, 99UL, 1UL ) )==FD_VM_ERR_SIGABORT );
+
+  /* Upgrade (new deploy slot) and new epoch invalidate */
+
+  FD_TEST( !fd_jit_cache_query( cache, key+0, 101UL, 1UL ) );
+  FD_TEST( fd_jit_cache_pending( cache, ent_idx, ENT_MAX )==1UL );
+  make_prog( prog, text, 0xb7UL, 7U );
+  FD_TEST( fd_jit_cache_compile( cache, ent_idx[0], prog, syscalls, 101UL, 1UL, scratch, sizeof(scratch) )==FD_VM_SUCCESS );
+  FD_TEST( !fd_jit_cache_query( cache, key+0, 100UL, 1UL ) );
+  jit_prog = fd_jit_cache_query( cache, key+0, 101UL, 1UL );
+  FD_TEST( jit_prog );
+  FD_TEST( run( jit_prog )==FD_VM_SUCCESS );
+  FD_TEST( vm->reg[0]==7UL );
+
+  FD_TEST( !fd_jit_cache_query( cache, key+0, 101UL, 2UL ) );
+  FD_TEST( fd_jit_cache_pending( cache, ent_idx, ENT_MAX )==1UL );
+  FD_TEST( fd_jit_cache_compile( cache, ent_idx[0], prog, syscalls, 101UL, 2UL, scratch, sizeof(scratch) )==FD_VM_SUCCESS );
+  FD_TEST( fd_jit_cache_query( cache, key+0, 101UL, 2UL ) );
+
+  /* Failed compiles are not retried for the same tag */
+
+  for( ulong i=0UL; i<HOT_THRESH; i++ ) FD_TEST( !fd_jit_cache_query( cache, key+1, 200UL, 2UL ) );
+  FD_TEST( fd_jit_cache_pending( cache, ent_idx, ENT_MAX )==1UL );
+  FD_TEST( fd_jit_cache_compile( cache, ent_idx[0], prog, syscalls, 200UL, 2UL, scratch, 8UL )==FD_VM_ERR_FULL );
+  FD_TEST( fd_jit_cache_ent( cache, ent_idx[0] )->state==FD_JIT_CACHE_STATE_FAILED );
+  FD_TEST( fd_jit_cache_ent( cache, ent_idx[0] )->code_idx==UINT_MAX );
+  FD_TEST( !fd_jit_cache_query( cache, key+1, 200UL, 2UL ) );
+  FD_TEST( !fd_jit_cache_pending( cache, ent_idx, ENT_MAX ) );
+
+  /* Eviction: key 1 gets the free slot, key 2 (hotter than key 1 after
+     more queries) takes over key 1's slot once all slots are used */
+
+  FD_TEST( !fd_jit_cache_query( cache, key+1, 201UL, 2UL ) );
+  FD_TEST( fd_jit_cache_pending( cache, ent_idx, ENT_MAX )==1UL );
+  ulong ent1 = ent_idx[0];
+  FD_TEST( fd_jit_cache_compile( cache, ent1, prog, syscalls, 201UL, 2UL, scratch, sizeof(scratch) )==FD_VM_SUCCESS );
+
+  for( ulong i=0UL; i<100UL; i++ ) FD_TEST( fd_jit_cache_query( cache, key+0, 101UL, 2UL ) );
+  for( ulong i=0UL; i<50UL;  i++ ) FD_TEST( !fd_jit_cache_query( cache, key+2, 300UL, 2UL ) );
+  FD_TEST( fd_jit_cache_pending( cache, ent_idx, ENT_MAX )==1UL );
+  FD_TEST( fd_memeq( &fd_jit_cache_ent( cache, ent_idx[0] )->key, key+2, sizeof(fd_pubkey_t) ) );
+  FD_TEST( fd_jit_cache_ent( cache, ent1 )->state==FD_JIT_CACHE_STATE_COLD );
+  FD_TEST( !fd_jit_cache_query( cache, key+1, 201UL, 2UL ) );
+  FD_TEST( fd_jit_cache_query( cache, key+0, 101UL, 2UL ) );
+  FD_TEST( fd_jit_cache_compile( cache, ent_idx[0], prog, syscalls, 300UL, 2UL, scratch, sizeof(scratch) )==FD_VM_SUCCESS );
+  FD_TEST( run( fd_jit_cache_query( cache, key+2, 300UL, 2UL ) )==FD_VM_SUCCESS );
+  FD_TEST( vm->reg[0]==7UL );
+
+  /* Cache full */
+
+  for( ulong i=0UL; i<ENT_MAX; i++ ) {
+    fd_pubkey_t k; memset( &k, 0, sizeof(fd_pubkey_t) ); k.ul[0] = 1000UL+i;
+    FD_TEST( !fd_jit_cache_query( cache, &k, 0UL, 0UL ) );
+  }
+  FD_TEST( fd_jit_cache_query( cache, key+0, 101UL, 2UL ) );
+
+  FD_TEST( fd_jit_cache_leave( cache )==cache_mem );
+  FD_TEST( fd_jit_cache_delete( cache_mem )==cache_mem );
+  FD_TEST( !fd_jit_cache_join( cache_mem ) );
+
+  /* Multiple threads run the same native code.  Each run faults back
+     into the execution context of the thread running it. */
+
+  if( fd_tile_cnt()<3UL ) {
+    FD_LOG_WARNING(( "skip: multi-threaded test requires at least 3 tiles" ));
+  } else {
+    cache = fd_jit_cache_join( fd_jit_cache_new( cache_mem, ENT_MAX, CODE_MAX, CODE_SLOT_SZ, 1UL ) );
+    FD_TEST( cache );
+    FD_TEST( !fd_jit_cache_query( cache, key+0, 500UL, 3UL ) );
+    FD_TEST( fd_jit_cache_pending( cache, ent_idx, ENT_MAX )==1UL );
+
+    /* mov64 r0, 7; div64 r0, r1; exit */
+    ulong div_text[3];
+    make_prog( prog, div_text, 0xb7UL, 7U );
+    div_text[1]     = 0x3fUL | (0x10UL<<8);
+    div_text[2]     = 0x95UL;
+    prog->rodata_sz = 24UL;
+    prog->text_cnt  = 3UL;
+    prog->text_sz   = 24UL;
+    FD_TEST( fd_jit_cache_compile( cache, ent_idx[0], prog, syscalls, 500UL, 3UL, scratch, sizeof(scratch) )==FD_VM_SUCCESS );
+    jit_prog = fd_jit_cache_query( cache, key+0, 500UL, 3UL );
+    FD_TEST( jit_prog );
+    FD_TEST( run_vm( vm, jit_prog, 1UL )==FD_VM_SUCCESS && vm->reg[0]==7UL );
+    FD_TEST( run_vm( vm, jit_prog, 0UL )!=FD_VM_SUCCESS );
+
+    static uchar tpool_mem[ FD_TPOOL_FOOTPRINT(3UL) ] __attribute__((aligned(FD_TPOOL_ALIGN)));
+    fd_tpool_t * tpool = fd_tpool_init( tpool_mem, 3UL ); FD_TEST( tpool );
+    for( ulong tile_idx=1UL; tile_idx<3UL; tile_idx++ ) FD_TEST( fd_tpool_worker_push( tpool, tile_idx, NULL, 0UL )==tpool );
+
+    ulong bad[3] = { 0UL, ULONG_MAX, ULONG_MAX };
+    for( ulong t=1UL; t<3UL; t++ ) fd_tpool_exec( tpool, t, mt_task, tpool, t, t+1UL, (void *)(ulong)jit_prog, bad, 0UL, 0UL, 0UL, 0UL, 0UL, 0UL, 0UL );
+    FD_COMPILER_MFENCE();
+    mt_start = 1UL;
+    FD_COMPILER_MFENCE();
+    for( ulong t=1UL; t<3UL; t++ ) fd_tpool_wait( tpool, t );
+    FD_TEST( !bad[1] && !bad[2] );
+
+    fd_tpool_fini( tpool );
+    FD_TEST( fd_jit_cache_leave( cache )==cache_mem );
+    FD_TEST( fd_jit_cache_delete( cache_mem )==cache_mem );
+  }
+
+  fd_sbpf_syscalls_delete( fd_sbpf_syscalls_leave( syscalls ) );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
@@ -645,6 +645,12 @@ VM_SYSCALL_CPI_ENTRYPOINT( void *  _vm,
 
   FD_VM_CU_UPDATE( vm, FD_VM_INVOKE_UNITS );
 
+  /* The callee can read and replace the data of the caller's accounts,
+     so account data mapped copy on write can't keep referencing the
+     borrowed account data from here on. */
+
+  fd_vm_input_region_cow_copy_all( vm );
+
   /* Translate instruction ********************************************/
   /* translate_instruction is the first thing that agave does
      https://github.com/anza-xyz/agave/blob/838c1952595809a31520ff1603a13f2c9123aa51/programs/bpf_loader/src/syscalls/cpi.rs#L1089 */
@@ -749,6 +749,41 @@ main( int     argc,
 
 # undef APPEND
 
+  /* Copy on write input region: region 2 maps acct_data in place until
+     the first write or the first access spanning into a neighbor */
+
+  test_vm_syscall_toggle_direct_mapping( vm, 0 ); /* disable direct mapping */
+
+  uchar acct_data[ 400UL ];
+  for( ulong i=0UL; i<400UL; i++ ) acct_data[i] = (uchar)(0xff-(i & 0xffUL));
+  memset( input, 0, input_sz );
+
+  uchar is_multi = 0;
+  input_mem_regions[2] = (fd_vm_input_region_t){ .haddr = (ulong)acct_data, .cow_haddr = (ulong)input + 101UL, .region_sz = 400UL,
+                                                 .is_writable = 1, .is_acct_data = 1, .is_cow = 1, .vaddr_offset = 101UL };
+  FD_TEST( fd_vm_find_input_mem_region( vm, 150UL, 10UL, 0, 0UL, &is_multi )==(ulong)acct_data + 49UL );
+  FD_TEST( !is_multi && input_mem_regions[2].cow_haddr );
+  FD_TEST( fd_vm_find_input_mem_region( vm, 490UL, 20UL, 0, 0UL, &is_multi )==(ulong)input + 490UL );
+  FD_TEST( is_multi && !input_mem_regions[2].cow_haddr && !memcmp( input + 101UL, acct_data, 400UL ) );
+  FD_TEST( input_mem_regions[2].dirty_hi<=input_mem_regions[2].dirty_lo );
+
+  memset( input, 0, input_sz );
+  input_mem_regions[2] = (fd_vm_input_region_t){ .haddr = (ulong)acct_data, .cow_haddr = (ulong)input + 101UL, .region_sz = 400UL,
+                                                 .is_writable = 1, .is_acct_data = 1, .is_cow = 1, .vaddr_offset = 101UL };
+  FD_TEST( fd_vm_find_input_mem_region( vm, 200UL, 4UL, 1, 0UL, &is_multi )==(ulong)input + 200UL );
+  FD_TEST( !input_mem_regions[2].cow_haddr && !memcmp( input + 101UL, acct_data, 400UL ) );
+  FD_TEST( input_mem_regions[2].dirty_lo==99U && input_mem_regions[2].dirty_hi==103U );
+  FD_TEST( fd_vm_find_input_mem_region( vm, 120UL, 1UL, 1, 0UL, &is_multi )==(ulong)input + 120UL );
+  FD_TEST( input_mem_regions[2].dirty_lo==19U && input_mem_regions[2].dirty_hi==103U );
+  FD_TEST( fd_vm_find_input_mem_region( vm, 495UL, 10UL, 1, 0UL, &is_multi )==(ulong)input + 495UL );
+  FD_TEST( is_multi && input_mem_regions[2].dirty_lo==19U && input_mem_regions[2].dirty_hi==400U );
+
+  input_mem_regions[2] = (fd_vm_input_region_t){ .haddr = (ulong)acct_data, .cow_haddr = (ulong)input + 101UL, .region_sz = 400UL,
+                                                 .is_writable = 0, .is_acct_data = 1, .is_cow = 1, .vaddr_offset = 101UL };
+  FD_TEST( fd_vm_find_input_mem_region( vm, 200UL, 4UL, 1, 0UL, &is_multi )==0UL );
+  FD_TEST( input_mem_regions[2].cow_haddr );
+  input_mem_regions[2] = (fd_vm_input_region_t){ .haddr = (ulong)input + 101UL, .region_sz = 400UL, .is_writable = 1, .vaddr_offset = 101UL };
+
   fd_vm_delete    ( fd_vm_leave    ( vm  ) );
   fd_sha256_delete( fd_sha256_leave( sha ) );
   fd_rng_delete   ( fd_rng_leave   ( rng ) );
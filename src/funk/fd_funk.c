@@ -117,6 +117,17 @@ fd_funk_new( void * shmem,
     return NULL;
   }
 
+  fd_funk_rec_lock_t * rec_lock = (fd_funk_rec_lock_t *)
+    fd_wksp_alloc_laddr( wksp, FD_FUNK_REC_LOCK_ALIGN, FD_FUNK_REC_LOCK_CNT*sizeof(fd_funk_rec_lock_t), wksp_tag );
+  if( FD_UNLIKELY( !rec_lock ) ) {
+    FD_LOG_WARNING(( "record locks too large for workspace" ));
+    fd_wksp_free_laddr( fd_alloc_delete( fd_alloc_leave( alloc ) ) );
+    fd_wksp_free_laddr( fd_funk_rec_map_delete( fd_funk_rec_map_leave( rec_map ) ) );
+    fd_wksp_free_laddr( fd_funk_txn_map_delete( fd_funk_txn_map_leave( txn_map ) ) );
+    return NULL;
+  }
+  for( ulong lock_idx=0UL; lock_idx<FD_FUNK_REC_LOCK_CNT; lock_idx++ ) rec_lock[ lock_idx ].lock = 0UL;
+
   fd_memset( funk, 0, fd_funk_footprint() );
 
   funk->funk_gaddr = fd_wksp_gaddr_fast( wksp, funk );
@@ -139,10 +150,14 @@ fd_funk_new( void * shmem,
 
   funk->alloc_gaddr = fd_wksp_gaddr_fast( wksp, alloc ); /* Note that this persists the join until delete */
 
+  funk->rec_lock_gaddr = fd_wksp_gaddr_fast( wksp, rec_lock );
+  funk->rec_pool_lock  = 0UL;
+
   ulong tmp_max;
   fd_funk_partvec_t * partvec = (fd_funk_partvec_t *)fd_alloc_malloc_at_least( alloc, fd_funk_partvec_align(), fd_funk_partvec_footprint(0U), &tmp_max );
   if( FD_UNLIKELY( !partvec ) ) {
     FD_LOG_WARNING(( "partvec alloc failed" ));
+    fd_wksp_free_laddr( rec_lock );
     fd_wksp_free_laddr( fd_alloc_delete( alloc_shalloc ) );
     fd_wksp_free_laddr( fd_funk_rec_map_delete( fd_funk_rec_map_leave( rec_map ) ) );
     fd_wksp_free_laddr( fd_funk_txn_map_delete( fd_funk_txn_map_leave( txn_map ) ) );
@@ -231,6 +246,8 @@ fd_funk_delete( void * shfunk ) {
   /* Free all value resources here */
   fd_alloc_free( fd_funk_alloc( funk, wksp ), fd_funk_get_partvec( funk, wksp ) );
 
+  if( funk->rec_lock_gaddr ) fd_wksp_free_laddr( fd_wksp_laddr_fast( wksp, funk->rec_lock_gaddr ) );
+  if( funk->cold_gaddr     ) fd_wksp_free_laddr( fd_wksp_laddr_fast( wksp, funk->cold_gaddr     ) );
   fd_wksp_free_laddr( fd_alloc_delete       ( fd_alloc_leave       ( fd_funk_alloc  ( funk, wksp ) ) ) );
   fd_wksp_free_laddr( fd_funk_rec_map_delete( fd_funk_rec_map_leave( fd_funk_rec_map( funk, wksp ) ) ) );
   fd_wksp_free_laddr( fd_funk_txn_map_delete( fd_funk_txn_map_leave( fd_funk_txn_map( funk, wksp ) ) ) );
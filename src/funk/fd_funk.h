@@ -257,6 +257,38 @@ struct __attribute__((aligned(FD_FUNK_ALIGN))) fd_funk_private {
 
   ulong alloc_gaddr; /* Non-zero wksp gaddr with tag wksp tag */
 
+  /* The record locks allow multiple threads to insert and modify
+     records of the same in-preparation transaction concurrently (see
+     fd_funk_rec_write_prepare_concur in fd_funk_rec.h).  The rec_map
+     hash chains are sharded over FD_FUNK_REC_LOCK_CNT spin locks such
+     that all incarnations of a record key are covered by the same
+     lock.  rec_pool_lock briefly guards the rec_map free pool and the
+     record lists of transactions when a concurrent writer links a new
+     record.  rec_lock_gaddr is 0 for funks formatted before the locks
+     existed, in which case concurrent writers all use rec_pool_lock. */
+
+  ulong          rec_lock_gaddr; /* Wksp gaddr with tag wksp_tag of FD_FUNK_REC_LOCK_CNT fd_funk_rec_lock_t, 0 if none */
+  volatile ulong rec_pool_lock;  /* 0 if unlocked, 1 if locked */
+
+  /* cold_clock is the application's notion of time (typically the
+     slot) for the cold storage tier.  Records are stamped with it when
+     written or faulted in and fd_funk_cold_evict evicts published
+     records whose stamp is old enough.  See fd_funk_cold.h. */
+
+  ulong cold_clock;
+
+  /* cold_gaddr locates the shared state of the cold tier attached to
+     this funk (fd_funk_cold_shmem_t, see fd_funk_cold.h). */
+
+  ulong cold_gaddr; /* Wksp gaddr with tag wksp_tag of the cold tier state, 0 if none */
+
+  /* ckpt_seq is the sequence number of the last checkpoint written by
+     (or restored into) this funk with fd_funk_ckpt_write (or
+     fd_funk_ckpt_restore), 0 if none.  An incremental checkpoint is
+     only valid on top of checkpoint ckpt_seq.  See fd_funk_ckpt.h. */
+
+  ulong ckpt_seq;
+
   /* Padding to FD_FUNK_ALIGN here */
 };
 
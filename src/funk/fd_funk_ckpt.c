@@ -0,0 +1,583 @@
+#define _GNU_SOURCE
+#define _FILE_OFFSET_BITS 64
+#include "fd_funk_ckpt.h"
+#include "fd_funk_cold.h"
+#include "../util/wksp/fd_wksp_private.h"
+#include <stdio.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+FD_STATIC_ASSERT( sizeof(fd_funk_ckpt_hdr_t)  ==96UL, layout );
+FD_STATIC_ASSERT( sizeof(fd_funk_ckpt_chunk_t)==16UL, layout );
+FD_STATIC_ASSERT( sizeof(fd_funk_ckpt_rec_t)  ==56UL, layout );
+
+/* Flags that are meaningful in a checkpoint */
+
+#define FD_FUNK_CKPT_FLAG_MASK (~(FD_FUNK_REC_FLAG_COLD|FD_FUNK_REC_FLAG_DIRTY))
+
+/* fd_funk_ckpt_rec_footprint returns the byte footprint of a checkpoint
+   record with a val_sz byte value. */
+
+FD_FN_CONST static inline ulong
+fd_funk_ckpt_rec_footprint( ulong val_sz ) {
+  return sizeof(fd_funk_ckpt_rec_t) + fd_ulong_align_up( val_sz, FD_FUNK_CKPT_ALIGN );
+}
+
+/* Writing ************************************************************/
+
+/* fd_funk_ckpt_writer_t buffers the records of the current chunk */
+
+struct fd_funk_ckpt_writer {
+  int          fd;
+  char const * path;
+  uchar *      buf;     /* FD_FUNK_CKPT_CHUNK_MAX bytes */
+  ulong        buf_sz;  /* Bytes of the current chunk in buf */
+  ulong        buf_cnt; /* Records of the current chunk in buf */
+  ulong        file_sz;
+  ulong        rec_cnt;
+  ulong        chunk_cnt;
+};
+
+typedef struct fd_funk_ckpt_writer fd_funk_ckpt_writer_t;
+
+static int
+fd_funk_ckpt_writer_out( fd_funk_ckpt_writer_t * w,
+                         void const *            src,
+                         ulong                   sz ) {
+  ulong wsz;
+  int   err = fd_io_write( w->fd, src, sz, sz, &wsz );
+  if( FD_UNLIKELY( err ) ) {
+    FD_LOG_WARNING(( "write to %s failed (%i-%s)", w->path, err, fd_io_strerror( err ) ));
+    return FD_FUNK_ERR_SYS;
+  }
+  w->file_sz += sz;
+  return FD_FUNK_SUCCESS;
+}
+
+static int
+fd_funk_ckpt_writer_flush( fd_funk_ckpt_writer_t * w ) {
+  if( !w->buf_cnt ) return FD_FUNK_SUCCESS;
+  fd_funk_ckpt_chunk_t chunk[1] = {{ .rec_cnt = w->buf_cnt, .sz = w->buf_sz }};
+  int err = fd_funk_ckpt_writer_out( w, chunk, sizeof(chunk) );
+  if( FD_LIKELY( !err ) ) err = fd_funk_ckpt_writer_out( w, w->buf, w->buf_sz );
+  w->chunk_cnt++;
+  w->buf_sz  = 0UL;
+  w->buf_cnt = 0UL;
+  return err;
+}
+
+static int
+fd_funk_ckpt_writer_append( fd_funk_ckpt_writer_t *    w,
+                            fd_funk_ckpt_rec_t const * rec,
+                            uchar const *              val ) {
+  ulong val_sz = (ulong)rec->val_sz;
+  ulong rec_sz = fd_funk_ckpt_rec_footprint( val_sz );
+  ulong pad_sz = rec_sz - sizeof(fd_funk_ckpt_rec_t) - val_sz;
+  int   err;
+
+  w->rec_cnt++;
+
+  if( FD_UNLIKELY( rec_sz>FD_FUNK_CKPT_CHUNK_MAX ) ) { /* Huge value, gets its own chunk */
+    static uchar const zeros[ FD_FUNK_CKPT_ALIGN ];
+    fd_funk_ckpt_chunk_t chunk[1] = {{ .rec_cnt = 1UL, .sz = rec_sz }};
+    if( FD_UNLIKELY( (err = fd_funk_ckpt_writer_flush( w ))                            ) ) return err;
+    if( FD_UNLIKELY( (err = fd_funk_ckpt_writer_out( w, chunk, sizeof(chunk) ))        ) ) return err;
+    if( FD_UNLIKELY( (err = fd_funk_ckpt_writer_out( w, rec, sizeof(fd_funk_ckpt_rec_t) )) ) ) return err;
+    if( FD_UNLIKELY( (err = fd_funk_ckpt_writer_out( w, val, val_sz ))                 ) ) return err;
+    if( FD_UNLIKELY( (err = fd_funk_ckpt_writer_out( w, zeros, pad_sz ))               ) ) return err;
+    w->chunk_cnt++;
+    return FD_FUNK_SUCCESS;
+  }
+
+  if( FD_UNLIKELY( w->buf_sz+rec_sz>FD_FUNK_CKPT_CHUNK_MAX ) && FD_UNLIKELY( (err = fd_funk_ckpt_writer_flush( w )) ) ) return err;
+
+  uchar * dst = w->buf + w->buf_sz;
+  fd_memcpy( dst, rec, sizeof(fd_funk_ckpt_rec_t) );
+  if( val_sz ) fd_memcpy( dst + sizeof(fd_funk_ckpt_rec_t), val, val_sz );
+  fd_memset( dst + sizeof(fd_funk_ckpt_rec_t) + val_sz, 0, pad_sz );
+  w->buf_sz += rec_sz;
+  w->buf_cnt++;
+  return FD_FUNK_SUCCESS;
+}
+
+int
+fd_funk_ckpt_write( fd_funk_t *  funk,
+                    char const * path,
+                    int          incr,
+                    ulong *      opt_rec_cnt ) {
+
+  if( FD_UNLIKELY( (!funk) | (!path) ) ) {
+    FD_LOG_WARNING(( "NULL funk or path" ));
+    return FD_FUNK_ERR_INVAL;
+  }
+  fd_funk_check_write( funk );
+
+  if( FD_UNLIKELY( incr && !funk->ckpt_seq ) ) {
+    FD_LOG_WARNING(( "incremental checkpoint requested but funk has no prior checkpoint" ));
+    return FD_FUNK_ERR_INVAL;
+  }
+
+  fd_wksp_t *     wksp    = fd_funk_wksp( funk );
+  fd_funk_rec_t * rec_map = fd_funk_rec_map( funk, wksp );
+  fd_alloc_t *    alloc   = fd_funk_alloc( funk, wksp );
+  ulong           rec_max = funk->rec_max;
+
+  char tmp_path[ PATH_MAX ];
+  if( FD_UNLIKELY( !fd_cstr_printf_check( tmp_path, sizeof(tmp_path), NULL, "%s.tmp", path ) ) ) {
+    FD_LOG_WARNING(( "path too long" ));
+    return FD_FUNK_ERR_INVAL;
+  }
+
+  uchar * buf = (uchar *)fd_alloc_malloc( alloc, FD_FUNK_CKPT_ALIGN, FD_FUNK_CKPT_CHUNK_MAX );
+  if( FD_UNLIKELY( !buf ) ) {
+    FD_LOG_WARNING(( "unable to allocate checkpoint buffer (wksp full)" ));
+    return FD_FUNK_ERR_MEM;
+  }
+
+  int fd = open( tmp_path, O_CREAT|O_TRUNC|O_WRONLY, S_IRUSR|S_IWUSR|S_IRGRP|S_IROTH );
+  if( FD_UNLIKELY( fd<0 ) ) {
+    FD_LOG_WARNING(( "open(%s) failed (%i-%s)", tmp_path, errno, fd_io_strerror( errno ) ));
+    fd_alloc_free( alloc, buf );
+    return FD_FUNK_ERR_SYS;
+  }
+
+  fd_funk_ckpt_writer_t w[1] = {{ .fd = fd, .path = tmp_path, .buf = buf }};
+
+  fd_funk_ckpt_hdr_t hdr[1];
+  memset( hdr, 0, sizeof(fd_funk_ckpt_hdr_t) );
+  int err = fd_funk_ckpt_writer_out( w, hdr, sizeof(fd_funk_ckpt_hdr_t) ); /* Placeholder, rewritten below */
+
+  for( ulong rec_idx = funk->rec_head_idx; !err && !fd_funk_rec_idx_is_null( rec_idx ); rec_idx = rec_map[ rec_idx ].next_idx ) {
+    if( FD_UNLIKELY( rec_idx>=rec_max ) ) FD_LOG_CRIT(( "memory corruption detected (bad idx)" ));
+    fd_funk_rec_t const * rec = rec_map + rec_idx;
+    if( incr && !(rec->flags & FD_FUNK_REC_FLAG_DIRTY) ) continue;
+
+    uchar const * val;
+    ulong         val_sz;
+    if( FD_UNLIKELY( rec->flags & FD_FUNK_REC_FLAG_COLD ) ) {
+      val    = fd_funk_cold_val_const( funk, rec );
+      val_sz = (ulong)rec->cold_sz;
+    } else {
+      val    = (uchar const *)fd_funk_val_const( rec, wksp );
+      val_sz = fd_funk_val_sz( rec );
+    }
+
+    fd_funk_ckpt_rec_t crec[1];
+    memset( crec, 0, sizeof(fd_funk_ckpt_rec_t) );
+    fd_funk_rec_key_copy( crec->key, rec->pair.key );
+    crec->flags  = rec->flags & FD_FUNK_CKPT_FLAG_MASK;
+    crec->part   = rec->part;
+    crec->val_sz = (uint)val_sz;
+
+    err = fd_funk_ckpt_writer_append( w, crec, val );
+  }
+
+  if( FD_LIKELY( !err ) ) err = fd_funk_ckpt_writer_flush( w );
+
+  fd_alloc_free( alloc, buf );
+
+  if( FD_LIKELY( !err ) ) {
+    hdr->magic      = FD_FUNK_CKPT_MAGIC;
+    hdr->seq        = incr ? funk->ckpt_seq+1UL : 1UL;
+    hdr->parent_seq = incr ? funk->ckpt_seq : 0UL;
+    hdr->rec_cnt    = w->rec_cnt;
+    hdr->chunk_cnt  = w->chunk_cnt;
+    hdr->file_sz    = w->file_sz;
+    hdr->num_part   = fd_funk_get_partvec( funk, wksp )->num_part;
+    hdr->txn_max    = (uint)funk->txn_max;
+    hdr->rec_max    = funk->rec_max;
+    hdr->seed       = funk->seed;
+    hdr->wksp_sz    = fd_wksp_footprint( wksp->part_max, wksp->data_max );
+    fd_funk_txn_xid_copy( hdr->last_publish, funk->last_publish );
+
+    if( FD_UNLIKELY( pwrite( fd, hdr, sizeof(fd_funk_ckpt_hdr_t), 0 )!=(ssize_t)sizeof(fd_funk_ckpt_hdr_t) ) ) {
+      FD_LOG_WARNING(( "pwrite(%s) failed (%i-%s)", tmp_path, errno, fd_io_strerror( errno ) ));
+      err = FD_FUNK_ERR_SYS;
+    } else if( FD_UNLIKELY( fsync( fd ) ) ) {
+      FD_LOG_WARNING(( "fsync(%s) failed (%i-%s)", tmp_path, errno, fd_io_strerror( errno ) ));
+      err = FD_FUNK_ERR_SYS;
+    }
+  }
+
+  if( FD_UNLIKELY( close( fd ) ) ) {
+    FD_LOG_WARNING(( "close(%s) failed (%i-%s)", tmp_path, errno, fd_io_strerror( errno ) ));
+    err = FD_FUNK_ERR_SYS;
+  }
+
+  if( FD_LIKELY( !err ) && FD_UNLIKELY( rename( tmp_path, path ) ) ) {
+    FD_LOG_WARNING(( "rename(%s,%s) failed (%i-%s)", tmp_path, path, errno, fd_io_strerror( errno ) ));
+    err = FD_FUNK_ERR_SYS;
+  }
+
+  if( FD_UNLIKELY( err ) ) {
+    unlink( tmp_path );
+    return err;
+  }
+
+  /* The checkpoint is durable, start tracking the next increment */
+
+  for( ulong rec_idx = funk->rec_head_idx; !fd_funk_rec_idx_is_null( rec_idx ); rec_idx = rec_map[ rec_idx ].next_idx )
+    rec_map[ rec_idx ].flags &= ~FD_FUNK_REC_FLAG_DIRTY;
+  funk->ckpt_seq = hdr->seq;
+
+  fd_ulong_store_if( !!opt_rec_cnt, opt_rec_cnt, w->rec_cnt );
+  return FD_FUNK_SUCCESS;
+}
+
+/* Restoring **********************************************************/
+
+/* fd_funk_ckpt_file_t is a checkpoint file mapped for restore */
+
+struct fd_funk_ckpt_file {
+  int                        fd;
+  uchar const *              map;
+  ulong                      map_sz;
+  fd_funk_ckpt_hdr_t const * hdr;
+};
+
+typedef struct fd_funk_ckpt_file fd_funk_ckpt_file_t;
+
+static int
+fd_funk_ckpt_file_open( fd_funk_ckpt_file_t * file,
+                        char const *          path ) {
+  file->fd  = -1;
+  file->map = NULL;
+
+  int fd = open( path, O_RDONLY );
+  if( FD_UNLIKELY( fd<0 ) ) {
+    FD_LOG_WARNING(( "open(%s) failed (%i-%s)", path, errno, fd_io_strerror( errno ) ));
+    return FD_FUNK_ERR_SYS;
+  }
+
+  struct stat st;
+  if( FD_UNLIKELY( fstat( fd, &st ) ) ) {
+    FD_LOG_WARNING(( "fstat(%s) failed (%i-%s)", path, errno, fd_io_strerror( errno ) ));
+    close( fd );
+    return FD_FUNK_ERR_SYS;
+  }
+
+  ulong map_sz = (ulong)st.st_size;
+  if( FD_UNLIKELY( map_sz<sizeof(fd_funk_ckpt_hdr_t) ) ) {
+    FD_LOG_WARNING(( "%s is not a funk checkpoint (too small)", path ));
+    close( fd );
+    return FD_FUNK_ERR_INVAL;
+  }
+
+  void * map = mmap( NULL, map_sz, PROT_READ, MAP_PRIVATE, fd, 0 );
+  if( FD_UNLIKELY( map==MAP_FAILED ) ) {
+    FD_LOG_WARNING(( "mmap(%s) failed (%i-%s)", path, errno, fd_io_strerror( errno ) ));
+    close( fd );
+    return FD_FUNK_ERR_SYS;
+  }
+  madvise( map, map_sz, MADV_SEQUENTIAL );
+
+  fd_funk_ckpt_hdr_t const * hdr = (fd_funk_ckpt_hdr_t const *)map;
+  if( FD_UNLIKELY( hdr->magic!=FD_FUNK_CKPT_MAGIC || !hdr->seq || hdr->file_sz!=map_sz ) ) {
+    FD_LOG_WARNING(( "%s is not a funk checkpoint (bad magic, seq or size)", path ));
+    munmap( map, map_sz );
+    close( fd );
+    return FD_FUNK_ERR_INVAL;
+  }
+
+  file->fd     = fd;
+  file->map    = (uchar const *)map;
+  file->map_sz = map_sz;
+  file->hdr    = hdr;
+  return FD_FUNK_SUCCESS;
+}
+
+static void
+fd_funk_ckpt_file_close( fd_funk_ckpt_file_t * file ) {
+  if( file->map ) munmap( (void *)file->map, file->map_sz );
+  if( file->fd>=0 ) close( file->fd );
+  file->map = NULL;
+  file->fd  = -1;
+}
+
+/* fd_funk_ckpt_restore_args_t is shared by the restore workers */
+
+struct fd_funk_ckpt_restore_args {
+  fd_funk_t *         funk;
+  uchar const *       map;
+  ulong const *       chunk_off;   /* Indexed [0,chunk_cnt), file offset of chunk */
+  uchar *             chunk_fixup; /* Indexed [0,chunk_cnt), non-zero if the chunk needs a serial partition / tombstone pass */
+  int volatile        err;
+};
+
+typedef struct fd_funk_ckpt_restore_args fd_funk_ckpt_restore_args_t;
+
+/* fd_funk_ckpt_restore_chunk restores the values of the records in
+   chunk l0.  Tombstones get their value flushed and partition changes
+   are deferred to the serial pass (both touch shared lists). */
+
+static void
+fd_funk_ckpt_restore_chunk( void * tpool,
+                            ulong  t0,     ulong t1,
+                            void * _args,
+                            void * reduce, ulong stride,
+                            ulong  l0,     ulong l1,
+                            ulong  m0,     ulong m1,
+                            ulong  n0,     ulong n1 ) {
+  (void)tpool; (void)t0; (void)t1; (void)reduce; (void)stride; (void)l0; (void)l1; (void)m1; (void)n0; (void)n1;
+
+  fd_funk_ckpt_restore_args_t * args = (fd_funk_ckpt_restore_args_t *)_args;
+  fd_funk_t *  funk  = args->funk;
+  fd_wksp_t *  wksp  = fd_funk_wksp( funk );
+  fd_alloc_t * alloc = fd_funk_alloc( funk, wksp );
+
+  fd_funk_ckpt_chunk_t const * chunk = (fd_funk_ckpt_chunk_t const *)( args->map + args->chunk_off[ m0 ] );
+  uchar const *                cur   = (uchar const *)( chunk+1 );
+  int                          fixup = 0;
+
+  for( ulong i=0UL; i<chunk->rec_cnt; i++ ) {
+    if( FD_UNLIKELY( args->err ) ) return;
+
+    fd_funk_ckpt_rec_t const * crec   = (fd_funk_ckpt_rec_t const *)cur;
+    ulong                      val_sz = (ulong)crec->val_sz;
+    int                        erase  = !!(crec->flags & FD_FUNK_REC_FLAG_ERASE);
+
+    int err;
+    fd_funk_rec_t * rec = fd_funk_rec_write_prepare_concur( funk, NULL, crec->key, val_sz, 1, NULL, &err );
+    if( FD_LIKELY( rec && fd_funk_val_sz( rec )!=val_sz ) ) rec = fd_funk_val_truncate( rec, val_sz, alloc, wksp, &err );
+    if( FD_UNLIKELY( !rec ) ) {
+      FD_LOG_WARNING(( "unable to restore record (%i-%s)", err, fd_funk_strerror( err ) ));
+      args->err = err;
+      return;
+    }
+
+    if( erase ) {
+      fd_funk_val_flush( rec, alloc, wksp );
+      fixup = 1;
+    } else {
+      if( val_sz ) fd_memcpy( fd_funk_val( rec, wksp ), crec+1, val_sz );
+      if( FD_UNLIKELY( rec->part!=crec->part ) ) fixup = 1;
+      else rec->flags = crec->flags;
+    }
+
+    cur += fd_funk_ckpt_rec_footprint( val_sz );
+  }
+
+  args->chunk_fixup[ m0 ] = (uchar)fixup;
+}
+
+/* fd_funk_ckpt_restore_fixup applies the partition assignments and
+   tombstones of chunk l serially. */
+
+static int
+fd_funk_ckpt_restore_fixup( fd_funk_t *                  funk,
+                            fd_funk_ckpt_chunk_t const * chunk ) {
+  fd_wksp_t *         wksp    = fd_funk_wksp( funk );
+  fd_funk_rec_t *     rec_map = fd_funk_rec_map( funk, wksp );
+  fd_funk_partvec_t * partvec = fd_funk_get_partvec( funk, wksp );
+
+  uchar const * cur = (uchar const *)( chunk+1 );
+  for( ulong i=0UL; i<chunk->rec_cnt; i++ ) {
+    fd_funk_ckpt_rec_t const * crec = (fd_funk_ckpt_rec_t const *)cur;
+    cur += fd_funk_ckpt_rec_footprint( (ulong)crec->val_sz );
+
+    fd_funk_xid_key_pair_t pair[1]; fd_funk_xid_key_pair_init( pair, fd_funk_root( funk ), crec->key );
+    fd_funk_rec_t * rec = fd_funk_rec_map_query( rec_map, pair, NULL );
+    if( FD_UNLIKELY( !rec ) ) FD_LOG_CRIT(( "restored record vanished" ));
+
+    if( (crec->flags & FD_FUNK_REC_FLAG_ERASE) ) {
+      fd_funk_part_set_intern( partvec, rec_map, rec, FD_FUNK_PART_NULL );
+    } else if( rec->part!=crec->part ) {
+      int err = fd_funk_part_set_intern( partvec, rec_map, rec, crec->part );
+      if( FD_UNLIKELY( err ) ) {
+        FD_LOG_WARNING(( "unable to restore record partition %u (%i-%s)", crec->part, err, fd_funk_strerror( err ) ));
+        return err;
+      }
+    }
+    rec->flags = crec->flags;
+  }
+  return FD_FUNK_SUCCESS;
+}
+
+static uint
+fd_funk_ckpt_part_null( fd_funk_rec_t * rec,
+                        uint            num_part,
+                        void *          cb_arg ) {
+  (void)rec; (void)num_part; (void)cb_arg;
+  return FD_FUNK_PART_NULL;
+}
+
+/* fd_funk_ckpt_restore_file restores a single validated checkpoint */
+
+static int
+fd_funk_ckpt_restore_file( fd_funk_t *                 funk,
+                           fd_funk_ckpt_file_t const * file,
+                           char const *                path,
+                           fd_tpool_t *                tpool,
+                           ulong                       t0,
+                           ulong                       t1 ) {
+  fd_wksp_t *                wksp  = fd_funk_wksp( funk );
+  fd_alloc_t *               alloc = fd_funk_alloc( funk, wksp );
+  fd_funk_ckpt_hdr_t const * hdr   = file->hdr;
+  ulong                      chunk_cnt = hdr->chunk_cnt;
+
+  /* Index and bounds check the chunks */
+
+  if( FD_UNLIKELY( chunk_cnt>file->map_sz/sizeof(fd_funk_ckpt_chunk_t) ) ) {
+    FD_LOG_WARNING(( "%s is corrupt (bad chunk_cnt)", path ));
+    return FD_FUNK_ERR_INVAL;
+  }
+
+  ulong * chunk_off   = (ulong *)fd_alloc_malloc( alloc, alignof(ulong), fd_ulong_max( chunk_cnt, 1UL )*(sizeof(ulong)+1UL) );
+  if( FD_UNLIKELY( !chunk_off ) ) {
+    FD_LOG_WARNING(( "unable to allocate chunk index (wksp full)" ));
+    return FD_FUNK_ERR_MEM;
+  }
+  uchar * chunk_fixup = (uchar *)( chunk_off + chunk_cnt );
+
+  int   err     = FD_FUNK_SUCCESS;
+  ulong off     = sizeof(fd_funk_ckpt_hdr_t);
+  ulong rec_cnt = 0UL;
+  for( ulong l=0UL; l<chunk_cnt; l++ ) {
+    fd_funk_ckpt_chunk_t const * chunk = (fd_funk_ckpt_chunk_t const *)( file->map + off );
+    if( FD_UNLIKELY( off+sizeof(fd_funk_ckpt_chunk_t)>file->map_sz ||
+                     chunk->sz>file->map_sz-off-sizeof(fd_funk_ckpt_chunk_t) ) ) { err = FD_FUNK_ERR_INVAL; break; }
+
+    /* Validate the records of the chunk such that the workers can trust
+       them */
+
+    uchar const * cur = (uchar const *)( chunk+1 );
+    uchar const * end = cur + chunk->sz;
+    for( ulong i=0UL; i<chunk->rec_cnt; i++ ) {
+      if( FD_UNLIKELY( (ulong)(end-cur)<sizeof(fd_funk_ckpt_rec_t) ) ) { err = FD_FUNK_ERR_INVAL; break; }
+      fd_funk_ckpt_rec_t const * crec   = (fd_funk_ckpt_rec_t const *)cur;
+      ulong                      rec_sz = fd_funk_ckpt_rec_footprint( (ulong)crec->val_sz );
+      if( FD_UNLIKELY( (ulong)(end-cur)<rec_sz || ((crec->flags & FD_FUNK_REC_FLAG_ERASE) && crec->val_sz) ) ) { err = FD_FUNK_ERR_INVAL; break; }
+      cur += rec_sz;
+    }
+    if( FD_UNLIKELY( err || cur!=end || !chunk->rec_cnt ) ) { err = FD_FUNK_ERR_INVAL; break; }
+
+    chunk_off  [ l ] = off;
+    chunk_fixup[ l ] = (uchar)0;
+    rec_cnt += chunk->rec_cnt;
+    off     += sizeof(fd_funk_ckpt_chunk_t) + chunk->sz;
+  }
+  if( FD_UNLIKELY( !err && (off!=file->map_sz || rec_cnt!=hdr->rec_cnt) ) ) err = FD_FUNK_ERR_INVAL;
+  if( FD_UNLIKELY( err ) ) {
+    FD_LOG_WARNING(( "%s is corrupt (bad chunk at offset %lu)", path, off ));
+    fd_alloc_free( alloc, chunk_off );
+    return err;
+  }
+
+  /* Match the partitioning of the checkpointed funk.  A repartition
+     marks every record dirty so the checkpoint holds the partition of
+     every record. */
+
+  if( fd_funk_get_partvec( funk, wksp )->num_part!=hdr->num_part )
+    fd_funk_repartition( funk, hdr->num_part, fd_funk_ckpt_part_null, NULL );
+
+  /* Restore the values thread parallel */
+
+  fd_funk_ckpt_restore_args_t args[1] = {{
+    .funk        = funk,
+    .map         = file->map,
+    .chunk_off   = chunk_off,
+    .chunk_fixup = chunk_fixup,
+    .err         = FD_FUNK_SUCCESS
+  }};
+
+# if FD_HAS_ATOMIC
+  if( tpool && t1-t0>1UL ) {
+    fd_tpool_exec_all_taskq( tpool, t0, t1, fd_funk_ckpt_restore_chunk, tpool, args, NULL, 0UL, 0UL, chunk_cnt );
+  } else
+# endif
+  {
+    for( ulong l=0UL; l<chunk_cnt; l++ )
+      fd_funk_ckpt_restore_chunk( tpool, t0, t1, args, NULL, 0UL, 0UL, chunk_cnt, l, l+1UL, t0, t0+1UL );
+  }
+  err = args->err;
+
+  /* Apply partitions and tombstones serially */
+
+  for( ulong l=0UL; !err && l<chunk_cnt; l++ )
+    if( chunk_fixup[ l ] ) err = fd_funk_ckpt_restore_fixup( funk, (fd_funk_ckpt_chunk_t const *)( file->map + chunk_off[ l ] ) );
+
+  fd_alloc_free( alloc, chunk_off );
+  return err;
+}
+
+int
+fd_funk_ckpt_restore( fd_funk_t *          funk,
+                      char const * const * path,
+                      ulong                path_cnt,
+                      fd_tpool_t *         tpool,
+                      ulong                t0,
+                      ulong                t1 ) {
+
+  if( FD_UNLIKELY( (!funk) | (!path) | (!path_cnt) ) ) {
+    FD_LOG_WARNING(( "NULL funk, NULL path or no checkpoints" ));
+    return FD_FUNK_ERR_INVAL;
+  }
+  fd_funk_check_write( funk );
+
+  if( FD_UNLIKELY( fd_funk_last_publish_is_frozen( funk ) ) ) {
+    FD_LOG_WARNING(( "funk has in-preparation transactions" ));
+    return FD_FUNK_ERR_FROZEN;
+  }
+
+  /* Validate the chain before touching funk */
+
+  ulong seq = funk->ckpt_seq;
+  for( ulong i=0UL; i<path_cnt; i++ ) {
+    fd_funk_ckpt_file_t file[1];
+    int err = fd_funk_ckpt_file_open( file, path[i] );
+    if( FD_UNLIKELY( err ) ) return err;
+
+    ulong parent_seq = file->hdr->parent_seq;
+    ulong file_seq   = file->hdr->seq;
+    fd_funk_ckpt_file_close( file );
+
+    int ok = parent_seq ? (parent_seq==seq) : (!i && fd_funk_rec_idx_is_null( funk->rec_head_idx ));
+    if( FD_UNLIKELY( !ok || file_seq<=parent_seq ) ) {
+      FD_LOG_WARNING(( "%s (seq %lu, parent %lu) does not continue the checkpoint chain at seq %lu%s",
+                       path[i], file_seq, parent_seq, seq, parent_seq ? "" : " (full checkpoints need an empty funk)" ));
+      return FD_FUNK_ERR_INVAL;
+    }
+    seq = file_seq;
+  }
+
+  /* Restore */
+
+  for( ulong i=0UL; i<path_cnt; i++ ) {
+    fd_funk_ckpt_file_t file[1];
+    int err = fd_funk_ckpt_file_open( file, path[i] );
+    if( FD_LIKELY( !err ) ) {
+      long dt = -fd_log_wallclock();
+      err = fd_funk_ckpt_restore_file( funk, file, path[i], tpool, t0, t1 );
+      dt += fd_log_wallclock();
+      if( FD_LIKELY( !err ) ) {
+        FD_LOG_NOTICE(( "restored funk checkpoint %s (seq %lu, %lu records, %lu bytes) in %.3f s",
+                        path[i], file->hdr->seq, file->hdr->rec_cnt, file->hdr->file_sz, 1e-9*(double)dt ));
+        funk->ckpt_seq = file->hdr->seq;
+        fd_funk_txn_xid_copy( funk->last_publish, file->hdr->last_publish );
+      }
+      fd_funk_ckpt_file_close( file );
+    }
+    if( FD_UNLIKELY( err ) ) return err;
+  }
+
+  /* Funk now matches the last checkpoint */
+
+  fd_wksp_t *     wksp    = fd_funk_wksp( funk );
+  fd_funk_rec_t * rec_map = fd_funk_rec_map( funk, wksp );
+  for( ulong rec_idx = funk->rec_head_idx; !fd_funk_rec_idx_is_null( rec_idx ); rec_idx = rec_map[ rec_idx ].next_idx )
+    rec_map[ rec_idx ].flags &= ~FD_FUNK_REC_FLAG_DIRTY;
+
+  return FD_FUNK_SUCCESS;
+}
+
+char *
+fd_funk_ckpt_chain_path( char *       buf,
+                         ulong        buf_sz,
+                         char const * path,
+                         ulong        seq ) {
+  if( seq<=1UL ) return fd_cstr_printf_check( buf, buf_sz, NULL, "%s",     path      ) ? buf : NULL;
+  else           return fd_cstr_printf_check( buf, buf_sz, NULL, "%s.%lu", path, seq ) ? buf : NULL;
+}
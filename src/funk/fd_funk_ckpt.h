@@ -0,0 +1,152 @@
+#ifndef HEADER_fd_src_funk_fd_funk_ckpt_h
+#define HEADER_fd_src_funk_fd_funk_ckpt_h
+
+/* fd_funk_ckpt provides record level funk checkpoints.
+
+   A workspace checkpoint (fd_wksp_checkpt) of a funk rewrites the
+   entire workspace every time.  A funk checkpoint instead only holds
+   published records.  A full checkpoint holds all of them and an
+   incremental checkpoint only holds the published records that changed
+   since the previous checkpoint (tracked with FD_FUNK_REC_FLAG_DIRTY,
+   which is set when transactions are published and when published
+   records are modified directly).  Erased records are written as
+   tombstones so deletions are replayed too.  A funk is recovered by
+   restoring a full checkpoint followed by the chain of incremental
+   checkpoints written after it.
+
+   Checkpoints are numbered.  Each checkpoint records its own sequence
+   number and the sequence number of the checkpoint it applies on top of
+   (0 for a full checkpoint) so restoring a broken chain is detected.
+
+   The file format is native endian:
+
+     fd_funk_ckpt_hdr_t
+     chunk_cnt times:
+       fd_funk_ckpt_chunk_t
+       chunk->rec_cnt times:
+         fd_funk_ckpt_rec_t
+         val_sz bytes of value, zero padded to FD_FUNK_CKPT_ALIGN
+
+   Records are grouped in chunks of roughly FD_FUNK_CKPT_CHUNK_MAX bytes
+   so they can be restored thread parallel.  A key appears at most once
+   per checkpoint.
+
+   A chain is stored as the full checkpoint at some path followed by
+   the incremental checkpoint with sequence number seq at path.<seq>
+   (see fd_funk_ckpt_chain_path).  fd_funk_recover_checkpoint
+   (fd_funk_filemap.h) recovers a funk from such a chain.
+
+   Limitations: the xid history of published transactions is not
+   preserved (only last_publish) and tombstones removed with
+   fd_funk_rec_forget are not removed by an incremental restore. */
+
+#include "fd_funk.h"
+
+#define FD_FUNK_CKPT_MAGIC     (0xf17eda2ce7c4e770UL) /* firedancer funk ckpt version 0 */
+#define FD_FUNK_CKPT_ALIGN     (8UL)                  /* Alignment of everything in a checkpoint file */
+#define FD_FUNK_CKPT_CHUNK_MAX (1UL<<20)              /* Target chunk payload size (larger values get their own chunk) */
+
+struct fd_funk_ckpt_hdr {
+  ulong             magic;           /* ==FD_FUNK_CKPT_MAGIC */
+  ulong             seq;             /* Sequence number of this checkpoint, positive */
+  ulong             parent_seq;      /* 0 for a full checkpoint, sequence number of the checkpoint this applies on top of otherwise */
+  ulong             rec_cnt;         /* Number of records in the checkpoint */
+  ulong             chunk_cnt;       /* Number of chunks in the checkpoint */
+  ulong             file_sz;         /* Byte size of the checkpoint file */
+  uint              num_part;        /* Number of funk record partitions */
+  uint              txn_max;         /* Geometry of the checkpointed funk (used to recover a funk of the same size) */
+  ulong             rec_max;
+  ulong             seed;
+  ulong             wksp_sz;         /* Byte footprint of the workspace holding the checkpointed funk */
+  fd_funk_txn_xid_t last_publish[1]; /* Last published transaction of funk when checkpointed */
+};
+
+typedef struct fd_funk_ckpt_hdr fd_funk_ckpt_hdr_t;
+
+struct fd_funk_ckpt_chunk {
+  ulong rec_cnt; /* Number of records in the chunk, positive */
+  ulong sz;      /* Byte size of the records in the chunk (excluding this header), multiple of FD_FUNK_CKPT_ALIGN */
+};
+
+typedef struct fd_funk_ckpt_chunk fd_funk_ckpt_chunk_t;
+
+struct fd_funk_ckpt_rec {
+  fd_funk_rec_key_t key[1];
+  ulong             flags;  /* FD_FUNK_REC_FLAG_ERASE and erase data only */
+  uint              part;   /* Record partition, FD_FUNK_PART_NULL if none */
+  uint              val_sz; /* Value byte size, 0 if erased */
+};
+
+typedef struct fd_funk_ckpt_rec fd_funk_ckpt_rec_t;
+
+FD_PROTOTYPES_BEGIN
+
+/* fd_funk_ckpt_write writes a checkpoint of the published records of
+   funk to path (replacing any existing file atomically).  If incr is
+   zero, this is a full checkpoint.  Otherwise, this is an incremental
+   checkpoint holding only the records that changed since the last
+   checkpoint written or restored by funk (this fails with
+   FD_FUNK_ERR_INVAL if there was none).  On success, the checkpoint
+   gets sequence number fd_funk_ckpt_seq( funk )+1 (1 for a full
+   checkpoint, which starts a new chain), funk's dirty record
+   tracking is reset, *opt_rec_cnt holds the number of records written
+   and returns FD_FUNK_SUCCESS.  On failure, returns a FD_FUNK_ERR_*
+   (logs details) and funk is unchanged.  Values evicted to a cold tier
+   are read from the tier.
+
+   Assumes the caller is in a fd_funk_start_write / fd_funk_end_write
+   block. */
+
+int
+fd_funk_ckpt_write( fd_funk_t *  funk,
+                    char const * path,
+                    int          incr,
+                    ulong *      opt_rec_cnt );
+
+/* fd_funk_ckpt_restore restores the checkpoint chain path[0..path_cnt)
+   into funk.  path[0] is either a full checkpoint, in which case funk
+   should not have any records, or an incremental checkpoint on top of
+   checkpoint fd_funk_ckpt_seq( funk ).  Each subsequent path should be
+   the incremental checkpoint on top of the previous one.  funk should
+   be childless.  The chain is validated before anything is restored.
+
+   Each checkpoint is restored thread parallel using the caller and
+   tpool worker threads (t0,t1) (tpool can be NULL and/or t1-t0 1 to
+   restore single threaded).  Returns FD_FUNK_SUCCESS on success and a
+   FD_FUNK_ERR_* on failure (logs details, e.g. FD_FUNK_ERR_REC if funk
+   is too small).  On success, funk holds the published records and
+   last published transaction of the last checkpoint in the chain and
+   fd_funk_ckpt_seq( funk ) is its sequence number (such that new
+   incremental checkpoints can continue the chain).  On failure after
+   validation, funk should be considered corrupt.
+
+   Assumes the caller is in a fd_funk_start_write / fd_funk_end_write
+   block. */
+
+int
+fd_funk_ckpt_restore( fd_funk_t *          funk,
+                      char const * const * path,
+                      ulong                path_cnt,
+                      fd_tpool_t *         tpool,
+                      ulong                t0,
+                      ulong                t1 );
+
+/* fd_funk_ckpt_chain_path formats into buf the path of checkpoint seq
+   in the chain whose full checkpoint is at path (path for seq 1 and
+   path.<seq> for the following ones).  Returns buf on success and NULL
+   if the result does not fit in buf_sz bytes. */
+
+char *
+fd_funk_ckpt_chain_path( char *       buf,
+                         ulong        buf_sz,
+                         char const * path,
+                         ulong        seq );
+
+/* fd_funk_ckpt_seq returns the sequence number of the last checkpoint
+   written or restored by funk, 0 if none. */
+
+FD_FN_PURE static inline ulong fd_funk_ckpt_seq( fd_funk_t const * funk ) { return funk->ckpt_seq; }
+
+FD_PROTOTYPES_END
+
+#endif /* HEADER_fd_src_funk_fd_funk_ckpt_h */
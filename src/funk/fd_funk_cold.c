@@ -0,0 +1,487 @@
+#define _GNU_SOURCE
+#define _FILE_OFFSET_BITS 64
+#include "fd_funk_cold.h"
+#include <stdio.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/* fd_funk_cold_private_join are the joins of this process to the cold
+   tiers of funk instances.  fd_funk_cold_private_lock protects them. */
+
+static fd_funk_cold_t fd_funk_cold_private_join[ FD_FUNK_COLD_JOIN_MAX ];
+static volatile ulong fd_funk_cold_private_lock;
+
+/* fd_funk_cold_hdr_t is the header at the start of the log file */
+
+struct fd_funk_cold_hdr {
+  ulong magic;   /* ==FD_FUNK_COLD_MAGIC */
+  ulong used_sz; /* Append cursor */
+};
+
+typedef struct fd_funk_cold_hdr fd_funk_cold_hdr_t;
+
+/* fd_funk_cold_map_file maps the log file open at fd, growing it to
+   at least max_sz bytes first.  Returns the mapping on success (*_sz
+   holds its size) and NULL on failure (logs details). */
+
+static uchar *
+fd_funk_cold_map_file( int          fd,
+                       char const * path,
+                       ulong        max_sz,
+                       ulong *      _sz ) {
+  struct stat st;
+  if( FD_UNLIKELY( fstat( fd, &st ) ) ) {
+    FD_LOG_WARNING(( "fstat(%s) failed (%i-%s)", path, errno, fd_io_strerror( errno ) ));
+    return NULL;
+  }
+
+  ulong sz = fd_ulong_align_up( fd_ulong_max( fd_ulong_max( max_sz, (ulong)st.st_size ), 2UL*FD_FUNK_COLD_HDR_SZ ), FD_FUNK_COLD_HDR_SZ );
+  if( (ulong)st.st_size<sz && FD_UNLIKELY( ftruncate( fd, (off_t)sz ) ) ) {
+    FD_LOG_WARNING(( "ftruncate(%s,%lu) failed (%i-%s)", path, sz, errno, fd_io_strerror( errno ) ));
+    return NULL;
+  }
+
+  void * map = mmap( NULL, sz, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0 );
+  if( FD_UNLIKELY( map==MAP_FAILED ) ) {
+    FD_LOG_WARNING(( "mmap(%s,%lu) failed (%i-%s)", path, sz, errno, fd_io_strerror( errno ) ));
+    return NULL;
+  }
+
+  *_sz = sz;
+  return (uchar *)map;
+}
+
+/* fd_funk_cold_next_gen returns a log generation that differs from gen
+   and, with overwhelming probability, from the generation of any log
+   previously attached to a funk at the same wksp address. */
+
+static ulong
+fd_funk_cold_next_gen( ulong gen ) {
+  return fd_ulong_max( (ulong)fd_log_wallclock(), gen+1UL );
+}
+
+/* fd_funk_cold_unmap unmaps the log of the local join cold and marks
+   the join as unused. */
+
+static void
+fd_funk_cold_unmap( fd_funk_cold_t * cold ) {
+  if( FD_UNLIKELY( munmap( cold->map, cold->map_sz ) ) )
+    FD_LOG_WARNING(( "munmap of cold log failed (%i-%s)", errno, fd_io_strerror( errno ) ));
+  if( FD_UNLIKELY( close( cold->fd ) ) )
+    FD_LOG_WARNING(( "close of cold log failed (%i-%s)", errno, fd_io_strerror( errno ) ));
+  memset( cold, 0, sizeof(fd_funk_cold_t) );
+  cold->fd = -1;
+}
+
+int
+fd_funk_cold_open( fd_funk_t *  funk,
+                   char const * path,
+                   ulong        max_sz ) {
+
+  if( FD_UNLIKELY( (!funk) | (!path) ) ) {
+    FD_LOG_WARNING(( "NULL funk or path" ));
+    return FD_FUNK_ERR_INVAL;
+  }
+
+  fd_funk_check_write( funk );
+
+  if( FD_UNLIKELY( strlen( path )>=PATH_MAX ) ) {
+    FD_LOG_WARNING(( "path too long" ));
+    return FD_FUNK_ERR_INVAL;
+  }
+
+  if( FD_UNLIKELY( funk->cold_gaddr ) ) {
+    FD_LOG_WARNING(( "funk already has a cold tier (%s)", fd_funk_cold_shmem( funk )->path ));
+    return FD_FUNK_ERR_INVAL;
+  }
+
+  int fd = open( path, O_CREAT|O_RDWR, S_IRUSR|S_IWUSR );
+  if( FD_UNLIKELY( fd<0 ) ) {
+    FD_LOG_WARNING(( "open(%s) failed (%i-%s)", path, errno, fd_io_strerror( errno ) ));
+    return FD_FUNK_ERR_SYS;
+  }
+
+  ulong   map_sz;
+  uchar * map = fd_funk_cold_map_file( fd, path, max_sz, &map_sz );
+  if( FD_UNLIKELY( !map ) ) {
+    close( fd );
+    return FD_FUNK_ERR_SYS;
+  }
+
+  fd_funk_cold_hdr_t * hdr = (fd_funk_cold_hdr_t *)map;
+  if( !hdr->magic ) { /* New log */
+    hdr->used_sz = FD_FUNK_COLD_HDR_SZ;
+    FD_COMPILER_MFENCE();
+    hdr->magic   = FD_FUNK_COLD_MAGIC;
+  } else if( FD_UNLIKELY( hdr->magic!=FD_FUNK_COLD_MAGIC || hdr->used_sz<FD_FUNK_COLD_HDR_SZ || hdr->used_sz>map_sz ) ) {
+    FD_LOG_WARNING(( "%s is not a funk cold log", path ));
+    munmap( map, map_sz );
+    close( fd );
+    return FD_FUNK_ERR_SYS;
+  }
+  ulong used_sz = hdr->used_sz;
+
+  munmap( map, map_sz );
+  close( fd );
+
+  fd_wksp_t *            wksp  = fd_funk_wksp( funk );
+  fd_funk_cold_shmem_t * shmem = (fd_funk_cold_shmem_t *)
+    fd_wksp_alloc_laddr( wksp, FD_FUNK_COLD_SHMEM_ALIGN, sizeof(fd_funk_cold_shmem_t), funk->wksp_tag );
+  if( FD_UNLIKELY( !shmem ) ) {
+    FD_LOG_WARNING(( "cold tier state too large for workspace" ));
+    return FD_FUNK_ERR_MEM;
+  }
+
+  memset( shmem, 0, sizeof(fd_funk_cold_shmem_t) );
+  strcpy( shmem->path, path );
+  shmem->gen     = fd_funk_cold_next_gen( 0UL );
+  shmem->map_sz  = map_sz;
+  shmem->used_sz = used_sz;
+
+  FD_COMPILER_MFENCE();
+  funk->cold_gaddr = fd_wksp_gaddr_fast( wksp, shmem );
+  FD_COMPILER_MFENCE();
+
+  if( FD_UNLIKELY( !fd_funk_cold_join( funk ) ) ) {
+    funk->cold_gaddr = 0UL;
+    FD_COMPILER_MFENCE();
+    fd_wksp_free_laddr( shmem );
+    return FD_FUNK_ERR_INVAL;
+  }
+
+  return FD_FUNK_SUCCESS;
+}
+
+int
+fd_funk_cold_close( fd_funk_t * funk ) {
+  fd_funk_check_write( funk );
+
+  fd_funk_cold_shmem_t * shmem = fd_funk_cold_shmem( funk );
+  if( FD_UNLIKELY( !shmem ) ) {
+    FD_LOG_WARNING(( "funk has no cold tier" ));
+    return FD_FUNK_ERR_INVAL;
+  }
+
+  FD_COMPILER_MFENCE();
+  funk->cold_gaddr = 0UL;
+  FD_COMPILER_MFENCE();
+
+  fd_funk_cold_join( funk ); /* Drops the now stale join of this process */
+  fd_wksp_free_laddr( shmem );
+
+  return FD_FUNK_SUCCESS;
+}
+
+fd_funk_cold_t *
+fd_funk_cold_join( fd_funk_t * funk ) {
+  fd_funk_cold_shmem_t * shmem = fd_funk_cold_shmem( funk );
+
+  fd_funk_rec_lock_acquire( &fd_funk_cold_private_lock );
+
+  fd_funk_cold_t * join      = NULL;
+  fd_funk_cold_t * free_join = NULL;
+  for( ulong join_idx=0UL; join_idx<FD_FUNK_COLD_JOIN_MAX; join_idx++ ) {
+    fd_funk_cold_t * j = fd_funk_cold_private_join + join_idx;
+    if(      j->funk==funk           ) join      = j;
+    else if( !j->funk && !free_join ) free_join = j;
+  }
+
+  if( join && ( join->shmem!=shmem || join->gen!=shmem->gen ) ) { /* Tier closed or log replaced */
+    fd_funk_cold_unmap( join );
+    if( !free_join ) free_join = join;
+    join = NULL;
+  }
+
+  if( !join && shmem ) {
+    if( FD_UNLIKELY( !free_join ) ) {
+      FD_LOG_WARNING(( "too many cold tiers joined (increase FD_FUNK_COLD_JOIN_MAX)" ));
+    } else {
+      int fd = open( shmem->path, O_RDWR );
+      if( FD_UNLIKELY( fd<0 ) ) {
+        FD_LOG_WARNING(( "open(%s) failed (%i-%s)", shmem->path, errno, fd_io_strerror( errno ) ));
+      } else {
+        void * map = mmap( NULL, shmem->map_sz, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0 );
+        if( FD_UNLIKELY( map==MAP_FAILED ) ) {
+          FD_LOG_WARNING(( "mmap(%s,%lu) failed (%i-%s)", shmem->path, shmem->map_sz, errno, fd_io_strerror( errno ) ));
+          close( fd );
+        } else {
+          free_join->funk   = funk;
+          free_join->shmem  = shmem;
+          free_join->gen    = shmem->gen;
+          free_join->fd     = fd;
+          free_join->map    = (uchar *)map;
+          free_join->map_sz = shmem->map_sz;
+          join = free_join;
+        }
+      }
+    }
+  }
+
+  fd_funk_rec_lock_release( &fd_funk_cold_private_lock );
+
+  return join;
+}
+
+ulong
+fd_funk_cold_evict( fd_funk_t * funk,
+                    ulong       min_age ) {
+  fd_funk_check_write( funk );
+
+  fd_funk_cold_t * cold = fd_funk_cold_join( funk );
+  if( FD_UNLIKELY( !cold ) ) return 0UL;
+  fd_funk_cold_shmem_t * shmem = cold->shmem;
+
+  fd_wksp_t *     wksp    = fd_funk_wksp( funk );
+  fd_funk_rec_t * rec_map = fd_funk_rec_map( funk, wksp );
+  fd_alloc_t *    alloc   = fd_funk_alloc( funk, wksp );
+  ulong           rec_max = funk->rec_max;
+  uint            now     = (uint)funk->cold_clock;
+
+  if( FD_UNLIKELY( min_age>(ulong)UINT_MAX ) ) return 0UL; /* Nothing can be that old given 32-bit stamps */
+
+  ulong used_sz   = shmem->used_sz;
+  ulong evict_cnt = 0UL;
+  ulong evict_sz  = 0UL;
+
+  for( ulong rec_idx = funk->rec_head_idx; !fd_funk_rec_idx_is_null( rec_idx ); rec_idx = rec_map[ rec_idx ].next_idx ) {
+    if( FD_UNLIKELY( rec_idx>=rec_max ) ) FD_LOG_CRIT(( "memory corruption detected (bad idx)" ));
+    fd_funk_rec_t * rec = rec_map + rec_idx;
+
+    if( rec->flags & (FD_FUNK_REC_FLAG_ERASE|FD_FUNK_REC_FLAG_COLD) ) continue;
+    ulong val_sz = (ulong)rec->val_sz;
+    if( !val_sz ) continue;
+    if( (ulong)(uint)(now - rec->touch)<min_age ) continue;
+
+    ulong off = fd_ulong_align_up( used_sz, FD_FUNK_COLD_ALIGN );
+    if( FD_UNLIKELY( off+val_sz>cold->map_sz ) ) {
+      FD_LOG_WARNING(( "cold log %s is full (%lu bytes), compact or grow it", shmem->path, cold->map_sz ));
+      break;
+    }
+
+    fd_memcpy( cold->map + off, fd_funk_val_const( rec, wksp ), val_sz );
+    fd_funk_val_flush( rec, alloc, wksp );
+    rec->cold_off = off;
+    rec->cold_sz  = (uint)val_sz;
+    rec->flags   |= FD_FUNK_REC_FLAG_COLD;
+
+    used_sz = off + val_sz;
+    evict_cnt++;
+    evict_sz += val_sz;
+  }
+
+  shmem->used_sz                             = used_sz;
+  ((fd_funk_cold_hdr_t *)cold->map)->used_sz = used_sz;
+  shmem->metrics->evict_cnt                 += evict_cnt;
+  shmem->metrics->evict_sz                  += evict_sz;
+
+  return evict_cnt;
+}
+
+void
+fd_funk_cold_fault_private( fd_funk_t *           funk,
+                            fd_funk_rec_t const * _rec ) {
+  if( FD_UNLIKELY( !(_rec->flags & FD_FUNK_REC_FLAG_COLD) ) ) return; /* Faulted in by somebody else meanwhile */
+
+  fd_funk_cold_t * cold = fd_funk_cold_join( funk );
+  if( FD_UNLIKELY( !cold ) ) FD_LOG_CRIT(( "record is cold but no cold tier is available" ));
+
+  long dt = -fd_log_wallclock();
+
+  fd_wksp_t *     wksp   = fd_funk_wksp( funk );
+  fd_funk_rec_t * rec    = (fd_funk_rec_t *)_rec;
+  ulong           val_sz = (ulong)rec->cold_sz;
+
+  ulong   val_max = 0UL;
+  uchar * val     = (uchar *)fd_alloc_malloc_at_least( fd_funk_alloc( funk, wksp ), FD_FUNK_VAL_ALIGN, val_sz, &val_max );
+  if( FD_UNLIKELY( !val ) ) FD_LOG_CRIT(( "unable to fault in cold record value (wksp full)" ));
+  fd_memcpy( val, cold->map + rec->cold_off, val_sz );
+
+  rec->val_gaddr = fd_wksp_gaddr_fast( wksp, val );
+  rec->val_max   = (uint)fd_ulong_min( val_max, FD_FUNK_REC_VAL_MAX );
+  rec->val_sz    = (uint)val_sz;
+  rec->touch     = (uint)funk->cold_clock;
+  rec->cold_off  = 0UL;
+  rec->cold_sz   = 0U;
+  FD_COMPILER_MFENCE();
+  rec->flags    &= ~FD_FUNK_REC_FLAG_COLD;
+  FD_COMPILER_MFENCE();
+
+  dt += fd_log_wallclock();
+
+  fd_funk_cold_metrics_t * metrics = cold->shmem->metrics;
+# if FD_HAS_ATOMIC
+  FD_ATOMIC_FETCH_AND_ADD( &metrics->fault_cnt, 1UL    );
+  FD_ATOMIC_FETCH_AND_ADD( &metrics->fault_sz,  val_sz );
+  FD_ATOMIC_FETCH_AND_ADD( &metrics->fault_ns,  dt     );
+  for(;;) {
+    long max = metrics->fault_ns_max;
+    if( FD_LIKELY( dt<=max ) || FD_LIKELY( FD_ATOMIC_CAS( &metrics->fault_ns_max, max, dt )==max ) ) break;
+  }
+# else
+  metrics->fault_cnt++;
+  metrics->fault_sz    += val_sz;
+  metrics->fault_ns    += dt;
+  metrics->fault_ns_max = fd_long_max( metrics->fault_ns_max, dt );
+# endif
+}
+
+fd_funk_rec_t const *
+fd_funk_cold_fault( fd_funk_t *           funk,
+                    fd_funk_rec_t const * rec ) {
+  if( FD_LIKELY( !(rec->flags & FD_FUNK_REC_FLAG_COLD) ) ) return rec;
+
+  volatile ulong * lock = fd_funk_rec_shard_lock( funk, rec->map_hash );
+  fd_funk_rec_lock_acquire( lock );
+  fd_funk_cold_fault_private( funk, rec );
+  fd_funk_rec_lock_release( lock );
+
+  return rec;
+}
+
+uchar const *
+fd_funk_cold_val_const( fd_funk_t *           funk,
+                        fd_funk_rec_t const * rec ) {
+  fd_funk_cold_t * cold = fd_funk_cold_join( funk );
+  if( FD_UNLIKELY( !cold ) ) FD_LOG_CRIT(( "record is cold but no cold tier is available" ));
+
+  fd_funk_cold_metrics_t * metrics = cold->shmem->metrics;
+# if FD_HAS_ATOMIC
+  FD_ATOMIC_FETCH_AND_ADD( &metrics->fault_cnt, 1UL                 );
+  FD_ATOMIC_FETCH_AND_ADD( &metrics->fault_sz,  (ulong)rec->cold_sz );
+# else
+  metrics->fault_cnt++;
+  metrics->fault_sz += (ulong)rec->cold_sz;
+# endif
+
+  return cold->map + rec->cold_off;
+}
+
+uchar const *
+fd_funk_cold_val_peek_private( fd_funk_t *           funk,
+                               fd_funk_rec_t const * rec ) {
+  fd_funk_cold_t * cold = fd_funk_cold_join( funk );
+  if( FD_UNLIKELY( !cold ) ) FD_LOG_CRIT(( "record is cold but no cold tier is available" ));
+
+  fd_funk_cold_metrics_t * metrics = cold->shmem->metrics;
+# if FD_HAS_ATOMIC
+  FD_ATOMIC_FETCH_AND_ADD( &metrics->peek_cnt, 1UL                 );
+  FD_ATOMIC_FETCH_AND_ADD( &metrics->peek_sz,  (ulong)rec->cold_sz );
+# else
+  metrics->peek_cnt++;
+  metrics->peek_sz += (ulong)rec->cold_sz;
+# endif
+
+  return cold->map + rec->cold_off;
+}
+
+int
+fd_funk_cold_compact( fd_funk_t * funk ) {
+  fd_funk_check_write( funk );
+
+  fd_funk_cold_t * cold = fd_funk_cold_join( funk );
+  if( FD_UNLIKELY( !cold ) ) {
+    FD_LOG_WARNING(( "funk has no cold tier" ));
+    return FD_FUNK_ERR_INVAL;
+  }
+  fd_funk_cold_shmem_t * shmem = cold->shmem;
+
+  fd_wksp_t *     wksp    = fd_funk_wksp( funk );
+  fd_funk_rec_t * rec_map = fd_funk_rec_map( funk, wksp );
+  ulong           rec_max = funk->rec_max;
+
+  char tmp_path[ PATH_MAX ];
+  if( FD_UNLIKELY( !fd_cstr_printf_check( tmp_path, sizeof(tmp_path), NULL, "%s.compact", shmem->path ) ) ) {
+    FD_LOG_WARNING(( "path too long" ));
+    return FD_FUNK_ERR_SYS;
+  }
+
+  int fd = open( tmp_path, O_CREAT|O_TRUNC|O_RDWR, S_IRUSR|S_IWUSR );
+  if( FD_UNLIKELY( fd<0 ) ) {
+    FD_LOG_WARNING(( "open(%s) failed (%i-%s)", tmp_path, errno, fd_io_strerror( errno ) ));
+    return FD_FUNK_ERR_SYS;
+  }
+
+  ulong   map_sz;
+  uchar * map = fd_funk_cold_map_file( fd, tmp_path, cold->map_sz, &map_sz );
+  if( FD_UNLIKELY( !map ) ) {
+    close( fd );
+    unlink( tmp_path );
+    return FD_FUNK_ERR_SYS;
+  }
+
+  /* The live values are a subset of the old log and the new log is at
+     least as large, so the copy below cannot run out of space.  Record
+     offsets are only updated once the new log is in place. */
+
+  ulong used_sz = FD_FUNK_COLD_HDR_SZ;
+  for( ulong rec_idx = funk->rec_head_idx; !fd_funk_rec_idx_is_null( rec_idx ); rec_idx = rec_map[ rec_idx ].next_idx ) {
+    if( FD_UNLIKELY( rec_idx>=rec_max ) ) FD_LOG_CRIT(( "memory corruption detected (bad idx)" ));
+    fd_funk_rec_t * rec = rec_map + rec_idx;
+    if( !(rec->flags & FD_FUNK_REC_FLAG_COLD) ) continue;
+    ulong off = fd_ulong_align_up( used_sz, FD_FUNK_COLD_ALIGN );
+    fd_memcpy( map + off, cold->map + rec->cold_off, (ulong)rec->cold_sz );
+    used_sz = off + (ulong)rec->cold_sz;
+  }
+
+  fd_funk_cold_hdr_t * hdr = (fd_funk_cold_hdr_t *)map;
+  hdr->used_sz = used_sz;
+  hdr->magic   = FD_FUNK_COLD_MAGIC;
+
+  if( FD_UNLIKELY( msync( map, map_sz, MS_SYNC ) || rename( tmp_path, shmem->path ) ) ) {
+    FD_LOG_WARNING(( "unable to replace %s (%i-%s)", shmem->path, errno, fd_io_strerror( errno ) ));
+    munmap( map, map_sz );
+    close( fd );
+    unlink( tmp_path );
+    return FD_FUNK_ERR_SYS;
+  }
+
+  used_sz = FD_FUNK_COLD_HDR_SZ;
+  for( ulong rec_idx = funk->rec_head_idx; !fd_funk_rec_idx_is_null( rec_idx ); rec_idx = rec_map[ rec_idx ].next_idx ) {
+    fd_funk_rec_t * rec = rec_map + rec_idx;
+    if( !(rec->flags & FD_FUNK_REC_FLAG_COLD) ) continue;
+    ulong off = fd_ulong_align_up( used_sz, FD_FUNK_COLD_ALIGN );
+    rec->cold_off = off;
+    used_sz = off + (ulong)rec->cold_sz;
+  }
+
+  /* Swap the local join to the new log.  Joins of other processes
+     notice the generation change and remap. */
+
+  fd_funk_rec_lock_acquire( &fd_funk_cold_private_lock );
+
+  munmap( cold->map, cold->map_sz );
+  close( cold->fd );
+
+  shmem->metrics->compact_cnt++;
+  shmem->metrics->compact_free_sz += shmem->used_sz - used_sz;
+
+  shmem->map_sz  = map_sz;
+  shmem->used_sz = used_sz;
+  shmem->gen     = fd_funk_cold_next_gen( shmem->gen );
+
+  cold->gen    = shmem->gen;
+  cold->fd     = fd;
+  cold->map    = map;
+  cold->map_sz = map_sz;
+
+  fd_funk_rec_lock_release( &fd_funk_cold_private_lock );
+
+  return FD_FUNK_SUCCESS;
+}
+
+void
+fd_funk_cold_log_metrics( fd_funk_t const * funk ) {
+  fd_funk_cold_shmem_t const * shmem = fd_funk_cold_shmem( funk );
+  if( FD_UNLIKELY( !shmem ) ) return;
+  fd_funk_cold_metrics_t const * m = shmem->metrics;
+  double hit_rate = m->lookup_cnt ? 1. - (double)fd_ulong_min( m->fault_cnt, m->lookup_cnt )/(double)m->lookup_cnt : 1.;
+  double fault_us = m->fault_cnt  ? 1e-3*(double)m->fault_ns/(double)m->fault_cnt : 0.;
+  FD_LOG_NOTICE(( "funk cold tier %s: log %lu/%lu bytes, lookups %lu, hit rate %.4f, faults %lu (%lu bytes, avg %.3f us, max %.3f us), "
+                  "peeks %lu (%lu bytes), evicted %lu (%lu bytes), compactions %lu (%lu bytes reclaimed)",
+                  shmem->path, shmem->used_sz, shmem->map_sz, m->lookup_cnt, hit_rate,
+                  m->fault_cnt, m->fault_sz, fault_us, 1e-3*(double)m->fault_ns_max,
+                  m->peek_cnt, m->peek_sz, m->evict_cnt, m->evict_sz, m->compact_cnt, m->compact_free_sz ));
+}
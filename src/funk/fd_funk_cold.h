@@ -0,0 +1,284 @@
+#ifndef HEADER_fd_src_funk_fd_funk_cold_h
+#define HEADER_fd_src_funk_fd_funk_cold_h
+
+/* fd_funk_cold provides a cold storage tier for funk record values.
+
+   Funk normally keeps every record value resident in the wksp.  With a
+   cold tier attached, published records whose values have not been
+   written (or faulted in) for a configurable number of cold clock ticks
+   can be evicted to an append-only, memory mapped value log on disk.
+   The record itself (key, map linkage, partition, etc) stays in the
+   record map and is marked with FD_FUNK_REC_FLAG_COLD.  When such a
+   record is returned by fd_funk_rec_query, fd_funk_rec_query_global or
+   fd_funk_rec_write_prepare, its value is transparently faulted back
+   into the wksp first.  Records in in-preparation transactions are never
+   evicted, so the hot working set of the replay path stays at wksp
+   speed.
+
+   Evicted values are never overwritten in the log.  When a cold record
+   is faulted in, erased or superseded by a publish, its log entry
+   becomes garbage.  fd_funk_cold_compact rewrites the log with only the
+   live entries.
+
+   A cold tier is attached to a funk instance: its shared state (log
+   path, capacity, metrics) lives in the funk's wksp and is found
+   through funk->cold_gaddr, so every process joined to the funk sees
+   the same tier.  Each process maps the log lazily the first time it
+   needs a cold value (fd_funk_cold_join).  Processes that cannot open
+   files later on (e.g. sandboxed tiles) should call fd_funk_cold_join
+   during initialization and cannot follow a compaction.
+
+   Code that walks the record map directly instead of going through the
+   query APIs (e.g. snapshot creation, hashing all accounts) sees cold
+   records with a zero sized value.  Such code should read values with
+   fd_funk_cold_val_peek, which does not pull them back into the wksp.
+
+   The log file starts with a FD_FUNK_COLD_HDR_SZ byte header and is
+   reopened as-is, so a funk backed by fd_funk_filemap can be restarted
+   with its cold tier. */
+
+#include "fd_funk.h"
+#include <limits.h>
+
+#define FD_FUNK_COLD_MAGIC  (0xf17eda2ce7c01d00UL) /* firedancer funk cold log version 0 */
+#define FD_FUNK_COLD_HDR_SZ (4096UL)
+#define FD_FUNK_COLD_ALIGN  (8UL)                  /* Alignment of values in the log */
+
+/* FD_FUNK_COLD_JOIN_MAX is the max number of funk instances whose cold
+   tier a single process can have joined at the same time. */
+
+#define FD_FUNK_COLD_JOIN_MAX (16UL)
+
+/* fd_funk_cold_metrics_t gives the cold tier counters.  A lookup is a
+   query that returned a published record while the cold tier was
+   attached, a hit is a lookup that found the value resident in the wksp
+   and a fault is a lookup that had to fault the value back in.  A peek
+   is a read of a cold value by a walker that did not fault it in. */
+
+struct fd_funk_cold_metrics {
+  ulong lookup_cnt;      /* Number of published record lookups, see fd_funk_cold_note_lookup */
+  ulong fault_cnt;       /* Number of values faulted in or copied out of the log */
+  ulong fault_sz;        /* Bytes faulted in or copied out of the log */
+  long  fault_ns;        /* Total wallclock ns spent faulting values in */
+  long  fault_ns_max;    /* Worst case wallclock ns for a single fault */
+  ulong peek_cnt;        /* Number of values read in place from the log */
+  ulong peek_sz;         /* Bytes read in place from the log */
+  ulong evict_cnt;       /* Number of values evicted */
+  ulong evict_sz;        /* Bytes evicted */
+  ulong compact_cnt;     /* Number of compactions */
+  ulong compact_free_sz; /* Bytes of garbage reclaimed by compactions */
+};
+
+typedef struct fd_funk_cold_metrics fd_funk_cold_metrics_t;
+
+/* fd_funk_cold_shmem_t is the shared state of a cold tier.  It is
+   allocated in the funk's wksp (with the funk's wksp_tag) when the tier
+   is attached. */
+
+#define FD_FUNK_COLD_SHMEM_ALIGN (128UL)
+
+struct __attribute__((aligned(FD_FUNK_COLD_SHMEM_ALIGN))) fd_funk_cold_shmem {
+  char                   path[ PATH_MAX ]; /* Path of the log file */
+  ulong                  gen;              /* Changes whenever the log file is replaced */
+  ulong                  map_sz;           /* Log capacity in bytes, multiple of FD_FUNK_COLD_HDR_SZ */
+  ulong                  used_sz;          /* Append cursor, in [FD_FUNK_COLD_HDR_SZ,map_sz] */
+  fd_funk_cold_metrics_t metrics[1];
+};
+
+typedef struct fd_funk_cold_shmem fd_funk_cold_shmem_t;
+
+/* fd_funk_cold_t is a process local join to the cold tier of a funk.
+   Joins are managed by fd_funk_cold_join. */
+
+struct fd_funk_cold {
+  fd_funk_t *            funk;   /* Local join of the funk, NULL if this join is unused */
+  fd_funk_cold_shmem_t * shmem;  /* Local address of the shared state */
+  ulong                  gen;    /* shmem->gen when the log was mapped */
+  int                    fd;     /* File descriptor of the log file */
+  uchar *                map;    /* Local mapping of the entire log file */
+  ulong                  map_sz; /* Size of the local mapping */
+};
+
+typedef struct fd_funk_cold fd_funk_cold_t;
+
+FD_PROTOTYPES_BEGIN
+
+/* fd_funk_cold_shmem returns the shared state of the cold tier attached
+   to funk, NULL if none.  Assumes funk is a current local join. */
+
+FD_FN_PURE static inline fd_funk_cold_shmem_t *
+fd_funk_cold_shmem( fd_funk_t const * funk ) {
+  ulong gaddr = funk->cold_gaddr;
+  if( FD_LIKELY( !gaddr ) ) return NULL;
+  return (fd_funk_cold_shmem_t *)fd_wksp_laddr_fast( fd_funk_wksp( (fd_funk_t *)funk ), gaddr );
+}
+
+/* fd_funk_cold_open opens (creating if necessary) the cold value log at
+   path with a capacity of max_sz bytes (rounded up to a multiple of
+   FD_FUNK_COLD_HDR_SZ, the file is sparse) and attaches it to funk.  An
+   existing log is reused as is (max_sz is then only used to grow the
+   capacity).  Returns FD_FUNK_SUCCESS on success and FD_FUNK_ERR_INVAL
+   (e.g. funk already has a cold tier), FD_FUNK_ERR_MEM (wksp full) or
+   FD_FUNK_ERR_SYS (file error) on failure (logs details).  Assumes the
+   caller is inside a fd_funk_start_write / fd_funk_end_write block. */
+
+int
+fd_funk_cold_open( fd_funk_t *  funk,
+                   char const * path,
+                   ulong        max_sz );
+
+/* fd_funk_cold_close detaches the cold tier from funk and drops the
+   calling process's join.  Any records still cold in funk will need the
+   same log to be reopened before their values can be accessed again.
+   Other processes' joins are dropped the next time they use the tier.
+   Returns FD_FUNK_SUCCESS or FD_FUNK_ERR_INVAL if funk has no cold tier.
+   Same requirements as fd_funk_cold_open. */
+
+int
+fd_funk_cold_close( fd_funk_t * funk );
+
+/* fd_funk_cold_join returns the calling process's join to the cold tier
+   of funk, mapping the log first if this process has not done so yet or
+   the log was replaced since (compaction).  Returns NULL if funk has no
+   cold tier or the log could not be mapped (logs details).  The join is
+   valid until the log is replaced or the tier is closed.  Thread safe. */
+
+fd_funk_cold_t *
+fd_funk_cold_join( fd_funk_t * funk );
+
+/* fd_funk_cold_clock_{set,get} set / get the cold clock of funk
+   (typically the current slot).  Assumes funk is a current local
+   join. */
+
+static inline void  fd_funk_cold_clock_set( fd_funk_t * funk, ulong now ) { funk->cold_clock = now; }
+FD_FN_PURE static inline ulong fd_funk_cold_clock_get( fd_funk_t const * funk ) { return funk->cold_clock; }
+
+/* fd_funk_cold_evict evicts the values of all published records of
+   funk that have not been written or faulted in for at least min_age
+   cold clock ticks to the log.  Returns the number of values evicted
+   (0 if funk has no cold tier).  Stops early (logs a warning) if the
+   log is full.  Assumes the caller is inside a fd_funk_start_write /
+   fd_funk_end_write block and no other thread or process is accessing
+   the published records of funk. */
+
+ulong
+fd_funk_cold_evict( fd_funk_t * funk,
+                    ulong       min_age );
+
+/* fd_funk_cold_fault faults the value of the cold record rec back into
+   the wksp and returns rec.  Returns rec unchanged if it is not cold.
+   This is safe to call concurrently with other faults, queries and
+   fd_funk_rec_write_prepare_concur (the record's lock shard is held for
+   the duration) but does otherwise not require the caller to be in a
+   write block.  Logs critical and aborts if funk has no cold tier or
+   the wksp is out of memory (as the value would be lost otherwise). */
+
+fd_funk_rec_t const *
+fd_funk_cold_fault( fd_funk_t *           funk,
+                    fd_funk_rec_t const * rec );
+
+/* fd_funk_cold_fault_private is fd_funk_cold_fault for callers that
+   already hold the record's lock shard (fd_funk_rec_shard_lock).
+   Internal use only. */
+
+void
+fd_funk_cold_fault_private( fd_funk_t *           funk,
+                            fd_funk_rec_t const * rec );
+
+/* fd_funk_cold_val_const returns a pointer in the caller's address
+   space to the value of the cold record rec in the log (the size is
+   rec->cold_sz).  This allows copying a cold value (e.g. into an
+   in-preparation transaction) without faulting it into the wksp and is
+   accounted as a fault.  The lifetime of the returned pointer is until
+   the record is faulted in, the log is compacted or closed.  Logs
+   critical and aborts if funk has no cold tier. */
+
+uchar const *
+fd_funk_cold_val_const( fd_funk_t *           funk,
+                        fd_funk_rec_t const * rec );
+
+/* fd_funk_cold_val_peek returns a pointer in the caller's address
+   space to the value of record rec, wherever it currently is, and
+   stores its size in *_val_sz.  Cold values are read in place from the
+   log and are not faulted in, so a walk over all records does not pull
+   the cold tier back into the wksp.  Same lifetime and error handling
+   as fd_funk_cold_val_const for cold records and as fd_funk_val_const
+   otherwise.  The returned value is read-only: a cold value lives in
+   the shared log mapping and writing to it would silently modify the
+   log of every process using the tier.  Callers that need to update a
+   value in place must fault it in with fd_funk_cold_fault first. */
+
+uchar const *
+fd_funk_cold_val_peek_private( fd_funk_t *           funk,
+                               fd_funk_rec_t const * rec );
+
+static inline uchar const *
+fd_funk_cold_val_peek( fd_funk_t *           funk,
+                       fd_funk_rec_t const * rec,
+                       fd_wksp_t *           wksp,
+                       ulong *               _val_sz ) {
+  if( FD_LIKELY( !(rec->flags & FD_FUNK_REC_FLAG_COLD) ) ) {
+    *_val_sz = fd_funk_val_sz( rec );
+    return (uchar const *)fd_funk_val_const( rec, wksp );
+  }
+  *_val_sz = (ulong)rec->cold_sz;
+  return fd_funk_cold_val_peek_private( funk, rec );
+}
+
+/* fd_funk_cold_note_lookup updates the lookup metrics after a query
+   returned rec.  This is a no-op if funk has no cold tier.  Counting
+   lookups costs a shared atomic increment per query, so it is compiled
+   out (lookup_cnt stays 0) unless FD_FUNK_COLD_LOOKUP_METRICS is set. */
+
+#ifndef FD_FUNK_COLD_LOOKUP_METRICS
+#define FD_FUNK_COLD_LOOKUP_METRICS 0
+#endif
+
+static inline void
+fd_funk_cold_note_lookup( fd_funk_t *           funk,
+                          fd_funk_rec_t const * rec ) {
+# if FD_FUNK_COLD_LOOKUP_METRICS
+  fd_funk_cold_shmem_t * shmem = fd_funk_cold_shmem( funk );
+  if( FD_LIKELY( !shmem ) || !rec || !fd_funk_txn_idx_is_null( fd_funk_txn_idx( rec->txn_cidx ) ) ) return;
+# if FD_HAS_ATOMIC
+  FD_ATOMIC_FETCH_AND_ADD( &shmem->metrics->lookup_cnt, 1UL );
+# else
+  shmem->metrics->lookup_cnt++;
+# endif
+# else
+  (void)funk; (void)rec;
+# endif
+}
+
+/* fd_funk_cold_compact rewrites the log such that it only holds the
+   values of records that are currently cold, reclaiming the space used
+   by faulted in / erased / superseded values.  Returns FD_FUNK_SUCCESS
+   on success, FD_FUNK_ERR_INVAL if funk has no cold tier and
+   FD_FUNK_ERR_SYS on failure (logs details, the existing log is left
+   untouched in that case).  Same concurrency requirements as
+   fd_funk_cold_evict. */
+
+int
+fd_funk_cold_compact( fd_funk_t * funk );
+
+/* fd_funk_cold_metrics returns the metrics of the cold tier of funk,
+   NULL if none.  The counters are shared by all processes using the
+   tier.  The hit rate is 1-fault_cnt/lookup_cnt (lookups are only
+   counted with FD_FUNK_COLD_LOOKUP_METRICS) and the average fault
+   latency is fault_ns/fault_cnt. */
+
+FD_FN_PURE static inline fd_funk_cold_metrics_t const *
+fd_funk_cold_metrics( fd_funk_t const * funk ) {
+  fd_funk_cold_shmem_t const * shmem = fd_funk_cold_shmem( funk );
+  return shmem ? shmem->metrics : NULL;
+}
+
+/* fd_funk_cold_log_metrics logs the metrics of the cold tier of funk at
+   NOTICE level (no-op if none). */
+
+void
+fd_funk_cold_log_metrics( fd_funk_t const * funk );
+
+FD_PROTOTYPES_END
+
+#endif /* HEADER_fd_src_funk_fd_funk_cold_h */
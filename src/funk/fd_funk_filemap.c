@@ -1,6 +1,7 @@
 #define _GNU_SOURCE
 #define _FILE_OFFSET_BITS 64
 #include "fd_funk_filemap.h"
+#include "fd_funk_ckpt.h"
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <unistd.h>
@@ -10,6 +11,11 @@
 
 #define PAGESIZE (1UL<<12)  /* 4 KiB */
 
+/* Source for zeroing backing files (not on the stack as the recovery of
+   a funk checkpoint chain nests funk file creation) */
+
+static uchar const zeros[ 4UL<<20 ];
+
 fd_funk_t *
 fd_funk_open_file( const char * filename,
                    ulong        wksp_tag,
@@ -150,8 +156,6 @@ fd_funk_open_file( const char * filename,
 
   if( do_new & (fd != -1) ) {
     FD_LOG_DEBUG(( "zeroing %s", (filename ? filename : "(NULL)") ));
-    uchar zeros[4<<20];
-    memset( zeros, 0, sizeof(zeros) );
     for( ulong i = 0; i < total_sz; ) {
       ulong sz = fd_ulong_min( sizeof(zeros), total_sz - i );
       if( FD_UNLIKELY( pwrite( fd, zeros, sz, (__off_t)i ) < (ssize_t)sz ) ) {
@@ -298,11 +302,79 @@ fd_funk_open_file( const char * filename,
   }
 }
 
+/* fd_funk_recover_ckpt_chain recovers a funk from the chain of funk
+   checkpoints whose full checkpoint is at ckpt_filename (with header
+   hdr).  The incremental checkpoints of the chain are restored in order
+   until the next one does not exist, each using the caller and tpool
+   worker threads (t0,t1). */
+
+static fd_funk_t *
+fd_funk_recover_ckpt_chain( const char *                funk_filename,
+                            ulong                       wksp_tag,
+                            const char *                ckpt_filename,
+                            fd_funk_ckpt_hdr_t const *  hdr,
+                            fd_tpool_t *                tpool,
+                            ulong                       t0,
+                            ulong                       t1,
+                            fd_funk_close_file_args_t * close_args_out ) {
+  if( FD_UNLIKELY( hdr->parent_seq ) ) {
+    FD_LOG_WARNING(( "%s is an incremental funk checkpoint, the chain must start with a full one", ckpt_filename ));
+    return NULL;
+  }
+
+  /* Make the funk match the one that was checkpointed */
+
+  fd_funk_close_file_args_t close_args[1];
+  fd_funk_t * funk = fd_funk_open_file( funk_filename, wksp_tag, hdr->seed, (ulong)hdr->txn_max, hdr->rec_max,
+                                        fd_ulong_align_up( hdr->wksp_sz, PAGESIZE ), FD_FUNK_OVERWRITE, close_args );
+  if( FD_UNLIKELY( !funk ) ) return NULL;
+
+  fd_funk_start_write( funk );
+  char         next[ PATH_MAX ];
+  char const * path = ckpt_filename;
+  int          err;
+  for(;;) {
+    err = fd_funk_ckpt_restore( funk, &path, 1UL, tpool, t0, t1 );
+    if( FD_UNLIKELY( err ) ) break;
+    path = fd_funk_ckpt_chain_path( next, sizeof(next), ckpt_filename, fd_funk_ckpt_seq( funk )+1UL );
+    if( !path || access( path, F_OK ) ) break;
+  }
+  fd_funk_end_write( funk );
+
+  if( FD_UNLIKELY( err ) ) {
+    FD_LOG_WARNING(( "restoring funk checkpoint chain %s failed (%i-%s)", ckpt_filename, err, fd_funk_strerror( err ) ));
+    fd_funk_close_file( close_args );
+    return NULL;
+  }
+
+  FD_LOG_NOTICE(( "recovered funk from checkpoint chain %s (last checkpoint %lu), %lu records", ckpt_filename,
+                  fd_funk_ckpt_seq( funk ), fd_funk_rec_cnt( fd_funk_rec_map( funk, fd_funk_wksp( funk ) ) ) ));
+
+  if( FD_UNLIKELY( close_args_out != NULL ) ) *close_args_out = *close_args;
+  return funk;
+}
+
 fd_funk_t *
 fd_funk_recover_checkpoint( const char * funk_filename,
                             ulong        wksp_tag,
                             const char * checkpt_filename,
+                            fd_tpool_t * tpool,
+                            ulong        t0,
+                            ulong        t1,
                             fd_funk_close_file_args_t * close_args_out ) {
+  /* Funk checkpoints are recognized by their magic, anything else is
+     assumed to be a workspace checkpoint */
+
+  fd_funk_ckpt_hdr_t hdr[1];
+  int ckpt_fd = open( checkpt_filename, O_RDONLY );
+  if( FD_LIKELY( ckpt_fd>=0 ) ) {
+    ssize_t rsz = read( ckpt_fd, hdr, sizeof(fd_funk_ckpt_hdr_t) );
+    close( ckpt_fd );
+    if( rsz==(ssize_t)sizeof(fd_funk_ckpt_hdr_t) && hdr->magic==FD_FUNK_CKPT_MAGIC ) {
+      return fd_funk_recover_ckpt_chain( funk_filename, wksp_tag, checkpt_filename, hdr, tpool, t0, t1, close_args_out );
+    }
+  }
+
   /* Make the funk workspace match the parameters used to create the
      checkpoint. */
 
@@ -350,8 +422,6 @@ fd_funk_recover_checkpoint( const char * funk_filename,
 
     /* Force all the disk blocks to be physically allocated to avoid major faults in the future */
 
-    uchar zeros[4<<20];
-    memset( zeros, 0, sizeof(zeros) );
     for( ulong i = 0; i < total_sz; ) {
       ulong sz = fd_ulong_min( sizeof(zeros), total_sz - i );
       if( FD_UNLIKELY ( pwrite( fd, zeros, sz, (__off_t)i ) < (ssize_t)sz ) ) {
@@ -45,13 +45,22 @@ fd_funk_open_file( const char * filename,
    instance. funk_filename is the backing file, or NULL for a
    local/anonymous instance. wksp_tag is the workspace partition tag
    for funk (usually just 1). checkpt_filename is the checkpoint
-   file. close_args_opt is an optional pointer to a structure which is
+   file. If checkpt_filename is a full funk checkpoint (fd_funk_ckpt.h)
+   instead, a funk with the checkpointed geometry is created and the
+   chain starting at checkpt_filename (checkpt_filename.<seq> for the
+   incremental checkpoints) is restored into it, thread parallel using
+   the caller and tpool worker threads (t0,t1) (tpool can be NULL
+   and/or t1-t0 1 to restore single threaded, see
+   fd_funk_ckpt_restore). close_args_opt is an optional pointer to a structure which is
    filled in. This is needed for fd_funk_close_file. */
 
 fd_funk_t *
 fd_funk_recover_checkpoint( const char * funk_filename,
                             ulong        wksp_tag,
                             const char * checkpt_filename,
+                            fd_tpool_t * tpool,
+                            ulong        t0,
+                            ulong        t1,
                             fd_funk_close_file_args_t * close_args_out );
 
 /* Release the resources associated with a funk instance. The funk
@@ -74,6 +74,7 @@ fd_funk_part_set_intern( fd_funk_partvec_t * partvec,
                          uint                part) {
   if (part == rec->part) return FD_FUNK_SUCCESS;
   if ((rec->flags & FD_FUNK_REC_FLAG_ERASE)) return FD_FUNK_ERR_INVAL;
+  if ( fd_funk_txn_idx_is_null( fd_funk_txn_idx( rec->txn_cidx ) ) ) rec->flags |= FD_FUNK_REC_FLAG_DIRTY;
 
   int err;
   if (rec->part != FD_FUNK_PART_NULL) {
@@ -129,6 +130,8 @@ fd_funk_repartition(fd_funk_t *            funk,
        iter = fd_funk_rec_map_iter_next( rec_map, iter ) ) {
     fd_funk_rec_t * rec = fd_funk_rec_map_iter_ele( rec_map, iter );
     fd_funk_part_init( rec );
+    /* Conservatively treat every published record as repartitioned */
+    if ( fd_funk_txn_idx_is_null( fd_funk_txn_idx( rec->txn_cidx ) ) ) rec->flags |= FD_FUNK_REC_FLAG_DIRTY;
   }
 
   for( fd_funk_rec_map_iter_t iter = fd_funk_rec_map_iter_init( rec_map );
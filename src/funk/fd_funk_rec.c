@@ -1,4 +1,5 @@
 #include "fd_funk.h"
+#include "fd_funk_cold.h"
 
 /* Provide the actual record map implementation */
 
@@ -29,6 +30,18 @@ fd_funk_rec_map_set_key_cnt( fd_funk_rec_t * join, ulong key_cnt ) {
   map->key_cnt = key_cnt;
 }
 
+/* fd_funk_rec_tier_fault is applied to the records returned by the
+   query APIs.  It faults the value of rec back in from the cold tier if
+   it was evicted (see fd_funk_cold.h). */
+
+static inline fd_funk_rec_t const *
+fd_funk_rec_tier_fault( fd_funk_t *           funk,
+                        fd_funk_rec_t const * rec ) {
+  fd_funk_cold_note_lookup( funk, rec );
+  if( FD_UNLIKELY( rec && (rec->flags & FD_FUNK_REC_FLAG_COLD) ) ) rec = fd_funk_cold_fault( funk, rec );
+  return rec;
+}
+
 fd_funk_rec_t const *
 fd_funk_rec_query( fd_funk_t *               funk,
                    fd_funk_txn_t const *     txn,
@@ -38,15 +51,17 @@ fd_funk_rec_query( fd_funk_t *               funk,
 
   fd_funk_xid_key_pair_t pair[1]; fd_funk_xid_key_pair_init( pair, txn ? fd_funk_txn_xid( txn ) : fd_funk_root( funk ), key );
 
-  return fd_funk_rec_map_query_const( fd_funk_rec_map( funk, fd_funk_wksp( funk ) ), pair, NULL );
+  return fd_funk_rec_tier_fault( funk, fd_funk_rec_map_query_const( fd_funk_rec_map( funk, fd_funk_wksp( funk ) ), pair, NULL ) );
 }
 
-fd_funk_rec_t const *
-fd_funk_rec_query_global( fd_funk_t *               funk,
-                          fd_funk_txn_t const *     txn,
-                          fd_funk_rec_key_t const * key,
-                          fd_funk_txn_t const **    txn_out ) {
-  if( FD_UNLIKELY( (!funk) | (!key) ) ) return NULL;
+/* fd_funk_rec_query_global_private is fd_funk_rec_query_global without
+   faulting in cold values.  The returned record may be cold. */
+
+static fd_funk_rec_t const *
+fd_funk_rec_query_global_private( fd_funk_t *               funk,
+                                  fd_funk_txn_t const *     txn,
+                                  fd_funk_rec_key_t const * key,
+                                  fd_funk_txn_t const **    txn_out ) {
 
   fd_wksp_t * wksp = fd_funk_wksp( funk );
 
@@ -101,6 +116,37 @@ fd_funk_rec_query_global( fd_funk_t *               funk,
   return NULL;
 }
 
+fd_funk_rec_t const *
+fd_funk_rec_query_global( fd_funk_t *               funk,
+                          fd_funk_txn_t const *     txn,
+                          fd_funk_rec_key_t const * key,
+                          fd_funk_txn_t const **    txn_out ) {
+  if( FD_UNLIKELY( (!funk) | (!key) ) ) return NULL;
+  return fd_funk_rec_tier_fault( funk, fd_funk_rec_query_global_private( funk, txn, key, txn_out ) );
+}
+
+fd_funk_rec_t const *
+fd_funk_rec_query_global_concur( fd_funk_t *               funk,
+                                 fd_funk_txn_t const *     txn,
+                                 fd_funk_rec_key_t const * key,
+                                 fd_funk_txn_t const **    txn_out ) {
+  if( FD_UNLIKELY( (!funk) | (!key) ) ) return NULL;
+
+  /* All incarnations of key live in the same hash chain, so holding
+     the chain's lock serializes the query with concurrent writers
+     linking records into it or faulting in their values. */
+
+  fd_funk_rec_map_private_t * priv       = fd_funk_rec_map_private( fd_funk_rec_map( funk, fd_funk_wksp( funk ) ) );
+  volatile ulong *            chain_lock = fd_funk_rec_shard_lock( funk, fd_funk_rec_key_hash( key, priv->seed ) );
+
+  fd_funk_rec_lock_acquire( chain_lock );
+  fd_funk_rec_t const * rec = fd_funk_rec_query_global_private( funk, txn, key, txn_out );
+  fd_funk_cold_note_lookup( funk, rec );
+  if( FD_UNLIKELY( rec && (rec->flags & FD_FUNK_REC_FLAG_COLD) ) ) fd_funk_cold_fault_private( funk, rec );
+  fd_funk_rec_lock_release( chain_lock );
+  return rec;
+}
+
 void *
 fd_funk_rec_query_safe( fd_funk_t *               funk,
                         fd_funk_rec_key_t const * key,
@@ -139,7 +185,19 @@ fd_funk_rec_query_xid_safe( fd_funk_t *               funk,
       FD_COMPILER_MFENCE();
       if( lock_start == funk->write_lock ) return NULL;
     } else {
-      uint val_sz = rec->val_sz;
+      uint          val_sz  = rec->val_sz;
+      uchar const * val_src = val_sz ? fd_wksp_laddr_fast( wksp, rec->val_gaddr ) : NULL;
+      if( FD_UNLIKELY( rec->flags & FD_FUNK_REC_FLAG_COLD ) ) {
+        /* Read evicted values straight from the cold tier's log rather
+           than faulting them in as we do not hold the write lock. */
+        fd_funk_cold_t * cold = fd_funk_cold_join( funk );
+        if( FD_UNLIKELY( !cold ) ) {
+          FD_LOG_WARNING(( "record is cold but no cold tier is available" ));
+          return NULL;
+        }
+        val_sz  = rec->cold_sz;
+        val_src = cold->map + rec->cold_off;
+      }
       if( val_sz ) {
         if( result == NULL ) {
           result = fd_valloc_malloc( valloc, FD_FUNK_VAL_ALIGN, val_sz );
@@ -149,7 +207,7 @@ fd_funk_rec_query_xid_safe( fd_funk_t *               funk,
           result = fd_valloc_malloc( valloc, FD_FUNK_VAL_ALIGN, val_sz );
           alloc_len = val_sz;
         }
-        fd_memcpy( result, fd_wksp_laddr_fast( wksp, rec->val_gaddr ), val_sz );
+        fd_memcpy( result, val_src, val_sz );
       }
       *result_len = val_sz;
       FD_COMPILER_MFENCE();
@@ -228,6 +286,8 @@ fd_funk_rec_modify( fd_funk_t *           funk,
     if( FD_UNLIKELY( fd_funk_last_publish_is_frozen( funk ) ) )
       return NULL;
 
+    ((fd_funk_rec_t *)rec)->flags |= FD_FUNK_REC_FLAG_DIRTY;
+
   } else { /* Modifying an in-prep transaction */
     fd_funk_txn_t * txn_map = fd_funk_txn_map( funk, wksp );
 
@@ -340,7 +400,7 @@ fd_funk_rec_insert( fd_funk_t *               funk,
       /* However, if the record is marked for erasure, reset the flag and
          return the record. */
       if( rec->flags & FD_FUNK_REC_FLAG_ERASE ) {
-        rec->flags &= ~FD_FUNK_REC_FLAG_ERASE;
+        rec->flags = (rec->flags & ~FD_FUNK_REC_FLAG_ERASE) | FD_FUNK_REC_FLAG_DIRTY;
         return rec;
       }
 
@@ -414,7 +474,10 @@ fd_funk_rec_insert( fd_funk_t *               funk,
   rec->next_idx = FD_FUNK_REC_IDX_NULL;
   rec->txn_cidx = fd_funk_txn_cidx( txn_idx );
   rec->tag      = 0U;
-  rec->flags    = 0UL;
+  rec->flags    = fd_funk_txn_idx_is_null( txn_idx ) ? FD_FUNK_REC_FLAG_DIRTY : 0UL;
+  rec->touch    = (uint)funk->cold_clock;
+  rec->cold_off = 0UL;
+  rec->cold_sz  = 0U;
 
   if( first_born ) *_rec_head_idx                   = rec_idx;
   else             rec_map[ rec_prev_idx ].next_idx = rec_idx;
@@ -476,7 +539,10 @@ fd_funk_rec_remove( fd_funk_t *     funk,
 
   fd_funk_val_flush( rec, fd_funk_alloc( funk, wksp ), wksp );
   fd_funk_part_set_intern( fd_funk_get_partvec( funk, wksp ), rec_map, rec, FD_FUNK_PART_NULL );
-  rec->flags |= FD_FUNK_REC_FLAG_ERASE;
+  rec->flags    = (rec->flags & ~FD_FUNK_REC_FLAG_COLD) | FD_FUNK_REC_FLAG_ERASE;
+  if( fd_funk_txn_idx_is_null( txn_idx ) ) rec->flags |= FD_FUNK_REC_FLAG_DIRTY;
+  rec->cold_off = 0UL;
+  rec->cold_sz  = 0U;
 
   /* At this point, the 5 most significant bytes should store data about the
      transaction that the record was updated in. */
@@ -551,7 +617,7 @@ fd_funk_rec_write_prepare( fd_funk_t *               funk,
   fd_funk_rec_t * rec = NULL;
   fd_funk_rec_t const * rec_con = NULL;
   if ( FD_LIKELY (NULL == irec ) )
-    rec_con = fd_funk_rec_query_global( funk, txn, key, NULL );
+    rec_con = fd_funk_rec_query_global_private( funk, txn, key, NULL );
   else
     rec_con = irec;
 
@@ -562,6 +628,7 @@ fd_funk_rec_write_prepare( fd_funk_t *               funk,
     /* We have an incarnation of the record */
     if ( txn == fd_funk_rec_txn( rec_con,  fd_funk_txn_map( funk, wksp ) ) ) {
       /* The record is already in the right transaction */
+      if( FD_UNLIKELY( rec_con->flags & FD_FUNK_REC_FLAG_COLD ) ) rec_con = fd_funk_cold_fault( funk, rec_con );
       rec = fd_funk_rec_modify( funk, rec_con );
       if ( !rec ) {
         fd_int_store_if( !!opt_err, opt_err, FD_FUNK_ERR_FROZEN );
@@ -569,12 +636,16 @@ fd_funk_rec_write_prepare( fd_funk_t *               funk,
       }
 
     } else {
-      /* Copy the record into the transaction */
+      /* Copy the record into the transaction (straight from the cold
+         tier if the ancestor incarnation was evicted) */
       rec = fd_funk_rec_modify( funk, fd_funk_rec_insert( funk, txn, key, opt_err ) );
       if ( !rec )
         return NULL;
-      rec = fd_funk_val_copy( rec, fd_funk_val_const(rec_con, wksp), fd_funk_val_sz(rec_con),
-        fd_ulong_max( fd_funk_val_sz(rec_con), min_val_size ), fd_funk_alloc( funk, wksp ), wksp, opt_err );
+      int           con_cold = !!(rec_con->flags & FD_FUNK_REC_FLAG_COLD);
+      uchar const * con_val  = con_cold ? fd_funk_cold_val_const( funk, rec_con ) : (uchar const *)fd_funk_val_const( rec_con, wksp );
+      ulong         con_sz   = con_cold ? (ulong)rec_con->cold_sz : fd_funk_val_sz( rec_con );
+      rec = fd_funk_val_copy( rec, con_val, con_sz,
+        fd_ulong_max( con_sz, min_val_size ), fd_funk_alloc( funk, wksp ), wksp, opt_err );
       if ( !rec ) {
         return NULL;
       }
@@ -594,6 +665,7 @@ fd_funk_rec_write_prepare( fd_funk_t *               funk,
 
   /* Grow the record to the right size */
   rec->flags &= ~FD_FUNK_REC_FLAG_ERASE;
+  rec->touch  = (uint)funk->cold_clock;
   if ( fd_funk_val_sz( rec ) < min_val_size ) {
     rec = fd_funk_val_truncate( rec, min_val_size, fd_funk_alloc( funk, wksp ), wksp, opt_err );
   }
@@ -601,6 +673,214 @@ fd_funk_rec_write_prepare( fd_funk_t *               funk,
   return rec;
 }
 
+volatile ulong *
+fd_funk_rec_shard_lock( fd_funk_t * funk,
+                        ulong       hash ) {
+  if( FD_UNLIKELY( !funk->rec_lock_gaddr ) ) return &funk->rec_pool_lock;
+  fd_wksp_t *                 wksp     = fd_funk_wksp( funk );
+  fd_funk_rec_map_private_t * priv     = fd_funk_rec_map_private( fd_funk_rec_map( funk, wksp ) );
+  fd_funk_rec_lock_t *        rec_lock = (fd_funk_rec_lock_t *)fd_wksp_laddr_fast( wksp, funk->rec_lock_gaddr );
+  return &rec_lock[ (hash & (priv->list_cnt-1UL)) & (FD_FUNK_REC_LOCK_CNT-1UL) ].lock;
+}
+
+/* fd_funk_rec_chain_query returns the record in the rec_map chain
+   starting at head whose (xid,key) pair matches pair and NULL if there
+   is none.  Unlike fd_funk_rec_map_query, this does not move the found
+   record to the front of the chain, such that lockless readers of the
+   chain stay safe. */
+
+static fd_funk_rec_t *
+fd_funk_rec_chain_query( fd_funk_rec_t *                rec_map,
+                         ulong const *                  head,
+                         ulong                          hash,
+                         fd_funk_xid_key_pair_t const * pair ) {
+  ulong cur = *head;
+  for(;;) {
+    ulong ele_idx = fd_funk_rec_map_private_unbox_idx( cur );
+    if( fd_funk_rec_map_private_is_null( ele_idx ) ) return NULL;
+    fd_funk_rec_t * ele = rec_map + ele_idx;
+    if( FD_LIKELY( hash==ele->map_hash ) && FD_LIKELY( fd_funk_xid_key_pair_eq( pair, &ele->pair ) ) ) return ele;
+    cur = ele->map_next;
+  }
+}
+
+fd_funk_rec_t *
+fd_funk_rec_write_prepare_concur( fd_funk_t *               funk,
+                                  fd_funk_txn_t *           txn,
+                                  fd_funk_rec_key_t const * key,
+                                  ulong                     min_val_size,
+                                  int                       do_create,
+                                  fd_funk_rec_t const *     irec,
+                                  int *                     opt_err ) {
+
+  if( FD_UNLIKELY( (!funk) | (!key) ) ) {
+    fd_int_store_if( !!opt_err, opt_err, FD_FUNK_ERR_INVAL );
+    return NULL;
+  }
+  fd_funk_check_write( funk );
+
+  fd_wksp_t *     wksp    = fd_funk_wksp( funk );
+  fd_funk_txn_t * txn_map = fd_funk_txn_map( funk, wksp );
+  fd_funk_rec_t * rec_map = fd_funk_rec_map( funk, wksp );
+  ulong           rec_max = funk->rec_max;
+
+  /* Validate the destination transaction.  The transaction map cannot
+     change under us as per the concurrency contract. */
+
+  ulong   txn_idx;
+  ulong * _rec_head_idx;
+  ulong * _rec_tail_idx;
+
+  if( !txn ) {
+    if( FD_UNLIKELY( fd_funk_last_publish_is_frozen( funk ) ) ) {
+      fd_int_store_if( !!opt_err, opt_err, FD_FUNK_ERR_FROZEN );
+      return NULL;
+    }
+    txn_idx       = FD_FUNK_TXN_IDX_NULL;
+    _rec_head_idx = &funk->rec_head_idx;
+    _rec_tail_idx = &funk->rec_tail_idx;
+  } else {
+    txn_idx = (ulong)(txn - txn_map);
+    if( FD_UNLIKELY( (txn_idx>=funk->txn_max) /* Out of map (incl NULL) */ | (txn!=(txn_map+txn_idx)) /* Bad alignment */ ) ) {
+      fd_int_store_if( !!opt_err, opt_err, FD_FUNK_ERR_INVAL );
+      return NULL;
+    }
+    if( FD_UNLIKELY( fd_funk_txn_is_frozen( txn ) ) ) {
+      fd_int_store_if( !!opt_err, opt_err, FD_FUNK_ERR_FROZEN );
+      return NULL;
+    }
+    _rec_head_idx = &txn->rec_head_idx;
+    _rec_tail_idx = &txn->rec_tail_idx;
+  }
+
+  fd_funk_xid_key_pair_t pair[1];
+  fd_funk_xid_key_pair_init( pair, txn ? fd_funk_txn_xid( txn ) : fd_funk_root( funk ), key );
+
+  /* All incarnations of key live in the same hash chain (see
+     fd_funk_xid_key_pair_hash), so holding the chain's lock makes the
+     query, insert and value copy below atomic with respect to other
+     concurrent writers of key. */
+
+  fd_funk_rec_map_private_t * priv = fd_funk_rec_map_private( rec_map );
+  ulong   hash     = fd_funk_rec_key_hash( key, priv->seed );
+  ulong   list_idx = hash & (priv->list_cnt-1UL);
+  ulong * head     = fd_funk_rec_map_private_list( priv ) + list_idx;
+
+  volatile ulong * pool_lock  = &funk->rec_pool_lock;
+  volatile ulong * chain_lock = fd_funk_rec_shard_lock( funk, hash );
+
+  fd_funk_rec_lock_acquire( chain_lock );
+
+  fd_funk_rec_t * rec = fd_funk_rec_chain_query( rec_map, head, hash, pair );
+
+  if( rec ) {
+
+    /* Case 1: key is already in txn.  If it is a tombstone, it is
+       revived empty (matching fd_funk_rec_insert). */
+
+    if( FD_UNLIKELY( (rec->flags & FD_FUNK_REC_FLAG_ERASE) && !do_create ) ) {
+      fd_funk_rec_lock_release( chain_lock );
+      fd_int_store_if( !!opt_err, opt_err, FD_FUNK_ERR_KEY );
+      return NULL;
+    }
+
+    if( FD_UNLIKELY( rec->flags & FD_FUNK_REC_FLAG_COLD ) ) fd_funk_cold_fault_private( funk, rec );
+
+  } else {
+
+    fd_funk_rec_t const * rec_con = irec ? irec : fd_funk_rec_query_global_private( funk, txn, key, NULL );
+    if( rec_con && (rec_con->flags & FD_FUNK_REC_FLAG_ERASE) ) rec_con = NULL;
+
+    if( FD_UNLIKELY( !rec_con && !do_create ) ) {
+      fd_funk_rec_lock_release( chain_lock );
+      fd_int_store_if( !!opt_err, opt_err, FD_FUNK_ERR_KEY );
+      return NULL;
+    }
+
+    /* Cases 2 and 3: allocate a record from the map pool and link it
+       to the end of txn's record list.  This is the only part where
+       writers on different shards contend. */
+
+    if( chain_lock!=pool_lock ) fd_funk_rec_lock_acquire( pool_lock );
+
+    if( FD_UNLIKELY( fd_funk_rec_map_is_full( rec_map ) ) ) {
+      if( chain_lock!=pool_lock ) fd_funk_rec_lock_release( pool_lock );
+      fd_funk_rec_lock_release( chain_lock );
+      fd_int_store_if( !!opt_err, opt_err, FD_FUNK_ERR_REC );
+      return NULL;
+    }
+
+    rec = fd_funk_rec_map_pop_free_ele( rec_map );
+    priv->key_cnt++;
+
+    ulong rec_idx = (ulong)(rec - rec_map);
+    if( FD_UNLIKELY( rec_idx>=rec_max ) ) FD_LOG_CRIT(( "memory corruption detected (bad idx)" ));
+
+    ulong rec_prev_idx = *_rec_tail_idx;
+    int   first_born   = fd_funk_rec_idx_is_null( rec_prev_idx );
+    if( FD_UNLIKELY( !first_born ) ) {
+      if( FD_UNLIKELY( rec_prev_idx>=rec_max ) )
+        FD_LOG_CRIT(( "memory corruption detected (bad_idx)" ));
+      if( FD_UNLIKELY( fd_funk_txn_idx( rec_map[ rec_prev_idx ].txn_cidx )!=txn_idx ) )
+        FD_LOG_CRIT(( "memory corruption detected (mismatch)" ));
+    }
+
+    rec->prev_idx = rec_prev_idx;
+    rec->next_idx = FD_FUNK_REC_IDX_NULL;
+    rec->txn_cidx = fd_funk_txn_cidx( txn_idx );
+    rec->tag      = 0U;
+    rec->flags    = fd_funk_txn_idx_is_null( txn_idx ) ? FD_FUNK_REC_FLAG_DIRTY : 0UL;
+    rec->touch    = (uint)funk->cold_clock;
+    rec->cold_off = 0UL;
+    rec->cold_sz  = 0U;
+    fd_funk_val_init( rec );
+    fd_funk_part_init( rec );
+
+    if( first_born ) *_rec_head_idx                   = rec_idx;
+    else             rec_map[ rec_prev_idx ].next_idx = rec_idx;
+    *_rec_tail_idx = rec_idx;
+
+    if( chain_lock!=pool_lock ) fd_funk_rec_lock_release( pool_lock );
+
+    /* Publish the record at the head of its chain (newest first, as
+       required by fd_funk_rec_query_global).  The record is fully
+       formed before it becomes visible to lockless readers. */
+
+    fd_funk_xid_key_pair_copy( &rec->pair, pair );
+    rec->map_hash = hash;
+    rec->map_next = fd_funk_rec_map_private_box_next( fd_funk_rec_map_private_unbox_idx( *head ), 0 );
+    FD_COMPILER_MFENCE();
+    FD_VOLATILE( *head ) = fd_funk_rec_map_private_box_next( rec_idx, 0 );
+    FD_COMPILER_MFENCE();
+
+    if( rec_con ) {
+      int           con_cold = !!(rec_con->flags & FD_FUNK_REC_FLAG_COLD);
+      uchar const * con_val  = con_cold ? fd_funk_cold_val_const( funk, rec_con ) : (uchar const *)fd_funk_val_const( rec_con, wksp );
+      ulong         con_sz   = con_cold ? (ulong)rec_con->cold_sz : fd_funk_val_sz( rec_con );
+      rec = fd_funk_val_copy( rec, con_val, con_sz, fd_ulong_max( con_sz, min_val_size ), fd_funk_alloc( funk, wksp ), wksp, opt_err );
+      if( FD_UNLIKELY( !rec ) ) {
+        fd_funk_rec_lock_release( chain_lock );
+        return NULL;
+      }
+    }
+
+  }
+
+  /* Grow the record to the right size */
+
+  rec->flags &= ~FD_FUNK_REC_FLAG_ERASE;
+  if( fd_funk_txn_idx_is_null( txn_idx ) ) rec->flags |= FD_FUNK_REC_FLAG_DIRTY;
+  rec->touch  = (uint)funk->cold_clock;
+  if( fd_funk_val_sz( rec ) < min_val_size ) {
+    rec = fd_funk_val_truncate( rec, min_val_size, fd_funk_alloc( funk, wksp ), wksp, opt_err );
+  } else {
+    fd_int_store_if( !!opt_err, opt_err, FD_FUNK_SUCCESS );
+  }
+
+  fd_funk_rec_lock_release( chain_lock );
+  return rec;
+}
+
 int
 fd_funk_rec_verify( fd_funk_t * funk ) {
   fd_wksp_t *     wksp    = fd_funk_wksp( funk );          /* Previously verified */
@@ -659,7 +939,7 @@ fd_funk_rec_verify( fd_funk_t * funk ) {
       TEST( (rec_idx<rec_max) && (fd_funk_txn_idx( rec_map[ rec_idx ].txn_cidx )==txn_idx) && rec_map[ rec_idx ].tag==0U );
       rec_map[ rec_idx ].tag = 1U;
       cnt++;
-      fd_funk_rec_t const * rec2 = fd_funk_rec_query_global( funk, NULL, rec_map[ rec_idx ].pair.key, NULL );
+      fd_funk_rec_t const * rec2 = fd_funk_rec_query_global_private( funk, NULL, rec_map[ rec_idx ].pair.key, NULL );
       if( FD_UNLIKELY( rec_map[ rec_idx ].flags & FD_FUNK_REC_FLAG_ERASE ) )
         TEST( rec2 == NULL );
       else
@@ -679,7 +959,7 @@ fd_funk_rec_verify( fd_funk_t * funk ) {
         TEST( (rec_idx<rec_max) && (fd_funk_txn_idx( rec_map[ rec_idx ].txn_cidx )==txn_idx) && rec_map[ rec_idx ].tag==0U );
         rec_map[ rec_idx ].tag = 1U;
         cnt++;
-        fd_funk_rec_t const * rec2 = fd_funk_rec_query_global( funk, txn, rec_map[ rec_idx ].pair.key, NULL );
+        fd_funk_rec_t const * rec2 = fd_funk_rec_query_global_private( funk, txn, rec_map[ rec_idx ].pair.key, NULL );
         if( FD_UNLIKELY( rec_map[ rec_idx ].flags & FD_FUNK_REC_FLAG_ERASE ) )
           TEST( rec2 == NULL );
         else
@@ -20,9 +20,23 @@
    - ERASE indicates a record in an in-preparation transaction should be
    erased if and when the in-preparation transaction is published. If
    set on a published record, it serves as a tombstone.
-   If set, there will be no value resources used by this record. */
+   If set, there will be no value resources used by this record.
+
+   - COLD indicates a published record whose value has been evicted
+   from the wksp to the cold value log (see fd_funk_cold.h).  If set,
+   the record uses no wksp value resources (val_sz, val_max and
+   val_gaddr are 0) and the value is at cold_off / cold_sz in the log.
+   Queries fault the value back in transparently.
+
+   - DIRTY indicates a published record whose value, flags or partition
+   changed since the last funk checkpoint (see fd_funk_ckpt.h).  It is
+   set when a record is published, or when a published record is
+   inserted, modified, removed or repartitioned, and cleared when a
+   checkpoint is written. */
 
 #define FD_FUNK_REC_FLAG_ERASE (1UL<<0)
+#define FD_FUNK_REC_FLAG_COLD  (1UL<<1)
+#define FD_FUNK_REC_FLAG_DIRTY (1UL<<2)
 
 /* FD_FUNK_REC_IDX_NULL gives the map record idx value used to represent
    NULL.  This value also set a limit on how large rec_max can be. */
@@ -33,6 +47,20 @@
    in a partition */
 #define FD_FUNK_PART_NULL (UINT_MAX)
 
+/* FD_FUNK_REC_LOCK_CNT gives the number of spin locks over which the
+   record map hash chains are sharded for concurrent writers.  Must be a
+   power of 2.  Each lock gets its own cache line to avoid false sharing
+   between writers on different shards. */
+
+#define FD_FUNK_REC_LOCK_CNT   (1024UL)
+#define FD_FUNK_REC_LOCK_ALIGN (128UL)
+
+struct __attribute__((aligned(FD_FUNK_REC_LOCK_ALIGN))) fd_funk_rec_lock {
+  volatile ulong lock; /* 0 if unlocked, 1 if locked */
+};
+
+typedef struct fd_funk_rec_lock fd_funk_rec_lock_t;
+
 /* A fd_funk_rec_t describes a funk record. */
 
 struct __attribute__((aligned(FD_FUNK_REC_ALIGN))) fd_funk_rec {
@@ -65,9 +93,13 @@ struct __attribute__((aligned(FD_FUNK_REC_ALIGN))) fd_funk_rec {
   ulong next_part_idx;  /* Record map index of next record in partition chain */
   uint  part;           /* Partition number, FD_FUNK_PART_NULL if none */
 
-  /* Padding to FD_FUNK_REC_ALIGN here (TODO: consider using self index
-     in the structures to accelerate indexing computations if padding
-     permits as this structure is currently has 8 bytes of padding) */
+  /* These fields are managed by the cold storage tier (fd_funk_cold.h) */
+
+  uint  touch;          /* Low 32 bits of funk->cold_clock when the record was last written or faulted in */
+  ulong cold_off;       /* If FD_FUNK_REC_FLAG_COLD, byte offset of the value in the cold value log, 0 otherwise */
+  uint  cold_sz;        /* If FD_FUNK_REC_FLAG_COLD, byte size of the value in the cold value log, 0 otherwise */
+
+  /* Padding to FD_FUNK_REC_ALIGN here */
 };
 
 typedef struct fd_funk_rec fd_funk_rec_t;
@@ -151,9 +183,18 @@ FD_FN_PURE static inline int fd_funk_rec_is_full( fd_funk_rec_t const * map ) {
    Important safety tip!  This function can encounter records
    that have the ERASE flag set (i.e. are tombstones of erased
    records). fd_funk_rec_query will still return the record in this
-   case, and the application should check for the flag. */
+   case, and the application should check for the flag.
 
-FD_FN_PURE fd_funk_rec_t const *
+   If funk has a cold tier (fd_funk_cold.h) and the returned record was
+   evicted, its value is faulted back into the wksp before returning.
+   Hence this is not a pure function: it may allocate from the funk's
+   allocator and modify the record's value metadata.  The fault is
+   serialized by the record's lock shard (fd_funk_rec_shard_lock), so
+   concurrent queries of published records (e.g. from transaction
+   execution threads) are safe.  It must not run concurrently with
+   fd_funk_cold_evict or fd_funk_cold_compact. */
+
+fd_funk_rec_t const *
 fd_funk_rec_query( fd_funk_t *               funk,
                    fd_funk_txn_t const *     txn,
                    fd_funk_rec_key_t const * key );
@@ -172,13 +213,30 @@ fd_funk_rec_query( fd_funk_t *               funk,
    that have the ERASE flag set (i.e. are tombstones of erased
    records). fd_funk_rec_query_global will return a NULL in this case
    but still set *txn_out to the relevant transaction. This behavior
-   differs from fd_funk_rec_query. */
-FD_FN_PURE fd_funk_rec_t const *
+   differs from fd_funk_rec_query.
+
+   Faults in cold values like fd_funk_rec_query. */
+
+fd_funk_rec_t const *
 fd_funk_rec_query_global( fd_funk_t *               funk,
                           fd_funk_txn_t const *     txn,
                           fd_funk_rec_key_t const * key,
                           fd_funk_txn_t const **    txn_out );
 
+/* fd_funk_rec_query_global_concur is the same as
+   fd_funk_rec_query_global but is safe to call concurrently with
+   fd_funk_rec_write_prepare_concur (under the same concurrency
+   contract): the lookup (and the fault of a cold value) is done while
+   holding the lock of key's record lock shard.  The value of the
+   returned record is only stable if no other thread writes key
+   concurrently. */
+
+fd_funk_rec_t const *
+fd_funk_rec_query_global_concur( fd_funk_t *               funk,
+                                 fd_funk_txn_t const *     txn,
+                                 fd_funk_rec_key_t const * key,
+                                 fd_funk_txn_t const **    txn_out );
+
 /* fd_funk_rec_query_safe is a query that is safe in the presence of
    concurrent writes. The result data is copied into a buffer
    allocated by the given valloc and should be freed with the same
@@ -502,6 +560,64 @@ fd_funk_rec_write_prepare( fd_funk_t *               funk,         /* Funky data
                            fd_funk_rec_t const *     irec,         /* Prior result of fd_funk_rec_query_global if known */
                            int *                     opt_err );    /* Optional error code return */
 
+/* fd_funk_rec_write_prepare_concur is the same as
+   fd_funk_rec_write_prepare but is safe to call from multiple threads
+   concurrently, including on the same in-preparation transaction (e.g.
+   the workers of a tpool finalizing the transactions of a block).
+
+   The caller's thread group must be inside a fd_funk_start_write /
+   fd_funk_end_write block for the duration of all concurrent calls and
+   no other funk mutation (transaction prepare / publish / cancel,
+   record insert / remove / forget, etc) can run at the same time.
+   Record queries by other threads stay safe as new records are
+   published atomically at the head of their hash chain and existing
+   chains are never reordered by this function.
+
+   Writers of different record keys only contend if the keys hash to
+   the same record lock shard (see FD_FUNK_REC_LOCK_CNT) and, briefly,
+   when a new record gets linked into the record map.  Writers of the
+   same record key in the same transaction are serialized and will get
+   the same record back but the caller is responsible for coordinating
+   the subsequent modifications of that record's value.  Record value
+   resizing uses the funk alloc, which supports concurrent use. */
+
+fd_funk_rec_t *
+fd_funk_rec_write_prepare_concur( fd_funk_t *               funk,
+                                  fd_funk_txn_t *           txn,
+                                  fd_funk_rec_key_t const * key,
+                                  ulong                     min_val_size,
+                                  int                       do_create,
+                                  fd_funk_rec_t const *     irec,
+                                  int *                     opt_err );
+
+/* fd_funk_rec_shard_lock returns the spin lock that covers the record
+   map hash chain of records whose key hash is hash (i.e.
+   rec->map_hash).  fd_funk_rec_lock_{acquire,release} acquire /
+   release such a lock.  Internal use only. */
+
+volatile ulong *
+fd_funk_rec_shard_lock( fd_funk_t * funk,
+                        ulong       hash );
+
+static inline void
+fd_funk_rec_lock_acquire( volatile ulong * lock ) {
+# if FD_HAS_ATOMIC
+  for(;;) {
+    if( FD_LIKELY( !*lock ) && FD_LIKELY( !FD_ATOMIC_CAS( lock, 0UL, 1UL ) ) ) break;
+    FD_SPIN_PAUSE();
+  }
+# else
+  *lock = 1UL;
+# endif
+  FD_COMPILER_MFENCE();
+}
+
+static inline void
+fd_funk_rec_lock_release( volatile ulong * lock ) {
+  FD_COMPILER_MFENCE();
+  *lock = 0UL;
+}
+
 /* Misc */
 
 /* fd_funk_rec_verify verifies the record map.  Returns FD_FUNK_SUCCESS
@@ -582,6 +582,7 @@ fd_funk_txn_update( ulong *                   _dst_rec_head_idx, /* Pointer to t
 
     rec->pair.xid[0] = *dst_xid;
     rec->txn_cidx = fd_funk_txn_cidx( dst_txn_idx );
+    if( fd_funk_txn_idx_is_null( dst_txn_idx ) ) rec->flags |= FD_FUNK_REC_FLAG_DIRTY; /* Published, see fd_funk_ckpt.h */
 
     if( fd_funk_rec_idx_is_null( *_dst_rec_head_idx ) ) {
       *_dst_rec_head_idx = rec_idx;
@@ -1,4 +1,5 @@
 #include "fd_funk.h"
+#include "fd_funk_cold.h" /* For FD_FUNK_COLD_HDR_SZ */
 
 fd_funk_rec_t *
 fd_funk_val_copy( fd_funk_rec_t * rec,
@@ -308,9 +309,18 @@ fd_funk_val_verify( fd_funk_t * funk ) {
 
     TEST( val_sz<=val_max );
 
+    if( rec->flags & FD_FUNK_REC_FLAG_DIRTY ) TEST( fd_funk_txn_idx_is_null( fd_funk_txn_idx( rec->txn_cidx ) ) );
+
     if( rec->flags & FD_FUNK_REC_FLAG_ERASE ) {
       TEST( !val_max   );
       TEST( !val_gaddr );
+      TEST( !(rec->flags & FD_FUNK_REC_FLAG_COLD) );
+    } else if( rec->flags & FD_FUNK_REC_FLAG_COLD ) {
+      TEST( !val_max   );
+      TEST( !val_gaddr );
+      TEST( rec->cold_sz );
+      TEST( rec->cold_off>=FD_FUNK_COLD_HDR_SZ );
+      TEST( fd_funk_txn_idx_is_null( fd_funk_txn_idx( rec->txn_cidx ) ) );
     } else {
       TEST( val_max<=FD_FUNK_REC_VAL_MAX );
       if( !val_gaddr ) TEST( !val_max );
@@ -0,0 +1,286 @@
+#include "fd_funk_ckpt.h"
+#include "fd_funk_filemap.h"
+
+#if FD_HAS_HOSTED
+
+#include <stdio.h>
+#include <unistd.h>
+
+static fd_funk_rec_key_t *
+make_key( fd_funk_rec_key_t * key,
+          ulong               k ) {
+  memset( key, 0, sizeof(fd_funk_rec_key_t) );
+  key->ul[0] = k;
+  return key;
+}
+
+static fd_funk_t *
+make_funk( fd_wksp_t * wksp,
+           ulong       wksp_tag,
+           ulong       seed,
+           ulong       txn_max,
+           ulong       rec_max ) {
+  fd_funk_t * funk = fd_funk_join( fd_funk_new( fd_wksp_alloc_laddr( wksp, fd_funk_align(), fd_funk_footprint(), wksp_tag ),
+                                                wksp_tag, seed, txn_max, rec_max ) );
+  if( FD_UNLIKELY( !funk ) ) FD_LOG_ERR(( "Unable to create funk" ));
+  return funk;
+}
+
+/* apply_slot publishes a transaction with random updates to the
+   records with keys in [0,key_max) */
+
+static void
+apply_slot( fd_funk_t * funk,
+            fd_rng_t *  rng,
+            ulong       slot,
+            ulong       key_max,
+            ulong       upd_cnt ) {
+  fd_wksp_t *  wksp  = fd_funk_wksp( funk );
+  fd_alloc_t * alloc = fd_funk_alloc( funk, wksp );
+
+  fd_funk_txn_xid_t xid[1] = {{ .ul = { slot, slot } }};
+  fd_funk_txn_t * txn = fd_funk_txn_prepare( funk, NULL, xid, 0 );
+  FD_TEST( txn );
+
+  fd_funk_rec_key_t key[1];
+  for( ulong i=0UL; i<upd_cnt; i++ ) {
+    ulong k = fd_rng_ulong_roll( rng, key_max );
+    uint  r = fd_rng_uint_roll( rng, 8U );
+    if( !r ) {
+      fd_funk_rec_t const * rec = fd_funk_rec_query_global( funk, txn, make_key( key, k ), NULL );
+      if( rec ) {
+        fd_funk_rec_t * mrec = fd_funk_rec_write_prepare( funk, txn, key, 0UL, 0, NULL, NULL );
+        FD_TEST( mrec );
+        FD_TEST( !fd_funk_rec_remove( funk, mrec, slot ) );
+      }
+    } else {
+      ulong sz = fd_rng_ulong_roll( rng, 200UL );
+      if( FD_UNLIKELY( !fd_rng_uint_roll( rng, 64U ) ) ) sz = FD_FUNK_CKPT_CHUNK_MAX + fd_rng_ulong_roll( rng, FD_FUNK_CKPT_CHUNK_MAX/2UL ); /* Own chunk */
+      int err;
+      fd_funk_rec_t * rec = fd_funk_rec_write_prepare( funk, txn, make_key( key, k ), 0UL, 1, NULL, &err );
+      FD_TEST( rec );
+      rec = fd_funk_val_truncate( rec, sz, alloc, wksp, &err );
+      FD_TEST( rec );
+      uchar * val = (uchar *)fd_funk_val( rec, wksp );
+      for( ulong j=0UL; j<sz; j++ ) val[j] = (uchar)fd_ulong_hash( k ^ slot ^ j );
+    }
+  }
+
+  FD_TEST( fd_funk_txn_publish( funk, txn, 0 )==1UL );
+}
+
+/* funk_eq tests that the published records of a and b match */
+
+static void
+funk_eq( fd_funk_t * a,
+         fd_funk_t * b ) {
+  fd_wksp_t *     wksp_a = fd_funk_wksp( a );
+  fd_wksp_t *     wksp_b = fd_funk_wksp( b );
+  fd_funk_rec_t * map_a  = fd_funk_rec_map( a, wksp_a );
+  fd_funk_rec_t * map_b  = fd_funk_rec_map( b, wksp_b );
+
+  FD_TEST( fd_funk_txn_xid_eq( fd_funk_last_publish( a ), fd_funk_last_publish( b ) ) );
+
+  ulong cnt_a = 0UL;
+  for( ulong rec_idx = a->rec_head_idx; !fd_funk_rec_idx_is_null( rec_idx ); rec_idx = map_a[ rec_idx ].next_idx ) {
+    fd_funk_rec_t const * ra = map_a + rec_idx;
+    fd_funk_xid_key_pair_t pair[1]; fd_funk_xid_key_pair_init( pair, fd_funk_root( b ), ra->pair.key );
+    fd_funk_rec_t const * rb = fd_funk_rec_map_query_const( map_b, pair, NULL );
+    FD_TEST( rb );
+    FD_TEST( (ra->flags & ~FD_FUNK_REC_FLAG_DIRTY)==(rb->flags & ~FD_FUNK_REC_FLAG_DIRTY) );
+    FD_TEST( ra->part==rb->part );
+    FD_TEST( fd_funk_val_sz( ra )==fd_funk_val_sz( rb ) );
+    FD_TEST( !memcmp( fd_funk_val_const( ra, wksp_a ), fd_funk_val_const( rb, wksp_b ), fd_funk_val_sz( ra ) ) );
+    cnt_a++;
+  }
+
+  ulong cnt_b = 0UL;
+  for( ulong rec_idx = b->rec_head_idx; !fd_funk_rec_idx_is_null( rec_idx ); rec_idx = map_b[ rec_idx ].next_idx ) cnt_b++;
+  FD_TEST( cnt_a==cnt_b );
+}
+
+static uint
+part_cb( fd_funk_rec_t * rec,
+         uint            num_part,
+         void *          cb_arg ) {
+  (void)cb_arg;
+  return (uint)( rec->pair.key->ul[0] % (ulong)num_part );
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  char const * name     = fd_env_strip_cmdline_cstr ( &argc, &argv, "--wksp",     NULL,                 NULL );
+  char const * _page_sz = fd_env_strip_cmdline_cstr ( &argc, &argv, "--page-sz",  NULL,           "gigantic" );
+  ulong        page_cnt = fd_env_strip_cmdline_ulong( &argc, &argv, "--page-cnt", NULL,                  1UL );
+  ulong        near_cpu = fd_env_strip_cmdline_ulong( &argc, &argv, "--near-cpu", NULL,      fd_log_cpu_id() );
+  ulong        wksp_tag = fd_env_strip_cmdline_ulong( &argc, &argv, "--wksp-tag", NULL,               1234UL );
+  ulong        seed     = fd_env_strip_cmdline_ulong( &argc, &argv, "--seed",     NULL,               5678UL );
+  ulong        rec_max  = fd_env_strip_cmdline_ulong( &argc, &argv, "--rec-max",  NULL,              16384UL );
+  ulong        key_max  = fd_env_strip_cmdline_ulong( &argc, &argv, "--key-max",  NULL,               4096UL );
+  ulong        slot_cnt = fd_env_strip_cmdline_ulong( &argc, &argv, "--slot-cnt", NULL,                 64UL );
+  char const * path     = fd_env_strip_cmdline_cstr ( &argc, &argv, "--path",     NULL, "/tmp/test_funk_ckpt" );
+
+  fd_rng_t _rng[1]; fd_rng_t * rng = fd_rng_join( fd_rng_new( _rng, 0U, 0UL ) );
+
+  fd_wksp_t * wksp;
+  if( name ) {
+    FD_LOG_NOTICE(( "Attaching to --wksp %s", name ));
+    wksp = fd_wksp_attach( name );
+  } else {
+    FD_LOG_NOTICE(( "--wksp not specified, using an anonymous local workspace, --page-sz %s, --page-cnt %lu, --near-cpu %lu",
+                    _page_sz, page_cnt, near_cpu ));
+    wksp = fd_wksp_new_anonymous( fd_cstr_to_shmem_page_sz( _page_sz ), page_cnt, near_cpu, "wksp", 0UL );
+  }
+
+  if( FD_UNLIKELY( !wksp ) ) FD_LOG_ERR(( "Unable to attach to wksp" ));
+
+  FD_LOG_NOTICE(( "Testing with --wksp-tag %lu --seed %lu --rec-max %lu --key-max %lu --slot-cnt %lu --path %s",
+                  wksp_tag, seed, rec_max, key_max, slot_cnt, path ));
+
+  static uchar tpool_mem[ FD_TPOOL_FOOTPRINT(FD_TILE_MAX) ] __attribute__((aligned(FD_TPOOL_ALIGN)));
+  ulong        tile_cnt = fd_tile_cnt();
+  fd_tpool_t * tpool    = fd_tpool_init( tpool_mem, tile_cnt ); FD_TEST( tpool );
+  for( ulong tile_idx=1UL; tile_idx<tile_cnt; tile_idx++ ) FD_TEST( fd_tpool_worker_push( tpool, tile_idx, NULL, 0UL )==tpool );
+
+  fd_funk_t * funk = make_funk( wksp, wksp_tag, seed, 4UL, rec_max );
+  fd_funk_start_write( funk );
+
+  ulong ckpt_cnt = slot_cnt/8UL + 1UL;
+  char  ckpt_path[ 65 ][ PATH_MAX ];
+  char const * ckpt_path_ptr[ 65 ];
+  FD_TEST( ckpt_cnt<=64UL );
+  for( ulong i=0UL; i<=ckpt_cnt; i++ ) {
+    FD_TEST( fd_funk_ckpt_chain_path( ckpt_path[i], PATH_MAX, path, i+1UL )==ckpt_path[i] );
+    ckpt_path_ptr[i] = ckpt_path[i];
+  }
+  FD_TEST( !strcmp( ckpt_path[0], path ) );
+  FD_TEST( !fd_funk_ckpt_chain_path( ckpt_path[64], 4UL, path, 2UL ) );
+
+  FD_TEST( fd_funk_ckpt_write( funk, ckpt_path[0], 1, NULL )==FD_FUNK_ERR_INVAL ); /* No base */
+
+  /* Base, then an incremental checkpoint every 8 slots.  Repartition
+     half way through. */
+
+  ulong slot = 1UL;
+  for( ulong i=0UL; i<8UL; i++ ) apply_slot( funk, rng, slot++, key_max, 256UL );
+  ulong full_cnt;
+  FD_TEST( !fd_funk_ckpt_write( funk, ckpt_path[0], 0, &full_cnt ) );
+  FD_TEST( fd_funk_ckpt_seq( funk )==1UL );
+  FD_TEST( !fd_funk_verify( funk ) );
+
+  for( ulong c=1UL; c<ckpt_cnt; c++ ) {
+    for( ulong i=0UL; i<8UL; i++ ) apply_slot( funk, rng, slot++, key_max, 16UL );
+    if( c==ckpt_cnt/2UL ) fd_funk_repartition( funk, 7U, part_cb, NULL );
+    ulong incr_cnt;
+    FD_TEST( !fd_funk_ckpt_write( funk, ckpt_path[c], 1, &incr_cnt ) );
+    FD_TEST( fd_funk_ckpt_seq( funk )==c+1UL );
+    if( c!=ckpt_cnt/2UL ) FD_TEST( incr_cnt<=8UL*16UL && incr_cnt<full_cnt );
+    FD_TEST( !fd_funk_verify( funk ) );
+  }
+
+  /* Nothing is dirty right after a checkpoint */
+
+  fd_wksp_t *     _wksp   = fd_funk_wksp( funk );
+  fd_funk_rec_t * rec_map = fd_funk_rec_map( funk, _wksp );
+  for( ulong rec_idx = funk->rec_head_idx; !fd_funk_rec_idx_is_null( rec_idx ); rec_idx = rec_map[ rec_idx ].next_idx )
+    FD_TEST( !(rec_map[ rec_idx ].flags & FD_FUNK_REC_FLAG_DIRTY) );
+
+  fd_funk_end_write( funk ); /* Write blocks are process wide */
+
+  /* Restore the whole chain in parallel */
+
+  fd_funk_t * copy = make_funk( wksp, wksp_tag+1UL, seed, 4UL, rec_max );
+  fd_funk_start_write( copy );
+  FD_TEST( fd_funk_ckpt_restore( copy, ckpt_path_ptr+1, ckpt_cnt-1UL, tpool, 0UL, tile_cnt )==FD_FUNK_ERR_INVAL ); /* Missing base */
+  FD_TEST( !fd_funk_ckpt_restore( copy, ckpt_path_ptr, ckpt_cnt, tpool, 0UL, tile_cnt ) );
+  FD_TEST( fd_funk_ckpt_seq( copy )==ckpt_cnt );
+  FD_TEST( !fd_funk_verify( copy ) );
+  funk_eq( funk, copy );
+  FD_TEST( fd_funk_ckpt_restore( copy, ckpt_path_ptr, 1UL, NULL, 0UL, 1UL )==FD_FUNK_ERR_INVAL ); /* Base on non-empty funk */
+  fd_funk_end_write( copy );
+  fd_wksp_free_laddr( fd_funk_delete( fd_funk_leave( copy ) ) );
+
+  /* Restore the base, then the increments one at a time, single
+     threaded, and continue the chain from the restored funk */
+
+  copy = make_funk( wksp, wksp_tag+1UL, seed, 4UL, rec_max );
+  fd_funk_start_write( copy );
+  FD_TEST( !fd_funk_ckpt_restore( copy, ckpt_path_ptr, 1UL, NULL, 0UL, 1UL ) );
+  if( ckpt_cnt>2UL ) FD_TEST( fd_funk_ckpt_restore( copy, ckpt_path_ptr+2, 1UL, NULL, 0UL, 1UL )==FD_FUNK_ERR_INVAL ); /* Gap */
+  for( ulong c=1UL; c<ckpt_cnt; c++ ) FD_TEST( !fd_funk_ckpt_restore( copy, ckpt_path_ptr+c, 1UL, NULL, 0UL, 1UL ) );
+  funk_eq( funk, copy );
+
+  fd_rng_t _rng_a[1]; fd_rng_t * rng_a = fd_rng_join( fd_rng_new( _rng_a, 1U, 0UL ) ); /* Same updates on both */
+  fd_rng_t _rng_b[1]; fd_rng_t * rng_b = fd_rng_join( fd_rng_new( _rng_b, 1U, 0UL ) );
+  ulong incr_cnt_a;
+  ulong incr_cnt_b;
+  apply_slot( copy, rng_b, slot, key_max, 16UL );
+  FD_TEST( !fd_funk_ckpt_write( copy, ckpt_path[ ckpt_cnt ], 1, &incr_cnt_b ) );
+  fd_funk_end_write( copy );
+  fd_funk_start_write( funk );
+  apply_slot( funk, rng_a, slot, key_max, 16UL );
+  FD_TEST( !fd_funk_ckpt_write( funk, ckpt_path[ ckpt_cnt ], 1, &incr_cnt_a ) );
+  fd_funk_end_write( funk );
+  FD_TEST( incr_cnt_a==incr_cnt_b );
+  FD_TEST( fd_funk_ckpt_seq( funk )==ckpt_cnt+1UL && fd_funk_ckpt_seq( copy )==ckpt_cnt+1UL );
+  funk_eq( funk, copy );
+
+  fd_wksp_free_laddr( fd_funk_delete( fd_funk_leave( copy ) ) );
+
+  /* Recover a funk with the same geometry from the chain on disk */
+
+  fd_funk_close_file_args_t close_args[1];
+  copy = fd_funk_recover_checkpoint( NULL, wksp_tag, path, tpool, 0UL, tile_cnt, close_args );
+  FD_TEST( copy );
+  FD_TEST( copy->rec_max==funk->rec_max && copy->txn_max==funk->txn_max );
+  FD_TEST( fd_funk_ckpt_seq( copy )==ckpt_cnt+1UL );
+  FD_TEST( !fd_funk_verify( copy ) );
+  funk_eq( funk, copy );
+  fd_funk_close_file( close_args );
+  FD_TEST( !fd_funk_recover_checkpoint( NULL, wksp_tag, ckpt_path[1], NULL, 0UL, 1UL, NULL ) ); /* Not a full checkpoint */
+
+  /* Corruption is detected */
+
+  FILE * f = fopen( ckpt_path[0], "r+" );
+  FD_TEST( f );
+  FD_TEST( !fseek( f, 0L, SEEK_END ) );
+  FD_TEST( fputc( 0, f )==0 );
+  FD_TEST( !fclose( f ) );
+  copy = make_funk( wksp, wksp_tag+1UL, seed, 4UL, rec_max );
+  fd_funk_start_write( copy );
+  FD_TEST( fd_funk_ckpt_restore( copy, ckpt_path_ptr, 1UL, NULL, 0UL, 1UL )==FD_FUNK_ERR_INVAL );
+  fd_funk_end_write( copy );
+  fd_wksp_free_laddr( fd_funk_delete( fd_funk_leave( copy ) ) );
+
+  for( ulong i=0UL; i<=ckpt_cnt; i++ ) unlink( ckpt_path[i] );
+
+  fd_wksp_free_laddr( fd_funk_delete( fd_funk_leave( funk ) ) );
+
+  for( ulong tile_idx=1UL; tile_idx<tile_cnt; tile_idx++ ) FD_TEST( fd_tpool_worker_pop( tpool ) );
+  FD_TEST( fd_tpool_fini( tpool ) );
+
+  if( name ) fd_wksp_detach( wksp );
+  else       fd_wksp_delete_anonymous( wksp );
+
+  fd_rng_delete( fd_rng_leave( rng ) );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
+
+#else
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+  FD_LOG_WARNING(( "skip: unit test requires FD_HAS_HOSTED capabilities" ));
+  fd_halt();
+  return 0;
+}
+
+#endif
@@ -0,0 +1,255 @@
+#include "fd_funk_cold.h"
+
+#if FD_HAS_HOSTED
+
+#include <stdio.h>
+#include <unistd.h>
+
+static void
+fill_val( uchar * val,
+          ulong   sz,
+          ulong   key ) {
+  for( ulong i=0UL; i<sz; i++ ) val[i] = (uchar)fd_ulong_hash( key ^ i );
+}
+
+static int
+check_val( uchar const * val,
+           ulong         sz,
+           ulong         key ) {
+  for( ulong i=0UL; i<sz; i++ ) if( val[i]!=(uchar)fd_ulong_hash( key ^ i ) ) return 0;
+  return 1;
+}
+
+static fd_funk_rec_key_t *
+make_key( fd_funk_rec_key_t * key,
+          ulong               k ) {
+  memset( key, 0, sizeof(fd_funk_rec_key_t) );
+  key->ul[0] = k;
+  return key;
+}
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+
+  char const * name     = fd_env_strip_cmdline_cstr ( &argc, &argv, "--wksp",     NULL,                 NULL );
+  char const * _page_sz = fd_env_strip_cmdline_cstr ( &argc, &argv, "--page-sz",  NULL,           "gigantic" );
+  ulong        page_cnt = fd_env_strip_cmdline_ulong( &argc, &argv, "--page-cnt", NULL,                  1UL );
+  ulong        near_cpu = fd_env_strip_cmdline_ulong( &argc, &argv, "--near-cpu", NULL,      fd_log_cpu_id() );
+  ulong        wksp_tag = fd_env_strip_cmdline_ulong( &argc, &argv, "--wksp-tag", NULL,               1234UL );
+  ulong        seed     = fd_env_strip_cmdline_ulong( &argc, &argv, "--seed",     NULL,               5678UL );
+  ulong        txn_max  = fd_env_strip_cmdline_ulong( &argc, &argv, "--txn-max",  NULL,                 32UL );
+  ulong        rec_max  = fd_env_strip_cmdline_ulong( &argc, &argv, "--rec-max",  NULL,               1024UL );
+  ulong        rec_cnt  = fd_env_strip_cmdline_ulong( &argc, &argv, "--rec-cnt",  NULL,                512UL );
+  char const * path     = fd_env_strip_cmdline_cstr ( &argc, &argv, "--path",     NULL, "/tmp/test_funk_cold" );
+
+  FD_TEST( rec_cnt<=rec_max/2UL );
+
+  fd_wksp_t * wksp;
+  if( name ) {
+    FD_LOG_NOTICE(( "Attaching to --wksp %s", name ));
+    wksp = fd_wksp_attach( name );
+  } else {
+    FD_LOG_NOTICE(( "--wksp not specified, using an anonymous local workspace, --page-sz %s, --page-cnt %lu, --near-cpu %lu",
+                    _page_sz, page_cnt, near_cpu ));
+    wksp = fd_wksp_new_anonymous( fd_cstr_to_shmem_page_sz( _page_sz ), page_cnt, near_cpu, "wksp", 0UL );
+  }
+
+  if( FD_UNLIKELY( !wksp ) ) FD_LOG_ERR(( "Unable to attach to wksp" ));
+
+  FD_LOG_NOTICE(( "Testing with --wksp-tag %lu --seed %lu --txn-max %lu --rec-max %lu --rec-cnt %lu --path %s",
+                  wksp_tag, seed, txn_max, rec_max, rec_cnt, path ));
+
+  fd_funk_t * funk = fd_funk_join( fd_funk_new( fd_wksp_alloc_laddr( wksp, fd_funk_align(), fd_funk_footprint(), wksp_tag ),
+                                                wksp_tag, seed, txn_max, rec_max ) );
+  if( FD_UNLIKELY( !funk ) ) FD_LOG_ERR(( "Unable to create funk" ));
+
+  unlink( path );
+
+  fd_funk_start_write( funk );
+
+  FD_TEST( !fd_funk_cold_shmem( funk ) && !fd_funk_cold_join( funk ) && !fd_funk_cold_metrics( funk ) );
+  FD_TEST( !fd_funk_cold_evict( funk, 0UL ) );
+
+  FD_TEST( fd_funk_cold_open( funk, path, 1UL<<20 )==FD_FUNK_SUCCESS );
+  fd_funk_cold_shmem_t * shmem = fd_funk_cold_shmem( funk );
+  FD_TEST( shmem && shmem->map_sz>=(1UL<<20) && shmem->used_sz==FD_FUNK_COLD_HDR_SZ );
+  FD_TEST( fd_funk_cold_open( funk, path, 0UL )==FD_FUNK_ERR_INVAL ); /* Only one tier per funk */
+
+  fd_funk_cold_t * cold = fd_funk_cold_join( funk );
+  FD_TEST( cold && cold->funk==funk && cold->shmem==shmem && cold->map_sz==shmem->map_sz );
+  FD_TEST( fd_funk_cold_join( funk )==cold );
+
+  fd_alloc_t * alloc = fd_funk_alloc( funk, wksp );
+  uchar        buf[ 1024 ];
+  fd_funk_rec_key_t key[1];
+
+  /* Populate the root with records of varying sizes, the odd ones
+     written at a later clock */
+
+  for( ulong k=0UL; k<rec_cnt; k++ ) {
+    fd_funk_cold_clock_set( funk, 10UL + (k & 1UL)*10UL );
+    ulong sz = 1UL + (k % 1000UL);
+    int err;
+    fd_funk_rec_t * rec = fd_funk_rec_write_prepare( funk, NULL, make_key( key, k ), sz, 1, NULL, &err );
+    FD_TEST( rec && !err );
+    FD_TEST( rec->touch==(uint)fd_funk_cold_clock_get( funk ) );
+    fill_val( buf, sz, k );
+    FD_TEST( fd_funk_val_copy( rec, buf, sz, sz, alloc, wksp, &err ) && !err );
+  }
+
+  FD_TEST( !fd_funk_verify( funk ) );
+
+  /* Evict the records not written since clock 10 */
+
+  fd_funk_cold_clock_set( funk, 25UL );
+  FD_TEST( !fd_funk_cold_evict( funk, 100UL ) );
+  ulong even_cnt = (rec_cnt+1UL)/2UL;
+  FD_TEST( fd_funk_cold_evict( funk, 15UL )==even_cnt );
+  FD_TEST( !fd_funk_cold_evict( funk, 15UL ) ); /* Already cold */
+  FD_TEST( fd_funk_cold_metrics( funk )->evict_cnt==even_cnt );
+
+  FD_TEST( !fd_funk_verify( funk ) );
+
+  for( ulong k=0UL; k<rec_cnt; k++ ) {
+    fd_funk_rec_t const * rec = fd_funk_rec_query_global( funk, NULL, make_key( key, k ), NULL );
+    FD_TEST( rec );
+    /* Query faults the value back in transparently */
+    FD_TEST( !(rec->flags & FD_FUNK_REC_FLAG_COLD) );
+    FD_TEST( fd_funk_val_sz( rec )==1UL + (k % 1000UL) );
+    FD_TEST( check_val( fd_funk_val_const( rec, wksp ), fd_funk_val_sz( rec ), k ) );
+  }
+
+  FD_TEST( fd_funk_cold_metrics( funk )->fault_cnt ==even_cnt );
+  FD_TEST( fd_funk_cold_metrics( funk )->lookup_cnt==( FD_FUNK_COLD_LOOKUP_METRICS ? rec_cnt : 0UL ) );
+  FD_TEST( !fd_funk_verify( funk ) );
+
+  /* Evict everything again and copy cold values into a transaction
+     without faulting the published records in */
+
+  fd_funk_cold_clock_set( funk, 100UL );
+  FD_TEST( fd_funk_cold_evict( funk, 1UL )==rec_cnt );
+
+  fd_funk_txn_xid_t xid[1] = {{ .ul = { 1UL, 1UL } }};
+  fd_funk_txn_t * txn = fd_funk_txn_prepare( funk, NULL, xid, 0 );
+  FD_TEST( txn );
+
+  for( ulong k=0UL; k<rec_cnt; k+=2UL ) {
+    int err;
+    fd_funk_rec_t * rec = fd_funk_rec_write_prepare( funk, txn, make_key( key, k ), 0UL, 0, NULL, &err );
+    FD_TEST( rec && !err );
+    FD_TEST( fd_funk_val_sz( rec )==1UL + (k % 1000UL) );
+    FD_TEST( check_val( fd_funk_val_const( rec, wksp ), fd_funk_val_sz( rec ), k ) );
+  }
+
+  FD_TEST( !fd_funk_verify( funk ) );
+
+  /* Publishing supersedes the cold root records of the even keys,
+     compaction reclaims their log space */
+
+  FD_TEST( fd_funk_txn_publish( funk, txn, 0 )==1UL );
+  FD_TEST( !fd_funk_verify( funk ) );
+
+  ulong old_used_sz = shmem->used_sz;
+  ulong old_gen     = shmem->gen;
+  FD_TEST( !fd_funk_cold_compact( funk ) );
+  FD_TEST( shmem->used_sz<old_used_sz && shmem->gen!=old_gen );
+  FD_TEST( fd_funk_cold_join( funk )==cold && cold->gen==shmem->gen );
+  FD_TEST( fd_funk_cold_metrics( funk )->compact_cnt==1UL );
+  FD_TEST( !fd_funk_verify( funk ) );
+
+  for( ulong k=0UL; k<rec_cnt; k++ ) {
+    fd_funk_rec_t const * rec = fd_funk_rec_query( funk, NULL, make_key( key, k ) );
+    FD_TEST( rec && !(rec->flags & FD_FUNK_REC_FLAG_COLD) );
+    FD_TEST( fd_funk_val_sz( rec )==1UL + (k % 1000UL) );
+    FD_TEST( check_val( fd_funk_val_const( rec, wksp ), fd_funk_val_sz( rec ), k ) );
+  }
+
+  /* Removing a faulted in record */
+
+  FD_TEST( fd_funk_cold_evict( funk, 0UL )==rec_cnt );
+  fd_funk_rec_t * rec = (fd_funk_rec_t *)fd_funk_rec_query_global( funk, NULL, make_key( key, 0UL ), NULL );
+  FD_TEST( rec );
+  FD_TEST( !fd_funk_rec_remove( funk, rec, 1 ) );
+  FD_TEST( !fd_funk_verify( funk ) );
+
+  /* Walkers read cold values in place */
+
+  ulong fault_cnt = fd_funk_cold_metrics( funk )->fault_cnt;
+  for( ulong k=1UL; k<rec_cnt; k++ ) {
+    fd_funk_xid_key_pair_t pair[1]; fd_funk_xid_key_pair_init( pair, fd_funk_root( funk ), make_key( key, k ) );
+    fd_funk_rec_t const * rec = fd_funk_rec_map_query_const( fd_funk_rec_map( funk, wksp ), pair, NULL ); /* Does not fault */
+    FD_TEST( rec && (rec->flags & FD_FUNK_REC_FLAG_COLD) );
+    ulong         sz;
+    uchar const * val = fd_funk_cold_val_peek( funk, rec, wksp, &sz );
+    FD_TEST( sz==1UL + (k % 1000UL) && check_val( val, sz, k ) );
+    FD_TEST( rec->flags & FD_FUNK_REC_FLAG_COLD );
+  }
+  FD_TEST( fd_funk_cold_metrics( funk )->fault_cnt==fault_cnt );
+  FD_TEST( fd_funk_cold_metrics( funk )->peek_cnt==rec_cnt-1UL );
+
+  fd_funk_cold_log_metrics( funk );
+
+  /* A second funk in the same process gets its own tier (write blocks
+     cannot be nested across funks) */
+
+  fd_funk_end_write( funk );
+
+  char path2[ PATH_MAX ];
+  FD_TEST( fd_cstr_printf_check( path2, sizeof(path2), NULL, "%s.2", path ) );
+  unlink( path2 );
+  fd_funk_t * funk2 = fd_funk_join( fd_funk_new( fd_wksp_alloc_laddr( wksp, fd_funk_align(), fd_funk_footprint(), wksp_tag ),
+                                                 wksp_tag, seed+1UL, txn_max, rec_max ) );
+  FD_TEST( funk2 );
+  fd_funk_start_write( funk2 );
+  FD_TEST( fd_funk_cold_open( funk2, path2, 0UL )==FD_FUNK_SUCCESS );
+  fd_funk_cold_t * cold2 = fd_funk_cold_join( funk2 );
+  FD_TEST( cold2 && cold2!=cold && cold2->shmem!=shmem );
+  FD_TEST( fd_funk_cold_close( funk2 )==FD_FUNK_SUCCESS );
+  FD_TEST( !fd_funk_cold_join( funk2 ) );
+  fd_funk_end_write( funk2 );
+  fd_wksp_free_laddr( fd_funk_delete( fd_funk_leave( funk2 ) ) );
+  unlink( path2 );
+
+  fd_funk_start_write( funk );
+  FD_TEST( fd_funk_cold_join( funk )==cold );
+
+  /* Closing and reopening the tier keeps the cold values reachable */
+
+  FD_TEST( fd_funk_cold_close( funk )==FD_FUNK_SUCCESS );
+  FD_TEST( fd_funk_cold_close( funk )==FD_FUNK_ERR_INVAL );
+  FD_TEST( fd_funk_cold_open( funk, path, 0UL )==FD_FUNK_SUCCESS );
+  for( ulong k=1UL; k<rec_cnt; k++ ) {
+    fd_funk_rec_t const * rec = fd_funk_rec_query( funk, NULL, make_key( key, k ) );
+    FD_TEST( rec && !(rec->flags & FD_FUNK_REC_FLAG_COLD) );
+    FD_TEST( check_val( fd_funk_val_const( rec, wksp ), fd_funk_val_sz( rec ), k ) );
+  }
+  FD_TEST( !fd_funk_verify( funk ) );
+  FD_TEST( fd_funk_cold_close( funk )==FD_FUNK_SUCCESS );
+
+  fd_funk_end_write( funk );
+
+  unlink( path );
+
+  fd_wksp_free_laddr( fd_funk_delete( fd_funk_leave( funk ) ) );
+  if( name ) fd_wksp_detach( wksp );
+  else       fd_wksp_delete_anonymous( wksp );
+
+  FD_LOG_NOTICE(( "pass" ));
+  fd_halt();
+  return 0;
+}
+
+#else
+
+int
+main( int     argc,
+      char ** argv ) {
+  fd_boot( &argc, &argv );
+  FD_LOG_WARNING(( "skip: unit test requires FD_HAS_HOSTED capabilities" ));
+  fd_halt();
+  return 0;
+}
+
+#endif
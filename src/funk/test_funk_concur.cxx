@@ -14,11 +14,82 @@ static void * read_thread(void * arg) {
   return NULL;
 }
 
+/* Scaling benchmark for fd_funk_rec_write_prepare_concur: thread_cnt
+   threads concurrently insert disjoint sets of keys into the same
+   in-preparation transaction. */
+
+#define BENCH_VAL_SZ (64UL)
+
+struct bench_arg {
+  fd_funk_t *     funk;
+  fd_funk_txn_t * txn;
+  ulong           key0;
+  ulong           key_cnt;
+};
+
+static void * bench_thread(void * _arg) {
+  bench_arg * arg = (bench_arg *)_arg;
+  fd_wksp_t * wksp = fd_funk_wksp( arg->funk );
+  fd_funk_rec_key_t key;
+  memset( &key, 0, sizeof(key) );
+  for( ulong i = 0; i < arg->key_cnt; ++i ) {
+    key.ul[0] = arg->key0 + i;
+    int err;
+    fd_funk_rec_t * rec = fd_funk_rec_write_prepare_concur( arg->funk, arg->txn, &key, BENCH_VAL_SZ, 1, NULL, &err );
+    FD_TEST( rec && err==FD_FUNK_SUCCESS );
+    memset( fd_funk_val( rec, wksp ), (int)i, BENCH_VAL_SZ );
+  }
+  return NULL;
+}
+
+static void bench_concur_insert(fd_wksp_t * wksp, ulong thread_max, ulong rec_cnt) {
+  for( ulong thread_cnt = 1; thread_cnt <= thread_max; thread_cnt <<= 1 ) {
+    ulong wksp_tag = 1234UL + thread_cnt;
+    void * mem = fd_wksp_alloc_laddr( wksp, fd_funk_align(), fd_funk_footprint(), wksp_tag );
+    fd_funk_t * funk = fd_funk_join( fd_funk_new( mem, wksp_tag, 5678U, 16UL, rec_cnt ) );
+    FD_TEST( funk );
+
+    fd_funk_start_write( funk );
+    fd_funk_txn_xid_t xid;
+    memset( &xid, 0, sizeof(xid) );
+    xid.ul[0] = 1UL;
+    fd_funk_txn_t * txn = fd_funk_txn_prepare( funk, NULL, &xid, 1 );
+    FD_TEST( txn );
+
+    pthread_t thr[ 64 ];
+    bench_arg arg[ 64 ];
+    ulong per_thread = rec_cnt / thread_cnt;
+    long dt = -fd_log_wallclock();
+    for( ulong t = 0; t < thread_cnt; ++t ) {
+      arg[t].funk    = funk;
+      arg[t].txn     = txn;
+      arg[t].key0    = t*per_thread;
+      arg[t].key_cnt = per_thread;
+      FD_TEST( pthread_create( &thr[t], NULL, bench_thread, &arg[t] ) == 0 );
+    }
+    for( ulong t = 0; t < thread_cnt; ++t ) pthread_join( thr[t], NULL );
+    dt += fd_log_wallclock();
+    fd_funk_end_write( funk );
+
+    FD_TEST( fd_funk_rec_cnt( fd_funk_rec_map( funk, wksp ) ) == per_thread*thread_cnt );
+    FD_TEST( !fd_funk_verify( funk ) );
+    FD_LOG_NOTICE(( "%2lu threads: %lu inserts in %.3f ms (%.3f Minserts/s)",
+                    thread_cnt, per_thread*thread_cnt, (double)dt*1e-6, (double)(per_thread*thread_cnt)*1e3/(double)dt ));
+
+    fd_wksp_free_laddr( fd_funk_delete( fd_funk_leave( funk ) ) );
+    fd_wksp_tag_free( wksp, &wksp_tag, 1UL );
+  }
+}
+
 int main(int argc, char** argv) {
   srand(1234);
 
   fake_funk ff(&argc, &argv);
 
+  ulong bench_thread_max = fd_env_strip_cmdline_ulong( &argc, &argv, "--bench-thread-max", NULL, fd_ulong_min( fd_shmem_cpu_cnt(), 64UL ) );
+  ulong bench_rec_cnt    = fd_env_strip_cmdline_ulong( &argc, &argv, "--bench-rec-cnt",    NULL, 1UL<<18                                );
+  bench_concur_insert( ff._wksp, fd_ulong_min( bench_thread_max, 64UL ), bench_rec_cnt );
+
   pthread_t thr = 0;
   FD_TEST( pthread_create(&thr, NULL, read_thread, &ff) == 0 );
   
@@ -105,6 +105,18 @@ fd_tar_meta_set_mtime( fd_tar_meta_t * meta,
   return fd_tar_set_octal( meta->mtime, mtime );
 }
 
+/* fd_tar_meta_init_file populates meta with the complete header of a
+   regular file at path file_name with file_sz bytes of data (the same
+   header the streaming writer below produces, including the checksum).
+   This allows producing tar streams in memory when the size of a file
+   is known before its data is written out.  Returns 1 on success and 0
+   if file_name does not fit in the header. */
+
+int
+fd_tar_meta_init_file( fd_tar_meta_t * meta,
+                       char const *    file_name,
+                       ulong           file_sz );
+
 FD_PROTOTYPES_END
 
 /* Streaming reader ***************************************************/
@@ -12,6 +12,30 @@ static char null_tar_block[ FD_TAR_BLOCK_SZ ] = {0};
 #define FD_TAR_MAGIC_VERSION  ("ustar  \0")
 #define FD_TAR_DEFAULT_CHKSUM ("        " )
 
+int
+fd_tar_meta_init_file( fd_tar_meta_t * meta,
+                       char const *    file_name,
+                       ulong           file_sz ) {
+
+  ulong name_len = strlen( file_name );
+  if( FD_UNLIKELY( name_len>=FD_TAR_NAME_SZ ) ) return 0;
+
+  fd_memset( meta, 0, sizeof(fd_tar_meta_t) );
+  fd_memcpy( &meta->name,   file_name,             name_len                      );
+  fd_memcpy( &meta->mode,   FD_TAR_PERM,           sizeof(FD_TAR_PERM)           );
+  fd_memcpy( &meta->magic,  FD_TAR_MAGIC_VERSION,  sizeof(FD_TAR_MAGIC_VERSION)  );
+  fd_memcpy( &meta->chksum, FD_TAR_DEFAULT_CHKSUM, sizeof(FD_TAR_DEFAULT_CHKSUM) );
+  fd_tar_meta_set_size( meta, file_sz );
+
+  /* The checksum is computed with the checksum field set to spaces */
+
+  uint checksum = 0U;
+  for( ulong i=0UL; i<FD_TAR_BLOCK_SZ; i++ ) checksum += ((uchar *)meta)[i];
+  snprintf( meta->chksum, sizeof(meta->chksum), "%07o", checksum );
+
+  return 1;
+}
+
 fd_tar_writer_t *
 fd_tar_writer_new( void * mem, int fd ) {
 
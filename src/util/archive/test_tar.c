@@ -1,6 +1,8 @@
 #include "../fd_util.h"
 #include "fd_tar.h"
 
+#include <stdlib.h>
+
 uchar const test_large_header[ 512 ] = {
   0x61, 0x63, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x73, 0x2f, 0x32, 0x35, 0x34, 0x34, 0x36, 0x32, 0x34,
   0x39, 0x39, 0x2e, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00,
@@ -45,6 +47,24 @@ main( int     argc,
   fd_tar_meta_t const * hdr = fd_type_pun_const( test_large_header );
   FD_TEST( fd_tar_meta_get_size( hdr )==10771643384UL );
 
+  /* Test in-memory header creation */
+  fd_tar_meta_t meta[1];
+  FD_TEST( fd_tar_meta_init_file( meta, "accounts/254462499.10000000000", 10771643384UL ) );
+  FD_TEST( fd_tar_meta_is_reg( meta ) );
+  FD_TEST( fd_tar_meta_get_size( meta )==10771643384UL );
+  FD_TEST( !memcmp( meta->name, hdr->name, FD_TAR_NAME_SZ ) );
+  FD_TEST( !memcmp( meta->magic, FD_TAR_MAGIC, 5UL ) );
+
+  fd_tar_meta_t chk[1] = { *meta };
+  fd_memset( chk->chksum, ' ', sizeof(chk->chksum) );
+  uint checksum = 0U;
+  for( ulong i=0UL; i<FD_TAR_BLOCK_SZ; i++ ) checksum += ((uchar *)chk)[i];
+  FD_TEST( strtoul( meta->chksum, NULL, 8 )==checksum );
+
+  char long_name[ FD_TAR_NAME_SZ+1 ];
+  fd_memset( long_name, 'a', FD_TAR_NAME_SZ ); long_name[ FD_TAR_NAME_SZ ] = '\0';
+  FD_TEST( !fd_tar_meta_init_file( meta, long_name, 0UL ) );
+
   FD_LOG_NOTICE(( "pass" ));
 
   fd_halt();
@@ -386,6 +386,184 @@ FD_TPOOL_EXEC_ALL_IMPL_HDR(raw)
   task( (void *)_tpool,t0,t1, args,reduce,stride, l0,l1, l0,l1, node_t0,node_t1 );
 FD_TPOOL_EXEC_ALL_IMPL_FTR
 
+#if FD_HAS_ATOMIC
+
+ulong
+fd_tpool_steal_align( void ) {
+  return FD_TPOOL_STEAL_ALIGN;
+}
+
+ulong
+fd_tpool_steal_footprint( ulong worker_max,
+                          ulong depth ) {
+  if( FD_UNLIKELY( !((1UL<=worker_max) & (worker_max<=FD_TILE_MAX)) ) ) return 0UL;
+  if( FD_UNLIKELY( !(fd_ulong_is_pow2( depth ) & (depth<=FD_TPOOL_STEAL_DEPTH_MAX)) ) ) return 0UL;
+  return FD_TPOOL_STEAL_FOOTPRINT( worker_max, depth );
+}
+
+fd_tpool_steal_t *
+fd_tpool_steal_init( void * mem,
+                     ulong  worker_max,
+                     ulong  depth ) {
+
+  FD_COMPILER_MFENCE();
+
+  if( FD_UNLIKELY( !mem ) ) {
+    FD_LOG_WARNING(( "NULL mem" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)mem, fd_tpool_steal_align() ) ) ) {
+    FD_LOG_WARNING(( "bad alignment" ));
+    return NULL;
+  }
+
+  ulong footprint = fd_tpool_steal_footprint( worker_max, depth );
+  if( FD_UNLIKELY( !footprint ) ) {
+    FD_LOG_WARNING(( "bad worker_max or depth" ));
+    return NULL;
+  }
+
+  fd_memset( mem, 0, footprint );
+
+  fd_tpool_steal_t * steal = (fd_tpool_steal_t *)mem;
+  steal->worker_max = worker_max;
+  steal->depth      = depth;
+  steal->done       = 1UL;
+
+  FD_COMPILER_MFENCE();
+
+  return steal;
+}
+
+void *
+fd_tpool_steal_fini( fd_tpool_steal_t * steal ) {
+
+  FD_COMPILER_MFENCE();
+
+  if( FD_UNLIKELY( !steal ) ) {
+    FD_LOG_WARNING(( "NULL steal" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( !FD_VOLATILE_CONST( steal->done ) ) ) {
+    FD_LOG_WARNING(( "steal is in use" ));
+    return NULL;
+  }
+
+  return (void *)steal;
+}
+
+/* fd_tpool_private_steal_try tries to steal the oldest task in worker
+   victim_idx's deque.  Returns the task on success and NULL if the
+   deque was empty or we lost a race for the task. */
+
+static inline fd_tpool_steal_task_t *
+fd_tpool_private_steal_try( fd_tpool_steal_t * steal,
+                            ulong              victim_idx ) {
+  fd_tpool_private_deque_t * deque = fd_tpool_private_steal_deque( steal, victim_idx );
+
+  FD_COMPILER_MFENCE();
+  ulong top = FD_VOLATILE_CONST( deque->top );
+  FD_COMPILER_MFENCE();
+  ulong bot = FD_VOLATILE_CONST( deque->bot );
+  FD_COMPILER_MFENCE();
+
+  if( FD_LIKELY( (long)(bot-top)<=0L ) ) return NULL;
+
+  /* The slot cannot be reused by the owner until top advances past it
+     so it is safe to read before the CAS. */
+
+  fd_tpool_steal_task_t * task = fd_tpool_private_steal_ring( steal, victim_idx )[ top & (steal->depth-1UL) ];
+  FD_COMPILER_MFENCE();
+  if( FD_UNLIKELY( FD_ATOMIC_CAS( &deque->top, top, top+1UL )!=top ) ) return NULL;
+  return task;
+}
+
+/* fd_tpool_private_steal_any has worker worker_idx sweep the other
+   participating workers' deques for a task to steal.  Victims are
+   probed in order of increasing xor distance in worker index (i.e.
+   sibling in the dispatch tree first, then cousins, ...) to keep
+   steals between nearby tiles when possible. */
+
+static fd_tpool_steal_task_t *
+fd_tpool_private_steal_any( fd_tpool_steal_t * steal,
+                            ulong              worker_idx ) {
+  ulong t0    = steal->t0;
+  ulong t_cnt = steal->t1 - t0;
+  ulong w     = worker_idx - t0;
+  ulong k_max = fd_ulong_pow2_up( t_cnt );
+  for( ulong k=1UL; k<k_max; k++ ) {
+    ulong v = w ^ k;
+    if( FD_UNLIKELY( v>=t_cnt ) ) continue;
+    fd_tpool_steal_task_t * task = fd_tpool_private_steal_try( steal, t0+v );
+    if( task ) return task;
+  }
+  return NULL;
+}
+
+/* fd_tpool_private_steal_run runs a stolen task on worker worker_idx
+   and then marks it done.  The task descriptor can be freed by its
+   owner as soon as it is marked done so we must not touch it after. */
+
+static void
+fd_tpool_private_steal_run( fd_tpool_steal_t *      steal,
+                            ulong                   worker_idx,
+                            fd_tpool_steal_task_t * task ) {
+  try {
+    task->task( steal,steal->t0,steal->t1, task->args,task->reduce,task->stride, task->l0,task->l1, task->m0,task->m1,
+                worker_idx,worker_idx+1UL );
+  } catch( ... ) {
+    FD_LOG_WARNING(( "uncaught exception; attempting to continue" ));
+  }
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( task->done ) = 1UL;
+  FD_COMPILER_MFENCE();
+}
+
+void
+fd_tpool_private_steal_wait( fd_tpool_steal_t *      steal,
+                             ulong                   worker_idx,
+                             fd_tpool_steal_task_t * child ) {
+  for(;;) {
+    FD_COMPILER_MFENCE();
+    if( FD_VOLATILE_CONST( child->done ) ) break;
+    FD_COMPILER_MFENCE();
+    fd_tpool_steal_task_t * task = fd_tpool_private_steal_any( steal, worker_idx );
+    if( task ) fd_tpool_private_steal_run( steal, worker_idx, task );
+    else       FD_SPIN_PAUSE();
+  }
+  FD_COMPILER_MFENCE();
+}
+
+FD_TPOOL_EXEC_ALL_IMPL_HDR(steal)
+  fd_tpool_steal_t * steal = (fd_tpool_steal_t *)_tpool;
+  if( node_t0==t0 ) {
+
+    /* We are the root.  By the time the root returns, everything it
+       spawned (recursively) has completed. */
+
+    task( steal,t0,t1, args,reduce,stride, l0,l1, l0,l1, t0,t0+1UL );
+    FD_COMPILER_MFENCE();
+    FD_VOLATILE( steal->done ) = 1UL;
+    FD_COMPILER_MFENCE();
+
+  } else {
+
+    for(;;) {
+      FD_COMPILER_MFENCE();
+      if( FD_VOLATILE_CONST( steal->done ) ) break;
+      FD_COMPILER_MFENCE();
+      fd_tpool_steal_task_t * stolen = fd_tpool_private_steal_any( steal, node_t0 );
+      if( stolen ) fd_tpool_private_steal_run( steal, node_t0, stolen );
+      else         FD_SPIN_PAUSE();
+    }
+
+  }
+FD_TPOOL_EXEC_ALL_IMPL_FTR
+
+#endif
+
 #undef FD_TPOOL_EXEC_ALL_IMPL_FTR
 #undef FD_TPOOL_EXEC_ALL_IMPL_HDR
 
@@ -957,6 +957,313 @@ fd_tpool_exec_all_taskq( fd_tpool_t *    tpool,
 
 #undef FD_TPOOL_EXEC_ALL_DECL
 
+#if FD_HAS_ATOMIC
+
+/* Work stealing ******************************************************/
+
+/* The exec_all variants above work well when the shape of a job is
+   known at dispatch time.  Some jobs (e.g. recursive divide and
+   conquer over work items with wildly non-uniform costs and/or nested
+   parallelism discovered while running) are not like that.  For these,
+   fd_tpool_exec_all_steal provides a fork-join style execution mode
+   where a running task can expose additional parallelism with
+   fd_tpool_spawn and later join it with fd_tpool_sync.
+
+   Each worker thread has its own fixed capacity Chase-Lev deque of
+   spawned tasks.  A worker pushes and pops tasks to / from the bottom
+   of its own deque without contention (an atomic is only needed when
+   racing a thief for the last task) and idle workers steal the oldest
+   (and thus typically the largest) task from the top of a victim's
+   deque.  Victims are probed in order of increasing tpool worker index
+   distance (same dispatch tree neighbors first) such that steals tend
+   to stay between tiles that are near each other, mirroring the NUMA
+   aware splitting used by the dispatch tree above.
+
+   There is no central counter and no dynamic allocation.  The deques
+   live in a caller provided fd_tpool_steal_t memory region and spawned
+   task descriptors live in the spawning task's stack frame (which is
+   guaranteed to outlive the spawned task by the fork-join discipline).
+   If a worker's deque is full when it spawns, the spawned task is just
+   executed immediately by the spawner.  Thus any deque depth gives
+   correct results (depth just limits the amount of exposed
+   parallelism).
+
+   Typical usage:
+
+     static void
+     my_task( void * _steal,
+              ulong  t0,     ulong t1,
+              void * args,
+              void * reduce, ulong stride,
+              ulong  l0,     ulong l1,
+              ulong  m0,     ulong m1,
+              ulong  n0,     ulong n1 ) {
+       fd_tpool_steal_t * steal = (fd_tpool_steal_t *)_steal;
+       if( m1-m0>grain ) {
+         ulong ms = m0 + ((m1-m0)>>1);
+         fd_tpool_steal_task_t right[1];
+         fd_tpool_spawn( steal, n0, right, my_task, args, reduce,stride, l0,l1, ms,m1 );
+         my_task( steal, t0,t1, args, reduce,stride, l0,l1, m0,ms, n0,n1 );
+         fd_tpool_sync( steal, n0, right );
+         return;
+       }
+       ... process items [m0,m1) ...
+     }
+
+     ... in the main thread ...
+
+     fd_tpool_exec_all_steal( tpool,t0,t1, steal, my_task, args, reduce,stride, l0,l1 );
+
+   Note that tasks run via work stealing receive the fd_tpool_steal_t
+   as their tpool argument and the index of the worker thread running
+   them in [n0,n1) (n1==n0+1). */
+
+/* A fd_tpool_steal_task_t describes a spawned task.  These are
+   typically declared in the stack frame of the spawning task.  Users
+   should treat the fields as opaque. */
+
+struct fd_tpool_steal_task {
+  fd_tpool_task_t task;
+  void *          args;
+  void *          reduce; ulong stride;
+  ulong           l0;     ulong l1;
+  ulong           m0;     ulong m1;
+  ulong           done;   /* 0 until a task run by another thread completes */
+};
+
+typedef struct fd_tpool_steal_task fd_tpool_steal_task_t;
+
+/* Private APIs (exposed to facilitate inlining spawn and sync) */
+
+struct __attribute__((aligned(128))) fd_tpool_private_deque {
+  ulong top;        /* Oldest task not yet stolen or popped, advanced by thieves and owner with CAS */
+  uchar _pad[120];  /* top and bot on different cache line pairs */
+  ulong bot;        /* Next deque slot to push, only modified by owner */
+};
+
+typedef struct fd_tpool_private_deque fd_tpool_private_deque_t;
+
+struct __attribute__((aligned(128))) fd_tpool_steal_private {
+
+  ulong worker_max; /* Positive */
+  ulong depth;      /* Positive integer power of 2 */
+  ulong t0;         /* Workers [t0,t1) are participating in the current exec_all_steal */
+  ulong t1;
+  ulong done;       /* 0 while the current exec_all_steal root task is running */
+
+  /* worker_max fd_tpool_private_deque_t here, indexed by tpool worker
+     idx, followed by worker_max depth fd_tpool_steal_task_t * rings */
+
+};
+
+typedef struct fd_tpool_steal_private fd_tpool_steal_t;
+
+/* FD_TPOOL_STEAL_DEPTH_MAX is the largest deque depth supported */
+
+#define FD_TPOOL_STEAL_DEPTH_MAX (1UL<<20)
+
+/* FD_TPOOL_STEAL_{ALIGN,FOOTPRINT} return the alignment and footprint
+   required for a memory region to be used as a fd_tpool_steal_t that
+   supports worker indices in [0,worker_max) with per worker deques that
+   can hold up to depth outstanding spawns.  Assumes worker_max in
+   [1,FD_TILE_MAX] and depth is an integer power of 2 in
+   [1,FD_TPOOL_STEAL_DEPTH_MAX]. */
+
+#define FD_TPOOL_STEAL_ALIGN                          (128UL)
+#define FD_TPOOL_STEAL_FOOTPRINT( worker_max, depth ) ( ( sizeof(fd_tpool_steal_t)                                                   \
+                                                        + ((ulong)(worker_max))*sizeof(fd_tpool_private_deque_t)                     \
+                                                        + ((ulong)(worker_max))*((ulong)(depth))*sizeof(fd_tpool_steal_task_t *)     \
+                                                        + FD_TPOOL_STEAL_ALIGN-1UL ) & (~(FD_TPOOL_STEAL_ALIGN-1UL)) )
+
+FD_FN_CONST static inline fd_tpool_private_deque_t *
+fd_tpool_private_steal_deque( fd_tpool_steal_t const * steal,
+                              ulong                    worker_idx ) {
+  return ((fd_tpool_private_deque_t *)(steal+1)) + worker_idx;
+}
+
+FD_FN_PURE static inline fd_tpool_steal_task_t **
+fd_tpool_private_steal_ring( fd_tpool_steal_t const * steal,
+                             ulong                    worker_idx ) {
+  return ((fd_tpool_steal_task_t **)(((fd_tpool_private_deque_t *)(steal+1)) + steal->worker_max)) + worker_idx*steal->depth;
+}
+
+/* fd_tpool_private_steal_wait has worker_idx steal and run tasks from
+   other workers until child is done. */
+
+void
+fd_tpool_private_steal_wait( fd_tpool_steal_t *      steal,
+                             ulong                   worker_idx,
+                             fd_tpool_steal_task_t * child );
+
+/* fd_tpool_steal_{align,footprint} return FD_TPOOL_STEAL_{ALIGN,
+   FOOTPRINT}.  footprint returns 0 if worker_max and/or depth are not
+   valid. */
+
+FD_FN_CONST ulong fd_tpool_steal_align( void );
+FD_FN_CONST ulong fd_tpool_steal_footprint( ulong worker_max, ulong depth );
+
+/* fd_tpool_steal_init formats a memory region with the appropriate
+   alignment and footprint for use in fd_tpool_exec_all_steal.  Returns
+   a handle to it on success (not a simple cast of mem) and NULL on
+   failure (logs details).  fd_tpool_steal_fini unformats it, returning
+   the underlying memory region on success and NULL on failure (logs
+   details).  A fd_tpool_steal_t can be used by at most one
+   fd_tpool_exec_all_steal at a time but can be reused by any number of
+   them sequentially.  Like tpools, these use init/fini semantics and
+   act as compiler memory fences. */
+
+fd_tpool_steal_t *
+fd_tpool_steal_init( void * mem,
+                     ulong  worker_max,
+                     ulong  depth );
+
+void *
+fd_tpool_steal_fini( fd_tpool_steal_t * steal );
+
+FD_FN_PURE static inline ulong fd_tpool_steal_worker_max( fd_tpool_steal_t const * steal ) { return steal->worker_max; }
+FD_FN_PURE static inline ulong fd_tpool_steal_depth     ( fd_tpool_steal_t const * steal ) { return steal->depth;      }
+
+/* fd_tpool_exec_all_steal calls:
+
+     task( steal,t0,t1, task_args,task_reduce,task_stride, task_l0,task_l1, task_l0,task_l1, t0,t0+1 );
+
+   on the caller (masquerading as worker thread t0 as per the other
+   exec_all variants) while tpool worker threads (t0,t1) steal and run
+   any tasks spawned by it (recursively) until it returns.  The usual
+   exec_all requirements apply.  Additionally assumes steal is a
+   current local join to a fd_tpool_steal_t with a worker_max of at
+   least t1 that is not in use by another exec_all_steal and that task
+   syncs all tasks it spawns before returning.  All tasks have completed
+   on return.  This function acts as a compiler memory fence. */
+
+void
+fd_tpool_private_exec_all_steal_node( void * _node_tpool,
+                                      ulong  node_t0, ulong node_t1,
+                                      void * args,
+                                      void * reduce,  ulong stride,
+                                      ulong  l0,      ulong l1,
+                                      ulong  _task,   ulong _steal,
+                                      ulong  t0,      ulong t1 );
+
+static inline void
+fd_tpool_exec_all_steal( fd_tpool_t *       tpool,
+                         ulong              t0,          ulong t1,
+                         fd_tpool_steal_t * steal,
+                         fd_tpool_task_t    task,
+                         void *             task_args,
+                         void *             task_reduce, ulong task_stride,
+                         ulong              task_l0,     ulong task_l1 ) {
+  steal->t0   = t0;
+  steal->t1   = t1;
+  steal->done = 0UL;
+  FD_COMPILER_MFENCE();
+  fd_tpool_private_exec_all_steal_node( tpool, t0,t1, task_args, task_reduce,task_stride, task_l0,task_l1,
+                                        (ulong)task,(ulong)steal, t0,t1 );
+}
+
+/* fd_tpool_spawn makes the call:
+
+     task( steal,t0,t1, args,reduce,stride, l0,l1, m0,m1, n,n+1 )
+
+   available for execution by any worker participating in the current
+   exec_all_steal (n is the worker that ends up running it).  child is
+   caller provided storage for the spawn that must remain valid until
+   the matching fd_tpool_sync returns.  worker_idx is the index of the
+   calling worker (i.e. the n0 its own task was given).  Spawned tasks
+   must be synced in the reverse order they were spawned.  If the
+   caller's deque is full, the task is run before this returns.  This
+   function acts as a compiler memory fence. */
+
+static inline void
+fd_tpool_spawn( fd_tpool_steal_t *      steal,
+                ulong                   worker_idx,
+                fd_tpool_steal_task_t * child,
+                fd_tpool_task_t         task,
+                void *                  args,
+                void *                  reduce, ulong stride,
+                ulong                   l0,     ulong l1,
+                ulong                   m0,     ulong m1 ) {
+  child->task   = task;
+  child->args   = args;
+  child->reduce = reduce; child->stride = stride;
+  child->l0     = l0;     child->l1     = l1;
+  child->m0     = m0;     child->m1     = m1;
+  child->done   = 0UL;
+
+  fd_tpool_private_deque_t * deque = fd_tpool_private_steal_deque( steal, worker_idx );
+  ulong                      mask  = steal->depth - 1UL;
+
+  FD_COMPILER_MFENCE();
+  ulong bot = deque->bot;
+  ulong top = FD_VOLATILE_CONST( deque->top );
+  FD_COMPILER_MFENCE();
+
+  if( FD_UNLIKELY( (bot-top)>mask ) ) { /* Deque full, run inline */
+    task( steal,steal->t0,steal->t1, args,reduce,stride, l0,l1, m0,m1, worker_idx,worker_idx+1UL );
+    FD_COMPILER_MFENCE();
+    child->done = 1UL;
+    FD_COMPILER_MFENCE();
+    return;
+  }
+
+  fd_tpool_private_steal_ring( steal, worker_idx )[ bot & mask ] = child;
+  FD_COMPILER_MFENCE();
+  FD_VOLATILE( deque->bot ) = bot+1UL;
+  FD_COMPILER_MFENCE();
+}
+
+/* fd_tpool_sync waits for the task spawned into child by worker
+   worker_idx to complete.  If the task has not been stolen, it is run
+   by the caller.  Otherwise, the caller steals and runs other tasks
+   while waiting.  Assumes child is the most recently spawned
+   still-unsynced task of the caller.  This function acts as a compiler
+   memory fence. */
+
+static inline void
+fd_tpool_sync( fd_tpool_steal_t *      steal,
+               ulong                   worker_idx,
+               fd_tpool_steal_task_t * child ) {
+
+  FD_COMPILER_MFENCE();
+  if( FD_UNLIKELY( FD_VOLATILE_CONST( child->done ) ) ) return; /* Ran inline on spawn (or already stolen and done) */
+
+  /* Pop the bottom of our deque.  Given LIFO spawn / sync order, this
+     is either child or, if child was stolen (in which case everything
+     older than it was stolen too), nothing.  The atomic decrement is
+     needed as a full memory fence between the bot store and top
+     load. */
+
+  fd_tpool_private_deque_t * deque = fd_tpool_private_steal_deque( steal, worker_idx );
+  ulong                      mask  = steal->depth - 1UL;
+
+  ulong bot = FD_ATOMIC_SUB_AND_FETCH( &deque->bot, 1UL );
+  ulong top = FD_VOLATILE_CONST( deque->top );
+
+  fd_tpool_steal_task_t * task = NULL;
+  if( FD_LIKELY( (long)(bot-top)>=0L ) ) {
+    task = fd_tpool_private_steal_ring( steal, worker_idx )[ bot & mask ];
+    if( FD_UNLIKELY( bot==top ) ) { /* Last task in deque, race any thieves for it */
+      if( FD_UNLIKELY( FD_ATOMIC_CAS( &deque->top, top, top+1UL )!=top ) ) task = NULL;
+      FD_VOLATILE( deque->bot ) = bot+1UL;
+    }
+  } else {
+    FD_VOLATILE( deque->bot ) = bot+1UL;
+  }
+  FD_COMPILER_MFENCE();
+
+  if( FD_LIKELY( task ) ) {
+    task->task( steal,steal->t0,steal->t1, task->args,task->reduce,task->stride, task->l0,task->l1, task->m0,task->m1,
+                worker_idx,worker_idx+1UL );
+    return;
+  }
+
+  fd_tpool_private_steal_wait( steal, worker_idx, child );
+}
+
+/* End of work stealing ***********************************************/
+
+#endif /* FD_HAS_ATOMIC */
+
 /* FD_FOR_ALL provides some macros for writing CUDA-ish parallel-for
    kernels executed via tpool threads.  Example usage:
 
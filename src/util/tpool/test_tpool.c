@@ -9,6 +9,12 @@ FD_STATIC_ASSERT( FD_TPOOL_WORKER_STATE_IDLE==1, unit_test );
 FD_STATIC_ASSERT( FD_TPOOL_WORKER_STATE_EXEC==2, unit_test );
 FD_STATIC_ASSERT( FD_TPOOL_WORKER_STATE_HALT==3, unit_test );
 
+#if FD_HAS_ATOMIC
+FD_STATIC_ASSERT( FD_TPOOL_STEAL_ALIGN                == 128UL, unit_test );
+FD_STATIC_ASSERT( FD_TPOOL_STEAL_FOOTPRINT(1UL,1UL)   == 512UL, unit_test );
+FD_STATIC_ASSERT( FD_TPOOL_STEAL_FOOTPRINT(4UL,64UL)  ==3200UL, unit_test );
+#endif
+
 static int
 tile_self_push_main( int     argc,
                      char ** argv ) {
@@ -113,6 +119,88 @@ worker_taskq( void * tpool,
 }
 #endif
 
+#if FD_HAS_ATOMIC
+static ulong steal_hit[ FD_TILE_MAX ];
+
+static void
+worker_steal( void * tpool,
+              ulong  t0,     ulong t1,
+              void * args,
+              void * reduce, ulong stride,
+              ulong  l0,     ulong l1,
+              ulong  m0,     ulong m1,
+              ulong  n0,     ulong n1 ) {
+  test_args_t const * tx = (test_args_t const *)args;
+  FD_TEST( tpool==tx->tpool );
+  FD_TEST( t0==tx->t0 ); FD_TEST( t1==tx->t1 ); FD_TEST( reduce==tx->reduce ); FD_TEST( stride==tx->stride );
+  FD_TEST( l0==tx->l0 ); FD_TEST( l1==tx->l1 ); FD_TEST( l0<=m0 ); FD_TEST( m0<=m1 ); FD_TEST( m1<=l1 );
+  FD_TEST( t0<=n0 ); FD_TEST( n1==n0+1UL ); FD_TEST( n1<=t1 );
+
+  fd_tpool_steal_t * steal = (fd_tpool_steal_t *)tpool;
+
+  if( m1-m0>1UL ) { /* Uneven split to exercise lopsided trees */
+    ulong ms = m0 + 1UL + ((m1-m0-1UL)>>(1+(int)(m0&1UL)));
+    fd_tpool_steal_task_t right[1];
+    fd_tpool_spawn( steal, n0, right, worker_steal, args, reduce,stride, l0,l1, ms,m1 );
+    worker_steal( tpool, t0,t1, args, reduce,stride, l0,l1, m0,ms, n0,n1 );
+    fd_tpool_sync( steal, n0, right );
+    return;
+  }
+
+  if( m1>m0 ) FD_ATOMIC_FETCH_AND_ADD( &steal_hit[ m0 ], 1UL );
+}
+
+/* The work stealing benchmark does BENCH_TASK_CNT tasks of highly
+   non-uniform cost (the cost of a task varies over 2 orders of
+   magnitude) */
+
+#define BENCH_TASK_CNT (4096UL)
+
+ulong bench_out[ BENCH_TASK_CNT ]; /* Not static to keep bench_task from being optimized out */
+
+static inline void
+bench_task( ulong m ) {
+  ulong x = m;
+  ulong n = 8UL << (fd_ulong_hash( m ) & 7UL);
+  for( ulong i=0UL; i<n; i++ ) x = fd_ulong_hash( x );
+  bench_out[ m ] = x;
+}
+
+static void
+worker_bench_taskq( void * tpool,
+                    ulong  t0,     ulong t1,
+                    void * args,
+                    void * reduce, ulong stride,
+                    ulong  l0,     ulong l1,
+                    ulong  m0,     ulong m1,
+                    ulong  n0,     ulong n1 ) {
+  (void)tpool; (void)t0; (void)t1; (void)args; (void)reduce; (void)stride; (void)l0; (void)l1; (void)m1; (void)n0; (void)n1;
+  bench_task( m0 );
+}
+
+static void
+worker_bench_steal( void * tpool,
+                    ulong  t0,     ulong t1,
+                    void * args,
+                    void * reduce, ulong stride,
+                    ulong  l0,     ulong l1,
+                    ulong  m0,     ulong m1,
+                    ulong  n0,     ulong n1 ) {
+  fd_tpool_steal_t * steal = (fd_tpool_steal_t *)tpool;
+  if( m1-m0>1UL ) {
+    ulong ms = m0 + ((m1-m0)>>1);
+    fd_tpool_steal_task_t right[1];
+    fd_tpool_spawn( steal, n0, right, worker_bench_steal, args, reduce,stride, l0,l1, ms,m1 );
+    worker_bench_steal( tpool, t0,t1, args, reduce,stride, l0,l1, m0,ms, n0,n1 );
+    fd_tpool_sync( steal, n0, right );
+    return;
+  }
+  if( m1>m0 ) bench_task( m0 );
+}
+
+static uchar steal_mem[ FD_TPOOL_STEAL_FOOTPRINT( FD_TILE_MAX, 64UL ) ] __attribute__((aligned(FD_TPOOL_STEAL_ALIGN)));
+#endif
+
 static void
 worker_bench( void * tpool,
               ulong  t0,     ulong t1,
@@ -626,6 +714,47 @@ main( int     argc,
     fd_tpool_exec_all_taskq( tpool,job_t0,job_t1, worker_taskq, job_tpool, job_args, job_reduce,job_stride, job_l0,job_l1 );
     FD_TEST( !memcmp( worker_tx, worker_rx, FD_TILE_MAX*sizeof(test_args_t) ) );
   }
+
+  FD_LOG_NOTICE(( "Testing fd_tpool_steal" ));
+
+  FD_TEST( fd_tpool_steal_align()==FD_TPOOL_STEAL_ALIGN );
+  FD_TEST( !fd_tpool_steal_footprint( 0UL,             1UL                            ) ); /* bad worker_max */
+  FD_TEST( !fd_tpool_steal_footprint( FD_TILE_MAX+1UL, 1UL                            ) ); /* bad worker_max */
+  FD_TEST( !fd_tpool_steal_footprint( 1UL,             0UL                            ) ); /* bad depth */
+  FD_TEST( !fd_tpool_steal_footprint( 1UL,             3UL                            ) ); /* bad depth */
+  FD_TEST( !fd_tpool_steal_footprint( 1UL,             2UL*FD_TPOOL_STEAL_DEPTH_MAX   ) ); /* bad depth */
+  FD_TEST( fd_tpool_steal_footprint( FD_TILE_MAX, 64UL )==FD_TPOOL_STEAL_FOOTPRINT( FD_TILE_MAX, 64UL ) );
+
+  FD_TEST( !fd_tpool_steal_init( NULL,        1UL, 1UL ) ); /* NULL mem */
+  FD_TEST( !fd_tpool_steal_init( (void *)1UL, 1UL, 1UL ) ); /* misaligned mem */
+  FD_TEST( !fd_tpool_steal_init( steal_mem,   0UL, 1UL ) ); /* bad worker_max */
+  FD_TEST( !fd_tpool_steal_init( steal_mem,   1UL, 3UL ) ); /* bad depth */
+  FD_TEST( !fd_tpool_steal_fini( NULL ) );                  /* NULL steal */
+
+  for( ulong rem=10000UL; rem; rem-- ) {
+    ulong depth = 1UL << fd_rng_uint_roll( rng, 7U );
+    fd_tpool_steal_t * steal = fd_tpool_steal_init( steal_mem, tile_cnt, depth ); FD_TEST( steal );
+    FD_TEST( fd_tpool_steal_worker_max( steal )==tile_cnt );
+    FD_TEST( fd_tpool_steal_depth     ( steal )==depth    );
+
+    ulong tmp0 = fd_rng_ulong_roll( rng, tile_cnt );
+    ulong tmp1 = fd_rng_ulong_roll( rng, tile_cnt );
+    test_args_t tx[1];
+    tx->tpool  = (void *)steal;
+    tx->t0     = fd_ulong_min( tmp0, tmp1 );
+    tx->t1     = fd_ulong_max( tmp0, tmp1 ) + 1UL;
+    tx->reduce = (void *)fd_rng_ulong( rng ); tx->stride = fd_rng_ulong( rng );
+    /**/  tmp0 = fd_rng_ulong_roll( rng, FD_TILE_MAX+1UL );
+    /**/  tmp1 = fd_rng_ulong_roll( rng, FD_TILE_MAX+1UL );
+    tx->l0     = fd_ulong_min( tmp0, tmp1 );
+    tx->l1     = fd_ulong_max( tmp0, tmp1 );
+
+    fd_memset( steal_hit, 0, FD_TILE_MAX*sizeof(ulong) );
+    fd_tpool_exec_all_steal( tpool,tx->t0,tx->t1, steal, worker_steal, tx, tx->reduce,tx->stride, tx->l0,tx->l1 );
+    for( ulong l=0UL; l<FD_TILE_MAX; l++ ) FD_TEST( steal_hit[l]==(ulong)((tx->l0<=l) & (l<tx->l1)) );
+
+    FD_TEST( fd_tpool_steal_fini( steal )==(void *)steal_mem );
+  }
 # endif
 
   FD_LOG_NOTICE(( "Testing FD_FOR_ALL" ));
@@ -708,6 +837,37 @@ main( int     argc,
     }
   }
 
+# if FD_HAS_ATOMIC
+  FD_LOG_NOTICE(( "Benchmarking exec_all_taskq vs exec_all_steal (%lu non-uniform tasks)", BENCH_TASK_CNT ));
+
+  fd_tpool_steal_t * steal = fd_tpool_steal_init( steal_mem, tile_cnt, 64UL ); FD_TEST( steal );
+
+  for( ulong worker_cnt=1UL; worker_cnt<=tile_cnt; worker_cnt++ ) {
+    ulong bench_iter_cnt = 16UL;
+
+    /* warmup */
+    fd_tpool_exec_all_taskq( tpool, 0UL,worker_cnt, worker_bench_taskq, NULL, NULL,NULL,0UL, 0UL,BENCH_TASK_CNT );
+    fd_tpool_exec_all_steal( tpool, 0UL,worker_cnt, steal, worker_bench_steal, NULL,NULL,0UL, 0UL,BENCH_TASK_CNT );
+
+    /* for real */
+    long dt_taskq = -fd_log_wallclock();
+    for( ulong rem=bench_iter_cnt; rem; rem-- )
+      fd_tpool_exec_all_taskq( tpool, 0UL,worker_cnt, worker_bench_taskq, NULL, NULL,NULL,0UL, 0UL,BENCH_TASK_CNT );
+    dt_taskq += fd_log_wallclock();
+
+    long dt_steal = -fd_log_wallclock();
+    for( ulong rem=bench_iter_cnt; rem; rem-- )
+      fd_tpool_exec_all_steal( tpool, 0UL,worker_cnt, steal, worker_bench_steal, NULL,NULL,0UL, 0UL,BENCH_TASK_CNT );
+    dt_steal += fd_log_wallclock();
+
+    float norm = 1.f / ((float)(bench_iter_cnt*BENCH_TASK_CNT));
+    FD_LOG_NOTICE(( "%4lu workers taskq %9.3f ns/task steal %9.3f ns/task", worker_cnt,
+                    (double)(norm*(float)dt_taskq), (double)(norm*(float)dt_steal) ));
+  }
+
+  FD_TEST( fd_tpool_steal_fini( steal )==(void *)steal_mem );
+# endif
+
   FD_LOG_NOTICE(( "Benchmarking FOR_ALL" ));
 
   for( ulong worker_cnt=1UL; worker_cnt<=tile_cnt; worker_cnt++ ) {
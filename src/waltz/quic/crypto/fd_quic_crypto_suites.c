@@ -251,13 +251,18 @@ fd_quic_crypto_encrypt(
   return FD_QUIC_SUCCESS;
 }
 
-int
-fd_quic_crypto_decrypt(
-    uchar *                       buf,
-    ulong                         buf_sz,
-    ulong                         pkt_number_off,
-    ulong                         pkt_number,
-    fd_quic_crypto_keys_t const * keys ) {
+/* fd_quic_crypto_decrypt_private decrypts a packet with a gcm object
+   already initialized with the packet protection key.  iv is the
+   packet protection IV. */
+
+static int
+fd_quic_crypto_decrypt_private(
+    uchar *        buf,
+    ulong          buf_sz,
+    ulong          pkt_number_off,
+    ulong          pkt_number,
+    uchar const *  quic_iv,
+    fd_aes_gcm_t * pkt_cipher ) {
 
   if( FD_UNLIKELY( ( pkt_number_off >= buf_sz      ) |
                    ( buf_sz < FD_QUIC_SHORTEST_PKT ) ) ) {
@@ -276,7 +281,6 @@ fd_quic_crypto_decrypt(
      packet number is 1-4 bytes, so only XOR last pkt_number_sz bytes */
   uchar nonce[FD_QUIC_NONCE_SZ] = {0};
   uint nonce_tmp = FD_QUIC_NONCE_SZ - 4;
-  uchar const * quic_iv = keys->iv;
   fd_memcpy( nonce, quic_iv, nonce_tmp );
   for( uint k = 0; k < 4; ++k ) {
     uint j = nonce_tmp + k;
@@ -302,8 +306,7 @@ fd_quic_crypto_decrypt(
   uchar * const gcm_tag = buf_end - FD_QUIC_CRYPTO_TAG_SZ;
   ulong   const gcm_sz  = (ulong)( gcm_tag - out );
 
-  fd_aes_gcm_t pkt_cipher[1];
-  fd_aes_128_gcm_init( pkt_cipher, keys->pkt_key, nonce );
+  fd_aes_gcm_set_iv( pkt_cipher, nonce );
 
   int decrypt_ok =
    fd_aes_gcm_decrypt( pkt_cipher,
@@ -319,13 +322,38 @@ fd_quic_crypto_decrypt(
   return FD_QUIC_SUCCESS;
 }
 
+int
+fd_quic_crypto_decrypt(
+    uchar *                       buf,
+    ulong                         buf_sz,
+    ulong                         pkt_number_off,
+    ulong                         pkt_number,
+    fd_quic_crypto_keys_t const * keys ) {
+  fd_aes_gcm_t pkt_cipher[1];
+  fd_aes_128_gcm_init( pkt_cipher, keys->pkt_key, keys->iv );
+  return fd_quic_crypto_decrypt_private( buf, buf_sz, pkt_number_off, pkt_number, keys->iv, pkt_cipher );
+}
 
 int
-fd_quic_crypto_decrypt_hdr(
-    uchar *                        buf,
-    ulong                          buf_sz,
-    ulong                          pkt_number_off,
-    fd_quic_crypto_keys_t const *  keys ) {
+fd_quic_crypto_rx_decrypt(
+    uchar *               buf,
+    ulong                 buf_sz,
+    ulong                 pkt_number_off,
+    ulong                 pkt_number,
+    fd_quic_crypto_rx_t * rx ) {
+  return fd_quic_crypto_decrypt_private( buf, buf_sz, pkt_number_off, pkt_number, rx->iv, rx->gcm );
+}
+
+
+/* fd_quic_crypto_decrypt_hdr_private removes header protection using
+   the expanded header protection key ecb. */
+
+static int
+fd_quic_crypto_decrypt_hdr_private(
+    uchar *              buf,
+    ulong                buf_sz,
+    ulong                pkt_number_off,
+    fd_aes_key_t *       ecb ) {
 
   /* bounds checks */
   if( FD_UNLIKELY( ( buf_sz < FD_QUIC_CRYPTO_TAG_SZ ) |
@@ -345,10 +373,7 @@ fd_quic_crypto_decrypt_hdr(
 
   uchar * sample = buf + sample_off;
 
-  /* TODO this is hardcoded to AES-128 */
   uchar hp_cipher[16];
-  fd_aes_key_t ecb[1];
-  fd_aes_set_encrypt_key( keys->hp_key, 128, ecb );
   fd_aes_encrypt( sample, hp_cipher, ecb );
 
   /* hp_cipher is mask */
@@ -372,3 +397,32 @@ fd_quic_crypto_decrypt_hdr(
 
   return FD_QUIC_SUCCESS;
 }
+
+int
+fd_quic_crypto_decrypt_hdr(
+    uchar *                        buf,
+    ulong                          buf_sz,
+    ulong                          pkt_number_off,
+    fd_quic_crypto_keys_t const *  keys ) {
+  /* TODO this is hardcoded to AES-128 */
+  fd_aes_key_t ecb[1];
+  fd_aes_set_encrypt_key( keys->hp_key, 128, ecb );
+  return fd_quic_crypto_decrypt_hdr_private( buf, buf_sz, pkt_number_off, ecb );
+}
+
+int
+fd_quic_crypto_rx_decrypt_hdr(
+    uchar *                     buf,
+    ulong                       buf_sz,
+    ulong                       pkt_number_off,
+    fd_quic_crypto_rx_t *       rx ) {
+  return fd_quic_crypto_decrypt_hdr_private( buf, buf_sz, pkt_number_off, rx->hp );
+}
+
+void
+fd_quic_crypto_rx_init( fd_quic_crypto_rx_t *         rx,
+                        fd_quic_crypto_keys_t const * keys ) {
+  fd_aes_128_gcm_init( rx->gcm, keys->pkt_key, keys->iv );
+  fd_aes_set_encrypt_key( keys->hp_key, 128, rx->hp );
+  memcpy( rx->iv, keys->iv, FD_AES_GCM_IV_SZ );
+}
@@ -2,6 +2,7 @@
 #define HEADER_fd_src_waltz_quic_crypto_fd_quic_crypto_suites_h
 
 #include "../fd_quic_enum.h"
+#include "../../../ballet/aes/fd_aes_base.h"
 #include "../../../ballet/aes/fd_aes_gcm.h"
 
 /* Defines the crypto suites used by QUIC v1.
@@ -41,6 +42,21 @@ struct fd_quic_crypto_keys {
   uchar hp_key [FD_AES_128_KEY_SZ];
 };
 
+/* fd_quic_crypto_rx_t holds the expanded form of a set of incoming
+   keys (the AES-GCM key schedule and GHASH key powers of pkt_key, and
+   the AES key schedule of hp_key).  Expanding keys costs more than
+   decrypting a typical small packet, so the hot receive path decrypts
+   with a fd_quic_crypto_rx_t built once per key install instead of
+   with the raw fd_quic_crypto_keys_t. */
+
+struct __attribute__((aligned(FD_AES_GCM_ALIGN))) fd_quic_crypto_rx {
+  fd_aes_gcm_t gcm[1];
+  fd_aes_key_t hp [1];
+  uchar        iv [FD_AES_GCM_IV_SZ];
+};
+
+typedef struct fd_quic_crypto_rx fd_quic_crypto_rx_t;
+
 /* define enums for encryption levels */
 #define fd_quic_enc_level_initial_id    0
 #define fd_quic_enc_level_early_data_id 1
@@ -234,4 +250,30 @@ fd_quic_crypto_decrypt_hdr(
     ulong                          pkt_number_off,
     fd_quic_crypto_keys_t const *  keys );
 
+/* fd_quic_crypto_rx_init expands keys into rx.  rx must be initialized
+   again whenever the keys change (e.g. on key update). */
+
+void
+fd_quic_crypto_rx_init( fd_quic_crypto_rx_t *         rx,
+                        fd_quic_crypto_keys_t const * keys );
+
+/* fd_quic_crypto_rx_decrypt_{hdr,} are equivalent to
+   fd_quic_crypto_decrypt_{hdr,} with the keys rx was initialized
+   with. */
+
+int
+fd_quic_crypto_rx_decrypt_hdr(
+    uchar *                        buf,
+    ulong                          buf_sz,
+    ulong                          pkt_number_off,
+    fd_quic_crypto_rx_t *          rx );
+
+int
+fd_quic_crypto_rx_decrypt(
+    uchar *                        buf,
+    ulong                          buf_sz,
+    ulong                          pkt_number_off,
+    ulong                          pkt_number,
+    fd_quic_crypto_rx_t *          rx );
+
 #endif /* HEADER_fd_src_waltz_quic_crypto_fd_quic_crypto_suites_h */
@@ -385,6 +385,13 @@ fd_quic_init( fd_quic_t * quic ) {
   if( FD_UNLIKELY( !config->retry_ttl     ) ) { FD_LOG_WARNING(( "zero cfg.retry_ttl"    )); return NULL; }
   if( FD_UNLIKELY( !quic->cb.now          ) ) { FD_LOG_WARNING(( "NULL cb.now"           )); return NULL; }
   if( FD_UNLIKELY( config->tick_per_us==0 ) ) { FD_LOG_WARNING(( "zero cfg.tick_per_us"  )); return NULL; }
+  if( FD_UNLIKELY( config->conn_id_shard_cnt > FD_QUIC_CONN_ID_SHARD_MAX ||
+                   ( config->conn_id_shard_cnt &&
+                     config->conn_id_shard_idx >= config->conn_id_shard_cnt ) ) ) {
+    FD_LOG_WARNING(( "invalid cfg.conn_id_shard_{cnt,idx} (%u,%u)",
+                     config->conn_id_shard_cnt, config->conn_id_shard_idx ));
+    return NULL;
+  }
 
   do {
     ulong x = 0U;
@@ -797,6 +804,19 @@ fd_quic_conn_query( fd_quic_conn_map_t * map,
   return conn;
 }
 
+/* fd_quic_conn_id_gen picks a new random conn ID for use as one of
+   our own conn IDs, tagged with our shard index if configured. */
+
+static ulong
+fd_quic_conn_id_gen( fd_quic_t const * quic,
+                     fd_rng_t *        rng ) {
+  ulong conn_id = fd_rng_ulong( rng );
+  if( quic->config.conn_id_shard_cnt ) {
+    conn_id = fd_quic_conn_id_shard_set( conn_id, quic->config.conn_id_shard_idx );
+  }
+  return conn_id;
+}
+
 /* Helpers for generating fd_quic_log entries */
 
 static fd_quic_log_hdr_t
@@ -1526,13 +1546,13 @@ fd_quic_handle_v1_initial( fd_quic_t *               quic,
 
       /* Handle retry if configured. */
       if( !quic->config.retry ) {
-        scid = fd_rng_ulong( state->_rng );
+        scid = fd_quic_conn_id_gen( quic, state->_rng );
       } else {
         fd_quic_metrics_t * metrics = &quic->metrics;
 
         /* This is the initial packet before retry. */
         if( initial->token_len == 0 ) {
-          ulong new_conn_id_u64 = fd_rng_ulong( state->_rng );
+          ulong new_conn_id_u64 = fd_quic_conn_id_gen( quic, state->_rng );
           if( FD_UNLIKELY( fd_quic_send_retry(
                 quic, pkt,
                 &odcid, peer_scid, new_conn_id_u64,
@@ -2042,6 +2062,7 @@ fd_quic_key_update_complete( fd_quic_conn_t * conn ) {
   memcpy( conn->keys[enc_level][0].iv,      conn->new_keys[0].iv,      FD_AES_GCM_IV_SZ  );
   memcpy( conn->keys[enc_level][1].pkt_key, conn->new_keys[1].pkt_key, FD_AES_128_KEY_SZ );
   memcpy( conn->keys[enc_level][1].iv,      conn->new_keys[1].iv,      FD_AES_GCM_IV_SZ  );
+  fd_quic_crypto_rx_init( conn->rx_1rtt, &conn->keys[enc_level][0] );
 
   /* Update IVs */
   memcpy( conn->secrets.secret[enc_level][0], conn->secrets.new_secret[0], FD_QUIC_SECRET_SZ );
@@ -2085,9 +2106,9 @@ fd_quic_handle_v1_one_rtt( fd_quic_t *      quic,
 
 # if !FD_QUIC_DISABLE_CRYPTO
   if( FD_UNLIKELY(
-        fd_quic_crypto_decrypt_hdr( cur_ptr, tot_sz,
-                                    pn_offset,
-                                    &conn->keys[3][0] ) != FD_QUIC_SUCCESS ) ) {
+        fd_quic_crypto_rx_decrypt_hdr( cur_ptr, tot_sz,
+                                       pn_offset,
+                                       conn->rx_1rtt ) != FD_QUIC_SUCCESS ) ) {
     FD_DEBUG( FD_LOG_DEBUG(( "fd_quic_crypto_decrypt_hdr failed" )) );
     quic->metrics.pkt_decrypt_fail_cnt[ fd_quic_enc_level_appdata_id ]++;
     return FD_QUIC_PARSE_FAIL;
@@ -2109,15 +2130,17 @@ fd_quic_handle_v1_one_rtt( fd_quic_t *      quic,
 
 # if !FD_QUIC_DISABLE_CRYPTO
   /* If the key phase bit flips, decrypt with the new pair of keys
-      instead.  Note that the key phase bit is untrusted at this point. */
-  fd_quic_crypto_keys_t * keys = current_key_phase ? &conn->keys[3][0] : &conn->new_keys[0];
+      instead.  Note that the key phase bit is untrusted at this point.
+      Packets of the current key phase use the expanded keys. */
+  int decrypt_rc;
+  if( FD_LIKELY( current_key_phase ) ) {
+    decrypt_rc = fd_quic_crypto_rx_decrypt( cur_ptr, tot_sz, pn_offset, pkt_number, conn->rx_1rtt );
+  } else {
+    decrypt_rc = fd_quic_crypto_decrypt( cur_ptr, tot_sz, pn_offset, pkt_number, &conn->new_keys[0] );
+  }
 
   /* this decrypts the header and payload */
-  if( FD_UNLIKELY(
-        fd_quic_crypto_decrypt( cur_ptr, tot_sz,
-                                pn_offset,
-                                pkt_number,
-                                keys ) != FD_QUIC_SUCCESS ) ) {
+  if( FD_UNLIKELY( decrypt_rc != FD_QUIC_SUCCESS ) ) {
     /* remove connection from map, and insert into free list */
     FD_DTRACE_PROBE_3( quic_err_decrypt_1rtt_pkt, pkt->ip4, conn->our_conn_id, pkt->pkt_number );
     quic->metrics.pkt_decrypt_fail_cnt[ fd_quic_enc_level_appdata_id ]++;
@@ -2603,6 +2626,7 @@ fd_quic_tls_cb_secret( fd_quic_tls_hs_t *           hs,
 
   if( enc_level==fd_quic_enc_level_appdata_id ) {
     fd_quic_key_update_derive( &conn->secrets, conn->new_keys );
+    fd_quic_crypto_rx_init( conn->rx_1rtt, &conn->keys[enc_level][0] );
   }
 
   /* Key logging */
@@ -4121,7 +4145,7 @@ fd_quic_connect( fd_quic_t *  quic,
 
   /* create conn ids for us and them
      client creates connection id for the peer, peer immediately replaces it */
-  ulong our_conn_id_u64 = fd_rng_ulong( rng );
+  ulong our_conn_id_u64 = fd_quic_conn_id_gen( quic, rng );
   fd_quic_conn_id_t peer_conn_id;  fd_quic_conn_id_rand( &peer_conn_id, rng );
 
   fd_quic_conn_t * conn = fd_quic_conn_create(
@@ -179,6 +179,14 @@ struct __attribute__((aligned(16UL))) fd_quic_config {
   ulong retry_ttl;
 # define FD_QUIC_DEFAULT_RETRY_TTL (ulong)(1e9) /* 1s */
 
+  /* conn_id_shard_{cnt,idx}: If conn_id_shard_cnt is non-zero, all conn
+     IDs picked by this fd_quic are tagged with shard index
+     conn_id_shard_idx in [0,conn_id_shard_cnt) (see
+     fd_quic_conn_id_shard_set).  conn_id_shard_cnt is at most
+     FD_QUIC_CONN_ID_SHARD_MAX.  Zero disables tagging. */
+  uint conn_id_shard_cnt;
+  uint conn_id_shard_idx;
+
   /* TLS config ********************************************/
 
   /* identity_key: Ed25519 public key of node identity */
@@ -162,11 +162,15 @@ struct fd_quic_conn {
                     and direction (d==0 is incoming, d==1 is outgoing)
        new_keys[e]: App keys to use for the next key update.  Once app
                     keys are available these are always kept up-to-date
-       keys_avail:  Bit set of available keys, LSB indexed by enc level */
+       keys_avail:  Bit set of available keys, LSB indexed by enc level
+       rx_1rtt:     Expanded form of keys[appdata][0], used to decrypt
+                    1-RTT packets of the current key phase.  Valid if
+                    app keys are available */
   fd_quic_crypto_secrets_t secrets;
   fd_quic_crypto_keys_t    keys[FD_QUIC_NUM_ENC_LEVELS][2];
   fd_quic_crypto_keys_t    new_keys[2];
   uint                     keys_avail;
+  fd_quic_crypto_rx_t      rx_1rtt[1];
 
   fd_quic_stream_t         send_streams[1];      /* sentinel of list of streams needing action */
   fd_quic_stream_t         used_streams[1];      /* sentinel of list of used streams */
@@ -59,6 +59,45 @@ fd_quic_conn_id_rand( fd_quic_conn_id_t * conn_id,
   return conn_id;
 }
 
+/* Conn ID sharding
+
+   Multiple fd_quic instances (e.g. one per quic tile) can share one
+   UDP port if every packet is delivered to the instance that owns the
+   destination conn.  For this, each instance tags the conn IDs it
+   picks for itself with a shard index in [0,FD_QUIC_CONN_ID_SHARD_MAX)
+   in the first byte of the conn ID.  A load balancer can then steer
+   short header packets (which carry no other connection state) by
+   looking at a single byte at a fixed offset.  Long header packets
+   should be steered by a hash of the source address instead, since
+   the initial destination conn ID is picked by the client. */
+
+#define FD_QUIC_CONN_ID_SHARD_MAX (256UL)
+
+/* fd_quic_conn_id_shard_set returns the 8 byte conn ID conn_id (as
+   loaded via fd_ulong_load_8) with its first byte replaced by
+   shard_idx. */
+
+FD_FN_CONST static inline ulong
+fd_quic_conn_id_shard_set( ulong conn_id,
+                           ulong shard_idx ) {
+  return (conn_id & ~0xffUL) | (shard_idx & 0xffUL);
+}
+
+/* fd_quic_pkt_shard returns the shard index in
+   [0,FD_QUIC_CONN_ID_SHARD_MAX) encoded in the destination conn ID of
+   the QUIC datagram at payload of size sz (i.e. UDP payload).  Returns
+   -1 if the datagram starts with a long header packet or is too short
+   to contain a Firedancer conn ID.  Does not validate the datagram any
+   further. */
+
+FD_FN_PURE static inline int
+fd_quic_pkt_shard( uchar const * payload,
+                   ulong         sz ) {
+  if( FD_UNLIKELY( sz<1UL+FD_QUIC_CONN_ID_SZ ) ) return -1;
+  if( payload[0] & 0x80 ) return -1; /* long header */
+  return (int)payload[1];
+}
+
 FD_PROTOTYPES_END
 
 /* Defines a NULL connection id
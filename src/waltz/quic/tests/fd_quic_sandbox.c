@@ -305,6 +305,7 @@ fd_quic_sandbox_new_conn_established( fd_quic_sandbox_t * sandbox,
   conn->handshake_complete = 1;
   conn->peer_enc_level     = fd_quic_enc_level_appdata_id;
   conn->keys_avail         = 1U<<fd_quic_enc_level_appdata_id;
+  fd_quic_crypto_rx_init( conn->rx_1rtt, &conn->keys[ fd_quic_enc_level_appdata_id ][ 0 ] );
 
   conn->idle_timeout  = FD_QUIC_SANDBOX_IDLE_TIMEOUT;
   conn->last_activity = sandbox->wallclock;
@@ -169,6 +169,7 @@ LLVMFuzzerTestOneInput( uchar const * data,
   if( established ) {
     conn->state = FD_QUIC_CONN_STATE_ACTIVE;
     conn->keys_avail = 0xff;
+    fd_quic_crypto_rx_init( conn->rx_1rtt, &conn->keys[ fd_quic_enc_level_appdata_id ][ 0 ] );
   }
 
   g_clock = 1000UL;
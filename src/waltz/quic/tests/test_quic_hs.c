@@ -113,6 +113,12 @@ main( int argc, char ** argv ) {
   server_quic->config.initial_rx_max_stream_data = 1<<16;
   client_quic->config.initial_rx_max_stream_data = 1<<16;
 
+  /* Tag conn IDs with shard indices */
+  server_quic->config.conn_id_shard_cnt = 4U;
+  server_quic->config.conn_id_shard_idx = 3U;
+  client_quic->config.conn_id_shard_cnt = 2U;
+  client_quic->config.conn_id_shard_idx = 1U;
+
   FD_LOG_NOTICE(( "Creating virtual pair" ));
   fd_quic_virtual_pair_t vp;
   fd_quic_virtual_pair_init( &vp, server_quic, client_quic );
@@ -142,6 +148,20 @@ main( int argc, char ** argv ) {
     }
   }
 
+  FD_TEST( server_conn );
+  FD_TEST( (server_conn->our_conn_id & 0xffUL)==3UL );
+  FD_TEST( (client_conn->our_conn_id & 0xffUL)==1UL );
+  FD_TEST( client_conn->peer_cids[0].conn_id[0]==3 );
+  FD_TEST( server_conn->peer_cids[0].conn_id[0]==1 );
+
+  do {
+    uchar pkt[ 16 ] = { 0x40, 0x03, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff, 0x11, 0x22 };
+    FD_TEST( fd_quic_pkt_shard( pkt, 9UL )==3 );
+    FD_TEST( fd_quic_pkt_shard( pkt, 8UL )==-1 );
+    pkt[0] = 0xc0; /* long header */
+    FD_TEST( fd_quic_pkt_shard( pkt, 16UL )==-1 );
+  } while(0);
+
   /* TODO detect missing QUIC transport params */
 
   /* TODO we get callback before the call to fd_quic_conn_new_stream can complete
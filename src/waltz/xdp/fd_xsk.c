@@ -38,7 +38,7 @@ fd_xsk_align( void ) {
   return FD_XSK_ALIGN;
 }
 
-static ulong
+FD_FN_CONST ulong
 fd_xsk_umem_footprint( ulong frame_sz,
                        ulong fr_depth,
                        ulong rx_depth,
@@ -287,12 +287,14 @@ fd_xsk_fini( fd_xsk_t * xsk ) {
    getsockopt().  Returns 1 on success, 0 on failure. */
 static int
 fd_xsk_setup_umem( fd_xsk_t * xsk ) {
-  /* Find byte offset of UMEM area */
-  ulong umem_off = fd_ulong_align_up( sizeof(fd_xsk_t), FD_XSK_UMEM_ALIGN );
+  /* Find UMEM area, either following the fd_xsk_t or external (see
+     fd_xsk_set_umem) */
+  ulong umem_off  = fd_ulong_align_up( sizeof(fd_xsk_t), FD_XSK_UMEM_ALIGN );
+  ulong umem_addr = fd_ulong_if( !!xsk->umem_ext, xsk->umem_ext, (ulong)xsk + umem_off );
 
   /* Initialize xdp_umem_reg */
   xsk->umem.headroom   = 0; /* TODO no need for headroom for now */
-  xsk->umem.addr       = (ulong)xsk + umem_off;
+  xsk->umem.addr       = umem_addr;
   xsk->umem.chunk_size = (uint)xsk->params.frame_sz;
   xsk->umem.len        =       xsk->params.umem_sz;
 
@@ -334,6 +336,28 @@ fd_xsk_setup_umem( fd_xsk_t * xsk ) {
   return 0;
 }
 
+fd_xsk_t *
+fd_xsk_set_umem( fd_xsk_t * xsk,
+                 void *     umem ) {
+
+  if( FD_UNLIKELY( !xsk ) ) { FD_LOG_WARNING(( "NULL xsk" )); return NULL; }
+
+  if( FD_UNLIKELY( !umem ) ) { FD_LOG_WARNING(( "NULL umem" )); return NULL; }
+
+  if( FD_UNLIKELY( !fd_ulong_is_aligned( (ulong)umem, FD_XSK_UMEM_ALIGN ) ) ) {
+    FD_LOG_WARNING(( "misaligned umem" ));
+    return NULL;
+  }
+
+  if( FD_UNLIKELY( xsk->xsk_fd>=0 ) ) {
+    FD_LOG_WARNING(( "xsk already initialized" ));
+    return NULL;
+  }
+
+  xsk->umem_ext = (ulong)umem;
+  return xsk;
+}
+
 /* fd_xsk_init: Creates and configures an XSK socket object, and
    attaches to a preinstalled XDP program.  The various steps are
    implemented in fd_xsk_setup_{...}. */
@@ -166,6 +166,17 @@ fd_xsk_footprint( ulong frame_sz,
                   ulong tx_depth,
                   ulong cr_depth );
 
+/* fd_xsk_umem_footprint returns the footprint of the UMEM area (the
+   frame memory) of an fd_xsk_t with the given parameters.  This is the
+   part of fd_xsk_footprint following the fd_xsk_t itself. */
+
+FD_FN_CONST ulong
+fd_xsk_umem_footprint( ulong frame_sz,
+                       ulong fr_depth,
+                       ulong rx_depth,
+                       ulong tx_depth,
+                       ulong cr_depth );
+
 /* fd_xsk_new formats an unused memory region for use as an fd_xsk_t.
    shmem must point to a memory region that matches fd_xsk_align() and
    fd_xsk_footprint().  frame_sz controls the frame size used in the
@@ -188,6 +199,21 @@ fd_xsk_new( void * shmem,
 fd_xsk_t *
 fd_xsk_join( void * shxsk );
 
+/* fd_xsk_set_umem makes xsk use the UMEM area at umem (in the
+   caller's local address space) instead of the one following the
+   fd_xsk_t.  umem must be aligned by FD_XSK_UMEM_ALIGN, have room for
+   fd_xsk_umem_footprint bytes and outlive the xsk.  This allows placing
+   the frames in memory shared with other processes, such that received
+   packets can be handed to them without a copy.  In that case, the
+   memory region of the fd_xsk_t only needs to be
+   fd_xsk_footprint-fd_xsk_umem_footprint bytes.  Must be called after
+   fd_xsk_join and before fd_xsk_init.  Returns xsk on success and NULL
+   on failure (logs details). */
+
+fd_xsk_t *
+fd_xsk_set_umem( fd_xsk_t * xsk,
+                 void *     umem );
+
 /* fd_xsk_init creates an XSK, registers UMEM, maps rings, and binds the
    socket to the given interface queue.  This is a potentially
    destructive operation.  As of 2024-Jun, AF_XDP zero copy support is
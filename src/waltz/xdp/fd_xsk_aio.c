@@ -139,6 +139,7 @@ fd_xsk_aio_join( void *     shxsk_aio,
   fd_aio_delete( &xsk_aio->tx );
 
   xsk_aio->frame_mem      = fd_xsk_umem_laddr( xsk );
+  xsk_aio->rx_defer       = 0;
   xsk_aio->frame_sz       = params->frame_sz;
   xsk_aio->rx_off         = 0;
   xsk_aio->tx_off         = params->rx_depth;
@@ -243,6 +244,24 @@ fd_xsk_aio_set_rx( fd_xsk_aio_t *   xsk_aio,
   fd_memcpy( &xsk_aio->rx, aio, sizeof(fd_aio_t) );
 }
 
+void
+fd_xsk_aio_set_rx_defer( fd_xsk_aio_t * xsk_aio,
+                         int            defer ) {
+  xsk_aio->rx_defer = !!defer;
+}
+
+void
+fd_xsk_aio_rx_release( fd_xsk_aio_t * xsk_aio,
+                       ulong *        frame_off,
+                       ulong          cnt ) {
+  /* The fill ring has room for all rx frames, so this only spins
+     while the kernel catches up */
+  ulong frame_mask = ~(xsk_aio->frame_sz-1UL);
+  for( ulong j=0UL; j<cnt; j++ ) frame_off[ j ] &= frame_mask;
+  ulong j = 0UL;
+  while( j<cnt ) j += fd_xsk_rx_enqueue( xsk_aio->xsk, frame_off + j, cnt - j );
+}
+
 
 int
 fd_xsk_aio_service( fd_xsk_aio_t * xsk_aio ) {
@@ -272,15 +291,17 @@ fd_xsk_aio_service( fd_xsk_aio_t * xsk_aio ) {
     xsk_aio->metrics.rx_cnt += rx_avail;
     for( ulong j=0; j<rx_avail; j++ ) xsk_aio->metrics.rx_sz += meta[j].sz;
 
-    /* return frames to rx ring */
-    ulong enq_rc = fd_xsk_rx_enqueue2( xsk, meta, rx_avail );
-    if( FD_UNLIKELY( enq_rc < rx_avail ) ) {
-      /* keep trying indefinitely */
-      /* TODO consider adding a timeout */
-      ulong j = enq_rc;
-      while( rx_avail > j ) {
-        ulong enq_rc = fd_xsk_rx_enqueue2( xsk, meta + j, rx_avail - j );
-        j += enq_rc;
+    /* return frames to rx ring, unless the receiver keeps them */
+    if( FD_LIKELY( !xsk_aio->rx_defer ) ) {
+      ulong enq_rc = fd_xsk_rx_enqueue2( xsk, meta, rx_avail );
+      if( FD_UNLIKELY( enq_rc < rx_avail ) ) {
+        /* keep trying indefinitely */
+        /* TODO consider adding a timeout */
+        ulong j = enq_rc;
+        while( rx_avail > j ) {
+          ulong enq_rc = fd_xsk_rx_enqueue2( xsk, meta + j, rx_avail - j );
+          j += enq_rc;
+        }
       }
     }
   }
@@ -84,6 +84,30 @@ void
 fd_xsk_aio_set_rx( fd_xsk_aio_t *   xsk_aio,
                    fd_aio_t const * aio );
 
+/* fd_xsk_aio_set_rx_defer sets whether the frames of received packets
+   get returned to the fd_xsk_t as soon as the rx callback returns
+   (defer==0, the default after join) or stay owned by the caller until
+   released with fd_xsk_aio_rx_release (defer!=0).  Deferring allows
+   the caller to hand out received packets in place, e.g. when the
+   UMEM is in memory shared with consumers of the packets (see
+   fd_xsk_set_umem).  Note that the fd_xsk_t stops receiving once all
+   of its rx_depth frames are owned by the caller. */
+
+void
+fd_xsk_aio_set_rx_defer( fd_xsk_aio_t * xsk_aio,
+                         int            defer );
+
+/* fd_xsk_aio_rx_release returns the frames of cnt received packets to
+   the fd_xsk_t for reuse.  frame_off[i] for i in [0,cnt) is the byte
+   offset of a packet (or its frame) from the start of the UMEM area.
+   Each frame must have been received while deferring and must be
+   released exactly once. */
+
+void
+fd_xsk_aio_rx_release( fd_xsk_aio_t * xsk_aio,
+                       ulong *        frame_off,
+                       ulong          cnt );
+
 /* fd_xsk_aio_get_tx gets the fd_aio_t instance to send data out to the
    network via the underlying fd_xsk_t.  Each aio send does at most one
    call to fd_xsk_tx_enqueue and may yield FD_AIO_ERR_AGAIN if the XSK
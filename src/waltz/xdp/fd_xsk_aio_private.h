@@ -24,6 +24,7 @@ struct __attribute__((aligned(FD_XSK_AIO_ALIGN))) fd_xsk_aio_private {
   fd_aio_t   rx;  /* from outside to user (externally owned) */
   fd_aio_t   tx;  /* from user to outside (owned by fd_xsk_aio) */
   void *     frame_mem; /* Address of start of frame memory */
+  int        rx_defer;  /* If non-zero, rx frames are returned with fd_xsk_aio_rx_release */
 
   /* {rx,tx}_off: Offset from frame_mem to {rx,tx} frames.
      Unit is xsk->frame_sz. TODO consider using byte offset */
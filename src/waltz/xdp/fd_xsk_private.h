@@ -71,6 +71,10 @@ struct __attribute__((aligned(FD_XSK_ALIGN))) fd_xsk_private {
   /* Kernel descriptor of UMEM in local address space */
   struct xdp_umem_reg umem;
 
+  /* Local address of an external UMEM area (see fd_xsk_set_umem), 0 if
+     the UMEM area follows the fd_xsk_t */
+  ulong umem_ext;
+
   /* Kernel descriptor of XSK rings in local address space
      returned by getsockopt(SOL_XDP, XDP_MMAP_OFFSETS) */
   struct xdp_mmap_offsets offsets;
@@ -629,6 +629,29 @@ test_xsk_aio( void ) {
     FD_TEST( _rx_batch[i].buf_sz==3U );
   }
 
+  /* Receive packets with deferred frame release */
+
+  fd_xsk_aio_set_rx_defer( xsk_aio, 1 );
+
+  test_xsk_ring_fr.cons = 18U;
+  for( uint i=10U; i<12U; i++ )
+    test_xsk_ring_rx.packets[i%8UL] =
+      (struct xdp_desc) { .addr=(i%8)*2048U, .len=3U };
+  test_xsk_ring_rx.prod = 12U;
+
+  fd_xsk_aio_service( xsk_aio );
+
+  FD_TEST( _rx_call_cnt==3UL );
+  FD_TEST( test_xsk_ring_rx.cons==12U );
+  FD_TEST( test_xsk_ring_fr.prod==18U );
+
+  ulong frame_off[2] = { 2UL*2048UL+64UL, 3UL*2048UL };
+  fd_xsk_aio_rx_release( xsk_aio, frame_off, 2UL );
+
+  FD_TEST( test_xsk_ring_fr.prod==20U );
+  FD_TEST( test_xsk_ring_fr.frame_idxs[ 18%8 ]==2UL*2048UL );
+  FD_TEST( test_xsk_ring_fr.frame_idxs[ 19%8 ]==3UL*2048UL );
+
   /* Clean up */
 
   FD_TEST( fd_xsk_aio_leave ( xsk_aio   ) );